@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkmlib/DataSetConverters.h"
+
+//------------------------------------------------------------------------------
+int TestVTKMConvertCached(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(8, 8, 8);
+
+  vtkNew<vtkFloatArray> values;
+  values->SetName("values");
+  values->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < values->GetNumberOfTuples(); ++i)
+  {
+    values->SetValue(i, static_cast<float>(i));
+  }
+  image->GetPointData()->AddArray(values);
+
+  // Two conversions of an unchanged dataset must share the same cell set.
+  vtkm::cont::DataSet first = tovtkm::ConvertCached(image, tovtkm::FieldsFlag::Points);
+  vtkm::cont::DataSet second = tovtkm::ConvertCached(image, tovtkm::FieldsFlag::Points);
+  if (first.GetCellSet().GetCellSetBase() != second.GetCellSet().GetCellSetBase())
+  {
+    std::cerr << "Unchanged dataset was re-converted" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!second.HasPointField("values"))
+  {
+    std::cerr << "Cached conversion lost the point field" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Requesting more fields than cached widens the conversion in place.
+  vtkm::cont::DataSet widened = tovtkm::ConvertCached(image, tovtkm::FieldsFlag::PointsAndCells);
+  if (!widened.HasPointField("values"))
+  {
+    std::cerr << "Widened conversion lost the point field" << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkm::cont::DataSet widenedHit = tovtkm::ConvertCached(image, tovtkm::FieldsFlag::Points);
+  if (widened.GetCellSet().GetCellSetBase() != widenedHit.GetCellSet().GetCellSetBase())
+  {
+    std::cerr << "Narrower request after widening missed the cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Modifying the dataset must invalidate the cache.
+  image->Modified();
+  vtkm::cont::DataSet refreshed = tovtkm::ConvertCached(image, tovtkm::FieldsFlag::Points);
+  if (refreshed.GetCellSet().GetCellSetBase() == second.GetCellSet().GetCellSetBase())
+  {
+    std::cerr << "Modified dataset still served from the cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -20,6 +20,8 @@
 #include "vtkDataObjectTypes.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkNew.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
@@ -274,6 +276,71 @@ vtkm::cont::DataSet Convert(vtkDataSet* input, FieldsFlag fields)
   }
 }
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Holds a converted dataset in the information of the source vtkDataSet.
+// The vtkm::cont::DataSet inside shares its array handles with the VTK
+// arrays (where the layout permits zero copy), so keeping it alive costs
+// little beyond the structures that did need conversion.
+class ConvertedDataSetHolder : public vtkObjectBase
+{
+public:
+  vtkBaseTypeMacro(ConvertedDataSetHolder, vtkObjectBase);
+
+  static ConvertedDataSetHolder* New()
+  {
+    auto* holder = new ConvertedDataSetHolder;
+    holder->InitializeObjectBase();
+    return holder;
+  }
+
+  vtkm::cont::DataSet DataSet;
+  FieldsFlag Fields = FieldsFlag::None;
+  vtkMTimeType ConversionTime = 0;
+};
+
+vtkInformationObjectBaseKey* ConvertedDataSetKey()
+{
+  // Deleted at exit by the information key manager, like all keys.
+  static vtkInformationObjectBaseKey* key =
+    vtkInformationObjectBaseKey::MakeKey("CONVERTED_DATA_SET", "tovtkm");
+  return key;
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkm::cont::DataSet ConvertCached(vtkDataSet* input, FieldsFlag fields)
+{
+  vtkInformation* dataInfo = input->GetInformation();
+  auto* holder = static_cast<ConvertedDataSetHolder*>(ConvertedDataSetKey()->Get(dataInfo));
+
+  vtkMTimeType mtime = input->GetMTime();
+  if (holder && holder->ConversionTime == mtime && (holder->Fields & fields) == fields)
+  {
+    return holder->DataSet;
+  }
+
+  // When only the requested fields outgrow a current cache entry, widen
+  // the conversion so later callers with either request hit the cache.
+  FieldsFlag convertFields = fields;
+  if (holder && holder->ConversionTime == mtime)
+  {
+    convertFields = holder->Fields | fields;
+  }
+
+  vtkm::cont::DataSet converted = Convert(input, convertFields);
+
+  vtkSmartPointer<ConvertedDataSetHolder> newHolder =
+    vtkSmartPointer<ConvertedDataSetHolder>::Take(ConvertedDataSetHolder::New());
+  newHolder->DataSet = converted;
+  newHolder->Fields = convertFields;
+  newHolder->ConversionTime = mtime;
+  ConvertedDataSetKey()->Set(dataInfo, newHolder);
+
+  return converted;
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace tovtkm
 
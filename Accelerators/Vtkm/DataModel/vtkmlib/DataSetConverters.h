@@ -42,6 +42,15 @@ vtkm::cont::DataSet Convert(vtkRectilinearGrid* input, FieldsFlag fields);
 // determine the type and call the proper Convert routine
 VTKACCELERATORSVTKMDATAMODEL_EXPORT
 vtkm::cont::DataSet Convert(vtkDataSet* input, FieldsFlag fields = FieldsFlag::None);
+
+// Convert with a per-data-object cache. The converted dataset is kept
+// alive in the information of `input` and reused as long as the data
+// object's MTime is unchanged and the cached conversion covers the
+// requested fields, so chains of VTK-m-accelerated filters convert a
+// dataset once instead of once per filter per execution. Callers must
+// not mutate the returned dataset's arrays in place.
+VTKACCELERATORSVTKMDATAMODEL_EXPORT
+vtkm::cont::DataSet ConvertCached(vtkDataSet* input, FieldsFlag fields = FieldsFlag::None);
 VTK_ABI_NAMESPACE_END
 }
 
@@ -201,7 +201,7 @@ int vtkmContour::RequestData(
     }
 
     // convert the input dataset to a vtkm::cont::DataSet
-    vtkm::cont::DataSet in = tovtkm::Convert(input, tovtkm::FieldsFlag::PointsAndCells);
+    vtkm::cont::DataSet in = tovtkm::ConvertCached(input, tovtkm::FieldsFlag::PointsAndCells);
     if (!this->ComputeScalars)
     {
       // don't pass the scalar field
@@ -159,7 +159,7 @@ int vtkmGradient::RequestData(
     // convert the input dataset to a vtkm::cont::DataSet. We explicitly drop
     // all arrays from the conversion as this algorithm doesn't change topology
     // and therefore doesn't need input fields converted through the VTK-m filter
-    auto in = tovtkm::Convert(input, tovtkm::FieldsFlag::None);
+    auto in = tovtkm::ConvertCached(input, tovtkm::FieldsFlag::None);
     vtkm::cont::Field field = tovtkm::Convert(inputArray, association);
     in.AddField(field);
 
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include <vtkAxis.h>
+#include <vtkChartXY.h>
+#include <vtkContextScene.h>
+#include <vtkContextView.h>
+#include <vtkFloatArray.h>
+#include <vtkNew.h>
+#include <vtkPlotLine.h>
+#include <vtkPlotPoints.h>
+#include <vtkRenderWindow.h>
+#include <vtkTable.h>
+
+#include <cmath>
+
+int TestPlotPointBudget(int, char*[])
+{
+  // A series large enough to exceed the point budget
+  const int numPoints = 200000;
+  vtkNew<vtkTable> table;
+  vtkNew<vtkFloatArray> arrX;
+  arrX->SetName("X Axis");
+  table->AddColumn(arrX);
+  vtkNew<vtkFloatArray> arrS;
+  arrS->SetName("Sine");
+  table->AddColumn(arrS);
+  table->SetNumberOfRows(numPoints);
+  for (int i = 0; i < numPoints; ++i)
+  {
+    const double x = i * 0.001;
+    table->SetValue(i, 0, x);
+    table->SetValue(i, 1, std::sin(x) + 0.1 * std::sin(100.0 * x));
+  }
+
+  vtkNew<vtkContextView> view;
+  view->GetRenderWindow()->SetSize(400, 300);
+  vtkNew<vtkChartXY> chart;
+  view->GetScene()->AddItem(chart);
+
+  vtkPlotLine* line = vtkPlotLine::SafeDownCast(chart->AddPlot(vtkChart::LINE));
+  line->SetInputData(table, 0, 1);
+  line->SetPointBudget(10000);
+
+  vtkPlotPoints* points = vtkPlotPoints::SafeDownCast(chart->AddPlot(vtkChart::POINTS));
+  points->SetInputData(table, 0, 1);
+  points->SetPointBudget(10000);
+  if (points->GetPointBudget() != 10000)
+  {
+    std::cerr << "PointBudget was not stored" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Aggregated rendering of both plots.
+  view->GetRenderWindow()->Render();
+
+  // A different view transform rebuilds the aggregates.
+  chart->GetAxis(vtkAxis::BOTTOM)->SetRange(10.0, 20.0);
+  chart->GetAxis(vtkAxis::LEFT)->SetRange(-1.5, 1.5);
+  chart->RecalculateBounds();
+  view->GetRenderWindow()->Render();
+
+  // Zooming in below the budget restores the exact rendering.
+  chart->GetAxis(vtkAxis::BOTTOM)->SetRange(10.0, 10.05);
+  view->GetRenderWindow()->Render();
+
+  // Disabling the budget restores the exact rendering at any size.
+  line->SetPointBudget(0);
+  points->SetPointBudget(0);
+  view->GetRenderWindow()->Render();
+
+  return EXIT_SUCCESS;
+}
@@ -100,6 +100,10 @@ vtkAxis::vtkAxis()
   this->SetPosition(vtkAxis::LEFT);
   this->TickLabelAlgorithm = vtkAxis::TICK_SIMPLE;
   this->CustomTickLabels = false;
+  this->LabelBoundsCachePropertiesTime = 0;
+  this->LabelBoundsCacheTileScale = vtkVector2i(0);
+  this->CachedBoundingRect = vtkRectf(0, 0, 0, 0);
+  this->CachedBoundingRectTileScale = vtkVector2i(0);
 }
 
 //------------------------------------------------------------------------------
@@ -370,8 +374,8 @@ bool vtkAxis::Paint(vtkContext2D* painter)
     vtkStdString maxString =
       this->GenerateSprintfLabel(this->UnscaledMaximum, this->RangeLabelFormat);
 
-    painter->ComputeJustifiedStringBounds(minString.c_str(), minLabelBounds);
-    painter->ComputeJustifiedStringBounds(maxString.c_str(), maxLabelBounds);
+    this->GetLabelBounds(painter, minString, minLabelBounds, true);
+    this->GetLabelBounds(painter, maxString, maxLabelBounds, true);
 
     float minLabelShift[2] = { 0, 0 };
     float maxLabelShift[2] = { 0, 0 };
@@ -447,7 +451,7 @@ bool vtkAxis::Paint(vtkContext2D* painter)
       if (this->LabelsVisible)
       {
         float bounds[4];
-        painter->ComputeJustifiedStringBounds(tickLabel[i].c_str(), bounds);
+        this->GetLabelBounds(painter, tickLabel[i], bounds, true);
         float pos[2] = { this->Point1[0] + labelOffset, tickPos[i] };
         bounds[0] += pos[0];
         bounds[1] += pos[1];
@@ -481,7 +485,7 @@ bool vtkAxis::Paint(vtkContext2D* painter)
       if (this->LabelsVisible)
       {
         float bounds[4];
-        painter->ComputeJustifiedStringBounds(tickLabel[i].c_str(), bounds);
+        this->GetLabelBounds(painter, tickLabel[i], bounds, true);
         float pos[2] = { tickPos[i], this->Point1[1] + labelOffset };
         bounds[0] += pos[0];
         bounds[1] += pos[1];
@@ -964,6 +968,20 @@ bool vtkAxis::SetCustomTickPositions(vtkDoubleArray* positions, vtkStringArray*
 //------------------------------------------------------------------------------
 vtkRectf vtkAxis::GetBoundingRect(vtkContext2D* painter)
 {
+  // Reuse the last rect while nothing it was computed from has changed:
+  // dashboards with many charts lay their axes out every frame, and
+  // measuring every label is the expensive part of that.
+  vtkVector2i tileScale =
+    this->Scene ? this->Scene->GetLogicalTileScale() : vtkVector2i(1);
+  if (this->BoundingRectTime > this->GetMTime() &&
+    this->BoundingRectTime > this->TickLabels->GetMTime() &&
+    this->BoundingRectTime > this->LabelProperties->GetMTime() &&
+    this->BoundingRectTime > this->TitleProperties->GetMTime() &&
+    tileScale == this->CachedBoundingRectTileScale)
+  {
+    return this->CachedBoundingRect;
+  }
+
   bool vertical = false;
   if (this->Position == vtkAxis::LEFT || this->Position == vtkAxis::RIGHT ||
     this->Position == vtkAxis::PARALLEL)
@@ -977,10 +995,10 @@ vtkRectf vtkAxis::GetBoundingRect(vtkContext2D* painter)
   vtkRectf bounds(0, 0, 0, 0);
   if (this->LabelsVisible)
   {
+    painter->ApplyTextProp(this->LabelProperties);
     for (vtkIdType i = 0; i < this->TickLabels->GetNumberOfTuples(); ++i)
     {
-      painter->ApplyTextProp(this->LabelProperties);
-      painter->ComputeStringBounds(this->TickLabels->GetValue(i), bounds.GetData());
+      this->GetLabelBounds(painter, this->TickLabels->GetValue(i), bounds.GetData(), false);
       widest = bounds.GetWidth() > widest ? bounds.GetWidth() : widest;
       tallest = bounds.GetHeight() > tallest ? bounds.GetHeight() : tallest;
     }
@@ -994,11 +1012,12 @@ vtkRectf vtkAxis::GetBoundingRect(vtkContext2D* painter)
     vtkStdString maxLabel =
       this->GenerateSprintfLabel(this->UnscaledMaximum, this->RangeLabelFormat);
 
-    painter->ComputeStringBounds(minLabel, bounds.GetData());
+    painter->ApplyTextProp(this->LabelProperties);
+    this->GetLabelBounds(painter, minLabel, bounds.GetData(), false);
     widest = bounds.GetWidth() > widest ? bounds.GetWidth() : widest;
     tallest = bounds.GetHeight() > tallest ? bounds.GetHeight() : tallest;
 
-    painter->ComputeStringBounds(maxLabel, bounds.GetData());
+    this->GetLabelBounds(painter, maxLabel, bounds.GetData(), false);
     widest = bounds.GetWidth() > widest ? bounds.GetWidth() : widest;
     tallest = bounds.GetHeight() > tallest ? bounds.GetHeight() : tallest;
   }
@@ -1028,9 +1047,55 @@ vtkRectf vtkAxis::GetBoundingRect(vtkContext2D* painter)
                                                     : this->Point1[0] - this->Point2[0];
     bounds.SetWidth(range + widest + this->Margins[1]);
   }
+
+  this->CachedBoundingRect = bounds;
+  this->CachedBoundingRectTileScale = tileScale;
+  this->BoundingRectTime.Modified();
   return bounds;
 }
 
+//------------------------------------------------------------------------------
+void vtkAxis::GetLabelBounds(
+  vtkContext2D* painter, const vtkStdString& label, float bounds[4], bool justified)
+{
+  // The cached measurements only hold for the text properties and tile
+  // scale they were made with.
+  vtkVector2i tileScale =
+    this->Scene ? this->Scene->GetLogicalTileScale() : vtkVector2i(1);
+  if (this->LabelProperties->GetMTime() != this->LabelBoundsCachePropertiesTime ||
+    tileScale != this->LabelBoundsCacheTileScale)
+  {
+    this->LabelBoundsCache.clear();
+    this->JustifiedLabelBoundsCache.clear();
+    this->LabelBoundsCachePropertiesTime = this->LabelProperties->GetMTime();
+    this->LabelBoundsCacheTileScale = tileScale;
+  }
+
+  std::map<vtkStdString, vtkRectf>& cache =
+    justified ? this->JustifiedLabelBoundsCache : this->LabelBoundsCache;
+  auto entry = cache.find(label);
+  if (entry == cache.end())
+  {
+    // Rapidly changing labels (e.g. a continuous zoom) should not
+    // accumulate stale measurements.
+    if (cache.size() >= 512)
+    {
+      cache.clear();
+    }
+    vtkRectf measured(0, 0, 0, 0);
+    if (justified)
+    {
+      painter->ComputeJustifiedStringBounds(label.c_str(), measured.GetData());
+    }
+    else
+    {
+      painter->ComputeStringBounds(label, measured.GetData());
+    }
+    entry = cache.insert({ label, measured }).first;
+  }
+  std::copy(entry->second.GetData(), entry->second.GetData() + 4, bounds);
+}
+
 //------------------------------------------------------------------------------
 void vtkAxis::UpdateLogScaleActive(bool alwaysUpdateMinMaxFromUnscaled)
 {
@@ -47,6 +47,8 @@
 #include "vtkStdString.h"    // For vtkStdString ivars
 #include "vtkVector.h"       // For position variables
 
+#include <map> // For the measured label bounds cache
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkContext2D;
 class vtkFloatArray;
@@ -668,6 +670,17 @@ protected:
    */
   void CalculateTitlePosition(vtkVector2f& out);
 
+  /**
+   * Measure the supplied label with the painter, going through a cache
+   * keyed on the label text. Panning or zooming a chart shifts the
+   * visible tick labels but leaves most of their text unchanged, so only
+   * the labels entering at the edges reach the text renderer. The cache
+   * is dropped whenever the label text properties or the scene's tile
+   * scale change.
+   */
+  void GetLabelBounds(
+    vtkContext2D* painter, const vtkStdString& label, float bounds[4], bool justified);
+
   int Position;  // The position of the axis (LEFT, BOTTOM, RIGHT, TOP)
   float* Point1; // The position of point 1 (usually the origin)
   float* Point2; // The position of point 2 (usually the terminus)
@@ -773,6 +786,28 @@ protected:
    */
   vtkTimeStamp BuildTime;
 
+  ///@{
+  /**
+   * Measured label bounds keyed on the label text, and the label
+   * properties and tile scale they were measured against. See
+   * GetLabelBounds().
+   */
+  std::map<vtkStdString, vtkRectf> LabelBoundsCache;
+  std::map<vtkStdString, vtkRectf> JustifiedLabelBoundsCache;
+  vtkMTimeType LabelBoundsCachePropertiesTime;
+  vtkVector2i LabelBoundsCacheTileScale;
+  ///@}
+
+  ///@{
+  /**
+   * The rect returned by GetBoundingRect() and the state it was computed
+   * against, so chart layout does not re-measure every label each frame.
+   */
+  vtkRectf CachedBoundingRect;
+  vtkTimeStamp BoundingRectTime;
+  vtkVector2i CachedBoundingRectTileScale;
+  ///@}
+
 private:
   vtkAxis(const vtkAxis&) = delete;
   void operator=(const vtkAxis&) = delete;
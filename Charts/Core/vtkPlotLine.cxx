@@ -4,13 +4,24 @@
 #include "vtkPlotLine.h"
 
 #include "vtkContext2D.h"
+#include "vtkContextScene.h"
 #include "vtkIdTypeArray.h"
+#include "vtkMatrix3x3.h"
+#include "vtkNew.h"
 #include "vtkPen.h"
 #include "vtkPoints2D.h"
 #include "vtkRect.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkTransform2D.h"
 
 #include "vtkObjectFactory.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkPlotLine);
@@ -20,6 +31,9 @@ vtkPlotLine::vtkPlotLine()
 {
   this->MarkerStyle = vtkPlotPoints::NONE;
   this->PolyLine = true;
+  std::fill(this->AggregatedLineTransform, this->AggregatedLineTransform + 9, 0.0);
+  this->AggregatedLineViewSize[0] = this->AggregatedLineViewSize[1] = 0;
+  this->AggregatedLineExact = false;
 }
 
 //------------------------------------------------------------------------------
@@ -39,6 +53,21 @@ bool vtkPlotLine::Paint(vtkContext2D* painter)
   // Draw the line between the points
   painter->ApplyPen(this->Pen);
 
+  if (this->AggregationRequired())
+  {
+    vtkPoints2D* envelope = this->GetAggregatedLine(painter);
+    if (envelope != this->Points)
+    {
+      // the envelope carries the full vertical extent of every covered
+      // pixel column, so the drawing matches the exact line to the pixel
+      if (envelope->GetNumberOfPoints() > 1)
+      {
+        painter->DrawPoly(envelope);
+      }
+      return this->vtkPlotPoints::Paint(painter);
+    }
+  }
+
   if (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0)
   {
     // draw lines skipping bad points
@@ -95,6 +124,149 @@ bool vtkPlotLine::Paint(vtkContext2D* painter)
   return this->vtkPlotPoints::Paint(painter);
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Accumulate the lowest and highest screen y of the series' vertices for
+// every pixel column, one pair of arrays per thread.
+struct ColumnEnvelope
+{
+  const float* Points;
+  const double* Matrix; // 3x3 row-major, data to screen
+  int Width;
+
+  vtkSMPThreadLocal<std::vector<double>> LocalMin;
+  vtkSMPThreadLocal<std::vector<double>> LocalMax;
+  vtkSMPThreadLocal<vtkIdType> LocalVisible;
+  std::vector<double> Min;
+  std::vector<double> Max;
+  vtkIdType Visible = 0;
+
+  void Initialize()
+  {
+    this->LocalMin.Local().assign(this->Width, std::numeric_limits<double>::infinity());
+    this->LocalMax.Local().assign(this->Width, -std::numeric_limits<double>::infinity());
+    this->LocalVisible.Local() = 0;
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<double>& minY = this->LocalMin.Local();
+    std::vector<double>& maxY = this->LocalMax.Local();
+    vtkIdType& visible = this->LocalVisible.Local();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const double x = this->Points[2 * i];
+      const double y = this->Points[2 * i + 1];
+      const double sx = this->Matrix[0] * x + this->Matrix[1] * y + this->Matrix[2];
+      const double sy = this->Matrix[3] * x + this->Matrix[4] * y + this->Matrix[5];
+      // NaN x fails these comparisons; y may lie outside the view, a
+      // segment through the column still covers its vertical extent
+      if (sx >= 0.0 && sx < this->Width && std::isfinite(sy))
+      {
+        const int column = static_cast<int>(sx);
+        minY[column] = std::min(minY[column], sy);
+        maxY[column] = std::max(maxY[column], sy);
+        ++visible;
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for (auto it = this->LocalVisible.begin(); it != this->LocalVisible.end(); ++it)
+    {
+      this->Visible += *it;
+    }
+    this->Min.assign(this->Width, std::numeric_limits<double>::infinity());
+    this->Max.assign(this->Width, -std::numeric_limits<double>::infinity());
+    for (auto it = this->LocalMin.begin(); it != this->LocalMin.end(); ++it)
+    {
+      for (int x = 0; x < this->Width; ++x)
+      {
+        this->Min[x] = std::min(this->Min[x], (*it)[x]);
+      }
+    }
+    for (auto it = this->LocalMax.begin(); it != this->LocalMax.end(); ++it)
+    {
+      for (int x = 0; x < this->Width; ++x)
+      {
+        this->Max[x] = std::max(this->Max[x], (*it)[x]);
+      }
+    }
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkPoints2D* vtkPlotLine::GetAggregatedLine(vtkContext2D* painter)
+{
+  vtkTransform2D* transform = painter->GetTransform();
+  const int width = this->Scene ? this->Scene->GetSceneWidth() : 0;
+  const int height = this->Scene ? this->Scene->GetSceneHeight() : 0;
+  if (!transform || width <= 0 || height <= 0)
+  {
+    return this->Points;
+  }
+
+  vtkNew<vtkMatrix3x3> matrix;
+  transform->GetMatrix(matrix);
+  const double* m = matrix->GetData();
+  if (this->AggregatedLineTime > this->BuildTime &&
+    std::equal(m, m + 9, this->AggregatedLineTransform) &&
+    width == this->AggregatedLineViewSize[0] && height == this->AggregatedLineViewSize[1])
+  {
+    return this->AggregatedLineExact ? this->Points : this->AggregatedLine.GetPointer();
+  }
+
+  ColumnEnvelope envelope;
+  envelope.Points = static_cast<float*>(this->Points->GetVoidPointer(0));
+  envelope.Matrix = m;
+  envelope.Width = width;
+  vtkSMPTools::For(0, this->Points->GetNumberOfPoints(), envelope);
+
+  std::copy(m, m + 9, this->AggregatedLineTransform);
+  this->AggregatedLineViewSize[0] = width;
+  this->AggregatedLineViewSize[1] = height;
+  this->AggregatedLineTime.Modified();
+
+  // the view holds few enough of the series' vertices: restore the exact
+  // rendering
+  this->AggregatedLineExact = envelope.Visible <= this->PointBudget;
+  if (this->AggregatedLineExact)
+  {
+    return this->Points;
+  }
+
+  // a polyline visiting the vertical extent of every covered column, at
+  // the column centers in data coordinates so the painter's transform
+  // maps it back
+  std::vector<float> vertices;
+  for (int x = 0; x < width; ++x)
+  {
+    if (envelope.Min[x] <= envelope.Max[x])
+    {
+      vertices.push_back(x + 0.5f);
+      vertices.push_back(static_cast<float>(envelope.Min[x]));
+      if (envelope.Max[x] > envelope.Min[x])
+      {
+        vertices.push_back(x + 0.5f);
+        vertices.push_back(static_cast<float>(envelope.Max[x]));
+      }
+    }
+  }
+  const vtkIdType numberOfVertices = static_cast<vtkIdType>(vertices.size() / 2);
+  this->AggregatedLine->SetNumberOfPoints(numberOfVertices);
+  if (numberOfVertices > 0)
+  {
+    transform->InverseTransformPoints(vertices.data(),
+      static_cast<float*>(this->AggregatedLine->GetVoidPointer(0)),
+      static_cast<int>(numberOfVertices));
+  }
+  this->AggregatedLine->Modified();
+  return this->AggregatedLine;
+}
+
 //------------------------------------------------------------------------------
 bool vtkPlotLine::PaintLegend(vtkContext2D* painter, const vtkRectf& rect, int)
 {
@@ -58,11 +58,33 @@ protected:
   vtkPlotLine();
   ~vtkPlotLine() override;
 
+  /**
+   * Return the min/max envelope of the line under the painter's current
+   * transform: a polyline visiting the lowest and highest series vertex
+   * of every covered pixel column, rebuilt when the transform, the view
+   * size or the data changed since it was cached. Used instead of the
+   * full series when it exceeds the point budget; returns Points itself
+   * when no envelope can be computed.
+   */
+  vtkPoints2D* GetAggregatedLine(vtkContext2D* painter);
+
   /**
    * Poly line (true) or line segments(false).
    */
   bool PolyLine;
 
+  ///@{
+  /**
+   * Per-pixel-column min/max envelope of Points, with the view transform
+   * and size it was computed against.
+   */
+  vtkNew<vtkPoints2D> AggregatedLine;
+  vtkTimeStamp AggregatedLineTime;
+  double AggregatedLineTransform[9];
+  int AggregatedLineViewSize[2];
+  bool AggregatedLineExact;
+  ///@}
+
 private:
   vtkPlotLine(const vtkPlotLine&) = delete;
   void operator=(const vtkPlotLine&) = delete;
@@ -15,11 +15,14 @@
 #include "vtkImageData.h"
 #include "vtkLookupTable.h"
 #include "vtkMath.h"
+#include "vtkMatrix3x3.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPen.h"
 #include "vtkPoints2D.h"
+#include "vtkSMPTools.h"
 #include "vtkTable.h"
+#include "vtkTransform2D.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
@@ -72,6 +75,11 @@ vtkPlotPoints::vtkPlotPoints()
 
   this->UnscaledInputBounds[0] = this->UnscaledInputBounds[2] = vtkMath::Inf();
   this->UnscaledInputBounds[1] = this->UnscaledInputBounds[3] = -vtkMath::Inf();
+
+  this->PointBudget = 0;
+  std::fill(this->AggregatedPointsTransform, this->AggregatedPointsTransform + 9, 0.0);
+  this->AggregatedPointsViewSize[0] = this->AggregatedPointsViewSize[1] = 0;
+  this->AggregatedPointsExact = false;
 }
 
 //------------------------------------------------------------------------------
@@ -127,44 +135,57 @@ bool vtkPlotPoints::Paint(vtkContext2D* painter)
     painter->ApplyBrush(this->Brush);
     painter->GetPen()->SetWidth(width);
 
-    float* points = static_cast<float*>(this->Points->GetVoidPointer(0));
-    unsigned char* colors = nullptr;
-    int nColorComponents = 0;
-    if (this->ScalarVisibility && this->Colors)
+    vtkPoints2D* aggregate =
+      this->AggregationRequired() ? this->GetAggregatedPoints(painter) : this->Points;
+    if (aggregate != this->Points)
     {
-      colors = this->Colors->GetPointer(0);
-      nColorComponents = static_cast<int>(this->Colors->GetNumberOfComponents());
+      // one pen-colored marker per covered pixel; bad points were
+      // dropped during the binning
+      const std::uintptr_t cacheIdentifier = reinterpret_cast<std::uintptr_t>(this);
+      painter->DrawMarkers(this->MarkerStyle, false, aggregate->GetData(), nullptr,
+        cacheIdentifier);
     }
-
-    if (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0)
+    else
     {
-      vtkIdType lastGood = 0;
-      vtkIdType bpIdx = 0;
-      vtkIdType nPoints = this->Points->GetNumberOfPoints();
-      vtkIdType nBadPoints = this->BadPoints->GetNumberOfTuples();
+      float* points = static_cast<float*>(this->Points->GetVoidPointer(0));
+      unsigned char* colors = nullptr;
+      int nColorComponents = 0;
+      if (this->ScalarVisibility && this->Colors)
+      {
+        colors = this->Colors->GetPointer(0);
+        nColorComponents = static_cast<int>(this->Colors->GetNumberOfComponents());
+      }
 
-      while (lastGood < nPoints)
+      if (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0)
       {
-        vtkIdType id =
-          bpIdx < nBadPoints ? this->BadPoints->GetValue(bpIdx) : this->Points->GetNumberOfPoints();
+        vtkIdType lastGood = 0;
+        vtkIdType bpIdx = 0;
+        vtkIdType nPoints = this->Points->GetNumberOfPoints();
+        vtkIdType nBadPoints = this->BadPoints->GetNumberOfTuples();
 
-        // render from last good point to one before this bad point
-        if (id - lastGood > 0)
+        while (lastGood < nPoints)
         {
-          painter->DrawMarkers(this->MarkerStyle, false, points + 2 * (lastGood), id - lastGood,
-            colors ? colors + 4 * (lastGood) : nullptr, nColorComponents);
+          vtkIdType id = bpIdx < nBadPoints ? this->BadPoints->GetValue(bpIdx)
+                                            : this->Points->GetNumberOfPoints();
+
+          // render from last good point to one before this bad point
+          if (id - lastGood > 0)
+          {
+            painter->DrawMarkers(this->MarkerStyle, false, points + 2 * (lastGood), id - lastGood,
+              colors ? colors + 4 * (lastGood) : nullptr, nColorComponents);
+          }
+          lastGood = id + 1;
+          bpIdx++;
         }
-        lastGood = id + 1;
-        bpIdx++;
       }
-    }
-    else
-    {
-      // draw all of the points
-      const std::uintptr_t cacheIdentifier = reinterpret_cast<std::uintptr_t>(this);
-      vtkUnsignedCharArray* colorsArray = this->ScalarVisibility ? this->Colors : nullptr;
-      painter->DrawMarkers(
-        this->MarkerStyle, false, this->Points->GetData(), colorsArray, cacheIdentifier);
+      else
+      {
+        // draw all of the points
+        const std::uintptr_t cacheIdentifier = reinterpret_cast<std::uintptr_t>(this);
+        vtkUnsignedCharArray* colorsArray = this->ScalarVisibility ? this->Colors : nullptr;
+        painter->DrawMarkers(
+          this->MarkerStyle, false, this->Points->GetData(), colorsArray, cacheIdentifier);
+      }
     }
   }
 
@@ -196,6 +217,128 @@ bool vtkPlotPoints::Paint(vtkContext2D* painter)
   return true;
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Mark the pixels covered by at least one point. Concurrent writes store
+// the same value, so the races on the bytes are benign.
+struct DensityBinner
+{
+  const float* Points;
+  const double* Matrix; // 3x3 row-major, data to screen
+  unsigned char* Bins;
+  int Width;
+  int Height;
+
+  vtkSMPThreadLocal<vtkIdType> LocalVisible;
+  vtkIdType Visible = 0;
+
+  void Initialize() { this->LocalVisible.Local() = 0; }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkIdType& visible = this->LocalVisible.Local();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const double x = this->Points[2 * i];
+      const double y = this->Points[2 * i + 1];
+      const double sx = this->Matrix[0] * x + this->Matrix[1] * y + this->Matrix[2];
+      const double sy = this->Matrix[3] * x + this->Matrix[4] * y + this->Matrix[5];
+      // NaN and infinite coordinates fail these comparisons and are skipped
+      if (sx >= 0.0 && sx < this->Width && sy >= 0.0 && sy < this->Height)
+      {
+        this->Bins[static_cast<int>(sy) * this->Width + static_cast<int>(sx)] = 1;
+        ++visible;
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for (auto it = this->LocalVisible.begin(); it != this->LocalVisible.end(); ++it)
+    {
+      this->Visible += *it;
+    }
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+bool vtkPlotPoints::AggregationRequired()
+{
+  return this->PointBudget > 0 && this->Points &&
+    this->Points->GetNumberOfPoints() > this->PointBudget;
+}
+
+//------------------------------------------------------------------------------
+vtkPoints2D* vtkPlotPoints::GetAggregatedPoints(vtkContext2D* painter)
+{
+  vtkTransform2D* transform = painter->GetTransform();
+  const int width = this->Scene ? this->Scene->GetSceneWidth() : 0;
+  const int height = this->Scene ? this->Scene->GetSceneHeight() : 0;
+  if (!transform || width <= 0 || height <= 0)
+  {
+    return this->Points;
+  }
+
+  vtkNew<vtkMatrix3x3> matrix;
+  transform->GetMatrix(matrix);
+  const double* m = matrix->GetData();
+  if (this->AggregatedPointsTime > this->BuildTime &&
+    std::equal(m, m + 9, this->AggregatedPointsTransform) &&
+    width == this->AggregatedPointsViewSize[0] && height == this->AggregatedPointsViewSize[1])
+  {
+    return this->AggregatedPointsExact ? this->Points : this->AggregatedPoints.GetPointer();
+  }
+
+  std::vector<unsigned char> bins(static_cast<size_t>(width) * height, 0);
+  DensityBinner binner;
+  binner.Points = static_cast<float*>(this->Points->GetVoidPointer(0));
+  binner.Matrix = m;
+  binner.Bins = bins.data();
+  binner.Width = width;
+  binner.Height = height;
+  vtkSMPTools::For(0, this->Points->GetNumberOfPoints(), binner);
+
+  std::copy(m, m + 9, this->AggregatedPointsTransform);
+  this->AggregatedPointsViewSize[0] = width;
+  this->AggregatedPointsViewSize[1] = height;
+  this->AggregatedPointsTime.Modified();
+
+  // the view holds few enough of the series' points: restore the exact
+  // rendering
+  this->AggregatedPointsExact = binner.Visible <= this->PointBudget;
+  if (this->AggregatedPointsExact)
+  {
+    return this->Points;
+  }
+
+  // one marker per covered pixel, placed at the pixel center in data
+  // coordinates so the painter's transform maps it back onto the pixel
+  std::vector<float> centers;
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+    {
+      if (bins[static_cast<size_t>(y) * width + x])
+      {
+        centers.push_back(x + 0.5f);
+        centers.push_back(y + 0.5f);
+      }
+    }
+  }
+  const vtkIdType numberOfBins = static_cast<vtkIdType>(centers.size() / 2);
+  this->AggregatedPoints->SetNumberOfPoints(numberOfBins);
+  if (numberOfBins > 0)
+  {
+    transform->InverseTransformPoints(centers.data(),
+      static_cast<float*>(this->AggregatedPoints->GetVoidPointer(0)),
+      static_cast<int>(numberOfBins));
+  }
+  this->AggregatedPoints->Modified();
+  return this->AggregatedPoints;
+}
+
 //------------------------------------------------------------------------------
 bool vtkPlotPoints::PaintLegend(vtkContext2D* painter, const vtkRectf& rect, int)
 {
@@ -963,5 +1106,6 @@ vtkStdString vtkPlotPoints::GetColorArrayName()
 void vtkPlotPoints::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "PointBudget: " << this->PointBudget << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -165,6 +165,23 @@ public:
   vtkSetMacro(ValidPointMaskName, vtkStdString);
   ///@}
 
+  ///@{
+  /**
+   * Get/set the maximum number of points Paint() draws exactly. When the
+   * series holds more points than the budget, the markers are replaced by
+   * a screen-space density aggregate — one marker per pixel covered by at
+   * least one point — computed in parallel and cached against the view
+   * transform, so a repaint costs the view size rather than the series
+   * size. Zooming in until the visible points fit the budget restores the
+   * exact rendering. Aggregated markers use the pen color; per-point
+   * scalar colors apply to the exact rendering only, and selection and
+   * nearest-point queries always use the full series. The default is 0,
+   * which disables the aggregation.
+   */
+  vtkSetMacro(PointBudget, vtkIdType);
+  vtkGetMacro(PointBudget, vtkIdType);
+  ///@}
+
   /**
    * Update the internal cache. Returns true if cache was successfully updated. Default does
    * nothing.
@@ -217,6 +234,20 @@ protected:
    */
   void CreateSortedPoints();
 
+  /**
+   * Whether the series exceeds the point budget, so that painting should
+   * use a screen-space aggregate of the points.
+   */
+  bool AggregationRequired();
+
+  /**
+   * Return the density aggregate of Points under the painter's current
+   * transform, rebuilding it when the transform, the view size or the
+   * data changed since it was cached. Returns Points itself when no
+   * aggregate can be computed.
+   */
+  vtkPoints2D* GetAggregatedPoints(vtkContext2D* painter);
+
   ///@{
   /**
    * Store a well packed set of XY coordinates for this data series.
@@ -275,6 +306,23 @@ protected:
    */
   double UnscaledInputBounds[4];
 
+  /**
+   * See PointBudget.
+   */
+  vtkIdType PointBudget;
+
+  ///@{
+  /**
+   * Screen-space density aggregate of Points, with the view transform
+   * and size it was computed against.
+   */
+  vtkNew<vtkPoints2D> AggregatedPoints;
+  vtkTimeStamp AggregatedPointsTime;
+  double AggregatedPointsTransform[9];
+  int AggregatedPointsViewSize[2];
+  bool AggregatedPointsExact;
+  ///@}
+
 private:
   vtkPlotPoints(const vtkPlotPoints&) = delete;
   void operator=(const vtkPlotPoints&) = delete;
@@ -141,6 +141,42 @@ void vtkSMPToolsAPI::Initialize(int numThreads)
   this->RefreshNumberOfThread();
 }
 
+//------------------------------------------------------------------------------
+int vtkSMPToolsAPI::AllocateThreadBudget(int request)
+{
+  const int total = this->GetEstimatedNumberOfThreads();
+  int inUse = this->ThreadBudgetInUse.load(std::memory_order_relaxed);
+  int granted;
+  do
+  {
+    const int remaining = (total > inUse) ? total - inUse : 1;
+    granted = (request <= 0 || request > remaining) ? remaining : request;
+  } while (!this->ThreadBudgetInUse.compare_exchange_weak(
+    inUse, inUse + granted, std::memory_order_relaxed));
+  return granted;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::ReleaseThreadBudget(int granted)
+{
+  this->ThreadBudgetInUse.fetch_sub(granted, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+static thread_local int vtkSMPToolsThreadBudgetCap; // Default initialized to zero
+
+//------------------------------------------------------------------------------
+int vtkSMPToolsGetThreadBudgetCap()
+{
+  return vtkSMPToolsThreadBudgetCap;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsSetThreadBudgetCap(int cap)
+{
+  vtkSMPToolsThreadBudgetCap = cap;
+}
+
 //------------------------------------------------------------------------------
 void vtkSMPToolsAPI::RefreshNumberOfThread()
 {
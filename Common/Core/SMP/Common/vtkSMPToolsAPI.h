@@ -9,6 +9,7 @@
 #include "vtkObject.h"
 #include "vtkSMP.h"
 
+#include <atomic> // For std::atomic
 #include <memory>
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
@@ -74,6 +75,43 @@ public:
   //--------------------------------------------------------------------------------
   int GetInternalDesiredNumberOfThread() { return this->DesiredNumberOfThread; }
 
+  //--------------------------------------------------------------------------------
+  // Reserve up to `request` threads from the global thread budget (0 means "all
+  // remaining threads"). At least one thread is always granted so a loop can make
+  // progress on the calling thread. The returned grant must be handed back with
+  // ReleaseThreadBudget once the scope ends.
+  int AllocateThreadBudget(int request);
+
+  //--------------------------------------------------------------------------------
+  void ReleaseThreadBudget(int granted);
+
+  //--------------------------------------------------------------------------------
+  // Borrow up to `requestedThreads` threads from the global budget, run `lambda`
+  // with the per-thread cap (see vtkSMPToolsGetThreadBudgetCap) set to the grant,
+  // then restore the previous cap and hand the grant back. The cap is carried in
+  // thread-local state consulted by the backends on every call, so concurrent
+  // scopes on different threads do not interfere with each other or with the
+  // shared configuration.
+  template <typename T>
+  void ThreadBudgetScope(int requestedThreads, T&& lambda)
+  {
+    const int granted = this->AllocateThreadBudget(requestedThreads);
+    const int previousCap = vtkSMPToolsGetThreadBudgetCap();
+    vtkSMPToolsSetThreadBudgetCap(granted);
+    try
+    {
+      lambda();
+    }
+    catch (...)
+    {
+      vtkSMPToolsSetThreadBudgetCap(previousCap);
+      this->ReleaseThreadBudget(granted);
+      throw;
+    }
+    vtkSMPToolsSetThreadBudgetCap(previousCap);
+    this->ReleaseThreadBudget(granted);
+  }
+
   //------------------------------------------------------------------------------
   template <typename Config, typename T>
   void LocalScope(Config const& config, T&& lambda)
@@ -260,6 +298,12 @@ private:
    */
   int DesiredNumberOfThread = 0;
 
+  /**
+   * Number of threads currently lent out by the thread budget arbiter.
+   * See AllocateThreadBudget / ReleaseThreadBudget.
+   */
+  std::atomic<int> ThreadBudgetInUse{ 0 };
+
   /**
    * Sequential backend
    */
@@ -120,6 +120,15 @@ private:
 
 using ExecuteFunctorPtrType = void (*)(void*, vtkIdType, vtkIdType, vtkIdType);
 
+//--------------------------------------------------------------------------------
+// Per-thread cap on the number of threads a parallel call may use, installed by
+// vtkSMPToolsAPI::ThreadBudgetScope and consulted by the backends on every
+// call. Keeping it thread local makes the cap travel with the calling thread
+// instead of mutating the shared configuration, so concurrent scopes do not
+// interfere. Zero means uncapped.
+VTKCOMMONCORE_EXPORT int vtkSMPToolsGetThreadBudgetCap();
+VTKCOMMONCORE_EXPORT void vtkSMPToolsSetThreadBudgetCap(int cap);
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -105,9 +105,16 @@ bool vtkSMPToolsImpl<BackendType::OpenMP>::GetSingleThread()
 void vtkSMPToolsImplForOpenMP(vtkIdType first, vtkIdType last, vtkIdType grain,
   ExecuteFunctorPtrType functorExecuter, void* functor, bool nestedActivated)
 {
+  int numThreads = GetNumberOfThreadsOpenMP();
+  const int budgetCap = vtkSMPToolsGetThreadBudgetCap();
+  if (budgetCap > 0 && budgetCap < numThreads)
+  {
+    numThreads = budgetCap;
+  }
+
   if (grain <= 0)
   {
-    vtkIdType estimateGrain = (last - first) / (GetNumberOfThreadsOpenMP() * 4);
+    vtkIdType estimateGrain = (last - first) / (numThreads * 4);
     grain = (estimateGrain > 0) ? estimateGrain : 1;
   }
 
@@ -116,7 +123,7 @@ void vtkSMPToolsImplForOpenMP(vtkIdType first, vtkIdType last, vtkIdType grain,
 #pragma omp single
   threadIdStack->emplace(omp_get_thread_num());
 
-#pragma omp parallel for schedule(runtime)
+#pragma omp parallel for schedule(runtime) num_threads(numThreads)
   for (vtkIdType from = first; from < last; from += grain)
   {
     functorExecuter(functor, from, grain, last);
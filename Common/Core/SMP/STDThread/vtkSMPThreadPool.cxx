@@ -35,6 +35,7 @@ struct vtkSMPThreadPool::ThreadJob
   ProxyData* Proxy{};               // Proxy that allocated this job
   std::function<void()> Function{}; // Actual user job
   std::promise<void> Promise{};     // Set when job is done
+  bool HasFuture{ false };          // Whether the proxy recorded a future for this job
 };
 
 struct vtkSMPThreadPool::ThreadData
@@ -186,6 +187,7 @@ void vtkSMPThreadPool::Proxy::DoJob(std::function<void()> job)
 
     auto& jobs = proxyThread.Thread->Jobs;
     jobs.emplace_back(this->Data.get(), std::move(job));
+    jobs.back().HasFuture = true;
     this->Data->JobsFutures.emplace_back(jobs.back().Promise.get_future());
 
     lock.unlock();
@@ -353,11 +355,19 @@ std::thread vtkSMPThreadPool::MakeThread()
     {
       std::unique_lock<std::mutex> lock{ threadData.Mutex };
 
-      // Job stealing could be implemented but it will requires some changes in the process
-      // A thread that as no longer work to do could look at other threads jobs to "steal" a job
-      // from them and thus increase parallelism. This must take care of not generating deadlocks
-      // and should not increase Proxy parallelism above requested thread count.
-      // This goes out of the scope of current implementation.
+      if (threadData.Jobs.empty() && !this->Joining.load(std::memory_order_acquire))
+      {
+        // Before going to sleep, try to steal pending work from the other threads of the pool.
+        // This keeps all threads busy at the tail of irregular loops where per-chunk cost varies
+        // widely and round-robin distribution leaves some queues longer than others.
+        lock.unlock();
+        if (this->TryToStealJob(threadData))
+        {
+          continue;
+        }
+        lock.lock();
+      }
+
       threadData.ConditionVariable.wait(lock, [this, &threadData] {
         return !threadData.Jobs.empty() || this->Joining.load(std::memory_order_acquire);
       });
@@ -412,6 +422,66 @@ void vtkSMPThreadPool::FillThreadsForNestedProxy(ProxyData* proxy, std::size_t m
   }
 }
 
+bool vtkSMPThreadPool::TryToStealJob(ThreadData& thief)
+{
+  // Steal a pending job from another thread of the pool and run it on `thief`.
+  //
+  // Only the job at the back of a victim queue may be taken: removing it never shifts the
+  // indices of jobs currently running on the victim (RunJob keeps such indices on its stack).
+  // A job is only stolen if its proxy lists `thief` among its allocated threads, so proxy
+  // parallelism never exceeds the requested thread count and thread local storage keeps
+  // resolving to a valid virtual thread id.
+  for (const auto& victimOwner : this->Threads)
+  {
+    ThreadData& victim = *victimOwner;
+    if (&victim == &thief)
+    {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> victimLock{ victim.Mutex, std::try_to_lock };
+    if (!victimLock.owns_lock() || victim.Jobs.empty())
+    {
+      continue;
+    }
+
+    const std::size_t jobIndex = victim.Jobs.size() - 1;
+    if (jobIndex == victim.RunningJob)
+    {
+      continue; // the only job left is already being executed
+    }
+
+    // Nested proxies enqueue jobs for their own thread (index 0) without recording a future,
+    // and Proxy::Join only runs jobs still sitting in that queue or waits on recorded futures.
+    // Stealing such a job would let Join return while the job still runs, so only jobs with a
+    // future may be taken.
+    if (!victim.Jobs[jobIndex].HasFuture)
+    {
+      continue;
+    }
+
+    const auto& proxyThreads = victim.Jobs[jobIndex].Proxy->Threads;
+    const bool thiefBelongsToProxy =
+      std::any_of(proxyThreads.begin(), proxyThreads.end(),
+        [&thief](const ProxyThreadData& proxyThread) { return proxyThread.Thread == &thief; });
+    if (!thiefBelongsToProxy)
+    {
+      continue;
+    }
+
+    ThreadJob job = std::move(victim.Jobs[jobIndex]);
+    victim.Jobs.pop_back();
+    victimLock.unlock();
+
+    std::unique_lock<std::mutex> thiefLock{ thief.Mutex };
+    thief.Jobs.emplace_back(std::move(job));
+    RunJob(thief, thief.Jobs.size() - 1, thiefLock);
+    return true;
+  }
+
+  return false;
+}
+
 std::size_t vtkSMPThreadPool::GetNextThreadId() noexcept
 {
   return this->NextProxyThreadId.fetch_add(1, std::memory_order_relaxed) + 1;
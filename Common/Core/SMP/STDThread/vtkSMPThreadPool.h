@@ -162,6 +162,7 @@ private:
   std::thread MakeThread();
   void FillThreadsForNestedProxy(ProxyData* proxy, std::size_t maxCount);
   std::size_t GetNextThreadId() noexcept;
+  bool TryToStealJob(ThreadData& thief);
 
   std::atomic<bool> Initialized{};
   std::atomic<bool> Joining{};
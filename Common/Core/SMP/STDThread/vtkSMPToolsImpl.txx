@@ -41,6 +41,11 @@ void vtkSMPToolsImpl<BackendType::STDThread>::For(
   else
   {
     int threadNumber = GetNumberOfThreadsSTDThread();
+    const int budgetCap = vtkSMPToolsGetThreadBudgetCap();
+    if (budgetCap > 0 && budgetCap < threadNumber)
+    {
+      threadNumber = budgetCap;
+    }
 
     if (grain <= 0)
     {
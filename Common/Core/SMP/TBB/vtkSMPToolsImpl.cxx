@@ -136,7 +136,15 @@ void vtkSMPToolsImplForTBB(vtkIdType first, vtkIdType last, vtkIdType grain,
   threadIdStack->emplace(tbb::this_task_arena::current_thread_index());
   threadIdStackLock->unlock();
 
-  if (taskArena->is_active())
+  const int budgetCap = vtkSMPToolsGetThreadBudgetCap();
+  if (budgetCap > 0)
+  {
+    // A per-call arena keeps the cap local to this loop instead of touching
+    // the shared arena, which other threads may be using concurrently.
+    tbb::task_arena budgetArena(budgetCap);
+    budgetArena.execute([&] { functorExecuter(functor, first, last, grain); });
+  }
+  else if (taskArena->is_active())
   {
     taskArena->execute([&] { functorExecuter(functor, first, last, grain); });
   }
@@ -77,5 +77,48 @@ int TestBitArray(int, char*[])
     return EXIT_FAILURE;
   }
 
+  // Word-granular bulk operations.
+  vtkNew<vtkBitArray> mask;
+  mask->SetNumberOfValues(21);
+  mask->FillRange(0, 21, 0);
+  mask->FillRange(5, 17, 1);
+  if (mask->CountSetBits() != 12)
+  {
+    std::cerr << "FillRange/CountSetBits mismatch: expected 12 set bits, got "
+              << mask->CountSetBits() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (mask->GetValue(4) != 0 || mask->GetValue(5) != 1 || mask->GetValue(16) != 1 ||
+    mask->GetValue(17) != 0)
+  {
+    std::cerr << "FillRange touched bits outside [5, 17)." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (mask->FindNextSetBit(0) != 5 || mask->FindNextSetBit(6) != 6 ||
+    mask->FindNextSetBit(17) != -1)
+  {
+    std::cerr << "FindNextSetBit returned wrong ids." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkBitArray> other;
+  other->SetNumberOfValues(21);
+  other->FillRange(0, 21, 0);
+  other->FillRange(10, 21, 1);
+  if (!mask->BitwiseAnd(other) || mask->CountSetBits() != 7 || mask->FindNextSetBit(0) != 10)
+  {
+    std::cerr << "BitwiseAnd produced a wrong mask." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!mask->BitwiseOr(other) || mask->CountSetBits() != 11)
+  {
+    std::cerr << "BitwiseOr produced a wrong mask." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!mask->BitwiseXor(other) || mask->CountSetBits() != 0)
+  {
+    std::cerr << "BitwiseXor with itself-equal mask should clear every bit." << std::endl;
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkBuffer.h"
+#include "vtkNew.h"
+#include "vtkSmartPointer.h"
+
+#include <iostream>
+
+int TestBufferFirstTouch(int, char*[])
+{
+  auto buffer = vtkSmartPointer<vtkBuffer<double>>::New();
+
+  // a first touch on an unallocated buffer is a no-op
+  buffer->FirstTouchInitialize();
+  if (buffer->GetBuffer() != nullptr || buffer->GetSize() != 0)
+  {
+    std::cerr << "FirstTouchInitialize modified an unallocated buffer." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const vtkIdType size = 100000;
+  if (!buffer->Allocate(size))
+  {
+    std::cerr << "Failed to allocate buffer." << std::endl;
+    return EXIT_FAILURE;
+  }
+  buffer->FirstTouchInitialize();
+
+  const double* data = buffer->GetBuffer();
+  for (vtkIdType i = 0; i < size; ++i)
+  {
+    if (data[i] != 0.0)
+    {
+      std::cerr << "Element " << i << " not zero-initialized: " << data[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompressedImplicitBackend.h"
+#include "vtkDataArrayRange.h"
+
+#include "vtkDoubleArray.h"
+#include "vtkIntArray.h"
+
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+int TestCompressedImplicitBackend(int, char*[])
+{
+  // Integer values with a locally small range: the common case for ids
+  const vtkIdType nValues = 3000; // spans multiple blocks, last one partial
+  std::vector<int> ids(nValues);
+  std::iota(ids.begin(), ids.end(), 100000);
+
+  vtkCompressedImplicitBackend<int> compressedIds(ids.data(), nValues);
+  for (vtkIdType i = 0; i < nValues; ++i)
+  {
+    if (compressedIds(i) != ids[i])
+    {
+      std::cout << "Compressed backend operator not functioning: " << compressedIds(i)
+                << " != " << ids[i] << " at index " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Values requiring the full bit width within a block must round-trip too
+  std::vector<int> extremes = { VTK_INT_MIN, -1, 0, 1, VTK_INT_MAX };
+  vtkCompressedImplicitBackend<int> compressedExtremes(
+    extremes.data(), static_cast<vtkIdType>(extremes.size()));
+  for (std::size_t i = 0; i < extremes.size(); ++i)
+  {
+    if (compressedExtremes(static_cast<int>(i)) != extremes[i])
+    {
+      std::cout << "Compressed backend lost an extreme value at index " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Floating point values go through their bit representation and must be
+  // reproduced exactly
+  vtkNew<vtkDoubleArray> doubles;
+  doubles->SetNumberOfComponents(3);
+  doubles->SetNumberOfTuples(500);
+  auto doubleRange = vtk::DataArrayValueRange<3>(doubles);
+  double val = -0.5;
+  for (auto itr = doubleRange.begin(); itr != doubleRange.end(); ++itr)
+  {
+    *itr = val;
+    val += 0.125;
+  }
+
+  vtkCompressedImplicitBackend<double> compressedDoubles(doubles);
+  for (int i = 0; i < 1500; ++i)
+  {
+    if (compressedDoubles(i) != doubleRange[i])
+    {
+      std::cout << "Compressed backend operator not functioning: " << compressedDoubles(i)
+                << " != " << doubleRange[i] << " at index " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The whole point: the packed representation of slowly-varying integers
+  // should be much smaller than the uncompressed values
+  vtkNew<vtkIntArray> idArray;
+  idArray->SetNumberOfComponents(1);
+  idArray->SetNumberOfTuples(nValues);
+  auto idRange = vtk::DataArrayValueRange<1>(idArray);
+  std::iota(idRange.begin(), idRange.end(), 0);
+  vtkCompressedImplicitBackend<int> compressedIdArray(idArray);
+  if (compressedIdArray.getMemorySize() >= idArray->GetActualMemorySize())
+  {
+    std::cout << "Compressed backend did not compress a slowly-varying id array: "
+              << compressedIdArray.getMemorySize() << " KiB >= " << idArray->GetActualMemorySize()
+              << " KiB" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+
+#include <cstdlib>
+
+int TestDataArrayBufferMove(int, char*[])
+{
+  // MoveBufferFrom transfers the storage pointer, not the values.
+  vtkNew<vtkDoubleArray> source;
+  source->SetNumberOfComponents(3);
+  source->SetNumberOfTuples(100);
+  for (vtkIdType i = 0; i < 300; ++i)
+  {
+    source->SetValue(i, static_cast<double>(i));
+  }
+  const double* sourcePointer = source->GetPointer(0);
+
+  vtkNew<vtkDoubleArray> destination;
+  destination->MoveBufferFrom(source);
+
+  if (destination->GetPointer(0) != sourcePointer)
+  {
+    std::cerr << "MoveBufferFrom copied instead of moving the buffer." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (destination->GetNumberOfComponents() != 3 || destination->GetNumberOfTuples() != 100 ||
+    destination->GetValue(299) != 299.0)
+  {
+    std::cerr << "Moved array has wrong shape or content." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (source->GetNumberOfTuples() != 0)
+  {
+    std::cerr << "Source array should be empty after the move." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // TakeBuffer hands the memory and its deleter to the caller.
+  vtkIdType numValues = 0;
+  vtkFreeingFunction freeFunction = nullptr;
+  double* buffer = destination->TakeBuffer(numValues, freeFunction);
+  if (!buffer || numValues != 300 || buffer[42] != 42.0)
+  {
+    std::cerr << "TakeBuffer did not return the expected buffer." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (destination->GetNumberOfTuples() != 0)
+  {
+    std::cerr << "Array should be empty after TakeBuffer." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!freeFunction)
+  {
+    std::cerr << "Array-owned memory must come with a free function." << std::endl;
+    return EXIT_FAILURE;
+  }
+  freeFunction(buffer);
+
+  // Buffers adopted with save != 0 are reported as not owned.
+  double userData[6] = { 0, 1, 2, 3, 4, 5 };
+  vtkNew<vtkDoubleArray> wrapper;
+  wrapper->SetArray(userData, 6, /*save=*/1);
+  buffer = wrapper->TakeBuffer(numValues, freeFunction);
+  if (buffer != userData || numValues != 6 || freeFunction != nullptr)
+  {
+    std::cerr << "TakeBuffer mishandled a user-owned buffer." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+
+namespace
+{
+
+bool CheckRange(vtkDoubleArray* array, int comp, double expectedMin, double expectedMax,
+  const char* description)
+{
+  double range[2];
+  array->GetRange(range, comp);
+  if (range[0] != expectedMin || range[1] != expectedMax)
+  {
+    cerr << description << ": component " << comp << " range is [" << range[0] << ", " << range[1]
+         << "], expected [" << expectedMin << ", " << expectedMax << "]\n";
+    return false;
+  }
+  return true;
+}
+
+} // end anon namespace
+
+int TestDataArrayIncrementalRange(int, char*[])
+{
+  vtkNew<vtkDoubleArray> array;
+  array->SetNumberOfComponents(2);
+
+  double tuple[2] = { 1.0, 10.0 };
+  array->InsertNextTuple(tuple);
+  tuple[0] = 5.0;
+  tuple[1] = -10.0;
+  array->InsertNextTuple(tuple);
+
+  if (array->GetIncrementalRangeMode())
+  {
+    cerr << "IncrementalRangeMode should be off by default\n";
+    return 1;
+  }
+  array->IncrementalRangeModeOn();
+
+  // prime the cache with a full computation
+  if (!CheckRange(array, 0, 1.0, 5.0, "Initial range") ||
+    !CheckRange(array, 1, -10.0, 10.0, "Initial range"))
+  {
+    return 1;
+  }
+
+  // append tuples that extend the range of each component; the stale cache
+  // must be merged with a scan of the appended window only
+  tuple[0] = -3.0;
+  tuple[1] = 2.0;
+  array->InsertNextTuple(tuple);
+  tuple[0] = 8.0;
+  tuple[1] = 20.0;
+  array->InsertNextTuple(tuple);
+  // InsertNextTuple does not bump the MTime; the incremental contract is
+  // MTime driven, so flag the edit the way a writer filter would
+  array->Modified();
+  if (!CheckRange(array, 0, -3.0, 8.0, "Range after appending") ||
+    !CheckRange(array, 1, -10.0, 20.0, "Range after appending"))
+  {
+    return 1;
+  }
+
+  // append a tuple interior to the current range, nothing should change
+  tuple[0] = 0.0;
+  tuple[1] = 0.0;
+  array->InsertNextTuple(tuple);
+  array->Modified();
+  if (!CheckRange(array, 0, -3.0, 8.0, "Range after interior append") ||
+    !CheckRange(array, 1, -10.0, 20.0, "Range after interior append"))
+  {
+    return 1;
+  }
+
+  // an MTime bump without any appended tuples must reuse the cached range
+  array->Modified();
+  if (!CheckRange(array, 0, -3.0, 8.0, "Range after Modified") ||
+    !CheckRange(array, 1, -10.0, 20.0, "Range after Modified"))
+  {
+    return 1;
+  }
+
+  // in-place edits require toggling the mode off and on again; the toggle
+  // must discard the cached range so the edit is picked up by a full scan
+  array->IncrementalRangeModeOff();
+  tuple[0] = -30.0;
+  tuple[1] = 30.0;
+  array->SetTuple(0, tuple);
+  array->IncrementalRangeModeOn();
+  if (!CheckRange(array, 0, -30.0, 8.0, "Range after in-place edit") ||
+    !CheckRange(array, 1, -10.0, 30.0, "Range after in-place edit"))
+  {
+    return 1;
+  }
+
+  // and the rebuilt cache must keep extending incrementally afterwards
+  tuple[0] = 40.0;
+  tuple[1] = -40.0;
+  array->InsertNextTuple(tuple);
+  array->Modified();
+  if (!CheckRange(array, 0, -30.0, 40.0, "Range after edit and append") ||
+    !CheckRange(array, 1, -40.0, 30.0, "Range after edit and append"))
+  {
+    return 1;
+  }
+
+  return 0;
+}
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include "vtkAutoInit.h"
 #include "vtkDebugLeaks.h"
 #include "vtkObjectFactory.h"
 #include "vtkObjectFactoryCollection.h"
@@ -71,6 +72,12 @@ TestFactory::TestFactory()
     vtkObjectFactoryCreatevtkTestPoints2);
 }
 
+static int deferredConstructCalls = 0;
+static void TestDeferredConstruct()
+{
+  ++deferredConstructCalls;
+}
+
 void TestNewPoints(vtkPoints* v, const char* expectedClassName)
 {
   if (strcmp(v->GetClassName(), expectedClassName) != 0)
@@ -165,6 +172,17 @@ int TestObjectFactory(int, char*[])
     failed = 1;
   }
   oic->Delete();
+
+  // With the registry already initialized, a deferred module registration
+  // must execute immediately (the late plugin load path).
+  vtkAutoInitDeferConstruct(&TestDeferredConstruct);
+  if (deferredConstructCalls != 1)
+  {
+    cout << "failed: vtkAutoInitDeferConstruct did not run the construct "
+            "function immediately on an initialized registry\n";
+    failed = 1;
+  }
+
   vtkObjectFactory::UnRegisterAllFactories();
   return failed;
 }
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkIdList.h"
+#include "vtkObjectPool.h"
+
+int TestObjectPool(int, char*[])
+{
+  vtkObjectPool<vtkIdList> pool;
+
+  // Recycled instances must be handed out again instead of new allocations.
+  vtkIdList* first = pool.Acquire();
+  first->InsertNextId(42);
+  pool.Recycle(first);
+  vtkIdList* second = pool.Acquire();
+  if (second != first)
+  {
+    std::cerr << "Expected the recycled instance to be reused." << std::endl;
+    return EXIT_FAILURE;
+  }
+  // State survives recycling; callers reset as with any reused temporary.
+  if (second->GetNumberOfIds() != 1 || second->GetId(0) != 42)
+  {
+    std::cerr << "Recycled instance lost its state." << std::endl;
+    return EXIT_FAILURE;
+  }
+  second->Reset();
+  pool.Recycle(second);
+
+  // Objects still referenced elsewhere may not be pooled.
+  vtkIdList* shared = pool.Acquire();
+  shared->Register(nullptr);
+  pool.Recycle(shared); // deleted from the pool's point of view
+  if (shared->GetReferenceCount() != 1)
+  {
+    std::cerr << "Shared object should have dropped to one reference." << std::endl;
+    shared->UnRegister(nullptr);
+    return EXIT_FAILURE;
+  }
+  shared->UnRegister(nullptr);
+
+  // The pool caps the number of idle instances it retains.
+  pool.SetMaximumPoolSize(2);
+  vtkIdList* a = pool.Acquire();
+  vtkIdList* b = pool.Acquire();
+  vtkIdList* c = pool.Acquire();
+  pool.Recycle(a);
+  pool.Recycle(b);
+  pool.Recycle(c); // beyond the cap, deleted
+
+  // Thread instance is stable within a thread.
+  if (&vtkObjectPool<vtkIdList>::GetThreadInstance() !=
+    &vtkObjectPool<vtkIdList>::GetThreadInstance())
+  {
+    std::cerr << "GetThreadInstance must return the same pool." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkIdTypeArray.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkParallelAlgorithms.h"
+
+#include <algorithm>
+#include <vector>
+
+int TestParallelAlgorithms(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(8775070);
+
+  // Large enough to take the radix path for vtkIdType, with duplicates.
+  constexpr vtkIdType N = 100000;
+
+  // In-place sort of an array's own buffer against a std::sort reference.
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetNumberOfValues(N);
+  std::vector<vtkIdType> reference(N);
+  for (vtkIdType i = 0; i < N; ++i)
+  {
+    vtkIdType value = static_cast<vtkIdType>(random->GetValue() * 10000.) - 5000;
+    ids->SetValue(i, value);
+    reference[i] = value;
+    random->Next();
+  }
+
+  vtk::ParallelSort(ids.Get());
+  std::sort(reference.begin(), reference.end());
+  for (vtkIdType i = 0; i < N; ++i)
+  {
+    if (ids->GetValue(i) != reference[i])
+    {
+      std::cerr << "ParallelSort() disagrees with std::sort at index " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Sort-unique must truncate the array to the unique values.
+  vtkIdType numUnique = vtk::ParallelSortUnique(ids.Get());
+  reference.erase(std::unique(reference.begin(), reference.end()), reference.end());
+  if (numUnique != static_cast<vtkIdType>(reference.size()) ||
+    ids->GetNumberOfValues() != numUnique)
+  {
+    std::cerr << "ParallelSortUnique() kept " << numUnique << " values, expected "
+              << reference.size() << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < numUnique; ++i)
+  {
+    if (ids->GetValue(i) != reference[i])
+    {
+      std::cerr << "ParallelSortUnique() disagrees with std::unique at index " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The non-integral overload must route through the comparison sort.
+  std::vector<double> doubles = { 3.5, -1.25, 0.0, 7.75, -1.25 };
+  if (vtk::ParallelSortUnique(doubles.data(), doubles.data() + doubles.size()) != 4 ||
+    !std::is_sorted(doubles.begin(), doubles.begin() + 4))
+  {
+    std::cerr << "ParallelSortUnique() failed on a double buffer" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Join queries against the sorted-unique ids: every present value must
+  // resolve to its index, absent values to -1.
+  std::vector<vtkIdType> queries;
+  for (vtkIdType i = 0; i < numUnique; i += 7)
+  {
+    queries.push_back(ids->GetValue(i));
+  }
+  queries.push_back(reference.back() + 1); // beyond the sorted range
+  std::vector<vtkIdType> indices(queries.size());
+  vtk::ParallelBinarySearchJoin(ids->GetPointer(0), ids->GetPointer(0) + numUnique,
+    queries.data(), queries.data() + queries.size(), indices.data());
+  for (size_t q = 0; q < queries.size(); ++q)
+  {
+    if (q + 1 == queries.size())
+    {
+      if (indices[q] != -1)
+      {
+        std::cerr << "ParallelBinarySearchJoin() found a value that is not present" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+    else if (indices[q] < 0 || ids->GetValue(indices[q]) != queries[q])
+    {
+      std::cerr << "ParallelBinarySearchJoin() resolved query " << q << " incorrectly" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
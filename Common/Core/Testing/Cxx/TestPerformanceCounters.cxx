@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkPerformanceCounters.h"
+
+#include <iostream>
+
+int TestPerformanceCounters(int, char*[])
+{
+  vtkPerformanceCounters::Reset();
+
+  // manual bumps accumulate
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::LOCATOR_BUILDS, 1);
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::LOCATOR_BUILDS, 2);
+  if (vtkPerformanceCounters::Get(vtkPerformanceCounters::LOCATOR_BUILDS) != 3)
+  {
+    std::cerr << "Expected LocatorBuilds == 3, got "
+              << vtkPerformanceCounters::Get(vtkPerformanceCounters::LOCATOR_BUILDS) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the deep copy hot path is instrumented
+  vtkNew<vtkDoubleArray> source;
+  source->SetNumberOfComponents(3);
+  source->SetNumberOfTuples(100);
+  source->Fill(1.0);
+  vtkNew<vtkDoubleArray> target;
+  target->DeepCopy(source);
+  vtkTypeUInt64 copied = vtkPerformanceCounters::Get(vtkPerformanceCounters::DEEP_COPY_BYTES);
+  if (copied < 300 * sizeof(double))
+  {
+    std::cerr << "Expected at least " << 300 * sizeof(double) << " deep-copied bytes, got "
+              << copied << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // while disabled, bumps are dropped
+  vtkPerformanceCounters::SetEnabled(false);
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::LOCATOR_BUILDS, 10);
+  vtkPerformanceCounters::SetEnabled(true);
+  if (vtkPerformanceCounters::Get(vtkPerformanceCounters::LOCATOR_BUILDS) != 3)
+  {
+    std::cerr << "Counter changed while disabled." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkPerformanceCounters::Log(); // must not crash; output goes to the logger
+
+  vtkPerformanceCounters::Reset();
+  if (vtkPerformanceCounters::Get(vtkPerformanceCounters::DEEP_COPY_BYTES) != 0)
+  {
+    std::cerr << "Reset did not zero the counters." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
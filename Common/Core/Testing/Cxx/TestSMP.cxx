@@ -334,6 +334,61 @@ int doTestSMP()
     return EXIT_FAILURE;
   }
 
+  // Test ThreadBudgetScope accounting
+  {
+    auto& smpToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    const int totalThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+
+    // a request is honored while the budget lasts
+    const int outerGranted = smpToolsAPI.AllocateThreadBudget(1);
+    if (outerGranted != 1)
+    {
+      cerr << "Error: AllocateThreadBudget(1) granted " << outerGranted << " threads!" << endl;
+      return EXIT_FAILURE;
+    }
+    // a request for "everything" only gets what is left
+    const int innerGranted = smpToolsAPI.AllocateThreadBudget(0);
+    if (totalThreads > 1 && innerGranted != totalThreads - 1)
+    {
+      cerr << "Error: AllocateThreadBudget(0) granted " << innerGranted << " threads, expected "
+           << totalThreads - 1 << "!" << endl;
+      return EXIT_FAILURE;
+    }
+    // an exhausted budget still grants one thread so the caller can progress
+    const int minimumGranted = smpToolsAPI.AllocateThreadBudget(0);
+    if (minimumGranted < 1)
+    {
+      cerr << "Error: an exhausted thread budget granted " << minimumGranted << " threads!" << endl;
+      return EXIT_FAILURE;
+    }
+    smpToolsAPI.ReleaseThreadBudget(minimumGranted);
+    smpToolsAPI.ReleaseThreadBudget(innerGranted);
+    smpToolsAPI.ReleaseThreadBudget(outerGranted);
+
+    // the scope runs its loops to completion and hands its grant back on exit
+    ARangeFunctor budgetFunctor;
+    vtkSMPTools::ThreadBudgetScope(2, [&]() { vtkSMPTools::For(0, Target, budgetFunctor); });
+    total = 0;
+    for (const auto& el : budgetFunctor.Counter)
+    {
+      total += el;
+    }
+    if (total != Target)
+    {
+      cerr << "Error: ThreadBudgetScope generated " << total << ", did not generate " << Target
+           << endl;
+      return EXIT_FAILURE;
+    }
+    const int fullGranted = smpToolsAPI.AllocateThreadBudget(0);
+    if (fullGranted != totalThreads)
+    {
+      cerr << "Error: ThreadBudgetScope did not return its grant; " << fullGranted << " of "
+           << totalThreads << " threads left!" << endl;
+      return EXIT_FAILURE;
+    }
+    smpToolsAPI.ReleaseThreadBudget(fullGranted);
+  }
+
   // Test sorting
   double data0[] = { 2, 1, 0, 3, 9, 6, 7, 3, 8, 4, 5 };
   std::vector<double> myvector(data0, data0 + 11);
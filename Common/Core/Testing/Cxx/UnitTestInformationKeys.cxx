@@ -3,6 +3,7 @@
 #include "vtkInformation.h"
 #include "vtkInformationDoubleKey.h"
 #include "vtkInformationDoubleVectorKey.h"
+#include "vtkInformationIntegerKey.h"
 #include "vtkInformationStringKey.h"
 #include "vtkInformationStringVectorKey.h"
 #include "vtkInformationVariantKey.h"
@@ -11,6 +12,8 @@
 #include "vtkNew.h"
 #include "vtkVariant.h"
 
+#include <vector>
+
 template <typename T, typename V>
 int UnitTestScalarValueKey(vtkInformation* info, T* key, const V& val)
 {
@@ -127,6 +130,66 @@ int UnitTestVectorValueKey(
   return ok_setgetcomp && ok_copyget && ok_length && ok_appendedlength;
 }
 
+// Exercise the flat key storage past its inline capacity: set, overwrite,
+// look up and remove more keys than one information object usually holds.
+int UnitTestManyKeys()
+{
+  int ok = 1;
+  vtkNew<vtkInformation> info;
+
+  const int numKeys = 40;
+  std::vector<vtkInformationIntegerKey*> keys;
+  keys.reserve(numKeys);
+  for (int i = 0; i < numKeys; ++i)
+  {
+    keys.push_back(new vtkInformationIntegerKey("TestMany", "vtkTest"));
+    keys[i]->Set(info, i);
+  }
+  for (int i = 0; i < numKeys; ++i)
+  {
+    if (keys[i]->Get(info) != i)
+    {
+      cerr << "Key " << i << " lost its value after spill.\n";
+      ok = 0;
+    }
+  }
+  if (info->GetNumberOfKeys() != numKeys)
+  {
+    cerr << "Expected " << numKeys << " keys, got " << info->GetNumberOfKeys() << ".\n";
+    ok = 0;
+  }
+
+  // Remove every other key and check the survivors.
+  for (int i = 0; i < numKeys; i += 2)
+  {
+    info->Remove(keys[i]);
+  }
+  for (int i = 0; i < numKeys; ++i)
+  {
+    if (info->Has(keys[i]) != (i % 2))
+    {
+      cerr << "Key " << i << " has wrong presence after removal.\n";
+      ok = 0;
+    }
+    if ((i % 2) && keys[i]->Get(info) != i)
+    {
+      cerr << "Key " << i << " lost its value after removal of others.\n";
+      ok = 0;
+    }
+  }
+
+  // Copying must only carry the surviving keys.
+  vtkNew<vtkInformation> copy;
+  copy->Copy(info);
+  if (copy->GetNumberOfKeys() != numKeys / 2)
+  {
+    cerr << "Copy has " << copy->GetNumberOfKeys() << " keys, expected " << numKeys / 2 << ".\n";
+    ok = 0;
+  }
+
+  return ok;
+}
+
 int UnitTestInformationKeys(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
 {
   int ok = 1;
@@ -153,5 +216,7 @@ int UnitTestInformationKeys(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
   vtkInformationStringVectorKey* tsvkey = new vtkInformationStringVectorKey("Test", "vtkTest");
   ok &= UnitTestVectorValueKey(info, tsvkey, tsval);
 
+  ok &= UnitTestManyKeys();
+
   return !ok;
 }
@@ -135,6 +135,18 @@ class TestNumpySupport(Testing.vtkTest):
         self.assertEqual(vtk_array.GetTuple3(0), (1., 3., 5.))
         self.assertEqual(vtk_array.GetTuple3(1), (13., 15., 17.))
 
+    def testNumpyConversionReferenceWhenDelete(self):
+        "Test that dtype-converted shallow arrays keep their buffer alive"
+        np_array = numpy.array([[1., 2., 3.], [4., 5., 6.]], 'd')
+        vtk_array = numpy_to_vtk(np_array, 0, VTK_INT)
+        del np_array
+
+        import gc
+        gc.collect()
+
+        self.assertEqual(vtk_array.GetTuple3(0), (1., 2., 3.))
+        self.assertEqual(vtk_array.GetTuple3(1), (4., 5., 6.))
+
     def testNumpyReduce(self):
         "Test that reducing methods return scalars."
         vtk_array = vtkLongArray()
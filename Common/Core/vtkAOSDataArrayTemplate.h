@@ -202,6 +202,26 @@ public:
    **/
   void SetArrayFreeFunction(void (*callback)(void*)) override;
 
+  /**
+   * Move the internal storage buffer out of this array without copying.
+   * Returns the raw pointer; @a numValues receives the number of valid
+   * values and @a freeFunction the function the caller must use to release
+   * the memory. When @a freeFunction is nullptr the memory belongs to
+   * someone else (it was adopted with save != 0) and must not be freed.
+   * The array is left empty. This is the inverse of SetArray, which hands a
+   * user buffer to the array.
+   */
+  ValueType* TakeBuffer(vtkIdType& numValues, vtkFreeingFunction& freeFunction);
+
+  /**
+   * Adopt the storage of @a source without copying: this array takes over
+   * the buffer (and its delete method), the number of components and the
+   * number of tuples, while @a source is emptied and this array's previous
+   * storage is released. Useful to transfer large point or scalar arrays
+   * into a filter output with zero memcpy.
+   */
+  void MoveBufferFrom(vtkAOSDataArrayTemplate<ValueTypeT>* source);
+
   // Overridden for optimized implementations:
   void SetTuple(vtkIdType tupleIdx, const float* tuple) override;
   void SetTuple(vtkIdType tupleIdx, const double* tuple) override;
@@ -13,6 +13,8 @@
 
 #include "vtkArrayIteratorTemplate.h"
 
+#include <utility> // For std::swap
+
 //-----------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 template <class ValueTypeT>
@@ -114,6 +116,42 @@ void vtkAOSDataArrayTemplate<ValueType>::SetArrayFreeFunction(void (*callback)(v
   this->Buffer->SetFreeFunction(false, callback);
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+typename vtkAOSDataArrayTemplate<ValueTypeT>::ValueType*
+vtkAOSDataArrayTemplate<ValueTypeT>::TakeBuffer(
+  vtkIdType& numValues, vtkFreeingFunction& freeFunction)
+{
+  numValues = this->MaxId + 1;
+  freeFunction = this->Buffer->GetFreeFunction();
+  ValueType* buffer = this->Buffer->ReleaseBuffer();
+  this->Size = 0;
+  this->MaxId = -1;
+  this->DataChanged();
+  return buffer;
+}
+
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+void vtkAOSDataArrayTemplate<ValueTypeT>::MoveBufferFrom(
+  vtkAOSDataArrayTemplate<ValueTypeT>* source)
+{
+  if (!source || source == this)
+  {
+    return;
+  }
+  this->SetNumberOfComponents(source->GetNumberOfComponents());
+  // The storage object is reference counted, so moving it between arrays is
+  // a pointer swap; no element is copied.
+  std::swap(this->Buffer, source->Buffer);
+  std::swap(this->Size, source->Size);
+  std::swap(this->MaxId, source->MaxId);
+  // Drop this array's previous storage (now held by source) and leave the
+  // source empty.
+  source->Initialize();
+  this->DataChanged();
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const float* tuple)
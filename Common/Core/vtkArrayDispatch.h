@@ -412,6 +412,27 @@ struct Dispatch3BySameValueTypeUsingArrays;
 template <typename ValueTypeList>
 struct Dispatch3BySameValueType;
 
+//------------------------------------------------------------------------------
+/**
+ * Call-site memoization wrapper around any single-array dispatcher.
+ *
+ * Resolving a dispatch walks the configured array TypeList with one downcast
+ * attempt per entry; in tight pipeline loops that repeatedly dispatch arrays
+ * of the same concrete type, this chain dominates the dispatch cost. The
+ * cached variant remembers, per instantiation, the concrete array type that
+ * matched last time and retries it with a single downcast before falling
+ * back to (and re-priming from) the full resolution chain.
+ *
+ * Each distinct (dispatcher, worker, parameter) combination keeps its own
+ * cache entry, so a worker type used from one call site memoizes exactly
+ * that call site. The cache is a single atomic function pointer: safe to use
+ * from multiple threads, with the last successful resolution winning.
+ * The entry point mirrors the wrapped dispatcher:
+ * bool CachedDispatch<Dispatcher>::Execute(vtkDataArray *array, Worker &worker).
+ */
+template <typename DispatcherT>
+struct CachedDispatch;
+
 //------------------------------------------------------------------------------
 /**
  * Filter the ArrayList to contain only arrays with ArrayType::ValueType that
@@ -9,7 +9,9 @@
 #include "vtkDebug.h"  // For warning macro settings.
 #include "vtkSetGet.h" // For warning macros.
 
-#include <utility> // For std::forward
+#include <atomic>      // For the dispatch cache
+#include <type_traits> // For std::remove_reference
+#include <utility>     // For std::forward
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDataArray;
@@ -783,7 +785,75 @@ public:
 struct Dispatch3SameValueType : Dispatch3SameValueTypeUsingArrays<Arrays>
 {
 };
+VTK_ABI_NAMESPACE_END
+
+//------------------------------------------------------------------------------
+// CachedDispatch implementation:
+//------------------------------------------------------------------------------
+namespace impl
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+// Wraps the user worker during a full resolution so that the concrete array
+// type that matched can be recorded in the call-site cache.
+template <typename Worker, typename Trampoline>
+struct DispatchCacheRecorder
+{
+  Worker& UserWorker;
+  std::atomic<Trampoline>& Cache;
 
+  template <typename ArrayT, typename... Ts>
+  void operator()(ArrayT* array, Ts&&... ts)
+  {
+    this->Cache.store(&DispatchCacheRecorder::template Retry<ArrayT, Ts...>,
+      std::memory_order_relaxed);
+    this->UserWorker(array, std::forward<Ts>(ts)...);
+  }
+
+  // The memoized fast path: a single downcast to the previously resolved
+  // concrete type.
+  template <typename ArrayT, typename... Ts>
+  static bool Retry(vtkDataArray* inArray, Worker& worker, Ts&... params)
+  {
+    if (ArrayT* array = vtkArrayDownCast<ArrayT>(inArray))
+    {
+      worker(array, params...);
+      return true;
+    }
+    return false;
+  }
+};
+
+VTK_ABI_NAMESPACE_END
+} // end namespace impl
+
+VTK_ABI_NAMESPACE_BEGIN
+template <typename DispatcherT>
+struct CachedDispatch
+{
+  template <typename Worker, typename... Params>
+  static bool Execute(vtkDataArray* inArray, Worker&& worker, Params&&... params)
+  {
+    using WorkerT = typename std::remove_reference<Worker>::type;
+    using Trampoline =
+      bool (*)(vtkDataArray*, WorkerT&, typename std::remove_reference<Params>::type&...);
+
+    // One cache entry per (dispatcher, worker, parameter) instantiation,
+    // i.e. effectively per call site.
+    static std::atomic<Trampoline> cache{ nullptr };
+
+    if (Trampoline call = cache.load(std::memory_order_relaxed))
+    {
+      if (call(inArray, worker, params...))
+      {
+        return true;
+      }
+    }
+
+    impl::DispatchCacheRecorder<WorkerT, Trampoline> recorder{ worker, cache };
+    return DispatcherT::Execute(inArray, recorder, std::forward<Params>(params)...);
+  }
+};
 VTK_ABI_NAMESPACE_END
 } // end namespace vtkArrayDispatch
 
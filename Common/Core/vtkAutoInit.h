@@ -4,9 +4,26 @@
 #define vtkAutoInit_h
 
 #include "vtkABINamespace.h"
+#include "vtkCommonCoreModule.h"  // For export macro
 #include "vtkDebugLeaksManager.h" // DebugLeaks exists longer.
 #include "vtkTimeStamp.h"         // Here so that TimeStamp Schwarz initializer works
 
+VTK_ABI_NAMESPACE_BEGIN
+// Defined in vtkObjectFactory.cxx. Queues a module factory registration
+// function so that it runs on the first vtkObjectFactory lookup instead of
+// during static initialization; applications linking many modules then do
+// not pay for every factory's construction at startup. If the factory
+// registry is already initialized -- a module loaded after the first lookup,
+// e.g. a plugin -- the function is executed immediately.
+VTKCOMMONCORE_EXPORT void vtkAutoInitDeferConstruct(void (*construct)());
+// Defined in vtkObjectFactory.cxx. Runs any construct functions still queued
+// by vtkAutoInitDeferConstruct. vtkObjectFactory::Init() calls this on the
+// first factory lookup; code that depends on a side effect of a module's
+// construct function other than factory registration (e.g. the callbacks the
+// SQL database modules register) must call it before relying on that effect.
+VTKCOMMONCORE_EXPORT void vtkAutoInitFlushDeferredConstructs();
+VTK_ABI_NAMESPACE_END
+
 #define VTK_MODULE_AUTOINIT VTK_AUTOINIT
 
 #define VTK_AUTOINIT(M) VTK_AUTOINIT0(M, M##_AUTOINIT)
@@ -59,7 +76,7 @@
   VTK_AUTOINIT_CONSTRUCT_7(t1, t2, t3, t4, t5, t6, t7) VTK_AUTOINIT_CONSTRUCT(t8)
 #define VTK_AUTOINIT_CONSTRUCT_9(t1, t2, t3, t4, t5, t6, t7, t8, t9)                               \
   VTK_AUTOINIT_CONSTRUCT_8(t1, t2, t3, t4, t5, t6, t7, t8) VTK_AUTOINIT_CONSTRUCT(t9)
-#define VTK_AUTOINIT_CONSTRUCT(M) M##_AutoInit_Construct();
+#define VTK_AUTOINIT_CONSTRUCT(M) vtkAutoInitDeferConstruct(&M##_AutoInit_Construct);
 
 // Description:
 // Initialize the named module, ensuring its object factory is correctly
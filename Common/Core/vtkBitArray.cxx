@@ -6,6 +6,9 @@
 #include "vtkIdList.h"
 #include "vtkObjectFactory.h"
 
+#include <algorithm> // For std::min/std::max
+#include <cstring>   // For memset
+
 VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
@@ -674,6 +677,153 @@ vtkIdType vtkBitArray::InsertNextTuple(const double* tuple)
   return this->MaxId / this->NumberOfComponents;
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkBitArray::CountSetBits() const
+{
+  // Per-byte population counts; the unused bits of the last byte are kept at
+  // zero by InitializeUnusedBitsInLastByte so whole bytes can be summed.
+  static const unsigned char popCount[256] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 1,
+    2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4, 5,
+    2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4, 4,
+    5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5,
+    5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3,
+    4, 4, 5, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5, 4, 5, 5, 6, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4, 5,
+    4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 2, 3, 3, 4, 3, 4, 4, 5, 3, 4, 4,
+    5, 4, 5, 5, 6, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5, 5, 6, 5, 6, 6, 7, 3, 4, 4, 5, 4, 5, 5, 6, 4, 5,
+    5, 6, 5, 6, 6, 7, 4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8 };
+
+  const vtkIdType numBytes = (this->MaxId + 8) / 8;
+  vtkIdType count = 0;
+  for (vtkIdType i = 0; i < numBytes; ++i)
+  {
+    count += popCount[this->Array[i]];
+  }
+  return count;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBitArray::FindNextSetBit(vtkIdType startId) const
+{
+  const vtkIdType numValues = this->MaxId + 1;
+  if (startId < 0)
+  {
+    startId = 0;
+  }
+  if (startId >= numValues)
+  {
+    return -1;
+  }
+
+  // Finish the partial byte containing startId.
+  vtkIdType byteId = startId / 8;
+  unsigned char byte = static_cast<unsigned char>(this->Array[byteId] & (0xff >> (startId % 8)));
+  const vtkIdType numBytes = (numValues + 7) / 8;
+  while (byte == 0)
+  {
+    if (++byteId >= numBytes)
+    {
+      return -1;
+    }
+    byte = this->Array[byteId];
+  }
+
+  // Locate the most significant set bit: bits are stored MSB first.
+  int bit = 0;
+  while (!(byte & (0x80 >> bit)))
+  {
+    ++bit;
+  }
+  const vtkIdType id = byteId * 8 + bit;
+  return id < numValues ? id : -1;
+}
+
+//------------------------------------------------------------------------------
+bool vtkBitArray::BitwiseAnd(vtkBitArray* other)
+{
+  if (!other || other->GetNumberOfValues() != this->GetNumberOfValues())
+  {
+    vtkErrorMacro("Both arrays must hold the same number of values.");
+    return false;
+  }
+  const vtkIdType numBytes = (this->MaxId + 8) / 8;
+  const unsigned char* src = other->Array;
+  for (vtkIdType i = 0; i < numBytes; ++i)
+  {
+    this->Array[i] &= src[i];
+  }
+  this->DataChanged();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkBitArray::BitwiseOr(vtkBitArray* other)
+{
+  if (!other || other->GetNumberOfValues() != this->GetNumberOfValues())
+  {
+    vtkErrorMacro("Both arrays must hold the same number of values.");
+    return false;
+  }
+  const vtkIdType numBytes = (this->MaxId + 8) / 8;
+  const unsigned char* src = other->Array;
+  for (vtkIdType i = 0; i < numBytes; ++i)
+  {
+    this->Array[i] |= src[i];
+  }
+  this->DataChanged();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkBitArray::BitwiseXor(vtkBitArray* other)
+{
+  if (!other || other->GetNumberOfValues() != this->GetNumberOfValues())
+  {
+    vtkErrorMacro("Both arrays must hold the same number of values.");
+    return false;
+  }
+  const vtkIdType numBytes = (this->MaxId + 8) / 8;
+  const unsigned char* src = other->Array;
+  for (vtkIdType i = 0; i < numBytes; ++i)
+  {
+    this->Array[i] ^= src[i];
+  }
+  this->DataChanged();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkBitArray::FillRange(vtkIdType begin, vtkIdType end, int value)
+{
+  begin = std::max(begin, vtkIdType(0));
+  end = std::min(end, this->MaxId + 1);
+  if (begin >= end)
+  {
+    return;
+  }
+
+  const vtkIdType firstFullByte = (begin + 7) / 8;
+  const vtkIdType lastFullByte = end / 8;
+
+  // Partial byte in front of the first full byte (and behind it when the
+  // whole range lives in a single byte).
+  for (vtkIdType id = begin; id < std::min(firstFullByte * 8, end); ++id)
+  {
+    this->SetValue(id, value);
+  }
+  // Interior full bytes in one go.
+  if (lastFullByte > firstFullByte)
+  {
+    memset(this->Array + firstFullByte, value ? 0xff : 0x00,
+      static_cast<size_t>(lastFullByte - firstFullByte));
+  }
+  // Trailing partial byte.
+  for (vtkIdType id = std::max(lastFullByte * 8, begin); id < end; ++id)
+  {
+    this->SetValue(id, value);
+  }
+  this->DataChanged();
+}
+
 //------------------------------------------------------------------------------
 void vtkBitArray::InsertComponent(vtkIdType i, int j, double c)
 {
@@ -230,6 +230,46 @@ public:
 
   vtkIdType InsertNextValue(int i);
 
+  /**
+   * Return the number of set bits in the array, visiting a byte of storage
+   * at a time instead of testing bits through GetValue.
+   */
+  vtkIdType CountSetBits() const;
+
+  /**
+   * Return the id of the first set bit at or after @a startId, or -1 when no
+   * further bit is set. Whole bytes of zeros are skipped without testing
+   * individual bits, so sparse masks can be iterated efficiently:
+   * \code
+   * for (vtkIdType id = mask->FindNextSetBit(0); id != -1;
+   *      id = mask->FindNextSetBit(id + 1)) { ... }
+   * \endcode
+   */
+  vtkIdType FindNextSetBit(vtkIdType startId) const;
+
+  ///@{
+  /**
+   * Combine this array with @a other in place, a byte of storage at a time:
+   * and/or/xor every bit of this array with the corresponding bit of
+   * @a other. Both arrays must hold the same number of values; returns false
+   * (and leaves this array untouched) otherwise.
+   *
+   * NOT THREAD-SAFE
+   */
+  bool BitwiseAnd(vtkBitArray* other);
+  bool BitwiseOr(vtkBitArray* other);
+  bool BitwiseXor(vtkBitArray* other);
+  ///@}
+
+  /**
+   * Set every value in the half-open range [begin, end) to @a value. Interior
+   * bytes are filled with memset; only the partial bytes at the boundaries
+   * are touched bit by bit. The range must lie inside the allocated values.
+   *
+   * NOT THREAD-SAFE
+   */
+  void FillRange(vtkIdType begin, vtkIdType end, int value);
+
   /**
    * Insert the data component at ith tuple and jth component location.
    * Note that memory allocation is performed as necessary to hold the data.
@@ -41,6 +41,10 @@
  * 0.0 and 1.0
  *  - Infovis/vtkFixedWidthTextReader returns a pointer to a float value equal
  * to the number of lines read so far.
+ * - vtkCommand::PartialResultEvent
+ *  - vtkAlgorithm returns a pointer to a double value ranged between
+ * 0.0 and 1.0; the algorithm's outputs hold a displayable partial result
+ * for the duration of the event
  * - vtkCommand::ErrorEvent
  *  - an error message as a const char * string
  * - vtkCommand::WarningEvent
@@ -368,7 +372,8 @@
     _vtk_add_event(PositionProp3DEvent)                                                            \
     _vtk_add_event(Pick3DEvent)                                                                    \
     _vtk_add_event(Select3DEvent)                                                                  \
-    _vtk_add_event(Elevation3DEvent)
+    _vtk_add_event(Elevation3DEvent)                                                               \
+    _vtk_add_event(PartialResultEvent)
 // clang-format on
 
 #define vtkEventDeclarationMacro(_enum_name)                                                       \
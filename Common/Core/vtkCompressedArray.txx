@@ -0,0 +1,24 @@
+#include "vtkCompressedArray.h"
+
+#include "vtkDataArray.h"
+
+//-----------------------------------------------------------------------
+namespace vtk
+{
+VTK_ABI_NAMESPACE_BEGIN
+template <typename T>
+vtkSmartPointer<vtkCompressedArray<T>> CompressDataArray(vtkDataArray* array)
+{
+  if (!array)
+  {
+    return nullptr;
+  }
+  vtkNew<vtkCompressedArray<T>> compressed;
+  compressed->SetBackend(std::make_shared<vtkCompressedImplicitBackend<T>>(array));
+  compressed->SetNumberOfComponents(array->GetNumberOfComponents());
+  compressed->SetNumberOfTuples(array->GetNumberOfTuples());
+  compressed->SetName(array->GetName());
+  return compressed;
+}
+VTK_ABI_NAMESPACE_END
+}
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkCompressedImplicitBackend_h
+#define vtkCompressedImplicitBackend_h
+
+/**
+ * \class vtkCompressedImplicitBackend
+ * \brief A utility structure serving as a backend for compressed arrays: an array whose values
+ * are stored bit-packed in fixed-size blocks
+ *
+ * This structure can be classified as a closure and can be called using syntax similar to a
+ * function call.
+ *
+ * At construction the values are split into fixed-size blocks and each block is stored as a
+ * frame-of-reference: the block minimum plus per-value offsets packed at the smallest bit width
+ * that covers the block's range. Integer values (ids, labels, connectivity-like attributes) with
+ * locally small ranges compress particularly well; floating point values are packed through
+ * their bit representation and compress when neighboring values share sign and exponent. The
+ * compression is always lossless, and because every value occupies the same number of bits
+ * within its block, single values decode in O(1) without unpacking the block.
+ *
+ * An example of potential usage in a vtkImplicitArray
+ * ```
+ * vtkNew<vtkIntArray> originalArr;
+ * originalArr->SetNumberOfComponents(1);
+ * originalArr->SetNumberOfTuples(100);
+ * // ... fill the array ...
+ * vtkNew<vtkImplicitArray<vtkCompressedImplicitBackend<int>>> compressedArr; // easier with
+ * `vtkNew<vtkCompressedArray<int>> compressedArr;` if applicable
+ * compressedArr->SetBackend(std::make_shared<vtkCompressedImplicitBackend<int>>(originalArr));
+ * compressedArr->SetNumberOfComponents(1);
+ * compressedArr->SetNumberOfTuples(100);
+ * CHECK(compressedArr->GetValue(42) == originalArr->GetValue(42));
+ * ```
+ *
+ * > WARNING:
+ * > Arrays input to the backend are flattened upon use and are no longer sensitive to component
+ * > information.
+ */
+#include "vtkCommonCoreModule.h"
+#include "vtkCompiler.h" // For VTK_USE_EXTERN_TEMPLATE
+#include "vtkType.h"     // For vtkExternTemplateMacro
+
+#include <memory>
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+template <typename ValueType>
+class VTKCOMMONCORE_EXPORT vtkCompressedImplicitBackend final
+{
+public:
+  /**
+   * Constructor for the backend compressing a flat buffer of values
+   * @param values buffer of values to compress
+   * @param numberOfValues number of values in the buffer
+   */
+  vtkCompressedImplicitBackend(const ValueType* values, vtkIdType numberOfValues);
+
+  /**
+   * Constructor for the backend compressing the flattened values of an array
+   * @param array the array whose values to compress
+   */
+  vtkCompressedImplicitBackend(vtkDataArray* array);
+
+  ~vtkCompressedImplicitBackend();
+
+  /**
+   * Indexing operator for the compressed array respecting the `vtkImplicitArray` expectations.
+   *
+   * The value is decoded from its block's packed representation in O(1): the fixed per-block bit
+   * width makes the bit position of any value directly addressable.
+   */
+  ValueType operator()(int idx) const;
+
+  /**
+   * Returns the smallest integer memory size in KiB needed to store the array.
+   * The memory size is that of the packed blocks, not of the uncompressed values.
+   * Used to implement GetActualMemorySize on `vtkCompressedArray`.
+   */
+  unsigned long getMemorySize() const;
+
+protected:
+  struct Internals;
+  std::unique_ptr<Internals> Internal;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkCompressedImplicitBackend_h
+
+#if defined(VTK_COMPRESSED_BACKEND_INSTANTIATING)
+
+#define VTK_INSTANTIATE_COMPRESSED_BACKEND(ValueType)                                              \
+  VTK_ABI_NAMESPACE_BEGIN                                                                          \
+  template class VTKCOMMONCORE_EXPORT vtkCompressedImplicitBackend<ValueType>;                     \
+  VTK_ABI_NAMESPACE_END
+
+#elif defined(VTK_USE_EXTERN_TEMPLATE)
+
+#ifndef VTK_COMPRESSED_BACKEND_TEMPLATE_EXTERN
+#define VTK_COMPRESSED_BACKEND_TEMPLATE_EXTERN
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4910) // extern and dllexport incompatible
+#endif
+VTK_ABI_NAMESPACE_BEGIN
+vtkExternTemplateMacro(extern template class VTKCOMMONCORE_EXPORT vtkCompressedImplicitBackend);
+VTK_ABI_NAMESPACE_END
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif // VTK_COMPRESSED_BACKEND_TEMPLATE_EXTERN
+
+#endif
@@ -0,0 +1,259 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompressedImplicitBackend.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace vtkCompressedImplicitBackendDetail
+{
+VTK_ABI_NAMESPACE_BEGIN
+//-----------------------------------------------------------------------
+/*
+ * Reversible mapping between a value type and an unsigned integer of the same
+ * size, so that frame-of-reference bit packing can be applied uniformly.
+ * Integers map through their two's complement representation, floating point
+ * values through their raw bit pattern.
+ */
+template <typename ValueType, typename = void>
+struct BitRepresentation;
+
+template <typename ValueType>
+struct BitRepresentation<ValueType, typename std::enable_if<std::is_integral<ValueType>::value>::type>
+{
+  using UIntType = typename std::make_unsigned<ValueType>::type;
+  static UIntType Encode(ValueType val) { return static_cast<UIntType>(val); }
+  static ValueType Decode(UIntType bits) { return static_cast<ValueType>(bits); }
+};
+
+template <>
+struct BitRepresentation<float>
+{
+  using UIntType = std::uint32_t;
+  static UIntType Encode(float val)
+  {
+    UIntType bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+  }
+  static float Decode(UIntType bits)
+  {
+    float val;
+    std::memcpy(&val, &bits, sizeof(val));
+    return val;
+  }
+};
+
+template <>
+struct BitRepresentation<double>
+{
+  using UIntType = std::uint64_t;
+  static UIntType Encode(double val)
+  {
+    UIntType bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+  }
+  static double Decode(UIntType bits)
+  {
+    double val;
+    std::memcpy(&val, &bits, sizeof(val));
+    return val;
+  }
+};
+
+//-----------------------------------------------------------------------
+/*
+ * A worker to flatten any dispatchable array into a typed buffer, so that the
+ * compressor only has to deal with flat buffers.
+ */
+template <typename ValueType>
+struct FlattenDispatchWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, std::vector<ValueType>& buffer)
+  {
+    const auto range = vtk::DataArrayValueRange(array);
+    buffer.reserve(range.size());
+    for (const auto val : range)
+    {
+      buffer.push_back(static_cast<ValueType>(val));
+    }
+  }
+
+  // fallback for arrays whose base type cannot be determined by dispatch
+  void operator()(vtkDataArray* array, std::vector<ValueType>& buffer)
+  {
+    int nComps = array->GetNumberOfComponents();
+    vtkIdType nTuples = array->GetNumberOfTuples();
+    buffer.reserve(nTuples * nComps);
+    for (vtkIdType iTup = 0; iTup < nTuples; ++iTup)
+    {
+      for (int iComp = 0; iComp < nComps; ++iComp)
+      {
+        buffer.push_back(static_cast<ValueType>(array->GetComponent(iTup, iComp)));
+      }
+    }
+  }
+};
+VTK_ABI_NAMESPACE_END
+} // namespace vtkCompressedImplicitBackendDetail
+
+VTK_ABI_NAMESPACE_BEGIN
+//-----------------------------------------------------------------------
+template <typename ValueType>
+struct vtkCompressedImplicitBackend<ValueType>::Internals
+{
+  using Bits = vtkCompressedImplicitBackendDetail::BitRepresentation<ValueType>;
+  using UIntType = typename Bits::UIntType;
+
+  /*
+   * The number of values per block. A power of two keeps the index
+   * arithmetic in GetValue cheap; 1024 values keeps the per-block metadata
+   * overhead below 2 bytes per hundred values.
+   */
+  static constexpr vtkIdType BlockSize = 1024;
+
+  struct Block
+  {
+    UIntType Minimum;     // frame of reference for the block
+    vtkIdType WordOffset; // first packed word of the block
+    int Width;            // bits per packed offset, 0 for a constant block
+  };
+
+  /*
+   * Compress a flat buffer of values: each block stores its minimum and the
+   * per-value offsets from that minimum, packed at the smallest bit width
+   * that covers the block's range.
+   */
+  Internals(const ValueType* values, vtkIdType numberOfValues)
+    : NumberOfValues(numberOfValues)
+  {
+    vtkIdType numberOfBlocks = (numberOfValues + BlockSize - 1) / BlockSize;
+    this->Blocks.reserve(numberOfBlocks);
+    for (vtkIdType iBlock = 0; iBlock < numberOfBlocks; ++iBlock)
+    {
+      vtkIdType begin = iBlock * BlockSize;
+      vtkIdType end = std::min(begin + BlockSize, numberOfValues);
+
+      UIntType minimum = Bits::Encode(values[begin]);
+      UIntType maximum = minimum;
+      for (vtkIdType idx = begin + 1; idx < end; ++idx)
+      {
+        UIntType bits = Bits::Encode(values[idx]);
+        minimum = std::min(minimum, bits);
+        maximum = std::max(maximum, bits);
+      }
+
+      Block block;
+      block.Minimum = minimum;
+      block.WordOffset = static_cast<vtkIdType>(this->Words.size());
+      block.Width = 0;
+      for (UIntType range = maximum - minimum; range != 0; range >>= 1)
+      {
+        ++block.Width;
+      }
+
+      if (block.Width > 0)
+      {
+        vtkIdType numberOfWords = ((end - begin) * block.Width + 63) / 64;
+        this->Words.resize(this->Words.size() + numberOfWords, 0);
+        std::uint64_t* words = this->Words.data() + block.WordOffset;
+        for (vtkIdType idx = begin; idx < end; ++idx)
+        {
+          std::uint64_t offset =
+            static_cast<std::uint64_t>(Bits::Encode(values[idx]) - block.Minimum);
+          vtkIdType bitPosition = (idx - begin) * block.Width;
+          vtkIdType word = bitPosition / 64;
+          int shift = static_cast<int>(bitPosition % 64);
+          words[word] |= offset << shift;
+          if (shift + block.Width > 64)
+          {
+            words[word + 1] |= offset >> (64 - shift);
+          }
+        }
+      }
+      this->Blocks.push_back(block);
+    }
+  }
+
+  ValueType GetValue(vtkIdType idx) const
+  {
+    const Block& block = this->Blocks[idx / BlockSize];
+    if (block.Width == 0)
+    {
+      return Bits::Decode(block.Minimum);
+    }
+    vtkIdType bitPosition = (idx % BlockSize) * block.Width;
+    const std::uint64_t* words = this->Words.data() + block.WordOffset + bitPosition / 64;
+    int shift = static_cast<int>(bitPosition % 64);
+    std::uint64_t offset = words[0] >> shift;
+    if (shift + block.Width > 64)
+    {
+      offset |= words[1] << (64 - shift);
+    }
+    if (block.Width < 64)
+    {
+      offset &= (static_cast<std::uint64_t>(1) << block.Width) - 1;
+    }
+    return Bits::Decode(static_cast<UIntType>(block.Minimum + static_cast<UIntType>(offset)));
+  }
+
+  std::vector<Block> Blocks;
+  std::vector<std::uint64_t> Words;
+  vtkIdType NumberOfValues;
+};
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::vtkCompressedImplicitBackend(
+  const ValueType* values, vtkIdType numberOfValues)
+  : Internal(std::unique_ptr<Internals>(new Internals(values, numberOfValues)))
+{
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::vtkCompressedImplicitBackend(vtkDataArray* array)
+{
+  std::vector<ValueType> buffer;
+  vtkCompressedImplicitBackendDetail::FlattenDispatchWorker<ValueType> worker;
+  using Dispatcher = vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::AllArrays>;
+  if (!Dispatcher::Execute(array, worker, buffer))
+  {
+    worker(array, buffer);
+  }
+  this->Internal =
+    std::unique_ptr<Internals>(new Internals(buffer.data(), static_cast<vtkIdType>(buffer.size())));
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::~vtkCompressedImplicitBackend() = default;
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+ValueType vtkCompressedImplicitBackend<ValueType>::operator()(int idx) const
+{
+  return this->Internal->GetValue(idx);
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+unsigned long vtkCompressedImplicitBackend<ValueType>::getMemorySize() const
+{
+  std::size_t numberOfBytes =
+    this->Internal->Blocks.size() * sizeof(typename Internals::Block) +
+    this->Internal->Words.size() * sizeof(std::uint64_t);
+  return static_cast<unsigned long>(std::ceil(numberOfBytes / 1024.0));
+}
+
+VTK_ABI_NAMESPACE_END
@@ -79,6 +79,8 @@ vtkDataArray::vtkDataArray()
   this->Range[1] = 0;
   this->FiniteRange[0] = 0;
   this->FiniteRange[1] = 0;
+  this->IncrementalRangeMode = false;
+  this->RangeScannedTupleCount = -1;
 }
 
 //------------------------------------------------------------------------------
@@ -784,6 +786,53 @@ void vtkDataArray::ComputeFiniteRange(
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkDataArray::SetIncrementalRangeMode(bool mode)
+{
+  if (this->IncrementalRangeMode == mode)
+  {
+    return;
+  }
+  this->IncrementalRangeMode = mode;
+  // Toggling the mode discards the incremental bookkeeping so that a stale
+  // cache can never be merged with tuples modified while the mode was off.
+  this->RangeScannedTupleCount = -1;
+  this->CachedScalarRanges.clear();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkDataArray::ComputeIncrementalScalarRange(double* allCompRanges)
+{
+  const vtkIdType numTuples = this->GetNumberOfTuples();
+  const int numComps = this->NumberOfComponents;
+  if (this->RangeScannedTupleCount < 0 || this->RangeScannedTupleCount > numTuples ||
+    this->CachedScalarRanges.size() != static_cast<size_t>(2 * numComps))
+  {
+    return false;
+  }
+
+  std::copy(this->CachedScalarRanges.begin(), this->CachedScalarRanges.end(), allCompRanges);
+  if (this->RangeScannedTupleCount == numTuples)
+  {
+    // The MTime changed but nothing was appended: in append-only mode the
+    // cached range is still exact.
+    return true;
+  }
+
+  std::vector<double> window(2 * numComps);
+  if (!this->ComputeScalarRangeWindow(window.data(), this->RangeScannedTupleCount, numTuples))
+  {
+    return false;
+  }
+  for (int c = 0; c < numComps; ++c)
+  {
+    allCompRanges[2 * c] = std::min(allCompRanges[2 * c], window[2 * c]);
+    allCompRanges[2 * c + 1] = std::max(allCompRanges[2 * c + 1], window[2 * c + 1]);
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkDataArray::ComputeRange(double range[2], int comp)
 {
@@ -844,7 +893,14 @@ void vtkDataArray::ComputeRange(
     // hasValidKey will update range to the cached value if it exists.
     if (!hasValidKey(info, PER_COMPONENT(), rkey, range, comp))
     {
-      const bool computed = this->ComputeScalarRange(allCompRanges.data());
+      // In incremental mode try to extend the previous range with the
+      // appended tuples only; fall back to a full scan otherwise.
+      bool computed =
+        this->IncrementalRangeMode && this->ComputeIncrementalScalarRange(allCompRanges.data());
+      if (!computed)
+      {
+        computed = this->ComputeScalarRange(allCompRanges.data());
+      }
       if (computed)
       {
         // construct the keys and add them to the info object
@@ -858,6 +914,10 @@ void vtkDataArray::ComputeRange(
         }
         infoVec->FastDelete();
 
+        // remember what the incremental cache now covers
+        this->CachedScalarRanges.assign(allCompRanges.begin(), allCompRanges.end());
+        this->RangeScannedTupleCount = this->GetNumberOfTuples();
+
         // update the range passed in since we have a valid range.
         range[0] = allCompRanges[comp * 2];
         range[1] = allCompRanges[(comp * 2) + 1];
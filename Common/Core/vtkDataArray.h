@@ -28,6 +28,8 @@
 #include "vtkVTK_USE_SCALED_SOA_ARRAYS.h" // For #define of VTK_USE_SCALED_SOA_ARRAYS
 #include "vtkWrappingHints.h"             // For VTK_MARSHALMANUAL
 
+#include <vector> // For incremental range cache
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDoubleArray;
 class vtkIdList;
@@ -536,6 +538,21 @@ public:
    */
   int GetArrayType() const override { return DataArray; }
 
+  ///@{
+  /**
+   * When enabled, the cached per-component range is extended with the tuples
+   * appended since it was last computed -- e.g. through InsertNextTuple --
+   * instead of being recomputed from scratch once the array's MTime changes.
+   * The caller guarantees that existing tuples are never modified while this
+   * mode is active (append-only edits); after in-place modifications, toggle
+   * the mode off and on again to discard the incremental bookkeeping.
+   * Default is off.
+   */
+  void SetIncrementalRangeMode(bool mode);
+  vtkGetMacro(IncrementalRangeMode, bool);
+  vtkBooleanMacro(IncrementalRangeMode, bool);
+  ///@}
+
 protected:
   friend class vtkPoints;
   friend class vtkFieldData;
@@ -605,6 +622,15 @@ protected:
     double* ranges, const unsigned char* ghosts, unsigned char ghostsToSkip = 0xff);
   ///@}
 
+  /**
+   * Computes the range for each component of the half-open tuple window
+   * [beginTuple, endTuple) only; the length of \a ranges must be two times
+   * the number of components. Returns true if the range was computed, false
+   * if the window is empty or out of bounds. This is the building block of
+   * the incremental range cache, see SetIncrementalRangeMode.
+   */
+  bool ComputeScalarRangeWindow(double* ranges, vtkIdType beginTuple, vtkIdType endTuple);
+
   ///@{
   /**
    * Returns true if the range was computed. Will return false
@@ -661,6 +687,15 @@ protected:
     double range[2], const unsigned char* ghosts, unsigned char ghostsToSkip = 0xff);
   ///@}
 
+  /**
+   * Try to satisfy a stale per-component range request by scanning only the
+   * tuples appended since the last full computation and merging them into the
+   * cached range. Returns true and fills \a allCompRanges on success; returns
+   * false when no usable cached range exists, in which case the caller falls
+   * back to a full recomputation. Only used when IncrementalRangeMode is on.
+   */
+  bool ComputeIncrementalScalarRange(double* allCompRanges);
+
   // Construct object with default tuple dimension (number of components) of 1.
   vtkDataArray();
   ~vtkDataArray() override;
@@ -668,6 +703,12 @@ protected:
   vtkLookupTable* LookupTable;
   double Range[2];
   double FiniteRange[2];
+  bool IncrementalRangeMode;
+  // Number of tuples covered by CachedScalarRanges, -1 when the incremental
+  // cache has never been filled. Maintained by ComputeRange; unlike the
+  // information keys, these survive Modified() so appends can merge into them.
+  vtkIdType RangeScannedTupleCount;
+  std::vector<double> CachedScalarRanges;
 
 private:
   double* GetTupleN(vtkIdType i, int n);
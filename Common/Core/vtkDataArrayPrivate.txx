@@ -5,10 +5,12 @@
 
 #ifndef VTK_GDA_TEMPLATE_EXTERN
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkAssume.h"
 #include "vtkDataArray.h"
 #include "vtkDataArrayRange.h"
 #include "vtkMathUtilities.h"
+#include "vtkSIMDKernels.h"
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
 #include "vtkTypeTraits.h"
@@ -162,8 +164,25 @@ public:
   void Reduce() { MinAndMaxT::Reduce(); }
   void operator()(vtkIdType begin, vtkIdType end)
   {
-    const auto tuples = vtk::DataArrayTupleRange<NumComps>(this->Array, begin, end);
     auto& range = MinAndMaxT::TLRange.Local();
+    if (!this->Ghosts)
+    {
+      // Contiguous AOS storage: hand the scan to the vectorized kernels.
+      if (auto* aos = vtkAOSDataArrayTemplate<APIType>::FastDownCast(this->Array))
+      {
+        const APIType* values = aos->GetPointer(begin * NumComps);
+        if (NumComps == 1)
+        {
+          vtkSIMDKernels::MinMax(values, end - begin, range[0], range[1]);
+        }
+        else
+        {
+          vtkSIMDKernels::MinMaxStrided(values, end - begin, NumComps, range.data());
+        }
+        return;
+      }
+    }
+    const auto tuples = vtk::DataArrayTupleRange<NumComps>(this->Array, begin, end);
     const unsigned char* ghostIt = this->Ghosts ? this->Ghosts + begin : nullptr;
     for (const auto tuple : tuples)
     {
@@ -573,6 +592,35 @@ bool DoComputeScalarRange(ArrayT* array, RangeValueType* ranges, ValueType tag,
   }
 }
 
+//----------------------------------------------------------------------------
+// Compute the per-component range of the half-open tuple window
+// [beginTuple, endTuple) only. Used by the incremental range cache of
+// vtkDataArray to merge appended tuples into an existing range without
+// rescanning the whole array.
+template <class ArrayT, typename RangeValueType>
+bool DoComputeScalarRangeWindow(
+  ArrayT* array, RangeValueType* ranges, vtkIdType beginTuple, vtkIdType endTuple)
+{
+  const int numComp = array->GetNumberOfComponents();
+
+  // setup the initial ranges to be the max,min for double
+  for (int i = 0, j = 0; i < numComp; ++i, j += 2)
+  {
+    ranges[j] = vtkTypeTraits<RangeValueType>::Max();
+    ranges[j + 1] = vtkTypeTraits<RangeValueType>::Min();
+  }
+
+  if (beginTuple < 0 || endTuple <= beginTuple || endTuple > array->GetNumberOfTuples())
+  {
+    return false;
+  }
+
+  AllValuesGenericMinAndMax<ArrayT> minmax(array, nullptr, 0xff);
+  vtkSMPTools::For(beginTuple, endTuple, minmax);
+  minmax.CopyRanges(ranges);
+  return true;
+}
+
 //----------------------------------------------------------------------------
 // generic implementation that operates on ValueType.
 template <typename ArrayT, typename RangeValueType>
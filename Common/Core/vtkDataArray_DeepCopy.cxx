@@ -8,6 +8,7 @@
 #include "vtkDataArrayRange.h"
 #include "vtkGenericDataArray.h"
 #include "vtkLookupTable.h"
+#include "vtkPerformanceCounters.h"
 #include "vtkSMPTools.h"
 
 namespace
@@ -155,6 +156,8 @@ void vtkDataArray::DeepCopy(vtkDataArray* da)
         // If dispatch fails, use fallback:
         worker(da, this);
       }
+      vtkPerformanceCounters::Add(vtkPerformanceCounters::DEEP_COPY_BYTES,
+        static_cast<vtkTypeUInt64>(da->GetNumberOfValues()) * da->GetDataTypeSize());
     }
 
     this->SetLookupTable(nullptr);
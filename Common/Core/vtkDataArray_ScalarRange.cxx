@@ -33,6 +33,29 @@ struct ScalarRangeDispatchWrapper
   }
 };
 
+struct ScalarRangeWindowDispatchWrapper
+{
+  bool Success;
+  double* Range;
+  vtkIdType BeginTuple;
+  vtkIdType EndTuple;
+
+  ScalarRangeWindowDispatchWrapper(double* range, vtkIdType beginTuple, vtkIdType endTuple)
+    : Success(false)
+    , Range(range)
+    , BeginTuple(beginTuple)
+    , EndTuple(endTuple)
+  {
+  }
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    this->Success = vtkDataArrayPrivate::DoComputeScalarRangeWindow(
+      array, this->Range, this->BeginTuple, this->EndTuple);
+  }
+};
+
 } // end anon namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -53,4 +76,16 @@ bool vtkDataArray::ComputeScalarRange(
   }
   return worker.Success;
 }
+
+//------------------------------------------------------------------------------
+bool vtkDataArray::ComputeScalarRangeWindow(
+  double* ranges, vtkIdType beginTuple, vtkIdType endTuple)
+{
+  ScalarRangeWindowDispatchWrapper worker(ranges, beginTuple, endTuple);
+  if (!vtkArrayDispatch::Dispatch::Execute(this, worker))
+  {
+    worker(this);
+  }
+  return worker.Success;
+}
 VTK_ABI_NAMESPACE_END
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInformationIdTypeVectorKey.h"
+
+#include "vtkInformation.h" // For vtkErrorWithObjectMacro
+
+#include <algorithm>
+#include <vector>
+
+//------------------------------------------------------------------------------
+VTK_ABI_NAMESPACE_BEGIN
+vtkInformationIdTypeVectorKey ::vtkInformationIdTypeVectorKey(
+  const char* name, const char* location, int length)
+  : vtkInformationKey(name, location)
+  , RequiredLength(length)
+{
+  vtkCommonInformationKeyManager::Register(this);
+}
+
+//------------------------------------------------------------------------------
+vtkInformationIdTypeVectorKey::~vtkInformationIdTypeVectorKey() = default;
+
+//------------------------------------------------------------------------------
+void vtkInformationIdTypeVectorKey::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+
+//------------------------------------------------------------------------------
+class vtkInformationIdTypeVectorValue : public vtkObjectBase
+{
+public:
+  vtkBaseTypeMacro(vtkInformationIdTypeVectorValue, vtkObjectBase);
+  std::vector<vtkIdType> Value;
+};
+
+//------------------------------------------------------------------------------
+void vtkInformationIdTypeVectorKey::Append(vtkInformation* info, vtkIdType value)
+{
+  vtkInformationIdTypeVectorValue* v =
+    static_cast<vtkInformationIdTypeVectorValue*>(this->GetAsObjectBase(info));
+  if (v)
+  {
+    v->Value.push_back(value);
+  }
+  else
+  {
+    this->Set(info, &value, 1);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkInformationIdTypeVectorKey::Set(vtkInformation* info)
+{
+  vtkIdType someVal;
+  this->Set(info, &someVal, 0);
+}
+
+//------------------------------------------------------------------------------
+void vtkInformationIdTypeVectorKey::Set(vtkInformation* info, const vtkIdType* value, int length)
+{
+  if (value)
+  {
+    if (this->RequiredLength >= 0 && length != this->RequiredLength)
+    {
+      vtkErrorWithObjectMacro(info,
+        "Cannot store vtkIdType vector of length "
+          << length << " with key " << this->Location << "::" << this->Name
+          << " which requires a vector of length " << this->RequiredLength
+          << ".  Removing the key instead.");
+      this->SetAsObjectBase(info, nullptr);
+      return;
+    }
+
+    vtkInformationIdTypeVectorValue* oldv =
+      static_cast<vtkInformationIdTypeVectorValue*>(this->GetAsObjectBase(info));
+    if (oldv && static_cast<int>(oldv->Value.size()) == length)
+    {
+      // Replace the existing value.
+      std::copy(value, value + length, oldv->Value.begin());
+      // Since this sets a value without call SetAsObjectBase(),
+      // the info has to be modified here (instead of
+      // vtkInformation::SetAsObjectBase()
+      info->Modified(this);
+    }
+    else
+    {
+      // Allocate a new value.
+      vtkInformationIdTypeVectorValue* v = new vtkInformationIdTypeVectorValue;
+      v->InitializeObjectBase();
+      v->Value.insert(v->Value.begin(), value, value + length);
+      this->SetAsObjectBase(info, v);
+      v->Delete();
+    }
+  }
+  else
+  {
+    this->SetAsObjectBase(info, nullptr);
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType* vtkInformationIdTypeVectorKey::Get(vtkInformation* info)
+{
+  vtkInformationIdTypeVectorValue* v =
+    static_cast<vtkInformationIdTypeVectorValue*>(this->GetAsObjectBase(info));
+  return (v && !v->Value.empty()) ? v->Value.data() : nullptr;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkInformationIdTypeVectorKey::Get(vtkInformation* info, int idx)
+{
+  if (idx >= this->Length(info))
+  {
+    vtkErrorWithObjectMacro(info,
+      "Information does not contain " << idx << " elements. Cannot return information value.");
+    return 0;
+  }
+  vtkIdType* values = this->Get(info);
+  return values[idx];
+}
+
+//------------------------------------------------------------------------------
+void vtkInformationIdTypeVectorKey::Get(vtkInformation* info, vtkIdType* value)
+{
+  vtkInformationIdTypeVectorValue* v =
+    static_cast<vtkInformationIdTypeVectorValue*>(this->GetAsObjectBase(info));
+  if (v && value)
+  {
+    for (std::vector<vtkIdType>::size_type i = 0; i < v->Value.size(); ++i)
+    {
+      value[i] = v->Value[i];
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkInformationIdTypeVectorKey::Length(vtkInformation* info)
+{
+  vtkInformationIdTypeVectorValue* v =
+    static_cast<vtkInformationIdTypeVectorValue*>(this->GetAsObjectBase(info));
+  return v ? static_cast<int>(v->Value.size()) : 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkInformationIdTypeVectorKey::ShallowCopy(vtkInformation* from, vtkInformation* to)
+{
+  this->Set(to, this->Get(from), this->Length(from));
+}
+
+//------------------------------------------------------------------------------
+void vtkInformationIdTypeVectorKey::Print(ostream& os, vtkInformation* info)
+{
+  // Print the value.
+  if (this->Has(info))
+  {
+    vtkIdType* value = this->Get(info);
+    int length = this->Length(info);
+    const char* sep = "";
+    for (int i = 0; i < length; ++i)
+    {
+      os << sep << value[i];
+      sep = " ";
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType* vtkInformationIdTypeVectorKey::GetWatchAddress(vtkInformation* info)
+{
+  vtkInformationIdTypeVectorValue* v =
+    static_cast<vtkInformationIdTypeVectorValue*>(this->GetAsObjectBase(info));
+  return (v && !v->Value.empty()) ? v->Value.data() : nullptr;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkInformationIdTypeVectorKey
+ * @brief   Key for vtkIdType vector values.
+ *
+ * vtkInformationIdTypeVectorKey is used to represent keys for vtkIdType
+ * vector values in vtkInformation.h
+ */
+
+#ifndef vtkInformationIdTypeVectorKey_h
+#define vtkInformationIdTypeVectorKey_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkInformationKey.h"
+
+#include "vtkCommonInformationKeyManager.h" // Manage instances of this type.
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkInformationIdTypeVectorKey : public vtkInformationKey
+{
+public:
+  vtkTypeMacro(vtkInformationIdTypeVectorKey, vtkInformationKey);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  vtkInformationIdTypeVectorKey(const char* name, const char* location, int length = -1);
+  ~vtkInformationIdTypeVectorKey() override;
+
+  /**
+   * This method simply returns a new vtkInformationIdTypeVectorKey, given a
+   * name, a location and a required length. This method is provided for
+   * wrappers. Use the constructor directly from C++ instead.
+   */
+  static VTK_NEWINSTANCE vtkInformationIdTypeVectorKey* MakeKey(
+    const char* name, const char* location, int length = -1)
+  {
+    return new vtkInformationIdTypeVectorKey(name, location, length);
+  }
+
+  ///@{
+  /**
+   * Get/Set the value associated with this key in the given
+   * information object.
+   */
+  void Append(vtkInformation* info, vtkIdType value);
+  void Set(vtkInformation* info, const vtkIdType* value, int length);
+  void Set(vtkInformation* info);
+  vtkIdType* Get(vtkInformation* info);
+  vtkIdType Get(vtkInformation* info, int idx);
+  void Get(vtkInformation* info, vtkIdType* value);
+  int Length(vtkInformation* info);
+  ///@}
+
+  /**
+   * Copy the entry associated with this key from one information
+   * object to another.  If there is no entry in the first information
+   * object for this key, the value is removed from the second.
+   */
+  void ShallowCopy(vtkInformation* from, vtkInformation* to) override;
+
+  /**
+   * Print the key's value in an information object to a stream.
+   */
+  void Print(ostream& os, vtkInformation* info) override;
+
+protected:
+  // The required length of the vector value (-1 is no restriction).
+  int RequiredLength;
+
+  /**
+   * Get the address at which the actual value is stored.  This is
+   * meant for use from a debugger to add watches and is therefore not
+   * a public method.
+   */
+  vtkIdType* GetWatchAddress(vtkInformation* info);
+
+private:
+  vtkInformationIdTypeVectorKey(const vtkInformationIdTypeVectorKey&) = delete;
+  void operator=(const vtkInformationIdTypeVectorKey&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
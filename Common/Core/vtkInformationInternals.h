@@ -7,6 +7,15 @@
  * vtkInformationInternals is used in internal implementation of
  * vtkInformation. This should only be accessed by friends
  * and sub-classes of that class.
+ *
+ * Storage is a flat array of key/value pairs with a small inline buffer.
+ * Information objects rarely hold more than a handful of keys, so a
+ * linear scan over contiguous entries beats a hashed container while the
+ * inline buffer avoids any heap allocation for the common case. Pipeline
+ * executives create and destroy one of these per port per pass, which
+ * made the per-object bucket allocation of the previous hash map show up
+ * in profiles of many-block pipelines; a freelist recycles the objects
+ * themselves for the same reason.
  */
 
 #ifndef vtkInformationInternals_h
@@ -15,13 +24,9 @@
 #include "vtkInformationKey.h"
 #include "vtkObjectBase.h"
 
+#include <cstddef>
 #include <cstdint>
-#define VTK_INFORMATION_USE_HASH_MAP
-#ifdef VTK_INFORMATION_USE_HASH_MAP
-#include <unordered_map>
-#else
-#include <map>
-#endif
+#include <vector>
 
 //----------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -30,26 +35,94 @@ class vtkInformationInternals
 public:
   typedef vtkInformationKey* KeyType;
   typedef vtkObjectBase* DataType;
-#ifdef VTK_INFORMATION_USE_HASH_MAP
-  struct HashFun
+
+  class MapType
   {
-    size_t operator()(KeyType key) const
+  public:
+    struct value_type
+    {
+      value_type() = default;
+      value_type(KeyType key, DataType data)
+        : first(key)
+        , second(data)
+      {
+      }
+      KeyType first = nullptr;
+      DataType second = nullptr;
+    };
+    typedef value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    iterator begin() { return this->Data; }
+    iterator end() { return this->Data + this->Size; }
+    const_iterator begin() const { return this->Data; }
+    const_iterator end() const { return this->Data + this->Size; }
+
+    iterator find(KeyType key)
+    {
+      for (value_type* entry = this->Data; entry != this->Data + this->Size; ++entry)
+      {
+        if (entry->first == key)
+        {
+          return entry;
+        }
+      }
+      return this->end();
+    }
+
+    void insert(const value_type& entry)
+    {
+      if (this->Size == this->Capacity)
+      {
+        this->Grow();
+      }
+      this->Data[this->Size++] = entry;
+    }
+
+    // Order is not meaningful, so erasure moves the last entry into the
+    // freed slot.
+    void erase(iterator pos)
     {
-      return reinterpret_cast<uintptr_t>(key) / sizeof(vtkInformationKey);
+      *pos = this->Data[--this->Size];
     }
+
+    ~MapType()
+    {
+      if (this->Data != this->Inline)
+      {
+        delete[] this->Data;
+      }
+    }
+
+  private:
+    void Grow()
+    {
+      std::uint32_t newCapacity = this->Capacity * 2;
+      value_type* newData = new value_type[newCapacity];
+      for (std::uint32_t i = 0; i < this->Size; ++i)
+      {
+        newData[i] = this->Data[i];
+      }
+      if (this->Data != this->Inline)
+      {
+        delete[] this->Data;
+      }
+      this->Data = newData;
+      this->Capacity = newCapacity;
+    }
+
+    enum : std::uint32_t
+    {
+      InlineCapacity = 8
+    };
+
+    value_type Inline[InlineCapacity];
+    value_type* Data = Inline;
+    std::uint32_t Size = 0;
+    std::uint32_t Capacity = InlineCapacity;
   };
-  typedef std::unordered_map<KeyType, DataType, HashFun> MapType;
-#else
-  typedef std::map<KeyType, DataType> MapType;
-#endif
-  MapType Map;
 
-#ifdef VTK_INFORMATION_USE_HASH_MAP
-  vtkInformationInternals()
-    : Map(33)
-  {
-  }
-#endif
+  MapType Map;
 
   ~vtkInformationInternals()
   {
@@ -62,13 +135,74 @@ public:
     }
   }
 
-#ifdef VTK_INFORMATION_USE_HASH_MAP
+  // Recycle whole objects through a per-thread freelist: executives
+  // allocate one of these per port per pipeline pass.
+  static void* operator new(std::size_t size)
+  {
+    if (PoolType* pool = vtkInformationInternals::Pool())
+    {
+      std::vector<void*>& blocks = pool->Blocks;
+      if (!blocks.empty())
+      {
+        void* block = blocks.back();
+        blocks.pop_back();
+        return block;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  static void operator delete(void* block)
+  {
+    PoolType* pool = vtkInformationInternals::Pool();
+    if (pool && pool->Blocks.size() < 256)
+    {
+      pool->Blocks.push_back(block);
+    }
+    else
+    {
+      ::operator delete(block);
+    }
+  }
+
 private:
+  struct PoolType
+  {
+    std::vector<void*> Blocks;
+    bool* Alive;
+    PoolType(bool* alive)
+      : Alive(alive)
+    {
+      *alive = true;
+    }
+    ~PoolType()
+    {
+      *this->Alive = false;
+      for (void* block : this->Blocks)
+      {
+        ::operator delete(block);
+      }
+    }
+  };
+
+  // Main-thread thread_locals are destroyed before objects of static storage
+  // duration, and a static-duration destructor (a file-scope vtkSmartPointer
+  // in an application is enough) may still release a vtkInformation. The
+  // trivially destructible `alive` flag stays readable after the pool object
+  // is gone, so such late calls fall back to the global allocator instead of
+  // touching a destroyed vector.
+  static PoolType* Pool()
+  {
+    static thread_local bool alive = false;
+    static thread_local PoolType pool(&alive);
+    return alive ? &pool : nullptr;
+  }
+
   vtkInformationInternals(vtkInformationInternals const&) = delete;
-#endif
-};
 
-#undef VTK_INFORMATION_USE_HASH_MAP
+public:
+  vtkInformationInternals() = default;
+};
 
 VTK_ABI_NAMESPACE_END
 #endif
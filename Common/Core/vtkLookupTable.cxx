@@ -7,6 +7,7 @@
 #include "vtkMath.h"
 #include "vtkMathConfigure.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkVariantArray.h"
 
@@ -1055,6 +1056,35 @@ void vtkLookupTableMapData(vtkLookupTable* self, T* input, unsigned char* output
   }   // alpha blending
 }
 
+//------------------------------------------------------------------------------
+// Parallel dispatch over tuple blocks. Every value is mapped independently of
+// the others, so the input is split into blocks and each block is processed
+// by the serial kernel above, with a per-block copy of the table parameters.
+template <class T>
+void vtkLookupTableMapDataInParallel(vtkLookupTable* self, T* input, unsigned char* output,
+  int length, int inIncr, int outFormat, const TableParameters& p)
+{
+  int outIncr = 4;
+  if (outFormat == VTK_RGB)
+  {
+    outIncr = 3;
+  }
+  else if (outFormat == VTK_LUMINANCE_ALPHA)
+  {
+    outIncr = 2;
+  }
+  else if (outFormat == VTK_LUMINANCE)
+  {
+    outIncr = 1;
+  }
+
+  vtkSMPTools::For(0, length, [&](vtkIdType begin, vtkIdType end) {
+    TableParameters params = p;
+    vtkLookupTableMapData(self, input + begin * inIncr, output + begin * outIncr,
+      static_cast<int>(end - begin), inIncr, outFormat, params);
+  });
+}
+
 //------------------------------------------------------------------------------
 template <class T>
 void vtkLookupTableIndexedMapData(vtkLookupTable* self, const T* input, unsigned char* output,
@@ -1240,14 +1270,14 @@ void vtkLookupTable::MapScalarsThroughTable2(void* input, unsigned char* output,
         {
           newInput->SetValue(i, bitArray->GetValue(id));
         }
-        vtkLookupTableMapData(
+        vtkLookupTableMapDataInParallel(
           this, newInput->GetPointer(0), output, numberOfValues, inputIncrement, outputFormat, p);
         newInput->Delete();
         bitArray->Delete();
       }
       break;
 
-        vtkTemplateMacro(vtkLookupTableMapData(this, static_cast<VTK_TT*>(input), output,
+        vtkTemplateMacro(vtkLookupTableMapDataInParallel(this, static_cast<VTK_TT*>(input), output,
           numberOfValues, inputIncrement, outputFormat, p));
       default:
         vtkErrorMacro(<< "MapScalarsThroughTable2: Unknown input ScalarType");
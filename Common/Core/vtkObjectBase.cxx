@@ -302,7 +302,11 @@ void vtkObjectBase::RegisterInternal(vtkObjectBase*, vtkTypeBool check)
   // count.
   if (!(check && vtkObjectBaseToGarbageCollectorFriendship::TakeReference(this)))
   {
-    this->ReferenceCount++;
+    // Taking a new reference never needs to synchronize with other memory
+    // operations, so a relaxed increment is sufficient (same discipline as
+    // std::shared_ptr). This avoids a full barrier on every Register call,
+    // which is measurable when many threads share non-GC objects.
+    this->ReferenceCount.fetch_add(1, std::memory_order_relaxed);
   }
 }
 
@@ -318,7 +322,11 @@ void vtkObjectBase::UnRegisterInternal(vtkObjectBase*, vtkTypeBool check)
   }
 
   // Decrement the reference count, delete object if count goes to zero.
-  if (--this->ReferenceCount <= 0)
+  // Release ordering publishes this thread's writes to whichever thread
+  // performs the final decrement; the acquire half makes them visible to the
+  // destructor below. This matches std::shared_ptr's control-block discipline
+  // and is cheaper than the default sequentially-consistent decrement.
+  if (this->ReferenceCount.fetch_sub(1, std::memory_order_acq_rel) <= 1)
   {
     // Let subclasses know the object is on its way out.
     this->ObjectFinalize();
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkObjectFactory.h"
 
+#include "vtkAutoInit.h"
 #include "vtkDebugLeaks.h"
 #include "vtkDynamicLoader.h"
 #include "vtkObjectFactoryCollection.h"
@@ -12,11 +13,55 @@
 #include "vtksys/Directory.hxx"
 
 #include <cctype>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkObjectFactoryCollection* vtkObjectFactory::RegisteredFactories = nullptr;
 static unsigned int vtkObjectFactoryRegistryCleanupCounter = 0;
 
+namespace
+{
+// Module factory registration functions handed over by VTK_MODULE_AUTOINIT
+// during static initialization. They are executed on the first Init() so
+// that applications do not pay for every linked module's factory
+// construction at startup. Function-local static so the queue is usable at
+// any point of static initialization.
+std::vector<void (*)()>& vtkDeferredFactoryRegistrations()
+{
+  static std::vector<void (*)()> functions;
+  return functions;
+}
+bool vtkDeferredFactoryRegistrationsDone = false;
+}
+
+void vtkAutoInitDeferConstruct(void (*construct)())
+{
+  if (vtkDeferredFactoryRegistrationsDone)
+  {
+    // The registry is already in use; a module loaded after the first
+    // lookup (e.g. a plugin) must register right away.
+    (*construct)();
+  }
+  else
+  {
+    vtkDeferredFactoryRegistrations().push_back(construct);
+  }
+}
+
+void vtkAutoInitFlushDeferredConstructs()
+{
+  // Swap the queue out first: a construct that registers a factory triggers
+  // vtkObjectFactory::Init(), which calls back into this function and must
+  // find it empty.
+  vtkDeferredFactoryRegistrationsDone = true;
+  std::vector<void (*)()> constructs;
+  constructs.swap(vtkDeferredFactoryRegistrations());
+  for (void (*construct)() : constructs)
+  {
+    (*construct)();
+  }
+}
+
 vtkObjectFactoryRegistryCleanup::vtkObjectFactoryRegistryCleanup()
 {
   ++vtkObjectFactoryRegistryCleanupCounter;
@@ -67,6 +112,11 @@ void vtkObjectFactory::Init()
   vtkObjectFactory::RegisteredFactories = vtkObjectFactoryCollection::New();
   vtkObjectFactory::RegisterDefaults();
   vtkObjectFactory::LoadDynamicFactories();
+
+  // Execute the module factory registrations deferred by VTK_MODULE_AUTOINIT,
+  // after the VTK_AUTOLOAD_PATH factories so that externally loaded factories
+  // keep their precedence over the built-in ones.
+  vtkAutoInitFlushDeferredConstructs();
 }
 
 // Register any factories that are always present in VTK like
@@ -0,0 +1,208 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * @file vtkParallelAlgorithms.h
+ * Parallel sort, unique and binary-search-join primitives operating in
+ * place on raw buffers and on vtkAOSDataArrayTemplate storage.
+ *
+ * Filters that need sorted-unique id lists (point merging, selection
+ * extraction, ghost generation) traditionally copy array contents into
+ * temporary std::vectors and call std::sort. The helpers in this header
+ * avoid the copy: they sort the array's own buffer, using a stable
+ * byte-wise radix sort for large integer buffers and vtkSMPTools::Sort
+ * otherwise, and provide the companion unique and sorted-join steps those
+ * filters need.
+ */
+
+#ifndef vtkParallelAlgorithms_h
+#define vtkParallelAlgorithms_h
+
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace vtk
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+//------------------------------------------------------------------------------
+// Stable LSD byte-wise radix sort with a single scratch buffer. Signed
+// types are handled by biasing the most significant byte. Passes in which
+// every value shares the same byte are skipped; id lists commonly leave
+// the upper bytes untouched, so most passes cost one histogram read only.
+template <typename ValueT>
+void RadixSort(ValueT* begin, ValueT* end)
+{
+  using UValueT = typename std::make_unsigned<ValueT>::type;
+  const vtkIdType n = static_cast<vtkIdType>(end - begin);
+  std::vector<ValueT> scratch(static_cast<size_t>(n));
+  ValueT* src = begin;
+  ValueT* dst = scratch.data();
+
+  const int numPasses = static_cast<int>(sizeof(ValueT));
+  for (int pass = 0; pass < numPasses; ++pass)
+  {
+    const int shift = 8 * pass;
+    const unsigned int bias = (std::is_signed<ValueT>::value && pass == numPasses - 1) ? 0x80u : 0u;
+
+    vtkIdType count[256] = {};
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      ++count[((static_cast<UValueT>(src[i]) >> shift) & 0xffu) ^ bias];
+    }
+
+    bool uniformByte = false;
+    for (int b = 0; b < 256; ++b)
+    {
+      if (count[b] == n)
+      {
+        uniformByte = true;
+        break;
+      }
+    }
+    if (uniformByte)
+    {
+      continue;
+    }
+
+    vtkIdType offset = 0;
+    for (int b = 0; b < 256; ++b)
+    {
+      vtkIdType c = count[b];
+      count[b] = offset;
+      offset += c;
+    }
+
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      dst[count[((static_cast<UValueT>(src[i]) >> shift) & 0xffu) ^ bias]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+
+  if (src != begin)
+  {
+    std::copy(src, src + n, begin);
+  }
+}
+
+// Below this size, the comparison sort wins over paying for the radix
+// scratch buffer and histogram passes.
+enum : vtkIdType
+{
+  RADIX_SORT_THRESHOLD = 4096
+};
+
+//------------------------------------------------------------------------------
+template <typename ValueT>
+typename std::enable_if<std::is_integral<ValueT>::value>::type SortBuffer(
+  ValueT* begin, ValueT* end)
+{
+  if (end - begin >= RADIX_SORT_THRESHOLD)
+  {
+    RadixSort(begin, end);
+  }
+  else
+  {
+    vtkSMPTools::Sort(begin, end);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueT>
+typename std::enable_if<!std::is_integral<ValueT>::value>::type SortBuffer(
+  ValueT* begin, ValueT* end)
+{
+  vtkSMPTools::Sort(begin, end);
+}
+
+} // namespace detail
+
+//------------------------------------------------------------------------------
+/**
+ * Sort the values in [begin, end) in place. Large integer buffers are
+ * sorted with a stable byte-wise radix sort; everything else goes through
+ * vtkSMPTools::Sort.
+ */
+template <typename ValueT>
+void ParallelSort(ValueT* begin, ValueT* end)
+{
+  detail::SortBuffer(begin, end);
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Sort the values of an array-of-structs data array in place, without
+ * copying them out to a temporary container.
+ */
+template <typename ValueT>
+void ParallelSort(vtkAOSDataArrayTemplate<ValueT>* array)
+{
+  ValueT* begin = array->GetPointer(0);
+  ParallelSort(begin, begin + array->GetNumberOfValues());
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Sort the values in [begin, end) in place and move the unique values to
+ * the front of the range. Returns the number of unique values kept.
+ */
+template <typename ValueT>
+vtkIdType ParallelSortUnique(ValueT* begin, ValueT* end)
+{
+  ParallelSort(begin, end);
+  return static_cast<vtkIdType>(std::unique(begin, end) - begin);
+}
+
+//------------------------------------------------------------------------------
+/**
+ * Sort the values of an array-of-structs data array in place and drop
+ * duplicates. The array is truncated to the unique values (its allocation
+ * is kept; call Squeeze() to release it). Returns the new value count.
+ */
+template <typename ValueT>
+vtkIdType ParallelSortUnique(vtkAOSDataArrayTemplate<ValueT>* array)
+{
+  ValueT* begin = array->GetPointer(0);
+  vtkIdType newSize = ParallelSortUnique(begin, begin + array->GetNumberOfValues());
+  array->SetNumberOfValues(newSize);
+  return newSize;
+}
+
+//------------------------------------------------------------------------------
+/**
+ * For each value in [queriesBegin, queriesEnd), binary search the sorted
+ * range [sortedBegin, sortedEnd) and write the index of the first matching
+ * value — or -1 when the value is absent — to outIndices. Queries are
+ * processed in parallel, providing the join step of sorted-id algorithms
+ * without building hash tables.
+ */
+template <typename ValueT>
+void ParallelBinarySearchJoin(const ValueT* sortedBegin, const ValueT* sortedEnd,
+  const ValueT* queriesBegin, const ValueT* queriesEnd, vtkIdType* outIndices)
+{
+  const vtkIdType numQueries = static_cast<vtkIdType>(queriesEnd - queriesBegin);
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const ValueT* it = std::lower_bound(sortedBegin, sortedEnd, queriesBegin[i]);
+      outIndices[i] = (it != sortedEnd && !(queriesBegin[i] < *it))
+        ? static_cast<vtkIdType>(it - sortedBegin)
+        : -1;
+    }
+  });
+}
+
+VTK_ABI_NAMESPACE_END
+} // namespace vtk
+
+#endif // vtkParallelAlgorithms_h
+
+// VTK-HeaderTest-Exclude: vtkParallelAlgorithms.h
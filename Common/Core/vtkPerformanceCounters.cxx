@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPerformanceCounters.h"
+
+#include "vtkLogger.h"
+#include "vtkObjectFactory.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkPerformanceCounters);
+
+std::atomic<vtkTypeUInt64>
+  vtkPerformanceCounters::Counters[vtkPerformanceCounters::NUMBER_OF_COUNTERS] = {};
+std::atomic<bool> vtkPerformanceCounters::Enabled{ true };
+
+//------------------------------------------------------------------------------
+void vtkPerformanceCounters::SetEnabled(bool enabled)
+{
+  vtkPerformanceCounters::Enabled.store(enabled, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+bool vtkPerformanceCounters::GetEnabled()
+{
+  return vtkPerformanceCounters::Enabled.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+vtkTypeUInt64 vtkPerformanceCounters::Get(Counter counter)
+{
+  return vtkPerformanceCounters::Counters[counter].load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkPerformanceCounters::Reset()
+{
+  for (int i = 0; i < NUMBER_OF_COUNTERS; ++i)
+  {
+    vtkPerformanceCounters::Counters[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+//------------------------------------------------------------------------------
+const char* vtkPerformanceCounters::GetCounterName(Counter counter)
+{
+  switch (counter)
+  {
+    case DEEP_COPY_BYTES:
+      return "DeepCopyBytes";
+    case LOCATOR_BUILDS:
+      return "LocatorBuilds";
+    case VBO_UPLOAD_BYTES:
+      return "VBOUploadBytes";
+    case MPI_TRANSFER_BYTES:
+      return "MPITransferBytes";
+    case EXECUTIVE_PASSES:
+      return "ExecutivePasses";
+    default:
+      return "Unknown";
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPerformanceCounters::Log()
+{
+  for (int i = 0; i < NUMBER_OF_COUNTERS; ++i)
+  {
+    Counter counter = static_cast<Counter>(i);
+    vtkLogF(INFO, "%s: %llu", vtkPerformanceCounters::GetCounterName(counter),
+      static_cast<unsigned long long>(vtkPerformanceCounters::Get(counter)));
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkPerformanceCounters::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << (vtkPerformanceCounters::GetEnabled() ? "On" : "Off") << "\n";
+  for (int i = 0; i < NUMBER_OF_COUNTERS; ++i)
+  {
+    Counter counter = static_cast<Counter>(i);
+    os << indent << vtkPerformanceCounters::GetCounterName(counter) << ": "
+       << vtkPerformanceCounters::Get(counter) << "\n";
+  }
+}
+VTK_ABI_NAMESPACE_END
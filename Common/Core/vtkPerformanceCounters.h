@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPerformanceCounters
+ * @brief   Lightweight process-wide counters for hot-path activity.
+ *
+ * vtkPerformanceCounters keeps a small, fixed set of atomic counters that
+ * hot paths across the library bump as they run: bytes moved by data array
+ * deep copies, locator (re)builds, bytes uploaded to OpenGL buffer
+ * objects, bytes sent or received over MPI, and requests forwarded by
+ * executives. They answer the question "what is this pipeline actually
+ * doing" in a running process without a debugger or a profiler: dump them
+ * with Log() at any point, diff two dumps around a slow phase, and the
+ * dominating activity stands out.
+ *
+ * Counting is on by default: one bump is a relaxed atomic add, which is
+ * negligible next to the work each instrumented path performs. When even
+ * that is unwanted, SetEnabled(false) reduces every bump to a single
+ * relaxed flag test. All methods are static and thread safe.
+ *
+ * Log() writes the counters through vtkLogger at INFO verbosity, so the
+ * output follows the log routing the application configured.
+ *
+ * @sa
+ * vtkLogger vtkExecutionProfiler
+ */
+
+#ifndef vtkPerformanceCounters_h
+#define vtkPerformanceCounters_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <atomic> // For the counter storage
+
+VTK_ABI_NAMESPACE_BEGIN
+
+class VTKCOMMONCORE_EXPORT vtkPerformanceCounters : public vtkObject
+{
+public:
+  static vtkPerformanceCounters* New();
+  vtkTypeMacro(vtkPerformanceCounters, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * The available counters. Byte counters accumulate the amount of data
+   * moved; the others count occurrences.
+   */
+  enum Counter
+  {
+    DEEP_COPY_BYTES = 0,
+    LOCATOR_BUILDS,
+    VBO_UPLOAD_BYTES,
+    MPI_TRANSFER_BYTES,
+    EXECUTIVE_PASSES,
+    NUMBER_OF_COUNTERS
+  };
+
+  ///@{
+  /**
+   * Turn counting on or off. On by default; while off, every bump is a
+   * single relaxed flag test. Accumulated values are kept until Reset().
+   */
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled();
+  ///@}
+
+  /**
+   * Add amount to the given counter. Instrumented hot paths call this;
+   * it is safe from any thread.
+   */
+  static void Add(Counter counter, vtkTypeUInt64 amount);
+
+  /**
+   * Current value of the given counter.
+   */
+  static vtkTypeUInt64 Get(Counter counter);
+
+  /**
+   * Set all counters back to zero.
+   */
+  static void Reset();
+
+  /**
+   * The display name of a counter, e.g. "DeepCopyBytes".
+   */
+  static const char* GetCounterName(Counter counter);
+
+  /**
+   * Write all counters through vtkLogger at INFO verbosity.
+   */
+  static void Log();
+
+protected:
+  vtkPerformanceCounters() = default;
+  ~vtkPerformanceCounters() override = default;
+
+private:
+  vtkPerformanceCounters(const vtkPerformanceCounters&) = delete;
+  void operator=(const vtkPerformanceCounters&) = delete;
+
+  static std::atomic<vtkTypeUInt64> Counters[NUMBER_OF_COUNTERS];
+  static std::atomic<bool> Enabled;
+};
+
+//------------------------------------------------------------------------------
+inline void vtkPerformanceCounters::Add(Counter counter, vtkTypeUInt64 amount)
+{
+  if (vtkPerformanceCounters::Enabled.load(std::memory_order_relaxed))
+  {
+    vtkPerformanceCounters::Counters[counter].fetch_add(amount, std::memory_order_relaxed);
+  }
+}
+
+VTK_ABI_NAMESPACE_END
+#endif
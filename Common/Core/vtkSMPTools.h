@@ -532,6 +532,37 @@ public:
     SMPToolsAPI.LocalScope<vtkSMPTools::Config>(config, lambda);
   }
 
+  /**
+   * Run a functor under a thread budget borrowed from the global arbiter and return the
+   * borrowed threads when the scope ends.
+   *
+   * When several parallel regions are active at once -- typically a composite pipeline
+   * iterating blocks while each leaf filter calls vtkSMPTools::For internally -- each
+   * region that naively uses all hardware threads oversubscribes the machine. Wrapping the
+   * inner work in a ThreadBudgetScope makes concurrent scopes share a single process-wide
+   * budget: each scope is granted its fair share of the remaining threads (at least one)
+   * and lends them back on exit.
+   *
+   * Unlike LocalScope, this method is thread safe: the cap is carried in thread-local
+   * state consulted by the backend on each call rather than by mutating the global
+   * configuration, so it only applies to vtkSMPTools calls issued from the thread that
+   * opened the scope.
+   *
+   * Usage example:
+   * \code
+   * vtkSMPTools::ThreadBudgetScope(
+   *   requestedThreads, [&]() { vtkSMPTools::For(0, size, worker); });
+   * \endcode
+   *
+   * Pass 0 as requestedThreads to ask for all threads not currently lent to another scope.
+   */
+  template <typename T>
+  static void ThreadBudgetScope(int requestedThreads, T&& lambda)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    SMPToolsAPI.ThreadBudgetScope(requestedThreads, lambda);
+  }
+
   /**
    * A convenience method for transforming data. It is a drop in replacement for
    * std::transform(), it does a unary operation on the input ranges. The data array must have the
@@ -14,6 +14,7 @@
 
 #include "vtkArrayIteratorTemplate.h"
 #include "vtkBuffer.h"
+#include "vtkSMPTools.h"
 
 #include <array>
 #include <cassert>
@@ -457,14 +458,25 @@ void vtkSOADataArrayTemplate<ValueType>::ExportToVoidPointer(void* voidPtr)
 
   if (this->StorageType == StorageTypeEnum::SOA)
   {
+    // Blocked, parallel transpose: each chunk of tuples reads every
+    // component buffer sequentially and scatters into a cache-resident
+    // slice of the output, instead of touching all buffers one tuple at a
+    // time. The strided inner store is a shuffle the compiler can
+    // vectorize.
     ValueType* ptr = static_cast<ValueType*>(voidPtr);
-    for (vtkIdType t = 0; t < numTuples; ++t)
-    {
-      for (int c = 0; c < this->NumberOfComponents; ++c)
+    const int numComps = this->NumberOfComponents;
+    vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+      for (int c = 0; c < numComps; ++c)
       {
-        *ptr++ = this->Data[c]->GetBuffer()[t];
+        const ValueType* src = this->Data[c]->GetBuffer() + begin;
+        ValueType* dst = ptr + begin * numComps + c;
+        for (vtkIdType t = begin; t < end; ++t)
+        {
+          *dst = *src++;
+          dst += numComps;
+        }
       }
-    }
+    });
   }
   else
   {
@@ -523,14 +535,39 @@ void vtkSOADataArrayTemplate<ValueType>::CopyData(vtkSOADataArrayTemplate<ValueT
 
     std::copy(srcBegin, srcEnd, dstBegin);
   }
+  else if (this->StorageType == StorageTypeEnum::AOS && src->StorageType == StorageTypeEnum::SOA)
+  { // gather transpose: sequential reads per component buffer, blocked
+    // strided writes into the interleaved destination
+    ValueType* dstBuffer = this->AoSData->GetBuffer();
+    vtkSMPTools::For(0, numberOfTuples, [&](vtkIdType begin, vtkIdType end) {
+      for (int comp = 0; comp < numberOfComponents; ++comp)
+      {
+        const ValueType* srcPtr = src->GetComponentArrayPointer(comp) + begin;
+        ValueType* dstPtr = dstBuffer + begin * numberOfComponents + comp;
+        for (vtkIdType t = begin; t < end; ++t)
+        {
+          *dstPtr = *srcPtr++;
+          dstPtr += numberOfComponents;
+        }
+      }
+    });
+  }
   else
-  { // mismatching storage types so we'll copy data through the API
-    std::vector<ValueType> tuple(numberOfComponents);
-    for (vtkIdType i = 0; i < numberOfTuples; i++)
-    {
-      src->GetTypedTuple(i, tuple.data());
-      this->SetTypedTuple(i, tuple.data());
-    }
+  { // scatter transpose: blocked strided reads from the interleaved source,
+    // sequential writes per component buffer
+    const ValueType* srcBuffer = src->AoSData->GetBuffer();
+    vtkSMPTools::For(0, numberOfTuples, [&](vtkIdType begin, vtkIdType end) {
+      for (int comp = 0; comp < numberOfComponents; ++comp)
+      {
+        const ValueType* srcPtr = srcBuffer + begin * numberOfComponents + comp;
+        ValueType* dstPtr = this->GetComponentArrayPointer(comp) + begin;
+        for (vtkIdType t = begin; t < end; ++t)
+        {
+          *dstPtr++ = *srcPtr;
+          srcPtr += numberOfComponents;
+        }
+      }
+    });
   }
 }
 
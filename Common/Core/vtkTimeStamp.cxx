@@ -42,6 +42,17 @@ void vtkTimeStamp::Modified()
 #else
   static std::atomic<uint32_t> GlobalTimeStamp(0U);
 #endif
-  this->ModifiedTime = (vtkMTimeType)++GlobalTimeStamp;
+  // Relaxed ordering suffices here: callers only require that every call
+  // hands out a distinct, monotonically-allocated value. Any happens-before
+  // relationship between the modification and a later MTime comparison is
+  // established by the surrounding synchronization (locks, thread joins),
+  // not by this counter. Dropping the full barrier removes a contention
+  // hotspot when many threads modify objects concurrently.
+  //
+  // Per-thread epoch blocks were considered and rejected: handing each
+  // thread a pre-reserved range of stamps breaks the global ordering that
+  // pipeline MTime comparisons across threads rely on.
+  this->ModifiedTime =
+    (vtkMTimeType)(GlobalTimeStamp.fetch_add(1, std::memory_order_relaxed) + 1);
 }
 VTK_ABI_NAMESPACE_END
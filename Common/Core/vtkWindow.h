@@ -191,6 +191,31 @@ public:
   }
   ///@}
 
+  ///@{
+  /**
+   * Pipelined variant of GetPixelData for continuous capture. Submit
+   * queues a readback of the given rectangle and returns without waiting
+   * for the rendering backend to produce the pixels; Retrieve fills \c
+   * data from the oldest readback queued for the same rectangle, waiting
+   * only when that readback has not finished yet. Submitting each frame
+   * and retrieving right after overlaps the readback of one frame with
+   * the rendering of the next, at the price of the retrieved pixels
+   * being one frame old. Backends without asynchronous readback perform
+   * a plain synchronous read in Retrieve, so callers need no fallback of
+   * their own.
+   */
+  virtual int SubmitPixelDataReadback(
+    int /*x*/, int /*y*/, int /*x2*/, int /*y2*/, int /*front*/, int /*right*/ = 0)
+  {
+    return VTK_OK;
+  }
+  virtual int RetrievePixelDataReadback(
+    int x, int y, int x2, int y2, int front, vtkUnsignedCharArray* data, int right = 0)
+  {
+    return this->GetPixelData(x, y, x2, y2, front, data, right);
+  }
+  ///@}
+
   ///@{
   /**
    * Return a best estimate to the dots per inch of the display
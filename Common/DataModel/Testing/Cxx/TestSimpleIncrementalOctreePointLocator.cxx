@@ -1,5 +1,6 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
+#include "vtkIdList.h"
 #include "vtkIncrementalOctreeNode.h"
 #include "vtkIncrementalOctreePointLocator.h"
 #include "vtkNew.h"
@@ -69,5 +70,39 @@ int TestSimpleIncrementalOctreePointLocator(int, char** const)
   double* p = points->GetPoint(id);
   std::cout << "Point: " << p[0] << ", " << p[1] << ", " << p[2] << std::endl;
 
+  // bulk insertion should assign the same indices as per-point insertion,
+  // with duplicates mapped to the index of their first occurrence
+  vtkNew<vtkPoints> batch;
+  batch->SetDataTypeToDouble();
+  for (auto point : pointsInput)
+  {
+    batch->InsertNextPoint(point.data());
+    batch->InsertNextPoint(point.data()); // exact duplicate
+  }
+  vtkNew<vtkPoints> bulkPoints;
+  bulkPoints->SetDataTypeToDouble();
+  vtkNew<vtkIncrementalOctreePointLocator> bulkOctree;
+  bulkOctree->SetMaxPointsPerLeaf(16);
+  bulkOctree->InitPointInsertion(bulkPoints, bb.data());
+  vtkNew<vtkIdList> pntIds;
+  vtkIdType numInserted = bulkOctree->InsertUniquePoints(batch, pntIds);
+  if (static_cast<size_t>(numInserted) != pointsInput.size() ||
+    static_cast<size_t>(bulkPoints->GetNumberOfPoints()) != pointsInput.size())
+  {
+    std::cerr << "Bulk insertion inserted " << numInserted << " of "
+              << bulkPoints->GetNumberOfPoints() << " points, expected: " << pointsInput.size()
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < batch->GetNumberOfPoints(); ++i)
+  {
+    if (pntIds->GetId(i) != i / 2)
+    {
+      std::cerr << "Bulk insertion mapped point " << i << " to " << pntIds->GetId(i)
+                << " expected: " << (i / 2) << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
@@ -360,6 +360,80 @@ void RemoveHalfOfColumns(vtkTable* table, std::vector<std::vector<double>>& stdT
   CheckEqual(table, stdTable, "RemoveHalfColumns");
 }
 
+void TestColumnSpansAndRowViews()
+{
+  // Exercise the zero-allocation column spans and lazy row views against
+  // the classic variant-based accessors.
+  vtkNew<vtkTable> table;
+
+  vtkNew<vtkDoubleArray> doubles;
+  doubles->SetName("doubles");
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("ints");
+  vtkNew<vtkStringArray> strings;
+  strings->SetName("strings");
+  for (int i = 0; i < 10; ++i)
+  {
+    doubles->InsertNextValue(i * 1.5);
+    ints->InsertNextValue(i * 2);
+    strings->InsertNextValue("row");
+  }
+  table->AddColumn(doubles);
+  table->AddColumn(ints);
+  table->AddColumn(strings);
+
+  double* dBegin = nullptr;
+  double* dEnd = nullptr;
+  if (!table->GetColumnSpan(0, dBegin, dEnd) || dEnd - dBegin != 10)
+  {
+    cout << "GetColumnSpan() failed on a double column" << endl;
+    exit(EXIT_FAILURE);
+  }
+  for (int i = 0; i < 10; ++i)
+  {
+    if (dBegin[i] != table->GetValue(i, 0).ToDouble())
+    {
+      cout << "GetColumnSpan() returned wrong values" << endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  // Requesting the wrong value type or a non-data-array column must fail.
+  if (table->GetColumnSpan(1, dBegin, dEnd) || dBegin || dEnd)
+  {
+    cout << "GetColumnSpan() accepted a column of the wrong type" << endl;
+    exit(EXIT_FAILURE);
+  }
+  if (table->GetColumnSpan(2, dBegin, dEnd))
+  {
+    cout << "GetColumnSpan() accepted a string column" << endl;
+    exit(EXIT_FAILURE);
+  }
+
+  for (vtkIdType row = 0; row < table->GetNumberOfRows(); ++row)
+  {
+    vtkTable::RowView view = table->GetRowView(row);
+    if (view.GetRow() != row || view.GetNumberOfValues() != table->GetNumberOfColumns())
+    {
+      cout << "GetRowView() returned a malformed view" << endl;
+      exit(EXIT_FAILURE);
+    }
+    for (vtkIdType col = 0; col < table->GetNumberOfColumns(); ++col)
+    {
+      if (view.GetValue(col) != table->GetValue(row, col))
+      {
+        cout << "RowView::GetValue() disagrees with vtkTable::GetValue()" << endl;
+        exit(EXIT_FAILURE);
+      }
+    }
+    if (view.GetDouble(0) != doubles->GetValue(row) || view.GetDouble(1) != ints->GetValue(row))
+    {
+      cout << "RowView::GetDouble() disagrees with the column arrays" << endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
 int TestTable(int, char*[])
 {
   cout << "CTEST_FULL_OUTPUT" << endl;
@@ -411,5 +485,7 @@ int TestTable(int, char*[])
   // insert a column with an ImplicitArray, i.e. a read-only array.
   InsertImplicitArray(table, stdTable);
 
+  TestColumnSpansAndRowViews();
+
   return EXIT_SUCCESS;
 }
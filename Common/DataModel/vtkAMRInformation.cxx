@@ -7,9 +7,12 @@
 #include "vtkIntArray.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnsignedIntArray.h"
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <set>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -322,6 +325,10 @@ void vtkAMRInformation::SetAMRBox(unsigned int level, unsigned int id, const vtk
   {
     this->UpdateBounds(level, id);
   }
+  if (level < this->GridIndex.size())
+  {
+    this->GridIndex[level].Built = false;
+  }
 }
 
 int vtkAMRInformation::GetAMRBlockSourceIndex(int index)
@@ -725,32 +732,46 @@ void vtkAMRInformation::CalculateParentChildRelationShip(unsigned int level,
   // WriteBins(origin, spacing, extents, binsize, nbins, binner);
 
   // Actually find parent-children relationship
-  // between blocks in level and level-1
+  // between blocks in level and level-1. Every child block's parent search
+  // only reads the bins and the boxes and fills its own parent list, so the
+  // searches run in parallel; the children lists are then built serially by
+  // inverting the parent lists, which is linear in the number of relations.
   children.resize(this->GetNumberOfDataSets(level - 1));
   parents.resize(this->GetNumberOfDataSets(level));
 
   unsigned int numDataSets = this->GetNumberOfDataSets(level);
-  for (unsigned int i = 0; i < numDataSets; i++)
-  {
-    const vtkAMRBox& box = this->GetAMRBox(level, i);
-    if (!box.IsInvalid())
+  vtkSMPTools::For(0, numDataSets,
+    [this, level, refinementRatio, &binner, &parents](vtkIdType begin, vtkIdType end)
     {
-      std::set<unsigned int> boxes;
-      binner.GetBoxesInIntersectingBins(box, boxes);
-      std::set<unsigned int>::iterator iter;
-      for (iter = boxes.begin(); iter != boxes.end(); ++iter)
+      for (vtkIdType id = begin; id < end; id++)
       {
-        vtkAMRBox potentialParent = this->GetAMRBox(level - 1, *iter);
-        if (!potentialParent.IsInvalid())
+        unsigned int i = static_cast<unsigned int>(id);
+        const vtkAMRBox& box = this->GetAMRBox(level, i);
+        if (!box.IsInvalid())
         {
-          potentialParent.Refine(refinementRatio);
-          if (box.DoesIntersect(potentialParent))
+          std::set<unsigned int> boxes;
+          binner.GetBoxesInIntersectingBins(box, boxes);
+          std::set<unsigned int>::iterator iter;
+          for (iter = boxes.begin(); iter != boxes.end(); ++iter)
           {
-            children[*iter].push_back(i);
-            parents[i].push_back(*iter);
+            vtkAMRBox potentialParent = this->GetAMRBox(level - 1, *iter);
+            if (!potentialParent.IsInvalid())
+            {
+              potentialParent.Refine(refinementRatio);
+              if (box.DoesIntersect(potentialParent))
+              {
+                parents[i].push_back(*iter);
+              }
+            }
           }
         }
       }
+    });
+  for (unsigned int i = 0; i < numDataSets; i++)
+  {
+    for (unsigned int parent : parents[i])
+    {
+      children[parent].push_back(i);
     }
   }
 }
@@ -965,7 +986,52 @@ bool vtkAMRInformation::FindGrid(double q[3], unsigned int& level, unsigned int&
 
 bool vtkAMRInformation::FindGrid(double q[3], int level, unsigned int& gridId)
 {
-  for (unsigned int i = 0; i < this->GetNumberOfDataSets(level); i++)
+  unsigned int numDataSets = this->GetNumberOfDataSets(level);
+
+  // Past a handful of boxes, locate the point through the rasterized level
+  // index instead of scanning every box.
+  if (numDataSets > 8)
+  {
+    if (static_cast<size_t>(level) >= this->GridIndex.size() || !this->GridIndex[level].Built)
+    {
+      this->BuildGridIndex(level);
+    }
+    const GridIndexLevel& index = this->GridIndex[level];
+    if (index.Bins.empty())
+    {
+      return false;
+    }
+
+    double h[3];
+    this->GetSpacing(level, h);
+    unsigned int bin[3];
+    for (int d = 0; d < 3; d++)
+    {
+      int ijk = index.LoExtent[d];
+      if (h[d] > 0)
+      {
+        ijk = static_cast<int>(std::floor((q[d] - this->Origin[d]) / h[d]));
+      }
+      // Clamp so boundary points land in an edge bin; the exact bounds test
+      // below decides containment.
+      ijk = std::min(std::max(ijk, index.LoExtent[d]), index.HiExtent[d]);
+      bin[d] = static_cast<unsigned int>(ijk - index.LoExtent[d]) / index.BinSize[d];
+    }
+    size_t binIdx = bin[2] + bin[1] * index.NBins[2] + bin[0] * index.NBins[2] * index.NBins[1];
+    for (unsigned int boxId : index.Bins[binIdx])
+    {
+      double gbounds[6];
+      this->GetBounds(level, boxId, gbounds);
+      if (Inside(q, gbounds))
+      {
+        gridId = boxId;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  for (unsigned int i = 0; i < numDataSets; i++)
   {
     double gbounds[6];
     this->GetBounds(level, i, gbounds);
@@ -978,4 +1044,96 @@ bool vtkAMRInformation::FindGrid(double q[3], int level, unsigned int& gridId)
   }
   return false;
 }
+
+void vtkAMRInformation::BuildGridIndex(unsigned int level)
+{
+  if (this->GridIndex.size() < this->GetNumberOfLevels())
+  {
+    this->GridIndex.resize(this->GetNumberOfLevels());
+  }
+  GridIndexLevel& index = this->GridIndex[level];
+  index.Built = true;
+  index.Bins.clear();
+
+  // 1. Find the bounds of all boxes at this level
+  // 2. Find the average block size, which sets the bin size
+  int extents[6] = { VTK_INT_MAX, -VTK_INT_MAX, VTK_INT_MAX, -VTK_INT_MAX, VTK_INT_MAX,
+    -VTK_INT_MAX };
+  float totalsize[3] = { 0, 0, 0 };
+  unsigned int numDataSets = this->GetNumberOfDataSets(level);
+  unsigned int numValid = 0;
+  for (unsigned int id = 0; id < numDataSets; id++)
+  {
+    const vtkAMRBox& box = this->GetAMRBox(level, id);
+    if (!box.IsInvalid())
+    {
+      const int* loCorner = box.GetLoCorner();
+      int hiCorner[3];
+      box.GetValidHiCorner(hiCorner);
+      for (int i = 0; i < 3; i++)
+      {
+        if (loCorner[i] < extents[2 * i])
+        {
+          extents[2 * i] = loCorner[i];
+        }
+        if (hiCorner[i] > extents[2 * i + 1])
+        {
+          extents[2 * i + 1] = hiCorner[i];
+        }
+        totalsize[i] += (hiCorner[i] - loCorner[i] + 1);
+      }
+      numValid++;
+    }
+  }
+  if (numValid == 0)
+  {
+    return;
+  }
+
+  size_t totalNumBins = 1;
+  for (int i = 0; i < 3; i++)
+  {
+    index.LoExtent[i] = extents[2 * i];
+    index.HiExtent[i] = extents[2 * i + 1];
+    index.BinSize[i] =
+      std::max(1u, static_cast<unsigned int>(std::round(totalsize[i] / numValid)));
+    index.NBins[i] = (extents[2 * i + 1] - extents[2 * i]) / index.BinSize[i] + 1;
+    totalNumBins *= index.NBins[i];
+  }
+  index.Bins.resize(totalNumBins);
+
+  // Bin the boxes; each box lands in every bin its extent intersects, so a
+  // bin holds all candidates for the points it covers.
+  for (unsigned int id = 0; id < numDataSets; id++)
+  {
+    const vtkAMRBox& box = this->GetAMRBox(level, id);
+    if (box.IsInvalid())
+    {
+      continue;
+    }
+    const int* loCorner = box.GetLoCorner();
+    int hiCorner[3];
+    box.GetValidHiCorner(hiCorner);
+
+    unsigned int minbin[3];
+    unsigned int maxbin[3];
+    for (int j = 0; j < 3; j++)
+    {
+      minbin[j] = static_cast<unsigned int>(loCorner[j] - extents[2 * j]) / index.BinSize[j];
+      maxbin[j] = static_cast<unsigned int>(hiCorner[j] - extents[2 * j]) / index.BinSize[j];
+    }
+    unsigned int idx[3];
+    for (idx[0] = minbin[0]; idx[0] <= maxbin[0]; idx[0]++)
+    {
+      for (idx[1] = minbin[1]; idx[1] <= maxbin[1]; idx[1]++)
+      {
+        for (idx[2] = minbin[2]; idx[2] <= maxbin[2]; idx[2]++)
+        {
+          index.Bins[idx[2] + idx[1] * index.NBins[2] + idx[0] * index.NBins[2] * index.NBins[1]]
+            .push_back(id);
+        }
+      }
+    }
+  }
+}
 VTK_ABI_NAMESPACE_END
@@ -249,6 +249,7 @@ private:
   void UpdateBounds(int level, int id);
   void AllocateBoxes(unsigned int n);
   void GenerateBlockLevel();
+  void BuildGridIndex(unsigned int level);
   void CalculateParentChildRelationShip(unsigned int level,
     std::vector<std::vector<unsigned int>>& children,
     std::vector<std::vector<unsigned int>>& parents);
@@ -277,6 +278,20 @@ private:
   // parent child information
   std::vector<std::vector<std::vector<unsigned int>>> AllChildren;
   std::vector<std::vector<std::vector<unsigned int>>> AllParents;
+
+  // Rasterized per-level point-location index used by FindGrid: box ids
+  // binned on a uniform grid in AMR box index coordinates, built lazily
+  // and invalidated when a box is set.
+  struct GridIndexLevel
+  {
+    bool Built = false;
+    int LoExtent[3] = { 0, 0, 0 };
+    int HiExtent[3] = { 0, 0, 0 };
+    unsigned int BinSize[3] = { 1, 1, 1 };
+    unsigned int NBins[3] = { 0, 0, 0 };
+    std::vector<std::vector<unsigned int>> Bins;
+  };
+  std::vector<GridIndexLevel> GridIndex;
 };
 
 VTK_ABI_NAMESPACE_END
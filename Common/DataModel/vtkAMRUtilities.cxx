@@ -9,6 +9,7 @@
 #include "vtkFieldData.h"
 #include "vtkOverlappingAMR.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredData.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -367,72 +368,78 @@ void vtkAMRUtilities::BlankGridsAtLevel(vtkOverlappingAMR* amr, int levelIdx,
   std::vector<std::vector<unsigned int>>& children, const std::vector<int>& processMap)
 {
   unsigned int numDataSets = amr->GetNumberOfDataSets(levelIdx);
-  int N;
 
-  for (unsigned int dataSetIdx = 0; dataSetIdx < numDataSets; dataSetIdx++)
-  {
-    const vtkAMRBox& box = amr->GetAMRBox(levelIdx, dataSetIdx);
-    vtkUniformGrid* grid = amr->GetDataSet(levelIdx, dataSetIdx);
-    if (grid == nullptr)
-    {
-      continue;
-    }
-    N = grid->GetNumberOfCells();
-
-    vtkUnsignedCharArray* ghosts = vtkUnsignedCharArray::New();
-    ghosts->SetNumberOfTuples(N);
-    ghosts->FillComponent(0, 0);
-    ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
-
-    if (children.size() > dataSetIdx)
+  // Each block reads only the shared AMR metadata and writes the ghost
+  // array of its own grid, so the blocks are blanked in parallel.
+  vtkSMPTools::For(0, numDataSets,
+    [amr, levelIdx, &children, &processMap](vtkIdType begin, vtkIdType end)
     {
-      std::vector<unsigned int>& dsChildren = children[dataSetIdx];
-      std::vector<unsigned int>::iterator iter;
-
-      // For each higher res box fill in the cells that
-      // it covers
-      for (iter = dsChildren.begin(); iter != dsChildren.end(); ++iter)
+      for (vtkIdType blockId = begin; blockId < end; blockId++)
       {
-        vtkAMRBox ibox;
-        int childGridIndex = amr->GetCompositeIndex(levelIdx + 1, *iter);
-        if (processMap[childGridIndex] < 0)
+        unsigned int dataSetIdx = static_cast<unsigned int>(blockId);
+        const vtkAMRBox& box = amr->GetAMRBox(levelIdx, dataSetIdx);
+        vtkUniformGrid* grid = amr->GetDataSet(levelIdx, dataSetIdx);
+        if (grid == nullptr)
         {
           continue;
         }
-        if (amr->GetAMRInfo()->GetCoarsenedAMRBox(levelIdx + 1, *iter, ibox))
+        int N = grid->GetNumberOfCells();
+
+        vtkUnsignedCharArray* ghosts = vtkUnsignedCharArray::New();
+        ghosts->SetNumberOfTuples(N);
+        ghosts->FillComponent(0, 0);
+        ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+
+        if (children.size() > dataSetIdx)
         {
-          bool shouldBeTrue = ibox.Intersect(box);
-          assert(shouldBeTrue); // if the boxes don't intersect, there is a bug
-          (void)shouldBeTrue;   // to avoid warning in release
-          const int* loCorner = ibox.GetLoCorner();
-          int hi[3];
-          ibox.GetValidHiCorner(hi);
-          for (int iz = loCorner[2]; iz <= hi[2]; iz++)
+          std::vector<unsigned int>& dsChildren = children[dataSetIdx];
+          std::vector<unsigned int>::iterator iter;
+
+          // For each higher res box fill in the cells that
+          // it covers
+          for (iter = dsChildren.begin(); iter != dsChildren.end(); ++iter)
           {
-            for (int iy = loCorner[1]; iy <= hi[1]; iy++)
+            vtkAMRBox ibox;
+            int childGridIndex = amr->GetCompositeIndex(levelIdx + 1, *iter);
+            if (processMap[childGridIndex] < 0)
             {
-              for (int ix = loCorner[0]; ix <= hi[0]; ix++)
+              continue;
+            }
+            if (amr->GetAMRInfo()->GetCoarsenedAMRBox(levelIdx + 1, *iter, ibox))
+            {
+              bool shouldBeTrue = ibox.Intersect(box);
+              assert(shouldBeTrue); // if the boxes don't intersect, there is a bug
+              (void)shouldBeTrue;   // to avoid warning in release
+              const int* loCorner = ibox.GetLoCorner();
+              int hi[3];
+              ibox.GetValidHiCorner(hi);
+              for (int iz = loCorner[2]; iz <= hi[2]; iz++)
               {
-                vtkIdType id =
-                  vtkAMRBox::GetCellLinearIndex(box, ix, iy, iz, grid->GetDimensions());
-                ghosts->SetValue(id, ghosts->GetValue(id) | vtkDataSetAttributes::REFINEDCELL);
-              } // END for x
-            }   // END for y
-          }     // END for z
+                for (int iy = loCorner[1]; iy <= hi[1]; iy++)
+                {
+                  for (int ix = loCorner[0]; ix <= hi[0]; ix++)
+                  {
+                    vtkIdType id =
+                      vtkAMRBox::GetCellLinearIndex(box, ix, iy, iz, grid->GetDimensions());
+                    ghosts->SetValue(id, ghosts->GetValue(id) | vtkDataSetAttributes::REFINEDCELL);
+                  } // END for x
+                }   // END for y
+              }     // END for z
+            }
+          } // Processing all higher boxes for a specific coarse grid
         }
-      } // Processing all higher boxes for a specific coarse grid
-    }
 
-    if (grid->GetCellData()->HasArray(vtkDataSetAttributes::GhostArrayName()))
-    {
-      MergeGhostArrays(
-        grid->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()), ghosts);
-    }
+        if (grid->GetCellData()->HasArray(vtkDataSetAttributes::GhostArrayName()))
+        {
+          MergeGhostArrays(
+            grid->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()), ghosts);
+        }
 
-    grid->GetCellData()->AddArray(ghosts);
+        grid->GetCellData()->AddArray(ghosts);
 
-    ghosts->Delete();
-  }
+        ghosts->Delete();
+      }
+    });
 }
 
 //------------------------------------------------------------------------------
@@ -13,7 +13,9 @@
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkUnstructuredGrid.h"
 
 //------------------------------------------------------------------------------
@@ -258,6 +260,97 @@ vtkIdType vtkAbstractCellLocator::FindCell(
   return returnVal;
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::IntersectWithLines(
+  vtkPoints* startPoints, vtkPoints* endPoints, double tol, vtkIdList* cellIds, vtkPoints* hitPoints)
+{
+  if (!startPoints || !endPoints || !cellIds)
+  {
+    return;
+  }
+  const vtkIdType numSegments = startPoints->GetNumberOfPoints();
+  if (endPoints->GetNumberOfPoints() != numSegments)
+  {
+    vtkErrorMacro("startPoints and endPoints must have the same number of points.");
+    return;
+  }
+  cellIds->SetNumberOfIds(numSegments);
+  if (hitPoints)
+  {
+    hitPoints->SetNumberOfPoints(numSegments);
+  }
+  if (numSegments == 0)
+  {
+    return;
+  }
+
+  vtkSMPThreadLocal<vtkSmartPointer<vtkGenericCell>> tlCell;
+  vtkSMPTools::For(0, numSegments,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      auto& cell = tlCell.Local();
+      if (!cell)
+      {
+        cell = vtkSmartPointer<vtkGenericCell>::New();
+      }
+      double p1[3], p2[3], pcoords[3], t;
+      double x[3] = { 0.0, 0.0, 0.0 };
+      int subId;
+      vtkIdType cellId;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        startPoints->GetPoint(i, p1);
+        endPoints->GetPoint(i, p2);
+        if (!this->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId, cellId, cell))
+        {
+          cellId = -1;
+        }
+        cellIds->SetId(i, cellId);
+        if (hitPoints)
+        {
+          hitPoints->SetPoint(i, x);
+        }
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindCells(vtkPoints* points, double tol2, vtkIdList* cellIds)
+{
+  if (!points || !cellIds)
+  {
+    return;
+  }
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  cellIds->SetNumberOfIds(numPts);
+  if (numPts == 0)
+  {
+    return;
+  }
+
+  const int maxCellSize = this->DataSet ? this->DataSet->GetMaxCellSize() : 0;
+  vtkSMPThreadLocal<vtkSmartPointer<vtkGenericCell>> tlCell;
+  vtkSMPThreadLocal<std::vector<double>> tlWeights;
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      auto& cell = tlCell.Local();
+      if (!cell)
+      {
+        cell = vtkSmartPointer<vtkGenericCell>::New();
+      }
+      auto& weights = tlWeights.Local();
+      weights.resize(static_cast<size_t>(maxCellSize));
+      double x[3], pcoords[3];
+      int subId;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        points->GetPoint(i, x);
+        cellIds->SetId(i, this->FindCell(x, tol2, cell, subId, pcoords, weights.data()));
+      }
+    });
+}
+
 //------------------------------------------------------------------------------
 bool vtkAbstractCellLocator::InsideCellBounds(double x[3], vtkIdType cell_ID)
 {
@@ -158,6 +158,21 @@ public:
   virtual int IntersectWithLine(const double p1[3], const double p2[3], double tol,
     vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell);
 
+  /**
+   * Intersect a batch of finite line segments with the cells of the data
+   * set, returning the first hit of each segment. Segment i runs from
+   * startPoints point i to endPoints point i (the two arrays must be the
+   * same size). On output, cellIds holds one entry per segment: the id of
+   * the first cell hit, or -1 for a miss; when hitPoints is non-null it
+   * receives the corresponding intersection coordinates (undefined for
+   * misses). The batch is processed with vtkSMPTools using thread-local
+   * working cells, amortizing per-ray dispatch for ray-casting style
+   * workloads. This function should be used ONLY after the locator is
+   * built.
+   */
+  virtual void IntersectWithLines(vtkPoints* startPoints, vtkPoints* endPoints, double tol,
+    vtkIdList* cellIds, vtkPoints* hitPoints = nullptr);
+
   /**
    * Return the closest point and the cell which is closest to the point x.
    * The closest point is somewhere on a cell, it need not be one of the
@@ -287,6 +302,18 @@ public:
     double pcoords[3], double* weights);
   ///@}
 
+  /**
+   * Find the cells containing a batch of query points. On output, cellIds
+   * holds one entry per query point: the id of the cell containing the
+   * point, or -1 if no cell was found. The search is threaded with
+   * vtkSMPTools using thread-local working cells, so per-sample virtual
+   * dispatch and traversal setup are amortized over the batch; chunking also
+   * keeps nearby samples on the same thread, which preserves traversal
+   * coherence for typical probe / resample inputs. This function should be
+   * used ONLY after the locator is built.
+   */
+  virtual void FindCells(vtkPoints* points, double tol2, vtkIdList* cellIds);
+
   /**
    * Quickly test if a point is inside the bounds of a particular cell.
    * Some locators cache cell bounds and this function can make use
@@ -94,6 +94,20 @@ struct BaseArrayPair
   virtual void AssignNullValue(unsigned short outId) = 0;
 
   virtual void Realloc(vtkIdType sze) = 0;
+
+  // Batched variant of InterpolateEdge: process a run of edge interpolation
+  // records in a single virtual call per array, so the typed inner loop can
+  // stay in cache and vectorize. When outIds is nullptr the records write to
+  // consecutive output ids starting at firstOutId. Subclasses override this
+  // with a type-specific loop; the default falls back to per-record calls.
+  virtual void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0Ids,
+    const vtkIdType* v1Ids, const double* t, const vtkIdType* outIds, vtkIdType firstOutId)
+  {
+    for (vtkIdType i = 0; i < numEdges; ++i)
+    {
+      this->InterpolateEdge(v0Ids[i], v1Ids[i], t[i], outIds ? outIds[i] : firstOutId + i);
+    }
+  }
 };
 
 // Type specific interpolation on a matched pair of data arrays
@@ -201,6 +215,30 @@ protected:
     }
   }
 
+public:
+  // Batched edge interpolation: one virtual call for the whole run keeps the
+  // typed inner loops hot and lets them vectorize.
+  void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0Ids, const vtkIdType* v1Ids,
+    const double* t, const vtkIdType* outIds, vtkIdType firstOutId) override
+  {
+    const int numComp = this->NumComp;
+    const T* in = this->Input;
+    T* out = this->Output;
+    for (vtkIdType i = 0; i < numEdges; ++i)
+    {
+      const T* x0 = in + v0Ids[i] * numComp;
+      const T* x1 = in + v1Ids[i] * numComp;
+      T* y = out + (outIds ? outIds[i] : firstOutId + i) * numComp;
+      const double tt = t[i];
+      for (int j = 0; j < numComp; ++j)
+      {
+        y[j] = static_cast<T>(x0[j] + tt * (x1[j] - x0[j]));
+      }
+    }
+  }
+
+protected:
+
 public:
   void Copy(vtkIdType inId, vtkIdType outId) override { this->Copy<vtkIdType>(inId, outId); }
   void Interpolate(
@@ -581,6 +619,26 @@ protected:
   }
 
 public:
+  // Batched edge interpolation; see ArrayPair::InterpolateEdges().
+  void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0Ids, const vtkIdType* v1Ids,
+    const double* t, const vtkIdType* outIds, vtkIdType firstOutId) override
+  {
+    const int numComp = this->NumComp;
+    const TInput* in = this->Input;
+    TOutput* out = this->Output;
+    for (vtkIdType i = 0; i < numEdges; ++i)
+    {
+      const TInput* x0 = in + v0Ids[i] * numComp;
+      const TInput* x1 = in + v1Ids[i] * numComp;
+      TOutput* y = out + (outIds ? outIds[i] : firstOutId + i) * numComp;
+      const double tt = t[i];
+      for (int j = 0; j < numComp; ++j)
+      {
+        y[j] = static_cast<TOutput>(x0[j] + tt * (x1[j] - x0[j]));
+      }
+    }
+  }
+
   void Copy(vtkIdType inId, vtkIdType outId) override { this->Copy<vtkIdType>(inId, outId); }
   void Interpolate(
     int numWeights, const vtkIdType* ids, const double* weights, vtkIdType outId) override
@@ -826,6 +884,18 @@ public:
   {
     this->InterpolateEdge<vtkIdType>(v0, v1, t, outId);
   }
+  /**
+   * Loop over the arrays and interpolate a batch of edges in one pass per
+   * array. When outIds is nullptr, edge i is written to (firstOutId + i).
+   */
+  void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0Ids, const vtkIdType* v1Ids,
+    const double* t, const vtkIdType* outIds = nullptr, vtkIdType firstOutId = 0)
+  {
+    for (auto& array : this->Arrays)
+    {
+      array->InterpolateEdges(numEdges, v0Ids, v1Ids, t, outIds, firstOutId);
+    }
+  }
   /**
    * Loop over the arrays and assign the null value.
    */
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellAccessor.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellTypes.h"
+#include "vtkDataSet.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+bool vtkCellAccessor::Initialize(vtkDataSet* ds)
+{
+  this->DataSet = ds;
+  this->Connectivity = nullptr;
+  this->Types = nullptr;
+  this->Points = nullptr;
+
+  if (!ds)
+  {
+    return false;
+  }
+
+  if (auto* ugrid = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    this->Connectivity = ugrid->GetCells();
+    this->Types = ugrid->GetCellTypesArray();
+    this->Points = ugrid->GetPoints();
+    return true;
+  }
+
+  if (auto* polyData = vtkPolyData::SafeDownCast(ds))
+  {
+    // Perform the lazy build here so the const queries below never race on
+    // it. The generic path is used for queries since vtkPolyData's cell map
+    // is internal, but vtkPolyData::GetCell() is read-only once cells exist.
+    polyData->BuildCells();
+    return true;
+  }
+
+  // Other data set types (structured data, etc.) construct internal helper
+  // structures lazily on the first cell query; trigger that here.
+  if (ds->GetNumberOfCells() > 0)
+  {
+    vtkNew<vtkGenericCell> cell;
+    ds->GetCell(0, cell);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int vtkCellAccessor::GetCellType(vtkIdType cellId) const
+{
+  if (this->Types)
+  {
+    return static_cast<int>(this->Types->GetValue(cellId));
+  }
+  return this->DataSet->GetCellType(cellId);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkCellAccessor::GetCellSize(vtkIdType cellId) const
+{
+  if (this->Connectivity)
+  {
+    return this->Connectivity->GetCellSize(cellId);
+  }
+  return this->DataSet->GetCellSize(cellId);
+}
+
+//------------------------------------------------------------------------------
+void vtkCellAccessor::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds) const
+{
+  if (this->Connectivity)
+  {
+    this->Connectivity->GetCellAtId(cellId, ptIds);
+    return;
+  }
+  this->DataSet->GetCellPoints(cellId, ptIds);
+}
+
+//------------------------------------------------------------------------------
+void vtkCellAccessor::GetCell(vtkIdType cellId, vtkGenericCell* cell) const
+{
+  if (this->Connectivity)
+  {
+    const int cellType = static_cast<int>(this->Types->GetValue(cellId));
+    // Linear cells are assembled directly from the captured arrays.
+    // Polyhedra and higher-order cells need the face stream or rational
+    // weights, so they go through the (read-only) data set path.
+    if (cellType != VTK_POLYHEDRON && vtkCellTypes::IsLinear(static_cast<unsigned char>(cellType)))
+    {
+      cell->SetCellType(cellType);
+      this->Connectivity->GetCellAtId(cellId, cell->PointIds);
+      this->Points->GetPoints(cell->PointIds, cell->Points);
+      if (cell->RequiresInitialization())
+      {
+        cell->Initialize();
+      }
+      return;
+    }
+  }
+  this->DataSet->GetCell(cellId, cell);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCellAccessor
+ * @brief   Thread-safe, read-only cell access for use in vtkSMPTools workers
+ *
+ * vtkCellAccessor provides const access to the cells of a vtkDataSet without
+ * mutating shared state. The cell access methods on the data sets themselves
+ * may perform lazy builds on first use (e.g., vtkPolyData::BuildCells()), so
+ * concurrent workers must either serialize or remember to warm the data set
+ * up before dispatching. The accessor performs all lazy builds once, in
+ * Initialize(), and captures direct pointers to the connectivity, cell types,
+ * and points, so that subsequent queries are const, lock-free, and avoid
+ * virtual dispatch on the hot path. It is very light weight and is not
+ * derived from vtkObject, so workers can keep one on the stack or in a
+ * vtkSMPThreadLocal.
+ *
+ * Typical use from an SMP functor: Initialize() the accessor on the
+ * dispatching thread, then call the const query methods from any number of
+ * worker threads, handing each worker its own vtkGenericCell.
+ *
+ * @sa
+ * vtkGenericCell vtkSMPTools vtkCellArray
+ */
+
+#ifndef vtkCellAccessor_h
+#define vtkCellAccessor_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkCellArray;
+class vtkDataSet;
+class vtkGenericCell;
+class vtkIdList;
+class vtkPoints;
+class vtkUnsignedCharArray;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkCellAccessor
+{
+public:
+  /**
+   * Construct an accessor that is not attached to any data set. Initialize()
+   * must be called before any of the query methods.
+   */
+  vtkCellAccessor() = default;
+
+  /**
+   * Attach the accessor to a data set. This performs the lazy builds that
+   * make the subsequent const queries safe, and captures fast paths for
+   * vtkUnstructuredGrid. It is NOT thread safe and must be called from a
+   * single thread before workers are dispatched. Returns false if ds is
+   * null. The accessor does not hold a reference; the data set must outlive
+   * it.
+   */
+  bool Initialize(vtkDataSet* ds);
+
+  /**
+   * Return the type of the cell (e.g., VTK_TRIANGLE). Thread safe.
+   */
+  int GetCellType(vtkIdType cellId) const;
+
+  /**
+   * Return the number of points defining the cell. Thread safe.
+   */
+  vtkIdType GetCellSize(vtkIdType cellId) const;
+
+  /**
+   * Copy the point ids defining the cell into the provided list. Thread safe
+   * as long as each worker passes its own list.
+   */
+  void GetCellPoints(vtkIdType cellId, vtkIdList* ptIds) const;
+
+  /**
+   * Load the specified cell into the provided generic cell. Thread safe as
+   * long as each worker passes its own cell (e.g., from a
+   * vtkSMPThreadLocal).
+   */
+  void GetCell(vtkIdType cellId, vtkGenericCell* cell) const;
+
+protected:
+  vtkDataSet* DataSet = nullptr;
+  // Fast path; non-null only when the data set is a vtkUnstructuredGrid.
+  vtkCellArray* Connectivity = nullptr;
+  vtkUnsignedCharArray* Types = nullptr;
+  vtkPoints* Points = nullptr;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkCellAccessor.h
@@ -907,11 +907,16 @@ struct GenerateOffsetsImpl
   template <typename ArrayT>
   void operator()(ArrayT* offsets)
   {
-    for (vtkIdType cc = 0, max = (offsets->GetNumberOfTuples() - 1); cc < max; ++cc)
-    {
-      offsets->SetTypedComponent(cc, 0, cc * this->CellSize);
-    }
-    offsets->SetTypedComponent(offsets->GetNumberOfTuples() - 1, 0, this->ConnectivityArraySize);
+    const vtkIdType numOffsets = offsets->GetNumberOfTuples();
+    vtkSMPTools::For(0, numOffsets - 1,
+      [this, offsets](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType cc = begin; cc < end; ++cc)
+        {
+          offsets->SetTypedComponent(cc, 0, cc * this->CellSize);
+        }
+      });
+    offsets->SetTypedComponent(numOffsets - 1, 0, this->ConnectivityArraySize);
   }
 };
 
@@ -1240,6 +1245,21 @@ bool vtkCellArray::IsValid()
 //------------------------------------------------------------------------------
 vtkIdType vtkCellArray::IsHomogeneous()
 {
-  return this->Visit(IsHomogeneousImpl{});
+  // The scan is O(numCells), and mappers and traversal setup may ask
+  // repeatedly; cache the answer keyed on the offsets array. A new offsets
+  // array always carries a newer MTime than the cached one, so the pair
+  // (identity, MTime) is a sufficient key.
+  vtkDataArray* offsets = this->GetOffsetsArray();
+  const vtkMTimeType offsetsTime = offsets->GetMTime();
+  if (offsets == this->HomogeneousCheckedArray && offsetsTime == this->HomogeneousCheckTime)
+  {
+    return this->CachedHomogeneousCellSize;
+  }
+
+  const vtkIdType cellSize = this->Visit(IsHomogeneousImpl{});
+  this->HomogeneousCheckedArray = offsets;
+  this->HomogeneousCheckTime = offsetsTime;
+  this->CachedHomogeneousCellSize = cellSize;
+  return cellSize;
 }
 VTK_ABI_NAMESPACE_END
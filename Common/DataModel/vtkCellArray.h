@@ -1334,6 +1334,13 @@ protected:
   Storage Storage;
   vtkIdType TraversalCellId{ 0 };
 
+  // Cached result of IsHomogeneous(), keyed on the identity and modification
+  // time of the offsets array so storage conversions and appends invalidate
+  // it. Never dereferenced; only compared for identity.
+  vtkDataArray* HomogeneousCheckedArray{ nullptr };
+  vtkMTimeType HomogeneousCheckTime{ 0 };
+  vtkIdType CachedHomogeneousCellSize{ -1 };
+
   vtkNew<vtkIdTypeArray> LegacyData; // For GetData().
 
   static bool DefaultStorageIs64Bit;
@@ -8,6 +8,7 @@
 #include "vtkGenericCell.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkPerformanceCounters.h"
 #include "vtkPolyData.h"
 
 #include <array>
@@ -728,6 +729,8 @@ void vtkCellLocator::BuildLocatorInternal()
   int prod, numOctants;
   double hTol[3];
 
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::LOCATOR_BUILDS, 1);
+
   vtkDebugMacro(<< "Subdividing octree...");
 
   if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1)
@@ -6,21 +6,28 @@
 #include "vtkCellGrid.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSetRange.h"
+#include "vtkDataObjectTreeIterator.h"
 #include "vtkDataSet.h"
 #include "vtkInformation.h"
 #include "vtkInformationIntegerKey.h"
 #include "vtkInformationStringKey.h"
 #include "vtkInformationVector.h"
 #include "vtkLegacy.h"
+#include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 
+#include <algorithm>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkInformationKeyMacro(vtkCompositeDataSet, NAME, String);
 vtkInformationKeyMacro(vtkCompositeDataSet, CURRENT_PROCESS_CAN_LOAD_BLOCK, Integer);
 
 //------------------------------------------------------------------------------
-vtkCompositeDataSet::vtkCompositeDataSet() = default;
+vtkCompositeDataSet::vtkCompositeDataSet()
+{
+  vtkMath::UninitializeBounds(this->CachedBounds);
+}
 
 //------------------------------------------------------------------------------
 vtkCompositeDataSet::~vtkCompositeDataSet() = default;
@@ -114,22 +121,48 @@ vtkIdType vtkCompositeDataSet::GetNumberOfElements(int type)
 void vtkCompositeDataSet::GetBounds(double bounds[6])
 {
   using Opts = vtk::CompositeDataSetOptions;
-  double bds[6];
-  vtkBoundingBox bbox;
-  for (vtkDataObject* dobj : vtk::Range(this, Opts::SkipEmptyNodes))
+
+  // the leaves cache their own bounds against their modified time; cache the
+  // union the same way so a clean tree only compares time stamps instead of
+  // re-reading every block
+  // the sweep must include non-leaf nodes: structural edits to a nested
+  // composite (say, SetBlock on a child multiblock) only bump that child's
+  // MTime, which a leaves-only traversal never sees
+  vtkMTimeType mTime = this->GetMTime();
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(this->NewIterator());
+  iter->SkipEmptyNodesOn();
+  if (auto* treeIter = vtkDataObjectTreeIterator::SafeDownCast(iter))
   {
-    if (auto* ds = vtkDataSet::SafeDownCast(dobj))
-    {
-      ds->GetBounds(bds);
-      bbox.AddBounds(bds);
-    }
-    else if (auto* cg = vtkCellGrid::SafeDownCast(dobj))
+    treeIter->VisitOnlyLeavesOff();
+  }
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    mTime = std::max(mTime, iter->GetCurrentDataObject()->GetMTime());
+  }
+
+  if (mTime > this->BoundsComputeTime.GetMTime())
+  {
+    double bds[6];
+    vtkBoundingBox bbox;
+    for (vtkDataObject* dobj : vtk::Range(this, Opts::SkipEmptyNodes))
     {
-      cg->GetBounds(bds);
-      bbox.AddBounds(bds);
+      if (auto* ds = vtkDataSet::SafeDownCast(dobj))
+      {
+        ds->GetBounds(bds);
+        bbox.AddBounds(bds);
+      }
+      else if (auto* cg = vtkCellGrid::SafeDownCast(dobj))
+      {
+        cg->GetBounds(bds);
+        bbox.AddBounds(bds);
+      }
     }
+    bbox.GetBounds(this->CachedBounds);
+    this->BoundsComputeTime.Modified();
   }
-  bbox.GetBounds(bounds);
+
+  std::copy_n(this->CachedBounds, 6, bounds);
 }
 
 //------------------------------------------------------------------------------
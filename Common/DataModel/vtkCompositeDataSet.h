@@ -146,6 +146,10 @@ public:
    * dataset then the returned bounds will be undefined. THIS METHOD IS
    * THREAD SAFE IF FIRST CALLED FROM A SINGLE THREAD AND THE DATASET IS NOT
    * MODIFIED.
+   *
+   * The union of the block bounds is cached and only recomputed when this
+   * dataset or one of its blocks has been modified since the last query, so
+   * repeated calls (per-frame culling, camera resets) do not re-read points.
    */
   void GetBounds(double bounds[6]);
 
@@ -185,6 +189,10 @@ protected:
   vtkCompositeDataSet();
   ~vtkCompositeDataSet() override;
 
+  // cached union of the block bounds, see GetBounds()
+  double CachedBounds[6];
+  vtkTimeStamp BoundsComputeTime;
+
 private:
   vtkCompositeDataSet(const vtkCompositeDataSet&) = delete;
   void operator=(const vtkCompositeDataSet&) = delete;
@@ -27,6 +27,7 @@
 #include "vtkSmartPointer.h"
 #include "vtkStructuredData.h"
 
+#include <algorithm>
 #include <cmath>
 #include <set>
 
@@ -51,6 +52,8 @@ vtkDataSet::vtkDataSet()
 
   this->ScalarRange[0] = 0.0;
   this->ScalarRange[1] = 1.0;
+
+  this->ValidCellSpansGhostsToSkip = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -1126,6 +1129,78 @@ vtkUnsignedCharArray* vtkDataSet::GetCellGhostArray()
   return this->CellData->GetGhostArray();
 }
 
+//------------------------------------------------------------------------------
+const std::vector<std::array<vtkIdType, 2>>& vtkDataSet::GetValidCellSpans(
+  unsigned char ghostsToSkip)
+{
+  if (this->ValidCellSpansComputeTime.GetMTime() > this->GetMTime() &&
+    this->ValidCellSpansGhostsToSkip == ghostsToSkip)
+  {
+    return this->ValidCellSpans;
+  }
+
+  const vtkIdType numCells = this->GetNumberOfCells();
+  this->ValidCellSpans.clear();
+  vtkUnsignedCharArray* ghosts = this->GetCellGhostArray();
+  if (!ghosts || ghostsToSkip == 0)
+  {
+    if (numCells > 0)
+    {
+      this->ValidCellSpans.push_back({ 0, numCells });
+    }
+  }
+  else
+  {
+    // Build per-chunk span lists in parallel, then stitch them together
+    // serially, joining spans that meet at a chunk boundary. Fixed size
+    // chunks keep the result deterministic regardless of how the work is
+    // split across threads.
+    const unsigned char* ghostValues = ghosts->GetPointer(0);
+    constexpr vtkIdType chunkSize = 65536;
+    const vtkIdType numChunks = (numCells + chunkSize - 1) / chunkSize;
+    std::vector<std::vector<std::array<vtkIdType, 2>>> chunkSpans(numChunks);
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType beginChunk, vtkIdType endChunk) {
+      for (vtkIdType chunk = beginChunk; chunk < endChunk; ++chunk)
+      {
+        auto& spans = chunkSpans[chunk];
+        const vtkIdType chunkEnd = std::min(numCells, (chunk + 1) * chunkSize);
+        for (vtkIdType cellId = chunk * chunkSize; cellId < chunkEnd; ++cellId)
+        {
+          if ((ghostValues[cellId] & ghostsToSkip) == 0)
+          {
+            if (!spans.empty() && spans.back()[1] == cellId)
+            {
+              spans.back()[1] = cellId + 1;
+            }
+            else
+            {
+              spans.push_back({ cellId, cellId + 1 });
+            }
+          }
+        }
+      }
+    });
+    for (const auto& spans : chunkSpans)
+    {
+      for (const auto& span : spans)
+      {
+        if (!this->ValidCellSpans.empty() && this->ValidCellSpans.back()[1] == span[0])
+        {
+          this->ValidCellSpans.back()[1] = span[1];
+        }
+        else
+        {
+          this->ValidCellSpans.push_back(span);
+        }
+      }
+    }
+  }
+
+  this->ValidCellSpansGhostsToSkip = ghostsToSkip;
+  this->ValidCellSpansComputeTime.Modified();
+  return this->ValidCellSpans;
+}
+
 //------------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkDataSet::AllocateCellGhostArray()
 {
@@ -35,6 +35,9 @@
 #include "vtkSmartPointer.h"  // For vtkSmartPointer
 #include "vtkWrappingHints.h" // For VTK_MARSHALAUTO
 
+#include <array>  // For GetValidCellSpans
+#include <vector> // For GetValidCellSpans
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCell;
 class vtkCellData;
@@ -516,6 +519,19 @@ public:
    */
   vtkUnsignedCharArray* GetCellGhostArray();
 
+  /**
+   * Return the runs [begin, end) of consecutive cells whose ghost type does
+   * not contain any of the bits in ghostsToSkip (e.g.
+   * vtkDataSetAttributes::DUPLICATECELL | vtkDataSetAttributes::HIDDENCELL).
+   * Filters can iterate these spans instead of testing the ghost array for
+   * every cell. The spans are computed in parallel on first use and cached;
+   * the cache is rebuilt when this dataset is modified or when a different
+   * ghostsToSkip is requested. When there is no cell ghost array the single
+   * span [0, GetNumberOfCells()) is returned. THIS METHOD IS THREAD SAFE IF
+   * FIRST CALLED FROM A SINGLE THREAD AND THE DATASET IS NOT MODIFIED.
+   */
+  const std::vector<std::array<vtkIdType, 2>>& GetValidCellSpans(unsigned char ghostsToSkip);
+
   /**
    * Updates the pointer to the cell ghost array.
    */
@@ -570,6 +586,12 @@ protected:
   // Time at which scalar range is computed
   vtkTimeStamp ScalarRangeComputeTime;
 
+  // Cached runs of cells not masked by the cell ghost array,
+  // see GetValidCellSpans()
+  std::vector<std::array<vtkIdType, 2>> ValidCellSpans;
+  unsigned char ValidCellSpansGhostsToSkip;
+  vtkTimeStamp ValidCellSpansComputeTime;
+
   ///@{
   /**
    * These arrays pointers are caches used to avoid a string comparison (when
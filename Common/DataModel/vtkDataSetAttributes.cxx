@@ -12,6 +12,7 @@
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <cstring>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -1094,6 +1095,94 @@ void vtkDataSetAttributes::CopyData(
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkDataSetAttributes::CopyDataPlan::Update(
+  vtkDataSetAttributes* toPd, vtkDataSetAttributes* fromPd)
+{
+  if (!toPd || !fromPd)
+  {
+    this->Invalidate();
+    return false;
+  }
+
+  // Reuse the compiled pairs while both field layouts are unchanged. Array
+  // value modifications do not touch the field data MTime, so per-tuple
+  // writes between timesteps do not force a rebuild.
+  if (toPd == this->TargetFields && fromPd == this->SourceFields &&
+    toPd->GetMTime() == this->TargetLayoutTime && fromPd->GetMTime() == this->SourceLayoutTime)
+  {
+    return !this->Pairs.empty();
+  }
+
+  this->Pairs.clear();
+  this->TargetFields = toPd;
+  this->SourceFields = fromPd;
+  this->TargetLayoutTime = toPd->GetMTime();
+  this->SourceLayoutTime = fromPd->GetMTime();
+
+  vtkFieldData::BasicIterator requiredArrays = toPd->ComputeRequiredArrays(fromPd, COPYTUPLE);
+  for (const int i : requiredArrays)
+  {
+    vtkAbstractArray* source = fromPd->GetAbstractArray(i);
+    const char* name = source->GetName();
+    if (!name || !name[0])
+    {
+      continue;
+    }
+    vtkAbstractArray* target = toPd->GetAbstractArray(name);
+    if (!target)
+    {
+      continue;
+    }
+    // A straight memcpy is valid when both sides agree on value type,
+    // tuple size and contiguous (AOS) storage; vtkBitArray is excluded
+    // through its zero data type size.
+    bool memcpyable = source->GetDataType() == target->GetDataType() &&
+      source->GetNumberOfComponents() == target->GetNumberOfComponents() &&
+      source->GetDataTypeSize() > 0 && source->HasStandardMemoryLayout() &&
+      target->HasStandardMemoryLayout();
+    this->Pairs.push_back({ source, target, memcpyable });
+  }
+
+  return !this->Pairs.empty();
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::CopyDataPlan::CopyData(
+  vtkIdType dstStart, vtkIdType n, vtkIdType srcStart) const
+{
+  if (n <= 0)
+  {
+    return;
+  }
+
+  for (const ArrayPair& pair : this->Pairs)
+  {
+    if (pair.Memcpyable)
+    {
+      int numComp = pair.Target->GetNumberOfComponents();
+      size_t valueSize = static_cast<size_t>(pair.Target->GetDataTypeSize());
+      void* dest = pair.Target->WriteVoidPointer(dstStart * numComp, n * numComp);
+      const void* src = pair.Source->GetVoidPointer(srcStart * numComp);
+      memcpy(dest, src, static_cast<size_t>(n) * numComp * valueSize);
+    }
+    else
+    {
+      pair.Target->InsertTuples(dstStart, n, srcStart, pair.Source);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::CopyDataPlan::Invalidate()
+{
+  this->Pairs.clear();
+  this->SourceFields = nullptr;
+  this->TargetFields = nullptr;
+  this->SourceLayoutTime = 0;
+  this->TargetLayoutTime = 0;
+}
+
 //------------------------------------------------------------------------------
 void vtkDataSetAttributes::CopyAllocate(
   vtkDataSetAttributes* pd, vtkIdType sze, vtkIdType ext, int shallowCopyArrays)
@@ -44,6 +44,8 @@
 #include "vtkFieldData.h"
 #include "vtkWrappingHints.h" // For VTK_MARSHALMANUAL
 
+#include <vector> // For CopyDataPlan
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkLookupTable;
 
@@ -542,6 +544,58 @@ public:
    */
   void CopyData(vtkDataSetAttributes* fromPd, vtkIdType dstStart, vtkIdType n, vtkIdType srcStart);
 
+  /**
+   * A compiled mapping between the arrays of a source vtkDataSetAttributes
+   * and the arrays of a target, intended for repeated range copies in
+   * transient (per-timestep) pipelines. Update() resolves the source/target
+   * array pairs once, obeying the same copy flags as CopyData(), and reuses
+   * them as long as neither object's field layout has changed (tracked via
+   * MTime), so a per-step attribute shuffle reduces to one memcpy per
+   * matching array instead of redoing the field matching every step.
+   */
+  class VTKCOMMONDATAMODEL_EXPORT CopyDataPlan
+  {
+  public:
+    /**
+     * Compile the plan for copying from fromPd into toPd, or revalidate it
+     * if it was already compiled for these two objects. Arrays are matched
+     * by name, as in FieldList copying; nameless source arrays are skipped.
+     * The pairs are rebuilt only when either object's MTime changed since
+     * the last call, so this is cheap to invoke every timestep. The caller
+     * must keep both objects alive while the plan is in use.
+     * Returns true if at least one array pair was resolved.
+     */
+    bool Update(vtkDataSetAttributes* toPd, vtkDataSetAttributes* fromPd);
+
+    /**
+     * Copy n consecutive tuples starting at srcStart from the source arrays
+     * into the target arrays starting at dstStart, using the compiled pairs.
+     * Pairs whose arrays share type, component count and memory layout are
+     * copied with a single memcpy; the rest fall back to InsertTuples().
+     * Make sure Update() has been invoked before using this method.
+     */
+    void CopyData(vtkIdType dstStart, vtkIdType n, vtkIdType srcStart) const;
+
+    /**
+     * Discard the compiled pairs, forcing the next Update() to rebuild.
+     */
+    void Invalidate();
+
+  private:
+    struct ArrayPair
+    {
+      vtkAbstractArray* Source;
+      vtkAbstractArray* Target;
+      bool Memcpyable;
+    };
+
+    std::vector<ArrayPair> Pairs;
+    vtkDataSetAttributes* SourceFields = nullptr;
+    vtkDataSetAttributes* TargetFields = nullptr;
+    vtkMTimeType SourceLayoutTime = 0;
+    vtkMTimeType TargetLayoutTime = 0;
+  };
+
   ///@{
   /**
    * Copy a tuple (or set of tuples) of data from one data array to another.
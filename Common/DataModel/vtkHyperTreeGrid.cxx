@@ -1658,9 +1658,11 @@ void vtkHyperTreeGrid::ComputeBounds()
     vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
     this->InitializeTreeIterator(it);
     vtkBoundingBox mergedBounds;
+    // Reuse one cursor across trees instead of allocating one per tree.
+    vtkNew<vtkHyperTreeGridNonOrientedGeometryCursor> cursor;
     while (it.GetNextTree(inIndex))
     {
-      auto cursor = vtk::TakeSmartPointer(this->NewNonOrientedGeometryCursor(inIndex));
+      this->InitializeNonOrientedGeometryCursor(cursor, inIndex);
       if (!cursor->IsMasked())
       {
         vtkBoundingBox bounds;
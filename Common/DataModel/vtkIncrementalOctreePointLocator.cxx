@@ -1291,6 +1291,62 @@ int vtkIncrementalOctreePointLocator::InsertUniquePoint(const double point[3], v
                            this->MaxPointsPerLeaf, &pntId, 2, this->NumberOfNodes));
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkIncrementalOctreePointLocator::InsertUniquePoints(vtkPoints* points, vtkIdList* pntIds)
+{
+  vtkIdType numPts = points ? points->GetNumberOfPoints() : 0;
+  pntIds->SetNumberOfIds(numPts);
+  if (numPts == 0)
+  {
+    return 0;
+  }
+
+  // reserve room for the whole batch up front so that the per-point calls to
+  // vtkPoints::InsertNextPoint() do not repeatedly re-allocate the coordinate
+  // array while the batch is under processing
+  this->LocatorPoints->Resize(this->LocatorPoints->GetNumberOfPoints() + numPts);
+
+  double pntCord[3];
+  vtkIdType pointIdx = -1;
+  vtkIdType numInserted = 0;
+  vtkIncrementalOctreeNode* leafNode = nullptr;
+
+  for (vtkIdType i = 0; i < numPts; i++)
+  {
+    points->GetPoint(i, pntCord);
+
+    if (this->InsertTolerance2 == 0.0)
+    {
+      // Batches coming from cell-by-cell processing are spatially coherent in
+      // that consecutive points tend to fall to the same leaf node. Thus the
+      // previous container, as long as it still covers the point, serves as
+      // the descent origin (after a sub-division it is an interior node and
+      // the descent simply continues below it) in place of the root node.
+      vtkIncrementalOctreeNode* origin =
+        (leafNode && leafNode->ContainsPoint(pntCord)) ? leafNode : this->OctreeRootNode;
+      leafNode = this->GetLeafContainer(origin, pntCord);
+      pointIdx = this->FindDuplicatePointInLeafNode(leafNode, pntCord);
+    }
+    else
+    {
+      // non-zero tolerance insertion searches a sphere possibly spanning
+      // nodes far away from the container and hence resorts to the full check
+      pointIdx = this->IsInsertedPointForNonZeroTolerance(pntCord, &leafNode);
+    }
+
+    if (pointIdx == -1)
+    {
+      leafNode->InsertPoint(
+        this->LocatorPoints, pntCord, this->MaxPointsPerLeaf, &pointIdx, 2, this->NumberOfNodes);
+      numInserted++;
+    }
+
+    pntIds->SetId(i, pointIdx);
+  }
+
+  return numInserted;
+}
+
 //------------------------------------------------------------------------------
 void vtkIncrementalOctreePointLocator::InsertPointWithoutChecking(
   const double point[3], vtkIdType& pntId, int insert)
@@ -289,6 +289,19 @@ public:
    */
   int InsertUniquePoint(const double point[3], vtkIdType& pntId) override;
 
+  /**
+   * Insert a batch of points, skipping duplicates, in a single call. For each
+   * input point i, pntIds->GetId(i) provides the index assigned to the point
+   * (the index of the existing duplicate upon a rejection). Returned is the
+   * number of points actually inserted. The underlying vtkPoints storage is
+   * reserved for the whole batch up front and the octree descent re-uses the
+   * previous leaf container for spatially coherent input, making this faster
+   * than repeated InsertUniquePoint() calls for append / merge style
+   * workflows. Note that InitPointInsertion() should have been called prior
+   * to this function. This method is not thread safe.
+   */
+  vtkIdType InsertUniquePoints(vtkPoints* points, vtkIdList* pntIds);
+
   /**
    * Insert a given point into the octree with a specified point index ptId.
    * InitPointInsertion() should have been called prior to this function. In
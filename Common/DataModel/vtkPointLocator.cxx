@@ -8,6 +8,7 @@
 #include "vtkIntArray.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkPerformanceCounters.h"
 #include "vtkPolyData.h"
 
 #include <algorithm> //std::sort
@@ -857,6 +858,7 @@ void vtkPointLocator::BuildLocatorInternal()
     vtkErrorMacro(<< "No points to subdivide");
     return;
   }
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::LOCATOR_BUILDS, 1);
 
   //  Make sure the appropriate data is available
   this->FreeSearchStructure();
@@ -856,6 +856,29 @@ void vtkPolyData::BuildLinks(int initialSize)
   this->Links->BuildLinks();
 }
 
+//------------------------------------------------------------------------------
+// Return editable links, converting from the read-only static links if
+// necessary. BuildLinks() prefers vtkStaticCellLinks for its parallel build
+// and compact storage; the dynamic vtkCellLinks representation is only
+// materialized here, on the first editing call.
+vtkCellLinks* vtkPolyData::GetEditableLinks()
+{
+  if (!this->Links)
+  {
+    this->BuildLinks();
+  }
+  vtkCellLinks* links = vtkCellLinks::SafeDownCast(this->Links);
+  if (!links)
+  {
+    auto editable = vtkSmartPointer<vtkCellLinks>::New();
+    editable->SetDataSet(this);
+    editable->BuildLinks();
+    this->Links = editable;
+    links = editable;
+  }
+  return links;
+}
+
 //------------------------------------------------------------------------------
 // Copy a cells point ids into list provided. (Less efficient.)
 void vtkPolyData::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
@@ -887,7 +910,7 @@ void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
   cellIds->Reset();
 
   vtkIdType numCells, *cells;
-  if (!this->Editable)
+  if (this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
   {
     vtkStaticCellLinks* links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
     numCells = links->GetNcells(ptId);
@@ -910,7 +933,7 @@ void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 //------------------------------------------------------------------------------
 void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
 {
-  if (!this->Editable)
+  if (this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
   {
     auto links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
     ncells = links->GetNcells(ptId);
@@ -1077,7 +1100,7 @@ void vtkPolyData::ReverseCell(vtkIdType cellId)
 // use this method, make sure points are available and BuildLinks() has been invoked.)
 vtkIdType vtkPolyData::InsertNextLinkedPoint(int numLinks)
 {
-  return static_cast<vtkCellLinks*>(this->Links.Get())->InsertNextPoint(numLinks);
+  return this->GetEditableLinks()->InsertNextPoint(numLinks);
 }
 
 //------------------------------------------------------------------------------
@@ -1087,7 +1110,7 @@ vtkIdType vtkPolyData::InsertNextLinkedPoint(int numLinks)
 // and BuildLinks() has been invoked.)
 vtkIdType vtkPolyData::InsertNextLinkedPoint(double x[3], int numLinks)
 {
-  static_cast<vtkCellLinks*>(this->Links.Get())->InsertNextPoint(numLinks);
+  this->GetEditableLinks()->InsertNextPoint(numLinks);
   return this->Points->InsertNextPoint(x);
 }
 
@@ -1101,7 +1124,7 @@ vtkIdType vtkPolyData::InsertNextLinkedCell(int type, int npts, const vtkIdType
 
   id = this->InsertNextCell(type, npts, pts);
 
-  vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
+  vtkCellLinks* links = this->GetEditableLinks();
   for (i = 0; i < npts; i++)
   {
     links->ResizeCellList(pts[i], 1);
@@ -1118,7 +1141,7 @@ vtkIdType vtkPolyData::InsertNextLinkedCell(int type, int npts, const vtkIdType
 // operator ResizeCellList() to do this if necessary.
 void vtkPolyData::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  static_cast<vtkCellLinks*>(this->Links.Get())->RemoveCellReference(cellId, ptId);
+  this->GetEditableLinks()->RemoveCellReference(cellId, ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -1128,7 +1151,7 @@ void vtkPolyData::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 // operator ResizeCellList() to do this if necessary.
 void vtkPolyData::AddReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  static_cast<vtkCellLinks*>(this->Links.Get())->AddCellReference(cellId, ptId);
+  this->GetEditableLinks()->AddCellReference(cellId, ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -1164,7 +1187,7 @@ void vtkPolyData::ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 void vtkPolyData::ReplaceLinkedCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 {
   this->ReplaceCell(cellId, npts, pts);
-  auto links = static_cast<vtkCellLinks*>(this->Links.Get());
+  vtkCellLinks* links = this->GetEditableLinks();
   for (int i = 0; i < npts; i++)
   {
     links->InsertNextCellReference(pts[i], cellId);
@@ -1216,7 +1239,7 @@ void vtkPolyData::GetCellEdgeNeighbors(
     this->BuildLinks();
   }
 
-  if (!this->Editable)
+  if (this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
   {
     vtkStaticCellLinks* links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
     GetCellEdgeNeighborsImpl<vtkStaticCellLinks>(links, cellId, p1, p2, cellIds);
@@ -1284,7 +1307,7 @@ void vtkPolyData::GetCellNeighbors(vtkIdType cellId, vtkIdList* ptIds, vtkIdList
   }
 
   // Get the cell links based on the current state.
-  if (!this->Editable)
+  if (this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
   {
     vtkStaticCellLinks* links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
     GetCellNeighborsImpl<vtkStaticCellLinks>(
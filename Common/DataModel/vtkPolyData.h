@@ -702,6 +702,10 @@ protected:
 
   vtkCellArray* GetCellArrayInternal(TaggedCellId tag);
 
+  // Return the links as editable vtkCellLinks, materializing them from the
+  // read-only static links if needed (see BuildLinks()).
+  vtkCellLinks* GetEditableLinks();
+
   // points inherited
   // point data (i.e., scalars, vectors, normals, tcoords) inherited
   vtkSmartPointer<vtkCellArray> Verts;
@@ -802,7 +806,7 @@ inline int vtkPolyData::IsPointUsedByCell(vtkIdType ptId, vtkIdType cellId)
 //------------------------------------------------------------------------------
 inline void vtkPolyData::DeletePoint(vtkIdType ptId)
 {
-  static_cast<vtkCellLinks*>(this->Links.Get())->DeletePoint(ptId);
+  this->GetEditableLinks()->DeletePoint(ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -818,7 +822,7 @@ inline void vtkPolyData::RemoveCellReference(vtkIdType cellId)
   vtkIdType npts;
 
   this->GetCellPoints(cellId, npts, pts);
-  auto links = static_cast<vtkCellLinks*>(this->Links.Get());
+  vtkCellLinks* links = this->GetEditableLinks();
   for (vtkIdType i = 0; i < npts; i++)
   {
     links->RemoveCellReference(cellId, pts[i]);
@@ -832,7 +836,7 @@ inline void vtkPolyData::AddCellReference(vtkIdType cellId)
   vtkIdType npts;
 
   this->GetCellPoints(cellId, npts, pts);
-  auto links = static_cast<vtkCellLinks*>(this->Links.Get());
+  vtkCellLinks* links = this->GetEditableLinks();
   for (vtkIdType i = 0; i < npts; i++)
   {
     links->AddCellReference(cellId, pts[i]);
@@ -842,7 +846,7 @@ inline void vtkPolyData::AddCellReference(vtkIdType cellId)
 //------------------------------------------------------------------------------
 inline void vtkPolyData::ResizeCellList(vtkIdType ptId, int size)
 {
-  static_cast<vtkCellLinks*>(this->Links.Get())->ResizeCellList(ptId, size);
+  this->GetEditableLinks()->ResizeCellList(ptId, size);
 }
 
 //------------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 #include "vtkMath.h"
 #include "vtkMergePoints.h"
 #include "vtkObjectFactory.h"
+#include "vtkPerformanceCounters.h"
 #include "vtkPlane.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
@@ -1472,6 +1473,7 @@ void vtkStaticCellLocator::BuildLocatorInternal()
     vtkErrorMacro(<< "No cells to build");
     return;
   }
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::LOCATOR_BUILDS, 1);
 
   // Prepare
   this->FreeSearchStructure();
@@ -11,6 +11,7 @@
 #include "vtkLine.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkPerformanceCounters.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkSMPThreadLocal.h"
@@ -1986,9 +1987,11 @@ void vtkStaticPointLocator::BuildLocatorInternal()
     vtkErrorMacro(<< "No points to locate");
     return;
   }
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::LOCATOR_BUILDS, 1);
 
-  //  Make sure the appropriate data is available
-  this->FreeSearchStructure();
+  // The old search structure is kept alive while the new one is built so
+  // that in-flight queries (which snapshot all binning parameters inside the
+  // bucket list) keep working; it is freed at the swap below.
 
   // Size the root bucket.  Initialize bucket data structure, compute
   // level and divisions. The GetBounds() method below can be very slow;
@@ -2029,19 +2032,26 @@ void vtkStaticPointLocator::BuildLocatorInternal()
   // Instantiate the locator. The type is related to the maximum point id.
   // This is done for performance (e.g., the sort is faster) and significant
   // memory savings.
+  vtkBucketList* newBuckets;
+  bool largeIds;
   if (numPts >= VTK_INT_MAX || numBuckets >= VTK_INT_MAX)
   {
-    this->LargeIds = true;
-    this->Buckets = new BucketList<vtkIdType>(this, numPts, numBuckets);
+    largeIds = true;
+    newBuckets = new BucketList<vtkIdType>(this, numPts, numBuckets);
   }
   else
   {
-    this->LargeIds = false;
-    this->Buckets = new BucketList<int>(this, numPts, numBuckets);
+    largeIds = false;
+    newBuckets = new BucketList<int>(this, numPts, numBuckets);
   }
 
-  // Actually construct the locator
-  this->Buckets->BuildLocator();
+  // Actually construct the locator, then swap it in and release the old
+  // structure. Note the swap itself is not synchronized: callers that query
+  // from other threads must ensure no query straddles the swap.
+  newBuckets->BuildLocator();
+  this->FreeSearchStructure();
+  this->LargeIds = largeIds;
+  this->Buckets = newBuckets;
 
   this->BuildTime.Modified();
 }
@@ -2073,13 +2083,10 @@ void vtkStaticPointLocator::BuildLocator(const double* inBounds)
     vtkErrorMacro(<< "No points to locate");
     return;
   }
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::LOCATOR_BUILDS, 1);
 
-  //  Make sure the appropriate data is available
-  //
-  if (this->Buckets)
-  {
-    this->FreeSearchStructure();
-  }
+  // The old search structure is kept alive while the new one is built so
+  // that in-flight queries keep working; it is freed at the swap below.
 
   // Size the root bucket.  Initialize bucket data structure, compute
   // level and divisions. The GetBounds() method below can be very slow;
@@ -2122,19 +2129,25 @@ void vtkStaticPointLocator::BuildLocator(const double* inBounds)
   // This is done for performance (e.g., the sort is faster) and significant
   // memory savings.
   //
+  vtkBucketList* newBuckets;
+  bool largeIds;
   if (numPts >= VTK_INT_MAX || numBuckets >= VTK_INT_MAX)
   {
-    this->LargeIds = true;
-    this->Buckets = new BucketList<vtkIdType>(this, numPts, numBuckets);
+    largeIds = true;
+    newBuckets = new BucketList<vtkIdType>(this, numPts, numBuckets);
   }
   else
   {
-    this->LargeIds = false;
-    this->Buckets = new BucketList<int>(this, numPts, numBuckets);
+    largeIds = false;
+    newBuckets = new BucketList<int>(this, numPts, numBuckets);
   }
 
-  // Actually construct the locator
-  this->Buckets->BuildLocator();
+  // Actually construct the locator, then swap it in and release the old
+  // structure (see BuildLocatorInternal()).
+  newBuckets->BuildLocator();
+  this->FreeSearchStructure();
+  this->LargeIds = largeIds;
+  this->Buckets = newBuckets;
 
   this->BuildTime.Modified();
 }
@@ -209,6 +209,29 @@ void vtkTable::GetRow(vtkIdType row, vtkVariantArray* values)
   }
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkTable::RowView::GetNumberOfValues() const
+{
+  return this->Table->GetNumberOfColumns();
+}
+
+//------------------------------------------------------------------------------
+vtkVariant vtkTable::RowView::GetValue(vtkIdType col) const
+{
+  return this->Table->GetValue(this->Row, col);
+}
+
+//------------------------------------------------------------------------------
+double vtkTable::RowView::GetDouble(vtkIdType col) const
+{
+  vtkDataArray* array = vtkArrayDownCast<vtkDataArray>(this->Table->GetColumn(col));
+  if (array && this->Row < array->GetNumberOfTuples())
+  {
+    return array->GetComponent(this->Row, 0);
+  }
+  return this->GetValue(col).ToDouble();
+}
+
 //------------------------------------------------------------------------------
 void vtkTable::SetRow(vtkIdType row, vtkVariantArray* values)
 {
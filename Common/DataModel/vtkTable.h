@@ -40,6 +40,7 @@
 #ifndef vtkTable_h
 #define vtkTable_h
 
+#include "vtkAOSDataArrayTemplate.h"  // For GetColumnSpan
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkDataObject.h"
 
@@ -124,6 +125,59 @@ public:
    */
   void SetRow(vtkIdType row, vtkVariantArray* values);
 
+  /**
+   * A lazy, zero-allocation view on one row of a table. Unlike GetRow(),
+   * no vtkVariantArray is materialized: cells are fetched from the column
+   * arrays on access, and only the requested cell is boxed into a variant.
+   * The view is valid as long as the table and its column layout are
+   * unchanged.
+   */
+  class VTKCOMMONDATAMODEL_EXPORT RowView
+  {
+  public:
+    /**
+     * Get the index of the viewed row.
+     */
+    vtkIdType GetRow() const { return this->Row; }
+
+    /**
+     * Get the number of cells in the row, i.e. the number of table columns.
+     */
+    vtkIdType GetNumberOfValues() const;
+
+    /**
+     * Retrieve one cell of the row as a variant. Only the requested cell
+     * is boxed.
+     */
+    vtkVariant GetValue(vtkIdType col) const;
+
+    /**
+     * Retrieve one cell of a numeric column as a double without any
+     * variant boxing. Non-numeric columns fall back to boxing through
+     * GetValue() and converting the result.
+     */
+    double GetDouble(vtkIdType col) const;
+
+  private:
+    friend class vtkTable;
+    RowView(vtkTable* table, vtkIdType row)
+      : Table(table)
+      , Row(row)
+    {
+    }
+
+    vtkTable* Table;
+    vtkIdType Row;
+  };
+
+  /**
+   * Get a lazy view on the given row. This performs no allocation and is
+   * thread safe as long as the table is not modified concurrently, making
+   * it the preferred row accessor for analytics filters iterating large
+   * tables.
+   */
+  RowView GetRowView(vtkIdType row) { return RowView(this, row); }
+
   /**
    * Insert a single row at the index.
    */
@@ -189,6 +243,29 @@ public:
    */
   vtkAbstractArray* GetColumn(vtkIdType col);
 
+  /**
+   * Get a zero-allocation typed span over the values of a column. On
+   * success, begin and end delimit the contiguous native storage of the
+   * column and true is returned; consumers can then iterate the raw values
+   * without per-cell virtual calls or variant boxing. Returns false (and
+   * null pointers) when the column is not an array-of-structs vtkDataArray
+   * whose native value type is exactly ValueT.
+   */
+  template <typename ValueT>
+  bool GetColumnSpan(vtkIdType col, ValueT*& begin, ValueT*& end)
+  {
+    begin = end = nullptr;
+    vtkAOSDataArrayTemplate<ValueT>* array =
+      vtkArrayDownCast<vtkAOSDataArrayTemplate<ValueT>>(this->GetColumn(col));
+    if (!array)
+    {
+      return false;
+    }
+    begin = array->GetPointer(0);
+    end = begin + array->GetNumberOfValues();
+    return true;
+  }
+
   /**
    * Add a column to the table.
    */
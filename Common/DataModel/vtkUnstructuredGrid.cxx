@@ -19,12 +19,16 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyhedron.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStaticCellLinks.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGridCellIterator.h"
 
 #include <algorithm>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkUnstructuredGrid);
@@ -252,6 +256,7 @@ vtkUnstructuredGrid::vtkUnstructuredGrid()
   this->Information->Set(vtkDataObject::DATA_NUMBER_OF_GHOST_LEVELS(), 0);
 
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeHistogramUpdateMTime = 0;
   this->DistinctCellTypes = vtkSmartPointer<vtkCellTypes>::New();
   this->Types = vtkSmartPointer<vtkUnsignedCharArray>::New();
   this->Connectivity = vtkSmartPointer<vtkCellArray>::New();
@@ -294,6 +299,7 @@ void vtkUnstructuredGrid::CopyStructure(vtkDataSet* ds)
   this->Types = ug->Types;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeHistogramUpdateMTime = 0;
   this->Faces = ug->Faces;
   this->FaceLocations = ug->FaceLocations;
 }
@@ -306,6 +312,7 @@ void vtkUnstructuredGrid::Cleanup()
   this->Types = nullptr;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeHistogramUpdateMTime = 0;
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
 }
@@ -1039,6 +1046,7 @@ void vtkUnstructuredGrid::SetCells(vtkUnsignedCharArray* cellTypes, vtkCellArray
   this->Types = cellTypes;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeHistogramUpdateMTime = 0;
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
   if (faceLocations != nullptr && faces != nullptr)
@@ -1090,6 +1098,7 @@ void vtkUnstructuredGrid::SetPolyhedralCells(vtkUnsignedCharArray* cellTypes, vt
   this->Types = cellTypes;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeHistogramUpdateMTime = 0;
   this->Faces = faces;
   this->FaceLocations = faceLocations;
   this->LegacyFaces = nullptr;
@@ -1135,7 +1144,7 @@ vtkAbstractCellLinks* vtkUnstructuredGrid::GetCellLinks()
 //------------------------------------------------------------------------------
 void vtkUnstructuredGrid::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
 {
-  if (!this->Editable)
+  if (this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
   {
     vtkStaticCellLinks* links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
 
@@ -1189,7 +1198,16 @@ vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
       this->DistinctCellTypes->Register(this);
       this->DistinctCellTypes->Delete();
     }
-    vtkDataSet::GetCellTypes(this->DistinctCellTypes);
+    // Derive the distinct types from the (lazily computed, cached)
+    // histogram rather than re-scanning the types array.
+    this->UpdateCellTypeHistogram();
+    for (int type = 0; type < VTK_UNSIGNED_CHAR_MAX + 1; ++type)
+    {
+      if (this->CellTypeHistogram[type] > 0)
+      {
+        this->DistinctCellTypes->InsertNextType(static_cast<unsigned char>(type));
+      }
+    }
 
     this->DistinctCellTypesUpdateMTime = this->Types->GetMTime();
   }
@@ -1197,6 +1215,61 @@ vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
   return this->DistinctCellTypes->GetCellTypesArray();
 }
 
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::UpdateCellTypeHistogram()
+{
+  constexpr int numBins = VTK_UNSIGNED_CHAR_MAX + 1;
+  if (!this->CellTypeHistogram.empty() && this->Types &&
+    this->Types->GetMTime() <= this->CellTypeHistogramUpdateMTime)
+  {
+    return;
+  }
+
+  this->CellTypeHistogram.assign(numBins, 0);
+  if (!this->Types)
+  {
+    return;
+  }
+
+  // Build the histogram in parallel shards and reduce.
+  const vtkIdType numCells = this->Types->GetNumberOfValues();
+  const unsigned char* types = this->Types->GetPointer(0);
+  vtkSMPThreadLocal<std::vector<vtkIdType>> tlHistogram;
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      std::vector<vtkIdType>& histogram = tlHistogram.Local();
+      if (histogram.empty())
+      {
+        histogram.resize(numBins, 0);
+      }
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        ++histogram[types[cellId]];
+      }
+    });
+  for (const std::vector<vtkIdType>& histogram : tlHistogram)
+  {
+    for (int type = 0; type < numBins; ++type)
+    {
+      this->CellTypeHistogram[type] += histogram[type];
+    }
+  }
+
+  this->CellTypeHistogramUpdateMTime = this->Types->GetMTime();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkUnstructuredGrid::GetNumberOfCellsOfType(int type)
+{
+  if (type < 0 || type > VTK_UNSIGNED_CHAR_MAX)
+  {
+    return 0;
+  }
+  this->UpdateCellTypeHistogram();
+  return this->CellTypeHistogram[type];
+}
+
 //------------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkUnstructuredGrid::GetCellTypesArray()
 {
@@ -1324,7 +1397,7 @@ void vtkUnstructuredGrid::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
   cellIds->Reset();
 
   vtkIdType numCells, *cells;
-  if (!this->Editable)
+  if (this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
   {
     vtkStaticCellLinks* links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
     numCells = links->GetNcells(ptId);
@@ -1408,6 +1481,180 @@ void vtkUnstructuredGrid::Squeeze()
   vtkPointSet::Squeeze();
 }
 
+
+//------------------------------------------------------------------------------
+namespace
+{
+// Mean per-cell spread (max - min) of the point ids referenced by each cell;
+// a simple proxy for the cache locality of the connectivity.
+double ComputeMeanCellBandwidth(vtkCellArray* conn)
+{
+  const vtkIdType numCells = conn->GetNumberOfCells();
+  if (numCells == 0)
+  {
+    return 0.0;
+  }
+  vtkSMPThreadLocal<double> tlSum(0.0);
+  vtkSMPThreadLocalObject<vtkIdList> tlScratch;
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      double& sum = tlSum.Local();
+      vtkIdList* scratch = tlScratch.Local();
+      vtkIdType npts;
+      const vtkIdType* pts;
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        conn->GetCellAtId(cellId, npts, pts, scratch);
+        if (npts > 0)
+        {
+          vtkIdType minId = pts[0], maxId = pts[0];
+          for (vtkIdType j = 1; j < npts; ++j)
+          {
+            minId = std::min(minId, pts[j]);
+            maxId = std::max(maxId, pts[j]);
+          }
+          sum += static_cast<double>(maxId - minId);
+        }
+      }
+    });
+  double total = 0.0;
+  for (const double s : tlSum)
+  {
+    total += s;
+  }
+  return total / static_cast<double>(numCells);
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+double vtkUnstructuredGrid::CompactPointStorage()
+{
+  const vtkIdType numPts = this->GetNumberOfPoints();
+  const vtkIdType numCells = this->GetNumberOfCells();
+  if (numPts == 0 || numCells == 0 || !this->Connectivity || !this->Points)
+  {
+    return 1.0;
+  }
+
+  const double beforeBandwidth = ComputeMeanCellBandwidth(this->Connectivity);
+
+  // Assign new point ids in first-use (cell-traversal) order. Points not
+  // referenced by any cell keep their relative order at the end.
+  std::vector<vtkIdType> newIds(numPts, -1);
+  vtkIdType nextId = 0;
+  vtkNew<vtkIdList> scratch;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    this->Connectivity->GetCellAtId(cellId, npts, pts, scratch);
+    for (vtkIdType j = 0; j < npts; ++j)
+    {
+      if (newIds[pts[j]] < 0)
+      {
+        newIds[pts[j]] = nextId++;
+      }
+    }
+  }
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    if (newIds[ptId] < 0)
+    {
+      newIds[ptId] = nextId++;
+    }
+  }
+
+  // Gather the points into a tightly allocated array in the new order.
+  vtkNew<vtkPoints> newPoints;
+  newPoints->SetDataType(this->Points->GetDataType());
+  newPoints->SetNumberOfPoints(numPts);
+  vtkPoints* oldPoints = this->Points;
+  vtkSMPTools::For(0, numPts,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      double x[3];
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        oldPoints->GetPoint(i, x);
+        newPoints->SetPoint(newIds[i], x);
+      }
+    });
+
+  // Reorder the point data alongside the points.
+  vtkPointData* pd = this->GetPointData();
+  vtkNew<vtkPointData> newPD;
+  newPD->CopyAllocate(pd, numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    newPD->CopyData(pd, i, newIds[i]);
+  }
+
+  // Rebuild the connectivity with exactly-sized arrays and remapped ids.
+  vtkNew<vtkCellArray> newConnectivity;
+  newConnectivity->AllocateExact(numCells, this->Connectivity->GetNumberOfConnectivityIds());
+  std::vector<vtkIdType> cellPts;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    this->Connectivity->GetCellAtId(cellId, npts, pts, scratch);
+    cellPts.resize(static_cast<size_t>(npts));
+    for (vtkIdType j = 0; j < npts; ++j)
+    {
+      cellPts[j] = newIds[pts[j]];
+    }
+    newConnectivity->InsertNextCell(npts, cellPts.data());
+  }
+
+  // Remap the point ids inside polyhedron face streams. The face locations
+  // reference face ids, not point ids, so they are unaffected.
+  if (this->Faces)
+  {
+    const vtkIdType numFaces = this->Faces->GetNumberOfCells();
+    for (vtkIdType faceId = 0; faceId < numFaces; ++faceId)
+    {
+      this->Faces->GetCellAtId(faceId, scratch);
+      for (vtkIdType j = 0; j < scratch->GetNumberOfIds(); ++j)
+      {
+        scratch->SetId(j, newIds[scratch->GetId(j)]);
+      }
+      this->Faces->ReplaceCellAtId(faceId, scratch);
+    }
+  }
+
+  this->SetPoints(newPoints);
+  pd->ShallowCopy(newPD);
+  this->Connectivity = newConnectivity;
+  this->Links = nullptr; // point ids changed; links must be rebuilt
+  this->Modified();
+
+  const double afterBandwidth = ComputeMeanCellBandwidth(this->Connectivity);
+  return beforeBandwidth > 0.0 ? afterBandwidth / beforeBandwidth : 1.0;
+}
+
+//------------------------------------------------------------------------------
+// Return editable links, converting from the read-only static links if
+// necessary. BuildLinks() prefers vtkStaticCellLinks for its parallel build
+// and compact storage; the dynamic vtkCellLinks representation is only
+// materialized here, on the first editing call.
+vtkCellLinks* vtkUnstructuredGrid::GetEditableLinks()
+{
+  if (!this->Links)
+  {
+    this->BuildLinks();
+  }
+  vtkCellLinks* links = vtkCellLinks::SafeDownCast(this->Links);
+  if (!links)
+  {
+    auto editable = vtkSmartPointer<vtkCellLinks>::New();
+    editable->SetDataSet(this);
+    editable->Allocate(this->GetNumberOfPoints());
+    editable->BuildLinks();
+    this->Links = editable;
+    links = editable;
+  }
+  return links;
+}
+
 //------------------------------------------------------------------------------
 // Remove a reference to a cell in a particular point's link list. You may
 // also consider using RemoveCellReference() to remove the references from
@@ -1416,7 +1663,7 @@ void vtkUnstructuredGrid::Squeeze()
 // dataset should be set to "Editable".
 void vtkUnstructuredGrid::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  static_cast<vtkCellLinks*>(this->Links.Get())->RemoveCellReference(cellId, ptId);
+  this->GetEditableLinks()->RemoveCellReference(cellId, ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -1427,7 +1674,7 @@ void vtkUnstructuredGrid::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId
 // should be set to "Editable".
 void vtkUnstructuredGrid::AddReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  static_cast<vtkCellLinks*>(this->Links.Get())->AddCellReference(cellId, ptId);
+  this->GetEditableLinks()->AddCellReference(cellId, ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -1436,7 +1683,7 @@ void vtkUnstructuredGrid::AddReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 // "Editable".
 void vtkUnstructuredGrid::ResizeCellList(vtkIdType ptId, int size)
 {
-  static_cast<vtkCellLinks*>(this->Links.Get())->ResizeCellList(ptId, size);
+  this->GetEditableLinks()->ResizeCellList(ptId, size);
 }
 
 //------------------------------------------------------------------------------
@@ -1460,7 +1707,7 @@ vtkIdType vtkUnstructuredGrid::InsertNextLinkedCell(int type, int npts, const vt
 
   id = this->InsertNextCell(type, npts, pts);
 
-  vtkCellLinks* clinks = static_cast<vtkCellLinks*>(this->Links.Get());
+  vtkCellLinks* clinks = this->GetEditableLinks();
   for (i = 0; i < npts; i++)
   {
     clinks->ResizeCellList(pts[i], 1);
@@ -1527,6 +1774,7 @@ void vtkUnstructuredGrid::ShallowCopy(vtkDataObject* dataObject)
     this->Types = grid->Types;
     this->DistinctCellTypes = nullptr;
     this->DistinctCellTypesUpdateMTime = 0;
+    this->CellTypeHistogramUpdateMTime = 0;
     this->Faces = grid->Faces;
     this->FaceLocations = grid->FaceLocations;
 
@@ -1665,6 +1913,7 @@ bool vtkUnstructuredGrid::AllocateExact(vtkIdType numCells, vtkIdType connectivi
   }
 
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeHistogramUpdateMTime = 0;
   this->DistinctCellTypes = vtkSmartPointer<vtkCellTypes>::New();
   this->Types = vtkSmartPointer<vtkUnsignedCharArray>::New();
   this->Connectivity = vtkSmartPointer<vtkCellArray>::New();
@@ -1850,9 +2099,9 @@ bool vtkUnstructuredGrid::IsCellBoundary(
     this->BuildLinks();
   }
 
-  // Get the links (cells that use each point) depending on the editable
-  // state of this object.
-  if (!this->Editable)
+  // Get the links (cells that use each point) depending on the type of
+  // links that were built.
+  if (this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
   {
     using CellLinksType = vtkStaticCellLinks;
     using TIsCellBoundary = IsCellBoundaryImpl<CellLinksType>;
@@ -1891,7 +2140,7 @@ void vtkUnstructuredGrid::GetCellNeighbors(
   }
 
   // Get the cell links based on the current state.
-  if (!this->Editable)
+  if (this->Links->GetType() != vtkAbstractCellLinks::CELL_LINKS)
   {
     using CellLinksType = vtkStaticCellLinks;
     using TGetCellNeighbors = GetCellNeighborsImpl<CellLinksType>;
@@ -1910,19 +2159,20 @@ void vtkUnstructuredGrid::GetCellNeighbors(
 //------------------------------------------------------------------------------
 int vtkUnstructuredGrid::IsHomogeneous()
 {
-  unsigned char type;
   if (this->Types && this->Types->GetMaxId() >= 0)
   {
-    type = Types->GetValue(0);
-    vtkIdType numCells = this->GetNumberOfCells();
-    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    // The histogram is cached, so repeated calls from filters making
+    // type-specialization decisions are O(1).
+    this->UpdateCellTypeHistogram();
+    int distinctTypes = 0;
+    for (const vtkIdType count : this->CellTypeHistogram)
     {
-      if (this->Types->GetValue(cellId) != type)
+      if (count > 0 && ++distinctTypes > 1)
       {
         return 0;
       }
     }
-    return 1;
+    return distinctTypes == 1 ? 1 : 0;
   }
   return 0;
 }
@@ -25,8 +25,11 @@
 
 #include "vtkSmartPointer.h" // for smart pointer
 
+#include <vector> // for the cell-type histogram
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
+class vtkCellLinks;
 class vtkIdList;
 class vtkIdTypeArray;
 class vtkUnsignedCharArray;
@@ -203,11 +206,32 @@ public:
    */
   vtkUnsignedCharArray* GetCellTypesArray();
 
+  /**
+   * Return the number of cells of the given type (e.g., VTK_TETRA). The
+   * underlying histogram of the cell types array is computed lazily on first
+   * use (in parallel shards) and cached, keyed on the modification time of
+   * the types array, so repeated type-specialization queries in filters are
+   * O(1).
+   */
+  vtkIdType GetNumberOfCellsOfType(int type);
+
   /**
    * Squeeze all arrays in the grid to conserve memory.
    */
   void Squeeze() override;
 
+  /**
+   * Compact the grid after heavy editing (clipping, extraction, ...):
+   * points are renumbered in cell-traversal (first-use) order, and the
+   * points, point data, and connectivity are rebuilt into tightly allocated
+   * arrays, so downstream mappers and locators run on cache-friendly data.
+   * Cell order, cell data, and the number of points and cells are unchanged;
+   * cell links are invalidated. Returns the ratio of the mean per-cell
+   * point-id spread after compaction to the spread before (values < 1
+   * indicate improved locality; 1.0 is returned for empty grids).
+   */
+  double CompactPointStorage();
+
   /**
    * Reset the grid to an empty state and free any memory.
    */
@@ -548,6 +572,10 @@ protected:
 
   void ReportReferences(vtkGarbageCollector*) override;
 
+  // Return the links as editable vtkCellLinks, materializing them from the
+  // read-only static links if needed (see BuildLinks()).
+  vtkCellLinks* GetEditableLinks();
+
   // Points derived from vtkPointSet.
   // Attribute data (i.e., point and cell data (i.e., scalars, vectors, normals, tcoords)
   // derived from vtkDataSet.
@@ -569,6 +597,16 @@ protected:
   // updated so we can compare it to the modified time of the Types array.
   vtkMTimeType DistinctCellTypesUpdateMTime;
 
+  // Lazily computed histogram of the Types array (256 bins), cached with the
+  // same MTime convention as DistinctCellTypes. See UpdateCellTypeHistogram().
+  std::vector<vtkIdType> CellTypeHistogram;
+  vtkMTimeType CellTypeHistogramUpdateMTime;
+
+  /**
+   * Ensure the cell-type histogram is up to date with the Types array.
+   */
+  void UpdateCellTypeHistogram();
+
   /**
    *  Special support for polyhedra/cells with explicit face representations.
    * The Faces class represents polygonal faces using a vtkCellArray structure.
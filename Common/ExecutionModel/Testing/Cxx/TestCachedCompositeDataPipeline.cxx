@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkCachedCompositeDataPipeline.h"
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+
+namespace
+{
+
+// A filter whose output depends on a single printed parameter, counting
+// how often it actually executes.
+class vtkScaledValuesFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkScaledValuesFilter* New();
+  vtkTypeMacro(vtkScaledValuesFilter, vtkPolyDataAlgorithm);
+
+  vtkSetMacro(Scale, double);
+  vtkGetMacro(Scale, double);
+
+  void PrintSelf(ostream& os, vtkIndent indent) override
+  {
+    this->Superclass::PrintSelf(os, indent);
+    os << indent << "Scale: " << this->Scale << "\n";
+  }
+
+  int ExecutionCount = 0;
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    output->CopyStructure(input);
+
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("ScaledValues");
+    values->SetNumberOfTuples(input->GetNumberOfPoints());
+    for (vtkIdType i = 0; i < input->GetNumberOfPoints(); ++i)
+    {
+      values->SetValue(i, this->Scale * static_cast<double>(i));
+    }
+    output->GetPointData()->AddArray(values);
+
+    this->ExecutionCount++;
+    return 1;
+  }
+
+  double Scale = 1.0;
+};
+
+vtkStandardNewMacro(vtkScaledValuesFilter);
+
+//------------------------------------------------------------------------------
+bool CheckScale(vtkScaledValuesFilter* filter, double expectedScale, int expectedExecutions)
+{
+  vtkDoubleArray* values = vtkDoubleArray::SafeDownCast(
+    filter->GetOutput()->GetPointData()->GetArray("ScaledValues"));
+  if (!values || values->GetNumberOfTuples() < 2)
+  {
+    std::cerr << "Missing ScaledValues array" << std::endl;
+    return false;
+  }
+  if (values->GetValue(1) != expectedScale)
+  {
+    std::cerr << "Expected scaled value " << expectedScale << ", got " << values->GetValue(1)
+              << std::endl;
+    return false;
+  }
+  if (filter->ExecutionCount != expectedExecutions)
+  {
+    std::cerr << "Expected " << expectedExecutions << " executions, got "
+              << filter->ExecutionCount << std::endl;
+    return false;
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+int TestCachedCompositeDataPipeline(int, char*[])
+{
+  vtkCachedCompositeDataPipeline::ClearCache();
+
+  vtkNew<vtkPoints> points;
+  for (vtkIdType i = 0; i < 10; ++i)
+  {
+    points->InsertNextPoint(static_cast<double>(i), 0.0, 0.0);
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+
+  vtkNew<vtkScaledValuesFilter> filter;
+  vtkNew<vtkCachedCompositeDataPipeline> executive;
+  filter->SetExecutive(executive);
+  filter->SetInputData(input);
+
+  // First execution populates the cache.
+  filter->SetScale(1.0);
+  filter->Update();
+  if (!CheckScale(filter, 1.0, 1))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // An unchanged pipeline does not even reach the executive's cache.
+  filter->Update();
+  if (!CheckScale(filter, 1.0, 1))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // A new parameter value executes and caches a second entry.
+  filter->SetScale(2.0);
+  filter->Update();
+  if (!CheckScale(filter, 2.0, 2))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Reverting the parameter must restore from the cache, not re-execute.
+  filter->SetScale(1.0);
+  filter->Update();
+  if (!CheckScale(filter, 1.0, 2))
+  {
+    return EXIT_FAILURE;
+  }
+  if (vtkCachedCompositeDataPipeline::GetCacheMemorySize() == 0)
+  {
+    std::cerr << "Cache reports no memory in use" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Restored outputs carry a content key so downstream caches can chain.
+  if (!filter->GetOutput()->GetInformation()->Has(
+        vtkCachedCompositeDataPipeline::DATA_CONTENT_KEY()))
+  {
+    std::cerr << "Restored output has no content key" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // After clearing the cache a revisited state executes again.
+  vtkCachedCompositeDataPipeline::ClearCache();
+  if (vtkCachedCompositeDataPipeline::GetCacheMemorySize() != 0)
+  {
+    std::cerr << "Cache not empty after ClearCache" << std::endl;
+    return EXIT_FAILURE;
+  }
+  filter->SetScale(2.0);
+  filter->Update();
+  if (!CheckScale(filter, 2.0, 3))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // A zero budget disables caching: the reverted state executes once more.
+  unsigned long long previousLimit = vtkCachedCompositeDataPipeline::GetCacheMemoryLimit();
+  vtkCachedCompositeDataPipeline::SetCacheMemoryLimit(0);
+  filter->SetScale(1.0);
+  filter->Update();
+  bool ok = CheckScale(filter, 1.0, 4);
+  vtkCachedCompositeDataPipeline::SetCacheMemoryLimit(previousLimit);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
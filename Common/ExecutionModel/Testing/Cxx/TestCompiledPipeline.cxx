@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkCompiledPipeline.h"
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+
+namespace
+{
+
+// A source producing a single value per step, counting every pipeline pass
+// it receives.
+class vtkStepSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkStepSource* New();
+  vtkTypeMacro(vtkStepSource, vtkPolyDataAlgorithm);
+
+  void SetValue(double value)
+  {
+    this->Value = value;
+    this->Modified();
+  }
+
+  int InformationCount = 0;
+  int UpdateExtentCount = 0;
+  int DataCount = 0;
+
+protected:
+  vtkStepSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override
+  {
+    ++this->InformationCount;
+    return 1;
+  }
+
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override
+  {
+    ++this->UpdateExtentCount;
+    return 1;
+  }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    ++this->DataCount;
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    vtkNew<vtkPoints> points;
+    points->InsertNextPoint(0.0, 0.0, 0.0);
+    output->SetPoints(points);
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("values");
+    values->InsertNextValue(this->Value);
+    output->GetPointData()->AddArray(values);
+    return 1;
+  }
+
+  double Value = 0.0;
+};
+
+vtkStandardNewMacro(vtkStepSource);
+
+//------------------------------------------------------------------------------
+// A filter that adds one to the value, counting every pipeline pass.
+class vtkAddOneFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkAddOneFilter* New();
+  vtkTypeMacro(vtkAddOneFilter, vtkPolyDataAlgorithm);
+
+  int InformationCount = 0;
+  int UpdateExtentCount = 0;
+  int DataCount = 0;
+
+protected:
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override
+  {
+    ++this->InformationCount;
+    return 1;
+  }
+
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override
+  {
+    ++this->UpdateExtentCount;
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    ++this->DataCount;
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    output->ShallowCopy(input);
+    vtkDoubleArray* inValues =
+      vtkDoubleArray::SafeDownCast(input->GetPointData()->GetArray("values"));
+    vtkNew<vtkDoubleArray> outValues;
+    outValues->SetName("values");
+    outValues->InsertNextValue(inValues->GetValue(0) + 1.0);
+    output->GetPointData()->AddArray(outValues);
+    return 1;
+  }
+};
+
+vtkStandardNewMacro(vtkAddOneFilter);
+
+//------------------------------------------------------------------------------
+double GetOutputValue(vtkAlgorithm* sink)
+{
+  vtkPolyData* output = vtkPolyData::SafeDownCast(sink->GetOutputDataObject(0));
+  return vtkDoubleArray::SafeDownCast(output->GetPointData()->GetArray("values"))->GetValue(0);
+}
+
+}
+
+//------------------------------------------------------------------------------
+int TestCompiledPipeline(int, char*[])
+{
+  vtkNew<vtkStepSource> source;
+  vtkNew<vtkAddOneFilter> middle;
+  vtkNew<vtkAddOneFilter> sink;
+  middle->SetInputConnection(source->GetOutputPort());
+  sink->SetInputConnection(middle->GetOutputPort());
+
+  vtkCompiledPipeline::InstallUpstream(sink);
+  vtkCompiledPipeline* executive = vtkCompiledPipeline::SafeDownCast(sink->GetExecutive());
+  if (!executive)
+  {
+    std::cerr << "InstallUpstream did not install the executive on the sink" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // First update runs the full negotiation and compiles the schedule.
+  source->SetValue(1.0);
+  sink->Update();
+  if (!executive->GetCompiled())
+  {
+    std::cerr << "Pipeline was not compiled after the first update" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (GetOutputValue(sink) != 3.0)
+  {
+    std::cerr << "Wrong result from the first update: " << GetOutputValue(sink) << std::endl;
+    return EXIT_FAILURE;
+  }
+  int frozenInformationCount = source->InformationCount + middle->InformationCount;
+  int frozenUpdateExtentCount = source->UpdateExtentCount + middle->UpdateExtentCount;
+
+  // Replayed steps re-execute the data pass but skip the negotiation.
+  for (int step = 2; step <= 5; ++step)
+  {
+    source->SetValue(static_cast<double>(step));
+    sink->Update();
+    if (GetOutputValue(sink) != static_cast<double>(step) + 2.0)
+    {
+      std::cerr << "Wrong result at step " << step << ": " << GetOutputValue(sink) << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (source->DataCount != 5 || middle->DataCount != 5 || sink->DataCount != 5)
+  {
+    std::cerr << "Replayed steps did not re-execute the filters" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (source->InformationCount + middle->InformationCount != frozenInformationCount ||
+    source->UpdateExtentCount + middle->UpdateExtentCount != frozenUpdateExtentCount)
+  {
+    std::cerr << "Replayed steps ran the negotiation passes" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // An update without changes executes nothing.
+  sink->Update();
+  if (source->DataCount != 5 || sink->DataCount != 5)
+  {
+    std::cerr << "Unchanged replay re-executed the pipeline" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Flagging a structural change restores the full negotiation once.
+  executive->MarkStructureModified();
+  source->SetValue(9.0);
+  sink->Update();
+  if (GetOutputValue(sink) != 11.0)
+  {
+    std::cerr << "Wrong result after recompilation: " << GetOutputValue(sink) << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!executive->GetCompiled())
+  {
+    std::cerr << "Pipeline was not recompiled after a structural change" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (source->UpdateExtentCount + middle->UpdateExtentCount <= frozenUpdateExtentCount)
+  {
+    std::cerr << "Full negotiation did not run after MarkStructureModified" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
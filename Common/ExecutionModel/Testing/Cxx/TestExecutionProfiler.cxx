@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkExecutionProfiler.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+
+#include <sstream>
+#include <string>
+
+namespace
+{
+
+class vtkProfiledSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkProfiledSource* New();
+  vtkTypeMacro(vtkProfiledSource, vtkPolyDataAlgorithm);
+
+protected:
+  vtkProfiledSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector* outVector) override
+  {
+    vtkPolyData* output = vtkPolyData::GetData(outVector);
+    output->Initialize();
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkProfiledSource);
+
+} // end anonymous namespace
+
+int TestExecutionProfiler(int, char*[])
+{
+  // with the profiler off, updates must record nothing
+  vtkExecutionProfiler::Reset();
+  vtkNew<vtkProfiledSource> silentSource;
+  silentSource->Update();
+  if (vtkExecutionProfiler::GetNumberOfEvents() != 0)
+  {
+    std::cerr << "Events were recorded while the profiler was disabled." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // with the profiler on, one event per forwarded request is expected:
+  // at least data object, information, update extent and data passes
+  vtkExecutionProfiler::SetEnabled(true);
+  vtkNew<vtkProfiledSource> source;
+  source->Update();
+  vtkExecutionProfiler::SetEnabled(false);
+
+  vtkIdType numEvents = vtkExecutionProfiler::GetNumberOfEvents();
+  if (numEvents < 4)
+  {
+    std::cerr << "Expected at least 4 recorded events, got " << numEvents << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::ostringstream trace;
+  if (!vtkExecutionProfiler::WriteChromeTrace(trace))
+  {
+    std::cerr << "WriteChromeTrace failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string traceText = trace.str();
+  if (traceText.find("\"traceEvents\"") == std::string::npos ||
+    traceText.find("vtkProfiledSource") == std::string::npos ||
+    traceText.find("REQUEST_DATA") == std::string::npos)
+  {
+    std::cerr << "Chrome trace output is missing expected content:\n" << traceText << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkExecutionProfiler::Reset();
+  if (vtkExecutionProfiler::GetNumberOfEvents() != 0)
+  {
+    std::cerr << "Reset did not discard the recorded events." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
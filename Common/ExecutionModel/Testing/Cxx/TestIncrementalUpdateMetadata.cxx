@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkInformation.h"
+#include "vtkInformationIdTypeVectorKey.h"
+#include "vtkInformationStringVectorKey.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+namespace
+{
+
+// A source that regenerates a small range of its output per execution and
+// records that range as modified-region metadata.
+class vtkDeltaSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkDeltaSource* New();
+  vtkTypeMacro(vtkDeltaSource, vtkPolyDataAlgorithm);
+
+protected:
+  vtkDeltaSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    vtkNew<vtkPoints> points;
+    for (vtkIdType i = 0; i < 10; ++i)
+    {
+      points->InsertNextPoint(static_cast<double>(i), 0.0, 0.0);
+    }
+    output->SetPoints(points);
+
+    vtkInformation* dataInfo = output->GetInformation();
+    vtkIdType range[2] = { 5, 9 };
+    vtkStreamingDemandDrivenPipeline::MODIFIED_ID_RANGES()->Set(dataInfo, range, 2);
+    vtkStreamingDemandDrivenPipeline::MODIFIED_ARRAYS()->Append(dataInfo, "values");
+    return 1;
+  }
+};
+
+vtkStandardNewMacro(vtkDeltaSource);
+
+//------------------------------------------------------------------------------
+// A passthrough that does not understand deltas; the executive must strip
+// the metadata from its output.
+class vtkFullRecomputeFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkFullRecomputeFilter* New();
+  vtkTypeMacro(vtkFullRecomputeFilter, vtkPolyDataAlgorithm);
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPolyData::GetData(outputVector)->ShallowCopy(vtkPolyData::GetData(inputVector[0]));
+    return 1;
+  }
+};
+
+vtkStandardNewMacro(vtkFullRecomputeFilter);
+
+//------------------------------------------------------------------------------
+// A filter that declares incremental support, consumes its input's ranges
+// and forwards the metadata to its output.
+class vtkIncrementalFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkIncrementalFilter* New();
+  vtkTypeMacro(vtkIncrementalFilter, vtkPolyDataAlgorithm);
+
+  vtkIdType SeenRange[2] = { -1, -1 };
+
+protected:
+  int FillOutputPortInformation(int port, vtkInformation* info) override
+  {
+    info->Set(vtkStreamingDemandDrivenPipeline::INCREMENTAL_UPDATE_SUPPORTED(), 1);
+    return this->Superclass::FillOutputPortInformation(port, info);
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    output->ShallowCopy(input);
+
+    vtkInformation* inDataInfo = input->GetInformation();
+    if (inDataInfo->Has(vtkStreamingDemandDrivenPipeline::MODIFIED_ID_RANGES()))
+    {
+      vtkStreamingDemandDrivenPipeline::MODIFIED_ID_RANGES()->Get(inDataInfo, this->SeenRange);
+      vtkStreamingDemandDrivenPipeline::MODIFIED_ID_RANGES()->Set(
+        output->GetInformation(), this->SeenRange, 2);
+    }
+    return 1;
+  }
+};
+
+vtkStandardNewMacro(vtkIncrementalFilter);
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+int TestIncrementalUpdateMetadata(int, char*[])
+{
+  vtkNew<vtkDeltaSource> source;
+  vtkNew<vtkFullRecomputeFilter> fullFilter;
+  fullFilter->SetInputConnection(source->GetOutputPort());
+  vtkNew<vtkIncrementalFilter> incrementalFilter;
+  incrementalFilter->SetInputConnection(source->GetOutputPort());
+
+  fullFilter->Update();
+  incrementalFilter->Update();
+
+  // The producer's metadata survives its own execution.
+  vtkInformation* sourceInfo = source->GetOutput()->GetInformation();
+  if (!sourceInfo->Has(vtkStreamingDemandDrivenPipeline::MODIFIED_ID_RANGES()) ||
+    !sourceInfo->Has(vtkStreamingDemandDrivenPipeline::MODIFIED_ARRAYS()))
+  {
+    std::cerr << "Source lost its modified-region metadata" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (vtkStreamingDemandDrivenPipeline::MODIFIED_ARRAYS()->Get(sourceInfo, 0) !=
+    std::string("values"))
+  {
+    std::cerr << "Wrong modified array name" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The non-incremental filter's output must carry no stale metadata.
+  if (fullFilter->GetOutput()->GetInformation()->Has(
+        vtkStreamingDemandDrivenPipeline::MODIFIED_ID_RANGES()))
+  {
+    std::cerr << "Executive did not strip metadata from a non-incremental filter" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The incremental filter saw the producer's ranges and forwarded them.
+  if (incrementalFilter->SeenRange[0] != 5 || incrementalFilter->SeenRange[1] != 9)
+  {
+    std::cerr << "Incremental filter saw range [" << incrementalFilter->SeenRange[0] << ", "
+              << incrementalFilter->SeenRange[1] << "]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!incrementalFilter->GetOutput()->GetInformation()->Has(
+        vtkStreamingDemandDrivenPipeline::MODIFIED_ID_RANGES()))
+  {
+    std::cerr << "Incremental filter's metadata was stripped" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
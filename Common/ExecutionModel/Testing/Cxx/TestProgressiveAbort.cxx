@@ -0,0 +1,190 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkAbortToken.h"
+#include "vtkCallbackCommand.h"
+#include "vtkCommand.h"
+#include "vtkInformation.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+
+namespace
+{
+
+constexpr vtkIdType NumberOfIterations = 100000;
+
+//------------------------------------------------------------------------------
+// A filter polling a vtkAbortToken from inside a vtkSMPTools loop.
+class vtkTokenLoopFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTokenLoopFilter* New();
+  vtkTypeMacro(vtkTokenLoopFilter, vtkPolyDataAlgorithm);
+
+  std::atomic<vtkIdType> ProcessedCount{ 0 };
+
+protected:
+  vtkTokenLoopFilter() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override
+  {
+    vtkAbortToken token(this, 100);
+    vtkSMPTools::For(0, NumberOfIterations, [&token, this](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        if (token.IsAborted())
+        {
+          break;
+        }
+        ++this->ProcessedCount;
+      }
+    });
+    return 1;
+  }
+};
+
+vtkStandardNewMacro(vtkTokenLoopFilter);
+
+//------------------------------------------------------------------------------
+// A source emitting its output in chunks, with a checkpoint after each.
+class vtkCheckpointSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkCheckpointSource* New();
+  vtkTypeMacro(vtkCheckpointSource, vtkPolyDataAlgorithm);
+
+  static constexpr int NumberOfChunks = 5;
+  static constexpr int PointsPerChunk = 10;
+
+protected:
+  vtkCheckpointSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    vtkNew<vtkPoints> points;
+    output->SetPoints(points);
+    for (int chunk = 0; chunk < NumberOfChunks; ++chunk)
+    {
+      for (int i = 0; i < PointsPerChunk; ++i)
+      {
+        points->InsertNextPoint(static_cast<double>(chunk), static_cast<double>(i), 0.0);
+      }
+      if (this->EmitPartialResult(static_cast<double>(chunk + 1) / NumberOfChunks))
+      {
+        break;
+      }
+    }
+    return 1;
+  }
+};
+
+vtkStandardNewMacro(vtkCheckpointSource);
+
+//------------------------------------------------------------------------------
+struct CheckpointObserver
+{
+  vtkCheckpointSource* Source = nullptr;
+  int EventCount = 0;
+  vtkIdType LastPointCount = 0;
+  bool Monotonic = true;
+  int AbortAtCheckpoint = 0; // 0 disables aborting
+
+  static void Callback(vtkObject* caller, unsigned long, void* clientData, void*)
+  {
+    auto* self = static_cast<CheckpointObserver*>(clientData);
+    ++self->EventCount;
+    vtkIdType pointCount = vtkPolyDataAlgorithm::SafeDownCast(caller)
+                             ->GetPolyDataOutput()
+                             ->GetPoints()
+                             ->GetNumberOfPoints();
+    self->Monotonic = self->Monotonic && pointCount > self->LastPointCount;
+    self->LastPointCount = pointCount;
+    if (self->AbortAtCheckpoint && self->EventCount == self->AbortAtCheckpoint)
+    {
+      self->Source->SetAbortExecuteAndUpdateTime();
+    }
+  }
+};
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+int TestProgressiveAbort(int, char*[])
+{
+  // An abort observed through the token stops the threaded loop early.
+  vtkNew<vtkTokenLoopFilter> loopFilter;
+  loopFilter->SetAbortExecuteAndUpdateTime();
+  loopFilter->Update();
+  if (loopFilter->ProcessedCount >= NumberOfIterations)
+  {
+    std::cerr << "The token did not stop the threaded loop" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!loopFilter->GetOutputInformation(0)->Get(vtkAlgorithm::ABORTED()))
+  {
+    std::cerr << "The token did not feed the ABORTED flag" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Without an abort the loop runs to completion.
+  loopFilter->ProcessedCount = 0;
+  loopFilter->SetAbortExecute(0);
+  loopFilter->Modified();
+  loopFilter->Update();
+  if (loopFilter->ProcessedCount != NumberOfIterations)
+  {
+    std::cerr << "The loop processed " << loopFilter->ProcessedCount << " of "
+              << NumberOfIterations << " iterations" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Each checkpoint publishes a growing partial result.
+  vtkNew<vtkCheckpointSource> source;
+  CheckpointObserver observer;
+  observer.Source = source;
+  vtkNew<vtkCallbackCommand> command;
+  command->SetCallback(CheckpointObserver::Callback);
+  command->SetClientData(&observer);
+  source->AddObserver(vtkCommand::PartialResultEvent, command);
+
+  source->Update();
+  if (observer.EventCount != vtkCheckpointSource::NumberOfChunks || !observer.Monotonic)
+  {
+    std::cerr << "Expected " << vtkCheckpointSource::NumberOfChunks
+              << " growing checkpoints, got " << observer.EventCount << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (source->GetOutput()->GetNumberOfPoints() !=
+    vtkCheckpointSource::NumberOfChunks * vtkCheckpointSource::PointsPerChunk)
+  {
+    std::cerr << "Incomplete output after an unaborted execution" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // An abort raised during a checkpoint stops the source at that chunk.
+  observer.EventCount = 0;
+  observer.LastPointCount = 0;
+  observer.AbortAtCheckpoint = 2;
+  source->Modified();
+  source->Update();
+  if (observer.EventCount != 2)
+  {
+    std::cerr << "The source kept emitting checkpoints after the abort" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!source->GetOutputInformation(0)->Get(vtkAlgorithm::ABORTED()))
+  {
+    std::cerr << "ABORTED flag is not set after an abort at a checkpoint" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAbortToken.h"
+
+#include "vtkAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+vtkAbortToken::vtkAbortToken(vtkAlgorithm* algorithm, vtkIdType checkInterval)
+  : Algorithm(algorithm)
+  , CheckInterval(checkInterval > 0 ? checkInterval : 1)
+  , Counter(0)
+  , Aborted(false)
+  , Checking(false)
+{
+}
+
+//------------------------------------------------------------------------------
+bool vtkAbortToken::Check()
+{
+  if (this->Aborted.load(std::memory_order_relaxed))
+  {
+    return true;
+  }
+  if (!this->Algorithm)
+  {
+    return false;
+  }
+
+  // The upstream walk is not safe to run concurrently with itself; let
+  // one thread perform it and the others read the last published state.
+  bool expected = false;
+  if (!this->Checking.compare_exchange_strong(expected, true, std::memory_order_acquire))
+  {
+    return this->Aborted.load(std::memory_order_relaxed);
+  }
+  if (this->Algorithm->CheckAbort())
+  {
+    this->Aborted.store(true, std::memory_order_relaxed);
+  }
+  this->Checking.store(false, std::memory_order_release);
+  return this->Aborted.load(std::memory_order_relaxed);
+}
+
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkAbortToken
+ * @brief   cheap cooperative cancellation check for tight and threaded loops
+ *
+ * vtkAlgorithm::CheckAbort walks the pipeline upstream, so filters only
+ * call it every few thousand iterations and, inside vtkSMPTools functors,
+ * only from the single thread, re-implementing the same stride-and-flag
+ * boilerplate each time. A vtkAbortToken captures an algorithm before the
+ * loop and makes the per-iteration check a relaxed atomic load:
+ * IsAborted() runs the full CheckAbort walk only every CheckInterval
+ * calls, lets a single thread perform the walk while the others keep
+ * going, and publishes the sticky result to every thread polling the
+ * token.
+ *
+ * @code
+ * vtkAbortToken token(this, numCells / 10 + 1);
+ * vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+ *   for (vtkIdType cellId = begin; cellId < end; ++cellId)
+ *   {
+ *     if (token.IsAborted())
+ *     {
+ *       break;
+ *     }
+ *     // process cellId
+ *   }
+ * });
+ * @endcode
+ *
+ * The token is valid for one execution of the algorithm; construct a new
+ * one in each RequestData.
+ *
+ * @sa
+ * vtkAlgorithm vtkSMPTools
+ */
+
+#ifndef vtkAbortToken_h
+#define vtkAbortToken_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkType.h"                       // For vtkIdType
+
+#include <atomic> // For the shared abort state
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkAbortToken
+{
+public:
+  /**
+   * Create a token polling the abort state of the given algorithm. The
+   * full CheckAbort walk runs once every checkInterval IsAborted calls;
+   * the calls in between are a single atomic load.
+   */
+  vtkAbortToken(vtkAlgorithm* algorithm, vtkIdType checkInterval = 1000);
+
+  /**
+   * Whether an abort has been observed. Callable from any thread, cheap
+   * enough for per-iteration use. Once true it stays true.
+   */
+  bool IsAborted()
+  {
+    if (this->Aborted.load(std::memory_order_relaxed))
+    {
+      return true;
+    }
+    if (this->Counter.fetch_add(1, std::memory_order_relaxed) % this->CheckInterval == 0)
+    {
+      return this->Check();
+    }
+    return false;
+  }
+
+  /**
+   * Run the full CheckAbort walk now, regardless of the interval. Only
+   * one thread performs the walk at a time; a thread finding the walk in
+   * progress returns the last published state instead of blocking.
+   */
+  bool Check();
+
+private:
+  vtkAbortToken(const vtkAbortToken&) = delete;
+  void operator=(const vtkAbortToken&) = delete;
+
+  vtkAlgorithm* Algorithm;
+  vtkIdType CheckInterval;
+  std::atomic<vtkIdType> Counter;
+  std::atomic<bool> Aborted;
+  std::atomic<bool> Checking;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
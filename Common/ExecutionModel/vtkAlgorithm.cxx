@@ -210,6 +210,15 @@ bool vtkAlgorithm::CheckAbort()
   return this->AbortOutput;
 }
 
+//------------------------------------------------------------------------------
+// Publish a partial result at a checkpoint, then poll the abort state.
+bool vtkAlgorithm::EmitPartialResult(double progress)
+{
+  this->UpdateProgress(progress);
+  this->InvokeEvent(vtkCommand::PartialResultEvent, static_cast<void*>(&progress));
+  return this->CheckAbort();
+}
+
 //------------------------------------------------------------------------------
 // Set AbortExecute flag and update LastAbortTime.
 void vtkAlgorithm::SetAbortExecuteAndUpdateTime()
@@ -218,6 +218,17 @@ public:
    */
   bool CheckAbort();
 
+  /**
+   * Declare a checkpoint at which the algorithm's outputs hold a
+   * consistent partial result. Updates the progress to the given value,
+   * invokes vtkCommand::PartialResultEvent so observers can display the
+   * partial outputs early, then polls CheckAbort and returns its result
+   * so the algorithm can stop at the checkpoint. Must be called from the
+   * thread executing the algorithm, between checkpoints the outputs are
+   * owned by the algorithm again.
+   */
+  bool EmitPartialResult(double progress);
+
   ///@{
   /**
    * Set/get a Container algorithm for this algorithm. Allows this algorithm
@@ -0,0 +1,343 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCachedCompositeDataPipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkInformationIdTypeKey.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkCachedCompositeDataPipeline);
+vtkInformationKeyMacro(vtkCachedCompositeDataPipeline, DATA_CONTENT_KEY, IdType);
+VTK_ABI_NAMESPACE_END
+
+namespace
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+// 64-bit FNV-1a, used to combine class name, parameter digest and input
+// content keys into the cache key.
+constexpr vtkTypeUInt64 FnvOffset = 14695981039346656037ULL;
+constexpr vtkTypeUInt64 FnvPrime = 1099511628211ULL;
+
+vtkTypeUInt64 HashBytes(vtkTypeUInt64 hash, const void* data, size_t size)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < size; ++i)
+  {
+    hash = (hash ^ bytes[i]) * FnvPrime;
+  }
+  return hash;
+}
+
+vtkTypeUInt64 HashValue(vtkTypeUInt64 hash, vtkTypeUInt64 value)
+{
+  return HashBytes(hash, &value, sizeof(value));
+}
+
+//------------------------------------------------------------------------------
+// Serialize the algorithm's parameter state through PrintSelf, dropping the
+// lines that change without affecting the produced data: modified times,
+// progress, reference counts and printed object addresses.
+bool LineIsVolatile(const std::string& line)
+{
+  static const char* patterns[] = { "Modified Time", "Reference Count", "Registered Events",
+    "Progress", "ErrorCode", "Executive", "Information", "Debug", "0x" };
+  for (const char* pattern : patterns)
+  {
+    if (line.find(pattern) != std::string::npos)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string ParameterDigest(vtkAlgorithm* algorithm)
+{
+  std::ostringstream state;
+  algorithm->PrintSelf(state, vtkIndent());
+
+  std::istringstream lines(state.str());
+  std::string digest;
+  std::string line;
+  while (std::getline(lines, line))
+  {
+    if (!LineIsVolatile(line))
+    {
+      digest += line;
+      digest += '\n';
+    }
+  }
+  return digest;
+}
+
+//====================== Process-wide memoization cache ========================
+struct CacheEntry
+{
+  std::vector<vtkSmartPointer<vtkDataObject>> Outputs;
+  unsigned long long KibiBytes = 0;
+  std::list<vtkTypeUInt64>::iterator LruPosition;
+};
+
+struct PipelineCache
+{
+  std::mutex Mutex;
+  std::map<vtkTypeUInt64, CacheEntry> Entries;
+  // Most recently used keys are at the front.
+  std::list<vtkTypeUInt64> Lru;
+  unsigned long long KibiBytes = 0;
+  unsigned long long Limit = 512 * 1024; // 512 MiB
+
+  // The caller must hold Mutex for all of these.
+  void Touch(CacheEntry& entry)
+  {
+    this->Lru.splice(this->Lru.begin(), this->Lru, entry.LruPosition);
+  }
+
+  void TrimToLimit()
+  {
+    while (this->KibiBytes > this->Limit && !this->Lru.empty())
+    {
+      auto entry = this->Entries.find(this->Lru.back());
+      this->KibiBytes -= entry->second.KibiBytes;
+      this->Entries.erase(entry);
+      this->Lru.pop_back();
+    }
+  }
+};
+
+PipelineCache& GetCache()
+{
+  static PipelineCache cache;
+  return cache;
+}
+
+VTK_ABI_NAMESPACE_END
+} // anonymous namespace
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::vtkCachedCompositeDataPipeline() = default;
+
+//------------------------------------------------------------------------------
+vtkCachedCompositeDataPipeline::~vtkCachedCompositeDataPipeline() = default;
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "CacheMemoryLimit: " << vtkCachedCompositeDataPipeline::GetCacheMemoryLimit()
+     << " KiB\n";
+  os << indent << "CacheMemorySize: " << vtkCachedCompositeDataPipeline::GetCacheMemorySize()
+     << " KiB\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::SetCacheMemoryLimit(unsigned long long limit)
+{
+  PipelineCache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.Limit = limit;
+  cache.TrimToLimit();
+}
+
+//------------------------------------------------------------------------------
+unsigned long long vtkCachedCompositeDataPipeline::GetCacheMemoryLimit()
+{
+  PipelineCache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  return cache.Limit;
+}
+
+//------------------------------------------------------------------------------
+unsigned long long vtkCachedCompositeDataPipeline::GetCacheMemorySize()
+{
+  PipelineCache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  return cache.KibiBytes;
+}
+
+//------------------------------------------------------------------------------
+void vtkCachedCompositeDataPipeline::ClearCache()
+{
+  PipelineCache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.Entries.clear();
+  cache.Lru.clear();
+  cache.KibiBytes = 0;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeUInt64 vtkCachedCompositeDataPipeline::ComputeCacheKey(vtkInformationVector** inInfoVec)
+{
+  // Sources depend on state the parameter digest cannot see (files on
+  // disk, generators); never cache them.
+  if (this->Algorithm->GetTotalNumberOfInputConnections() == 0)
+  {
+    return 0;
+  }
+
+  vtkTypeUInt64 key = FnvOffset;
+
+  const char* className = this->Algorithm->GetClassName();
+  key = HashBytes(key, className, strlen(className));
+
+  std::string digest = ParameterDigest(this->Algorithm);
+  key = HashBytes(key, digest.data(), digest.size());
+
+  // Mix in the content of every input. Data that was itself restored or
+  // recorded by a caching executive carries a content key; anything else
+  // is identified by object identity and modified time, which is exact
+  // but never matches across regenerations.
+  for (int port = 0; port < this->Algorithm->GetNumberOfInputPorts(); ++port)
+  {
+    for (int index = 0; index < inInfoVec[port]->GetNumberOfInformationObjects(); ++index)
+    {
+      vtkInformation* inInfo = inInfoVec[port]->GetInformationObject(index);
+      vtkDataObject* input = inInfo->Get(vtkDataObject::DATA_OBJECT());
+      if (!input)
+      {
+        return 0;
+      }
+      vtkInformation* dataInfo = input->GetInformation();
+      if (dataInfo->Has(vtkCachedCompositeDataPipeline::DATA_CONTENT_KEY()))
+      {
+        key = HashValue(key,
+          static_cast<vtkTypeUInt64>(
+            dataInfo->Get(vtkCachedCompositeDataPipeline::DATA_CONTENT_KEY())));
+      }
+      else
+      {
+        key = HashValue(key, static_cast<vtkTypeUInt64>(reinterpret_cast<std::uintptr_t>(input)));
+        key = HashValue(key, input->GetMTime());
+      }
+    }
+  }
+
+  // The same inputs under a different piece request produce different data.
+  vtkInformation* outInfo = this->GetOutputInformation(0);
+  if (outInfo && outInfo->Has(UPDATE_PIECE_NUMBER()))
+  {
+    key = HashValue(key, static_cast<vtkTypeUInt64>(outInfo->Get(UPDATE_PIECE_NUMBER())));
+    key = HashValue(key, static_cast<vtkTypeUInt64>(outInfo->Get(UPDATE_NUMBER_OF_PIECES())));
+    key = HashValue(key, static_cast<vtkTypeUInt64>(outInfo->Get(UPDATE_NUMBER_OF_GHOST_LEVELS())));
+  }
+  if (outInfo && outInfo->Has(UPDATE_EXTENT()))
+  {
+    int updateExtent[6];
+    outInfo->Get(UPDATE_EXTENT(), updateExtent);
+    key = HashBytes(key, updateExtent, sizeof(updateExtent));
+  }
+
+  // 0 means "do not cache"; remap the (vanishingly unlikely) genuine hash.
+  return key == 0 ? 1 : key;
+}
+
+//------------------------------------------------------------------------------
+int vtkCachedCompositeDataPipeline::ExecuteData(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  PipelineCache& cache = GetCache();
+
+  vtkTypeUInt64 key = 0;
+  if (vtkCachedCompositeDataPipeline::GetCacheMemoryLimit() > 0)
+  {
+    key = this->ComputeCacheKey(inInfoVec);
+  }
+  if (key == 0)
+  {
+    return this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  }
+
+  int numberOfPorts = outInfoVec->GetNumberOfInformationObjects();
+
+  // Restore memoized outputs without executing the algorithm. Only the
+  // lookup runs under the lock; restoring fires pipeline events that may
+  // re-enter another executive.
+  std::vector<vtkSmartPointer<vtkDataObject>> cached;
+  {
+    std::lock_guard<std::mutex> lock(cache.Mutex);
+    auto it = cache.Entries.find(key);
+    if (it != cache.Entries.end() &&
+      static_cast<int>(it->second.Outputs.size()) == numberOfPorts)
+    {
+      cache.Touch(it->second);
+      cached = it->second.Outputs;
+    }
+  }
+  if (!cached.empty())
+  {
+    this->ExecuteDataStart(request, inInfoVec, outInfoVec);
+    for (int port = 0; port < numberOfPorts; ++port)
+    {
+      vtkInformation* outInfo = outInfoVec->GetInformationObject(port);
+      vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+      output->ShallowCopy(cached[port]);
+      output->GetInformation()->Set(vtkCachedCompositeDataPipeline::DATA_CONTENT_KEY(),
+        static_cast<vtkIdType>(HashValue(key, static_cast<vtkTypeUInt64>(port))));
+    }
+    this->ExecuteDataEnd(request, inInfoVec, outInfoVec);
+    return 1;
+  }
+
+  int result = this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+  if (!result)
+  {
+    return result;
+  }
+
+  // Record the freshly generated outputs. Shallow copies share the arrays,
+  // so the entry costs little until the algorithm re-executes and replaces
+  // them; GetActualMemorySize accounts the full data size, which is what
+  // the entry holds once the live output moves on.
+  CacheEntry entry;
+  for (int port = 0; port < numberOfPorts; ++port)
+  {
+    vtkInformation* outInfo = outInfoVec->GetInformationObject(port);
+    vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+    vtkSmartPointer<vtkDataObject> copy = vtkSmartPointer<vtkDataObject>::Take(
+      output->NewInstance());
+    copy->ShallowCopy(output);
+    entry.KibiBytes += static_cast<unsigned long long>(copy->GetActualMemorySize());
+    entry.Outputs.push_back(copy);
+    output->GetInformation()->Set(vtkCachedCompositeDataPipeline::DATA_CONTENT_KEY(),
+      static_cast<vtkIdType>(HashValue(key, static_cast<vtkTypeUInt64>(port))));
+  }
+  // Entries are never free even when the arrays round down to 0 KiB.
+  entry.KibiBytes = entry.KibiBytes > 0 ? entry.KibiBytes : 1;
+
+  {
+    std::lock_guard<std::mutex> lock(cache.Mutex);
+    auto it = cache.Entries.find(key);
+    if (it != cache.Entries.end())
+    {
+      cache.KibiBytes -= it->second.KibiBytes;
+      cache.Lru.erase(it->second.LruPosition);
+      cache.Entries.erase(it);
+    }
+    cache.Lru.push_front(key);
+    entry.LruPosition = cache.Lru.begin();
+    cache.KibiBytes += entry.KibiBytes;
+    cache.Entries[key] = entry;
+    cache.TrimToLimit();
+  }
+
+  return result;
+}
+VTK_ABI_NAMESPACE_END
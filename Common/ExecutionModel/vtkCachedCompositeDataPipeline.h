@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCachedCompositeDataPipeline
+ * @brief   Executive that memoizes filter outputs across executions.
+ *
+ * vtkCachedCompositeDataPipeline extends vtkCompositeDataPipeline with a
+ * process-wide, byte-budgeted memoization cache. Before executing its
+ * algorithm, the executive computes a key from the algorithm's class name,
+ * a digest of its parameter state, and content keys of its inputs. When the
+ * key is found in the cache the stored outputs are shallow copied into the
+ * algorithm's outputs without invoking the algorithm at all; otherwise the
+ * algorithm executes normally and its outputs are recorded under the key.
+ *
+ * This pays off in parameter-sweep scenarios: changing a parameter and
+ * later changing it back raises the algorithm's modified time, so the
+ * standard pipeline re-executes everything downstream even though every
+ * result is identical to one computed earlier. With this executive the
+ * revisited states are restored from the cache instead, and because each
+ * restored output carries its content key, cache hits chain down the
+ * pipeline.
+ *
+ * The parameter digest is built from the algorithm's PrintSelf output with
+ * volatile lines (modified times, progress, addresses) removed, so it only
+ * captures parameters that the algorithm prints. Algorithms that depend on
+ * state outside their printed parameters — readers watching files on disk,
+ * filters using random seeds — should not be assigned this executive.
+ * Algorithms without input connections are never cached for that reason.
+ *
+ * The cache is shared by all instances of this executive and is trimmed to
+ * SetCacheMemoryLimit() kibibytes in least-recently-used order.
+ *
+ * @sa
+ * vtkCompositeDataPipeline vtkCachedStreamingDemandDrivenPipeline
+ */
+
+#ifndef vtkCachedCompositeDataPipeline_h
+#define vtkCachedCompositeDataPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkInformationIdTypeKey;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkCachedCompositeDataPipeline
+  : public vtkCompositeDataPipeline
+{
+public:
+  static vtkCachedCompositeDataPipeline* New();
+  vtkTypeMacro(vtkCachedCompositeDataPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Key placed in the information of generated data objects recording the
+   * cache key of the execution that produced them. Downstream caching
+   * executives use it as the input content key, so a cache hit upstream
+   * enables hits downstream.
+   */
+  static vtkInformationIdTypeKey* DATA_CONTENT_KEY();
+
+  ///@{
+  /**
+   * The memory budget of the process-wide cache in kibibytes (1024 bytes).
+   * When an insertion pushes the cache over the budget, least recently
+   * used entries are discarded until it fits. A limit of 0 disables
+   * caching entirely. The default is 524288 (512 MiB).
+   */
+  static void SetCacheMemoryLimit(unsigned long long limit);
+  static unsigned long long GetCacheMemoryLimit();
+  ///@}
+
+  /**
+   * Return the memory currently held by the cache in kibibytes.
+   */
+  static unsigned long long GetCacheMemorySize();
+
+  /**
+   * Discard all cached results.
+   */
+  static void ClearCache();
+
+protected:
+  vtkCachedCompositeDataPipeline();
+  ~vtkCachedCompositeDataPipeline() override;
+
+  int ExecuteData(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+
+  /**
+   * Compute the cache key for the pending execution, or 0 when the
+   * execution must not be cached.
+   */
+  virtual vtkTypeUInt64 ComputeCacheKey(vtkInformationVector** inInfoVec);
+
+private:
+  vtkCachedCompositeDataPipeline(const vtkCachedCompositeDataPipeline&) = delete;
+  void operator=(const vtkCachedCompositeDataPipeline&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
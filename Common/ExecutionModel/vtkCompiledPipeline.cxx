@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompiledPipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkAlgorithmOutput.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkInformationExecutivePortKey.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+#include <set>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkCompiledPipeline);
+
+//------------------------------------------------------------------------------
+vtkCompiledPipeline::vtkCompiledPipeline()
+{
+  this->Compiled = false;
+  this->CompileFailed = false;
+  this->InReplay = false;
+}
+
+//------------------------------------------------------------------------------
+vtkCompiledPipeline::~vtkCompiledPipeline() = default;
+
+//------------------------------------------------------------------------------
+void vtkCompiledPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Compiled: " << (this->Compiled ? "On" : "Off") << "\n";
+  os << indent << "Schedule Length: " << this->Schedule.size() << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkCompiledPipeline::InstallUpstream(vtkAlgorithm* sink)
+{
+  if (!sink)
+  {
+    return;
+  }
+
+  // Connections are stored in the executives' information objects, so
+  // collect the algorithms and their connections before replacing any
+  // executive, and restore the connections afterwards.
+  struct ConnectionEntry
+  {
+    vtkSmartPointer<vtkAlgorithm> Consumer;
+    int Port;
+    int Index;
+    vtkSmartPointer<vtkAlgorithmOutput> Input;
+  };
+  std::vector<vtkAlgorithm*> algorithms;
+  std::vector<ConnectionEntry> connections;
+  std::set<vtkAlgorithm*> visited;
+
+  algorithms.push_back(sink);
+  visited.insert(sink);
+  for (size_t q = 0; q < algorithms.size(); ++q)
+  {
+    vtkAlgorithm* algorithm = algorithms[q];
+    for (int i = 0; i < algorithm->GetNumberOfInputPorts(); ++i)
+    {
+      for (int j = 0; j < algorithm->GetNumberOfInputConnections(i); ++j)
+      {
+        vtkAlgorithmOutput* input = algorithm->GetInputConnection(i, j);
+        if (!input || !input->GetProducer())
+        {
+          continue;
+        }
+        connections.push_back({ algorithm, i, j, input });
+        if (visited.insert(input->GetProducer()).second)
+        {
+          algorithms.push_back(input->GetProducer());
+        }
+      }
+    }
+  }
+
+  for (vtkAlgorithm* algorithm : algorithms)
+  {
+    if (!vtkCompiledPipeline::SafeDownCast(algorithm->GetExecutive()))
+    {
+      vtkNew<vtkCompiledPipeline> executive;
+      algorithm->SetExecutive(executive);
+    }
+  }
+
+  for (ConnectionEntry& entry : connections)
+  {
+    entry.Consumer->SetNthInputConnection(entry.Port, entry.Index, entry.Input);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCompiledPipeline::MarkStructureModified()
+{
+  this->Compiled = false;
+  this->CompileFailed = false;
+  this->Schedule.clear();
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkCompiledPipeline::Update()
+{
+  return this->Superclass::Update();
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkCompiledPipeline::Update(int port)
+{
+  return this->Update(port, nullptr);
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkCompiledPipeline::Update(int port, vtkInformationVector* requests)
+{
+  if (this->Compiled && !requests)
+  {
+    // an executive expired when part of the pipeline was destroyed; the
+    // caller did not flag it, but a stale schedule must not be replayed
+    bool valid = true;
+    for (const auto& entry : this->Schedule)
+    {
+      if (entry.first.GetPointer() == nullptr)
+      {
+        valid = false;
+        break;
+      }
+    }
+    if (valid)
+    {
+      int result = 1;
+      for (const auto& entry : this->Schedule)
+      {
+        result = result && entry.first->ReplayNode(entry.second);
+      }
+      return result;
+    }
+    this->MarkStructureModified();
+  }
+
+  if (requests)
+  {
+    // per-update requests change the negotiation, so they always take the
+    // full path and invalidate any compiled schedule
+    this->MarkStructureModified();
+    return this->Superclass::Update(port, requests);
+  }
+
+  vtkTypeBool result = this->Superclass::Update(port, nullptr);
+  if (result && !this->Compiled && !this->CompileFailed)
+  {
+    this->Compiled = this->CompileSchedule();
+    if (!this->Compiled)
+    {
+      this->CompileFailed = true;
+    }
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+namespace
+{
+bool CollectSchedule(vtkCompiledPipeline* node, int port, std::set<vtkExecutive*>& visited,
+  std::vector<std::pair<vtkWeakPointer<vtkCompiledPipeline>, int>>& schedule)
+{
+  if (!visited.insert(node).second)
+  {
+    return true;
+  }
+  for (int i = 0; i < node->GetAlgorithm()->GetNumberOfInputPorts(); ++i)
+  {
+    vtkInformationVector* inVec = node->GetInputInformation(i);
+    for (int j = 0; j < inVec->GetNumberOfInformationObjects(); ++j)
+    {
+      vtkInformation* info = inVec->GetInformationObject(j);
+      vtkExecutive* producer = nullptr;
+      int producerPort = 0;
+      vtkExecutive::PRODUCER()->Get(info, producer, producerPort);
+      if (!producer)
+      {
+        continue;
+      }
+      vtkCompiledPipeline* producerNode = vtkCompiledPipeline::SafeDownCast(producer);
+      if (!producerNode || !CollectSchedule(producerNode, producerPort, visited, schedule))
+      {
+        return false;
+      }
+    }
+  }
+  schedule.emplace_back(node, port);
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+bool vtkCompiledPipeline::CompileSchedule()
+{
+  this->Schedule.clear();
+  std::set<vtkExecutive*> visited;
+  std::vector<std::pair<vtkWeakPointer<vtkCompiledPipeline>, int>> schedule;
+  if (!CollectSchedule(this, -1, visited, schedule))
+  {
+    vtkWarningMacro("An upstream algorithm does not use a vtkCompiledPipeline, so "
+                    "updates keep performing the full request negotiation. Use "
+                    "vtkCompiledPipeline::InstallUpstream to install the executive "
+                    "on the whole pipeline.");
+    return false;
+  }
+  this->Schedule = std::move(schedule);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkCompiledPipeline::NeedToReplay()
+{
+  vtkMTimeType dataTime = this->DataTime.GetMTime();
+  if (this->Algorithm->GetMTime() > dataTime)
+  {
+    return true;
+  }
+
+  // released or missing outputs force execution
+  vtkInformationVector* outInfoVec = this->GetOutputInformation();
+  for (int i = 0; i < outInfoVec->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkDataObject* data = outInfoVec->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+    if (!data || data->GetDataReleased())
+    {
+      return true;
+    }
+  }
+
+  // inputs already replayed this cycle, so their data objects are current
+  for (int port = 0; port < this->Algorithm->GetNumberOfInputPorts(); ++port)
+  {
+    vtkInformationVector* inVec = this->GetInputInformation(port);
+    for (int j = 0; j < inVec->GetNumberOfInformationObjects(); ++j)
+    {
+      vtkDataObject* inData = inVec->GetInformationObject(j)->Get(vtkDataObject::DATA_OBJECT());
+      if (!inData || inData->GetMTime() > dataTime)
+      {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+//------------------------------------------------------------------------------
+int vtkCompiledPipeline::NeedToExecuteData(
+  int outputPort, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  // during a replay the pipeline modified time has not been recomputed,
+  // so the decision is based on this node alone
+  if (this->InReplay)
+  {
+    return this->NeedToReplay() ? 1 : 0;
+  }
+  return this->Superclass::NeedToExecuteData(outputPort, inInfoVec, outInfoVec);
+}
+
+//------------------------------------------------------------------------------
+int vtkCompiledPipeline::ReplayNode(int outputPort)
+{
+  // The algorithm should not invoke anything on the executive.
+  if (!this->CheckAlgorithm("ReplayNode", nullptr))
+  {
+    return 0;
+  }
+
+  // run only the data pass; the upstream executives executed earlier in
+  // the schedule and the negotiation passes are frozen
+  if (!this->DataRequest)
+  {
+    this->DataRequest = vtkInformation::New();
+    this->DataRequest->Set(REQUEST_DATA());
+    this->DataRequest->Set(vtkExecutive::FORWARD_DIRECTION(), vtkExecutive::RequestUpstream);
+    this->DataRequest->Set(vtkExecutive::ALGORITHM_AFTER_FORWARD(), 1);
+  }
+  this->DataRequest->Set(FROM_OUTPUT_PORT(), outputPort);
+
+  this->InReplay = true;
+  int result = this->ProcessRequest(
+    this->DataRequest, this->GetInputInformation(), this->GetOutputInformation());
+  this->InReplay = false;
+
+  return result;
+}
+
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCompiledPipeline
+ * @brief   Executive that replays a frozen execution schedule.
+ *
+ * vtkCompiledPipeline extends vtkCompositeDataPipeline for pipelines whose
+ * structure never changes between updates, such as in situ endpoints that
+ * execute the same filter graph for every simulation step. The first
+ * Update() runs the normal request negotiation — data object creation,
+ * information, update extent — and then compiles a flat, topologically
+ * ordered schedule of the upstream executives. Subsequent updates replay
+ * that schedule directly: each executive re-executes its algorithm only
+ * when the algorithm or one of its input data objects has been modified
+ * since its last execution, and the negotiation passes are skipped
+ * entirely.
+ *
+ * Because the negotiation is frozen, changes that would renegotiate
+ * pipeline metadata — connecting or removing filters, changing whole
+ * extents, time steps or piece requests — are not observed until
+ * MarkStructureModified() is called, which forces the next Update() to run
+ * the full negotiation and recompile the schedule. Plain parameter and
+ * data changes are handled by the replay itself through modified times.
+ *
+ * Every algorithm upstream of the sink must use this executive for the
+ * schedule to compile; InstallUpstream() installs it on an algorithm and
+ * everything it depends on. When compilation is not possible the executive
+ * keeps performing full updates.
+ *
+ * @sa
+ * vtkCompositeDataPipeline vtkCachedCompositeDataPipeline
+ */
+
+#ifndef vtkCompiledPipeline_h
+#define vtkCompiledPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+#include "vtkWeakPointer.h" // For the compiled schedule
+
+#include <utility> // For the compiled schedule
+#include <vector>  // For the compiled schedule
+
+VTK_ABI_NAMESPACE_BEGIN
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkCompiledPipeline : public vtkCompositeDataPipeline
+{
+public:
+  static vtkCompiledPipeline* New();
+  vtkTypeMacro(vtkCompiledPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Install a vtkCompiledPipeline as the executive of the given algorithm
+   * and of every algorithm upstream of it. Algorithms that already use a
+   * vtkCompiledPipeline are left untouched.
+   */
+  static void InstallUpstream(vtkAlgorithm* sink);
+
+  ///@{
+  /**
+   * Bring this algorithm's outputs up-to-date. The first successful
+   * update compiles the execution schedule; later updates replay it
+   * without the request negotiation passes.
+   */
+  vtkTypeBool Update() override;
+  vtkTypeBool Update(int port) override;
+  vtkTypeBool Update(int port, vtkInformationVector* requests) override;
+  ///@}
+
+  /**
+   * Declare that the structure of the pipeline has changed: filters were
+   * connected or removed, or requests such as update extents, pieces or
+   * time steps must be renegotiated. The next Update() performs the full
+   * negotiation and recompiles the schedule.
+   */
+  void MarkStructureModified();
+
+  /**
+   * Return whether a compiled schedule is in place and updates are being
+   * replayed without negotiation.
+   */
+  vtkGetMacro(Compiled, bool);
+
+protected:
+  vtkCompiledPipeline();
+  ~vtkCompiledPipeline() override;
+
+  /**
+   * Walk the upstream executives and record them in execution order.
+   * Returns false when an upstream algorithm does not use this executive,
+   * in which case updates keep using the full negotiation.
+   */
+  bool CompileSchedule();
+
+  /**
+   * Run the data pass for this node of the schedule. The algorithm is
+   * invoked only when NeedToReplay says its result is out of date.
+   */
+  int ReplayNode(int outputPort);
+
+  /**
+   * Whether this algorithm or any of its input data objects changed
+   * since the node's last execution.
+   */
+  bool NeedToReplay();
+
+  /**
+   * During a replay the pipeline modified time is stale by design, so
+   * the decision is made from NeedToReplay instead.
+   */
+  int NeedToExecuteData(
+    int outputPort, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec) override;
+
+  // The executives to execute, ordered so that producers come before
+  // their consumers, together with the output port each was compiled for.
+  std::vector<std::pair<vtkWeakPointer<vtkCompiledPipeline>, int>> Schedule;
+
+  bool Compiled;
+  bool CompileFailed;
+  bool InReplay;
+
+private:
+  vtkCompiledPipeline(const vtkCompiledPipeline&) = delete;
+  void operator=(const vtkCompiledPipeline&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
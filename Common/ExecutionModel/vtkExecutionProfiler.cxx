@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkExecutionProfiler.h"
+
+#include "vtkInformation.h"
+#include "vtkInformationIterator.h"
+#include "vtkInformationKey.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkTimerLog.h"
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct vtkProfilerEvent
+{
+  std::string Name;
+  std::string Category;
+  double Start;       // wall-clock seconds
+  double Duration;    // wall-clock seconds
+  double CpuDuration; // CPU seconds
+  std::size_t ThreadId;
+};
+
+// The event log is process wide so that every executive, whichever thread
+// it executes on, feeds the same trace.
+std::vector<vtkProfilerEvent> ProfilerEvents;
+std::mutex ProfilerMutex;
+std::atomic<bool> ProfilerEnabled{ false };
+
+} // end anonymous namespace
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkExecutionProfiler);
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::SetEnabled(bool enabled)
+{
+  ProfilerEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionProfiler::GetEnabled()
+{
+  return ProfilerEnabled.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+double vtkExecutionProfiler::Now()
+{
+  return vtkTimerLog::GetUniversalTime();
+}
+
+//------------------------------------------------------------------------------
+double vtkExecutionProfiler::NowCpu()
+{
+  return vtkTimerLog::GetCPUTime();
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::RecordEvent(
+  const char* name, vtkInformation* request, double startWall, double startCpu)
+{
+  vtkProfilerEvent event;
+  event.Name = name ? name : "(unknown)";
+  event.Category = "Request";
+  if (request)
+  {
+    // the request type is identified by its REQUEST_... key
+    vtkNew<vtkInformationIterator> keyIter;
+    keyIter->SetInformationWeak(request);
+    for (keyIter->InitTraversal(); !keyIter->IsDoneWithTraversal(); keyIter->GoToNextItem())
+    {
+      const char* keyName = keyIter->GetCurrentKey()->GetName();
+      if (keyName && strncmp(keyName, "REQUEST_", 8) == 0)
+      {
+        event.Category = keyName;
+        break;
+      }
+    }
+  }
+  event.Start = startWall;
+  event.Duration = vtkTimerLog::GetUniversalTime() - startWall;
+  event.CpuDuration = vtkTimerLog::GetCPUTime() - startCpu;
+  event.ThreadId = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+  std::lock_guard<std::mutex> lock(ProfilerMutex);
+  ProfilerEvents.push_back(std::move(event));
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::Reset()
+{
+  std::lock_guard<std::mutex> lock(ProfilerMutex);
+  ProfilerEvents.clear();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkExecutionProfiler::GetNumberOfEvents()
+{
+  std::lock_guard<std::mutex> lock(ProfilerMutex);
+  return static_cast<vtkIdType>(ProfilerEvents.size());
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionProfiler::WriteChromeTrace(ostream& os)
+{
+  std::lock_guard<std::mutex> lock(ProfilerMutex);
+
+  // export timestamps relative to the earliest event, in microseconds
+  double timeBase = 0.0;
+  bool first = true;
+  for (const vtkProfilerEvent& event : ProfilerEvents)
+  {
+    if (first || event.Start < timeBase)
+    {
+      timeBase = event.Start;
+      first = false;
+    }
+  }
+
+  // the trace format wants small integral thread ids, not hashes
+  std::map<std::size_t, int> threadIds;
+
+  os << "{\"traceEvents\":[";
+  const char* separator = "";
+  for (const vtkProfilerEvent& event : ProfilerEvents)
+  {
+    int tid =
+      threadIds.emplace(event.ThreadId, static_cast<int>(threadIds.size()) + 1).first->second;
+    os << separator << "{\"name\":\"" << event.Name << "\",\"cat\":\"" << event.Category
+       << "\",\"ph\":\"X\",\"ts\":" << (event.Start - timeBase) * 1.0e6
+       << ",\"dur\":" << event.Duration * 1.0e6 << ",\"pid\":1,\"tid\":" << tid
+       << ",\"args\":{\"cpu_us\":" << event.CpuDuration * 1.0e6 << "}}";
+    separator = ",";
+  }
+  os << "]}\n";
+
+  return os.good();
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionProfiler::WriteChromeTrace(const char* fileName)
+{
+  if (!fileName)
+  {
+    vtkGenericWarningMacro("WriteChromeTrace requires a file name.");
+    return false;
+  }
+  std::ofstream file(fileName);
+  if (!file)
+  {
+    vtkGenericWarningMacro("WriteChromeTrace could not open " << fileName << " for writing.");
+    return false;
+  }
+  return vtkExecutionProfiler::WriteChromeTrace(file);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionProfiler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << (vtkExecutionProfiler::GetEnabled() ? "On" : "Off") << "\n";
+  os << indent << "NumberOfEvents: " << vtkExecutionProfiler::GetNumberOfEvents() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkExecutionProfiler
+ * @brief   Runtime profiler for pipeline execution.
+ *
+ * vtkExecutionProfiler records, while enabled, one event for every request
+ * a vtkExecutive forwards to its algorithm: the algorithm class name, the
+ * request type (REQUEST_DATA, REQUEST_INFORMATION, ...), the wall-clock
+ * start time, and the wall and CPU time the request took. Internal
+ * pipelines updated from inside an outer RequestData show up as events
+ * contained within the outer event, so nesting is preserved. Collection is
+ * off by default and is switched on and off at runtime without rebuilding;
+ * while it is off the hook in vtkExecutive::CallAlgorithm costs a single
+ * flag test.
+ *
+ * The accumulated events can be written with WriteChromeTrace() in the
+ * Chrome trace-event JSON format, which chrome://tracing, Perfetto and
+ * speedscope render as a per-thread flame graph. The CPU time of each
+ * request is attached under the event's args.
+ *
+ * All methods are static and thread safe; events recorded from different
+ * threads carry their thread of origin into the trace.
+ *
+ * @sa
+ * vtkExecutive vtkTimerLog
+ */
+
+#ifndef vtkExecutionProfiler_h
+#define vtkExecutionProfiler_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkInformation;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkExecutionProfiler : public vtkObject
+{
+public:
+  static vtkExecutionProfiler* New();
+  vtkTypeMacro(vtkExecutionProfiler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Turn event collection on or off. Collection is off by default; events
+   * recorded before a disable are kept until Reset() is called.
+   */
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled();
+  ///@}
+
+  ///@{
+  /**
+   * Current wall-clock and CPU time in seconds, the time base recorded
+   * events use. Callers sample these before invoking the work to profile
+   * and hand the values to RecordEvent() afterwards.
+   */
+  static double Now();
+  static double NowCpu();
+  ///@}
+
+  /**
+   * Record one completed event. The request, when given, provides the
+   * event category from its REQUEST_... key. startWall and startCpu are
+   * the values of Now() and NowCpu() sampled before the work started; the
+   * durations are measured against the current time. vtkExecutive calls
+   * this around every request it forwards to its algorithm.
+   */
+  static void RecordEvent(
+    const char* name, vtkInformation* request, double startWall, double startCpu);
+
+  /**
+   * Discard all recorded events.
+   */
+  static void Reset();
+
+  /**
+   * Number of events recorded so far.
+   */
+  static vtkIdType GetNumberOfEvents();
+
+  ///@{
+  /**
+   * Write the recorded events in the Chrome trace-event JSON format, to a
+   * stream or to a file. Returns false when nothing could be written.
+   * Timestamps are exported in microseconds relative to the earliest
+   * recorded event.
+   */
+  static bool WriteChromeTrace(ostream& os);
+  static bool WriteChromeTrace(const char* fileName);
+  ///@}
+
+protected:
+  vtkExecutionProfiler() = default;
+  ~vtkExecutionProfiler() override = default;
+
+private:
+  vtkExecutionProfiler(const vtkExecutionProfiler&) = delete;
+  void operator=(const vtkExecutionProfiler&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
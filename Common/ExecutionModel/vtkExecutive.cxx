@@ -5,6 +5,7 @@
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
 #include "vtkDataObject.h"
+#include "vtkExecutionProfiler.h"
 #include "vtkGarbageCollector.h"
 #include "vtkInformation.h"
 #include "vtkInformationExecutivePortKey.h"
@@ -14,6 +15,7 @@
 #include "vtkInformationKeyVectorKey.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkPerformanceCounters.h"
 #include "vtkSmartPointer.h"
 
 #include <sstream>
@@ -718,10 +720,21 @@ int vtkExecutive::CallAlgorithm(vtkInformation* request, int direction,
   // Copy default information in the direction of information flow.
   this->CopyDefaultInformation(request, direction, inInfo, outInfo);
 
-  // Invoke the request on the algorithm.
+  vtkPerformanceCounters::Add(vtkPerformanceCounters::EXECUTIVE_PASSES, 1);
+
+  // Invoke the request on the algorithm, timing it when the execution
+  // profiler is collecting.
+  const bool profiling = vtkExecutionProfiler::GetEnabled();
+  const double profileWall = profiling ? vtkExecutionProfiler::Now() : 0.0;
+  const double profileCpu = profiling ? vtkExecutionProfiler::NowCpu() : 0.0;
   this->InAlgorithm = 1;
   int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
   this->InAlgorithm = 0;
+  if (profiling)
+  {
+    vtkExecutionProfiler::RecordEvent(
+      this->Algorithm->GetClassName(), request, profileWall, profileCpu);
+  }
 
   // If the algorithm failed report it now.
   if (!result)
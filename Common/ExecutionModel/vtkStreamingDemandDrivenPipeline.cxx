@@ -12,6 +12,7 @@
 #include "vtkInformationDoubleKey.h"
 #include "vtkInformationDoubleVectorKey.h"
 #include "vtkInformationIdTypeKey.h"
+#include "vtkInformationIdTypeVectorKey.h"
 #include "vtkInformationInformationVectorKey.h"
 #include "vtkInformationIntegerKey.h"
 #include "vtkInformationIntegerRequestKey.h"
@@ -20,6 +21,7 @@
 #include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationRequestKey.h"
 #include "vtkInformationStringKey.h"
+#include "vtkInformationStringVectorKey.h"
 #include "vtkInformationUnsignedLongKey.h"
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
@@ -52,6 +54,10 @@ vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, PREVIOUS_UPDATE_TIME_ST
 vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, TIME_RANGE, DoubleVector);
 
 vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, BOUNDS, DoubleVector);
+vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, MODIFIED_BLOCKS, IntegerVector);
+vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, MODIFIED_ARRAYS, StringVector);
+vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, MODIFIED_ID_RANGES, IdTypeVector);
+vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, INCREMENTAL_UPDATE_SUPPORTED, Integer);
 vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, TIME_DEPENDENT_INFORMATION, Integer);
 
 vtkInformationKeyMacro(vtkStreamingDemandDrivenPipeline, NO_PRIOR_TEMPORAL_ACCESS, Integer);
@@ -912,6 +918,23 @@ void vtkStreamingDemandDrivenPipeline ::ExecuteDataStart(
   for (int i = 0; i < numInfo; ++i)
   {
     vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+
+    // An algorithm that does not declare incremental-update support
+    // regenerates its whole output, so modified-region metadata left over
+    // from an earlier execution no longer describes it. Incremental
+    // algorithms refresh the metadata themselves during the execution.
+    if (!this->Algorithm->GetOutputPortInformation(i)->Has(INCREMENTAL_UPDATE_SUPPORTED()))
+    {
+      vtkDataObject* outData = outInfo->Get(vtkDataObject::DATA_OBJECT());
+      if (outData)
+      {
+        vtkInformation* dataInfo = outData->GetInformation();
+        dataInfo->Remove(MODIFIED_BLOCKS());
+        dataInfo->Remove(MODIFIED_ARRAYS());
+        dataInfo->Remove(MODIFIED_ID_RANGES());
+      }
+    }
+
     int numPieces = outInfo->Get(UPDATE_NUMBER_OF_PIECES());
     if (numPieces > 1)
     {
@@ -25,12 +25,13 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkInformationDoubleKey;
 class vtkInformationDoubleVectorKey;
 class vtkInformationIdTypeKey;
+class vtkInformationIdTypeVectorKey;
 class vtkInformationIntegerKey;
 class vtkInformationIntegerVectorKey;
 class vtkInformationIterator;
 class vtkInformationObjectBaseKey;
 class vtkInformationStringKey;
-class vtkInformationStringKey;
+class vtkInformationStringVectorKey;
 class vtkInformationUnsignedLongKey;
 
 class VTKCOMMONEXECUTIONMODEL_EXPORT VTK_MARSHALAUTO vtkStreamingDemandDrivenPipeline
@@ -226,6 +227,33 @@ public:
    */
   static vtkInformationDoubleVectorKey* BOUNDS();
 
+  ///@{
+  /**
+   * Keys a producer may set in the information of its output data object
+   * to record which part of the output actually changed during the last
+   * execution: the flat indices of changed composite blocks, the names of
+   * changed attribute arrays, and changed id ranges stored as
+   * (begin, end) pairs with inclusive ends. Absence of a key means the
+   * whole corresponding aspect may have changed, so consumers must always
+   * fall back to a full update when the metadata is missing.
+   * \ingroup InformationKeys
+   */
+  static vtkInformationIntegerVectorKey* MODIFIED_BLOCKS();
+  static vtkInformationStringVectorKey* MODIFIED_ARRAYS();
+  static vtkInformationIdTypeVectorKey* MODIFIED_ID_RANGES();
+  ///@}
+
+  /**
+   * Key an algorithm sets in its output port information (from
+   * FillOutputPortInformation) to declare that it understands the
+   * modified-region metadata of its inputs and maintains the metadata on
+   * its outputs. For algorithms that do not declare support the executive
+   * removes the metadata from their outputs before each execution, since
+   * a full re-execution invalidates any earlier deltas.
+   * \ingroup InformationKeys
+   */
+  static vtkInformationIntegerKey* INCREMENTAL_UPDATE_SUPPORTED();
+
   /**
    * Key to tell whether the data has all its time steps generated.
    * It is typically used for in situ, where you want to be able to visualize
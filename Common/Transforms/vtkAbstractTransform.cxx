@@ -10,8 +10,10 @@
 #include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 
-#include <mutex> // for std::mutex
+#include <mutex>  // for std::mutex
+#include <vector> // for std::vector
 
 VTK_ABI_NAMESPACE_BEGIN
 
@@ -144,16 +146,26 @@ void vtkAbstractTransform::TransformPoints(vtkPoints* in, vtkPoints* out)
 {
   this->Update();
 
-  double point[3];
-  vtkIdType i;
   vtkIdType n = in->GetNumberOfPoints();
-
-  for (i = 0; i < n; i++)
+  vtkIdType m = out->GetNumberOfPoints();
+  if (n == 0)
   {
-    in->GetPoint(i, point);
-    this->InternalTransformPoint(point, point);
-    out->InsertNextPoint(point);
+    return;
   }
+
+  // presize the output, then transform the points in parallel;
+  // InternalTransformPoint must be reentrant once Update has been called
+  double zero[3] = { 0.0, 0.0, 0.0 };
+  out->InsertPoint(m + n - 1, zero);
+  vtkSMPTools::For(0, n, vtkSMPTools::THRESHOLD, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double point[3];
+    for (; ptId < endPtId; ++ptId)
+    {
+      in->GetPoint(ptId, point);
+      this->InternalTransformPoint(point, point);
+      out->SetPoint(m + ptId, point);
+    }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -170,42 +182,71 @@ void vtkAbstractTransform::TransformPointsNormalsVectors(vtkPoints* inPts, vtkPo
 {
   this->Update();
 
-  double matrix[3][3];
-  double coord[3];
-
-  vtkIdType i;
   vtkIdType n = inPts->GetNumberOfPoints();
+  if (n == 0)
+  {
+    return;
+  }
 
-  for (i = 0; i < n; i++)
+  // presize the outputs, then transform each point together with its normal
+  // and vectors in parallel; the derivative evaluation must be reentrant
+  // once Update has been called
+  double zero[3] = { 0.0, 0.0, 0.0 };
+  vtkIdType mPts = outPts->GetNumberOfPoints();
+  outPts->InsertPoint(mPts + n - 1, zero);
+  vtkIdType mNms = 0;
+  if (inNms)
+  {
+    mNms = outNms->GetNumberOfTuples();
+    outNms->InsertTuple(mNms + n - 1, zero);
+  }
+  vtkIdType mVrs = 0;
+  if (inVrs)
+  {
+    mVrs = outVrs->GetNumberOfTuples();
+    outVrs->InsertTuple(mVrs + n - 1, zero);
+  }
+  std::vector<vtkIdType> mVrsArr(inVrsArr ? nOptionalVectors : 0);
+  for (int iArr = 0; inVrsArr && iArr < nOptionalVectors; iArr++)
   {
-    inPts->GetPoint(i, coord);
-    this->InternalTransformDerivative(coord, coord, matrix);
-    outPts->InsertNextPoint(coord);
+    mVrsArr[iArr] = outVrsArr[iArr]->GetNumberOfTuples();
+    outVrsArr[iArr]->InsertTuple(mVrsArr[iArr] + n - 1, zero);
+  }
 
-    if (inVrs)
+  vtkSMPTools::For(0, n, vtkSMPTools::THRESHOLD, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double matrix[3][3];
+    double coord[3];
+    for (; ptId < endPtId; ++ptId)
     {
-      inVrs->GetTuple(i, coord);
-      vtkMath::Multiply3x3(matrix, coord, coord);
-      outVrs->InsertNextTuple(coord);
-    }
-    if (inVrsArr)
-    {
-      for (int iArr = 0; iArr < nOptionalVectors; iArr++)
+      inPts->GetPoint(ptId, coord);
+      this->InternalTransformDerivative(coord, coord, matrix);
+      outPts->SetPoint(mPts + ptId, coord);
+
+      if (inVrs)
       {
-        inVrsArr[iArr]->GetTuple(i, coord);
+        inVrs->GetTuple(ptId, coord);
         vtkMath::Multiply3x3(matrix, coord, coord);
-        outVrsArr[iArr]->InsertNextTuple(coord);
+        outVrs->SetTuple(mVrs + ptId, coord);
+      }
+      if (inVrsArr)
+      {
+        for (int iArr = 0; iArr < nOptionalVectors; iArr++)
+        {
+          inVrsArr[iArr]->GetTuple(ptId, coord);
+          vtkMath::Multiply3x3(matrix, coord, coord);
+          outVrsArr[iArr]->SetTuple(mVrsArr[iArr] + ptId, coord);
+        }
+      }
+      if (inNms)
+      {
+        inNms->GetTuple(ptId, coord);
+        vtkMath::Transpose3x3(matrix, matrix);
+        vtkMath::LinearSolve3x3(matrix, coord, coord);
+        vtkMath::Normalize(coord);
+        outNms->SetTuple(mNms + ptId, coord);
       }
     }
-    if (inNms)
-    {
-      inNms->GetTuple(i, coord);
-      vtkMath::Transpose3x3(matrix, matrix);
-      vtkMath::LinearSolve3x3(matrix, coord, coord);
-      vtkMath::Normalize(coord);
-      outNms->InsertNextTuple(coord);
-    }
-  }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -293,6 +334,16 @@ void vtkAbstractTransform::DeepCopy(vtkAbstractTransform* transform)
 void vtkAbstractTransform::Update()
 {
   auto& internals = *(this->Internals);
+
+  // fast path: nothing has been modified since the last update, so there is
+  // nothing to do. GetMTime includes the inverse's MTime when we depend on
+  // it. Skipping the lock matters because TransformPoint calls Update once
+  // per point.
+  if (this->GetMTime() < internals.UpdateTime.GetMTime())
+  {
+    return;
+  }
+
   // locking is required to ensure that the class is thread-safe
   internals.UpdateMutex.lock();
 
@@ -305,6 +356,7 @@ void vtkAbstractTransform::Update()
     this->Inverse();
     vtkDebugMacro("Calling InternalUpdate on the transformation");
     this->InternalUpdate();
+    internals.UpdateTime.Modified();
   }
   // otherwise just check our MTime against our last update
   else if (this->GetMTime() >= internals.UpdateTime.GetMTime())
@@ -312,9 +364,9 @@ void vtkAbstractTransform::Update()
     // do internal update for subclass
     vtkDebugMacro("Calling InternalUpdate on the transformation");
     this->InternalUpdate();
+    internals.UpdateTime.Modified();
   }
 
-  internals.UpdateTime.Modified();
   internals.UpdateMutex.unlock();
 }
 
@@ -201,13 +201,16 @@ public:
 
   /**
    * Apply the transformation to a series of points, and append the
-   * results to outPts.
+   * results to outPts. The points are processed in parallel, so
+   * InternalTransformPoint must be reentrant once Update has been called
+   * (true for all transforms provided by VTK).
    */
   virtual void TransformPoints(vtkPoints* inPts, vtkPoints* outPts);
 
   /**
    * Apply the transformation to a combination of points, normals
-   * and vectors.
+   * and vectors. As with TransformPoints, the points are processed in
+   * parallel.
    */
   virtual void TransformPointsNormalsVectors(vtkPoints* inPts, vtkPoints* outPts,
     vtkDataArray* inNms, vtkDataArray* outNms, vtkDataArray* inVrs, vtkDataArray* outVrs,
@@ -8,6 +8,8 @@
 #include "vtkPoints.h"
 #include "vtkSMPTools.h"
 
+#include <vector>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 void vtkLinearTransform::PrintSelf(ostream& os, vtkIndent indent)
@@ -132,6 +134,37 @@ inline void vtkLinearTransformNormals(T1 matrix[4][4], T2* in, T3* out, vtkIdTyp
   });
 }
 
+//------------------------------------------------------------------------------
+template <class T1, class T2, class T3>
+inline void vtkLinearTransformPointsNormalsVectors(T1 matrix[4][4], T1 normalMatrix[4][4],
+  T2* inPts, T3* outPts, T2* inNms, T3* outNms, T2* inVrs, T3* outVrs, int nOptionalVectors,
+  T2* const* inVrsArr, T3* const* outVrsArr, vtkIdType n)
+{
+  // Fused sweep: transform each point together with its normal and vectors
+  // so that the data is traversed once instead of once per array.
+  vtkSMPTools::For(0, n, vtkSMPTools::THRESHOLD, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType tuple = 3 * ptId;
+      vtkLinearTransformPoint(matrix, inPts + tuple, outPts + tuple);
+      if (inNms)
+      {
+        // normalMatrix has been transposed & inverted, so use TransformVector
+        vtkLinearTransformVector(normalMatrix, inNms + tuple, outNms + tuple);
+        vtkMath::Normalize(outNms + tuple);
+      }
+      if (inVrs)
+      {
+        vtkLinearTransformVector(matrix, inVrs + tuple, outVrs + tuple);
+      }
+      for (int iArr = 0; iArr < nOptionalVectors; iArr++)
+      {
+        vtkLinearTransformVector(matrix, inVrsArr[iArr] + tuple, outVrsArr[iArr] + tuple);
+      }
+    }
+  });
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -195,6 +228,88 @@ void vtkLinearTransform::TransformPointsNormalsVectors(vtkPoints* inPts, vtkPoin
   vtkDataArray* inNms, vtkDataArray* outNms, vtkDataArray* inVrs, vtkDataArray* outVrs,
   int nOptionalVectors, vtkDataArray** inVrsArr, vtkDataArray** outVrsArr)
 {
+  this->Update();
+
+  // When every participating array shares one of the two common real types,
+  // transform points, normals and vectors in a single fused sweep so that
+  // the data is traversed once. Mixed or unusual types fall back to one
+  // pass per array below.
+  const auto allOfType = [&](int dataType) {
+    if (inPts->GetDataType() != dataType || outPts->GetDataType() != dataType)
+    {
+      return false;
+    }
+    if (inNms && (inNms->GetDataType() != dataType || outNms->GetDataType() != dataType))
+    {
+      return false;
+    }
+    if (inVrs && (inVrs->GetDataType() != dataType || outVrs->GetDataType() != dataType))
+    {
+      return false;
+    }
+    for (int iArr = 0; inVrsArr && iArr < nOptionalVectors; iArr++)
+    {
+      if (inVrsArr[iArr]->GetDataType() != dataType ||
+        outVrsArr[iArr]->GetDataType() != dataType)
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  const bool allFloat = allOfType(VTK_FLOAT);
+  if (allFloat || allOfType(VTK_DOUBLE))
+  {
+    const vtkIdType n = inPts->GetNumberOfPoints();
+    double(*matrix)[4] = this->Matrix->Element;
+
+    // to transform the normals, multiply by the transposed inverse matrix
+    double normalMatrix[4][4];
+    vtkMatrix4x4::DeepCopy(*normalMatrix, this->Matrix);
+    vtkMatrix4x4::Invert(*normalMatrix, *normalMatrix);
+    vtkMatrix4x4::Transpose(*normalMatrix, *normalMatrix);
+
+    // operate directly on the memory, appending after any existing tuples
+    void* inPtsPtr = inPts->GetData()->GetVoidPointer(0);
+    void* outPtsPtr = outPts->GetData()->WriteVoidPointer(3 * outPts->GetNumberOfPoints(), 3 * n);
+    void* inNmsPtr = inNms ? inNms->GetVoidPointer(0) : nullptr;
+    void* outNmsPtr = inNms ? outNms->WriteVoidPointer(3 * outNms->GetNumberOfTuples(), 3 * n)
+                            : nullptr;
+    void* inVrsPtr = inVrs ? inVrs->GetVoidPointer(0) : nullptr;
+    void* outVrsPtr = inVrs ? outVrs->WriteVoidPointer(3 * outVrs->GetNumberOfTuples(), 3 * n)
+                            : nullptr;
+    std::vector<void*> inArrPtrs(nOptionalVectors);
+    std::vector<void*> outArrPtrs(nOptionalVectors);
+    const int numArrs = inVrsArr ? nOptionalVectors : 0;
+    for (int iArr = 0; iArr < numArrs; iArr++)
+    {
+      inArrPtrs[iArr] = inVrsArr[iArr]->GetVoidPointer(0);
+      outArrPtrs[iArr] =
+        outVrsArr[iArr]->WriteVoidPointer(3 * outVrsArr[iArr]->GetNumberOfTuples(), 3 * n);
+    }
+
+    if (allFloat)
+    {
+      vtkLinearTransformPointsNormalsVectors(matrix, normalMatrix, static_cast<float*>(inPtsPtr),
+        static_cast<float*>(outPtsPtr), static_cast<float*>(inNmsPtr),
+        static_cast<float*>(outNmsPtr), static_cast<float*>(inVrsPtr),
+        static_cast<float*>(outVrsPtr), numArrs,
+        reinterpret_cast<float* const*>(inArrPtrs.data()),
+        reinterpret_cast<float* const*>(outArrPtrs.data()), n);
+    }
+    else
+    {
+      vtkLinearTransformPointsNormalsVectors(matrix, normalMatrix, static_cast<double*>(inPtsPtr),
+        static_cast<double*>(outPtsPtr), static_cast<double*>(inNmsPtr),
+        static_cast<double*>(outNmsPtr), static_cast<double*>(inVrsPtr),
+        static_cast<double*>(outVrsPtr), numArrs,
+        reinterpret_cast<double* const*>(inArrPtrs.data()),
+        reinterpret_cast<double* const*>(outArrPtrs.data()), n);
+    }
+    return;
+  }
+
   this->TransformPoints(inPts, outPts);
   if (inNms)
   {
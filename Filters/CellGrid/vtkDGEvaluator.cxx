@@ -14,6 +14,9 @@
 #include "vtkInterpolateCalculator.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStaticPointLocator.h"
 #include "vtkStringToken.h"
 #include "vtkTypeInt64Array.h"
@@ -194,9 +197,6 @@ bool vtkDGEvaluator::ClassifyPoints(
     return false;
   }
   vtkIdType numCells = conn->GetNumberOfTuples();
-  vtkVector3d center;
-  double radius;
-  vtkNew<vtkIdList> searchPoints;
   // A classifier for determining whether a point is inside or outside a DG cell.
   // We rely on the fact that the DG cells are easy to bound with related convex planes.
   // If the point is inside every boundary's half-space, the point is inside.
@@ -211,10 +211,6 @@ bool vtkDGEvaluator::ClassifyPoints(
   int numCorners = dgCell->GetNumberOfCorners();
   int dim = dgCell->GetDimension();
   auto cellShape = dgCell->GetShape();
-  std::vector<vtkTypeInt64Array::ValueType> cellConn;
-  std::vector<vtkVector3d> cellCorners;
-  cellConn.resize(numCorners);
-  cellCorners.resize(numCorners);
   auto classifier = [&](vtkTypeUInt64 cellId, const vtkVector3d& testPoint,
                       const std::vector<vtkVector3d>& cellCornerData) {
     (void)cellId;
@@ -263,34 +259,54 @@ bool vtkDGEvaluator::ClassifyPoints(
   };
   auto& alloc = query->GetAllocationsForCellType(cellType->GetClassName());
   auto* inputPoints = query->GetInputPoints();
-  vtkNew<vtkIdList> testPointIDs;
-  vtkVector3d testPoint;
-  for (vtkIdType ii = 0; ii < numCells; ++ii)
-  {
-    // Get corner point IDs
-    conn->GetTypedTuple(ii, cellConn.data());
-    // Get corner point coordinates
-    for (int jj = 0; jj < numCorners; ++jj)
-    {
-      coords->GetTuple(cellConn[jj], cellCorners[jj].GetData());
-    }
-    centerAndRadiusOfCellPoints(cellCorners, center, radius);
-    locator->FindPointsWithinRadius(radius, center.GetData(), testPointIDs);
-    for (const auto& testPointID : *testPointIDs)
+  // Classify cells in parallel; each thread accumulates its own point-in-cell
+  // hits which are merged into the query's allocations afterwards.
+  // Build the locator up front so the threads only perform lookups.
+  locator->BuildLocator();
+  vtkSMPThreadLocal<std::map<vtkIdType, std::set<vtkIdType>>> tlHits;
+  vtkSMPThreadLocal<std::vector<vtkTypeInt64Array::ValueType>> tlCellConn;
+  vtkSMPThreadLocal<std::vector<vtkVector3d>> tlCellCorners;
+  vtkSMPThreadLocalObject<vtkIdList> tlTestPointIDs;
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType begin, vtkIdType end)
     {
-      inputPoints->GetTuple(testPointID, testPoint.GetData());
-      if (classifier(ii, testPoint, cellCorners))
+      auto& hits = tlHits.Local();
+      auto& cellConn = tlCellConn.Local();
+      auto& cellCorners = tlCellCorners.Local();
+      cellConn.resize(numCorners);
+      cellCorners.resize(numCorners);
+      vtkIdList* testPointIDs = tlTestPointIDs.Local();
+      vtkVector3d center;
+      vtkVector3d testPoint;
+      double radius;
+      for (vtkIdType ii = begin; ii < end; ++ii)
       {
-        alloc.InputPoints[testPointID].insert(ii);
-        if (alloc.InputPoints.size() == static_cast<std::size_t>(inputPoints->GetNumberOfTuples()))
+        // Get corner point IDs
+        conn->GetTypedTuple(ii, cellConn.data());
+        // Get corner point coordinates
+        for (int jj = 0; jj < numCorners; ++jj)
         {
-          // We have consumed all the input points with already-processed cells.
-          // NB: If a point lies in multiple cells (i.e., cells overlap or one
-          // cell forms the boundary of another), then returning now will fail
-          // to report all the containing cells).
-          // return true;
+          coords->GetTuple(cellConn[jj], cellCorners[jj].GetData());
+        }
+        centerAndRadiusOfCellPoints(cellCorners, center, radius);
+        locator->FindPointsWithinRadius(radius, center.GetData(), testPointIDs);
+        for (const auto& testPointID : *testPointIDs)
+        {
+          inputPoints->GetTuple(testPointID, testPoint.GetData());
+          if (classifier(ii, testPoint, cellCorners))
+          {
+            hits[testPointID].insert(ii);
+          }
         }
       }
+    });
+  // NB: If a point lies in multiple cells (i.e., cells overlap or one cell
+  // forms the boundary of another), all the containing cells are reported.
+  for (const auto& hits : tlHits)
+  {
+    for (const auto& entry : hits)
+    {
+      alloc.InputPoints[entry.first].insert(entry.second.begin(), entry.second.end());
     }
   }
   return true;
@@ -316,82 +332,88 @@ bool vtkDGEvaluator::EvaluatePositions(
   auto cellIds = query->GetClassifierCellIndices();
   auto pointParams = query->GetClassifierPointParameters();
   auto& alloc = query->GetAllocationsForCellType(dgCell->GetClassName());
-  vtkIdType outputPointId = alloc.Offset;
-  int numCorners = dgCell->GetNumberOfCorners();
-  std::vector<vtkTypeInt64Array::ValueType> cellConn;
-  std::vector<vtkVector3d> cellCorners;
-  cellConn.resize(numCorners);
-  cellCorners.resize(numCorners);
-  vtkVector3d testPoint;
+  // Flatten the per-point cell sets into a work list so the Newton
+  // iterations can be sharded across threads; the output location of each
+  // (point, cell) pair is its index offset by the cell-type's allocation.
+  std::vector<std::pair<vtkIdType, vtkTypeUInt64>> work;
   for (const auto& entry : alloc.InputPoints)
   {
-    inputPoints->GetTuple(entry.first, testPoint.GetData());
-    vtkTypeUInt64 outputPointValue = entry.first;
     for (const auto& cellId : entry.second)
     {
-      vtkTypeUInt64 outputCellValue = cellId;
-      pointIds->SetTypedTuple(outputPointId, &outputPointValue);
-      cellIds->SetTypedTuple(outputPointId, &outputCellValue);
-
-      // Compute the parametric coordinates of \a testPoint by Newton iteration.
-      vtkVector3d rst(0., 0., 0.);
+      work.emplace_back(entry.first, static_cast<vtkTypeUInt64>(cellId));
+    }
+  }
+  vtkSMPTools::For(0, static_cast<vtkIdType>(work.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      vtkVector3d testPoint;
       std::vector<double> xyz(3, 0.0);
       std::vector<double> jacobian(9, 0.0);
-      bool done = false;
-#ifdef VTK_DBG_DGEVAL
-      std::cout << "Test point " << entry.first << " " << testPoint << " cell " << cellId << ":\n";
-#endif
-      // Iterate at most 20 times before giving up:
-      for (int ii = 0; !done && ii < 20; ++ii)
+      for (vtkIdType wi = begin; wi < end; ++wi)
       {
-        calc->Evaluate(cellId, rst, xyz);
+        vtkIdType outputPointId = alloc.Offset + wi;
+        vtkTypeUInt64 outputPointValue = work[wi].first;
+        vtkTypeUInt64 cellId = work[wi].second;
+        inputPoints->GetTuple(work[wi].first, testPoint.GetData());
+        pointIds->SetTypedTuple(outputPointId, &outputPointValue);
+        cellIds->SetTypedTuple(outputPointId, &cellId);
+
+        // Compute the parametric coordinates of \a testPoint by Newton iteration.
+        vtkVector3d rst(0., 0., 0.);
+        bool done = false;
 #ifdef VTK_DBG_DGEVAL
-        std::cout << "  " << rst << " → " << xyz[0] << " " << xyz[1] << " " << xyz[2] << "\n";
+        std::cout << "Test point " << work[wi].first << " " << testPoint << " cell " << cellId
+                  << ":\n";
 #endif
-        vtkVector3d delta(xyz[0] - testPoint[0], xyz[1] - testPoint[1], xyz[2] - testPoint[2]);
-        if (delta.Norm() < 1e-7)
+        // Iterate at most 20 times before giving up:
+        for (int ii = 0; !done && ii < 20; ++ii)
         {
-          done = true;
-          break;
-        }
-        calc->EvaluateDerivative(cellId, rst, jacobian);
-        Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> map(&jacobian[0]);
-        Eigen::Vector3d edelt(delta[0], delta[1], delta[2]);
-        Eigen::HouseholderQR<Eigen::Matrix3d> solver(map);
-        auto xx = solver.solve(edelt);
+          calc->Evaluate(cellId, rst, xyz);
 #ifdef VTK_DBG_DGEVAL
-        std::cout << "AA\n" << map << "\nbb\n" << edelt << "\n => xx\n" << xx << "\n--\n";
+          std::cout << "  " << rst << " → " << xyz[0] << " " << xyz[1] << " " << xyz[2] << "\n";
 #endif
-        rst[0] -= xx[0];
-        rst[1] -= xx[1];
-        rst[2] -= xx[2];
+          vtkVector3d delta(xyz[0] - testPoint[0], xyz[1] - testPoint[1], xyz[2] - testPoint[2]);
+          if (delta.Norm() < 1e-7)
+          {
+            done = true;
+            break;
+          }
+          calc->EvaluateDerivative(cellId, rst, jacobian);
+          Eigen::Map<Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> map(&jacobian[0]);
+          Eigen::Vector3d edelt(delta[0], delta[1], delta[2]);
+          Eigen::HouseholderQR<Eigen::Matrix3d> solver(map);
+          auto xx = solver.solve(edelt);
 #ifdef VTK_DBG_DGEVAL
-        std::cout << "      delta " << edelt[0] << " " << edelt[1] << " " << edelt[2] << "\n";
+          std::cout << "AA\n" << map << "\nbb\n" << edelt << "\n => xx\n" << xx << "\n--\n";
 #endif
-      }
-      if (done)
-      {
-        // Clamp to cell boundary as needed.
-        done &= dgCell->IsInside(rst);
-      }
-      if (done)
-      {
-        pointParams->SetTuple(outputPointId, rst.GetData());
+          rst[0] -= xx[0];
+          rst[1] -= xx[1];
+          rst[2] -= xx[2];
 #ifdef VTK_DBG_DGEVAL
-        std::cout << "        success to " << outputPointId << " " << rst << "\n";
+          std::cout << "      delta " << edelt[0] << " " << edelt[1] << " " << edelt[2] << "\n";
 #endif
-      }
-      else
-      {
-        pointParams->SetTuple3(outputPointId, vtkMath::Nan(), vtkMath::Nan(), vtkMath::Nan());
+        }
+        if (done)
+        {
+          // Clamp to cell boundary as needed.
+          done &= dgCell->IsInside(rst);
+        }
+        if (done)
+        {
+          pointParams->SetTuple(outputPointId, rst.GetData());
+#ifdef VTK_DBG_DGEVAL
+          std::cout << "        success to " << outputPointId << " " << rst << "\n";
+#endif
+        }
+        else
+        {
+          pointParams->SetTuple3(outputPointId, vtkMath::Nan(), vtkMath::Nan(), vtkMath::Nan());
 #ifdef VTK_DBG_DGEVAL
-        std::cout << "        failure to " << outputPointId << " " << rst << "\n";
+          std::cout << "        failure to " << outputPointId << " " << rst << "\n";
 #endif
+        }
       }
-
-      ++outputPointId;
-    }
-  }
+    });
   return true;
 }
 
@@ -416,20 +438,27 @@ bool vtkDGEvaluator::InterpolatePoints(
   auto pointParams = query->GetClassifierPointParameters();
   auto values = query->GetInterpolatedValues();
   auto& alloc = query->GetAllocationsForCellType(dgCell->GetClassName());
-  vtkIdType outputPointId = alloc.Offset; // The start of the output points we will interpolate
+  vtkIdType startPointId = alloc.Offset; // The start of the output points we will interpolate
   vtkIdType numberOfPoints = alloc.GetNumberOfOutputPoints(); // The number of points to process.
-  vtkVector3d rst;
-  vtkTypeUInt64 cellId;
-  std::vector<double> value;
-  value.resize(attribute->GetNumberOfComponents());
 
-  for (const vtkIdType end = outputPointId + numberOfPoints; outputPointId < end; ++outputPointId)
-  {
-    cellIds->GetTypedTuple(outputPointId, &cellId);
-    pointParams->GetTuple(outputPointId, rst.GetData());
-    calc->Evaluate(cellId, rst, value);
-    values->SetTuple(outputPointId, &value[0]);
-  }
+  // Each output point is independent and the calculator keeps its scratch
+  // space in thread-local storage, so the interpolation shards cleanly.
+  vtkSMPThreadLocal<std::vector<double>> tlValue;
+  vtkSMPTools::For(startPointId, startPointId + numberOfPoints,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      auto& value = tlValue.Local();
+      value.resize(attribute->GetNumberOfComponents());
+      vtkVector3d rst;
+      vtkTypeUInt64 cellId;
+      for (vtkIdType outputPointId = begin; outputPointId < end; ++outputPointId)
+      {
+        cellIds->GetTypedTuple(outputPointId, &cellId);
+        pointParams->GetTuple(outputPointId, rst.GetData());
+        calc->Evaluate(cellId, rst, value);
+        values->SetTuple(outputPointId, &value[0]);
+      }
+    });
 
   return true;
 }
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Test the multi-plane (plane offset) mode of vtk3DLinearGridPlaneCutter:
+// cutting with a stack of parallel planes in one pass must produce the same
+// slices as executing the filter once per plane.
+
+#include <vtk3DLinearGridPlaneCutter.h>
+#include <vtkCellArray.h>
+#include <vtkDoubleArray.h>
+#include <vtkMultiBlockDataSet.h>
+#include <vtkNew.h>
+#include <vtkPlane.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+
+// Create a simple grid of hexahedra spanning [0,2]^3.
+vtkSmartPointer<vtkUnstructuredGrid> CreateHexGrid(int dim)
+{
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  const double spacing = 2.0 / (dim - 1);
+  for (int k = 0; k < dim; ++k)
+  {
+    for (int j = 0; j < dim; ++j)
+    {
+      for (int i = 0; i < dim; ++i)
+      {
+        points->InsertNextPoint(i * spacing, j * spacing, k * spacing);
+      }
+    }
+  }
+  grid->SetPoints(points);
+
+  grid->Allocate((dim - 1) * (dim - 1) * (dim - 1));
+  for (int k = 0; k < dim - 1; ++k)
+  {
+    for (int j = 0; j < dim - 1; ++j)
+    {
+      for (int i = 0; i < dim - 1; ++i)
+      {
+        const vtkIdType p0 = i + dim * (j + dim * k);
+        const vtkIdType hex[8] = { p0, p0 + 1, p0 + 1 + dim, p0 + dim, p0 + dim * dim,
+          p0 + 1 + dim * dim, p0 + 1 + dim + dim * dim, p0 + dim + dim * dim };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+      }
+    }
+  }
+
+  // Add a point scalar that varies along z so that interpolated attributes
+  // can be verified per slice.
+  vtkNew<vtkDoubleArray> elevation;
+  elevation->SetName("elevation");
+  elevation->SetNumberOfTuples(grid->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < grid->GetNumberOfPoints(); ++ptId)
+  {
+    elevation->SetValue(ptId, grid->GetPoint(ptId)[2]);
+  }
+  grid->GetPointData()->SetScalars(elevation);
+
+  return grid;
+}
+
+} // namespace
+
+int Test3DLinearGridMultiPlaneCutter(int, char*[])
+{
+  auto grid = CreateHexGrid(5);
+
+  vtkNew<vtkPlane> plane;
+  plane->SetOrigin(1.0, 1.0, 1.0);
+  plane->SetNormal(0.0, 0.0, 1.0);
+
+  const int numOffsets = 3;
+  const double offsets[numOffsets] = { -0.5, 0.0, 0.5 };
+
+  // Cut with all planes in one pass.
+  vtkNew<vtk3DLinearGridPlaneCutter> slicer;
+  slicer->SetInputData(grid);
+  slicer->SetPlane(plane);
+  slicer->GeneratePlaneOffsets(numOffsets, offsets[0], offsets[numOffsets - 1]);
+  slicer->Update();
+
+  auto mbds = vtkMultiBlockDataSet::SafeDownCast(slicer->GetOutputDataObject(0));
+  if (!mbds || static_cast<int>(mbds->GetNumberOfBlocks()) != numOffsets)
+  {
+    std::cerr << "Expected a multiblock output with " << numOffsets << " blocks" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 0; i < numOffsets; ++i)
+  {
+    auto slice = vtkPolyData::SafeDownCast(mbds->GetBlock(i));
+    if (!slice || slice->GetNumberOfCells() < 1)
+    {
+      std::cerr << "Empty slice for offset " << offsets[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // Reference: cut with a single plane displaced by the offset.
+    vtkNew<vtkPlane> refPlane;
+    refPlane->SetOrigin(1.0, 1.0, 1.0 + offsets[i]);
+    refPlane->SetNormal(0.0, 0.0, 1.0);
+    vtkNew<vtk3DLinearGridPlaneCutter> refSlicer;
+    refSlicer->SetInputData(grid);
+    refSlicer->SetPlane(refPlane);
+    refSlicer->Update();
+
+    auto reference = vtkPolyData::SafeDownCast(refSlicer->GetOutputDataObject(0));
+    if (!reference || slice->GetNumberOfCells() != reference->GetNumberOfCells() ||
+      slice->GetNumberOfPoints() != reference->GetNumberOfPoints())
+    {
+      std::cerr << "Slice at offset " << offsets[i] << " differs from the single-plane cut"
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // All slice points (and interpolated scalars) must lie on the plane.
+    const double expectedZ = 1.0 + offsets[i];
+    auto scalars = vtkDoubleArray::SafeDownCast(slice->GetPointData()->GetArray("elevation"));
+    if (!scalars)
+    {
+      std::cerr << "Interpolated attributes missing for offset " << offsets[i] << std::endl;
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType ptId = 0; ptId < slice->GetNumberOfPoints(); ++ptId)
+    {
+      if (std::abs(slice->GetPoint(ptId)[2] - expectedZ) > 1e-6 ||
+        std::abs(scalars->GetValue(ptId) - expectedZ) > 1e-6)
+      {
+        std::cerr << "Slice point off the plane at offset " << offsets[i] << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Clearing the offsets must restore the single polydata output.
+  slicer->SetNumberOfPlaneOffsets(0);
+  slicer->Update();
+  if (!vtkPolyData::SafeDownCast(slicer->GetOutputDataObject(0)))
+  {
+    std::cerr << "Expected a polydata output without plane offsets" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
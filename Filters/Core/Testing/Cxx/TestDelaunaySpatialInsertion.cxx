@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Verifies that the spatially coherent (BRIO/Hilbert) insertion order of
+// vtkDelaunay2D and vtkDelaunay3D produces triangulations equivalent to the
+// default insertion order.
+#include <vtkCellArray.h>
+#include <vtkDelaunay2D.h>
+#include <vtkDelaunay3D.h>
+#include <vtkMinimalStandardRandomSequence.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkUnstructuredGrid.h>
+
+namespace
+{
+void InitializePoints(vtkPolyData* polyData, int numberOfPoints, bool planar)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> randomSequence;
+  randomSequence->SetSeed(2);
+
+  vtkNew<vtkPoints> points;
+  points->SetDataType(VTK_DOUBLE);
+  for (int i = 0; i < numberOfPoints; ++i)
+  {
+    double point[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      randomSequence->Next();
+      point[j] = planar && j == 2 ? 0.0 : randomSequence->GetValue();
+    }
+    points->InsertNextPoint(point);
+  }
+  polyData->SetPoints(points);
+}
+}
+
+int TestDelaunaySpatialInsertion(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
+{
+  // 2D: same triangle count with and without the spatial insertion order
+  vtkNew<vtkPolyData> planarPoints;
+  InitializePoints(planarPoints, 500, true);
+
+  vtkNew<vtkDelaunay2D> delaunay2D;
+  delaunay2D->SetInputData(planarPoints);
+  delaunay2D->Update();
+  const vtkIdType numberOfTriangles = delaunay2D->GetOutput()->GetNumberOfPolys();
+
+  vtkNew<vtkDelaunay2D> spatialDelaunay2D;
+  spatialDelaunay2D->SetInputData(planarPoints);
+  spatialDelaunay2D->SpatialPointInsertionOn();
+  spatialDelaunay2D->Update();
+
+  if (spatialDelaunay2D->GetOutput()->GetNumberOfPolys() != numberOfTriangles ||
+    numberOfTriangles == 0)
+  {
+    std::cerr << "Spatial insertion produced " << spatialDelaunay2D->GetOutput()->GetNumberOfPolys()
+              << " triangles, expected " << numberOfTriangles << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // 3D: same tetrahedron count with and without the spatial insertion order
+  vtkNew<vtkPolyData> cloudPoints;
+  InitializePoints(cloudPoints, 500, false);
+
+  vtkNew<vtkDelaunay3D> delaunay3D;
+  delaunay3D->SetInputData(cloudPoints);
+  delaunay3D->Update();
+  const vtkIdType numberOfTetras = delaunay3D->GetOutput()->GetNumberOfCells();
+
+  vtkNew<vtkDelaunay3D> spatialDelaunay3D;
+  spatialDelaunay3D->SetInputData(cloudPoints);
+  spatialDelaunay3D->SpatialPointInsertionOn();
+  spatialDelaunay3D->Update();
+
+  if (spatialDelaunay3D->GetOutput()->GetNumberOfCells() != numberOfTetras || numberOfTetras == 0)
+  {
+    std::cerr << "Spatial insertion produced "
+              << spatialDelaunay3D->GetOutput()->GetNumberOfCells() << " tetrahedra, expected "
+              << numberOfTetras << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
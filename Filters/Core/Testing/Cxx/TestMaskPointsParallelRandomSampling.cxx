@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Description
+// Verifies that the PARALLEL_RANDOM_SAMPLING mode of vtkMaskPoints selects
+// exactly the same points no matter how many threads execute the sampling
+// loop, and that different seeds select different points.
+
+#include "vtkIdTypeArray.h"
+#include "vtkMaskPoints.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+// Run the filter and return the original ids of the sampled points, recovered
+// through a point data array carrying the input point index.
+std::vector<vtkIdType> SampleIds(vtkPolyData* input, int seed, vtkIdType maxPts)
+{
+  vtkNew<vtkMaskPoints> mask;
+  mask->SetInputData(input);
+  mask->RandomModeOn();
+  mask->SetRandomModeType(vtkMaskPoints::PARALLEL_RANDOM_SAMPLING);
+  mask->SetRandomSeed(seed);
+  mask->SetMaximumNumberOfPoints(maxPts);
+  mask->Update();
+
+  vtkIdTypeArray* origIds =
+    vtkIdTypeArray::SafeDownCast(mask->GetOutput()->GetPointData()->GetArray("OrigIds"));
+  if (!origIds)
+  {
+    return {};
+  }
+  std::vector<vtkIdType> ids(origIds->GetNumberOfValues());
+  for (vtkIdType i = 0; i < origIds->GetNumberOfValues(); ++i)
+  {
+    ids[i] = origIds->GetValue(i);
+  }
+  return ids;
+}
+
+} // end anon namespace
+
+int TestMaskPointsParallelRandomSampling(int, char*[])
+{
+  const vtkIdType numPts = 10000;
+  const vtkIdType sampleSize = 500;
+
+  vtkNew<vtkPolyData> input;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkIdTypeArray> origIds;
+  origIds->SetName("OrigIds");
+  points->SetNumberOfPoints(numPts);
+  origIds->SetNumberOfValues(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    points->SetPoint(i, static_cast<double>(i % 100), static_cast<double>((i / 100) % 100),
+      static_cast<double>(i / 10000));
+    origIds->SetValue(i, i);
+  }
+  input->SetPoints(points);
+  input->GetPointData()->AddArray(origIds);
+
+  int status = EXIT_SUCCESS;
+
+  // the sample must not depend on how the point range is split across threads
+  vtkSMPTools::Initialize(1);
+  const std::vector<vtkIdType> baseline = SampleIds(input, 12, sampleSize);
+  if (static_cast<vtkIdType>(baseline.size()) != sampleSize)
+  {
+    cerr << "Sampled " << baseline.size() << " points, expected " << sampleSize << endl;
+    status = EXIT_FAILURE;
+  }
+  for (size_t i = 1; i < baseline.size(); ++i)
+  {
+    if (baseline[i] <= baseline[i - 1])
+    {
+      cerr << "Sampled ids are not emitted in input order" << endl;
+      status = EXIT_FAILURE;
+      break;
+    }
+  }
+  for (const int numThreads : { 2, 3, 8 })
+  {
+    vtkSMPTools::Initialize(numThreads);
+    if (SampleIds(input, 12, sampleSize) != baseline)
+    {
+      cerr << "Sample with " << numThreads << " threads differs from the single threaded one"
+           << endl;
+      status = EXIT_FAILURE;
+    }
+  }
+
+  // a different seed must draw a different sample
+  if (SampleIds(input, 13, sampleSize) == baseline)
+  {
+    cerr << "Samples with seeds 12 and 13 are identical" << endl;
+    status = EXIT_FAILURE;
+  }
+
+  // asking for more points than exist keeps every point
+  if (static_cast<vtkIdType>(SampleIds(input, 12, 2 * numPts).size()) != numPts)
+  {
+    cerr << "Oversized sample request did not keep every point" << endl;
+    status = EXIT_FAILURE;
+  }
+
+  vtkSMPTools::Initialize(0);
+  return status;
+}
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include <vtkBoundingBox.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkQuadricDecimation.h>
+#include <vtkSphereSource.h>
+
+#include <cstdlib>
+#include <iostream>
+
+int TestQuadricDecimationPartitioned(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetRadius(1.0);
+  sphere->SetThetaResolution(100);
+  sphere->SetPhiResolution(100);
+  sphere->Update();
+
+  const vtkIdType nCellsBefore = sphere->GetOutput()->GetNumberOfCells();
+
+  vtkNew<vtkQuadricDecimation> decimator;
+  decimator->SetInputConnection(sphere->GetOutputPort());
+  decimator->SetTargetReduction(0.90);
+  decimator->SetNumberOfPartitions(4);
+  decimator->Update();
+
+  vtkPolyData* output = decimator->GetOutput();
+  const vtkIdType nCellsAfter = output->GetNumberOfCells();
+  std::cout << "NCells: " << nCellsBefore << " -> " << nCellsAfter
+            << ", actual reduction: " << decimator->GetActualReduction() << std::endl;
+
+  // The locked partition boundaries limit the achievable reduction, but the
+  // bulk of each partition should still decimate.
+  if (decimator->GetActualReduction() < 0.5)
+  {
+    std::cerr << "Partitioned decimation did not reduce the mesh enough" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The decimated sphere should stay close to the unit sphere.
+  vtkBoundingBox bbox(output->GetBounds());
+  vtkBoundingBox expected(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0);
+  expected.Inflate(0.05);
+  if (!expected.Contains(bbox))
+  {
+    std::cerr << "Decimated output extends outside the expected bounds" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
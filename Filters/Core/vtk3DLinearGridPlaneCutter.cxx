@@ -11,6 +11,7 @@
 #include "vtkCellTypes.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
+#include "vtkContourValues.h"
 #include "vtkDataArrayRange.h"
 #include "vtkFloatArray.h"
 #include "vtkGarbageCollector.h"
@@ -18,6 +19,7 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
+#include "vtkMath.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
@@ -39,6 +41,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtk3DLinearGridPlaneCutter);
@@ -301,12 +304,17 @@ struct ExtractEdges : public ExtractEdgesBase<IDType, TIP>
 {
   const unsigned char* InOut;
   const double* Distance;
+  const vtkIdType* CellList; // if non-null, iterate this list of cells
+  double Offset;             // plane offset along the normal (multi-plane mode)
 
   ExtractEdges(TIP* inPts, CellIter* c, vtkPlane* plane, unsigned char* inout, double* distance,
-    vtkCellArray* tris, bool computeCells, vtk3DLinearGridPlaneCutter* filter)
+    vtkCellArray* tris, bool computeCells, vtk3DLinearGridPlaneCutter* filter,
+    const vtkIdType* cellList = nullptr, double offset = 0.0)
     : ExtractEdgesBase<IDType, TIP>(inPts, c, plane, tris, computeCells, filter)
     , InOut(inout)
     , Distance(distance)
+    , CellList(cellList)
+    , Offset(offset)
   {
   }
 
@@ -314,22 +322,25 @@ struct ExtractEdges : public ExtractEdgesBase<IDType, TIP>
   void Initialize() { this->ExtractEdgesBase<IDType, TIP>::Initialize(); }
 
   // operator() method extracts edges from cells (edges taken three at a
-  // time form a triangle)
-  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  // time form a triangle). The iteration is either a sweep over all cells,
+  // or, when a cell list is provided (multi-plane mode), a random-access
+  // visit of the listed cells with distances shifted by the plane offset.
+  void operator()(vtkIdType beginIdx, vtkIdType endIdx)
   {
     auto& localData = this->LocalData.Local();
     auto& lEdges = localData.LocalEdges;
     auto& lCells = localData.LocalCells;
     CellIter* cellIter = &localData.LocalCellIter;
-    const vtkIdType* c = cellIter->Initialize(cellId); // connectivity array
+    const vtkIdType* c = // connectivity array
+      cellIter->Initialize(this->CellList ? this->CellList[beginIdx] : beginIdx);
     const unsigned short* edges;
     double s[MAX_CELL_VERTS];
     bool isFirst = vtkSMPTools::GetSingleThread();
-    vtkIdType checkAbortInterval = std::min((endCellId - cellId) / 10 + 1, (vtkIdType)1000);
+    vtkIdType checkAbortInterval = std::min((endIdx - beginIdx) / 10 + 1, (vtkIdType)1000);
 
-    for (; cellId < endCellId; ++cellId)
+    for (vtkIdType idx = beginIdx; idx < endIdx; ++idx)
     {
-      if (cellId % checkAbortInterval == 0)
+      if (idx % checkAbortInterval == 0)
       {
         if (isFirst)
         {
@@ -340,15 +351,17 @@ struct ExtractEdges : public ExtractEdgesBase<IDType, TIP>
           break;
         }
       }
-      // Does the plane cut this cell?
-      if (Classify::PlaneIntersects(this->InOut, cellIter->NumVerts, c))
+      const vtkIdType cellId = (this->CellList ? this->CellList[idx] : idx);
+      // Does the plane cut this cell? (Listed cells have already been
+      // classified against their plane.)
+      if (this->CellList || Classify::PlaneIntersects(this->InOut, cellIter->NumVerts, c))
       {
         unsigned short isoCase;
         vtkIdType i;
         // Compute case by repeated masking with function value
         for (isoCase = 0, i = 0; i < cellIter->NumVerts; ++i)
         {
-          s[i] = this->Distance[c[i]];
+          s[i] = this->Distance[c[i]] - this->Offset;
           isoCase |= (s[i] >= 0.0 ? BaseCell::Mask[i] : 0);
         }
 
@@ -383,10 +396,21 @@ struct ExtractEdges : public ExtractEdgesBase<IDType, TIP>
               lCells.emplace_back(cellId);
             }
           }
-        }                   // if contour passes through this cell
-      }                     // if plane intersects
-      c = cellIter->Next(); // move to the next cell
-    }                       // for all cells in this batch
+        } // if contour passes through this cell
+      }   // if plane intersects
+      // move to the next cell
+      if (this->CellList)
+      {
+        if (idx + 1 < endIdx)
+        {
+          c = cellIter->Initialize(this->CellList[idx + 1]);
+        }
+      }
+      else
+      {
+        c = cellIter->Next();
+      }
+    } // for all cells in this batch
   }
 
   // Composite local thread data
@@ -408,15 +432,17 @@ struct ProducePoints
   TOP* OutPts;
   const double* Distance;
   const double* Normal;
+  double Offset; // plane offset along the normal (multi-plane mode)
   vtk3DLinearGridPlaneCutter* Filter;
 
   ProducePoints(const MergeTupleType* mt, const TIP* inPts, TOP* outPts, double* distance,
-    vtkPlane* plane, vtk3DLinearGridPlaneCutter* filter)
+    vtkPlane* plane, vtk3DLinearGridPlaneCutter* filter, double offset = 0.0)
     : Edges(mt)
     , InPts(inPts)
     , OutPts(outPts)
     , Distance(distance)
     , Normal(plane->GetNormal())
+    , Offset(offset)
     , Filter(filter)
   {
   }
@@ -441,8 +467,8 @@ struct ProducePoints
       const MergeTupleType& mergeTuple = this->Edges[ptId];
       const TIP* x0 = this->InPts + 3 * mergeTuple.V0;
       const TIP* x1 = this->InPts + 3 * mergeTuple.V1;
-      double d0 = this->Distance[mergeTuple.V0];
-      double d1 = this->Distance[mergeTuple.V1];
+      double d0 = this->Distance[mergeTuple.V0] - this->Offset;
+      double d1 = this->Distance[mergeTuple.V1] - this->Offset;
       TOP* x = this->OutPts + 3 * ptId;
 
       TIP p0[3], p1[3];
@@ -686,16 +712,18 @@ struct ProduceMergedPoints
   TOP* OutPts;
   const double* Distance;
   const double* Normal;
+  double PlaneOffset; // plane offset along the normal (multi-plane mode)
   vtk3DLinearGridPlaneCutter* Filter;
 
   ProduceMergedPoints(const MergeTupleType* merge, const IDType* offsets, TIP* inPts, TOP* outPts,
-    double* distance, vtkPlane* plane, vtk3DLinearGridPlaneCutter* filter)
+    double* distance, vtkPlane* plane, vtk3DLinearGridPlaneCutter* filter, double planeOffset = 0.0)
     : MergeArray(merge)
     , Offsets(offsets)
     , InPts(inPts)
     , OutPts(outPts)
     , Distance(distance)
     , Normal(plane->GetNormal())
+    , PlaneOffset(planeOffset)
     , Filter(filter)
   {
   }
@@ -720,8 +748,8 @@ struct ProduceMergedPoints
       const MergeTupleType* mergeTuple = this->MergeArray + this->Offsets[ptId];
       const TIP* x0 = this->InPts + 3 * mergeTuple->V0;
       const TIP* x1 = this->InPts + 3 * mergeTuple->V1;
-      double d0 = this->Distance[mergeTuple->V0];
-      double d1 = this->Distance[mergeTuple->V1];
+      double d0 = this->Distance[mergeTuple->V0] - this->PlaneOffset;
+      double d1 = this->Distance[mergeTuple->V1] - this->PlaneOffset;
       TOP* x = this->OutPts + 3 * ptId;
 
       TIP p0[3], p1[3];
@@ -797,7 +825,8 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
   unsigned char* inout, double* distance, vtkPoints* outPts, vtkCellArray* newPolys, bool mergePts,
   bool intAttr, bool seqProcessing, int& numThreads, vtkPointData* inPD = nullptr,
   vtkPointData* outPD = nullptr, vtkCellData* inCD = nullptr, vtkCellData* outCD = nullptr,
-  vtk3DLinearGridPlaneCutter* filter = nullptr)
+  vtk3DLinearGridPlaneCutter* filter = nullptr, const vtkIdType* cellList = nullptr,
+  double planeOffset = 0.0)
 {
   // Extract edges that the plane intersects.
   vtkIdType numTris = 0;
@@ -812,7 +841,7 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
   {
     float* pts = static_cast<float*>(inPts->GetVoidPointer(0));
     ExtractEdges<TIds, float> extractEdges(
-      pts, cellIter, plane, inout, distance, newPolys, computeCells, filter);
+      pts, cellIter, plane, inout, distance, newPolys, computeCells, filter, cellList, planeOffset);
     EXECUTE_REDUCED_SMPFOR(seqProcessing, numCells, extractEdges, numThreads);
     numTris = extractEdges.NumTris;
     mergeEdges = extractEdges.Edges;
@@ -822,7 +851,7 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
   {
     double* pts = static_cast<double*>(inPts->GetVoidPointer(0));
     ExtractEdges<TIds, double> extractEdges(
-      pts, cellIter, plane, inout, distance, newPolys, computeCells, filter);
+      pts, cellIter, plane, inout, distance, newPolys, computeCells, filter, cellList, planeOffset);
     EXECUTE_REDUCED_SMPFOR(seqProcessing, numCells, extractEdges, numThreads);
     numTris = extractEdges.NumTris;
     mergeEdges = extractEdges.Edges;
@@ -859,14 +888,14 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
       {
         float* outPtsPtr = static_cast<float*>(outPts->GetVoidPointer(0));
         ProducePoints<float, float, TIds> producePoints(
-          mergeEdges, inPtsPtr, outPtsPtr, distance, plane, filter);
+          mergeEdges, inPtsPtr, outPtsPtr, distance, plane, filter, planeOffset);
         EXECUTE_SMPFOR(seqProcessing, numPts, producePoints);
       }
       else // outPtsType == VTK_DOUBLE
       {
         double* outPtsPtr = static_cast<double*>(outPts->GetVoidPointer(0));
         ProducePoints<float, double, TIds> producePoints(
-          mergeEdges, inPtsPtr, outPtsPtr, distance, plane, filter);
+          mergeEdges, inPtsPtr, outPtsPtr, distance, plane, filter, planeOffset);
         EXECUTE_SMPFOR(seqProcessing, numPts, producePoints);
       }
     }
@@ -877,14 +906,14 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
       {
         float* outPtsPtr = static_cast<float*>(outPts->GetVoidPointer(0));
         ProducePoints<double, float, TIds> producePoints(
-          mergeEdges, inPtsPtr, outPtsPtr, distance, plane, filter);
+          mergeEdges, inPtsPtr, outPtsPtr, distance, plane, filter, planeOffset);
         EXECUTE_SMPFOR(seqProcessing, numPts, producePoints);
       }
       else // outPtsType == VTK_DOUBLE
       {
         double* outPtsPtr = static_cast<double*>(outPts->GetVoidPointer(0));
         ProducePoints<double, double, TIds> producePoints(
-          mergeEdges, inPtsPtr, outPtsPtr, distance, plane, filter);
+          mergeEdges, inPtsPtr, outPtsPtr, distance, plane, filter, planeOffset);
         EXECUTE_SMPFOR(seqProcessing, numPts, producePoints);
       }
     }
@@ -941,14 +970,14 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
       {
         float* outPtsPtr = static_cast<float*>(outPts->GetVoidPointer(0));
         ProduceMergedPoints<float, float, TIds> producePts(
-          mergeEdges, offsets, inPtsPtr, outPtsPtr, distance, plane, filter);
+          mergeEdges, offsets, inPtsPtr, outPtsPtr, distance, plane, filter, planeOffset);
         EXECUTE_SMPFOR(seqProcessing, numPts, producePts);
       }
       else // outPtsType == VTK_DOUBLE
       {
         double* outPtsPtr = static_cast<double*>(outPts->GetVoidPointer(0));
         ProduceMergedPoints<float, double, TIds> producePts(
-          mergeEdges, offsets, inPtsPtr, outPtsPtr, distance, plane, filter);
+          mergeEdges, offsets, inPtsPtr, outPtsPtr, distance, plane, filter, planeOffset);
         EXECUTE_SMPFOR(seqProcessing, numPts, producePts);
       }
     }
@@ -959,14 +988,14 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
       {
         float* outPtsPtr = static_cast<float*>(outPts->GetVoidPointer(0));
         ProduceMergedPoints<double, float, TIds> producePts(
-          mergeEdges, offsets, inPtsPtr, outPtsPtr, distance, plane, filter);
+          mergeEdges, offsets, inPtsPtr, outPtsPtr, distance, plane, filter, planeOffset);
         EXECUTE_SMPFOR(seqProcessing, numPts, producePts);
       }
       else // outPtsType == VTK_DOUBLE
       {
         double* outPtsPtr = static_cast<double*>(outPts->GetVoidPointer(0));
         ProduceMergedPoints<double, double, TIds> producePts(
-          mergeEdges, offsets, inPtsPtr, outPtsPtr, distance, plane, filter);
+          mergeEdges, offsets, inPtsPtr, outPtsPtr, distance, plane, filter, planeOffset);
         EXECUTE_SMPFOR(seqProcessing, numPts, producePts);
       }
     }
@@ -1002,6 +1031,108 @@ int ProcessEdges(vtkIdType numCells, vtkPoints* inPts, CellIter* cellIter, vtkPl
   return 1;
 }
 
+//========================= Multi-plane cell binning ==========================
+// Bin cells against a stack of parallel planes in a single traversal. A
+// plane with (scaled) offset d cuts a cell exactly when d falls within the
+// range of signed distances of the cell's points, so each cell is binned to
+// the interval of sorted offsets spanned by its distance range. The
+// resulting per-plane cell lists drive a separate, greatly reduced edge
+// extraction per plane.
+struct BinCells
+{
+  CellIter* Iter;
+  const double* Distance;
+  const double* Offsets; // sorted plane offsets, scaled by the normal magnitude
+  int NumOffsets;
+  std::vector<std::vector<vtkIdType>> Bins; // after Reduce(): cells cut per plane
+  int NumThreadsUsed;
+  vtk3DLinearGridPlaneCutter* Filter;
+
+  // Track local data on a per-thread basis to avoid locking.
+  struct LocalDataType
+  {
+    std::vector<std::vector<vtkIdType>> Bins;
+    CellIter LocalCellIter;
+  };
+  vtkSMPThreadLocal<LocalDataType> LocalData;
+
+  BinCells(CellIter* c, const double* distance, const double* offsets, int numOffsets,
+    vtk3DLinearGridPlaneCutter* filter)
+    : Iter(c)
+    , Distance(distance)
+    , Offsets(offsets)
+    , NumOffsets(numOffsets)
+    , NumThreadsUsed(0)
+    , Filter(filter)
+  {
+  }
+
+  void Initialize()
+  {
+    auto& localData = this->LocalData.Local();
+    localData.Bins.resize(this->NumOffsets);
+    localData.LocalCellIter = *(this->Iter);
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    auto& localData = this->LocalData.Local();
+    auto& bins = localData.Bins;
+    CellIter* cellIter = &localData.LocalCellIter;
+    const vtkIdType* c = cellIter->Initialize(cellId); // connectivity array
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkIdType checkAbortInterval = std::min((endCellId - cellId) / 10 + 1, (vtkIdType)1000);
+
+    for (; cellId < endCellId; ++cellId)
+    {
+      if (cellId % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->Filter->CheckAbort();
+        }
+        if (this->Filter->GetAbortOutput())
+        {
+          break;
+        }
+      }
+      // Compute the range of point distances for this cell.
+      double dMin = this->Distance[c[0]];
+      double dMax = dMin;
+      for (vtkIdType i = 1; i < cellIter->NumVerts; ++i)
+      {
+        const double d = this->Distance[c[i]];
+        dMin = (d < dMin ? d : dMin);
+        dMax = (d > dMax ? d : dMax);
+      }
+      // All planes whose offset falls within [dMin,dMax] cut this cell.
+      const double* first = std::lower_bound(this->Offsets, this->Offsets + this->NumOffsets, dMin);
+      const double* last = std::upper_bound(first, this->Offsets + this->NumOffsets, dMax);
+      for (const double* o = first; o != last; ++o)
+      {
+        bins[o - this->Offsets].push_back(cellId);
+      }
+      c = cellIter->Next(); // move to the next cell
+    }
+  }
+
+  // Composite local thread data
+  void Reduce()
+  {
+    this->Bins.resize(this->NumOffsets);
+    this->NumThreadsUsed = 0;
+    for (auto& ld : this->LocalData)
+    {
+      for (int i = 0; i < this->NumOffsets; ++i)
+      {
+        this->Bins[i].insert(this->Bins[i].end(), ld.Bins[i].begin(), ld.Bins[i].end());
+      }
+      std::vector<std::vector<vtkIdType>>().swap(ld.Bins); // frees memory
+      this->NumThreadsUsed++;
+    }
+  }
+};
+
 // Functor for assigning normals at each point
 struct ComputePointNormals
 {
@@ -1080,6 +1211,7 @@ struct ComputePointNormals
 vtk3DLinearGridPlaneCutter::vtk3DLinearGridPlaneCutter()
 {
   this->Plane = vtkPlane::New();
+  this->PlaneOffsets = vtkContourValues::New();
   this->MergePoints = false;
   this->InterpolateAttributes = true;
   this->ComputeNormals = false;
@@ -1093,23 +1225,55 @@ vtk3DLinearGridPlaneCutter::vtk3DLinearGridPlaneCutter()
 vtk3DLinearGridPlaneCutter::~vtk3DLinearGridPlaneCutter()
 {
   this->SetPlane(nullptr);
+  this->PlaneOffsets->Delete();
 }
 
 //------------------------------------------------------------------------------
-// Overload standard modified time function. If the plane definition is modified,
-// then this object is modified as well.
+// Overload standard modified time function. If the plane definition or the
+// plane offsets are modified, then this object is modified as well.
 vtkMTimeType vtk3DLinearGridPlaneCutter::GetMTime()
 {
   vtkMTimeType mTime = this->Superclass::GetMTime();
   if (this->Plane != nullptr)
   {
     vtkMTimeType mTime2 = this->Plane->GetMTime();
-    return (mTime2 > mTime ? mTime2 : mTime);
-  }
-  else
-  {
-    return mTime;
+    mTime = (mTime2 > mTime ? mTime2 : mTime);
   }
+  vtkMTimeType mTime2 = this->PlaneOffsets->GetMTime();
+  return (mTime2 > mTime ? mTime2 : mTime);
+}
+
+//------------------------------------------------------------------------------
+// Methods delegating to the internal vtkContourValues holding the plane
+// offsets for multi-plane cutting.
+void vtk3DLinearGridPlaneCutter::SetPlaneOffsetValue(int i, double value)
+{
+  this->PlaneOffsets->SetValue(i, value);
+}
+
+//------------------------------------------------------------------------------
+double vtk3DLinearGridPlaneCutter::GetPlaneOffsetValue(int i)
+{
+  return this->PlaneOffsets->GetValue(i);
+}
+
+//------------------------------------------------------------------------------
+void vtk3DLinearGridPlaneCutter::SetNumberOfPlaneOffsets(int n)
+{
+  this->PlaneOffsets->SetNumberOfContours(n);
+}
+
+//------------------------------------------------------------------------------
+int vtk3DLinearGridPlaneCutter::GetNumberOfPlaneOffsets()
+{
+  return this->PlaneOffsets->GetNumberOfContours();
+}
+
+//------------------------------------------------------------------------------
+void vtk3DLinearGridPlaneCutter::GeneratePlaneOffsets(
+  int numOffsets, double rangeStart, double rangeEnd)
+{
+  this->PlaneOffsets->GenerateValues(numOffsets, rangeStart, rangeEnd);
 }
 
 //------------------------------------------------------------------------------
@@ -1239,6 +1403,169 @@ int vtk3DLinearGridPlaneCutter::ProcessPiece(
   return 1;
 }
 
+//------------------------------------------------------------------------------
+// Cut an unstructured grid with a stack of planes parallel to the specified
+// plane. The signed point distances are computed once and each cell is
+// classified against all planes in a single traversal; the per-plane edge
+// extraction then only visits the cells actually cut by its plane.
+int vtk3DLinearGridPlaneCutter::ProcessPieceMultiPlane(
+  vtkUnstructuredGrid* input, vtkPlane* plane, vtkMultiBlockDataSet* output)
+{
+  // Make sure there is input data to process
+  if (!input || !plane || !output)
+  {
+    vtkLog(INFO, "Null input, plane, or output");
+    return 1;
+  }
+
+  vtkPoints* inPts = input->GetPoints();
+  vtkIdType numPts = inPts ? inPts->GetNumberOfPoints() : 0;
+  vtkCellArray* cells = input->GetCells();
+  vtkIdType numCells = cells ? cells->GetNumberOfCells() : 0;
+  if (numPts <= 0 || numCells <= 0)
+  {
+    vtkLog(INFO, "Empty input");
+    return 1;
+  }
+
+  // Check the input point type. Only real types are supported.
+  int inPtsType = inPts->GetDataType();
+  if (inPtsType != VTK_FLOAT && inPtsType != VTK_DOUBLE)
+  {
+    vtkLog(ERROR, "Input point type not supported");
+    return 0;
+  }
+
+  const int numOffsets = this->PlaneOffsets->GetNumberOfContours();
+  output->SetNumberOfBlocks(numOffsets);
+
+  // Sort the offsets (remembering the originating block) and scale them by
+  // the normal magnitude so that they are expressed in plane function
+  // values, comparable to the computed point distances.
+  double normal[3];
+  plane->GetNormal(normal);
+  const double norm = vtkMath::Norm(normal);
+  std::vector<int> order(numOffsets);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+    [this](int a, int b) { return this->PlaneOffsets->GetValue(a) < this->PlaneOffsets->GetValue(b); });
+  std::vector<double> sortedOffsets(numOffsets);
+  for (int i = 0; i < numOffsets; ++i)
+  {
+    sortedOffsets[i] = this->PlaneOffsets->GetValue(order[i]) * norm;
+  }
+
+  // Set up the cells for processing. A specialized iterator is used to traverse the cells.
+  unsigned char* cellTypes =
+    static_cast<unsigned char*>(input->GetCellTypesArray()->GetVoidPointer(0));
+  CellIter* cellIter = new CellIter(numCells, cellTypes, cells);
+
+  // Compute the signed distance of each point to the base plane. This is
+  // done once; the distance to an offset plane is just the shifted value.
+  unsigned char* inout = nullptr;
+  double* distance = nullptr;
+  if (inPtsType == VTK_FLOAT)
+  {
+    ClassifyPoints<float> classify(inPts, plane, this);
+    vtkSMPTools::For(0, numPts, classify);
+    inout = classify.InOutArray;
+    distance = classify.DistanceArray;
+  }
+  else // if (inPtsType == VTK_DOUBLE)
+  {
+    ClassifyPoints<double> classify(inPts, plane, this);
+    vtkSMPTools::For(0, numPts, classify);
+    inout = classify.InOutArray;
+    distance = classify.DistanceArray;
+  }
+
+  // Classify each cell against all planes in one traversal.
+  BinCells binCells(cellIter, distance, sortedOffsets.data(), numOffsets, this);
+  EXECUTE_REDUCED_SMPFOR(
+    this->SequentialProcessing, numCells, binCells, this->NumberOfThreadsUsed);
+
+  vtkPointData* inPD = input->GetPointData();
+  vtkCellData* inCD = input->GetCellData();
+
+  // Determine the size/type of point and cell ids needed to index points
+  // and cells. Using smaller ids results in a greatly reduced memory footprint
+  // and faster processing.
+  this->LargeIds = (numPts >= VTK_INT_MAX || numCells >= VTK_INT_MAX);
+
+  // Produce one output polydata per plane, each processing only the cells
+  // binned to its plane.
+  for (int i = 0; i < numOffsets && !this->GetAbortOutput(); ++i)
+  {
+    const auto& bin = binCells.Bins[i];
+    auto slice = vtkSmartPointer<vtkPolyData>::New();
+
+    // Create the output points. Only real types are supported.
+    auto outPts = vtkSmartPointer<vtkPoints>::New();
+    if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
+    {
+      outPts->SetDataType(inPts->GetDataType());
+    }
+    else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
+    {
+      outPts->SetDataType(VTK_FLOAT);
+    }
+    else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
+    {
+      outPts->SetDataType(VTK_DOUBLE);
+    }
+
+    // Output triangles go here.
+    auto newPolys = vtkSmartPointer<vtkCellArray>::New();
+
+    if (bin.empty())
+    {
+      outPts->SetNumberOfPoints(0);
+    }
+    else if (!this->LargeIds)
+    {
+      if (!ProcessEdges<int>(static_cast<vtkIdType>(bin.size()), inPts, cellIter, plane, inout,
+            distance, outPts, newPolys, this->MergePoints, this->InterpolateAttributes,
+            this->SequentialProcessing, this->NumberOfThreadsUsed, inPD, slice->GetPointData(),
+            inCD, slice->GetCellData(), this, bin.data(), sortedOffsets[i]))
+      {
+        return 0;
+      }
+    }
+    else
+    {
+      if (!ProcessEdges<vtkIdType>(static_cast<vtkIdType>(bin.size()), inPts, cellIter, plane,
+            inout, distance, outPts, newPolys, this->MergePoints, this->InterpolateAttributes,
+            this->SequentialProcessing, this->NumberOfThreadsUsed, inPD, slice->GetPointData(),
+            inCD, slice->GetCellData(), this, bin.data(), sortedOffsets[i]))
+      {
+        return 0;
+      }
+    }
+
+    // If requested, compute point normals. All planes in the stack share
+    // the same normal.
+    if (this->ComputeNormals)
+    {
+      ComputePointNormals::Execute(
+        this->SequentialProcessing, outPts, plane, slice->GetPointData(), this);
+    }
+
+    slice->SetPoints(outPts);
+    slice->SetPolys(newPolys);
+    output->SetBlock(order[i], slice);
+  }
+
+  // Report the results of execution
+  vtkLog(TRACE, "Created: " << numOffsets << " plane cuts");
+
+  // Clean up
+  delete[] inout;
+  delete[] distance;
+  delete cellIter;
+
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 // The output dataset type varies dependingon the input type.
 int vtk3DLinearGridPlaneCutter::RequestDataObject(
@@ -1258,6 +1585,17 @@ int vtk3DLinearGridPlaneCutter::RequestDataObject(
 
   if (vtkUnstructuredGrid::SafeDownCast(inputDO))
   {
+    // In multi-plane mode the output holds one vtkPolyData per plane offset.
+    if (this->PlaneOffsets->GetNumberOfContours() > 0)
+    {
+      if (vtkMultiBlockDataSet::SafeDownCast(outputDO) == nullptr)
+      {
+        outputDO = vtkMultiBlockDataSet::New();
+        outInfo->Set(vtkDataObject::DATA_OBJECT(), outputDO);
+        outputDO->Delete();
+      }
+      return 1;
+    }
     if (vtkPolyData::SafeDownCast(outputDO) == nullptr)
     {
       outputDO = vtkPolyData::New();
@@ -1304,8 +1642,11 @@ int vtk3DLinearGridPlaneCutter::RequestData(
   vtkMultiBlockDataSet* outputMBDS =
     vtkMultiBlockDataSet::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
-  // Make sure we have valid input and output of some form
-  if ((inputGrid == nullptr || outputPolyData == nullptr) &&
+  // Make sure we have valid input and output of some form. In multi-plane
+  // mode an unstructured grid input produces a multiblock output.
+  const bool multiPlane = (this->PlaneOffsets->GetNumberOfContours() > 0);
+  if ((inputGrid == nullptr || (multiPlane && outputMBDS == nullptr) ||
+        (!multiPlane && outputPolyData == nullptr)) &&
     (inputCDS == nullptr || outputMBDS == nullptr))
   {
     return 0;
@@ -1323,7 +1664,14 @@ int vtk3DLinearGridPlaneCutter::RequestData(
   // grid producing a single output vtkPolyData.
   if (inputGrid)
   {
-    this->ProcessPiece(inputGrid, plane, outputPolyData);
+    if (multiPlane)
+    {
+      this->ProcessPieceMultiPlane(inputGrid, plane, outputMBDS);
+    }
+    else
+    {
+      this->ProcessPiece(inputGrid, plane, outputPolyData);
+    }
     this->CheckAbort();
   }
 
@@ -1332,6 +1680,10 @@ int vtk3DLinearGridPlaneCutter::RequestData(
   // the output multiblock dataset.
   else
   {
+    if (multiPlane)
+    {
+      vtkLog(INFO, "Plane offsets are ignored for composite input");
+    }
     vtkUnstructuredGrid* grid;
     vtkPolyData* polydata;
     outputMBDS->CopyStructure(inputCDS);
@@ -1435,6 +1787,7 @@ void vtk3DLinearGridPlaneCutter::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "Plane: " << this->Plane << "\n";
+  os << indent << "Number of Plane Offsets: " << this->PlaneOffsets->GetNumberOfContours() << "\n";
 
   os << indent << "Merge Points: " << (this->MergePoints ? "true\n" : "false\n");
   os << indent
@@ -17,6 +17,8 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticCleanPolyData.h"
+#include "vtkStaticCleanUnstructuredGrid.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkType.h"
 #include "vtkUnstructuredGrid.h"
@@ -29,6 +31,7 @@ vtkAppendDataSets::vtkAppendDataSets()
   : MergePoints(false)
   , Tolerance(0.0)
   , ToleranceIsAbsolute(true)
+  , UseStaticPointMerging(false)
   , OutputDataSetType(VTK_UNSTRUCTURED_GRID)
   , OutputPointsPrecision(DEFAULT_PRECISION)
 {
@@ -108,10 +111,25 @@ int vtkAppendDataSets::RequestData(vtkInformation* vtkNotUsed(request),
 
   if (outputUG)
   {
+    // Zero-copy adoption: with a single input of the output type and no
+    // merging or precision conversion requested, the append is a no-op.
+    if (!this->MergePoints && inputVector[0]->GetNumberOfInformationObjects() == 1 &&
+      this->OutputPointsPrecision == DEFAULT_PRECISION)
+    {
+      auto input = vtkUnstructuredGrid::GetData(inputVector[0], 0);
+      if (input)
+      {
+        outputUG->ShallowCopy(input);
+        return 1;
+      }
+    }
+
+    const bool staticMerge = this->MergePoints && this->UseStaticPointMerging;
+
     vtkNew<vtkAppendFilter> appender;
     appender->SetContainerAlgorithm(this);
     appender->SetOutputPointsPrecision(this->GetOutputPointsPrecision());
-    appender->SetMergePoints(this->GetMergePoints());
+    appender->SetMergePoints(this->GetMergePoints() && !staticMerge);
     appender->SetToleranceIsAbsolute(this->GetToleranceIsAbsolute());
     appender->SetTolerance(this->GetTolerance());
 
@@ -122,12 +140,44 @@ int vtkAppendDataSets::RequestData(vtkInformation* vtkNotUsed(request),
     }
     if (appender->GetNumberOfInputConnections(0) > 0)
     {
-      appender->Update();
-      outputUG->ShallowCopy(appender->GetOutput());
+      if (staticMerge)
+      {
+        vtkNew<vtkStaticCleanUnstructuredGrid> cleaner;
+        cleaner->SetInputConnection(appender->GetOutputPort());
+        cleaner->SetContainerAlgorithm(this);
+        if (this->GetToleranceIsAbsolute())
+        {
+          cleaner->SetAbsoluteTolerance(this->GetTolerance());
+          cleaner->ToleranceIsAbsoluteOn();
+        }
+        else
+        {
+          cleaner->SetTolerance(this->GetTolerance());
+          cleaner->ToleranceIsAbsoluteOff();
+        }
+        cleaner->Update();
+        outputUG->ShallowCopy(cleaner->GetOutput());
+      }
+      else
+      {
+        appender->Update();
+        outputUG->ShallowCopy(appender->GetOutput());
+      }
     }
   }
   else if (outputPD)
   {
+    if (!this->MergePoints && inputVector[0]->GetNumberOfInformationObjects() == 1 &&
+      this->OutputPointsPrecision == DEFAULT_PRECISION)
+    {
+      auto input = vtkPolyData::GetData(inputVector[0], 0);
+      if (input)
+      {
+        outputPD->ShallowCopy(input);
+        return 1;
+      }
+    }
+
     vtkNew<vtkAppendPolyData> appender;
     appender->SetContainerAlgorithm(this);
     appender->SetOutputPointsPrecision(this->GetOutputPointsPrecision());
@@ -143,25 +193,49 @@ int vtkAppendDataSets::RequestData(vtkInformation* vtkNotUsed(request),
     {
       if (appender->GetNumberOfInputConnections(0) > 0)
       {
-        vtkNew<vtkCleanPolyData> cleaner;
-        cleaner->SetInputConnection(appender->GetOutputPort());
-        cleaner->SetContainerAlgorithm(this);
-        cleaner->PointMergingOn();
-        cleaner->ConvertLinesToPointsOff();
-        cleaner->ConvertPolysToLinesOff();
-        cleaner->ConvertStripsToPolysOff();
-        if (this->GetToleranceIsAbsolute())
+        if (this->UseStaticPointMerging)
         {
-          cleaner->SetAbsoluteTolerance(this->GetTolerance());
-          cleaner->ToleranceIsAbsoluteOn();
+          vtkNew<vtkStaticCleanPolyData> cleaner;
+          cleaner->SetInputConnection(appender->GetOutputPort());
+          cleaner->SetContainerAlgorithm(this);
+          cleaner->ConvertLinesToPointsOff();
+          cleaner->ConvertPolysToLinesOff();
+          cleaner->ConvertStripsToPolysOff();
+          if (this->GetToleranceIsAbsolute())
+          {
+            cleaner->SetAbsoluteTolerance(this->GetTolerance());
+            cleaner->ToleranceIsAbsoluteOn();
+          }
+          else
+          {
+            cleaner->SetTolerance(this->GetTolerance());
+            cleaner->ToleranceIsAbsoluteOff();
+          }
+          cleaner->Update();
+          output->ShallowCopy(cleaner->GetOutput());
         }
         else
         {
-          cleaner->SetTolerance(this->GetTolerance());
-          cleaner->ToleranceIsAbsoluteOff();
+          vtkNew<vtkCleanPolyData> cleaner;
+          cleaner->SetInputConnection(appender->GetOutputPort());
+          cleaner->SetContainerAlgorithm(this);
+          cleaner->PointMergingOn();
+          cleaner->ConvertLinesToPointsOff();
+          cleaner->ConvertPolysToLinesOff();
+          cleaner->ConvertStripsToPolysOff();
+          if (this->GetToleranceIsAbsolute())
+          {
+            cleaner->SetAbsoluteTolerance(this->GetTolerance());
+            cleaner->ToleranceIsAbsoluteOn();
+          }
+          else
+          {
+            cleaner->SetTolerance(this->GetTolerance());
+            cleaner->ToleranceIsAbsoluteOff();
+          }
+          cleaner->Update();
+          output->ShallowCopy(cleaner->GetOutput());
         }
-        cleaner->Update();
-        output->ShallowCopy(cleaner->GetOutput());
       }
     }
     else
@@ -217,6 +291,7 @@ void vtkAppendDataSets::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "MergePoints:" << (this->MergePoints ? "On" : "Off") << "\n";
+  os << indent << "UseStaticPointMerging:" << (this->UseStaticPointMerging ? "On" : "Off") << "\n";
   os << indent << "Tolerance: " << this->Tolerance << "\n";
   os << indent
      << "OutputDataSetType: " << vtkDataObjectTypes::GetClassNameFromTypeId(this->OutputDataSetType)
@@ -78,6 +78,22 @@ public:
   vtkBooleanMacro(ToleranceIsAbsolute, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set whether point merging is performed with the threaded static
+   * cleaners (vtkStaticCleanPolyData, vtkStaticCleanUnstructuredGrid),
+   * which bin the appended points with a vtkStaticPointLocator and merge
+   * them in parallel, instead of the serial incremental point locator.
+   * This scales with the number of cores when appending many blocks. The
+   * same points are merged, but which duplicate survives — and hence the
+   * output point order — may differ from the incremental locator.
+   * Default is off.
+   */
+  vtkGetMacro(UseStaticPointMerging, bool);
+  vtkSetMacro(UseStaticPointMerging, bool);
+  vtkBooleanMacro(UseStaticPointMerging, bool);
+  ///@}
+
   ///@{
   /**
    * Get/Set the output type produced by this filter. Only input datasets compatible with the
@@ -130,6 +146,9 @@ protected:
   // the diagonal of the bounding box of the input.
   bool ToleranceIsAbsolute;
 
+  // If true, point merging uses the threaded static cleaners.
+  bool UseStaticPointMerging;
+
   // Output data set type.
   int OutputDataSetType;
 
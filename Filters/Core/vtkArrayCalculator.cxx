@@ -323,6 +323,12 @@ public:
     auto tuple = this->Tuple.Local().data();
     vtkDataArray* currentArray;
     int j = 0;
+    // fetch point coordinates per tuple only if the expression actually
+    // references a coordinate variable
+    const bool needsCoordinates =
+      (this->AttributeType == vtkDataObject::POINT ||
+        this->AttributeType == vtkDataObject::VERTEX) &&
+      (this->CoordinateScalarVariableNamesSize > 0 || this->CoordinateVectorVariableNamesSize > 0);
 
     for (vtkIdType i = begin; i < end; i++, resultArrayItr++)
     {
@@ -346,8 +352,7 @@ public:
             tuple[this->SelectedVectorComponents[j][2]]);
         }
       }
-      if (this->AttributeType == vtkDataObject::POINT ||
-        this->AttributeType == vtkDataObject::VERTEX)
+      if (needsCoordinates)
       {
         double pt[3];
         if (this->DsInput)
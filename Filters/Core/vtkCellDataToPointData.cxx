@@ -340,6 +340,9 @@ vtkCellDataToPointData::vtkCellDataToPointData()
   this->ContributingCellOption = vtkCellDataToPointData::All;
   this->ProcessAllArrays = true;
   this->PieceInvariant = true;
+  this->CacheCellLinks = false;
+  this->CellLinksCacheInput = nullptr;
+  this->CellLinksCacheMTime = 0;
   this->Implementation = new Internals();
 }
 
@@ -513,6 +516,7 @@ void vtkCellDataToPointData::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "PassCellData: " << (this->PassCellData ? "On\n" : "Off\n");
   os << indent << "ContributingCellOption: " << this->ContributingCellOption << endl;
   os << indent << "PieceInvariant: " << (this->PieceInvariant ? "On\n" : "Off\n");
+  os << indent << "CacheCellLinks: " << (this->CacheCellLinks ? "On\n" : "Off\n");
 }
 
 //----------------------------------------------------------------------------
@@ -602,6 +606,12 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData(
         uGrid->BuildLinks(); // ensure links are up to date
         FastUnstructuredDataACL(numberOfPoints, uGrid->GetLinks(), processedCellData, outPD);
       }
+      else if (this->CacheCellLinks) // reuse links across executions
+      {
+        vtkMTimeType connMTime = uGrid->GetCells() ? uGrid->GetCells()->GetMTime() : 0;
+        FastUnstructuredDataACL(
+          numberOfPoints, this->GetCachedCellLinks(uGrid, connMTime), processedCellData, outPD);
+      }
       else // otherwise create links with the minimum size
       {
         vtkIdType connectivitySize = uGrid->GetCells()->GetNumberOfConnectivityIds();
@@ -617,6 +627,20 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData(
         polyData->BuildLinks(); // ensure links are up to date
         FastUnstructuredDataACL(numberOfPoints, polyData->GetLinks(), processedCellData, outPD);
       }
+      else if (this->CacheCellLinks) // reuse links across executions
+      {
+        vtkMTimeType connMTime = 0;
+        for (vtkCellArray* ca : { polyData->GetVerts(), polyData->GetLines(),
+               polyData->GetPolys(), polyData->GetStrips() })
+        {
+          if (ca && ca->GetMTime() > connMTime)
+          {
+            connMTime = ca->GetMTime();
+          }
+        }
+        FastUnstructuredDataACL(
+          numberOfPoints, this->GetCachedCellLinks(polyData, connMTime), processedCellData, outPD);
+      }
       else // otherwise create links with the minimum size
       {
         auto verts = polyData->GetVerts();
@@ -716,6 +740,22 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData(
   return 1; // slow path
 }
 
+//------------------------------------------------------------------------------
+vtkStaticCellLinks* vtkCellDataToPointData::GetCachedCellLinks(
+  vtkDataSet* input, vtkMTimeType connectivityMTime)
+{
+  if (!this->CellLinksCache || this->CellLinksCacheInput != input ||
+    this->CellLinksCacheMTime != connectivityMTime || connectivityMTime == 0)
+  {
+    this->CellLinksCache = vtkSmartPointer<vtkStaticCellLinks>::New();
+    this->CellLinksCache->SetDataSet(input);
+    this->CellLinksCache->BuildLinks();
+    this->CellLinksCacheInput = input;
+    this->CellLinksCacheMTime = connectivityMTime;
+  }
+  return this->CellLinksCache;
+}
+
 //------------------------------------------------------------------------------
 int vtkCellDataToPointData::InterpolatePointData(vtkDataSet* input, vtkDataSet* output)
 {
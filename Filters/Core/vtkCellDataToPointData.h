@@ -44,9 +44,11 @@
 
 #include "vtkDataSetAlgorithm.h"
 #include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkSmartPointer.h"      // For the cached cell links
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDataSet;
+class vtkStaticCellLinks;
 
 class VTKFILTERSCORE_EXPORT vtkCellDataToPointData : public vtkDataSetAlgorithm
 {
@@ -108,6 +110,21 @@ public:
   vtkBooleanMacro(PieceInvariant, bool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to cache the point-to-cell links used by the fast
+   * unstructured-data path across filter executions. The links are rebuilt
+   * only when the input or its connectivity changes, so repeated
+   * conversions over a time series with static topology (where only the
+   * attribute arrays vary) skip the links construction entirely. The cache
+   * is only used when the input does not already carry its own cell links.
+   * The default is false.
+   */
+  vtkSetMacro(CacheCellLinks, bool);
+  vtkGetMacro(CacheCellLinks, bool);
+  vtkBooleanMacro(CacheCellLinks, bool);
+  ///@}
+
   /**
    * Adds an array to be processed. This only has an effect if the
    * ProcessAllArrays option is turned off. If a name is already present,
@@ -150,6 +167,13 @@ protected:
 
   int InterpolatePointData(vtkDataSet* input, vtkDataSet* output);
 
+  /**
+   * Return the cached cell links for the given input, rebuilding them when
+   * the input or its connectivity (identified by the given modified time)
+   * has changed since the last execution.
+   */
+  vtkStaticCellLinks* GetCachedCellLinks(vtkDataSet* input, vtkMTimeType connectivityMTime);
+
   ///@{
   /**
    * Option to pass cell data arrays through to the output. Default is false/off.
@@ -172,6 +196,15 @@ protected:
 
   bool PieceInvariant;
 
+  /**
+   * Cached cell links and their key, used when CacheCellLinks is on. The
+   * previous input is only compared as a pointer, never dereferenced.
+   */
+  bool CacheCellLinks;
+  vtkSmartPointer<vtkStaticCellLinks> CellLinksCache;
+  vtkDataSet* CellLinksCacheInput;
+  vtkMTimeType CellLinksCacheMTime;
+
   class Internals;
   Internals* Implementation;
 
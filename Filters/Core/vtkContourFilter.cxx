@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkContourFilter.h"
 
+#include "vtkAppendPolyData.h"
 #include "vtkCallbackCommand.h"
 #include "vtkCell.h"
 #include "vtkCellArray.h"
@@ -11,11 +12,13 @@
 #include "vtkContourHelper.h"
 #include "vtkContourValues.h"
 #include "vtkCutter.h"
+#include "vtkExtractCells.h"
 #include "vtkFlyingEdges2D.h"
 #include "vtkFlyingEdges3D.h"
 #include "vtkGarbageCollector.h"
 #include "vtkGenericCell.h"
 #include "vtkGridSynchronizedTemplates3D.h"
+#include "vtkIdList.h"
 #include "vtkImageData.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
@@ -393,7 +396,7 @@ int vtkContourFilter::RequestData(
       this->Contour3DLinearGrid->SetComputeScalars(this->ComputeScalars);
       this->Contour3DLinearGrid->SetOutputPointsPrecision(this->OutputPointsPrecision);
       this->Contour3DLinearGrid->SetUseScalarTree(this->UseScalarTree);
-      this->ContourGrid->SetScalarTree(this->ScalarTree);
+      this->Contour3DLinearGrid->SetScalarTree(this->ScalarTree);
 
       bool mergePoints = !this->GetLocator()->IsA("vtkNonMergingPointLocator");
       this->Contour3DLinearGrid->SetMergePoints(mergePoints);
@@ -402,6 +405,92 @@ int vtkContourFilter::RequestData(
     }
     else
     {
+      // Mixed-topology fast path. CanFullyProcessDataObject() rejects grids
+      // that mix linear 3D cells with any other cell type, which would send
+      // the whole grid through the serial path below. When at least half of
+      // the grid is made of linear 3D cells, split those off and contour
+      // them in parallel with vtkContour3DLinearGrid, run only the remainder
+      // through the serial path, and append the two results. Points are not
+      // merged across the seam, but the volumetric isosurface and the
+      // geometry contributed by the remaining cells rarely coincide.
+      if (ugrid && this->GenerateTriangles && inScalars->GetName() &&
+        inScalars->GetNumberOfComponents() == 1 &&
+        (sType == VTK_UNSIGNED_INT || sType == VTK_INT || sType == VTK_FLOAT ||
+          sType == VTK_DOUBLE) &&
+        ugrid->GetPointData()->GetArray(inScalars->GetName()) == inScalars)
+      {
+        const vtkIdType numInputCells = ugrid->GetNumberOfCells();
+        vtkIdType numLinear3D = 0;
+        for (int cellType : { VTK_VOXEL, VTK_TETRA, VTK_HEXAHEDRON, VTK_WEDGE, VTK_PYRAMID })
+        {
+          numLinear3D += ugrid->GetNumberOfCellsOfType(cellType);
+        }
+        if (numLinear3D >= numInputCells / 2 && numLinear3D < numInputCells)
+        {
+          vtkNew<vtkIdList> linearIds;
+          vtkNew<vtkIdList> otherIds;
+          linearIds->Allocate(numLinear3D);
+          otherIds->Allocate(numInputCells - numLinear3D);
+          for (vtkIdType cellId = 0; cellId < numInputCells; ++cellId)
+          {
+            switch (ugrid->GetCellType(cellId))
+            {
+              case VTK_VOXEL:
+              case VTK_TETRA:
+              case VTK_HEXAHEDRON:
+              case VTK_WEDGE:
+              case VTK_PYRAMID:
+                linearIds->InsertNextId(cellId);
+                break;
+              default:
+                otherIds->InsertNextId(cellId);
+                break;
+            }
+          }
+
+          vtkNew<vtkExtractCells> extractLinear;
+          extractLinear->SetInputData(ugrid);
+          extractLinear->SetCellList(linearIds);
+          vtkNew<vtkContour3DLinearGrid> linearContour;
+          linearContour->SetInputConnection(extractLinear->GetOutputPort());
+          linearContour->SetNumberOfContours(numContours);
+          std::copy_n(values, numContours, linearContour->GetValues());
+          linearContour->SetInterpolateAttributes(true);
+          linearContour->SetComputeNormals(this->ComputeNormals);
+          linearContour->SetComputeScalars(this->ComputeScalars);
+          linearContour->SetOutputPointsPrecision(this->OutputPointsPrecision);
+          linearContour->SetMergePoints(!this->GetLocator()->IsA("vtkNonMergingPointLocator"));
+          linearContour->SetInputArrayToProcess(
+            0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, inScalars->GetName());
+
+          vtkNew<vtkExtractCells> extractOther;
+          extractOther->SetInputData(ugrid);
+          extractOther->SetCellList(otherIds);
+          vtkNew<vtkContourGrid> otherContour;
+          otherContour->SetInputConnection(extractOther->GetOutputPort());
+          otherContour->SetNumberOfContours(numContours);
+          std::copy_n(values, numContours, otherContour->GetValues());
+          otherContour->SetComputeNormals(this->ComputeNormals);
+          otherContour->SetComputeScalars(this->ComputeScalars);
+          otherContour->SetOutputPointsPrecision(this->OutputPointsPrecision);
+          otherContour->SetGenerateTriangles(this->GenerateTriangles);
+          otherContour->SetUseScalarTree(this->UseScalarTree);
+          if (this->Locator)
+          {
+            otherContour->SetLocator(this->Locator);
+          }
+          otherContour->SetInputArrayToProcess(
+            0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, inScalars->GetName());
+
+          vtkNew<vtkAppendPolyData> append;
+          append->AddInputConnection(linearContour->GetOutputPort());
+          append->AddInputConnection(otherContour->GetOutputPort());
+          append->Update();
+          output->ShallowCopy(append->GetOutput());
+          return 1;
+        }
+      }
+
       this->ContourGrid->SetNumberOfContours(numContours);
       std::copy_n(values, numContours, this->ContourGrid->GetValues());
       this->ContourGrid->SetComputeNormals(this->ComputeNormals);
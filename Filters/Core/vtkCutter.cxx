@@ -8,6 +8,7 @@
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
 #include "vtkCellTypes.h"
+#include "vtkContour3DLinearGrid.h"
 #include "vtkContourHelper.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
@@ -34,6 +35,7 @@
 #include "vtkStructuredGrid.h"
 #include "vtkSynchronizedTemplates3D.h"
 #include "vtkSynchronizedTemplatesCutter3D.h"
+#include "vtkUnstructuredGrid.h"
 #include "vtkUnstructuredGridBase.h"
 
 #include <algorithm>
@@ -57,6 +59,7 @@ vtkCutter::vtkCutter(vtkImplicitFunction* cf)
   this->OutputPointsPrecision = DEFAULT_PRECISION;
 
   this->PlaneCutter->SetContainerAlgorithm(this);
+  this->Contour3DLinearGrid->SetContainerAlgorithm(this);
   this->SynchronizedTemplates3D->SetContainerAlgorithm(this);
   this->SynchronizedTemplatesCutter3D->SetContainerAlgorithm(this);
   this->GridSynchronizedTemplates->SetContainerAlgorithm(this);
@@ -419,7 +422,22 @@ int vtkCutter::RequestData(
     }
     else
     {
-      this->UnstructuredGridCutter(input, output);
+      // For non-planar cut functions, try the multithreaded linear-grid
+      // path first: the cut function is evaluated over all points in one
+      // batched dispatch and the cells are processed in parallel through
+      // case tables by vtkContour3DLinearGrid. The path declines grids with
+      // unsupported cell types, in which case the serial per-cell path
+      // below handles the cut.
+      bool done = false;
+      if (!plane && this->GetGenerateCutScalars() == 0 && this->GetGenerateTriangles() == 1 &&
+        (this->SortBy != VTK_SORT_BY_CELL || this->GetNumberOfContours() == 1))
+      {
+        done = this->UnstructuredGrid3DLinearCutter(input, output) != 0;
+      }
+      if (!done)
+      {
+        this->UnstructuredGridCutter(input, output);
+      }
     }
   }
   else if (vtkPolyData::SafeDownCast(input))
@@ -1024,6 +1042,70 @@ void vtkCutter::UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
   output->Squeeze();
 }
 
+//------------------------------------------------------------------------------
+// Fast path for unstructured grids whose cells are all linear 3D cells:
+// evaluate the cut function over the whole points array in one batched
+// dispatch, then delegate the case-table cell processing to the
+// multithreaded vtkContour3DLinearGrid. Returns 0 if the grid cannot be
+// fully processed this way, in which case the caller falls back to
+// UnstructuredGridCutter.
+int vtkCutter::UnstructuredGrid3DLinearCutter(vtkDataSet* dataSetInput, vtkPolyData* output)
+{
+  vtkUnstructuredGrid* input = vtkUnstructuredGrid::SafeDownCast(dataSetInput);
+  if (!input || !input->GetPoints())
+  {
+    return 0;
+  }
+  vtkIdType numPts = input->GetNumberOfPoints();
+
+  vtkNew<vtkDoubleArray> cutScalars;
+  cutScalars->SetName("cutScalars");
+  cutScalars->SetNumberOfTuples(numPts);
+
+  vtkNew<vtkUnstructuredGrid> contourData;
+  contourData->ShallowCopy(input);
+  contourData->GetPointData()->AddArray(cutScalars);
+
+  // The array is checked before it is filled in so that grids with
+  // unsupported cell types do not pay for the function evaluation.
+  if (!vtkContour3DLinearGrid::CanFullyProcessDataObject(contourData, "cutScalars"))
+  {
+    return 0;
+  }
+
+  // Evaluate the cut function at all points with a single dispatch over the
+  // points array; vtkImplicitFunction parallelizes this over point batches.
+  this->CutFunction->FunctionValue(input->GetPoints()->GetData(), cutScalars);
+
+  vtkIdType numContours = this->GetNumberOfContours();
+  this->Contour3DLinearGrid->SetInputData(contourData);
+  this->Contour3DLinearGrid->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "cutScalars");
+  this->Contour3DLinearGrid->SetNumberOfContours(numContours);
+  for (int i = 0; i < numContours; i++)
+  {
+    this->Contour3DLinearGrid->SetValue(i, this->GetValue(i));
+  }
+  if (this->Locator == nullptr)
+  {
+    this->CreateDefaultLocator();
+  }
+  bool mergePoints = this->GetLocator() && !this->GetLocator()->IsA("vtkNonMergingPointLocator");
+  this->Contour3DLinearGrid->SetMergePoints(mergePoints);
+  this->Contour3DLinearGrid->InterpolateAttributesOn();
+  this->Contour3DLinearGrid->ComputeScalarsOff();
+  this->Contour3DLinearGrid->ComputeNormalsOff();
+  this->Contour3DLinearGrid->SetOutputPointsPrecision(this->OutputPointsPrecision);
+  this->Contour3DLinearGrid->Update();
+
+  output->ShallowCopy(this->Contour3DLinearGrid->GetOutput());
+  // The cut scalars were only needed to drive the contouring; they are not
+  // part of the output unless GenerateCutScalars is on, and this path is
+  // only taken when it is off.
+  output->GetPointData()->RemoveArray("cutScalars");
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 // Specify a spatial locator for merging points. By default,
 // an instance of vtkMergePoints is used.
@@ -47,6 +47,7 @@
 #define VTK_SORT_BY_CELL 1
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkContour3DLinearGrid;
 class vtkGridSynchronizedTemplates3D;
 class vtkImplicitFunction;
 class vtkIncrementalPointLocator;
@@ -223,6 +224,7 @@ protected:
   int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int FillInputPortInformation(int port, vtkInformation* info) override;
   void UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output);
+  int UnstructuredGrid3DLinearCutter(vtkDataSet* input, vtkPolyData* output);
   void DataSetCutter(vtkDataSet* input, vtkPolyData* output);
   void StructuredPointsCutter(
     vtkDataSet*, vtkPolyData*, vtkInformation*, vtkInformationVector**, vtkInformationVector*);
@@ -236,6 +238,7 @@ protected:
   vtkNew<vtkGridSynchronizedTemplates3D> GridSynchronizedTemplates;
   vtkNew<vtkRectilinearSynchronizedTemplates> RectilinearSynchronizedTemplates;
   vtkNew<vtkPlaneCutter> PlaneCutter;
+  vtkNew<vtkContour3DLinearGrid> Contour3DLinearGrid;
 
   vtkIncrementalPointLocator* Locator;
   int SortBy;
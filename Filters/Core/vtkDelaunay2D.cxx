@@ -8,6 +8,8 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
 #include "vtkPointData.h"
@@ -17,6 +19,7 @@
 #include "vtkTransform.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
 #include <set>
 #include <vector>
 
@@ -33,6 +36,7 @@ vtkDelaunay2D::vtkDelaunay2D()
   this->BoundingTriangulation = 0;
   this->Offset = 1.0;
   this->RandomPointInsertion = 0;
+  this->SpatialPointInsertion = 0;
   this->Transform = nullptr;
   this->ProjectionPlaneMode = VTK_DELAUNAY_XY_PLANE;
 
@@ -325,6 +329,127 @@ struct GCDTraversal
   // else that is going on.
   vtkIdType GetPointId(vtkIdType idx) { return ((this->Prime * idx + this->Offset) % this->NPts); }
 };
+
+//------------------------------------------------------------------------------
+// Index of 2D grid coordinates (bits of precision per axis) along a Hilbert
+// curve, following J. Skilling, "Programming the Hilbert curve" (2004).
+vtkTypeUInt64 HilbertIndex(vtkTypeUInt32 x, vtkTypeUInt32 y, int bits)
+{
+  vtkTypeUInt32 X[2] = { x, y };
+  const vtkTypeUInt32 M = 1u << (bits - 1);
+
+  // inverse undo of the excess work
+  for (vtkTypeUInt32 Q = M; Q > 1; Q >>= 1)
+  {
+    vtkTypeUInt32 P = Q - 1;
+    for (int i = 0; i < 2; i++)
+    {
+      if (X[i] & Q)
+      {
+        X[0] ^= P;
+      }
+      else
+      {
+        vtkTypeUInt32 t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  X[1] ^= X[0];
+  vtkTypeUInt32 t = 0;
+  for (vtkTypeUInt32 Q = M; Q > 1; Q >>= 1)
+  {
+    if (X[1] & Q)
+    {
+      t ^= Q - 1;
+    }
+  }
+  X[0] ^= t;
+  X[1] ^= t;
+
+  // interleave the transposed bits, X[0] carrying the most significant one
+  vtkTypeUInt64 index = 0;
+  for (int b = bits - 1; b >= 0; --b)
+  {
+    index = (index << 1) | ((X[0] >> b) & 1);
+    index = (index << 1) | ((X[1] >> b) & 1);
+  }
+  return index;
+}
+
+//------------------------------------------------------------------------------
+// Computes a biased randomized insertion order (BRIO): points are assigned
+// to rounds so that each round roughly doubles the number of points, and
+// every round is sorted along a Hilbert curve. See Amenta, Choi & Rote,
+// "Incremental constructions con BRIO" (2003). The coordinates are the mesh
+// point array (x,y,z triplets, z ignored); only the first numPoints entries
+// participate.
+void ComputeSpatialInsertionOrder(
+  const double* coords, vtkIdType numPoints, std::vector<vtkIdType>& order)
+{
+  constexpr int bits = 20;
+  constexpr double maxCoord = (1u << bits) - 1;
+
+  double bounds[4] = { VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+  for (vtkIdType id = 0; id < numPoints; id++)
+  {
+    bounds[0] = std::min(bounds[0], coords[3 * id]);
+    bounds[1] = std::max(bounds[1], coords[3 * id]);
+    bounds[2] = std::min(bounds[2], coords[3 * id + 1]);
+    bounds[3] = std::max(bounds[3], coords[3 * id + 1]);
+  }
+  const double xScale = bounds[1] > bounds[0] ? maxCoord / (bounds[1] - bounds[0]) : 0.0;
+  const double yScale = bounds[3] > bounds[2] ? maxCoord / (bounds[3] - bounds[2]) : 0.0;
+
+  int numRounds = 1;
+  while ((static_cast<vtkIdType>(1) << numRounds) < numPoints)
+  {
+    numRounds++;
+  }
+
+  vtkNew<vtkMinimalStandardRandomSequence> rng;
+  rng->SetSeed(static_cast<int>(numPoints % VTK_INT_MAX));
+  std::vector<int> rounds(numPoints);
+  std::vector<vtkTypeUInt64> keys(numPoints);
+  order.resize(numPoints);
+  for (vtkIdType id = 0; id < numPoints; id++)
+  {
+    // a point stays in the last round with probability 1/2, and so on
+    // recursively into the earlier, smaller rounds
+    int round = numRounds - 1;
+    while (round > 0)
+    {
+      const double coin = rng->GetValue();
+      rng->Next();
+      if (coin < 0.5)
+      {
+        break;
+      }
+      round--;
+    }
+    rounds[id] = round;
+    keys[id] =
+      HilbertIndex(static_cast<vtkTypeUInt32>((coords[3 * id] - bounds[0]) * xScale),
+        static_cast<vtkTypeUInt32>((coords[3 * id + 1] - bounds[2]) * yScale), bits);
+    order[id] = id;
+  }
+
+  std::sort(order.begin(), order.end(),
+    [&rounds, &keys](vtkIdType a, vtkIdType b) {
+      if (rounds[a] != rounds[b])
+      {
+        return rounds[a] < rounds[b];
+      }
+      if (keys[a] != keys[b])
+      {
+        return keys[a] < keys[b];
+      }
+      return a < b;
+    });
+}
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -516,9 +641,16 @@ int vtkDelaunay2D::RequestData(vtkInformation* vtkNotUsed(request),
   // traversed in given order, or pseudo-random order.
   //
   GCDTraversal gcdIter(numPoints);
+  std::vector<vtkIdType> spatialOrder;
+  if (this->SpatialPointInsertion)
+  {
+    ComputeSpatialInsertionOrder(this->Points, numPoints, spatialOrder);
+  }
   for (auto idx = 0; idx < numPoints; idx++)
   {
-    ptId = (this->RandomPointInsertion ? gcdIter.GetPointId(idx) : idx);
+    ptId = (this->SpatialPointInsertion
+        ? spatialOrder[idx]
+        : (this->RandomPointInsertion ? gcdIter.GetPointId(idx) : idx));
     this->GetPoint(ptId, x);
     nei[0] = (-1); // where we are coming from...nowhere initially
 
@@ -1641,6 +1773,8 @@ void vtkDelaunay2D::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Tolerance: " << this->Tolerance << "\n";
   os << indent << "Offset: " << this->Offset << "\n";
   os << indent << "Random Point Insertion: " << (this->RandomPointInsertion ? "On" : "Off") << "\n";
+  os << indent << "Spatial Point Insertion: " << (this->SpatialPointInsertion ? "On" : "Off")
+     << "\n";
   os << indent << "Bounding Triangulation: " << (this->BoundingTriangulation ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
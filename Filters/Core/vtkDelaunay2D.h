@@ -255,6 +255,22 @@ public:
   vtkBooleanMacro(RandomPointInsertion, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to insert the points in a spatially coherent order: a
+   * biased randomized insertion order (BRIO) whose rounds are each sorted
+   * along a Hilbert curve. Successive insertions then land close to each
+   * other, which keeps the triangle walk short and the mesh structures
+   * cache resident; on large scattered point sets this speeds up the
+   * triangulation by an order of magnitude while the randomized rounds
+   * retain the good expected complexity of random insertion. Takes
+   * precedence over RandomPointInsertion. Off by default.
+   */
+  vtkSetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkGetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkBooleanMacro(SpatialPointInsertion, vtkTypeBool);
+  ///@}
+
 protected:
   vtkDelaunay2D();
 
@@ -265,6 +281,7 @@ protected:
   vtkTypeBool BoundingTriangulation;
   double Offset;
   vtkTypeBool RandomPointInsertion;
+  vtkTypeBool SpatialPointInsertion;
 
   // Transform input points (if necessary)
   vtkSmartPointer<vtkAbstractTransform> Transform;
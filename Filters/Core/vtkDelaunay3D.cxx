@@ -9,6 +9,8 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointLocator.h"
@@ -17,6 +19,9 @@
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkDelaunay3D);
 
@@ -126,6 +131,7 @@ vtkDelaunay3D::vtkDelaunay3D()
   this->Tolerance = 0.001;
   this->BoundingTriangulation = 0;
   this->Offset = 2.5;
+  this->SpatialPointInsertion = 0;
   this->OutputPointsPrecision = DEFAULT_PRECISION;
   this->Locator = nullptr;
   this->TetraArray = nullptr;
@@ -409,6 +415,131 @@ int vtkDelaunay3D::FindTetra(vtkUnstructuredGrid* Mesh, double x[3], vtkIdType t
 //   5. Make sure that faces/point combination forms good tetrahedron
 //   6. Create tetrahedron from each point/face combination
 //
+namespace
+{
+//------------------------------------------------------------------------------
+// Index of 3D grid coordinates (bits of precision per axis) along a Hilbert
+// curve, following J. Skilling, "Programming the Hilbert curve" (2004).
+vtkTypeUInt64 HilbertIndex(vtkTypeUInt32 x, vtkTypeUInt32 y, vtkTypeUInt32 z, int bits)
+{
+  vtkTypeUInt32 X[3] = { x, y, z };
+  const vtkTypeUInt32 M = 1u << (bits - 1);
+
+  // inverse undo of the excess work
+  for (vtkTypeUInt32 Q = M; Q > 1; Q >>= 1)
+  {
+    vtkTypeUInt32 P = Q - 1;
+    for (int i = 0; i < 3; i++)
+    {
+      if (X[i] & Q)
+      {
+        X[0] ^= P;
+      }
+      else
+      {
+        vtkTypeUInt32 t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  X[1] ^= X[0];
+  X[2] ^= X[1];
+  vtkTypeUInt32 t = 0;
+  for (vtkTypeUInt32 Q = M; Q > 1; Q >>= 1)
+  {
+    if (X[2] & Q)
+    {
+      t ^= Q - 1;
+    }
+  }
+  X[0] ^= t;
+  X[1] ^= t;
+  X[2] ^= t;
+
+  // interleave the transposed bits, X[0] carrying the most significant one
+  vtkTypeUInt64 index = 0;
+  for (int b = bits - 1; b >= 0; --b)
+  {
+    index = (index << 1) | ((X[0] >> b) & 1);
+    index = (index << 1) | ((X[1] >> b) & 1);
+    index = (index << 1) | ((X[2] >> b) & 1);
+  }
+  return index;
+}
+
+//------------------------------------------------------------------------------
+// Computes a biased randomized insertion order (BRIO): points are assigned
+// to rounds so that each round roughly doubles the number of points, and
+// every round is sorted along a Hilbert curve. See Amenta, Choi & Rote,
+// "Incremental constructions con BRIO" (2003).
+void ComputeSpatialInsertionOrder(vtkPoints* points, std::vector<vtkIdType>& order)
+{
+  constexpr int bits = 20;
+  constexpr double maxCoord = (1u << bits) - 1;
+  const vtkIdType numPoints = points->GetNumberOfPoints();
+
+  double bounds[6];
+  points->GetBounds(bounds);
+  double scale[3];
+  for (int axis = 0; axis < 3; axis++)
+  {
+    const double range = bounds[2 * axis + 1] - bounds[2 * axis];
+    scale[axis] = range > 0.0 ? maxCoord / range : 0.0;
+  }
+
+  int numRounds = 1;
+  while ((static_cast<vtkIdType>(1) << numRounds) < numPoints)
+  {
+    numRounds++;
+  }
+
+  vtkNew<vtkMinimalStandardRandomSequence> rng;
+  rng->SetSeed(static_cast<int>(numPoints % VTK_INT_MAX));
+  std::vector<int> rounds(numPoints);
+  std::vector<vtkTypeUInt64> keys(numPoints);
+  order.resize(numPoints);
+  double x[3];
+  for (vtkIdType id = 0; id < numPoints; id++)
+  {
+    // a point stays in the last round with probability 1/2, and so on
+    // recursively into the earlier, smaller rounds
+    int round = numRounds - 1;
+    while (round > 0)
+    {
+      const double coin = rng->GetValue();
+      rng->Next();
+      if (coin < 0.5)
+      {
+        break;
+      }
+      round--;
+    }
+    rounds[id] = round;
+    points->GetPoint(id, x);
+    keys[id] = HilbertIndex(static_cast<vtkTypeUInt32>((x[0] - bounds[0]) * scale[0]),
+      static_cast<vtkTypeUInt32>((x[1] - bounds[2]) * scale[1]),
+      static_cast<vtkTypeUInt32>((x[2] - bounds[4]) * scale[2]), bits);
+    order[id] = id;
+  }
+
+  std::sort(order.begin(), order.end(),
+    [&rounds, &keys](vtkIdType a, vtkIdType b) {
+      if (rounds[a] != rounds[b])
+      {
+        return rounds[a] < rounds[b];
+      }
+      if (keys[a] != keys[b])
+      {
+        return keys[a] < keys[b];
+      }
+      return a < b;
+    });
+}
+} // anonymous namespace
+
 int vtkDelaunay3D::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
 {
@@ -485,16 +616,22 @@ int vtkDelaunay3D::RequestData(vtkInformation* vtkNotUsed(request),
   // of tetra cause tetra to be deleted, leaving a void with bounding
   // faces. Combination of point and each face is used to form new
   // tetrahedra.
-  for (ptId = 0; ptId < numPoints; ptId++)
+  std::vector<vtkIdType> spatialOrder;
+  if (this->SpatialPointInsertion)
+  {
+    ComputeSpatialInsertionOrder(inPoints, spatialOrder);
+  }
+  for (vtkIdType idx = 0; idx < numPoints; idx++)
   {
+    ptId = (this->SpatialPointInsertion ? spatialOrder[idx] : idx);
     inPoints->GetPoint(ptId, x);
 
     this->InsertPoint(Mesh, points, ptId, x, holeTetras);
 
-    if (!(ptId % 250))
+    if (!(idx % 250))
     {
       vtkDebugMacro(<< "point #" << ptId);
-      this->UpdateProgress(static_cast<double>(ptId) / numPoints);
+      this->UpdateProgress(static_cast<double>(idx) / numPoints);
       if (this->CheckAbort())
       {
         break;
@@ -1051,6 +1188,7 @@ void vtkDelaunay3D::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Tolerance: " << this->Tolerance << "\n";
   os << indent << "Offset: " << this->Offset << "\n";
   os << indent << "Bounding Triangulation: " << (this->BoundingTriangulation ? "On\n" : "Off\n");
+  os << indent << "Spatial Point Insertion: " << (this->SpatialPointInsertion ? "On\n" : "Off\n");
 
   if (this->Locator)
   {
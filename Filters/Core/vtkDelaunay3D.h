@@ -186,6 +186,22 @@ public:
   vtkBooleanMacro(BoundingTriangulation, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to insert the points in a spatially coherent order: a
+   * biased randomized insertion order (BRIO) whose rounds are each sorted
+   * along a Hilbert curve. Successive insertions then land close to each
+   * other, which keeps the tetrahedron search short and the mesh
+   * structures cache resident; on large scattered point sets this speeds
+   * up the triangulation by an order of magnitude while the randomized
+   * rounds retain the good expected complexity of random insertion. Off
+   * by default.
+   */
+  vtkSetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkGetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkBooleanMacro(SpatialPointInsertion, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set / get a spatial locator for merging points. By default,
@@ -266,6 +282,7 @@ protected:
   double Tolerance;
   vtkTypeBool BoundingTriangulation;
   double Offset;
+  vtkTypeBool SpatialPointInsertion;
   int OutputPointsPrecision;
 
   vtkIncrementalPointLocator* Locator; // help locate points faster
@@ -12,6 +12,7 @@
 #include "vtkInformation.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkParallelAlgorithms.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
@@ -70,6 +71,17 @@ struct SubsetCellsWork
   inline vtkIdType GetPointId(vtkIdType id) const { return this->PointMapPtr[id]; }
 };
 
+struct SubsetCellsPassPointsWork
+{
+  const vtkIdType* CellListPtr;
+  vtkIdType NumberOfCells;
+
+  inline vtkIdType GetNumberOfCells() const { return this->NumberOfCells; }
+  inline vtkIdType GetCellId(vtkIdType index) const { return this->CellListPtr[index]; }
+  // The output shares the input points, so point ids pass through unchanged.
+  inline vtkIdType GetPointId(vtkIdType id) const { return id; }
+};
+
 struct SubsetPointsWork
 {
   const vtkSmartPointer<vtkIdList>& PointIdsToExtract;
@@ -467,9 +479,7 @@ public:
     }
     if (!self->GetAssumeSortedAndUniqueIds() && (self->GetMTime() > this->SortTime))
     {
-      vtkSMPTools::Sort(this->begin(), this->end());
-      auto last = std::unique(this->begin(), this->end());
-      this->SetNumberOfIds(static_cast<vtkIdType>(std::distance(this->begin(), last)));
+      this->SetNumberOfIds(vtk::ParallelSortUnique(this->begin(), this->end()));
       this->SortTime.Modified();
     }
     // check if ids larger than number of cells exist or negative.
@@ -643,6 +653,41 @@ int vtkExtractCells::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
+  // With PassPoints, the output adopts the input points and point data by
+  // reference and only the cell subset is materialized.
+  auto inputPS = vtkPointSet::SafeDownCast(input);
+  if (this->PassPoints && inputPS)
+  {
+    output->SetPoints(inputPS->GetPoints());
+    outPD->PassData(inPD);
+    outCD->CopyAllocate(inCD, outputNumbCells);
+    outCD->CopyData(inCD, this->CellList);
+
+    const SubsetCellsPassPointsWork passWork{ this->CellList->GetPointer(0), outputNumbCells };
+    if (this->PassThroughCellIds)
+    {
+      ::AddOriginalCellIds(outCD, passWork);
+    }
+    this->UpdateProgress(0.5);
+    if (this->CheckAbort())
+    {
+      return 1;
+    }
+
+    auto passCells = ::ExtractCells(input, passWork, this->BatchSize);
+    auto passInputUG = vtkUnstructuredGrid::SafeDownCast(input);
+    if (passInputUG && passInputUG->GetPolyhedronFaces() &&
+      passInputUG->GetPolyhedronFaceLocations() &&
+      passInputUG->GetPolyhedronFaceLocations()->GetOffsetsArray()->GetRange(0)[1] != 0)
+    {
+      ::ExtractPolyhedralFaces(passCells, passInputUG, passWork);
+    }
+    output->SetPolyhedralCells(
+      passCells.CellTypes, passCells.Connectivity, passCells.PolyFaceLocations, passCells.PolyFaces);
+    this->UpdateProgress(1.00);
+    return 1;
+  }
+
   // Build point map for selected cells.
   vtkIdType outputNumPoints;
   const auto pointMap = ::GeneratePointMap(input, this->CellList, outputNumPoints);
@@ -761,5 +806,6 @@ void vtkExtractCells::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "ExtractAllCells: " << this->ExtractAllCells << endl;
   os << indent << "AssumeSortedAndUniqueIds: " << this->AssumeSortedAndUniqueIds << endl;
+  os << indent << "PassPoints: " << this->PassPoints << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -105,6 +105,22 @@ public:
   vtkBooleanMacro(PassThroughCellIds, bool);
   ///@}
 
+  ///@{
+  /**
+   * If on and the input is a vtkPointSet, the output shares the input points
+   * and point data by reference instead of extracting the subset of points
+   * used by the selected cells; the output connectivity then refers to the
+   * original point ids. This skips the point map and point copies entirely,
+   * which pays off when repeatedly extracting small cell subsets from the
+   * same large dataset (e.g. interactive brushing). The output may reference
+   * points that no output cell uses. Ignored for inputs with implicit points
+   * (e.g. vtkImageData). Defaults to false.
+   */
+  vtkSetMacro(PassPoints, bool);
+  vtkGetMacro(PassPoints, bool);
+  vtkBooleanMacro(PassPoints, bool);
+  ///@}
+
   ///@{
   /**
    * Set/get the desired precision for the output types. See the documentation
@@ -139,6 +155,7 @@ protected:
   bool ExtractAllCells = false;
   bool AssumeSortedAndUniqueIds = false;
   bool PassThroughCellIds = true;
+  bool PassPoints = false;
   int OutputPointsPrecision = DEFAULT_PRECISION;
   unsigned int BatchSize = 1000;
 
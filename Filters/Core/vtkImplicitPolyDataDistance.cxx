@@ -5,10 +5,12 @@
 #include "vtkCellData.h"
 #include "vtkCellLocator.h"
 #include "vtkCleanPolyData.h"
+#include "vtkDoubleArray.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTriangleFilter.h"
 
@@ -60,6 +62,8 @@ void vtkImplicitPolyDataDistance::SetInput(vtkPolyData* input)
     this->Input->BuildLinks();
     this->NoValue = this->Input->GetLength();
 
+    this->BuildPseudonormals();
+
     this->CreateDefaultLocator();
     this->Locator->SetDataSet(this->Input);
     this->Locator->SetTolerance(this->Tolerance);
@@ -104,6 +108,97 @@ void vtkImplicitPolyDataDistance::CreateDefaultLocator()
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkImplicitPolyDataDistance::BuildPseudonormals()
+{
+  const vtkIdType numCells = this->Input->GetNumberOfCells();
+  const vtkIdType numPts = this->Input->GetNumberOfPoints();
+
+  // Per-cell normals. Normals provided on the input are reused, otherwise
+  // they are computed from the cell geometry.
+  this->CellNormals = vtkSmartPointer<vtkDoubleArray>::New();
+  this->CellNormals->SetNumberOfComponents(3);
+  this->CellNormals->SetNumberOfTuples(numCells);
+
+  vtkDataArray* cnorms = nullptr;
+  if (this->Input->GetCellData() && this->Input->GetCellData()->GetNormals())
+  {
+    cnorms = this->Input->GetCellData()->GetNormals();
+  }
+
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    auto cell = tlCell.Local();
+    double norm[3];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      if (cnorms)
+      {
+        cnorms->GetTuple(cellId, norm);
+      }
+      else
+      {
+        this->Input->GetCell(cellId, cell);
+        vtkPolygon::ComputeNormal(cell->GetPoints(), norm);
+      }
+      this->CellNormals->SetTuple(cellId, norm);
+    }
+  });
+
+  // Per-vertex angle-weighted pseudonormals, accumulated cell by cell so
+  // that each query only needs a single lookup (Baerentzen and Aanaes).
+  this->PointPseudonormals = vtkSmartPointer<vtkDoubleArray>::New();
+  this->PointPseudonormals->SetNumberOfComponents(3);
+  this->PointPseudonormals->SetNumberOfTuples(numPts);
+  this->PointPseudonormals->Fill(0.0);
+
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    vtkIdType npts;
+    const vtkIdType* ptIds;
+    this->Input->GetCellPoints(cellId, npts, ptIds);
+    if (npts != 3)
+    {
+      continue;
+    }
+
+    double norm[3];
+    this->CellNormals->GetTuple(cellId, norm);
+    for (int i = 0; i < 3; i++)
+    {
+      const vtkIdType a = ptIds[i];
+      double pa[3], pb[3], pc[3];
+      this->Input->GetPoint(a, pa);
+      this->Input->GetPoint(ptIds[(i + 1) % 3], pb);
+      this->Input->GetPoint(ptIds[(i + 2) % 3], pc);
+      for (int j = 0; j < 3; j++)
+      {
+        pb[j] -= pa[j];
+        pc[j] -= pa[j];
+      }
+      vtkMath::Normalize(pb);
+      vtkMath::Normalize(pc);
+      const double alpha = std::acos(vtkMath::Dot(pb, pc));
+
+      double pseudonormal[3];
+      this->PointPseudonormals->GetTuple(a, pseudonormal);
+      for (int j = 0; j < 3; j++)
+      {
+        pseudonormal[j] += alpha * norm[j];
+      }
+      this->PointPseudonormals->SetTuple(a, pseudonormal);
+    }
+  }
+
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double pseudonormal[3];
+    this->PointPseudonormals->GetTuple(ptId, pseudonormal);
+    vtkMath::Normalize(pseudonormal);
+    this->PointPseudonormals->SetTuple(ptId, pseudonormal);
+  }
+}
+
 //------------------------------------------------------------------------------
 double vtkImplicitPolyDataDistance::EvaluateFunction(double x[3])
 {
@@ -158,12 +253,6 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
   int subId;
   double vlen2;
 
-  vtkDataArray* cnorms = nullptr;
-  if (this->Input->GetCellData() && this->Input->GetCellData()->GetNormals())
-  {
-    cnorms = this->Input->GetCellData()->GetNormals();
-  }
-
   // Get point id of closest point in data set.
   auto cell = this->TLCell.Local();
   this->Locator->FindClosestPoint(x, p, cell, cellId, subId, vlen2);
@@ -190,15 +279,8 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
     // Face case - weights contains no 0s
     if (count == 0)
     {
-      // Compute face normal.
-      if (cnorms)
-      {
-        cnorms->GetTuple(cellId, awnorm);
-      }
-      else
-      {
-        vtkPolygon::ComputeNormal(cell->Points, awnorm);
-      }
+      // Look up the precomputed face normal.
+      this->CellNormals->GetTuple(cellId, awnorm);
     }
     // Edge case - weights contain one 0
     else if (count == 1)
@@ -228,15 +310,7 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
       for (int i = 0; i < idList->GetNumberOfIds(); i++)
       {
         double norm[3];
-        if (cnorms)
-        {
-          cnorms->GetTuple(idList->GetId(i), norm);
-        }
-        else
-        {
-          this->Input->GetCell(idList->GetId(i), cell);
-          vtkPolygon::ComputeNormal(cell->GetPoints(), norm);
-        }
+        this->CellNormals->GetTuple(idList->GetId(i), norm);
         awnorm[0] += norm[0];
         awnorm[1] += norm[1];
         awnorm[2] += norm[2];
@@ -266,48 +340,9 @@ double vtkImplicitPolyDataDistance::SharedEvaluate(double x[3], double g[3], dou
         return this->NoValue;
       }
 
-      this->Input->GetPointCells(a, idList);
-      for (int i = 0; i < idList->GetNumberOfIds(); i++)
-      {
-        double norm[3];
-        this->Input->GetCell(idList->GetId(i), cell);
-        if (cnorms)
-        {
-          cnorms->GetTuple(idList->GetId(i), norm);
-        }
-        else
-        {
-          vtkPolygon::ComputeNormal(cell->GetPoints(), norm);
-        }
-
-        // Compute angle at point a
-        int b = cell->GetPointId(0);
-        int c = cell->GetPointId(1);
-        if (a == b)
-        {
-          b = cell->GetPointId(2);
-        }
-        else if (a == c)
-        {
-          c = cell->GetPointId(2);
-        }
-        double pa[3], pb[3], pc[3];
-        this->Input->GetPoint(a, pa);
-        this->Input->GetPoint(b, pb);
-        this->Input->GetPoint(c, pc);
-        for (int j = 0; j < 3; j++)
-        {
-          pb[j] -= pa[j];
-          pc[j] -= pa[j];
-        }
-        vtkMath::Normalize(pb);
-        vtkMath::Normalize(pc);
-        double alpha = std::acos(vtkMath::Dot(pb, pc));
-        awnorm[0] += alpha * norm[0];
-        awnorm[1] += alpha * norm[1];
-        awnorm[2] += alpha * norm[2];
-      }
-      vtkMath::Normalize(awnorm);
+      // Look up the angle-weighted pseudonormal precomputed in
+      // BuildPseudonormals.
+      this->PointPseudonormals->GetTuple(a, awnorm);
     }
 
     // sign(dist) = dot(grad, cell normal)
@@ -32,9 +32,11 @@
 #include "vtkGenericCell.h"       // For thread local storage
 #include "vtkImplicitFunction.h"
 #include "vtkSMPThreadLocalObject.h" // For thread local storage
+#include "vtkSmartPointer.h"         // For precomputed normal arrays
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellLocator;
+class vtkDoubleArray;
 class vtkPolyData;
 
 class VTKFILTERSCORE_EXPORT vtkImplicitPolyDataDistance : public vtkImplicitFunction
@@ -51,6 +53,10 @@ public:
 
   /**
    * Evaluate plane equation of nearest triangle to point x[3].
+   * The vtkDataArray overload inherited from vtkImplicitFunction evaluates
+   * many points at once with SMP parallelism; per-query scratch state is
+   * kept in thread-local storage and the face and vertex pseudonormals are
+   * precomputed in SetInput, so concurrent evaluation is safe and cheap.
    */
   using vtkImplicitFunction::EvaluateFunction;
   double EvaluateFunction(double x[3]) override;
@@ -118,6 +124,13 @@ protected:
    */
   void CreateDefaultLocator();
 
+  /**
+   * Precompute the per-cell normals and the angle-weighted per-vertex
+   * pseudonormals of the input. Called from SetInput so that each query in
+   * SharedEvaluate only looks the normals up instead of recomputing them.
+   */
+  void BuildPseudonormals();
+
   double SharedEvaluate(double x[3], double g[3], double closestPoint[3]);
 
   double NoGradient[3];
@@ -127,6 +140,8 @@ protected:
 
   vtkPolyData* Input;
   vtkCellLocator* Locator;
+  vtkSmartPointer<vtkDoubleArray> CellNormals;
+  vtkSmartPointer<vtkDoubleArray> PointPseudonormals;
   vtkSMPThreadLocalObject<vtkGenericCell> TLCell;
   vtkSMPThreadLocalObject<vtkIdList> TLCellIds;
 
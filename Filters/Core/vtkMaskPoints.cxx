@@ -15,11 +15,16 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <random>
+#include <utility>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -31,6 +36,82 @@ inline double d_rand()
   return rand() / (double)((unsigned long)RAND_MAX + 1);
 }
 
+//------------------------------------------------------------------------------
+// Stateless hash (the splitmix64 finalizer) giving every point a reproducible
+// pseudo-random key from the seed and the point id alone. Keeping the points
+// with the smallest keys yields a uniform random sample without replacement
+// whose content cannot depend on the number of threads.
+inline vtkTypeUInt64 PointKey(vtkTypeUInt64 seed, vtkTypeUInt64 ptId)
+{
+  vtkTypeUInt64 z = ptId + 0x9E3779B97F4A7C15ULL * (seed + 1);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+//------------------------------------------------------------------------------
+// Every thread keeps the SampleSize smallest keys it has seen in a max-heap;
+// Reduce() merges the per-thread heaps and orders the winning point ids by
+// input order.
+struct BottomKSampler
+{
+  using Entry = std::pair<vtkTypeUInt64, vtkIdType>;
+
+  vtkIdType SampleSize;
+  int Seed;
+  std::vector<vtkIdType>& SampledIds;
+  vtkSMPThreadLocal<std::vector<Entry>> Heaps;
+
+  BottomKSampler(vtkIdType sampleSize, int seed, std::vector<vtkIdType>& sampledIds)
+    : SampleSize(sampleSize)
+    , Seed(seed)
+    , SampledIds(sampledIds)
+  {
+  }
+
+  void Initialize() { this->Heaps.Local().reserve(this->SampleSize); }
+
+  void operator()(vtkIdType beginPtId, vtkIdType endPtId)
+  {
+    std::vector<Entry>& heap = this->Heaps.Local();
+    for (vtkIdType ptId = beginPtId; ptId < endPtId; ++ptId)
+    {
+      Entry entry(PointKey(this->Seed, ptId), ptId);
+      if (static_cast<vtkIdType>(heap.size()) < this->SampleSize)
+      {
+        heap.push_back(entry);
+        std::push_heap(heap.begin(), heap.end());
+      }
+      else if (entry < heap.front())
+      {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = entry;
+        std::push_heap(heap.begin(), heap.end());
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    std::vector<Entry> merged;
+    for (std::vector<Entry>& heap : this->Heaps)
+    {
+      merged.insert(merged.end(), heap.begin(), heap.end());
+    }
+    if (static_cast<vtkIdType>(merged.size()) > this->SampleSize)
+    {
+      std::nth_element(merged.begin(), merged.begin() + this->SampleSize, merged.end());
+      merged.resize(this->SampleSize);
+    }
+    this->SampledIds.reserve(merged.size());
+    for (const Entry& entry : merged)
+    {
+      this->SampledIds.push_back(entry.second);
+    }
+    std::sort(this->SampledIds.begin(), this->SampledIds.end());
+  }
+};
+
 //------------------------------------------------------------------------------
 inline void SwapPoint(
   vtkPoints* points, vtkPointData* data, vtkPointData* temp, vtkIdType a, vtkIdType b)
@@ -747,6 +828,31 @@ int vtkMaskPoints::RequestData(vtkInformation* vtkNotUsed(request),
         }
         break;
       }
+      case PARALLEL_RANDOM_SAMPLING:
+      {
+        if (localMaxPts > 0)
+        {
+          std::vector<vtkIdType> sampledIds;
+          BottomKSampler sampler(localMaxPts, this->RandomSeed, sampledIds);
+          vtkSMPTools::For(0, numPts, sampler);
+
+          for (vtkIdType ptId : sampledIds)
+          {
+            input->GetPoint(ptId, x);
+            id = newPts->InsertNextPoint(x);
+            outputPD->CopyData(pd, ptId, id);
+            if (!(id % progressInterval)) // abort/progress
+            {
+              this->UpdateProgress(0.5 * id / numPts);
+              if (this->CheckAbort())
+              {
+                break;
+              }
+            }
+          }
+        }
+        break;
+      }
       default:
         vtkWarningMacro("Unsupported random mode type.");
         break;
@@ -34,7 +34,8 @@ public:
     SPATIALLY_STRATIFIED,
     UNIFORM_SPATIAL_BOUNDS,
     UNIFORM_SPATIAL_SURFACE,
-    UNIFORM_SPATIAL_VOLUME
+    UNIFORM_SPATIAL_VOLUME,
+    PARALLEL_RANDOM_SAMPLING
   };
 
   static vtkMaskPoints* New();
@@ -114,8 +115,14 @@ public:
    * 5 - spatially uniform (volume based): points randomly sampled via an
    * inverse transform on volume area of each cell.
    * Note that 2D cells are ignored.
+   * 6 - parallel random sample: create a statistically random sample by
+   * giving every point a pseudo-random key derived only from RandomSeed
+   * and the point id, and keeping the points with the smallest keys.
+   * Runs multithreaded via vtkSMPTools and produces the same sample for
+   * a given seed regardless of the number of threads.
+   * (OnRatio and Offset are ignored) O(N)
    */
-  vtkSetClampMacro(RandomModeType, int, RANDOMIZED_ID_STRIDES, UNIFORM_SPATIAL_VOLUME);
+  vtkSetClampMacro(RandomModeType, int, RANDOMIZED_ID_STRIDES, PARALLEL_RANDOM_SAMPLING);
   vtkGetMacro(RandomModeType, int);
   ///@}
 
@@ -47,6 +47,13 @@ vtkPolyDataConnectivityFilter::vtkPolyDataConnectivityFilter()
   this->VisitedPointIds = vtkIdList::New();
 
   this->OutputPointsPrecision = DEFAULT_PRECISION;
+
+  this->CacheRegionLabels = 0;
+  this->RegionLabelCacheInput = nullptr;
+  this->RegionLabelCacheMTime = 0;
+  this->CachedRegionNumber = 0;
+  this->CachedPointNumber = 0;
+  this->CachedLargestRegionId = 0;
 }
 
 vtkPolyDataConnectivityFilter::~vtkPolyDataConnectivityFilter()
@@ -178,32 +185,95 @@ int vtkPolyDataConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(reques
     this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION)
   { // visit all cells marking with region number
-    for (cellId = 0; cellId < numCells; cellId++)
+    // The labeling depends only on the connectivity (unless scalar
+    // connectivity is involved), so it may be reused across executions.
+    const bool cacheUsable = (this->CacheRegionLabels != 0) && (this->InScalars == nullptr);
+    vtkMTimeType connMTime = 0;
+    if (cacheUsable)
     {
-      if (cellId && !(cellId % 5000))
+      for (vtkCellArray* ca :
+        { input->GetVerts(), input->GetLines(), input->GetPolys(), input->GetStrips() })
       {
-        this->UpdateProgress(0.1 + 0.8 * cellId / numCells);
-        if (this->CheckAbort())
+        if (ca && ca->GetMTime() > connMTime)
         {
-          break;
+          connMTime = ca->GetMTime();
         }
       }
+    }
 
-      if (this->Visited[cellId] < 0)
+    if (cacheUsable && this->RegionLabelCacheInput == input &&
+      this->RegionLabelCacheMTime == connMTime && connMTime != 0 &&
+      static_cast<vtkIdType>(this->CachedVisited.size()) == numCells &&
+      static_cast<vtkIdType>(this->CachedPointMap.size()) == numPts)
+    {
+      // Connectivity unchanged since the previous execution: restore the
+      // labeling instead of re-traversing the mesh.
+      std::copy(this->CachedVisited.begin(), this->CachedVisited.end(), this->Visited);
+      std::copy(this->CachedPointMap.begin(), this->CachedPointMap.end(), this->PointMap);
+      vtkIdTypeArray* newScalars = vtkArrayDownCast<vtkIdTypeArray>(this->NewScalars);
+      for (i = 0; i < this->CachedPointNumber; i++)
+      {
+        newScalars->SetValue(i, this->CachedPointRegionIds[i]);
+      }
+      this->RegionSizes->DeepCopy(this->CachedRegionSizes);
+      this->RegionNumber = this->CachedRegionNumber;
+      this->PointNumber = this->CachedPointNumber;
+      largestRegionId = this->CachedLargestRegionId;
+      this->UpdateProgress(0.9);
+    }
+    else
+    {
+      bool aborted = false;
+      for (cellId = 0; cellId < numCells; cellId++)
       {
-        this->NumCellsInRegion = 0;
-        this->Wave.push_back(cellId);
-        this->TraverseAndMark();
+        if (cellId && !(cellId % 5000))
+        {
+          this->UpdateProgress(0.1 + 0.8 * cellId / numCells);
+          if (this->CheckAbort())
+          {
+            aborted = true;
+            break;
+          }
+        }
 
-        if (this->NumCellsInRegion > maxCellsInRegion)
+        if (this->Visited[cellId] < 0)
         {
-          maxCellsInRegion = this->NumCellsInRegion;
-          largestRegionId = this->RegionNumber;
+          this->NumCellsInRegion = 0;
+          this->Wave.push_back(cellId);
+          this->TraverseAndMark();
+
+          if (this->NumCellsInRegion > maxCellsInRegion)
+          {
+            maxCellsInRegion = this->NumCellsInRegion;
+            largestRegionId = this->RegionNumber;
+          }
+
+          this->RegionSizes->InsertValue(this->RegionNumber++, this->NumCellsInRegion);
+          this->Wave.clear();
+          this->Wave2.clear();
         }
+      }
 
-        this->RegionSizes->InsertValue(this->RegionNumber++, this->NumCellsInRegion);
-        this->Wave.clear();
-        this->Wave2.clear();
+      if (cacheUsable && !aborted)
+      {
+        this->CachedVisited.assign(this->Visited, this->Visited + numCells);
+        this->CachedPointMap.assign(this->PointMap, this->PointMap + numPts);
+        vtkIdTypeArray* newScalars = vtkArrayDownCast<vtkIdTypeArray>(this->NewScalars);
+        this->CachedPointRegionIds.resize(this->PointNumber);
+        for (i = 0; i < this->PointNumber; i++)
+        {
+          this->CachedPointRegionIds[i] = newScalars->GetValue(i);
+        }
+        if (!this->CachedRegionSizes)
+        {
+          this->CachedRegionSizes = vtkSmartPointer<vtkIdTypeArray>::New();
+        }
+        this->CachedRegionSizes->DeepCopy(this->RegionSizes);
+        this->CachedRegionNumber = this->RegionNumber;
+        this->CachedPointNumber = this->PointNumber;
+        this->CachedLargestRegionId = largestRegionId;
+        this->RegionLabelCacheInput = input;
+        this->RegionLabelCacheMTime = connMTime;
       }
     }
   }
@@ -675,5 +745,7 @@ void vtkPolyDataConnectivityFilter::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+
+  os << indent << "Cache Region Labels: " << (this->CacheRegionLabels ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
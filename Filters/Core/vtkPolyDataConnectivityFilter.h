@@ -40,6 +40,7 @@
 
 #include "vtkFiltersCoreModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
+#include "vtkSmartPointer.h" // For the cached region labeling
 
 #define VTK_EXTRACT_POINT_SEEDED_REGIONS 1
 #define VTK_EXTRACT_CELL_SEEDED_REGIONS 2
@@ -206,6 +207,23 @@ public:
   vtkGetObjectMacro(VisitedPointIds, vtkIdList);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to keep the region labeling alive across filter
+   * executions. When on, and the input connectivity has not changed since
+   * the previous execution, the connected-wave traversal is skipped and the
+   * cached labels are reused, so repeated executions over a time series
+   * where only the point positions or attribute arrays vary (e.g., in situ)
+   * only pay for the output extraction. The labeling is recomputed whenever
+   * the connectivity changes. The cache is not used with ScalarConnectivity
+   * or with the seeded and closest-point extraction modes, since the labels
+   * then depend on more than the topology. Default is off.
+   */
+  vtkSetMacro(CacheRegionLabels, vtkTypeBool);
+  vtkGetMacro(CacheRegionLabels, vtkTypeBool);
+  vtkBooleanMacro(CacheRegionLabels, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set/get the desired precision for the output types. See the documentation
@@ -261,6 +279,19 @@ protected:
   vtkTypeBool MarkVisitedPointIds;
   int OutputPointsPrecision;
 
+  // Cached region labeling used when CacheRegionLabels is on. The previous
+  // input is only compared as a pointer, never dereferenced.
+  vtkTypeBool CacheRegionLabels;
+  vtkPolyData* RegionLabelCacheInput;
+  vtkMTimeType RegionLabelCacheMTime;
+  std::vector<vtkIdType> CachedVisited;
+  std::vector<vtkIdType> CachedPointMap;
+  std::vector<vtkIdType> CachedPointRegionIds;
+  vtkSmartPointer<vtkIdTypeArray> CachedRegionSizes;
+  vtkIdType CachedRegionNumber;
+  vtkIdType CachedPointNumber;
+  vtkIdType CachedLargestRegionId;
+
 private:
   vtkPolyDataConnectivityFilter(const vtkPolyDataConnectivityFilter&) = delete;
   void operator=(const vtkPolyDataConnectivityFilter&) = delete;
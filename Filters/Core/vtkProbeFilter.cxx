@@ -665,13 +665,18 @@ void vtkProbeFilter::ProbeEmptyPoints(
   auto sourceGhostFlags = vtkUnsignedCharArray::SafeDownCast(
     source->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()));
 
-  // lets use a stack allocated array if possible for performance reasons
-  int maxCellSize = source->GetMaxCellSize();
-
-  outPD = output->GetPointData();
-
-  if (this->ComputeTolerance)
+  // GetMaxCellSize() scans every cell and the tolerance estimate below
+  // touches the first cells, so when the same source is probed repeatedly
+  // (e.g. many point clouds probed into one static mesh), recomputing them
+  // on every execution is pure overhead. Cache both, keyed on the source's
+  // identity and MTime.
+  if (source != this->ProbeContextSource || source->GetMTime() != this->ProbeContextMTime)
   {
+    this->ProbeContextSource = source;
+    this->ProbeContextMTime = source->GetMTime();
+    // lets use a stack allocated array if possible for performance reasons
+    this->ProbeContextMaxCellSize = source->GetMaxCellSize();
+
     // to compute a reasonable starting tolerance we use
     // a fraction of the largest cell length we come across
     // out of the first few cells. Tolerance is meant
@@ -688,7 +693,15 @@ void vtkProbeFilter::ProbeEmptyPoints(
       }
     }
     // use 1% of the diagonal (1% has to be squared)
-    tol2 = sLength2 * CELL_TOLERANCE_FACTOR_SQR;
+    this->ProbeContextTolerance2 = sLength2 * CELL_TOLERANCE_FACTOR_SQR;
+  }
+  int maxCellSize = this->ProbeContextMaxCellSize;
+
+  outPD = output->GetPointData();
+
+  if (this->ComputeTolerance)
+  {
+    tol2 = this->ProbeContextTolerance2;
   }
   else
   {
@@ -288,6 +288,19 @@ protected:
   vtkDataSetAttributes::FieldList* CellList;
   vtkDataSetAttributes::FieldList* PointList;
 
+  ///@{
+  /**
+   * Per-source quantities cached across executions so that repeatedly
+   * probing a static source only pays the point lookups. Keyed on the
+   * source's identity and MTime; the pointer is only compared, never
+   * dereferenced. See ProbeEmptyPoints().
+   */
+  vtkDataSet* ProbeContextSource = nullptr;
+  vtkMTimeType ProbeContextMTime = 0;
+  int ProbeContextMaxCellSize = 0;
+  double ProbeContextTolerance2 = 0.0;
+  ///@}
+
 private:
   vtkProbeFilter(const vtkProbeFilter&) = delete;
   void operator=(const vtkProbeFilter&) = delete;
@@ -28,8 +28,10 @@
 // toggling on and off sets it to 1 and 0
 
 #include "vtkQuadricDecimation.h"
+#include "vtkAppendPolyData.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkCleanPolyData.h"
 #include "vtkDoubleArray.h"
 #include "vtkEdgeTable.h"
 #include "vtkGenericCell.h"
@@ -37,11 +39,16 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPriorityQueue.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangle.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkQuadricDecimation);
@@ -254,6 +261,11 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
+  if (this->NumberOfPartitions > 1 && numTris >= 2 * this->NumberOfPartitions)
+  {
+    return this->PartitionedExecute(input, output);
+  }
+
   polys = vtkCellArray::New();
   points = vtkPoints::New();
   outputCellList = vtkIdList::New();
@@ -337,9 +349,18 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   this->UpdateProgress(0.15);
 
   vtkDebugMacro(<< "Computing Costs");
-  // Compute the cost of and target point for collapsing each edge.
+  // Compute the cost of and target point for collapsing each edge. Edges
+  // touching a locked point never enter the priority queue, so they are
+  // never collapsed (see the partitioned-parallel mode).
+  const unsigned char* pointLocks =
+    this->PointLocks ? this->PointLocks->GetPointer(0) : nullptr;
   for (i = 0; i < this->Edges->GetNumberOfEdges(); i++)
   {
+    if (pointLocks &&
+      (pointLocks[this->EndPoint1List->GetId(i)] || pointLocks[this->EndPoint2List->GetId(i)]))
+    {
+      continue;
+    }
     if (this->AttributeErrorMetric)
     {
       cost = this->ComputeCost2(i, x);
@@ -456,6 +477,170 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+//------------------------------------------------------------------------------
+int vtkQuadricDecimation::PartitionedExecute(vtkPolyData* input, vtkPolyData* output)
+{
+  const vtkIdType numTris = input->GetNumberOfPolys();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const int numParts = this->NumberOfPartitions;
+  vtkCellArray* polys = input->GetPolys();
+  const bool copyPointData = this->AttributeErrorMetric || this->MapPointData;
+
+  vtkDebugMacro(<< "Partitioned decimation with " << numParts << " partitions");
+
+  // First pass: find the points shared by more than one contiguous run of
+  // triangles. These become the locked partition boundaries.
+  std::vector<int> pointPartition(numPts, -1);
+  std::vector<unsigned char> sharedPoint(numPts, 0);
+  vtkNew<vtkIdList> ptIdsScratch;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (int part = 0; part < numParts; part++)
+  {
+    const vtkIdType beginTri = part * numTris / numParts;
+    const vtkIdType endTri = (part + 1) * numTris / numParts;
+    for (vtkIdType triId = beginTri; triId < endTri; triId++)
+    {
+      polys->GetCellAtId(triId, npts, pts, ptIdsScratch);
+      for (vtkIdType j = 0; j < npts; j++)
+      {
+        if (pointPartition[pts[j]] < 0)
+        {
+          pointPartition[pts[j]] = part;
+        }
+        else if (pointPartition[pts[j]] != part)
+        {
+          sharedPoint[pts[j]] = 1;
+        }
+      }
+    }
+  }
+  this->UpdateProgress(0.05);
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
+
+  // Second pass: assemble one self-contained piece per partition, flagging
+  // its shared points so that the per-partition filter locks them.
+  std::vector<vtkSmartPointer<vtkQuadricDecimation>> decimators(numParts);
+  std::vector<vtkIdType> pointMap(numPts, -1);
+  std::vector<vtkIdType> mappedPoints;
+  for (int part = 0; part < numParts; part++)
+  {
+    const vtkIdType beginTri = part * numTris / numParts;
+    const vtkIdType endTri = (part + 1) * numTris / numParts;
+
+    vtkNew<vtkPoints> piecePoints;
+    piecePoints->SetDataType(input->GetPoints()->GetDataType());
+    vtkNew<vtkCellArray> pieceTris;
+    pieceTris->AllocateEstimate(endTri - beginTri, 3);
+    vtkNew<vtkUnsignedCharArray> pieceLocks;
+    vtkNew<vtkPolyData> piece;
+    piece->SetPoints(piecePoints);
+    piece->SetPolys(pieceTris);
+    if (copyPointData)
+    {
+      piece->GetPointData()->CopyAllocate(input->GetPointData());
+    }
+
+    mappedPoints.clear();
+    vtkIdType tri[3];
+    for (vtkIdType triId = beginTri; triId < endTri; triId++)
+    {
+      polys->GetCellAtId(triId, npts, pts, ptIdsScratch);
+      for (vtkIdType j = 0; j < npts; j++)
+      {
+        vtkIdType& localId = pointMap[pts[j]];
+        if (localId < 0)
+        {
+          localId = piecePoints->InsertNextPoint(input->GetPoint(pts[j]));
+          pieceLocks->InsertNextValue(sharedPoint[pts[j]]);
+          if (copyPointData)
+          {
+            piece->GetPointData()->CopyData(input->GetPointData(), pts[j], localId);
+          }
+          mappedPoints.push_back(pts[j]);
+        }
+        tri[j] = localId;
+      }
+      pieceTris->InsertNextCell(npts, tri);
+    }
+    // the map is shared between partitions, reset only the entries used here
+    for (vtkIdType mappedPoint : mappedPoints)
+    {
+      pointMap[mappedPoint] = -1;
+    }
+
+    auto& decimator = decimators[part];
+    decimator = vtkSmartPointer<vtkQuadricDecimation>::New();
+    decimator->SetContainerAlgorithm(this);
+    decimator->SetTargetReduction(this->TargetReduction);
+    decimator->SetAttributeErrorMetric(this->AttributeErrorMetric);
+    decimator->SetVolumePreservation(this->VolumePreservation);
+    decimator->SetRegularize(this->Regularize);
+    decimator->SetRegularization(this->Regularization);
+    decimator->SetWeighBoundaryConstraintsByLength(this->WeighBoundaryConstraintsByLength);
+    decimator->SetBoundaryWeightFactor(this->BoundaryWeightFactor);
+    decimator->SetMapPointData(this->MapPointData);
+    decimator->SetScalarsAttribute(this->ScalarsAttribute);
+    decimator->SetVectorsAttribute(this->VectorsAttribute);
+    decimator->SetNormalsAttribute(this->NormalsAttribute);
+    decimator->SetTCoordsAttribute(this->TCoordsAttribute);
+    decimator->SetTensorsAttribute(this->TensorsAttribute);
+    decimator->SetScalarsWeight(this->ScalarsWeight);
+    decimator->SetVectorsWeight(this->VectorsWeight);
+    decimator->SetNormalsWeight(this->NormalsWeight);
+    decimator->SetTCoordsWeight(this->TCoordsWeight);
+    decimator->SetTensorsWeight(this->TensorsWeight);
+    decimator->PointLocks = pieceLocks;
+    decimator->SetInputData(piece);
+  }
+  this->UpdateProgress(0.1);
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
+
+  // Decimate the partitions concurrently. Each internal filter and its
+  // input are fully independent, so the updates can run in parallel.
+  vtkSMPTools::For(0, numParts, 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType part = begin; part < end; part++)
+    {
+      decimators[part]->Update();
+    }
+  });
+  this->UpdateProgress(0.9);
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
+
+  // Stitch: append the pieces and merge the seam points, which are exactly
+  // coincident because they were locked on every side.
+  vtkNew<vtkAppendPolyData> append;
+  append->SetContainerAlgorithm(this);
+  for (int part = 0; part < numParts; part++)
+  {
+    append->AddInputData(decimators[part]->GetOutput());
+  }
+  vtkNew<vtkCleanPolyData> clean;
+  clean->SetContainerAlgorithm(this);
+  clean->SetInputConnection(append->GetOutputPort());
+  clean->PointMergingOn();
+  clean->ToleranceIsAbsoluteOn();
+  clean->SetAbsoluteTolerance(0.0);
+  clean->ConvertLinesToPointsOff();
+  clean->ConvertPolysToLinesOff();
+  clean->ConvertStripsToPolysOff();
+  clean->Update();
+
+  output->ShallowCopy(clean->GetOutput());
+  this->ActualReduction =
+    numTris > 0 ? 1.0 - static_cast<double>(output->GetNumberOfPolys()) / numTris : 0.0;
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
 {
@@ -878,6 +1063,10 @@ void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
         this->Edges->InsertEdge(edge[1], pt0Id, edgeId);
         this->EndPoint1List->InsertId(edgeId, edge[1]);
         this->EndPoint2List->InsertId(edgeId, pt0Id);
+        if (this->PointLocks && this->PointLocks->GetValue(edge[1]))
+        { // edges touching a locked point stay out of the queue
+          continue;
+        }
         // Compute cost (target point/data) and add to priority cue.
         if (this->AttributeErrorMetric)
         {
@@ -899,6 +1088,10 @@ void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
         this->Edges->InsertEdge(edge[0], pt0Id, edgeId);
         this->EndPoint1List->InsertId(edgeId, edge[0]);
         this->EndPoint2List->InsertId(edgeId, pt0Id);
+        if (this->PointLocks && this->PointLocks->GetValue(edge[0]))
+        { // edges touching a locked point stay out of the queue
+          continue;
+        }
         // Compute cost (target point/data) and add to priority cue.
         if (this->AttributeErrorMetric)
         {
@@ -914,6 +1107,11 @@ void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
     }
     else
     { // This edge already has one point as the merged point.
+      if (this->PointLocks &&
+        (this->PointLocks->GetValue(edge[0]) || this->PointLocks->GetValue(edge[1])))
+      { // edges touching a locked point stay out of the queue
+        continue;
+      }
       if (this->AttributeErrorMetric)
       {
         cost = this->ComputeCost2(changedEdges->GetId(i), this->TempX);
@@ -1534,6 +1732,7 @@ void vtkQuadricDecimation::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Target Reduction: " << this->TargetReduction << "\n";
   os << indent << "Actual Reduction: " << this->ActualReduction << "\n";
+  os << indent << "Number Of Partitions: " << this->NumberOfPartitions << "\n";
 
   os << indent << "Attribute Error Metric: " << (this->AttributeErrorMetric ? "On\n" : "Off\n");
   os << indent << "Volume Preservation: " << (this->VolumePreservation ? "On\n" : "Off\n");
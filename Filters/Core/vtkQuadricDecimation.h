@@ -47,6 +47,7 @@
 #include "vtkDeprecation.h"       // For VTK_DEPRECATED_IN_9_3_0
 #include "vtkFiltersCoreModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkEdgeTable;
@@ -54,6 +55,7 @@ class vtkIdList;
 class vtkPointData;
 class vtkPriorityQueue;
 class vtkDoubleArray;
+class vtkUnsignedCharArray;
 
 class VTKFILTERSCORE_EXPORT vtkQuadricDecimation : public vtkPolyDataAlgorithm
 {
@@ -194,6 +196,22 @@ public:
   vtkGetMacro(ActualReduction, double);
   ///@}
 
+  ///@{
+  /**
+   * Set/get the number of partitions used by the partitioned-parallel mode.
+   * When greater than one, the input triangles are split into that many
+   * contiguous runs which are decimated concurrently, each with the points
+   * it shares with other runs locked in place, and the results are stitched
+   * back together by merging the unmoved seam points. This trades some
+   * quality near the seams (locked points are never collapsed, so the
+   * achievable reduction there is limited) for near-linear wall-clock
+   * speedups on very large meshes. The default is one, which runs the
+   * serial algorithm unchanged.
+   */
+  vtkSetClampMacro(NumberOfPartitions, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPartitions, int);
+  ///@}
+
 protected:
   vtkQuadricDecimation();
   ~vtkQuadricDecimation() override;
@@ -248,6 +266,15 @@ protected:
    */
   vtkIdType GetEdgeCellId(vtkIdType p1Id, vtkIdType p2Id);
 
+  /**
+   * Execute the partitioned-parallel mode: split the triangles into
+   * NumberOfPartitions contiguous runs, decimate each run with an internal
+   * filter whose partition-boundary points are locked, and stitch the
+   * per-partition results. Invoked by RequestData() when NumberOfPartitions
+   * is greater than one.
+   */
+  int PartitionedExecute(vtkPolyData* input, vtkPolyData* output);
+
   int IsGoodPlacement(vtkIdType pt0Id, vtkIdType pt1Id, const double* x);
   int TrianglePlaneCheck(
     const double t0[3], const double t1[3], const double t2[3], const double* x);
@@ -313,6 +340,13 @@ protected:
   vtkTypeBool Regularize = false;
   double Regularization = 0.05;
 
+  int NumberOfPartitions = 1;
+
+  // Set internally on the per-partition filters of the partitioned mode:
+  // one flag per input point, edges touching a point flagged 1 are never
+  // entered in the priority queue and thus never collapsed.
+  vtkSmartPointer<vtkUnsignedCharArray> PointLocks;
+
   // Controlling the boundary weighting behavior
   vtkTypeBool WeighBoundaryConstraintsByLength = false;
   double BoundaryWeightFactor = 1.0;
@@ -13,11 +13,15 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangleFilter.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSmoothPolyDataFilter);
@@ -274,6 +278,95 @@ void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
   vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
 }
 
+// Threaded version of the relaxation sweep, used when points are not
+// constrained to a source surface. The sweep is double buffered: each
+// iteration reads the previous positions and writes the relaxed ones, so
+// points can be processed concurrently without observing partially
+// updated neighbors (a Jacobi-style sweep rather than the serial
+// Gauss-Seidel sweep, which converges slightly more slowly but produces
+// run-to-run reproducible results).
+template <typename T>
+void vtkSPDF_MovePointsThreaded(vtkSPDF_InternalParams<T>& params)
+{
+  const vtkIdType numPts = params.numPts;
+  std::vector<T> buffer(3 * numPts);
+  T* newPtsCoords = static_cast<T*>(params.newPts->GetVoidPointer(0));
+  T* prev = newPtsCoords; // read buffer
+  T* next = buffer.data(); // write buffer
+
+  int iterationNumber = 0;
+  for (T maxDist = std::numeric_limits<T>::max();
+       maxDist > params.conv && iterationNumber < params.numberOfIterations; ++iterationNumber)
+  {
+    if (iterationNumber && !(iterationNumber % 5))
+    {
+      params.spdf->UpdateProgress(0.5 + 0.5 * iterationNumber / params.numberOfIterations);
+      if (params.spdf->CheckAbort())
+      {
+        break;
+      }
+    }
+
+    vtkSMPThreadLocal<T> localMaxDist(0.0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      T& threadMaxDist = localMaxDist.Local();
+      for (; ptId < endPtId; ++ptId)
+      {
+        vtkMeshVertexPtr vert = params.vertexPtr + ptId;
+        const T* pt = prev + 3 * ptId;
+        T* outPt = next + 3 * ptId;
+        vtkIdType npts;
+        if (vert->type != VTK_FIXED_VERTEX && vert->edges &&
+          (npts = vert->edges->GetNumberOfIds()) > 0)
+        {
+          T deltaX[3] = { 0.0, 0.0, 0.0 };
+          const vtkIdType* edgeIdPtr = vert->edges->GetPointer(0);
+          // Compute the mean (cumulated) direction vector
+          for (vtkIdType j = 0; j < npts; ++j, ++edgeIdPtr)
+          {
+            const T* neighbor = prev + 3 * (*edgeIdPtr);
+            for (unsigned short k = 0; k < 3; ++k)
+            {
+              deltaX[k] += neighbor[k];
+            }
+          } // for all connected points
+
+          // Move the point
+          for (unsigned short k = 0; k < 3; ++k)
+          {
+            outPt[k] = pt[k] + params.factor * (deltaX[k] / npts - pt[k]);
+          }
+
+          T dist = vtkMath::Norm(deltaX);
+          threadMaxDist = std::max(threadMaxDist, dist);
+        } // if can move point
+        else
+        {
+          outPt[0] = pt[0];
+          outPt[1] = pt[1];
+          outPt[2] = pt[2];
+        }
+      } // for all points
+    });
+
+    maxDist = 0.0;
+    for (const T& threadMaxDist : localMaxDist)
+    {
+      maxDist = std::max(maxDist, threadMaxDist);
+    }
+    std::swap(prev, next);
+  } // for not converged or within iteration count
+
+  // After an odd number of sweeps the final positions live in the side
+  // buffer; copy them back into the output points.
+  if (prev != newPtsCoords)
+  {
+    std::copy(prev, prev + 3 * numPts, newPtsCoords);
+  }
+
+  vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
+}
+
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -687,7 +780,16 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
       this->RelaxationFactor, conv, numPts, Verts, source, this->SmoothPoints.get(), w.get(),
       cellLocator };
 
-    vtkSPDF_MovePoints(params);
+    // The source-constrained path shares a cell locator and source cells
+    // across points, so only the unconstrained sweep is threaded.
+    if (source)
+    {
+      vtkSPDF_MovePoints(params);
+    }
+    else
+    {
+      vtkSPDF_MovePointsThreaded(params);
+    }
   }
   else
   {
@@ -695,7 +797,14 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
       static_cast<float>(this->RelaxationFactor), static_cast<float>(conv), numPts, Verts, source,
       this->SmoothPoints.get(), w.get(), cellLocator };
 
-    vtkSPDF_MovePoints(params);
+    if (source)
+    {
+      vtkSPDF_MovePoints(params);
+    }
+    else
+    {
+      vtkSPDF_MovePointsThreaded(params);
+    }
   }
 
   // Release memory if it's been allocated
@@ -6,6 +6,7 @@
 #include "vtkThreshold.h"
 
 #include "vtkArrayDispatch.h"
+#include "vtkBatch.h"
 #include "vtkCellData.h"
 #include "vtkEventForwarderCommand.h"
 #include "vtkExtractCells.h"
@@ -19,7 +20,9 @@
 #include "vtkUnstructuredGrid.h"
 
 #include <algorithm>
+#include <array>
 #include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
@@ -100,6 +103,30 @@ int vtkThreshold::GetThresholdFunction()
   return -1;
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+struct ThresholdBatchData
+{
+  // In BuildOffsetsAndGetGlobalSum: the number of kept cells in the batch,
+  // then the offset of the batch's first kept cell in the compacted list.
+  vtkIdType KeptCellsOffset = 0;
+
+  ThresholdBatchData& operator+=(const ThresholdBatchData& other)
+  {
+    this->KeptCellsOffset += other.KeptCellsOffset;
+    return *this;
+  }
+  ThresholdBatchData operator+(const ThresholdBatchData& other) const
+  {
+    ThresholdBatchData result = *this;
+    result += other;
+    return result;
+  }
+};
+using ThresholdBatches = vtkBatches<ThresholdBatchData>;
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 template <typename TScalarArray>
 struct vtkThreshold::EvaluateCellsFunctor
@@ -107,7 +134,7 @@ struct vtkThreshold::EvaluateCellsFunctor
   vtkThreshold* Self;
   vtkDataSet* Input;
   TScalarArray* ScalarsArray;
-  vtkUnsignedCharArray* GhostArray;
+  const std::vector<std::array<vtkIdType, 2>>& ValidCellSpans;
   bool UsePointScalars;
   vtkIdType NumberOfCells;
 
@@ -117,11 +144,11 @@ struct vtkThreshold::EvaluateCellsFunctor
   vtkIdList* KeptCellsList;
 
   EvaluateCellsFunctor(vtkThreshold* self, vtkDataSet* input, TScalarArray* scalarsArray,
-    vtkUnsignedCharArray* ghostArray, bool usePointScalars, vtkIdList* keptCellsList)
+    bool usePointScalars, vtkIdList* keptCellsList)
     : Self(self)
     , Input(input)
     , ScalarsArray(scalarsArray)
-    , GhostArray(ghostArray)
+    , ValidCellSpans(input->GetValidCellSpans(vtkDataSetAttributes::HIDDENCELL))
     , UsePointScalars(usePointScalars)
     , NumberOfCells(input->GetNumberOfCells())
     , KeptCellsList(keptCellsList)
@@ -149,67 +176,75 @@ struct vtkThreshold::EvaluateCellsFunctor
     const vtkIdType* cellPts;
     vtkIdType checkAbortInterval = std::min((end - begin) / 10 + 1, (vtkIdType)1000);
 
-    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    // Cells hidden by the ghost array lie outside every valid span and are
+    // simply left marked as discarded.
+    std::fill(insideness.begin() + begin, insideness.begin() + end, 0);
+
+    // Find the first span of non-hidden cells overlapping [begin, end).
+    auto spanIter = std::lower_bound(this->ValidCellSpans.begin(), this->ValidCellSpans.end(),
+      begin, [](const std::array<vtkIdType, 2>& span, vtkIdType id) { return span[1] <= id; });
+    bool aborted = false;
+    for (; !aborted && spanIter != this->ValidCellSpans.end() && (*spanIter)[0] < end; ++spanIter)
     {
-      if (cellId % checkAbortInterval == 0)
+      const vtkIdType spanBegin = std::max(begin, (*spanIter)[0]);
+      const vtkIdType spanEnd = std::min(end, (*spanIter)[1]);
+      for (vtkIdType cellId = spanBegin; cellId < spanEnd; ++cellId)
       {
-        if (isFirst)
-        {
-          this->Self->CheckAbort();
-        }
-        if (this->Self->GetAbortOutput())
+        if (cellId % checkAbortInterval == 0)
         {
-          break;
+          if (isFirst)
+          {
+            this->Self->CheckAbort();
+          }
+          if (this->Self->GetAbortOutput())
+          {
+            aborted = true;
+            break;
+          }
         }
-      }
-
-      if (this->GhostArray && this->GhostArray->GetValue(cellId) & vtkDataSetAttributes::HIDDENCELL)
-      {
-        insideness[cellId] = 0;
-        continue;
-      }
-      int cellType = this->Input->GetCellType(cellId);
-      if (cellType == VTK_EMPTY_CELL)
-      {
-        insideness[cellId] = 0;
-        continue;
-      }
-      this->Input->GetCellPoints(cellId, numCellPts, cellPts, cellIds);
 
-      int keepCell = 0;
-      if (this->UsePointScalars)
-      {
-        if (this->Self->GetAllScalars())
+        int cellType = this->Input->GetCellType(cellId);
+        if (cellType == VTK_EMPTY_CELL)
         {
-          keepCell = 1;
-          for (int i = 0; keepCell && (i < numCellPts); i++)
-          {
-            keepCell = this->Self->EvaluateComponents(scalars, cellPts[i]);
-          }
+          continue;
         }
-        else
+        this->Input->GetCellPoints(cellId, numCellPts, cellPts, cellIds);
+
+        int keepCell = 0;
+        if (this->UsePointScalars)
         {
-          if (!this->Self->GetUseContinuousCellRange())
+          if (this->Self->GetAllScalars())
           {
-            keepCell = 0;
-            for (int i = 0; (!keepCell) && (i < numCellPts); i++)
+            keepCell = 1;
+            for (int i = 0; keepCell && (i < numCellPts); i++)
             {
               keepCell = this->Self->EvaluateComponents(scalars, cellPts[i]);
             }
           }
           else
           {
-            keepCell = this->Self->EvaluateCell(scalars, cellPts, numCellPts);
+            if (!this->Self->GetUseContinuousCellRange())
+            {
+              keepCell = 0;
+              for (int i = 0; (!keepCell) && (i < numCellPts); i++)
+              {
+                keepCell = this->Self->EvaluateComponents(scalars, cellPts[i]);
+              }
+            }
+            else
+            {
+              keepCell = this->Self->EvaluateCell(scalars, cellPts, numCellPts);
+            }
           }
         }
+        else // use cell scalars
+        {
+          keepCell = this->Self->EvaluateComponents(scalars, cellId);
+        }
+        // Invert the keep flag if the Invert option is enabled.
+        keepCell = this->Self->GetInvert() ? (1 - keepCell) : keepCell;
+        insideness[cellId] = numCellPts > 0 && keepCell ? 1 : 0;
       }
-      else // use cell scalars
-      {
-        keepCell = this->Self->EvaluateComponents(scalars, cellId);
-      }
-      // Invert the keep flag if the Invert option is enabled.
-      keepCell = this->Self->GetInvert() ? (1 - keepCell) : keepCell;
-      insideness[cellId] = numCellPts > 0 && keepCell ? 1 : 0;
     }
     if (isFirst)
     {
@@ -219,14 +254,41 @@ struct vtkThreshold::EvaluateCellsFunctor
 
   void Reduce()
   {
-    this->KeptCellsList->Allocate(this->NumberOfCells);
-    for (vtkIdType cellId = 0; cellId < this->NumberOfCells; ++cellId)
-    {
-      if (this->InsidenessArray->GetValue(cellId))
+    // Compact the insideness flags into the kept-cells list in parallel:
+    // count the kept cells per batch, convert the counts into offsets with a
+    // prefix sum, then write each batch into the list at its offset.
+    const unsigned char* insideness = this->InsidenessArray->GetPointer(0);
+    ThresholdBatches batches;
+    batches.Initialize(this->NumberOfCells);
+    vtkSMPTools::For(0, batches.GetNumberOfBatches(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType batchId = begin; batchId < end; ++batchId)
       {
-        this->KeptCellsList->InsertNextId(cellId);
+        auto& batch = batches[batchId];
+        for (vtkIdType cellId = batch.BeginId; cellId < batch.EndId; ++cellId)
+        {
+          batch.Data.KeptCellsOffset += insideness[cellId] ? 1 : 0;
+        }
       }
-    }
+    });
+    batches.TrimBatches([](const vtkBatch<ThresholdBatchData>& batch)
+      { return batch.Data.KeptCellsOffset == 0; });
+    const auto globalSum = batches.BuildOffsetsAndGetGlobalSum();
+    this->KeptCellsList->SetNumberOfIds(globalSum.KeptCellsOffset);
+    vtkIdType* keptCells = this->KeptCellsList->GetPointer(0);
+    vtkSMPTools::For(0, batches.GetNumberOfBatches(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType batchId = begin; batchId < end; ++batchId)
+      {
+        const auto& batch = batches[batchId];
+        vtkIdType* keptCell = keptCells + batch.Data.KeptCellsOffset;
+        for (vtkIdType cellId = batch.BeginId; cellId < batch.EndId; ++cellId)
+        {
+          if (insideness[cellId])
+          {
+            *keptCell++ = cellId;
+          }
+        }
+      }
+    });
   }
 };
 
@@ -235,10 +297,10 @@ struct vtkThreshold::EvaluateCellsWorker
 {
   template <typename TScalarArray>
   void operator()(TScalarArray* scalarsArray, vtkThreshold* self, vtkDataSet* input,
-    vtkUnsignedCharArray* ghostArray, bool usePointScalars, vtkIdList* keptCellsList)
+    bool usePointScalars, vtkIdList* keptCellsList)
   {
     EvaluateCellsFunctor<TScalarArray> functor(
-      self, input, scalarsArray, ghostArray, usePointScalars, keptCellsList);
+      self, input, scalarsArray, usePointScalars, keptCellsList);
     vtkSMPTools::For(0, input->GetNumberOfCells(), functor);
   }
 };
@@ -258,8 +320,6 @@ int vtkThreshold::RequestData(
     vtkDebugMacro(<< "No scalar data to threshold");
     return 1;
   }
-  vtkUnsignedCharArray* ghostsArray = input->GetCellData()->GetGhostArray();
-
   // are we using pointScalars?
   int fieldAssociation = this->GetInputArrayAssociation(0, inputVector);
   this->NumberOfComponents = inScalars->GetNumberOfComponents();
@@ -275,10 +335,11 @@ int vtkThreshold::RequestData(
   this->SetProgressShiftScale(0, 0.5);
   EvaluateCellsWorker worker;
   if (!vtkArrayDispatch::Dispatch::Execute(
-        inScalars, worker, this, input, ghostsArray, usePointScalars, keptCellsList))
+        inScalars, worker, this, input, usePointScalars, keptCellsList))
   {
-    worker(inScalars, this, input, ghostsArray, usePointScalars, keptCellsList);
+    worker(inScalars, this, input, usePointScalars, keptCellsList);
   }
+  this->SelectedCellIds = keptCellsList;
   if (this->CheckAbort())
   {
     return 1;
@@ -306,6 +367,12 @@ int vtkThreshold::RequestData(
   return extractCells->ProcessRequest(request, inputVector, outputVector);
 }
 
+//------------------------------------------------------------------------------
+vtkIdList* vtkThreshold::GetSelectedCellIds()
+{
+  return this->SelectedCellIds;
+}
+
 //------------------------------------------------------------------------------
 template <typename TScalarsArray>
 int vtkThreshold::EvaluateCell(
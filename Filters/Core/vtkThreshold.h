@@ -37,6 +37,7 @@
 
 #include "vtkDeprecation.h"       // For VTK_DEPRECATED_IN_9_3_0
 #include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkSmartPointer.h"      // For vtkSmartPointer
 #include "vtkUnstructuredGridAlgorithm.h"
 
 #define VTK_ATTRIBUTE_MODE_DEFAULT 0
@@ -215,6 +216,15 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  /**
+   * Return the list of input cell ids selected by the most recent execution,
+   * in ascending order. This is an index view into the input cells: callers
+   * that only need the ids (e.g. to drive their own vtkExtractCells or build
+   * a selection) can use it without touching the deep-copied output. The
+   * list is valid until the next execution and null before the first one.
+   */
+  vtkIdList* GetSelectedCellIds();
+
   ///@{
   /**
    * Methods used for thresholding. vtkThreshold::Lower returns true if s is lower than the lower
@@ -254,6 +264,8 @@ protected:
 
   int (vtkThreshold::*ThresholdFunction)(double s) const = &vtkThreshold::Between;
 
+  vtkSmartPointer<vtkIdList> SelectedCellIds;
+
   template <typename TScalarArray>
   struct EvaluateCellsFunctor;
   struct EvaluateCellsWorker;
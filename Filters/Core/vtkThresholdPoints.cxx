@@ -11,6 +11,11 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkThresholdPoints);
@@ -24,6 +29,11 @@ vtkThresholdPoints::vtkThresholdPoints()
   , InputArrayComponent(0)
   , OutputPointsPrecision(DEFAULT_PRECISION)
   , ThresholdFunction(&vtkThresholdPoints::Upper)
+  , CacheValueIndex(false)
+  , ValueIndexArray(nullptr)
+  , ValueIndexMTime(0)
+  , ValueIndexComponent(0)
+  , ValueIndexValid(false)
 {
   // by default process active point scalars
   this->SetInputArrayToProcess(
@@ -108,6 +118,63 @@ void vtkThresholdPoints::ThresholdBetween(double lower, double upper)
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkThresholdPoints::BuildValueIndex(vtkDataArray* inScalars, vtkIdType numPts)
+{
+  // Reuse the index when the array, its contents, and the processed
+  // component are unchanged since the previous execution.
+  if (this->ValueIndexArray == inScalars && this->ValueIndexMTime == inScalars->GetMTime() &&
+    this->ValueIndexComponent == this->InputArrayComponent && this->ValueIndexMTime != 0)
+  {
+    return this->ValueIndexValid;
+  }
+
+  const int numComps = inScalars->GetNumberOfComponents();
+  const int comp = this->InputArrayComponent;
+  std::atomic<bool> valid(true);
+
+  this->ValueIndex.resize(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      double value = 0.0;
+      if (comp < numComps)
+      {
+        value = inScalars->GetComponent(ptId, comp);
+      }
+      else
+      {
+        for (int c = 0; c < numComps; ++c)
+        {
+          double component = inScalars->GetComponent(ptId, c);
+          value += component * component;
+        }
+        value = std::sqrt(value);
+      }
+      if (std::isnan(value))
+      {
+        valid = false;
+      }
+      this->ValueIndex[ptId] = std::make_pair(value, ptId);
+    }
+  });
+
+  if (valid)
+  {
+    vtkSMPTools::Sort(this->ValueIndex.begin(), this->ValueIndex.end());
+  }
+  else
+  {
+    this->ValueIndex.clear();
+  }
+
+  this->ValueIndexArray = inScalars;
+  this->ValueIndexMTime = inScalars->GetMTime();
+  this->ValueIndexComponent = comp;
+  this->ValueIndexValid = valid;
+  return this->ValueIndexValid;
+}
+
 //------------------------------------------------------------------------------
 int vtkThresholdPoints::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -174,41 +241,112 @@ int vtkThresholdPoints::RequestData(vtkInformation* vtkNotUsed(request),
   verts = vtkCellArray::New();
   verts->AllocateEstimate(numPts, 1);
 
-  // Check that the scalars of each point satisfy the threshold criterion
+  // See whether the sorted value index can answer the range query; if not,
+  // fall back to evaluating the criterion for every point.
+  bool indexed = false;
+  if (this->CacheValueIndex)
+  {
+    indexed = this->BuildValueIndex(inScalars, numPts);
+  }
+  else if (this->ValueIndexArray != nullptr)
+  {
+    // Release the index when the option is turned off.
+    this->ValueIndex.clear();
+    this->ValueIndex.shrink_to_fit();
+    this->ValueIndexArray = nullptr;
+    this->ValueIndexMTime = 0;
+    this->ValueIndexValid = false;
+  }
+
   bool abort = false;
-  vtkIdType progressInterval = numPts / 20 + 1;
+  vtkIdType progressInterval;
 
-  for (ptId = 0; ptId < numPts && !abort; ptId++)
+  if (indexed)
   {
-    if (!(ptId % progressInterval))
+    // Locate the window of satisfying values with binary searches.
+    auto first = this->ValueIndex.begin();
+    auto last = this->ValueIndex.end();
+    const auto valueLess = [](const std::pair<double, vtkIdType>& p, double v)
+    { return p.first < v; };
+    const auto lessValue = [](double v, const std::pair<double, vtkIdType>& p)
+    { return v < p.first; };
+    if (this->ThresholdFunction == &vtkThresholdPoints::Upper)
+    {
+      first = std::lower_bound(first, last, this->UpperThreshold, valueLess);
+    }
+    else if (this->ThresholdFunction == &vtkThresholdPoints::Lower)
+    {
+      last = std::upper_bound(first, last, this->LowerThreshold, lessValue);
+    }
+    else // Between
     {
-      this->UpdateProgress((double)ptId / numPts);
-      abort = this->CheckAbort();
+      first = std::lower_bound(first, last, this->LowerThreshold, valueLess);
+      last = std::upper_bound(first, last, this->UpperThreshold, lessValue);
     }
 
-    double value = 0.0;
-    if (this->InputArrayComponent < inScalars->GetNumberOfComponents())
+    // Emit the points in input order so the output matches the full scan.
+    std::vector<vtkIdType> selectedIds;
+    selectedIds.reserve(last - first);
+    for (auto it = first; it != last; ++it)
     {
-      value = inScalars->GetComponent(ptId, this->InputArrayComponent);
+      selectedIds.push_back(it->second);
     }
-    else
+    vtkSMPTools::Sort(selectedIds.begin(), selectedIds.end());
+
+    const vtkIdType numSelected = static_cast<vtkIdType>(selectedIds.size());
+    progressInterval = numSelected / 20 + 1;
+    for (vtkIdType idx = 0; idx < numSelected && !abort; idx++)
     {
-      for (int c = 0; c < inScalars->GetNumberOfComponents(); ++c)
+      if (!(idx % progressInterval))
       {
-        double component = inScalars->GetComponent(ptId, c);
-        value += component * component;
+        this->UpdateProgress((double)idx / numSelected);
+        abort = this->CheckAbort();
       }
-      value = std::sqrt(value);
-    }
 
-    if ((this->*(this->ThresholdFunction))(value))
-    {
+      ptId = selectedIds[idx];
       input->GetPoint(ptId, x);
       pts[0] = newPoints->InsertNextPoint(x);
       outPD->CopyData(pd, ptId, pts[0]);
       verts->InsertNextCell(1, pts);
-    } // satisfied thresholding
-  }   // for all points
+    } // for all selected points
+  }
+  else
+  {
+    // Check that the scalars of each point satisfy the threshold criterion
+    progressInterval = numPts / 20 + 1;
+
+    for (ptId = 0; ptId < numPts && !abort; ptId++)
+    {
+      if (!(ptId % progressInterval))
+      {
+        this->UpdateProgress((double)ptId / numPts);
+        abort = this->CheckAbort();
+      }
+
+      double value = 0.0;
+      if (this->InputArrayComponent < inScalars->GetNumberOfComponents())
+      {
+        value = inScalars->GetComponent(ptId, this->InputArrayComponent);
+      }
+      else
+      {
+        for (int c = 0; c < inScalars->GetNumberOfComponents(); ++c)
+        {
+          double component = inScalars->GetComponent(ptId, c);
+          value += component * component;
+        }
+        value = std::sqrt(value);
+      }
+
+      if ((this->*(this->ThresholdFunction))(value))
+      {
+        input->GetPoint(ptId, x);
+        pts[0] = newPoints->InsertNextPoint(x);
+        outPD->CopyData(pd, ptId, pts[0]);
+        verts->InsertNextCell(1, pts);
+      } // satisfied thresholding
+    }   // for all points
+  }
 
   vtkDebugMacro(<< "Extracted " << output->GetNumberOfPoints() << " points.");
 
@@ -240,5 +378,6 @@ void vtkThresholdPoints::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Lower Threshold: " << this->LowerThreshold << "\n";
   os << indent << "Upper Threshold: " << this->UpperThreshold << "\n";
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Cache Value Index: " << (this->CacheValueIndex ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
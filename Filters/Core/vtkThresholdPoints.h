@@ -19,7 +19,12 @@
 #include "vtkFiltersCoreModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
+#include <utility> // For the sorted value index
+#include <vector>  // For the sorted value index
+
 VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+
 class VTKFILTERSCORE_EXPORT vtkThresholdPoints : public vtkPolyDataAlgorithm
 {
 public:
@@ -78,6 +83,22 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to keep a sorted index of the thresholded values alive
+   * across filter executions. The index is built lazily (and in parallel)
+   * the first time the array is thresholded, and is rebuilt only when the
+   * array or the component to process changes. Subsequent executions with a
+   * different threshold range locate the satisfying points with two binary
+   * searches instead of re-evaluating every point, which makes interactive
+   * range sweeps over large arrays much cheaper. The index falls back to
+   * the full scan when the array contains NaN values. Default is off.
+   */
+  vtkSetMacro(CacheValueIndex, bool);
+  vtkGetMacro(CacheValueIndex, bool);
+  vtkBooleanMacro(CacheValueIndex, bool);
+  ///@}
+
 protected:
   vtkThresholdPoints();
   ~vtkThresholdPoints() override = default;
@@ -94,6 +115,22 @@ protected:
 
   int (vtkThresholdPoints::*ThresholdFunction)(double s);
 
+  /**
+   * Build (or reuse) the sorted value index for the array being thresholded.
+   * Returns false when the index cannot be used (e.g., NaN values would
+   * break the ordering), in which case the caller falls back to a full scan.
+   */
+  bool BuildValueIndex(vtkDataArray* inScalars, vtkIdType numPts);
+
+  // Sorted value index used when CacheValueIndex is on. The previous input
+  // array is only compared as a pointer, never dereferenced.
+  bool CacheValueIndex;
+  std::vector<std::pair<double, vtkIdType>> ValueIndex;
+  vtkDataArray* ValueIndexArray;
+  vtkMTimeType ValueIndexMTime;
+  int ValueIndexComponent;
+  bool ValueIndexValid;
+
   int Lower(double s) { return (s <= this->LowerThreshold ? 1 : 0); }
   int Upper(double s) { return (s >= this->UpperThreshold ? 1 : 0); }
   int Between(double s)
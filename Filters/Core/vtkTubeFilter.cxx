@@ -224,28 +224,42 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
   //  triangle strips. Texture coordinates are optionally generated.
   //
   this->Theta = 2.0 * vtkMath::Pi() / this->NumberOfSides;
+  // Tabulate cos/sin at half-side steps once per execution; the per-vertex
+  // loops in GeneratePoints index these tables instead of calling cos/sin.
+  this->CosSideHalf.resize(2 * this->NumberOfSides);
+  this->SinSideHalf.resize(2 * this->NumberOfSides);
+  for (int m = 0; m < 2 * this->NumberOfSides; m++)
+  {
+    this->CosSideHalf[m] = cos(m * this->Theta / 2.0);
+    this->SinSideHalf[m] = sin(m * this->Theta / 2.0);
+  }
   vtkPolyLine* lineNormalGenerator = vtkPolyLine::New();
   // the line cellIds start after the last vert cellId
   inCellId = input->GetNumberOfVerts();
   int checkAbortInterval = std::min(numLines / 10 + 1, (vtkIdType)1000);
   int progressCounter = 0;
+  std::vector<vtkIdType> ptsCopy;
   for (inLines->InitTraversal(); inLines->GetNextCell(npts, ptsOrig) && !abort; inCellId++)
   {
-    this->UpdateProgress((double)inCellId / numLines);
-    if (progressCounter % checkAbortInterval == 0 && this->CheckAbort())
+    if (progressCounter % checkAbortInterval == 0)
     {
-      abort = this->CheckAbort();
-      break;
+      this->UpdateProgress((double)inCellId / numLines);
+      if (this->CheckAbort())
+      {
+        abort = true;
+        break;
+      }
     }
     progressCounter++;
 
     // Make a copy of point indices to avoid modifying input polydata cells
-    // while removing degenerate lines.
+    // while removing degenerate lines. The copy buffer is reused across
+    // polylines to avoid one heap allocation per line.
     if (npts < 2)
     {
       continue; // skip tubing this polyline
     }
-    std::vector<vtkIdType> ptsCopy(ptsOrig, ptsOrig + npts);
+    ptsCopy.assign(ptsOrig, ptsOrig + npts);
     vtkIdType* pts = ptsCopy.data();
 
     // remove degenerate lines to avoid warnings
@@ -473,9 +487,11 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     {
       for (k = 0; k < this->NumberOfSides; k++)
       {
+        const double cosTheta = this->CosSideHalf[2 * k];
+        const double sinTheta = this->SinSideHalf[2 * k];
         for (i = 0; i < 3; i++)
         {
-          normal[i] = w[i] * cos((double)k * this->Theta) + nP[i] * sin((double)k * this->Theta);
+          normal[i] = w[i] * cosTheta + nP[i] * sinTheta;
           s[i] = p[i] + this->Radius * sFactor * normal[i];
         }
         newPts->InsertPoint(ptId, s);
@@ -487,8 +503,13 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     else
     {
       double n_left[3], n_right[3];
+      const int numHalfSides = 2 * this->NumberOfSides;
       for (k = 0; k < this->NumberOfSides; k++)
       {
+        const double cosTheta = this->CosSideHalf[2 * k];
+        const double sinTheta = this->SinSideHalf[2 * k];
+        const int rightIdx = (2 * k - 1 + numHalfSides) % numHalfSides;
+        const int leftIdx = (2 * k + 1) % numHalfSides;
         for (i = 0; i < 3; i++)
         {
           // Create duplicate vertices at each point
@@ -497,12 +518,9 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
           // polygonal appearance, as if by flat-shading around the tube,
           // while still allowing smooth (gouraud) shading along the
           // tube as it bends.
-          normal[i] = w[i] * cos((double)(k + 0.0) * this->Theta) +
-            nP[i] * sin((double)(k + 0.0) * this->Theta);
-          n_right[i] = w[i] * cos((double)(k - 0.5) * this->Theta) +
-            nP[i] * sin((double)(k - 0.5) * this->Theta);
-          n_left[i] = w[i] * cos((double)(k + 0.5) * this->Theta) +
-            nP[i] * sin((double)(k + 0.5) * this->Theta);
+          normal[i] = w[i] * cosTheta + nP[i] * sinTheta;
+          n_right[i] = w[i] * this->CosSideHalf[rightIdx] + nP[i] * this->SinSideHalf[rightIdx];
+          n_left[i] = w[i] * this->CosSideHalf[leftIdx] + nP[i] * this->SinSideHalf[leftIdx];
           s[i] = p[i] + this->Radius * sFactor * normal[i];
         }
         newPts->InsertPoint(ptId, s);
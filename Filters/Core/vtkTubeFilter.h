@@ -46,6 +46,8 @@
 #include "vtkFiltersCoreModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
+#include <vector> // For the side angle tables
+
 #define VTK_VARY_RADIUS_OFF 0
 #define VTK_VARY_RADIUS_BY_SCALAR 1
 #define VTK_VARY_RADIUS_BY_VECTOR 2
@@ -252,8 +254,14 @@ protected:
     vtkPoints* inPts, vtkDataArray* inScalars, vtkFloatArray* newTCoords);
   vtkIdType ComputeOffset(vtkIdType offset, vtkIdType npts);
 
-  // Helper data members
+  // Helper data members. The tables hold cos/sin sampled at half-side steps,
+  // entry m being cos/sin of m * Theta / 2 for m in [0, 2 * NumberOfSides).
+  // Whole-side angles k * Theta are the even entries and the offset angles
+  // (k +/- 0.5) * Theta the odd ones (modulo a full turn). They are filled
+  // once per execution so the per-vertex loops avoid transcendental calls.
   double Theta;
+  std::vector<double> CosSideHalf;
+  std::vector<double> SinSideHalf;
 
 private:
   vtkTubeFilter(const vtkTubeFilter&) = delete;
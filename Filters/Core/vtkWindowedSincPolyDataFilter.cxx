@@ -1568,6 +1568,66 @@ vtkSmartPointer<vtkFloatArray> ProduceErrorVectors(
 
 } // anonymous namespace
 
+//------------------------------------------------------------------------------
+// Holds the analyzed smoothing topology between executions, together with
+// the state it was built from. The topology only depends on the input mesh
+// and the classification parameters; iteration-phase parameters (number of
+// iterations, passband, window function) can change without invalidating
+// it.
+class vtkWindowedSincPolyDataFilterInternals
+{
+public:
+  PointConnectivityBase* PtConn = nullptr;
+  vtkPolyData* Input = nullptr;
+  vtkMTimeType InputTime = 0;
+  bool LargeIds = false;
+  vtkTypeBool NonManifoldSmoothing = false;
+  vtkTypeBool WeightNonManifoldEdges = false;
+  vtkTypeBool BoundarySmoothing = false;
+  vtkTypeBool FeatureEdgeSmoothing = false;
+  double FeatureAngle = 0.0;
+  double EdgeAngle = 0.0;
+
+  ~vtkWindowedSincPolyDataFilterInternals() { this->Reset(); }
+
+  void Reset()
+  {
+    delete this->PtConn;
+    this->PtConn = nullptr;
+    this->Input = nullptr;
+    this->InputTime = 0;
+  }
+
+  // Can the cached topology be reused for this execution?
+  bool IsValid(vtkPolyData* input, bool largeIds, vtkWindowedSincPolyDataFilter* self)
+  {
+    return this->PtConn != nullptr && this->Input == input &&
+      this->InputTime == input->GetMTime() && this->LargeIds == largeIds &&
+      this->NonManifoldSmoothing == self->GetNonManifoldSmoothing() &&
+      this->WeightNonManifoldEdges == self->GetWeightNonManifoldEdges() &&
+      this->BoundarySmoothing == self->GetBoundarySmoothing() &&
+      this->FeatureEdgeSmoothing == self->GetFeatureEdgeSmoothing() &&
+      this->FeatureAngle == self->GetFeatureAngle() && this->EdgeAngle == self->GetEdgeAngle();
+  }
+
+  void Store(
+    PointConnectivityBase* ptConn, vtkPolyData* input, bool largeIds,
+    vtkWindowedSincPolyDataFilter* self)
+  {
+    this->Reset();
+    this->PtConn = ptConn;
+    this->Input = input;
+    this->InputTime = input->GetMTime();
+    this->LargeIds = largeIds;
+    this->NonManifoldSmoothing = self->GetNonManifoldSmoothing();
+    this->WeightNonManifoldEdges = self->GetWeightNonManifoldEdges();
+    this->BoundarySmoothing = self->GetBoundarySmoothing();
+    this->FeatureEdgeSmoothing = self->GetFeatureEdgeSmoothing();
+    this->FeatureAngle = self->GetFeatureAngle();
+    this->EdgeAngle = self->GetEdgeAngle();
+  }
+};
+
 //------------------------------------------------------------------------------
 // Construct object with number of iterations 20; passband 0.1; feature edge
 // smoothing turned off; feature angle 45 degrees; edge angle 15 degrees; and
@@ -1592,6 +1652,14 @@ vtkWindowedSincPolyDataFilter::vtkWindowedSincPolyDataFilter()
 
   this->GenerateErrorScalars = false;
   this->GenerateErrorVectors = false;
+
+  this->Internals = new vtkWindowedSincPolyDataFilterInternals;
+}
+
+//------------------------------------------------------------------------------
+vtkWindowedSincPolyDataFilter::~vtkWindowedSincPolyDataFilter()
+{
+  delete this->Internals;
 }
 
 //------------------------------------------------------------------------------
@@ -1644,18 +1712,33 @@ int vtkWindowedSincPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(reques
   // and improve performance. It is done in two steps: first the topological
   // edge connectivity is constructed (i.e., incident edges to each point are
   // identified), then the local topology around each point is analyzed to
-  // create a local smoothing stencil.
+  // create a local smoothing stencil. The result is cached: when neither the
+  // input nor the classification parameters changed since the last
+  // execution (e.g., only the number of iterations or the passband moved),
+  // the analysis is skipped and the cached stencil is reused.
   bool largeIds = numPts > VTK_INT_MAX || numCells > VTK_INT_MAX;
   PointConnectivityBase* ptConn;
-  if (largeIds)
+  if (this->Internals->IsValid(input, largeIds, this))
   {
-    ptConn = BuildConnectivity<vtkIdType>(input, this);
-    AnalyzePointTopology<vtkIdType>(ptConn, this);
+    ptConn = this->Internals->PtConn;
+
+    // refresh the iteration-phase parameters snapshotted at build time
+    ptConn->NumberOfIterations = this->NumberOfIterations;
+    ptConn->PassBand = this->PassBand;
   }
   else
   {
-    ptConn = BuildConnectivity<int>(input, this);
-    AnalyzePointTopology<int>(ptConn, this);
+    if (largeIds)
+    {
+      ptConn = BuildConnectivity<vtkIdType>(input, this);
+      AnalyzePointTopology<vtkIdType>(ptConn, this);
+    }
+    else
+    {
+      ptConn = BuildConnectivity<int>(input, this);
+      AnalyzePointTopology<int>(ptConn, this);
+    }
+    this->Internals->Store(ptConn, input, largeIds, this);
   }
 
   vtkDebugMacro(<< "Found\n\t" << ptConn->NumSimple << " simple vertices\n\t" << ptConn->NumEdges
@@ -1706,8 +1789,12 @@ int vtkWindowedSincPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(reques
   // Set the new points
   output->SetPoints(outPts);
 
-  // Clean up
-  delete ptConn;
+  // The cache owns the connectivity. An aborted execution may have left
+  // it partially built, so do not let it survive into the next one.
+  if (this->GetAbortOutput())
+  {
+    this->Internals->Reset();
+  }
 
   return 1;
 }
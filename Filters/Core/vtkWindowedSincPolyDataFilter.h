@@ -132,6 +132,14 @@
  * non-sequential execution type (set in the CMake variable
  * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
  *
+ * @warning
+ * The analyzed smoothing topology (the stencil of smoothing edges) is
+ * cached between executions. When only iteration-phase parameters change
+ * (NumberOfIterations, PassBand, WindowFunction, or the error output
+ * options), re-execution skips the topological analysis and runs the
+ * smoothing iterations directly, which makes parameter exploration much
+ * cheaper on large meshes.
+ *
  * @sa
  * Another useful documentation resource is this SIGGRAPH publication:
  * Gabriel Taubin. "A Signal Processing Approach To Fair Surface Design".
@@ -148,6 +156,8 @@
 #include "vtkPolyDataAlgorithm.h"
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkWindowedSincPolyDataFilterInternals;
+
 class VTKFILTERSCORE_EXPORT vtkWindowedSincPolyDataFilter : public vtkPolyDataAlgorithm
 {
 public:
@@ -324,7 +334,7 @@ public:
 
 protected:
   vtkWindowedSincPolyDataFilter();
-  ~vtkWindowedSincPolyDataFilter() override = default;
+  ~vtkWindowedSincPolyDataFilter() override;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
@@ -345,6 +355,10 @@ protected:
   vtkTypeBool GenerateErrorScalars;
   vtkTypeBool GenerateErrorVectors;
 
+  // Caches the analyzed smoothing topology between executions,
+  // see RequestData()
+  vtkWindowedSincPolyDataFilterInternals* Internals;
+
 private:
   vtkWindowedSincPolyDataFilter(const vtkWindowedSincPolyDataFilter&) = delete;
   void operator=(const vtkWindowedSincPolyDataFilter&) = delete;
@@ -19,6 +19,7 @@
 #include "vtkInformationVector.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkParallelAlgorithms.h"
 #include "vtkPointData.h"
 #include "vtkSelectionNode.h"
 #include "vtkSignedCharArray.h"
@@ -128,7 +129,7 @@ int vtkConvertSelection::SelectTableFromTable(
         else
         {
           std::set<vtkIdType> intersection;
-          std::sort(list->GetPointer(0), list->GetPointer(0) + list->GetNumberOfIds());
+          vtk::ParallelSort(list->GetPointer(0), list->GetPointer(0) + list->GetNumberOfIds());
           std::set_intersection(matching.begin(), matching.end(), list->GetPointer(0),
             list->GetPointer(0) + list->GetNumberOfIds(),
             std::inserter(intersection, intersection.begin()));
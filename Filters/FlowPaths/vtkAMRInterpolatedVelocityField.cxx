@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkAMRInterpolatedVelocityField.h"
 
+#include "vtkAMRInformation.h"
 #include "vtkCellData.h"
 #include "vtkDataArray.h"
 #include "vtkFieldData.h"
@@ -22,18 +23,9 @@ bool Inside(double q[3], double gbounds[6])
 
 bool FindInLevel(double q[3], vtkOverlappingAMR* amrds, int level, unsigned int& gridId)
 {
-  for (unsigned int i = 0; i < amrds->GetNumberOfDataSets(level); i++)
-  {
-    double gbounds[6];
-    amrds->GetBounds(level, i, gbounds);
-    bool inside = Inside(q, gbounds);
-    if (inside)
-    {
-      gridId = i;
-      return true;
-    }
-  }
-  return false;
+  // vtkAMRInformation locates the point through its rasterized level index
+  // instead of scanning every box.
+  return amrds->GetAMRInfo()->FindGrid(q, level, gridId);
 }
 
 } // namespace
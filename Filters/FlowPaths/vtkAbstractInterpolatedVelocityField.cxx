@@ -139,23 +139,42 @@ void vtkAbstractInterpolatedVelocityField::Initialize(vtkCompositeDataSet* compD
   {
     if (auto pointSet = vtkPointSet::SafeDownCast(datasetInfo.DataSet))
     {
-      if (auto closestPointStrategy = vtkClosestPointStrategy::SafeDownCast(datasetInfo.Strategy))
+      if (vtkClosestPointStrategy::SafeDownCast(datasetInfo.Strategy))
       {
         auto providedClosestPointStrategy = vtkClosestPointStrategy::SafeDownCast(strategy);
-        // if locator is set, create a new instance of it and set it on the strategy
+        // if locator is set, create a new instance of it for this dataset. The
+        // instance is attached to the dataset rather than the strategy (unless
+        // the dataset already carries a locator of that type, which is then
+        // reused) so that other filters operating on the same dataset can
+        // share it. vtkProbeFilter proceeds the same way.
         if (auto pointLocator = providedClosestPointStrategy->GetPointLocator())
         {
-          closestPointStrategy->SetPointLocator(vtk::TakeSmartPointer(pointLocator->NewInstance()));
+          auto existingLocator = pointSet->GetPointLocator();
+          bool sameLocatorType =
+            existingLocator ? pointLocator->IsA(existingLocator->GetClassName()) : false;
+          if (!sameLocatorType)
+          {
+            auto newLocator = vtk::TakeSmartPointer(pointLocator->NewInstance());
+            pointSet->SetPointLocator(newLocator);
+            newLocator->SetDataSet(pointSet);
+          }
         }
       }
-      else if (auto cellLocatorStrategy =
-                 vtkCellLocatorStrategy::SafeDownCast(datasetInfo.Strategy))
+      else if (vtkCellLocatorStrategy::SafeDownCast(datasetInfo.Strategy))
       {
         auto providedCellLocatorStrategy = vtkCellLocatorStrategy::SafeDownCast(strategy);
-        // if locator is set, create a new instance of it and set it on the strategy
+        // same as above, but for the cell locator
         if (auto cellLocator = providedCellLocatorStrategy->GetCellLocator())
         {
-          cellLocatorStrategy->SetCellLocator(vtk::TakeSmartPointer(cellLocator->NewInstance()));
+          auto existingLocator = pointSet->GetCellLocator();
+          bool sameLocatorType =
+            existingLocator ? cellLocator->IsA(existingLocator->GetClassName()) : false;
+          if (!sameLocatorType)
+          {
+            auto newLocator = vtk::TakeSmartPointer(cellLocator->NewInstance());
+            pointSet->SetCellLocator(newLocator);
+            newLocator->SetDataSet(pointSet);
+          }
         }
       }
       datasetInfo.Strategy->Initialize(pointSet);
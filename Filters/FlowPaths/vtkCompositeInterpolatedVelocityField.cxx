@@ -60,6 +60,9 @@ void vtkCompositeInterpolatedVelocityField::CopyParameters(
   }
   this->DataSetsBoundsInfo = obj->DataSetsBoundsInfo;
 
+  // Per-dataset cell hints are thread-specific; start this instance empty.
+  this->LastCellIdPerDataSet.assign(this->DataSetsBoundsInfo.size(), -1);
+
   // The weights must be copied as well
   this->Weights.resize(obj->Weights.size());
 }
@@ -75,6 +78,7 @@ void vtkCompositeInterpolatedVelocityField::AddDataSet(vtkDataSet* dataset, size
 
   // insert the dataset (do NOT register the dataset to 'this')
   this->DataSetsBoundsInfo.emplace_back(dataset);
+  this->LastCellIdPerDataSet.push_back(-1);
 
   if (maxCellSize == 0)
   {
@@ -105,6 +109,23 @@ void vtkCompositeInterpolatedVelocityField::SetLastCellId(vtkIdType c, int datai
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkCompositeInterpolatedVelocityField::ResumeFromLastCellId(vtkDataSet* ds, int dataindex)
+{
+  vtkIdType cellId = dataindex < static_cast<int>(this->LastCellIdPerDataSet.size())
+    ? this->LastCellIdPerDataSet[dataindex]
+    : -1;
+  if (cellId >= 0 && cellId < ds->GetNumberOfCells())
+  {
+    this->LastCellId = cellId;
+    ds->GetCell(cellId, this->CurrentCell);
+  }
+  else
+  {
+    this->ClearLastCellId();
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkCompositeInterpolatedVelocityField::FunctionValues(double* x, double* f)
 {
@@ -121,11 +142,18 @@ int vtkCompositeInterpolatedVelocityField::FunctionValues(double* x, double* f)
   }
 
   // Use the superclass's method first as it is faster.
+  const vtkIdType entryCellId = this->LastCellId;
   int retVal = this->FunctionValues(ds, x, f);
 
   if (!retVal)
   {
     this->CacheDataSetMiss++;
+    // Remember where the trajectory left this dataset so the search can
+    // resume from that cell if the trajectory re-enters it later.
+    if (this->LastDataSetIndex < static_cast<int>(this->LastCellIdPerDataSet.size()))
+    {
+      this->LastCellIdPerDataSet[this->LastDataSetIndex] = entryCellId;
+    }
     // Okay need to check other datasets since we are outside the current dataset.
     const int datasetsInfoSize = static_cast<int>(this->DataSetsBoundsInfo.size());
     static const double delta[3] = { 0.0, 0.0, 0.0 };
@@ -135,7 +163,7 @@ int vtkCompositeInterpolatedVelocityField::FunctionValues(double* x, double* f)
       ds = this->DataSetsBoundsInfo[this->LastDataSetIndex].DataSet;
       if (ds && ds->GetNumberOfPoints() > 0 && ds != this->LastDataSet)
       {
-        this->ClearLastCellId();
+        this->ResumeFromLastCellId(ds, this->LastDataSetIndex);
         const auto& bounds = this->DataSetsBoundsInfo[this->LastDataSetIndex].Bounds;
         retVal = vtkMath::PointIsWithinBounds(x, bounds.data(), delta);
         if (retVal)
@@ -179,11 +207,18 @@ int vtkCompositeInterpolatedVelocityField::InsideTest(double* x)
 
   // Use the superclass's method first as it is faster.
   auto strategy = this->GetDataSetInfo(ds)->Strategy;
+  const vtkIdType entryCellId = this->LastCellId;
   int retVal = this->FindAndUpdateCell(ds, strategy, x);
 
   if (!retVal)
   {
     this->CacheDataSetMiss++;
+    // Remember where the trajectory left this dataset so the search can
+    // resume from that cell if the trajectory re-enters it later.
+    if (this->LastDataSetIndex < static_cast<int>(this->LastCellIdPerDataSet.size()))
+    {
+      this->LastCellIdPerDataSet[this->LastDataSetIndex] = entryCellId;
+    }
     // Okay need to check other datasets since we are outside the current dataset.
     const int datasetsInfoSize = static_cast<int>(this->DataSetsBoundsInfo.size());
     static const double delta[3] = { 0.0, 0.0, 0.0 };
@@ -193,7 +228,7 @@ int vtkCompositeInterpolatedVelocityField::InsideTest(double* x)
       ds = this->DataSetsBoundsInfo[this->LastDataSetIndex].DataSet;
       if (ds && ds->GetNumberOfPoints() > 0 && ds != this->LastDataSet)
       {
-        this->ClearLastCellId();
+        this->ResumeFromLastCellId(ds, this->LastDataSetIndex);
         const auto& bounds = this->DataSetsBoundsInfo[this->LastDataSetIndex].Bounds;
         retVal = vtkMath::PointIsWithinBounds(x, bounds.data(), delta);
         if (retVal)
@@ -143,6 +143,18 @@ protected:
   };
   std::vector<DataSetBoundsInformation> DataSetsBoundsInfo;
 
+  // The cell in which a trajectory was last found, per dataset. When a
+  // trajectory re-enters a dataset (e.g., shuttling across a partition
+  // boundary), the cell search resumes from this cell instead of
+  // performing a full locator descent from scratch.
+  std::vector<vtkIdType> LastCellIdPerDataSet;
+
+  /**
+   * Seed the cell cache for the dataset at the given index from
+   * LastCellIdPerDataSet, or clear it if no cell was recorded.
+   */
+  void ResumeFromLastCellId(vtkDataSet* ds, int dataindex);
+
 private:
   vtkCompositeInterpolatedVelocityField(const vtkCompositeInterpolatedVelocityField&) = delete;
   void operator=(const vtkCompositeInterpolatedVelocityField&) = delete;
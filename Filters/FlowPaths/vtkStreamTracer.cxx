@@ -35,6 +35,7 @@
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 
+#include <atomic>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -855,6 +856,10 @@ struct TracerIntegrator
   // thread generates one or more streamlines.
   vtkSMPThreadLocal<vtkLocalThreadOutput> LocalThreadOutput;
 
+  // Number of streamlines completed so far, across all threads. Used to
+  // report progress incrementally during long integrations.
+  std::atomic<vtkIdType> SeedsCompleted{ 0 };
+
   int MaxCellSize;
   int VecType;
   bool ComputeVorticity;
@@ -989,6 +994,12 @@ struct TracerIntegrator
 
     bool isFirst = this->Sequential || vtkSMPTools::GetSingleThread();
 
+    // Progress is reported from the lead thread only, based on the number of
+    // seeds consumed across all threads, so that interactive applications
+    // observe incremental updates during long integrations.
+    const vtkIdType numSeeds = seedIds->GetNumberOfIds();
+    const vtkIdType progressInterval = numSeeds / 100 + 1;
+
     // We will interpolate all point attributes of the input on each point of
     // the output (unless they are turned off). Note that we are using only
     // the first input, if there are more than one, the attributes have to match.
@@ -1003,6 +1014,11 @@ struct TracerIntegrator
       {
         break;
       }
+      vtkIdType seedsDone = this->SeedsCompleted++;
+      if (isFirst && seedsDone % progressInterval == 0)
+      {
+        this->StreamTracer->UpdateProgress(static_cast<double>(seedsDone) / numSeeds);
+      }
       if (seedNum == 0) // only update the first streamline, otherwise zero
       {
         propagation = this->InPropagation;
@@ -1627,7 +1643,11 @@ void vtkStreamTracer::Integrate(vtkPointData* input0Data, vtkPolyData* output,
   }
   else
   {
-    vtkSMPTools::For(0, numSeeds, ti);
+    // Schedule seeds as individual work items (grain of one). Streamline
+    // lengths vary wildly, so the default chunking can leave threads idle
+    // behind one long chunk; fine grains let the backend steal work. The
+    // per-seed integration cost dwarfs the scheduling overhead.
+    vtkSMPTools::For(0, numSeeds, 1, ti);
   }
 
   // Update information from streamer execution
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellArray.h"
+#include "vtkDeduplicateCompositeBlocks.h"
+#include "vtkFloatArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> MakeTriangle(double offset)
+{
+  auto pd = vtkSmartPointer<vtkPolyData>::New();
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(offset, 0.0, 0.0);
+  points->InsertNextPoint(offset + 1.0, 0.0, 0.0);
+  points->InsertNextPoint(offset, 1.0, 0.0);
+  pd->SetPoints(points);
+  vtkNew<vtkCellArray> polys;
+  polys->InsertNextCell({ 0, 1, 2 });
+  pd->SetPolys(polys);
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("values");
+  scalars->SetNumberOfTuples(3);
+  scalars->FillValue(static_cast<float>(offset));
+  pd->GetPointData()->SetScalars(scalars);
+  return pd;
+}
+}
+
+int TestDeduplicateCompositeBlocks(int, char*[])
+{
+  // blocks 0 and 2 are distinct instances with identical content, block 1
+  // differs, block 3 differs only in its point data array
+  vtkSmartPointer<vtkPolyData> part = MakeTriangle(0.0);
+  vtkNew<vtkPolyData> partCopy;
+  partCopy->DeepCopy(part);
+  vtkSmartPointer<vtkPolyData> other = MakeTriangle(5.0);
+  vtkNew<vtkPolyData> attributesDiffer;
+  attributesDiffer->DeepCopy(part);
+  attributesDiffer->GetPointData()->GetScalars()->SetComponent(0, 0, 42.0);
+
+  vtkNew<vtkMultiBlockDataSet> input;
+  input->SetNumberOfBlocks(4);
+  input->SetBlock(0, part);
+  input->SetBlock(1, other);
+  input->SetBlock(2, partCopy);
+  input->SetBlock(3, attributesDiffer);
+
+  vtkNew<vtkDeduplicateCompositeBlocks> dedup;
+  dedup->SetInputData(input);
+  dedup->Update();
+
+  vtkMultiBlockDataSet* output = vtkMultiBlockDataSet::SafeDownCast(dedup->GetOutput());
+  if (!output || output->GetNumberOfBlocks() != 4)
+  {
+    std::cerr << "Output structure does not match input" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (output->GetBlock(2) != output->GetBlock(0))
+  {
+    std::cerr << "Identical blocks were not deduplicated" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (output->GetBlock(1) == output->GetBlock(0) || output->GetBlock(3) == output->GetBlock(0))
+  {
+    std::cerr << "Differing blocks were wrongly merged" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (dedup->GetNumberOfDuplicateBlocks() != 1 || dedup->GetNumberOfUniqueBlocks() != 3)
+  {
+    std::cerr << "Unexpected statistics: " << dedup->GetNumberOfDuplicateBlocks()
+              << " duplicates, " << dedup->GetNumberOfUniqueBlocks() << " unique" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
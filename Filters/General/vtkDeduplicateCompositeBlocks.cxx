@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDeduplicateCompositeBlocks.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkDeduplicateCompositeBlocks);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// FNV-1a, folding raw bytes into a running 64 bit hash
+void HashBytes(const void* data, std::size_t size, std::uint64_t& hash)
+{
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+}
+
+//------------------------------------------------------------------------------
+void HashValue(std::uint64_t value, std::uint64_t& hash)
+{
+  HashBytes(&value, sizeof(value), hash);
+}
+
+//------------------------------------------------------------------------------
+// Fold an array's metadata and raw contents into the hash. Returns false for
+// arrays whose bytes cannot be visited directly; their block is then treated
+// as unique rather than risking a wrong merge.
+bool HashArray(vtkDataArray* array, std::uint64_t& hash)
+{
+  if (!array)
+  {
+    HashValue(0, hash);
+    return true;
+  }
+  if (!array->HasStandardMemoryLayout())
+  {
+    return false;
+  }
+  HashValue(static_cast<std::uint64_t>(array->GetDataType()), hash);
+  HashValue(static_cast<std::uint64_t>(array->GetNumberOfComponents()), hash);
+  HashValue(static_cast<std::uint64_t>(array->GetNumberOfTuples()), hash);
+  if (const char* name = array->GetName())
+  {
+    HashBytes(name, strlen(name), hash);
+  }
+  HashBytes(array->GetVoidPointer(0),
+    static_cast<std::size_t>(array->GetNumberOfValues()) * array->GetDataTypeSize(), hash);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool ArraysIdentical(vtkDataArray* a, vtkDataArray* b)
+{
+  if (a == b)
+  {
+    return true;
+  }
+  if (!a || !b || a->GetDataType() != b->GetDataType() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents() ||
+    a->GetNumberOfTuples() != b->GetNumberOfTuples() ||
+    !a->HasStandardMemoryLayout() || !b->HasStandardMemoryLayout())
+  {
+    return false;
+  }
+  const char* nameA = a->GetName();
+  const char* nameB = b->GetName();
+  if ((nameA == nullptr) != (nameB == nullptr) || (nameA && strcmp(nameA, nameB) != 0))
+  {
+    return false;
+  }
+  return memcmp(a->GetVoidPointer(0), b->GetVoidPointer(0),
+           static_cast<std::size_t>(a->GetNumberOfValues()) * a->GetDataTypeSize()) == 0;
+}
+
+//------------------------------------------------------------------------------
+bool HashFieldData(vtkFieldData* fd, std::uint64_t& hash)
+{
+  HashValue(static_cast<std::uint64_t>(fd->GetNumberOfArrays()), hash);
+  for (int i = 0; i < fd->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* array = vtkDataArray::SafeDownCast(fd->GetAbstractArray(i));
+    if (!array || !HashArray(array, hash))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool FieldDataIdentical(vtkFieldData* a, vtkFieldData* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    if (!ArraysIdentical(vtkDataArray::SafeDownCast(a->GetAbstractArray(i)),
+          vtkDataArray::SafeDownCast(b->GetAbstractArray(i))))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool HashCells(vtkCellArray* cells, std::uint64_t& hash)
+{
+  HashValue(static_cast<std::uint64_t>(cells->GetNumberOfCells()), hash);
+  return HashArray(cells->GetOffsetsArray(), hash) &&
+    HashArray(cells->GetConnectivityArray(), hash);
+}
+
+//------------------------------------------------------------------------------
+bool CellsIdentical(vtkCellArray* a, vtkCellArray* b)
+{
+  return a->GetNumberOfCells() == b->GetNumberOfCells() &&
+    ArraysIdentical(a->GetOffsetsArray(), b->GetOffsetsArray()) &&
+    ArraysIdentical(a->GetConnectivityArray(), b->GetConnectivityArray());
+}
+
+//------------------------------------------------------------------------------
+bool HashPolyData(vtkPolyData* pd, std::uint64_t& hash)
+{
+  vtkPoints* points = pd->GetPoints();
+  return HashArray(points ? points->GetData() : nullptr, hash) &&
+    HashCells(pd->GetVerts(), hash) && HashCells(pd->GetLines(), hash) &&
+    HashCells(pd->GetPolys(), hash) && HashCells(pd->GetStrips(), hash) &&
+    HashFieldData(pd->GetPointData(), hash) && HashFieldData(pd->GetCellData(), hash) &&
+    HashFieldData(pd->GetFieldData(), hash);
+}
+
+//------------------------------------------------------------------------------
+bool PolyDataIdentical(vtkPolyData* a, vtkPolyData* b)
+{
+  vtkPoints* pointsA = a->GetPoints();
+  vtkPoints* pointsB = b->GetPoints();
+  if ((pointsA == nullptr) != (pointsB == nullptr) ||
+    (pointsA && !ArraysIdentical(pointsA->GetData(), pointsB->GetData())))
+  {
+    return false;
+  }
+  return CellsIdentical(a->GetVerts(), b->GetVerts()) &&
+    CellsIdentical(a->GetLines(), b->GetLines()) && CellsIdentical(a->GetPolys(), b->GetPolys()) &&
+    CellsIdentical(a->GetStrips(), b->GetStrips()) &&
+    FieldDataIdentical(a->GetPointData(), b->GetPointData()) &&
+    FieldDataIdentical(a->GetCellData(), b->GetCellData()) &&
+    FieldDataIdentical(a->GetFieldData(), b->GetFieldData());
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkDeduplicateCompositeBlocks::vtkDeduplicateCompositeBlocks()
+{
+  this->NumberOfDuplicateBlocks = 0;
+  this->NumberOfUniqueBlocks = 0;
+}
+
+//------------------------------------------------------------------------------
+vtkDeduplicateCompositeBlocks::~vtkDeduplicateCompositeBlocks() = default;
+
+//------------------------------------------------------------------------------
+int vtkDeduplicateCompositeBlocks::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkCompositeDataSet");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkDeduplicateCompositeBlocks::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkCompositeDataSet* input = vtkCompositeDataSet::GetData(inputVector[0], 0);
+  vtkCompositeDataSet* output = vtkCompositeDataSet::GetData(outputVector, 0);
+  if (!input || !output)
+  {
+    return 0;
+  }
+
+  output->ShallowCopy(input);
+
+  this->NumberOfDuplicateBlocks = 0;
+  this->NumberOfUniqueBlocks = 0;
+
+  // bucket the leaves by content hash; only byte-identical blocks within a
+  // bucket are merged, so a collision can never merge differing blocks
+  std::unordered_map<std::uint64_t, std::vector<vtkPolyData*>> buckets;
+
+  vtkCompositeDataIterator* iter = output->NewIterator();
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    if (this->CheckAbort())
+    {
+      break;
+    }
+    vtkPolyData* pd = vtkPolyData::SafeDownCast(iter->GetCurrentDataObject());
+    if (!pd)
+    {
+      continue;
+    }
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    if (!HashPolyData(pd, hash))
+    {
+      // contains arrays we cannot compare; keep the block as is
+      this->NumberOfUniqueBlocks++;
+      continue;
+    }
+
+    std::vector<vtkPolyData*>& bucket = buckets[hash];
+    vtkPolyData* match = nullptr;
+    for (vtkPolyData* candidate : bucket)
+    {
+      if (candidate == pd || PolyDataIdentical(candidate, pd))
+      {
+        match = candidate;
+        break;
+      }
+    }
+    if (!match)
+    {
+      bucket.push_back(pd);
+      this->NumberOfUniqueBlocks++;
+    }
+    else if (match != pd)
+    {
+      output->SetDataSet(iter, match);
+      this->NumberOfDuplicateBlocks++;
+    }
+  }
+  iter->Delete();
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkDeduplicateCompositeBlocks::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfDuplicateBlocks: " << this->NumberOfDuplicateBlocks << endl;
+  os << indent << "NumberOfUniqueBlocks: " << this->NumberOfUniqueBlocks << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkDeduplicateCompositeBlocks
+ * @brief   share identical leaf blocks of a composite dataset
+ *
+ * vtkDeduplicateCompositeBlocks detects leaf blocks of a composite dataset
+ * that hold identical vtkPolyData content and replaces every duplicate with
+ * a reference to the first occurrence. Assemblies that instantiate the same
+ * part mesh many times (bolts, blades) then carry one copy of the geometry
+ * plus shared references instead of N independent copies, and downstream
+ * consumers that cache per data object or per data array -- notably the
+ * OpenGL vertex buffer cache used by the polydata mappers -- hold one GPU
+ * buffer for all instances.
+ *
+ * Blocks are first bucketed by a hash over their points, cells and
+ * attribute arrays, then candidate pairs are compared byte for byte, so a
+ * hash collision can never merge blocks that differ. Only blocks whose
+ * geometry and attributes are both identical are deduplicated; congruent
+ * blocks that differ by a rigid transform are left untouched. Non-polydata
+ * leaves and arrays without a contiguous memory layout are passed through
+ * unchanged.
+ *
+ * The output has the same structure as the input and shares the input data
+ * objects; no data is copied.
+ */
+
+#ifndef vtkDeduplicateCompositeBlocks_h
+#define vtkDeduplicateCompositeBlocks_h
+
+#include "vtkFiltersGeneralModule.h" // For export macro
+#include "vtkPassInputTypeAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSGENERAL_EXPORT vtkDeduplicateCompositeBlocks : public vtkPassInputTypeAlgorithm
+{
+public:
+  static vtkDeduplicateCompositeBlocks* New();
+  vtkTypeMacro(vtkDeduplicateCompositeBlocks, vtkPassInputTypeAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Statistics from the last execution: the number of leaf blocks that were
+   * replaced by a reference to an earlier identical block, and the number of
+   * distinct blocks kept.
+   */
+  vtkGetMacro(NumberOfDuplicateBlocks, vtkIdType);
+  vtkGetMacro(NumberOfUniqueBlocks, vtkIdType);
+  ///@}
+
+protected:
+  vtkDeduplicateCompositeBlocks();
+  ~vtkDeduplicateCompositeBlocks() override;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  vtkIdType NumberOfDuplicateBlocks;
+  vtkIdType NumberOfUniqueBlocks;
+
+private:
+  vtkDeduplicateCompositeBlocks(const vtkDeduplicateCompositeBlocks&) = delete;
+  void operator=(const vtkDeduplicateCompositeBlocks&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
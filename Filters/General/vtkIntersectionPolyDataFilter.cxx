@@ -28,8 +28,12 @@
 #include "vtkTriangleFilter.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <list>
 #include <map>
+#include <set>
+#include <utility>
+#include <vector>
 
 //------------------------------------------------------------------------------
 // Helper typedefs and data structures.
@@ -154,6 +158,11 @@ public:
   IntersectionMapType* IntersectionPtsMap[2];
   IntersectionMapType* PointMapper;
 
+  // Set of intersection lines already added, keyed on the sorted pair of
+  // merged end point IDs. Used to reject duplicate lines without rebuilding
+  // cell links for every candidate triangle pair.
+  std::set<std::pair<vtkIdType, vtkIdType>> IntersectionLineSet;
+
   // Map from point to an edge on which it resides, the ID of the
   // cell, and the ID of the line.
   PointEdgeMapType* PointEdgeMap[2];
@@ -229,6 +238,19 @@ int vtkIntersectionPolyDataFilter::Impl ::FindTriangleIntersections(
   // The number of cells in OBBTree
   int numCells0 = node0->Cells->GetNumberOfIds();
 
+  // Triangles from node1 are fetched once and reused across all triangles of
+  // node0. The cached bounds are padded by the tolerance so that the interval
+  // filter below never rejects a pair the exact test would accept.
+  struct CandidateTriangle
+  {
+    vtkIdType CellId;
+    vtkIdType PtIds[3];
+    double Pts[3][3];
+    double Bounds[6];
+  };
+  std::vector<CandidateTriangle> candidates1;
+  bool candidatesBuilt = false;
+
   for (vtkIdType id0 = 0; id0 < numCells0; id0++)
   {
     vtkIdType cellId0 = node0->Cells->GetId(id0);
@@ -248,200 +270,239 @@ int vtkIntersectionPolyDataFilter::Impl ::FindTriangleIntersections(
 
       if (obbTree1->TriangleIntersectsNode(node1, triPts0[0], triPts0[1], triPts0[2], transform))
       {
-        int numCells1 = node1->Cells->GetNumberOfIds();
-        for (vtkIdType id1 = 0; id1 < numCells1; id1++)
+        if (!candidatesBuilt)
         {
-          vtkIdType cellId1 = node1->Cells->GetId(id1);
-          int type1 = mesh1->GetCellType(cellId1);
-          if (type1 == VTK_TRIANGLE)
+          candidatesBuilt = true;
+          int numCells1 = node1->Cells->GetNumberOfIds();
+          candidates1.reserve(numCells1);
+          for (vtkIdType id1 = 0; id1 < numCells1; id1++)
           {
-            // See if the two cells actually intersect. If they do,
-            // add an entry into the intersection maps and add an
-            // intersection line.
+            vtkIdType cellId1 = node1->Cells->GetId(id1);
+            if (mesh1->GetCellType(cellId1) != VTK_TRIANGLE)
+            {
+              continue;
+            }
+            CandidateTriangle candidate;
+            candidate.CellId = cellId1;
             vtkIdType npts1;
             const vtkIdType* triPtIds1;
             mesh1->GetCellPoints(cellId1, npts1, triPtIds1);
-
-            double triPts1[3][3];
             for (vtkIdType id = 0; id < npts1; id++)
             {
-              mesh1->GetPoint(triPtIds1[id], triPts1[id]);
+              candidate.PtIds[id] = triPtIds1[id];
+              mesh1->GetPoint(triPtIds1[id], candidate.Pts[id]);
             }
-
-            int coplanar = 0;
-            double outpt0[3], outpt1[3];
-            double surfaceid[2];
-            int intersects = vtkIntersectionPolyDataFilter::TriangleTriangleIntersection(triPts0[0],
-              triPts0[1], triPts0[2], triPts1[0], triPts1[1], triPts1[2], coplanar, outpt0, outpt1,
-              surfaceid, tolerance);
-
-            if (coplanar)
+            for (int c = 0; c < 3; c++)
             {
-              // Coplanar triangle intersection is not handled.
-              // This intersection will not be included in the output. TODO
-              // vtkDebugMacro(<<"Coplanar");
-              intersects = 0;
-              continue;
+              candidate.Bounds[2 * c] = std::min(std::min(candidate.Pts[0][c], candidate.Pts[1][c]),
+                                          candidate.Pts[2][c]) -
+                tolerance;
+              candidate.Bounds[2 * c + 1] =
+                std::max(std::max(candidate.Pts[0][c], candidate.Pts[1][c]), candidate.Pts[2][c]) +
+                tolerance;
             }
+            candidates1.push_back(candidate);
+          }
+        }
 
-            // If actual intersection, add point and cell to edge, line,
-            // and surface maps!
-            if (intersects)
-            {
-              vtkIdType lineId = intersectionLines->GetNumberOfCells();
+        double bounds0[6];
+        for (int c = 0; c < 3; c++)
+        {
+          bounds0[2 * c] = std::min(std::min(triPts0[0][c], triPts0[1][c]), triPts0[2][c]);
+          bounds0[2 * c + 1] = std::max(std::max(triPts0[0][c], triPts0[1][c]), triPts0[2][c]);
+        }
 
-              vtkIdType ptId0, ptId1;
-              int unique[2];
-              unique[0] = pointMerger->InsertUniquePoint(outpt0, ptId0);
-              unique[1] = pointMerger->InsertUniquePoint(outpt1, ptId1);
+        for (CandidateTriangle& candidate : candidates1)
+        {
+          // Conservative interval filter: candidate pairs whose padded
+          // bounding boxes are disjoint cannot intersect, so the exact
+          // triangle-triangle test is skipped for them.
+          if (candidate.Bounds[0] > bounds0[1] || candidate.Bounds[1] < bounds0[0] ||
+            candidate.Bounds[2] > bounds0[3] || candidate.Bounds[3] < bounds0[2] ||
+            candidate.Bounds[4] > bounds0[5] || candidate.Bounds[5] < bounds0[4])
+          {
+            continue;
+          }
 
-              int addline = 1;
-              if (ptId0 == ptId1)
-              {
-                addline = 0;
-              }
+          // See if the two cells actually intersect. If they do,
+          // add an entry into the intersection maps and add an
+          // intersection line.
+          vtkIdType cellId1 = candidate.CellId;
+          const vtkIdType* triPtIds1 = candidate.PtIds;
+          double(*triPts1)[3] = candidate.Pts;
+
+          int coplanar = 0;
+          double outpt0[3], outpt1[3];
+          double surfaceid[2];
+          int intersects = vtkIntersectionPolyDataFilter::TriangleTriangleIntersection(triPts0[0],
+            triPts0[1], triPts0[2], triPts1[0], triPts1[1], triPts1[2], coplanar, outpt0, outpt1,
+            surfaceid, tolerance);
+
+          if (coplanar)
+          {
+            // Coplanar triangle intersection is not handled.
+            // This intersection will not be included in the output. TODO
+            // vtkDebugMacro(<<"Coplanar");
+            intersects = 0;
+            continue;
+          }
+
+          // If actual intersection, add point and cell to edge, line,
+          // and surface maps!
+          if (intersects)
+          {
+            vtkIdType lineId = intersectionLines->GetNumberOfCells();
 
-              if (ptId0 == ptId1 && surfaceid[0] != surfaceid[1])
+            vtkIdType ptId0, ptId1;
+            int unique[2];
+            unique[0] = pointMerger->InsertUniquePoint(outpt0, ptId0);
+            unique[1] = pointMerger->InsertUniquePoint(outpt1, ptId1);
+
+            int addline = 1;
+            if (ptId0 == ptId1)
+            {
+              addline = 0;
+            }
+
+            if (ptId0 == ptId1 && surfaceid[0] != surfaceid[1])
+            {
+              intersectionSurfaceId->InsertValue(ptId0, 3);
+            }
+            else
+            {
+              if (unique[0])
               {
-                intersectionSurfaceId->InsertValue(ptId0, 3);
+                intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
               }
               else
               {
-                if (unique[0])
+                if (intersectionSurfaceId->GetValue(ptId0) != 3)
                 {
                   intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
                 }
-                else
-                {
-                  if (intersectionSurfaceId->GetValue(ptId0) != 3)
-                  {
-                    intersectionSurfaceId->InsertValue(ptId0, surfaceid[0]);
-                  }
-                }
-                if (unique[1])
+              }
+              if (unique[1])
+              {
+                intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
+              }
+              else
+              {
+                if (intersectionSurfaceId->GetValue(ptId1) != 3)
                 {
                   intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
                 }
-                else
-                {
-                  if (intersectionSurfaceId->GetValue(ptId1) != 3)
-                  {
-                    intersectionSurfaceId->InsertValue(ptId1, surfaceid[1]);
-                  }
-                }
               }
+            }
 
-              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+            info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+            info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+            info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+            info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
 
-              // Check to see if duplicate line. Line can only be a duplicate
-              // line if both points are not unique and they don't
-              // equal each other
-              if (!unique[0] && !unique[1] && ptId0 != ptId1)
+            // Check to see if duplicate line. Line can only be a duplicate
+            // line if both points are not unique and they don't
+            // equal each other
+            if (!unique[0] && !unique[1] && ptId0 != ptId1)
+            {
+              if (info->IntersectionLineSet.find(std::make_pair(
+                    std::min(ptId0, ptId1), std::max(ptId0, ptId1))) !=
+                info->IntersectionLineSet.end())
               {
-                vtkSmartPointer<vtkPolyData> lineTest = vtkSmartPointer<vtkPolyData>::New();
-                lineTest->SetPoints(pointMerger->GetPoints());
-                lineTest->SetLines(intersectionLines);
-                lineTest->BuildLinks();
-                int newLine = info->CheckLine(lineTest, ptId0, ptId1);
-                if (newLine == 0)
-                {
-                  addline = 0;
-                }
+                addline = 0;
               }
-              if (addline)
+            }
+            if (addline)
+            {
+              // If the line is new and does not consist of two identical
+              // points, add the line to the intersection and update
+              // mapping information
+              intersectionLines->InsertNextCell(2);
+              intersectionLines->InsertCellPoint(ptId0);
+              intersectionLines->InsertCellPoint(ptId1);
+              info->IntersectionLineSet.insert(
+                std::make_pair(std::min(ptId0, ptId1), std::max(ptId0, ptId1)));
+
+              intersectionCellIds0->InsertNextValue(cellId0);
+              intersectionCellIds1->InsertNextValue(cellId1);
+
+              info->PointCellIds[0]->InsertValue(ptId0, cellId0);
+              info->PointCellIds[0]->InsertValue(ptId1, cellId0);
+              info->PointCellIds[1]->InsertValue(ptId0, cellId1);
+              info->PointCellIds[1]->InsertValue(ptId1, cellId1);
+
+              info->IntersectionMap[0]->insert(std::make_pair(cellId0, lineId));
+              info->IntersectionMap[1]->insert(std::make_pair(cellId1, lineId));
+
+              // Check which edges of cellId0 and cellId1 outpt0 and
+              // outpt1 are on, if any.
+              int isOnEdge = 0;
+              int m0p0 = 0, m0p1 = 0, m1p0 = 0, m1p1 = 0;
+              for (vtkIdType edgeId = 0; edgeId < 3; edgeId++)
               {
-                // If the line is new and does not consist of two identical
-                // points, add the line to the intersection and update
-                // mapping information
-                intersectionLines->InsertNextCell(2);
-                intersectionLines->InsertCellPoint(ptId0);
-                intersectionLines->InsertCellPoint(ptId1);
-
-                intersectionCellIds0->InsertNextValue(cellId0);
-                intersectionCellIds1->InsertNextValue(cellId1);
-
-                info->PointCellIds[0]->InsertValue(ptId0, cellId0);
-                info->PointCellIds[0]->InsertValue(ptId1, cellId0);
-                info->PointCellIds[1]->InsertValue(ptId0, cellId1);
-                info->PointCellIds[1]->InsertValue(ptId1, cellId1);
-
-                info->IntersectionMap[0]->insert(std::make_pair(cellId0, lineId));
-                info->IntersectionMap[1]->insert(std::make_pair(cellId1, lineId));
-
-                // Check which edges of cellId0 and cellId1 outpt0 and
-                // outpt1 are on, if any.
-                int isOnEdge = 0;
-                int m0p0 = 0, m0p1 = 0, m1p0 = 0, m1p1 = 0;
-                for (vtkIdType edgeId = 0; edgeId < 3; edgeId++)
+                isOnEdge = info->AddToPointEdgeMap(
+                  0, ptId0, outpt0, mesh0, cellId0, edgeId, lineId, triPtIds0);
+                if (isOnEdge != -1)
                 {
-                  isOnEdge = info->AddToPointEdgeMap(
-                    0, ptId0, outpt0, mesh0, cellId0, edgeId, lineId, triPtIds0);
-                  if (isOnEdge != -1)
-                  {
-                    m0p0++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    0, ptId1, outpt1, mesh0, cellId0, edgeId, lineId, triPtIds0);
-                  if (isOnEdge != -1)
-                  {
-                    m0p1++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    1, ptId0, outpt0, mesh1, cellId1, edgeId, lineId, triPtIds1);
-                  if (isOnEdge != -1)
-                  {
-                    m1p0++;
-                  }
-                  isOnEdge = info->AddToPointEdgeMap(
-                    1, ptId1, outpt1, mesh1, cellId1, edgeId, lineId, triPtIds1);
-                  if (isOnEdge != -1)
-                  {
-                    m1p1++;
-                  }
+                  m0p0++;
                 }
-                // Special cases caught by tolerance and not from the Point
-                // Merger
-                if (m0p0 > 0 && m1p0 > 0)
+                isOnEdge = info->AddToPointEdgeMap(
+                  0, ptId1, outpt1, mesh0, cellId0, edgeId, lineId, triPtIds0);
+                if (isOnEdge != -1)
                 {
-                  intersectionSurfaceId->InsertValue(ptId0, 3);
+                  m0p1++;
                 }
-                if (m0p1 > 0 && m1p1 > 0)
+                isOnEdge = info->AddToPointEdgeMap(
+                  1, ptId0, outpt0, mesh1, cellId1, edgeId, lineId, triPtIds1);
+                if (isOnEdge != -1)
                 {
-                  intersectionSurfaceId->InsertValue(ptId1, 3);
+                  m1p0++;
+                }
+                isOnEdge = info->AddToPointEdgeMap(
+                  1, ptId1, outpt1, mesh1, cellId1, edgeId, lineId, triPtIds1);
+                if (isOnEdge != -1)
+                {
+                  m1p1++;
                 }
               }
-              // Add information about origin surface to std::maps for
-              // checks later
-              if (intersectionSurfaceId->GetValue(ptId0) == 1)
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-              }
-              else if (intersectionSurfaceId->GetValue(ptId0) == 2)
-              {
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              }
-              else
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
-              }
-              if (intersectionSurfaceId->GetValue(ptId1) == 1)
-              {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-              }
-              else if (intersectionSurfaceId->GetValue(ptId1) == 2)
+              // Special cases caught by tolerance and not from the Point
+              // Merger
+              if (m0p0 > 0 && m1p0 > 0)
               {
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+                intersectionSurfaceId->InsertValue(ptId0, 3);
               }
-              else
+              if (m0p1 > 0 && m1p1 > 0)
               {
-                info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
-                info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+                intersectionSurfaceId->InsertValue(ptId1, 3);
               }
             }
+            // Add information about origin surface to std::maps for
+            // checks later
+            if (intersectionSurfaceId->GetValue(ptId0) == 1)
+            {
+              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+            }
+            else if (intersectionSurfaceId->GetValue(ptId0) == 2)
+            {
+              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+            }
+            else
+            {
+              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId0, cellId0));
+              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId0, cellId1));
+            }
+            if (intersectionSurfaceId->GetValue(ptId1) == 1)
+            {
+              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+            }
+            else if (intersectionSurfaceId->GetValue(ptId1) == 2)
+            {
+              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+            }
+            else
+            {
+              info->IntersectionPtsMap[0]->insert(std::make_pair(ptId1, cellId0));
+              info->IntersectionPtsMap[1]->insert(std::make_pair(ptId1, cellId1));
+            }
           }
         }
       }
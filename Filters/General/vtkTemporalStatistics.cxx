@@ -18,6 +18,7 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include "vtkSmartPointer.h"
@@ -57,7 +58,10 @@ struct AccumulateAverage
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(), std::plus<T>{});
+    vtkSMPTools::For(0, in.size(), [&](vtkIdType begin, vtkIdType end) {
+      std::transform(in.cbegin() + begin, in.cbegin() + end, out.cbegin() + begin,
+        out.begin() + begin, std::plus<T>{});
+    });
   }
 };
 
@@ -72,8 +76,10 @@ struct AccumulateMinimum
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(),
-      [](T v1, T v2) -> T { return std::min(v1, v2); });
+    vtkSMPTools::For(0, in.size(), [&](vtkIdType begin, vtkIdType end) {
+      std::transform(in.cbegin() + begin, in.cbegin() + end, out.cbegin() + begin,
+        out.begin() + begin, [](T v1, T v2) -> T { return std::min(v1, v2); });
+    });
   }
 };
 
@@ -88,8 +94,10 @@ struct AccumulateMaximum
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(),
-      [](T v1, T v2) -> T { return std::max(v1, v2); });
+    vtkSMPTools::For(0, in.size(), [&](vtkIdType begin, vtkIdType end) {
+      std::transform(in.cbegin() + begin, in.cbegin() + end, out.cbegin() + begin,
+        out.begin() + begin, [](T v1, T v2) -> T { return std::max(v1, v2); });
+    });
   }
 };
 
@@ -110,11 +118,13 @@ struct AccumulateStdDev
     const auto prevValues = vtk::DataArrayValueRange(prevArray);
     auto outValues = vtk::DataArrayValueRange(outArray);
 
-    for (vtkIdType i = 0; i < inValues.size(); ++i)
-    {
-      const double temp = inValues[i] - (prevValues[i] / pass);
-      outValues[i] += static_cast<T>(pass * temp * temp / (pass + 1.));
-    }
+    vtkSMPTools::For(0, inValues.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const double temp = inValues[i] - (prevValues[i] / pass);
+        outValues[i] += static_cast<T>(pass * temp * temp / (pass + 1.));
+      }
+    });
   }
 };
 
@@ -125,11 +135,12 @@ struct FinishAverage
   void operator()(ArrayT* array, int sumSize) const
   {
     auto range = vtk::DataArrayValueRange(array);
-    using RefT = typename decltype(range)::ReferenceType;
-    for (RefT ref : range)
-    {
-      ref /= sumSize;
-    }
+    vtkSMPTools::For(0, range.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        range[i] /= sumSize;
+      }
+    });
   }
 };
 
@@ -141,12 +152,13 @@ struct FinishStdDev
   {
     const double sumSize = static_cast<double>(sumSizeIn);
     auto range = vtk::DataArrayValueRange(array);
-    using RefT = typename decltype(range)::ReferenceType;
     using ValueT = typename decltype(range)::ValueType;
-    for (RefT ref : range)
-    {
-      ref = static_cast<ValueT>(std::sqrt(static_cast<double>(ref) / sumSize));
-    }
+    vtkSMPTools::For(0, range.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        range[i] = static_cast<ValueT>(std::sqrt(static_cast<double>(range[i]) / sumSize));
+      }
+    });
   }
 };
 } // anonymous namespace
@@ -1210,6 +1210,18 @@ int vtkTessellatorFilter::RequestData(
   vtkIdType deltaProg = numCells / progMax + 1; // the extra + 1 means we always reach the end
   vtkIdType progCells = 0;
 
+  // The set of fields to evaluate is fixed for the whole execution; resolve
+  // the arrays and their offsets once instead of once per cell point.
+  const int numFields = this->Subdivider->GetNumberOfFields();
+  const int* fieldOffsets = this->Subdivider->GetFieldOffsets();
+  std::vector<vtkDataArray*> fieldArrays(numFields);
+  for (int f = 0; f < numFields; ++f)
+  {
+    fieldArrays[f] = mesh->GetPointData()->GetArray(this->Subdivider->GetFieldIds()[f]);
+  }
+  // Interpolation weights scratch space, reused across cells.
+  std::vector<double> weights;
+
   vtkTessellatorHasPolys = 0; // print error message once per invocation, if needed
   for (progress = 0; progress < progMax && !this->CheckAbort(); ++progress)
   {
@@ -1226,7 +1238,7 @@ int vtkTessellatorFilter::RequestData(
 
       vtkCell* cp = this->Subdivider->GetCell(); // We set the cell ID, get the vtkCell pointer
       int np = cp->GetCellType();
-      std::vector<double> weights(cp->GetNumberOfPoints());
+      weights.resize(cp->GetNumberOfPoints());
       double* pcoord = cp->GetParametricCoords();
       if (!pcoord || np == VTK_POLYGON || np == VTK_TRIANGLE_STRIP || np == VTK_CONVEX_POINT_SET ||
         np == VTK_POLY_LINE || np == VTK_POLY_VERTEX || np == VTK_POLYHEDRON ||
@@ -1254,14 +1266,13 @@ int vtkTessellatorFilter::RequestData(
           pts[p][c + 3] = *pcoord;
         }
         // fill in field data
-        const int* offsets = this->Subdivider->GetFieldOffsets();
-        for (int f = 0; f < this->Subdivider->GetNumberOfFields(); ++f)
+        for (int f = 0; f < numFields; ++f)
         {
-          field = mesh->GetPointData()->GetArray(this->Subdivider->GetFieldIds()[f]);
+          field = fieldArrays[f];
           double* tuple = field->GetTuple(cp->GetPointId(p));
           for (c = 0; c < field->GetNumberOfComponents(); ++c)
           {
-            pts[p][6 + offsets[f] + c] = tuple[c];
+            pts[p][6 + fieldOffsets[f] + c] = tuple[c];
           }
         }
       }
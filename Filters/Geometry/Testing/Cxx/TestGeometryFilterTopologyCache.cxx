@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Test the vtkGeometryFilter topology cache: with static connectivity the
+// extracted surface must be reused across executions while changed point
+// and cell attributes are still mapped through.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkGeometryFilter.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <iostream>
+
+namespace
+{
+
+vtkSmartPointer<vtkUnstructuredGrid> CreateTetraGrid()
+{
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0, 0, 0);
+  points->InsertNextPoint(1, 0, 0);
+  points->InsertNextPoint(0, 1, 0);
+  points->InsertNextPoint(0, 0, 1);
+  points->InsertNextPoint(1, 1, 1);
+  grid->SetPoints(points);
+
+  const vtkIdType tetra0[4] = { 0, 1, 2, 3 };
+  const vtkIdType tetra1[4] = { 1, 2, 3, 4 };
+  grid->Allocate(2);
+  grid->InsertNextCell(VTK_TETRA, 4, tetra0);
+  grid->InsertNextCell(VTK_TETRA, 4, tetra1);
+
+  vtkNew<vtkDoubleArray> pointScalars;
+  pointScalars->SetName("pointScalars");
+  pointScalars->SetNumberOfTuples(5);
+  pointScalars->Fill(1.0);
+  grid->GetPointData()->SetScalars(pointScalars);
+
+  vtkNew<vtkDoubleArray> cellScalars;
+  cellScalars->SetName("cellScalars");
+  cellScalars->SetNumberOfTuples(2);
+  cellScalars->Fill(1.0);
+  grid->GetCellData()->SetScalars(cellScalars);
+
+  return grid;
+}
+
+} // namespace
+
+int TestGeometryFilterTopologyCache(int, char*[])
+{
+  auto grid = CreateTetraGrid();
+
+  vtkNew<vtkGeometryFilter> filter;
+  filter->SetInputData(grid);
+  filter->TopologyCachingOn();
+  filter->Update();
+
+  vtkPolyData* surface = filter->GetOutput();
+  const vtkIdType numCells = surface->GetNumberOfCells();
+  const vtkIdType numPoints = surface->GetNumberOfPoints();
+  vtkCellArray* polys = surface->GetPolys();
+  if (numCells < 1 || numPoints < 1)
+  {
+    std::cerr << "Empty surface extracted" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Reference execution without the cache.
+  vtkNew<vtkGeometryFilter> reference;
+  reference->SetInputData(grid);
+  reference->Update();
+  if (reference->GetOutput()->GetNumberOfCells() != numCells ||
+    reference->GetOutput()->GetNumberOfPoints() != numPoints)
+  {
+    std::cerr << "Cached execution differs from reference execution" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Change only the attributes; the connectivity is untouched.
+  auto pointScalars =
+    vtkDoubleArray::SafeDownCast(grid->GetPointData()->GetArray("pointScalars"));
+  pointScalars->Fill(2.0);
+  pointScalars->Modified();
+  auto cellScalars = vtkDoubleArray::SafeDownCast(grid->GetCellData()->GetArray("cellScalars"));
+  cellScalars->Fill(3.0);
+  cellScalars->Modified();
+  filter->Update();
+
+  surface = filter->GetOutput();
+  if (surface->GetNumberOfCells() != numCells || surface->GetNumberOfPoints() != numPoints)
+  {
+    std::cerr << "Surface size changed on a cache hit" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (surface->GetPolys() != polys)
+  {
+    std::cerr << "Cached topology was not reused" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto outPointScalars =
+    vtkDoubleArray::SafeDownCast(surface->GetPointData()->GetArray("pointScalars"));
+  auto outCellScalars =
+    vtkDoubleArray::SafeDownCast(surface->GetCellData()->GetArray("cellScalars"));
+  if (!outPointScalars || !outCellScalars)
+  {
+    std::cerr << "Attributes missing after a cache hit" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    if (outPointScalars->GetValue(i) != 2.0)
+    {
+      std::cerr << "Stale point attributes after a cache hit" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    if (outCellScalars->GetValue(i) != 3.0)
+    {
+      std::cerr << "Stale cell attributes after a cache hit" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The id maps are internal to the cache: they must not leak into the
+  // output when pass-through was not requested.
+  if (surface->GetCellData()->GetAbstractArray(filter->GetOriginalCellIdsName()) ||
+    surface->GetPointData()->GetAbstractArray(filter->GetOriginalPointIdsName()))
+  {
+    std::cerr << "Internal id maps leaked into the output" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Changing the connectivity must invalidate the cache.
+  const vtkIdType tetra2[4] = { 0, 2, 3, 4 };
+  grid->InsertNextCell(VTK_TETRA, 4, tetra2);
+  vtkNew<vtkDoubleArray> newCellScalars;
+  newCellScalars->SetName("cellScalars");
+  newCellScalars->SetNumberOfTuples(3);
+  newCellScalars->Fill(3.0);
+  grid->GetCellData()->SetScalars(newCellScalars);
+  grid->Modified();
+  filter->Update();
+
+  vtkNew<vtkGeometryFilter> reference2;
+  reference2->SetInputData(grid);
+  reference2->Update();
+  if (filter->GetOutput()->GetNumberOfCells() != reference2->GetOutput()->GetNumberOfCells())
+  {
+    std::cerr << "Cache was not invalidated on a connectivity change" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -271,26 +271,41 @@ int vtkDataSetRegionSurfaceFilter::UnstructuredGridExecute(
   }
 
   // First insert all points.  Points have to come first in poly data.
+  // Scan the cell types up front: when the grid carries no vertex cells
+  // (the common case for 3D models) the whole pass over the connectivity
+  // can be skipped.
+  bool hasVertexCells = false;
+  for (vtkIdType id = 0; id < numCells; id++)
+  {
+    if (cellTypes[id] == VTK_VERTEX || cellTypes[id] == VTK_POLY_VERTEX)
+    {
+      hasVertexCells = true;
+      break;
+    }
+  }
   auto cellIter = vtkSmartPointer<vtkCellArrayIterator>::Take(input->GetCells()->NewIterator());
-  for (cellIter->GoToFirstCell(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell())
+  if (hasVertexCells)
   {
-    const vtkIdType cellId = cellIter->GetCurrentCellId();
-    cellIter->GetCurrentCell(numCellPts, ids);
+    for (cellIter->GoToFirstCell(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell())
+    {
+      const vtkIdType cellId = cellIter->GetCurrentCellId();
+      cellIter->GetCurrentCell(numCellPts, ids);
 
-    cellType = cellTypes[cellId];
+      cellType = cellTypes[cellId];
 
-    // A couple of common cases to see if things go faster.
-    if (cellType == VTK_VERTEX || cellType == VTK_POLY_VERTEX)
-    {
-      newVerts->InsertNextCell(numCellPts);
-      for (i = 0; i < numCellPts; ++i)
+      // A couple of common cases to see if things go faster.
+      if (cellType == VTK_VERTEX || cellType == VTK_POLY_VERTEX)
       {
-        inPtId = ids[i];
-        outPtId = this->GetOutputPointId(inPtId, input, newPts, outputPD);
-        newVerts->InsertCellPoint(outPtId);
+        newVerts->InsertNextCell(numCellPts);
+        for (i = 0; i < numCellPts; ++i)
+        {
+          inPtId = ids[i];
+          outPtId = this->GetOutputPointId(inPtId, input, newPts, outputPD);
+          newVerts->InsertCellPoint(outPtId);
+        }
+        this->RecordOrigCellId(this->NumberOfNewCells, cellId);
+        outputCD->CopyData(cd, cellId, this->NumberOfNewCells++);
       }
-      this->RecordOrigCellId(this->NumberOfNewCells, cellId);
-      outputCD->CopyData(cd, cellId, this->NumberOfNewCells++);
     }
   }
 
@@ -342,6 +342,7 @@ vtkDataSetSurfaceFilter::vtkDataSetSurfaceFilter()
   this->NextArrayIndex = 0;
   this->NextQuadIndex = 0;
   this->FastMode = false;
+  this->PassThroughPoints = false;
   this->PieceInvariant = 0;
 
   this->PassThroughCellIds = 0;
@@ -1289,6 +1290,7 @@ void vtkDataSetSurfaceFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent
      << "MatchBoundariesIgnoringCellOrder: " << this->GetMatchBoundariesIgnoringCellOrder() << endl;
   os << indent << "FastMode: " << this->GetFastMode() << endl;
+  os << indent << "PassThroughPoints: " << (this->GetPassThroughPoints() ? "On\n" : "Off\n");
   os << indent << "Delegation: " << this->GetDelegation() << endl;
 }
 
@@ -1320,7 +1322,9 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecute(
   // If no info, then compute information about the unstructured grid.
   // Depending on the outcome, we may process the data ourselves, or send over
   // to the faster vtkGeometryFilter.
-  bool mayDelegate = (info == nullptr && this->Delegation);
+  // Point pass-through is implemented by vtkGeometryFilter (merging off),
+  // so it forces delegation for linear data.
+  bool mayDelegate = (info == nullptr && (this->Delegation || this->PassThroughPoints));
   bool info_owned = false;
   if (info == nullptr)
   {
@@ -1335,6 +1339,10 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecute(
   {
     vtkNew<vtkGeometryFilter> gf;
     vtkGeometryFilterHelper::CopyFilterParams(this, gf.Get());
+    if (this->PassThroughPoints)
+    {
+      gf->MergingOff(); // alias the input points and point data
+    }
     gf->UnstructuredGridExecute(dataSetInput, output, info, nullptr);
     delete info;
     return 1;
@@ -151,6 +151,22 @@ public:
   vtkBooleanMacro(FastMode, bool);
   ///@}
 
+  ///@{
+  /**
+   * When on and the input is an unstructured grid of linear cells, the
+   * output aliases the input vtkPoints object and point data unmodified, and
+   * only new connectivity is generated; combine with PassThroughPointIds if
+   * original point ids are needed. This eliminates the dominant point
+   * allocation on very large grids, at the cost of possibly unused points in
+   * the output. Extraction is handed to vtkGeometryFilter with point merging
+   * disabled. Ignored for inputs that inherently require new points
+   * (structured paths, nonlinear subdivision). Default is off.
+   */
+  vtkSetMacro(PassThroughPoints, bool);
+  vtkGetMacro(PassThroughPoints, bool);
+  vtkBooleanMacro(PassThroughPoints, bool);
+  ///@}
+
   ///@{
   /**
    * If PassThroughCellIds or PassThroughPointIds is on, then these ivars
@@ -359,6 +375,7 @@ protected:
   int MatchBoundariesIgnoringCellOrder;
   vtkTypeBool Delegation;
   bool FastMode;
+  bool PassThroughPoints;
 
 private:
   int UnstructuredGridBaseExecute(vtkDataSet* input, vtkPolyData* output);
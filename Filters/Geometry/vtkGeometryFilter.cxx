@@ -13,6 +13,7 @@
 #include "vtkGenericCell.h"
 #include "vtkHexagonalPrism.h"
 #include "vtkHexahedron.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -96,6 +97,12 @@ vtkGeometryFilter::vtkGeometryFilter()
 
   // Enable delegation to an internal vtkDataSetSurfaceFilter.
   this->Delegation = true;
+
+  this->TopologyCaching = false;
+  this->TopologyCacheInput = nullptr;
+  this->TopologyCacheConnectivityMTime = 0;
+  this->TopologyCachePointsMTime = 0;
+  this->TopologyCacheFilterMTime = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -219,6 +226,14 @@ int vtkGeometryFilter::RequestData(vtkInformation* vtkNotUsed(request),
   }
   else if (vtkUnstructuredGridBase::SafeDownCast(input))
   {
+    // The topology cache only handles plain unstructured grids (the cache
+    // key uses the connectivity array), and an excluded faces input may
+    // change independently of the cached surface.
+    auto ugInput = vtkUnstructuredGrid::SafeDownCast(input);
+    if (this->TopologyCaching && ugInput && !excFaces)
+    {
+      return this->UnstructuredGridTopologyCacheExecute(ugInput, output);
+    }
     return this->UnstructuredGridExecute(input, output, nullptr, excFaces);
   }
   else if (vtkImageData::SafeDownCast(input) || vtkRectilinearGrid::SafeDownCast(input) ||
@@ -307,6 +322,8 @@ void vtkGeometryFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "OriginalCellIdsName: " << this->GetOriginalCellIdsName() << endl;
   os << indent << "OriginalPointIdsName: " << this->GetOriginalPointIdsName() << endl;
 
+  os << indent << "TopologyCaching: " << (this->TopologyCaching ? "On\n" : "Off\n");
+
   os << indent << "NonlinearSubdivisionLevel: " << this->GetNonlinearSubdivisionLevel() << endl;
   os << indent
      << "MatchBoundariesIgnoringCellOrder: " << this->GetMatchBoundariesIgnoringCellOrder() << endl;
@@ -3214,6 +3231,164 @@ int vtkGeometryFilter::UnstructuredGridExecute(vtkDataSet* dataSetInput, vtkPoly
   return this->UnstructuredGridExecute(dataSetInput, output, nullptr, nullptr);
 }
 
+//----------------------------------------------------------------------------
+int vtkGeometryFilter::UnstructuredGridTopologyCacheExecute(
+  vtkUnstructuredGrid* input, vtkPolyData* output)
+{
+  const vtkMTimeType connMTime = input->GetCells() ? input->GetCells()->GetMTime() : 0;
+
+  // The cache is valid only for the same input connectivity and the same
+  // filter parameters that produced it.
+  bool hit = this->TopologyCache && this->TopologyCacheInput == input &&
+    this->TopologyCacheConnectivityMTime == connMTime &&
+    this->TopologyCacheFilterMTime == this->GetMTime();
+
+  vtkIdTypeArray* cellMap = nullptr;
+  vtkIdTypeArray* pointMap = nullptr;
+  if (hit)
+  {
+    vtkPolyData* cache = this->TopologyCache;
+    cellMap = vtkIdTypeArray::FastDownCast(
+      cache->GetCellData()->GetAbstractArray(this->GetOriginalCellIdsName()));
+    // The point map is only produced when the extraction creates new
+    // points; without it the cached surface reuses the input points and
+    // attributes directly.
+    pointMap = vtkIdTypeArray::FastDownCast(
+      cache->GetPointData()->GetAbstractArray(this->GetOriginalPointIdsName()));
+    if (!cellMap || (!pointMap && cache->GetNumberOfPoints() != input->GetNumberOfPoints()))
+    {
+      hit = false;
+    }
+  }
+
+  if (!hit)
+  {
+    // Prime the cache: run the normal extraction with the originating id
+    // maps forced on, then retain the result. The flags are restored via
+    // direct member writes so that priming does not bump the filter MTime.
+    const vtkTypeBool passCellIds = this->PassThroughCellIds;
+    const vtkTypeBool passPointIds = this->PassThroughPointIds;
+    this->PassThroughCellIds = 1;
+    this->PassThroughPointIds = 1;
+    const int retVal = this->UnstructuredGridExecute(input, output, nullptr, nullptr);
+    this->PassThroughCellIds = passCellIds;
+    this->PassThroughPointIds = passPointIds;
+    if (!retVal)
+    {
+      this->TopologyCache = nullptr;
+      return retVal;
+    }
+
+    this->TopologyCache = vtkSmartPointer<vtkPolyData>::New();
+    this->TopologyCache->ShallowCopy(output);
+    this->TopologyCacheInput = input;
+    this->TopologyCacheConnectivityMTime = connMTime;
+    this->TopologyCachePointsMTime = input->GetPoints() ? input->GetPoints()->GetMTime() : 0;
+    this->TopologyCacheFilterMTime = this->GetMTime();
+
+    // Strip the id maps from the output if the user did not ask for them.
+    if (!passCellIds)
+    {
+      output->GetCellData()->RemoveArray(this->GetOriginalCellIdsName());
+    }
+    if (!passPointIds)
+    {
+      output->GetPointData()->RemoveArray(this->GetOriginalPointIdsName());
+    }
+    return retVal;
+  }
+
+  // Cache hit: reuse the extracted topology, and map coordinates and
+  // attributes from the current input through the stored id maps.
+  vtkPolyData* cache = this->TopologyCache;
+  output->CopyStructure(cache);
+
+  // Re-map the point coordinates if they have moved since the cache was
+  // primed (same topology, transient geometry).
+  const vtkMTimeType pointsMTime = input->GetPoints() ? input->GetPoints()->GetMTime() : 0;
+  if (pointsMTime != this->TopologyCachePointsMTime)
+  {
+    if (!pointMap)
+    {
+      // The cached surface uses the input points directly.
+      output->SetPoints(input->GetPoints());
+      cache->SetPoints(input->GetPoints());
+    }
+    else
+    {
+      vtkPoints* inPts = input->GetPoints();
+      const vtkIdType numOutPts = cache->GetNumberOfPoints();
+      vtkNew<vtkPoints> newPts;
+      newPts->SetDataType(cache->GetPoints()->GetDataType());
+      newPts->SetNumberOfPoints(numOutPts);
+      const vtkIdType* ptMap = pointMap->GetPointer(0);
+      vtkSMPTools::For(0, numOutPts, [&](vtkIdType begin, vtkIdType end) {
+        double p[3];
+        for (vtkIdType ptId = begin; ptId < end; ++ptId)
+        {
+          inPts->GetPoint(ptMap[ptId], p);
+          newPts->SetPoint(ptId, p);
+        }
+      });
+      output->SetPoints(newPts);
+      cache->SetPoints(newPts);
+    }
+    this->TopologyCachePointsMTime = pointsMTime;
+  }
+
+  // Map the point attributes.
+  vtkPointData* inPD = input->GetPointData();
+  vtkPointData* outPD = output->GetPointData();
+  if (!pointMap)
+  {
+    outPD->PassData(inPD);
+  }
+  else
+  {
+    // CopyData is not thread safe (it bumps MaxId on every insert), so copy
+    // through an ArrayList like the extraction path does.
+    const vtkIdType numOutPts = cache->GetNumberOfPoints();
+    ArrayList ptArrays;
+    outPD->CopyAllocate(inPD, numOutPts);
+    ptArrays.AddArrays(numOutPts, inPD, outPD, 0.0, false);
+    const vtkIdType* ptMap = pointMap->GetPointer(0);
+    vtkSMPTools::For(0, numOutPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        ptArrays.Copy(ptMap[ptId], ptId);
+      }
+    });
+    if (this->PassThroughPointIds)
+    {
+      outPD->AddArray(pointMap);
+    }
+  }
+
+  // Map the cell attributes.
+  vtkCellData* inCD = input->GetCellData();
+  vtkCellData* outCD = output->GetCellData();
+  const vtkIdType numOutCells = cache->GetNumberOfCells();
+  ArrayList cellArrays;
+  outCD->CopyAllocate(inCD, numOutCells);
+  cellArrays.AddArrays(numOutCells, inCD, outCD, 0.0, false);
+  const vtkIdType* cellMapPtr = cellMap->GetPointer(0);
+  vtkSMPTools::For(0, numOutCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      cellArrays.Copy(cellMapPtr[cellId], cellId);
+    }
+  });
+  if (this->PassThroughCellIds)
+  {
+    outCD->AddArray(cellMap);
+  }
+
+  this->UpdateProgress(1.0);
+  vtkDebugMacro(<< "Reused cached surface topology: " << output->GetNumberOfPoints() << " points, "
+                << output->GetNumberOfCells() << " cells.");
+  return 1;
+}
+
 namespace
 {
 //------------------------------------------------------------------------------
@@ -77,12 +77,14 @@
 
 #include "vtkFiltersGeometryModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
 
 #include <array> // For std::array
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkIncrementalPointLocator;
 class vtkStructuredGrid;
+class vtkUnstructuredGrid;
 class vtkUnstructuredGridBase;
 class vtkGeometryFilter;
 class vtkDataSetSurfaceFilter;
@@ -366,6 +368,23 @@ public:
   vtkBooleanMacro(Delegation, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off caching of the extracted surface topology for unstructured
+   * grid input. When enabled, the extracted surface and its originating
+   * point and cell id maps are retained, keyed on the identity of the input
+   * and the modification time of its connectivity. On subsequent executions
+   * in which only the attributes (and possibly the point coordinates) have
+   * changed — the typical transient case — the cached topology is reused
+   * and only coordinates and attributes are mapped through, skipping the
+   * face hashing entirely. The cache retains a reference to one extracted
+   * surface. Default is off.
+   */
+  vtkSetMacro(TopologyCaching, bool);
+  vtkGetMacro(TopologyCaching, bool);
+  vtkBooleanMacro(TopologyCaching, bool);
+  ///@}
+
   ///@{
   /**
    * Set/Get if Ghost interfaces will be removed.
@@ -450,6 +469,22 @@ protected:
 
   vtkTypeBool Delegation;
 
+  /**
+   * Execute on unstructured grid input with the topology cache: reuse the
+   * cached surface when the cache key matches, otherwise run the normal
+   * extraction and prime the cache from its result.
+   */
+  int UnstructuredGridTopologyCacheExecute(vtkUnstructuredGrid* input, vtkPolyData* output);
+
+  // Support for TopologyCaching. The cached input pointer is only compared
+  // against the current input, never dereferenced.
+  bool TopologyCaching;
+  vtkSmartPointer<vtkPolyData> TopologyCache;
+  vtkDataSet* TopologyCacheInput;
+  vtkMTimeType TopologyCacheConnectivityMTime;
+  vtkMTimeType TopologyCachePointsMTime;
+  vtkMTimeType TopologyCacheFilterMTime;
+
 private:
   vtkGeometryFilter(const vtkGeometryFilter&) = delete;
   void operator=(const vtkGeometryFilter&) = delete;
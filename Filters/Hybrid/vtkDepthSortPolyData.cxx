@@ -9,6 +9,7 @@
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkGenericCell.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -16,10 +17,14 @@
 #include "vtkLongArray.h"
 #include "vtkLongLongArray.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkProp3D.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkShortArray.h"
 #include "vtkSignedCharArray.h"
 #include "vtkTransform.h"
@@ -31,6 +36,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -94,24 +100,7 @@ void getCellCenterDepth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells,
     pds->BuildCells();
   }
 
-  // compute cell centers
-  T* cx = new T[nCells];
-  T* cy = new T[nCells];
-  T* cz = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    // get the cell point ids using the fast api
-    const vtkIdType* pids = nullptr;
-    vtkIdType nPids = 0;
-    pds->GetCellPoints(cid, nPids, pids);
-
-    // compute the center of the cell bounds
-    cx[cid] = getCellBoundsCenter(pids, nPids, px);
-    cy[cid] = getCellBoundsCenter(pids, nPids, py);
-    cz[cid] = getCellBoundsCenter(pids, nPids, pz);
-  }
-
-  // compute the distance to the cell center
+  // compute the distance to the center of each cell's bounds
   T x0 = static_cast<T>(origin[0]);
   T y0 = static_cast<T>(origin[1]);
   T z0 = static_cast<T>(origin[2]);
@@ -119,14 +108,25 @@ void getCellCenterDepth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells,
   T vy = static_cast<T>(direction[1]);
   T vz = static_cast<T>(direction[2]);
   depth = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    depth[cid] = (cx[cid] - x0) * vx + (cy[cid] - y0) * vy + (cz[cid] - z0) * vz;
-  }
+  vtkSMPThreadLocalObject<vtkIdList> tlIds;
+  vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+    // the pointer overload of GetCellPoints is not thread safe, the
+    // overload taking a vtkIdList copies into the provided list instead
+    vtkIdList* ids = tlIds.Local();
+    for (vtkIdType cid = begin; cid < end; ++cid)
+    {
+      const vtkIdType* pids = nullptr;
+      vtkIdType nPids = 0;
+      pds->GetCellPoints(cid, nPids, pids, ids);
+
+      // compute the center of the cell bounds
+      T cx = getCellBoundsCenter(pids, nPids, px);
+      T cy = getCellBoundsCenter(pids, nPids, py);
+      T cz = getCellBoundsCenter(pids, nPids, pz);
 
-  delete[] cx;
-  delete[] cy;
-  delete[] cz;
+      depth[cid] = (cx - x0) * vx + (cy - y0) * vy + (cz - z0) * vz;
+    }
+  });
 }
 
 template <typename T>
@@ -150,21 +150,6 @@ void getCellPoint0Depth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells,
     pds->BuildCells();
   }
 
-  T* cx = new T[nCells];
-  T* cy = new T[nCells];
-  T* cz = new T[nCells];
-  const vtkIdType* pids = nullptr;
-  vtkIdType nPids = 0;
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    // get the cell point ids using the fast api
-    pds->GetCellPoints(cid, nPids, pids);
-    vtkIdType ii = pids[0];
-    cx[cid] = px[3 * ii];
-    cy[cid] = py[3 * ii];
-    cz[cid] = pz[3 * ii];
-  }
-
   // compute the distance to the cell's first point
   T x0 = static_cast<T>(origin[0]);
   T y0 = static_cast<T>(origin[1]);
@@ -173,14 +158,20 @@ void getCellPoint0Depth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells,
   T vy = static_cast<T>(direction[1]);
   T vz = static_cast<T>(direction[2]);
   depth = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    depth[cid] = (cx[cid] - x0) * vx + (cy[cid] - y0) * vy + (cz[cid] - z0) * vz;
-  }
-
-  delete[] cx;
-  delete[] cy;
-  delete[] cz;
+  vtkSMPThreadLocalObject<vtkIdList> tlIds;
+  vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+    // the pointer overload of GetCellPoints is not thread safe, the
+    // overload taking a vtkIdList copies into the provided list instead
+    vtkIdList* ids = tlIds.Local();
+    const vtkIdType* pids = nullptr;
+    vtkIdType nPids = 0;
+    for (vtkIdType cid = begin; cid < end; ++cid)
+    {
+      pds->GetCellPoints(cid, nPids, pids, ids);
+      vtkIdType ii = pids[0];
+      depth[cid] = (px[3 * ii] - x0) * vx + (py[3 * ii] - y0) * vy + (pz[3 * ii] - z0) * vz;
+    }
+  });
 }
 }
 
@@ -294,10 +285,10 @@ int vtkDepthSortPolyData::RequestData(vtkInformation* vtkNotUsed(request),
           // sort cell ids by depth
           if (this->Direction == VTK_DIRECTION_FRONT_TO_BACK) {
             ::lessf<VTK_TT> comp(depth);
-            std::sort(order, order + nCells, comp);
+            vtkSMPTools::Sort(order, order + nCells, comp);
           } else {
             ::greaterf<VTK_TT> comp(depth);
-            std::sort(order, order + nCells, comp);
+            vtkSMPTools::Sort(order, order + nCells, comp);
           }
 
           delete[] depth;);
@@ -305,41 +296,49 @@ int vtkDepthSortPolyData::RequestData(vtkInformation* vtkNotUsed(request),
     }
     else // VTK_SORT_PARAMETRIC_CENTER
     {
-      vtkGenericCell* cell = vtkGenericCell::New();
-
-      double x[3] = { 0.0 };
-      double p[3] = { 0.0 };
-
       size_t maxCellSize = input->GetMaxCellSize();
-      double* weight = new double[maxCellSize];
       double* depth = new double[nCells];
 
-      for (vtkIdType cid = 0; cid < nCells; ++cid)
-      {
-        tmpInput->GetCell(cid, cell);
-        int subId = cell->GetParametricCenter(p);
-        cell->EvaluateLocation(subId, p, x, weight);
-
-        // compute the distance
-        depth[cid] = (x[0] - origin[0]) * direction[0] + (x[1] - origin[1]) * direction[1] +
-          (x[2] - origin[2]) * direction[2];
-      }
+      // build the cell structure serially so that concurrent GetCell
+      // calls below only read it
+      vtkNew<vtkGenericCell> firstCell;
+      tmpInput->GetCell(0, firstCell);
+
+      vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+      vtkSMPThreadLocal<std::vector<double>> tlWeights;
+      vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+        vtkGenericCell* cell = tlCell.Local();
+        std::vector<double>& weight = tlWeights.Local();
+        weight.resize(maxCellSize);
+
+        double x[3] = { 0.0 };
+        double p[3] = { 0.0 };
+
+        for (vtkIdType cid = begin; cid < end; ++cid)
+        {
+          tmpInput->GetCell(cid, cell);
+          int subId = cell->GetParametricCenter(p);
+          cell->EvaluateLocation(subId, p, x, weight.data());
+
+          // compute the distance
+          depth[cid] = (x[0] - origin[0]) * direction[0] + (x[1] - origin[1]) * direction[1] +
+            (x[2] - origin[2]) * direction[2];
+        }
+      });
 
       // sort
       if (this->Direction == VTK_DIRECTION_FRONT_TO_BACK)
       {
         ::lessf<double> comp(depth);
-        std::sort(order, order + nCells, comp);
+        vtkSMPTools::Sort(order, order + nCells, comp);
       }
       else
       {
         ::greaterf<double> comp(depth);
-        std::sort(order, order + nCells, comp);
+        vtkSMPTools::Sort(order, order + nCells, comp);
       }
 
-      delete[] weight;
       delete[] depth;
-      cell->Delete();
     }
   }
 
@@ -14,6 +14,12 @@
  * @warning
  * The sort operation will not work well for long, thin primitives, or cells
  * that intersect, overlap, or interpenetrate each other.
+ *
+ * @warning
+ * The sort runs on every camera move. For plain translucent rendering the
+ * order independent translucency pass used by default by vtkOpenGLRenderer
+ * (vtkOrderIndependentTranslucentPass) resolves transparency per fragment
+ * on the GPU and does not require cells to be sorted at all.
  */
 
 #ifndef vtkDepthSortPolyData_h
@@ -16,6 +16,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
@@ -30,6 +31,7 @@ vtkTemporalInterpolator::vtkTemporalInterpolator()
 {
   this->DiscreteTimeStepInterval = 0.0; // non value
   this->ResampleFactor = 0;             // non value
+  this->StaticMesh = false;
   this->Ratio = 0.0;
   this->DeltaT = 0.0;
   this->Tfrac = 0.0;
@@ -51,6 +53,7 @@ void vtkTemporalInterpolator::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "ResampleFactor: " << this->ResampleFactor << "\n";
   os << indent << "DiscreteTimeStepInterval: " << this->DiscreteTimeStepInterval << "\n";
+  os << indent << "StaticMesh: " << this->StaticMesh << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -402,8 +405,21 @@ vtkDataSet* vtkTemporalInterpolator ::InterpolateDataSet(
   vtkPointSet* inPointSet1 = vtkPointSet::SafeDownCast(input[0]);
   vtkPointSet* inPointSet2 = vtkPointSet::SafeDownCast(input[1]);
   vtkPointSet* outPointSet = vtkPointSet::SafeDownCast(output);
-  if (inPointSet1 && inPointSet2)
+  if (inPointSet1 && inPointSet2 && this->StaticMesh &&
+    inPointSet1->GetNumberOfPoints() == inPointSet2->GetNumberOfPoints())
   {
+    // Static mesh: share the points of the first time step instead of
+    // interpolating coordinates. The connectivity is already shared by
+    // the CopyStructure() above.
+    outPointSet->SetPoints(inPointSet1->GetPoints());
+  }
+  else if (inPointSet1 && inPointSet2)
+  {
+    if (this->StaticMesh)
+    {
+      vtkWarningMacro(
+        "StaticMesh ignored because the number of points differs between time steps");
+    }
     vtkDataArray* outarray = nullptr;
     vtkPoints* outpoints;
 
@@ -576,10 +592,14 @@ struct vtkTemporalExecute
     auto in2 = vtk::DataArrayValueRange(input2);
     auto out = vtk::DataArrayValueRange(output);
 
-    for (vtkIdType i = 0; i < in1.size(); i++)
-    {
-      out[i] = static_cast<T>(in1[i] * oneMinusRatio + in2[i] * ratio);
-    }
+    // The blend is memory-bound and trivially data-parallel; thread it so
+    // that large arrays saturate the memory bandwidth.
+    vtkSMPTools::For(0, in1.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        out[i] = static_cast<T>(in1[i] * oneMinusRatio + in2[i] * ratio);
+      }
+    });
   }
 };
 }
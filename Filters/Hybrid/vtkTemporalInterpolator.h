@@ -92,12 +92,31 @@ public:
   vtkGetMacro(CacheData, bool);
   ///@}
 
+  ///@{
+  /**
+   * If on, the filter assumes the mesh does not change over time: the
+   * output shares the points (and, through CopyStructure, the
+   * connectivity) of the first time step, and only the point and cell
+   * attribute arrays are interpolated. This avoids re-allocating and
+   * re-interpolating the geometry for every interpolated frame, which
+   * matters when temporally supersampling large static-grid results. It
+   * is the caller's responsibility to ensure the mesh really is static;
+   * the option falls back to coordinate interpolation (with a warning)
+   * when the two time steps have a different number of points. Default
+   * is off.
+   */
+  vtkSetMacro(StaticMesh, bool);
+  vtkGetMacro(StaticMesh, bool);
+  vtkBooleanMacro(StaticMesh, bool);
+  ///@}
+
 protected:
   vtkTemporalInterpolator();
   ~vtkTemporalInterpolator() override;
 
   double DiscreteTimeStepInterval;
   int ResampleFactor;
+  bool StaticMesh;
 
   int FillInputPortInformation(int port, vtkInformation* info) override;
   int FillOutputPortInformation(int vtkNotUsed(port), vtkInformation* info) override;
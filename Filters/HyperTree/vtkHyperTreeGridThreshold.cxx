@@ -14,12 +14,14 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkUniformHyperTreeGrid.h"
 
 #include "vtkHyperTreeGridNonOrientedCursor.h"
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace
 {
@@ -265,24 +267,47 @@ int vtkHyperTreeGridThreshold::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObje
   {
     output->ShallowCopy(input);
 
-    this->OutMask->SetNumberOfTuples(output->GetNumberOfCells());
+    const vtkIdType numCells = output->GetNumberOfCells();
+    this->OutMask->SetNumberOfTuples(numCells);
 
-    // Iterate over all input and output hyper trees
+    // Collect the root tree indices, then process every tree as an SMP task:
+    // each traversal only reads the input scalars and mask and writes the
+    // per-cell state owned by its own tree's global indices. The state is
+    // accumulated in one byte per cell and packed into the bit-packed output
+    // mask afterwards, because neighboring trees may share a byte in
+    // vtkBitArray.
+    std::vector<vtkIdType> treeIndices;
     vtkIdType outIndex;
     vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
     output->InitializeTreeIterator(it);
-    vtkNew<vtkHyperTreeGridNonOrientedCursor> outCursor;
     while (it.GetNextTree(outIndex))
     {
-      if (this->CheckAbort())
+      treeIndices.push_back(outIndex);
+    }
+
+    if (!this->CheckAbort())
+    {
+      // Descendants of masked cells are never visited; mark everything masked
+      // up front so they do not inherit uninitialized state.
+      std::vector<unsigned char> maskState(static_cast<std::size_t>(numCells), 1);
+      vtkSMPTools::For(0, static_cast<vtkIdType>(treeIndices.size()),
+        [this, output, &treeIndices, &maskState](vtkIdType begin, vtkIdType end)
+        {
+          vtkNew<vtkHyperTreeGridNonOrientedCursor> outCursor;
+          for (vtkIdType i = begin; i < end; ++i)
+          {
+            // Initialize new grid cursor at root of current tree
+            output->InitializeNonOrientedCursor(outCursor, treeIndices[i]);
+            // Limit depth recursively
+            this->RecursivelyProcessTreeWithCreateNewMask(outCursor, maskState.data());
+          }
+        });
+
+      for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
       {
-        break;
+        this->OutMask->SetTuple1(cellId, maskState[cellId]);
       }
-      // Initialize new grid cursor at root of current input tree
-      output->InitializeNonOrientedCursor(outCursor, outIndex);
-      // Limit depth recursively
-      this->RecursivelyProcessTreeWithCreateNewMask(outCursor);
-    } // it
+    }
   }
   else if (this->MemoryStrategy == CopyStructureAndIndexArrays ||
     this->MemoryStrategy == DeepThreshold)
@@ -437,7 +462,7 @@ bool vtkHyperTreeGridThreshold::RecursivelyProcessTree(
 
 //------------------------------------------------------------------------------
 bool vtkHyperTreeGridThreshold::RecursivelyProcessTreeWithCreateNewMask(
-  vtkHyperTreeGridNonOrientedCursor* outCursor)
+  vtkHyperTreeGridNonOrientedCursor* outCursor, unsigned char* maskState)
 {
   // Retrieve global index of input cursor
   vtkIdType outId = outCursor->GetGlobalNodeIndex();
@@ -448,7 +473,7 @@ bool vtkHyperTreeGridThreshold::RecursivelyProcessTreeWithCreateNewMask(
   if (this->InMask && this->InMask->GetValue(outId))
   {
     // Mask output cell if necessary
-    this->OutMask->InsertTuple1(outId, discard);
+    maskState[outId] = 1;
 
     // Return whether current node is within range
     return discard;
@@ -457,18 +482,15 @@ bool vtkHyperTreeGridThreshold::RecursivelyProcessTreeWithCreateNewMask(
   // Descend further into input trees only if cursor is not at leaf
   if (!outCursor->IsLeaf())
   {
-    // If input cursor is neither at leaf nor at maximum depth, recurse to all children
+    // If input cursor is neither at leaf nor at maximum depth, recurse to all children.
+    // This runs from SMP workers, so no per-node abort check here.
     int numChildren = outCursor->GetNumberOfChildren();
     for (int ichild = 0; ichild < numChildren; ++ichild)
     {
-      if (this->CheckAbort())
-      {
-        break;
-      }
       // Descend into child in output grid as well
       outCursor->ToChild(ichild);
       // Recurse and keep track of whether some children are kept
-      discard &= this->RecursivelyProcessTreeWithCreateNewMask(outCursor);
+      discard &= this->RecursivelyProcessTreeWithCreateNewMask(outCursor, maskState);
       // Return to parent in output grid
       outCursor->ToParent();
     } // child
@@ -481,7 +503,7 @@ bool vtkHyperTreeGridThreshold::RecursivelyProcessTreeWithCreateNewMask(
   } // else
 
   // Mask output cell if necessary
-  this->OutMask->InsertTuple1(outId, discard);
+  maskState[outId] = static_cast<unsigned char>(discard);
 
   // Return whether current node is within range
   return discard;
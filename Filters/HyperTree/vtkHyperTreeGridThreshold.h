@@ -123,7 +123,8 @@ protected:
    */
   bool RecursivelyProcessTree(
     vtkHyperTreeGridNonOrientedCursor*, vtkHyperTreeGridNonOrientedCursor*);
-  bool RecursivelyProcessTreeWithCreateNewMask(vtkHyperTreeGridNonOrientedCursor*);
+  bool RecursivelyProcessTreeWithCreateNewMask(
+    vtkHyperTreeGridNonOrientedCursor*, unsigned char* maskState);
 
   /**
    * LowerThreshold scalar value to be accepted
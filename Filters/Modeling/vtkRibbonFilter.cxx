@@ -261,6 +261,10 @@ int vtkRibbonFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkI
   double nP[3];
   double sFactor = 1.0;
   vtkIdType ptId = offset;
+  // Theta is fixed for the whole execution; hoist the trigonometry out of
+  // the per-point loop.
+  const double cosTheta = cos(this->Theta);
+  const double sinTheta = sin(this->Theta);
 
   // Use "averaged" segment to create beveled effect.
   // Watch out for first and last points.
@@ -359,7 +363,7 @@ int vtkRibbonFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkI
 
     for (i = 0; i < 3; i++)
     {
-      v[i] = (w[i] * cos(this->Theta) + nP[i] * sin(this->Theta));
+      v[i] = (w[i] * cosTheta + nP[i] * sinTheta);
       sp[i] = p[i] + this->Width * sFactor * v[i];
       sm[i] = p[i] - this->Width * sFactor * v[i];
     }
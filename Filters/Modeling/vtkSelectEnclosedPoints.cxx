@@ -147,6 +147,7 @@ vtkSelectEnclosedPoints::vtkSelectEnclosedPoints()
   this->CheckSurface = false;
   this->InsideOut = 0;
   this->Tolerance = 0.0001;
+  this->CacheCellLocator = 1;
 
   this->InsideOutsideArray = nullptr;
 
@@ -227,8 +228,13 @@ int vtkSelectEnclosedPoints::RequestData(vtkInformation* vtkNotUsed(request),
   output->GetPointData()->AddArray(hits);
   output->GetPointData()->SetActiveScalars(hits->GetName());
 
-  // release memory
-  this->Complete();
+  // Release memory, unless the locator is cached for subsequent executions.
+  // A cached locator is only rebuilt when the surface changes (the build is
+  // skipped via the locator's modified time check).
+  if (!this->CacheCellLocator)
+  {
+    this->Complete();
+  }
 
   return 1;
 }
@@ -507,5 +513,7 @@ void vtkSelectEnclosedPoints::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Inside Out: " << (this->InsideOut ? "On\n" : "Off\n");
 
   os << indent << "Tolerance: " << this->Tolerance << "\n";
+
+  os << indent << "Cache Cell Locator: " << (this->CacheCellLocator ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -119,6 +119,20 @@ public:
   vtkGetMacro(Tolerance, double);
   ///@}
 
+  ///@{
+  /**
+   * Specify whether to keep the cell locator search structure between
+   * executions. When on (the default), repeated executions against the same
+   * unchanged surface reuse the locator instead of rebuilding it, which is a
+   * significant win when classifying several point sets against one
+   * surface. Turn this off to release the search structure after each
+   * execution and minimize the memory held between updates.
+   */
+  vtkSetMacro(CacheCellLocator, vtkTypeBool);
+  vtkBooleanMacro(CacheCellLocator, vtkTypeBool);
+  vtkGetMacro(CacheCellLocator, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * This is a backdoor that can be used to test many points for containment.
@@ -159,6 +173,7 @@ protected:
   vtkTypeBool CheckSurface;
   vtkTypeBool InsideOut;
   double Tolerance;
+  vtkTypeBool CacheCellLocator;
 
   vtkUnsignedCharArray* InsideOutsideArray;
 
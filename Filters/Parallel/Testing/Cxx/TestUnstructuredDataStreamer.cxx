@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDataSetTriangleFilter.h"
+#include "vtkNew.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkUnstructuredDataStreamer.h"
+#include "vtkUnstructuredGrid.h"
+
+// The streamer must produce the same data as a non-streamed execution
+// while only ever requesting pieces of its input.
+int TestUnstructuredDataStreamer(int, char*[])
+{
+  // Reference: tetrahedralize the whole analytic source in one go.
+  vtkNew<vtkRTAnalyticSource> referenceSource;
+  referenceSource->SetWholeExtent(0, 15, 0, 15, 0, 15);
+  vtkNew<vtkDataSetTriangleFilter> referenceTriangles;
+  referenceTriangles->SetInputConnection(referenceSource->GetOutputPort());
+  referenceTriangles->Update();
+  vtkIdType referenceCells = referenceTriangles->GetOutput()->GetNumberOfCells();
+  vtkIdType referencePoints = referenceTriangles->GetOutput()->GetNumberOfPoints();
+  if (referenceCells == 0)
+  {
+    std::cerr << "Reference pipeline produced no cells" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Streamed: same pipeline, but updated piece by piece.
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(0, 15, 0, 15, 0, 15);
+  vtkNew<vtkDataSetTriangleFilter> triangles;
+  triangles->SetInputConnection(source->GetOutputPort());
+  vtkNew<vtkUnstructuredDataStreamer> streamer;
+  streamer->SetInputConnection(triangles->GetOutputPort());
+  streamer->SetNumberOfStreamDivisions(4);
+  streamer->Update();
+
+  vtkUnstructuredGrid* output = streamer->GetOutput();
+  if (output->GetNumberOfCells() != referenceCells)
+  {
+    std::cerr << "Streamed execution produced " << output->GetNumberOfCells()
+              << " cells, expected " << referenceCells << std::endl;
+    return EXIT_FAILURE;
+  }
+  // Points are duplicated along piece boundaries since pieces are appended
+  // without merging, so only a lower bound holds.
+  if (output->GetNumberOfPoints() < referencePoints)
+  {
+    std::cerr << "Streamed execution lost points: " << output->GetNumberOfPoints() << " < "
+              << referencePoints << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A memory budget of 1 KiB forces the division count up; the result must
+  // still be complete.
+  vtkNew<vtkUnstructuredDataStreamer> budgeted;
+  budgeted->SetInputConnection(triangles->GetOutputPort());
+  budgeted->SetNumberOfStreamDivisions(2);
+  budgeted->SetMemoryLimit(1024);
+  budgeted->Update();
+  if (budgeted->GetOutput()->GetNumberOfCells() != referenceCells)
+  {
+    std::cerr << "Memory-budgeted execution produced "
+              << budgeted->GetOutput()->GetNumberOfCells() << " cells, expected " << referenceCells
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1950,15 +1950,15 @@ int vtkPKdTree::CompleteTree()
   // Processor 0 collects all the nodes of the k-d tree, and then
   //   processes the tree to ensure region boundaries are
   //   consistent.  The completed tree is then broadcast.
-  std::vector<int> buf(this->NumProcesses);
 
 #ifdef YIELDS_INCONSISTENT_REGION_BOUNDARIES
 
+  std::vector<int> buf(this->NumProcesses);
   this->RetrieveData(this->Top, buf.data());
 
 #else
 
-  this->ReduceData(this->Top, buf.data());
+  this->ReduceData(this->Top);
 
   if (this->MyId == 0)
   {
@@ -2033,88 +2033,206 @@ void vtkPKdTree::UnpackData(vtkKdNode* kd, double* data)
   kd->GetRight()->SetDataBounds(
     rminData[0], rmaxData[0], rminData[1], rmaxData[1], rminData[2], rmaxData[2]);
 }
-void vtkPKdTree::ReduceData(vtkKdNode* kd, int* sources)
+void vtkPKdTree::CollectNodeOwnership(
+  vtkKdNode* kd, int haveKey, int missingKey, std::vector<int>& keys)
+{
+  if (kd->GetLeft() == nullptr)
+    return;
+
+  keys.push_back(kd->GetDim() < 3 ? haveKey : missingKey);
+
+  vtkPKdTree::CollectNodeOwnership(kd->GetLeft(), haveKey, missingKey, keys);
+  vtkPKdTree::CollectNodeOwnership(kd->GetRight(), haveKey, missingKey, keys);
+}
+void vtkPKdTree::PackAssignedNodes(
+  vtkKdNode* kd, const std::vector<int>& action, int processId, int& index, std::vector<double>& buffer)
+{
+  if (kd->GetLeft() == nullptr)
+    return;
+
+  if (action[index++] == processId)
+  {
+    double data[27];
+    vtkPKdTree::PackData(kd, data);
+    buffer.insert(buffer.end(), data, data + 27);
+  }
+
+  vtkPKdTree::PackAssignedNodes(kd->GetLeft(), action, processId, index, buffer);
+  vtkPKdTree::PackAssignedNodes(kd->GetRight(), action, processId, index, buffer);
+}
+void vtkPKdTree::UnpackAssignedNodes(vtkKdNode* kd, const std::vector<int>& action,
+  std::vector<std::vector<double>>& buffers, std::vector<int>& cursors, int& index)
+{
+  if (kd->GetLeft() == nullptr)
+    return;
+
+  int sender = action[index++];
+  if (sender > 0)
+  {
+    vtkPKdTree::UnpackData(kd, buffers[sender].data() + cursors[sender]);
+    cursors[sender] += 27;
+  }
+
+  vtkPKdTree::UnpackAssignedNodes(kd->GetLeft(), action, buffers, cursors, index);
+  vtkPKdTree::UnpackAssignedNodes(kd->GetRight(), action, buffers, cursors, index);
+}
+void vtkPKdTree::PruneUnbuiltNodes(vtkKdNode* kd, const std::vector<int>& action, int& index)
+{
+  if (kd->GetLeft() == nullptr)
+    return;
+
+  int myAction = action[index++];
+
+  // recurse first so the descendants consume their pre-order indices
+  // before they are deleted
+  vtkPKdTree::PruneUnbuiltNodes(kd->GetLeft(), action, index);
+  vtkPKdTree::PruneUnbuiltNodes(kd->GetRight(), action, index);
+
+  if (myAction == -2)
+  {
+    // Normally BuildLocator will create a complete tree, but
+    // it may refuse to divide a region if all the data is at
+    // the same point along the axis it wishes to divide.  In
+    // that case, this region was not divided on any process.
+
+    vtkKdTree::DeleteAllDescendants(kd);
+  }
+}
+void vtkPKdTree::ReduceData(vtkKdNode* kd)
 {
   int i;
-  double data[27];
   vtkCommunicator* comm = this->Controller->GetCommunicator();
 
   if (kd->GetLeft() == nullptr)
     return;
 
-  int ihave = (kd->GetDim() < 3);
+  // The filled-out tree has the same shape on every process, so a pre-order
+  // index identifies a node globally. One reduction determines the
+  // lowest-numbered process that built each node, replacing the per-node
+  // gather and broadcast that dominated the build at high process counts.
 
-  this->SubGroup->Gather(&ihave, sources, 1, 0);
-  this->SubGroup->Broadcast(sources, this->NumProcesses, 0);
+  std::vector<int> keys;
+  vtkPKdTree::CollectNodeOwnership(kd, this->MyId, this->NumProcesses, keys);
 
-  // a contiguous group of process IDs built this node, the first
-  // in the group sends it to node 0 if node 0 doesn't have it
+  int numNodes = static_cast<int>(keys.size());
+  std::vector<int> action(numNodes);
+  this->SubGroup->ReduceMin(keys.data(), action.data(), numNodes, 0);
 
-  if (sources[0] == 0)
+  if (this->MyId == 0)
   {
-    int root = -1;
-
-    for (i = 1; i < this->NumProcesses; i++)
+    // Decide per node: -1 nothing to send (process 0 built it), -2 no
+    // process divided it (prune it everywhere), otherwise the id of the
+    // process that must send its data to process 0.
+    for (i = 0; i < numNodes; i++)
     {
-      if (sources[i])
+      if (keys[i] == 0)
       {
-        root = i;
-        break;
+        action[i] = -1;
+      }
+      else if (action[i] == this->NumProcesses)
+      {
+        action[i] = -2;
       }
     }
-    if (root == -1)
-    {
-
-      // Normally BuildLocator will create a complete tree, but
-      // it may refuse to divide a region if all the data is at
-      // the same point along the axis it wishes to divide.  In
-      // that case, this region was not divided, so just return.
-
-      vtkKdTree::DeleteAllDescendants(kd);
+  }
+  this->SubGroup->Broadcast(action.data(), numNodes, 0);
 
-      return;
+  if (this->MyId == 0)
+  {
+    // one message per process that built nodes process 0 is missing
+    std::vector<int> counts(this->NumProcesses, 0);
+    for (i = 0; i < numNodes; i++)
+    {
+      if (action[i] > 0)
+      {
+        counts[action[i]]++;
+      }
     }
-
-    if (root == this->MyId)
+    std::vector<std::vector<double>> recvBuffers(this->NumProcesses);
+    for (int proc = 1; proc < this->NumProcesses; proc++)
     {
-      vtkPKdTree::PackData(kd, data);
-
-      comm->Send(data, 27, 0, 0x1111);
+      if (counts[proc] > 0)
+      {
+        recvBuffers[proc].resize(27 * counts[proc]);
+        comm->Receive(recvBuffers[proc].data(), 27 * counts[proc], proc, 0x1111);
+      }
     }
-    else if (0 == this->MyId)
+    std::vector<int> cursors(this->NumProcesses, 0);
+    int index = 0;
+    vtkPKdTree::UnpackAssignedNodes(kd, action, recvBuffers, cursors, index);
+  }
+  else
+  {
+    std::vector<double> sendBuffer;
+    int index = 0;
+    vtkPKdTree::PackAssignedNodes(kd, action, this->MyId, index, sendBuffer);
+    if (!sendBuffer.empty())
     {
-      comm->Receive(data, 27, root, 0x1111);
-
-      vtkPKdTree::UnpackData(kd, data);
+      comm->Send(sendBuffer.data(), static_cast<vtkIdType>(sendBuffer.size()), 0, 0x1111);
     }
   }
 
-  this->ReduceData(kd->GetLeft(), sources);
+  int index = 0;
+  vtkPKdTree::PruneUnbuiltNodes(kd, action, index);
+}
+int vtkPKdTree::CountInternalNodes(vtkKdNode* kd)
+{
+  if (kd->GetLeft() == nullptr)
+    return 0;
+
+  return 1 + vtkPKdTree::CountInternalNodes(kd->GetLeft()) +
+    vtkPKdTree::CountInternalNodes(kd->GetRight());
+}
+void vtkPKdTree::PackSubtree(vtkKdNode* kd, std::vector<double>& buffer)
+{
+  if (kd->GetLeft() == nullptr)
+    return;
+
+  double data[27];
+  vtkPKdTree::PackData(kd, data);
+  buffer.insert(buffer.end(), data, data + 27);
 
-  this->ReduceData(kd->GetRight(), sources);
+  vtkPKdTree::PackSubtree(kd->GetLeft(), buffer);
+  vtkPKdTree::PackSubtree(kd->GetRight(), buffer);
 }
-void vtkPKdTree::BroadcastData(vtkKdNode* kd)
+void vtkPKdTree::UnpackSubtree(vtkKdNode* kd, const std::vector<double>& buffer, int& index)
 {
+  if (kd->GetLeft() == nullptr)
+    return;
+
   double data[27];
+  std::copy(buffer.begin() + index, buffer.begin() + index + 27, data);
+  index += 27;
+  vtkPKdTree::UnpackData(kd, data);
 
+  vtkPKdTree::UnpackSubtree(kd->GetLeft(), buffer, index);
+  vtkPKdTree::UnpackSubtree(kd->GetRight(), buffer, index);
+}
+void vtkPKdTree::BroadcastData(vtkKdNode* kd)
+{
   if (kd->GetLeft() == nullptr)
     return;
 
+  // After ReduceData the tree has the same shape on every process, so the
+  // whole tree travels in a single broadcast instead of one per node.
+
+  std::vector<double> buffer;
   if (0 == this->MyId)
   {
-    vtkPKdTree::PackData(kd, data);
+    vtkPKdTree::PackSubtree(kd, buffer);
+  }
+  else
+  {
+    buffer.resize(27 * static_cast<size_t>(vtkPKdTree::CountInternalNodes(kd)));
   }
 
-  this->SubGroup->Broadcast(data, 27, 0);
+  this->SubGroup->Broadcast(buffer.data(), static_cast<int>(buffer.size()), 0);
 
   if (this->MyId > 0)
   {
-    vtkPKdTree::UnpackData(kd, data);
+    int index = 0;
+    vtkPKdTree::UnpackSubtree(kd, buffer, index);
   }
-
-  this->BroadcastData(kd->GetLeft());
-
-  this->BroadcastData(kd->GetRight());
 }
 void vtkPKdTree::CheckFixRegionBoundaries(vtkKdNode* tree)
 {
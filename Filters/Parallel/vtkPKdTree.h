@@ -404,8 +404,18 @@ private:
 #ifdef YIELDS_INCONSISTENT_REGION_BOUNDARIES
   void RetrieveData(vtkKdNode* kd, int* buf);
 #else
-  void ReduceData(vtkKdNode* kd, int* sources);
+  void ReduceData(vtkKdNode* kd);
   void BroadcastData(vtkKdNode* kd);
+  static void CollectNodeOwnership(
+    vtkKdNode* kd, int haveKey, int missingKey, std::vector<int>& keys);
+  static void PackAssignedNodes(vtkKdNode* kd, const std::vector<int>& action, int processId,
+    int& index, std::vector<double>& buffer);
+  static void UnpackAssignedNodes(vtkKdNode* kd, const std::vector<int>& action,
+    std::vector<std::vector<double>>& buffers, std::vector<int>& cursors, int& index);
+  static void PruneUnbuiltNodes(vtkKdNode* kd, const std::vector<int>& action, int& index);
+  static void PackSubtree(vtkKdNode* kd, std::vector<double>& buffer);
+  static void UnpackSubtree(vtkKdNode* kd, const std::vector<double>& buffer, int& index);
+  static int CountInternalNodes(vtkKdNode* kd);
 #endif
 
   void GetDataBounds(int L, int K, int R, float dataBounds[12]);
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkUnstructuredDataStreamer.h"
+
+#include "vtkAppendFilter.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnstructuredGrid.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkUnstructuredDataStreamer);
+
+//------------------------------------------------------------------------------
+vtkUnstructuredDataStreamer::vtkUnstructuredDataStreamer()
+{
+  this->NumberOfStreamDivisions = 10;
+  this->MemoryLimit = 0;
+
+  this->CurrentPiece = 0;
+  this->CurrentNumberOfDivisions = 0;
+  this->DivisionsAdjusted = false;
+
+  this->SetNumberOfInputPorts(1);
+  this->SetNumberOfOutputPorts(1);
+}
+
+//------------------------------------------------------------------------------
+vtkUnstructuredDataStreamer::~vtkUnstructuredDataStreamer() = default;
+
+//------------------------------------------------------------------------------
+void vtkUnstructuredDataStreamer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "NumberOfStreamDivisions: " << this->NumberOfStreamDivisions << endl;
+  os << indent << "MemoryLimit: " << this->MemoryLimit << endl;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkUnstructuredDataStreamer::ProcessRequest(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (request->Has(vtkStreamingDemandDrivenPipeline::REQUEST_UPDATE_EXTENT()))
+  {
+    // At the start of the loop, (re)initialize the division count.
+    if (this->CurrentPiece == 0 && this->CurrentNumberOfDivisions == 0)
+    {
+      this->CurrentNumberOfDivisions = this->NumberOfStreamDivisions;
+      this->DivisionsAdjusted = false;
+    }
+
+    // Request one piece of the input, regardless of what is requested of
+    // the output: the whole point is that upstream only sees pieces.
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+    inInfo->Set(
+      vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(), this->CurrentPiece);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(),
+      this->CurrentNumberOfDivisions);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), 0);
+
+    return 1;
+  }
+
+  // generate the data
+  else if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()))
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    vtkUnstructuredGrid* output =
+      vtkUnstructuredGrid::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+    vtkUnstructuredGrid* input =
+      vtkUnstructuredGrid::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+    // is this the first request
+    if (!this->CurrentPiece)
+    {
+      // Tell the pipeline to start looping.
+      request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+      this->Pieces.clear();
+
+      // With a memory budget, use the first piece to estimate the whole
+      // data size and raise the division count so one piece fits. The
+      // piece is then re-requested under the new division count, since
+      // the piece decomposition changed.
+      if (this->MemoryLimit > 0 && !this->DivisionsAdjusted && input)
+      {
+        this->DivisionsAdjusted = true;
+        unsigned long pieceMemory = input->GetActualMemorySize();
+        if (pieceMemory > this->MemoryLimit)
+        {
+          unsigned long total =
+            pieceMemory * static_cast<unsigned long>(this->CurrentNumberOfDivisions);
+          int required = static_cast<int>((total + this->MemoryLimit - 1) / this->MemoryLimit);
+          if (required > this->CurrentNumberOfDivisions)
+          {
+            this->CurrentNumberOfDivisions = required;
+            return 1;
+          }
+        }
+      }
+    }
+
+    // Collect this piece. The input data object is reused by the next
+    // loop iteration, so the piece must be deep copied.
+    if (input && input->GetNumberOfCells() > 0)
+    {
+      vtkSmartPointer<vtkUnstructuredGrid> piece = vtkSmartPointer<vtkUnstructuredGrid>::New();
+      piece->DeepCopy(input);
+      this->Pieces.push_back(piece);
+    }
+
+    // update the progress
+    this->UpdateProgress(static_cast<double>(this->CurrentPiece + 1.0) /
+      static_cast<double>(this->CurrentNumberOfDivisions));
+
+    this->CurrentPiece++;
+    if (this->CurrentPiece == this->CurrentNumberOfDivisions)
+    {
+      // All pieces are in: append them into the output and stop looping.
+      if (this->Pieces.size() == 1)
+      {
+        output->ShallowCopy(this->Pieces[0]);
+      }
+      else if (!this->Pieces.empty())
+      {
+        vtkNew<vtkAppendFilter> append;
+        append->MergePointsOff();
+        for (const auto& piece : this->Pieces)
+        {
+          append->AddInputData(piece);
+        }
+        append->Update();
+        output->ShallowCopy(append->GetOutput());
+      }
+      else
+      {
+        output->Initialize();
+      }
+
+      this->Pieces.clear();
+      request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+      this->CurrentPiece = 0;
+      this->CurrentNumberOfDivisions = 0;
+    }
+
+    return 1;
+  }
+  return this->Superclass::ProcessRequest(request, inputVector, outputVector);
+}
+VTK_ABI_NAMESPACE_END
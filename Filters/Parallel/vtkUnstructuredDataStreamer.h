@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkUnstructuredDataStreamer
+ * @brief   Initiates piece-based streaming on unstructured data.
+ *
+ * To satisfy a request, this filter updates its input several times, each
+ * time with a different piece request, and appends the pieces into its
+ * output. All processing upstream therefore streams smaller pieces, which
+ * bounds the intermediate memory of the upstream pipeline. Sources that
+ * honor piece requests — vtkHDF and the parallel XML formats store
+ * per-piece offsets and bounds on file — only ever read one piece at a
+ * time, so data sets much larger than memory can be pushed through
+ * reduction filters (contouring, extraction) piece by piece.
+ *
+ * The number of pieces is set with SetNumberOfStreamDivisions(). When a
+ * MemoryLimit is set instead, the first piece is used to estimate the
+ * whole-data size and the division count is raised so that each upstream
+ * piece fits within the limit.
+ *
+ * This filter plays the role vtkImageDataStreamer plays for structured
+ * data; it only bounds upstream memory — its own output still holds the
+ * appended result, so it is meant to sit upstream of reduction filters
+ * rather than at the end of a pipeline.
+ *
+ * @sa
+ * vtkImageDataStreamer vtkExtractUnstructuredGridPiece vtkAppendFilter
+ */
+
+#ifndef vtkUnstructuredDataStreamer_h
+#define vtkUnstructuredDataStreamer_h
+
+#include "vtkFiltersParallelModule.h" // For export macro
+#include "vtkSmartPointer.h"          // For collected pieces
+#include "vtkUnstructuredGridAlgorithm.h"
+
+#include <vector> // For collected pieces
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkUnstructuredGrid;
+
+class VTKFILTERSPARALLEL_EXPORT vtkUnstructuredDataStreamer
+  : public vtkUnstructuredGridAlgorithm
+{
+public:
+  static vtkUnstructuredDataStreamer* New();
+  vtkTypeMacro(vtkUnstructuredDataStreamer, vtkUnstructuredGridAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set how many pieces to divide the input into. Default is 10.
+   */
+  vtkSetClampMacro(NumberOfStreamDivisions, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfStreamDivisions, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set the memory budget for one upstream piece in kibibytes (1024
+   * bytes). When non-zero, the first piece of an execution is used to
+   * estimate the whole-data size and the number of divisions is raised —
+   * never lowered below NumberOfStreamDivisions — so that each piece fits
+   * the budget. Default is 0, i.e. disabled.
+   */
+  vtkSetMacro(MemoryLimit, unsigned long);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
+  // See the vtkAlgorithm for a description of what these do
+  vtkTypeBool ProcessRequest(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+protected:
+  vtkUnstructuredDataStreamer();
+  ~vtkUnstructuredDataStreamer() override;
+
+  int NumberOfStreamDivisions;
+  unsigned long MemoryLimit;
+
+  // streaming state for the current execution
+  int CurrentPiece;
+  int CurrentNumberOfDivisions;
+  bool DivisionsAdjusted;
+  std::vector<vtkSmartPointer<vtkUnstructuredGrid>> Pieces;
+
+private:
+  vtkUnstructuredDataStreamer(const vtkUnstructuredDataStreamer&) = delete;
+  void operator=(const vtkUnstructuredDataStreamer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -4,6 +4,7 @@
 
 #include "vtkBoundingBox.h"
 #include "vtkCellData.h"
+#include "vtkCompositeDataSet.h"
 #include "vtkDIYKdTreeUtilities.h"
 #include "vtkDIYUtilities.h"
 #include "vtkDataSetAttributes.h"
@@ -218,6 +219,9 @@ void vtkNativePartitioningStrategy::PrintSelf(std::ostream& os, vtkIndent indent
   {
     os << indent.GetNextIndent() << "Number Of Cuts: " << this->Cuts.size() << std::endl;
   }
+  os << indent.GetNextIndent() << "Incremental: " << (this->Incremental ? "True" : "False")
+     << std::endl;
+  os << indent.GetNextIndent() << "ImbalanceThreshold: " << this->ImbalanceThreshold << std::endl;
 }
 
 //------------------------------------------------------------------------------
@@ -387,6 +391,13 @@ bool vtkNativePartitioningStrategy::InitializeCuts(vtkDataObjectTree* input)
   {
     this->Cuts = this->ExplicitCuts;
   }
+  else if (this->Incremental && !this->Cuts.empty() &&
+    this->ComputeImbalance(input) <= this->ImbalanceThreshold)
+  {
+    // the load drift since the previous execution is within tolerance: keep
+    // the previous cuts so most cells stay on their current rank and the
+    // exchange stays small
+  }
   else
   {
     this->Cuts = this->GenerateCuts(input);
@@ -394,6 +405,34 @@ bool vtkNativePartitioningStrategy::InitializeCuts(vtkDataObjectTree* input)
   return true;
 }
 
+//------------------------------------------------------------------------------
+double vtkNativePartitioningStrategy::ComputeImbalance(vtkDataObjectTree* input)
+{
+  auto controller = this->GetController();
+  if (!controller || controller->GetNumberOfProcesses() <= 1)
+  {
+    return 0.0;
+  }
+
+  vtkIdType localCells = 0;
+  for (vtkDataSet* ds : vtkCompositeDataSet::GetDataSets<vtkDataSet>(input))
+  {
+    localCells += ds->GetNumberOfCells();
+  }
+
+  vtkIdType totalCells = 0;
+  vtkIdType maxCells = 0;
+  controller->AllReduce(&localCells, &totalCells, 1, vtkCommunicator::SUM_OP);
+  controller->AllReduce(&localCells, &maxCells, 1, vtkCommunicator::MAX_OP);
+  if (totalCells <= 0)
+  {
+    return 0.0;
+  }
+
+  const double average = static_cast<double>(totalCells) / controller->GetNumberOfProcesses();
+  return static_cast<double>(maxCells) / average - 1.0;
+}
+
 //------------------------------------------------------------------------------
 std::vector<vtkBoundingBox> vtkNativePartitioningStrategy::GenerateCuts(vtkDataObject* dobj)
 {
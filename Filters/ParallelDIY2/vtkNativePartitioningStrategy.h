@@ -117,6 +117,35 @@ public:
   vtkBooleanMacro(LoadBalanceAcrossAllBlocks, bool);
   ///@}
 
+  ///@{
+  /**
+   * When on, subsequent `ComputePartition` calls reuse the cuts computed by
+   * the previous one as long as the measured cell-count imbalance across
+   * ranks stays at or below `ImbalanceThreshold`. Because the cuts are
+   * unchanged, cells that did not drift across a cut boundary remain on
+   * their current rank and the redistribution reduces to a small targeted
+   * exchange. When the imbalance exceeds the threshold (or no previous cuts
+   * exist), the full kdtree cut generation runs again. Only applies when
+   * `UseExplicitCuts` is off.
+   *
+   * Default is false.
+   */
+  vtkSetMacro(Incremental, bool);
+  vtkGetMacro(Incremental, bool);
+  vtkBooleanMacro(Incremental, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Maximum tolerated relative imbalance in incremental mode: the ratio of
+   * the most loaded rank's cell count over the average cell count, minus
+   * one. The default of 0.1 tolerates ranks up to 10% above the average
+   * load before the cuts are recomputed.
+   */
+  vtkSetClampMacro(ImbalanceThreshold, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(ImbalanceThreshold, double);
+  ///@}
+
   /**
    * This method is called to generate the partitions for the input dataset.
    * Subclasses should override this to generate partitions using preferred data
@@ -138,12 +167,21 @@ private:
 
   bool InitializeCuts(vtkDataObjectTree* input);
 
+  /**
+   * Returns the relative cell-count imbalance across ranks (maximum over
+   * average, minus one). Returns 0 when running serially or on empty input.
+   */
+  double ComputeImbalance(vtkDataObjectTree* input);
+
   std::vector<vtkBoundingBox> ExplicitCuts;
   std::vector<vtkBoundingBox> Cuts;
   bool UseExplicitCuts = false;
   bool ExpandExplicitCuts = true;
 
   bool LoadBalanceAcrossAllBlocks = true;
+
+  bool Incremental = false;
+  double ImbalanceThreshold = 0.1;
 };
 VTK_ABI_NAMESPACE_END
 
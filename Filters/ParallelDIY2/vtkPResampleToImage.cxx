@@ -25,12 +25,11 @@
 
 // clang-format off
 #include "vtk_diy2.h" // must include this before any diy header
+#include VTK_DIY2(diy/algorithms.hpp)
 #include VTK_DIY2(diy/assigner.hpp)
 #include VTK_DIY2(diy/link.hpp)
 #include VTK_DIY2(diy/master.hpp)
 #include VTK_DIY2(diy/mpi.hpp)
-#include VTK_DIY2(diy/reduce.hpp)
-#include VTK_DIY2(diy/partners/swap.hpp)
 #include VTK_DIY2(diy/decomposition.hpp)
 // clang-format on
 
@@ -330,88 +329,67 @@ inline void GetGlobalFieldMetaData(
 }
 
 //------------------------------------------------------------------------------
-void Redistribute(
-  void* blockp, const diy::ReduceProxy& srp, const diy::RegularSwapPartners& partners)
+// Routes every probed point directly to the block whose output extent owns it.
+// The owning blocks are computed locally from the decomposer, so each point is
+// serialized and sent exactly once instead of being forwarded and repacked
+// through the rounds of a swap reduction. Points on a shared piece boundary
+// are duplicated to every block whose extent contains them.
+void RedistributePoints(Block* b, const diy::ReduceProxy& rp,
+  const diy::RegularDecomposer<diy::DiscreteBounds>& decomposer)
 {
-  Block* b = static_cast<Block*>(blockp);
-  unsigned round = srp.round();
-
-  // step 1: dequeue all the incoming points and add them to this block's vector
-  diy::Master::IncomingQueues& in = *srp.incoming();
-  for (diy::Master::IncomingQueues::iterator i = in.begin(); i != in.end(); ++i)
+  if (rp.in_link().size() == 0) // enqueue
   {
-    while (i->second)
-    {
-      PointList::IndexType idx;
-      srp.dequeue(i->first, idx);
-      b->Points.Indices.push_back(idx);
-
-      std::size_t beg = b->Points.Data.size();
-      b->Points.Data.resize(beg + b->Points.DataSize);
-      srp.dequeue(i->first, &b->Points.Data[beg], b->Points.DataSize);
-    }
-  }
+    PointList myPoints;
+    myPoints.DataSize = b->Points.DataSize;
 
-  // final round
-  if (srp.out_link().size() == 0)
-  {
-    return;
-  }
-
-  // find this block's position in the group
-  int groupSize = srp.out_link().size();
-  int myPos = 0;
-  for (; myPos < groupSize; ++myPos)
-  {
-    if (srp.out_link().target(myPos).gid == srp.gid())
+    std::vector<int> gids;
+    std::size_t numPoints = b->Points.Indices.size();
+    for (std::size_t i = 0; i < numPoints; ++i)
     {
-      break;
+      const PointList::IndexType& idx = b->Points.Indices[i];
+      const char* data = &b->Points.Data[i * b->Points.DataSize];
+
+      gids.clear();
+      decomposer.point_to_gids(gids, idx);
+      for (int gid : gids)
+      {
+        if (gid == rp.gid())
+        {
+          myPoints.Indices.push_back(idx);
+          myPoints.Data.insert(myPoints.Data.end(), data, data + myPoints.DataSize);
+        }
+        else
+        {
+          rp.enqueue(rp.out_link().target(gid), idx);
+          rp.enqueue(rp.out_link().target(gid), data, myPoints.DataSize);
+        }
+      }
     }
+    swap(b->Points, myPoints);
   }
-
-  // step 2: redistribute this block's points among the blocks in the group
-  int axis = partners.dim(round);
-  int minIdx = b->Extent[2 * axis];
-  int maxIdx = b->Extent[2 * axis + 1];
-  int length = (maxIdx - minIdx + 1 + groupSize - 1) / groupSize;
-
-  PointList myPoints;
-  myPoints.DataSize = b->Points.DataSize; // initialize myPoints
-  std::size_t numPoints = b->Points.Indices.size();
-  for (size_t i = 0; i < numPoints; ++i)
+  else // dequeue
   {
-    PointList::IndexType idx = b->Points.Indices[i];
-    const char* data = &b->Points.Data[i * b->Points.DataSize];
-
-    int nlocs = 1;
-    int loc[2] = { (idx[axis] - minIdx) / length, 0 };
-
-    // duplicate shared point
-    if (((idx[axis] - minIdx) % length == 0) && (loc[0] != 0))
+    for (int i = 0; i < rp.in_link().size(); ++i)
     {
-      loc[1] = loc[0] - 1;
-      ++nlocs;
-    }
-
-    for (int j = 0; j < nlocs; ++j)
-    {
-      if (loc[j] == myPos)
+      int gid = rp.in_link().target(i).gid;
+      if (gid == rp.gid())
       {
-        myPoints.Indices.push_back(idx);
-        myPoints.Data.insert(myPoints.Data.end(), data, data + myPoints.DataSize);
+        continue;
       }
-      else
+
+      diy::MemoryBuffer& in = rp.incoming(gid);
+      while (in)
       {
-        srp.enqueue(srp.out_link().target(loc[j]), idx);
-        srp.enqueue(srp.out_link().target(loc[j]), data, myPoints.DataSize);
+        PointList::IndexType idx;
+        rp.dequeue(gid, idx);
+        b->Points.Indices.push_back(idx);
+
+        std::size_t beg = b->Points.Data.size();
+        b->Points.Data.resize(beg + b->Points.DataSize);
+        rp.dequeue(gid, &b->Points.Data[beg], b->Points.DataSize);
       }
     }
   }
-  swap(b->Points, myPoints);
-
-  // step 3: readjust extents for next round
-  b->Extent[2 * axis] = minIdx + (length * myPos);
-  b->Extent[2 * axis + 1] = std::min(b->Extent[2 * axis] + length, maxIdx);
 }
 
 } // anonymous namespace
@@ -489,8 +467,8 @@ int vtkPResampleToImage::RequestData(
   std::vector<FieldMetaData> pointFieldMetaData;
   GetGlobalFieldMetaData(comm, mypiece->GetPointData(), &pointFieldMetaData);
 
-  // perform swap-reduce partitioning on probed points to decompose the domain
-  // into non-overlapping rectangular regions
+  // decompose the domain into one rectangular region per rank and route each
+  // probed point directly to the rank that owns its region
   diy::RoundRobinAssigner assigner(comm.size(), comm.size());
 
   int* updateExtent = this->GetUpdateExtent();
@@ -503,17 +481,28 @@ int vtkPResampleToImage::RequestData(
 
   diy::Master master(comm, 1, -1, &CreateBlock, &DestroyBlock);
 
-  diy::RegularDecomposer<diy::DiscreteBounds> decomposer(3, domain, comm.size());
+  // neighboring regions share their boundary plane of points, matching the
+  // structured-extent convention for distributed pieces
+  diy::RegularDecomposer<diy::DiscreteBounds>::BoolVector shareFace(3, true);
+  diy::RegularDecomposer<diy::DiscreteBounds> decomposer(3, domain, comm.size(), shareFace);
   decomposer.decompose(comm.rank(), assigner, master);
 
   // Set up master's block
   Block* block = master.block<Block>(0);
-  std::copy(updateExtent, updateExtent + 6, block->Extent);
+  diy::DiscreteBounds blockBounds(3);
+  decomposer.fill_bounds(blockBounds, comm.rank());
+  for (int i = 0; i < 3; ++i)
+  {
+    block->Extent[2 * i] = blockBounds.min[i];
+    block->Extent[2 * i + 1] = blockBounds.max[i];
+  }
   block->Points.DataSize = ComputeSerializedFieldDataSize(pointFieldMetaData);
   GetPointsFromImage(mypiece, this->GetMaskArrayName(), &block->Points);
 
-  diy::RegularSwapPartners partners(decomposer, 2, false);
-  diy::reduce(master, assigner, partners, &Redistribute);
+  diy::all_to_all(
+    master, assigner,
+    [&decomposer](Block* b, const diy::ReduceProxy& rp) { RedistributePoints(b, rp, decomposer); },
+    comm.size());
 
   output->SetOrigin(mypiece->GetOrigin());
   output->SetSpacing(mypiece->GetSpacing());
@@ -364,6 +364,52 @@ bool vtkRedistributeDataSetFilter::GetLoadBalanceAcrossAllBlocks()
   return native->GetLoadBalanceAcrossAllBlocks();
 }
 
+//------------------------------------------------------------------------------
+void vtkRedistributeDataSetFilter::SetIncremental(bool incremental)
+{
+  if (!::CheckNativeStrategy(this->Strategy))
+  {
+    return;
+  }
+  auto native = vtkNativePartitioningStrategy::SafeDownCast(this->Strategy);
+  native->SetIncremental(incremental);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkRedistributeDataSetFilter::GetIncremental() const
+{
+  if (!::CheckNativeStrategy(this->Strategy))
+  {
+    return false;
+  }
+  auto native = vtkNativePartitioningStrategy::SafeDownCast(this->Strategy);
+  return native->GetIncremental();
+}
+
+//------------------------------------------------------------------------------
+void vtkRedistributeDataSetFilter::SetImbalanceThreshold(double threshold)
+{
+  if (!::CheckNativeStrategy(this->Strategy))
+  {
+    return;
+  }
+  auto native = vtkNativePartitioningStrategy::SafeDownCast(this->Strategy);
+  native->SetImbalanceThreshold(threshold);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+double vtkRedistributeDataSetFilter::GetImbalanceThreshold() const
+{
+  if (!::CheckNativeStrategy(this->Strategy))
+  {
+    return 0.0;
+  }
+  auto native = vtkNativePartitioningStrategy::SafeDownCast(this->Strategy);
+  return native->GetImbalanceThreshold();
+}
+
 //------------------------------------------------------------------------------
 void vtkRedistributeDataSetFilter::SetNumberOfPartitions(vtkIdType parts)
 {
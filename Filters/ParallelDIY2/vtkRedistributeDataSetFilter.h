@@ -252,6 +252,23 @@ public:
   vtkBooleanMacro(LoadBalanceAcrossAllBlocks, bool);
   ///@}
 
+  ///@{
+  /**
+   * When on, executions reuse the cuts computed by the previous one as long
+   * as the cell-count imbalance across ranks stays at or below
+   * `ImbalanceThreshold` (the ratio of the most loaded rank over the
+   * average, minus one). With unchanged cuts most cells stay on their
+   * current rank, so redistribution of slowly drifting transient data
+   * reduces to a small targeted exchange. Only applies when
+   * `UseExplicitCuts` is off. Default is off with a threshold of 0.1.
+   */
+  void SetIncremental(bool);
+  bool GetIncremental() const;
+  vtkBooleanMacro(Incremental, bool);
+  void SetImbalanceThreshold(double);
+  double GetImbalanceThreshold() const;
+  ///@}
+
   ///@{
   /**
    * Setter/Getter for Strategy
@@ -168,10 +168,18 @@ void vtkPParticleTracerBase::AssignSeedsToProcessors(double t, vtkDataSet* sourc
     info.TailPointId = -1;
   }
   //
-  // Check all Seeds on all processors for classification
+  // Check all Seeds on all processors for classification. When several ranks
+  // can locate a seed (overlapping or ghosted partitions), ties are broken
+  // towards the rank currently integrating the fewest particles: each
+  // candidate publishes a key that orders by its active-particle count first
+  // and by rank second, and the minimum key wins. This keeps convergent
+  // flows from piling every shared particle onto the same candidate rank.
   //
-  std::vector<int> owningProcess(numSeeds, -1);
+  int numProcs = this->Controller->GetNumberOfProcesses();
   int myRank = this->Controller->GetLocalProcessId();
+  vtkIdType myLoad = static_cast<vtkIdType>(this->ParticleHistories.size() + localSeedPoints.size());
+  vtkIdType myKey = myLoad * numProcs + myRank;
+  std::vector<vtkIdType> owningKey(numSeeds, VTK_ID_MAX);
   ParticleIterator it = candidates.begin();
   for (int i = 0; it != candidates.end(); ++it, ++i)
   {
@@ -186,17 +194,17 @@ void vtkPParticleTracerBase::AssignSeedsToProcessors(double t, vtkDataSet* sourc
       if (searchResult == IDStates::INSIDE_ALL || searchResult == IDStates::OUTSIDE_T0)
       {
         // this particle is in this process's domain for the latest time step
-        owningProcess[i] = myRank;
+        owningKey[i] = myKey;
       }
     }
   }
-  std::vector<int> realOwningProcess(numSeeds);
+  std::vector<vtkIdType> realOwningKey(numSeeds);
   this->Controller->AllReduce(
-    owningProcess.data(), realOwningProcess.data(), numSeeds, vtkCommunicator::MAX_OP);
+    owningKey.data(), realOwningKey.data(), numSeeds, vtkCommunicator::MIN_OP);
 
-  for (size_t i = 0; i < realOwningProcess.size(); i++)
+  for (size_t i = 0; i < realOwningKey.size(); i++)
   {
-    if (realOwningProcess[i] == myRank)
+    if (realOwningKey[i] != VTK_ID_MAX && realOwningKey[i] % numProcs == myRank)
     {
       localSeedPoints.push_back(candidates[i]);
     }
@@ -312,10 +320,14 @@ bool vtkPParticleTracerBase::SendReceiveParticles(
     messageOffset.data());
 
   int myRank = this->Controller->GetLocalProcessId();
-
-  // owningProcess is used to make sure that particles that are sent aren't added
-  // on multiple processes
-  std::vector<vtkIdType> owningProcess(numAllParticles, -1);
+  int numProcs = this->Controller->GetNumberOfProcesses();
+
+  // owningKey is used to make sure that particles that are sent aren't added
+  // on multiple processes. As with seed assignment, candidate owners publish
+  // a key ordered by active-particle count first and rank second, so a
+  // particle reachable by several ranks lands on the least loaded one.
+  vtkIdType myKey = static_cast<vtkIdType>(this->ParticleHistories.size()) * numProcs + myRank;
+  std::vector<vtkIdType> owningKey(numAllParticles, VTK_ID_MAX);
   // we automatically ignore particles that we sent
   int ignoreBegin = messageOffset[myRank] / typeSize;
   int ignoreEnd = ignoreBegin + messageLength[myRank] / typeSize;
@@ -331,31 +343,30 @@ bool vtkPParticleTracerBase::SendReceiveParticles(
       if (searchResult == IDStates::INSIDE_ALL || searchResult == IDStates::OUTSIDE_T0)
       {
         // this particle is in this process's domain for the latest time step
-        owningProcess[i] = myRank;
+        owningKey[i] = myKey;
       }
     }
   }
-  std::vector<vtkIdType> realOwningProcess(numAllParticles);
+  std::vector<vtkIdType> realOwningKey(numAllParticles);
   if (numAllParticles)
   {
     this->Controller->AllReduce(
-      owningProcess.data(), realOwningProcess.data(), numAllParticles, vtkCommunicator::MAX_OP);
+      owningKey.data(), realOwningKey.data(), numAllParticles, vtkCommunicator::MIN_OP);
   }
 
-  // if any value in realOwningProcess array is not -1 then we know
+  // if any value in realOwningKey array is not the sentinel then we know
   // that a particle was moved to another process and probably needs
   // to be integrated further
   bool particlesMoved = false; // assume no particles moved
 
   // read the message for the particles that we really want
   int counter = 0;
-  for (std::vector<vtkIdType>::iterator it = realOwningProcess.begin();
-       it != realOwningProcess.end(); ++it)
+  for (std::vector<vtkIdType>::iterator it = realOwningKey.begin(); it != realOwningKey.end(); ++it)
   {
-    if (*it != -1)
+    if (*it != VTK_ID_MAX)
     {
       particlesMoved = true;
-      if (*it == myRank)
+      if (*it % numProcs == myRank)
       {
         counter++;
       }
@@ -363,12 +374,12 @@ bool vtkPParticleTracerBase::SendReceiveParticles(
   }
   rParticles.resize(counter);
   counter = 0;
-  // owningProcess is used to make sure that particles that are sent aren't added
+  // owningKey is used to make sure that particles that are sent aren't added
   // on multiple processes
 
   for (int i = 0; i < numAllParticles; i++)
   {
-    if (realOwningProcess[i] == myRank)
+    if (realOwningKey[i] != VTK_ID_MAX && realOwningKey[i] % numProcs == myRank)
     {
       memcpy(&rParticles[counter].Current, &recvMessage[i * typeSize], size1);
       memcpy(&rParticles[counter].Previous, &recvMessage[i * typeSize] + size1, size1);
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkBoundedPointSource.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMortonSortPoints.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#include <vector>
+
+//------------------------------------------------------------------------------
+int TestMortonSortPoints(int, char*[])
+{
+  const vtkIdType numPts = 10000;
+
+  vtkNew<vtkBoundedPointSource> source;
+  source->SetNumberOfPoints(numPts);
+  source->SetBounds(-1.0, 1.0, -2.0, 2.0, -0.5, 0.5);
+  source->Update();
+
+  // Attach an attribute equal to the original point id so we can check
+  // that attributes travel with their points.
+  vtkPolyData* cloud = source->GetOutput();
+  vtkNew<vtkDoubleArray> tag;
+  tag->SetName("Tag");
+  tag->SetNumberOfTuples(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    tag->SetValue(i, static_cast<double>(i));
+  }
+  cloud->GetPointData()->AddArray(tag);
+
+  vtkNew<vtkMortonSortPoints> sorter;
+  sorter->SetInputData(cloud);
+  sorter->GenerateOriginalPointIdsOn();
+  sorter->Update();
+
+  vtkPolyData* output = sorter->GetOutput();
+  if (output->GetNumberOfPoints() != numPts)
+  {
+    vtkLog(ERROR, "Wrong number of output points: " << output->GetNumberOfPoints());
+    return EXIT_FAILURE;
+  }
+
+  // The point map must be a permutation.
+  const vtkIdType* map = sorter->GetPointMap();
+  std::vector<unsigned char> seen(numPts, 0);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    if (map[i] < 0 || map[i] >= numPts || seen[map[i]])
+    {
+      vtkLog(ERROR, "Point map is not a permutation at input id " << i);
+      return EXIT_FAILURE;
+    }
+    seen[map[i]] = 1;
+  }
+
+  // Each output point must carry the coordinates and attribute of the
+  // input point it maps from, and OriginalPointIds must be the inverse map.
+  auto* outTag =
+    vtkDoubleArray::SafeDownCast(output->GetPointData()->GetArray("Tag"));
+  auto* origIds =
+    vtkIdTypeArray::SafeDownCast(output->GetPointData()->GetArray("OriginalPointIds"));
+  if (!outTag || !origIds)
+  {
+    vtkLog(ERROR, "Missing output point-data arrays.");
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    vtkIdType outId = map[i];
+    double xIn[3], xOut[3];
+    cloud->GetPoint(i, xIn);
+    output->GetPoint(outId, xOut);
+    if (xIn[0] != xOut[0] || xIn[1] != xOut[1] || xIn[2] != xOut[2])
+    {
+      vtkLog(ERROR, "Point coordinates were not permuted correctly at input id " << i);
+      return EXIT_FAILURE;
+    }
+    if (outTag->GetValue(outId) != static_cast<double>(i) || origIds->GetValue(outId) != i)
+    {
+      vtkLog(ERROR, "Point attributes were not permuted correctly at input id " << i);
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
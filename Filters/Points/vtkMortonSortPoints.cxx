@@ -0,0 +1,241 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-CLAUSE
+#include "vtkMortonSortPoints.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkCellArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Helper classes to support efficient computing, and threaded execution.
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+
+// Spread the low 21 bits of v so they occupy every third bit.
+std::uint64_t ExpandBits(std::uint64_t v)
+{
+  v &= 0x1fffff;
+  v = (v | v << 32) & 0x001f00000000ffff;
+  v = (v | v << 16) & 0x001f0000ff0000ff;
+  v = (v | v << 8) & 0x100f00f00f00f00f;
+  v = (v | v << 4) & 0x10c30c30c30c30c3;
+  v = (v | v << 2) & 0x1249249249249249;
+  return v;
+}
+
+using SortKey = std::pair<std::uint64_t, vtkIdType>;
+
+//------------------------------------------------------------------------------
+// Compute the Morton code of each point's coordinates quantized over the
+// input bounds (21 bits per axis). The point id is carried along as a
+// tie-breaker so the sort is deterministic.
+struct ComputeKeys
+{
+  template <typename PointsT>
+  void operator()(PointsT* ptsArray, const double bounds[6], SortKey* keys)
+  {
+    const auto pts = vtk::DataArrayTupleRange<3>(ptsArray);
+    constexpr double maxCode = 2097151.0; // 2^21 - 1
+    double scale[3], origin[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      double range = bounds[2 * i + 1] - bounds[2 * i];
+      origin[i] = bounds[2 * i];
+      scale[i] = (range > 0.0 ? maxCode / range : 0.0);
+    }
+
+    vtkSMPTools::For(0, pts.size(), [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        const auto pt = pts[ptId];
+        std::uint64_t code = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+          double q = (static_cast<double>(pt[i]) - origin[i]) * scale[i];
+          q = (q < 0.0 ? 0.0 : (q > maxCode ? maxCode : q));
+          code |= ExpandBits(static_cast<std::uint64_t>(q)) << i;
+        }
+        keys[ptId] = SortKey(code, ptId);
+      }
+    });
+  }
+};
+
+//------------------------------------------------------------------------------
+// Gather input points (and their attributes) into sorted order, recording
+// the permutation as we go.
+struct GatherPoints
+{
+  template <typename InPointsT, typename OutPointsT>
+  void operator()(InPointsT* inPtsArray, OutPointsT* outPtsArray, const SortKey* keys,
+    vtkIdType* map, vtkPointData* inPD, vtkPointData* outPD)
+  {
+    const auto inPts = vtk::DataArrayTupleRange<3>(inPtsArray);
+    auto outPts = vtk::DataArrayTupleRange<3>(outPtsArray);
+
+    ArrayList arrays;
+    arrays.AddArrays(outPts.size(), inPD, outPD, 0.0, false);
+
+    vtkSMPTools::For(0, outPts.size(), [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        const vtkIdType inPtId = keys[ptId].second;
+        outPts[ptId] = inPts[inPtId];
+        arrays.Copy(inPtId, ptId);
+        map[inPtId] = ptId;
+      }
+    });
+  }
+};
+
+} // anonymous namespace
+
+//================= Begin class proper =======================================
+vtkStandardNewMacro(vtkMortonSortPoints);
+
+//------------------------------------------------------------------------------
+vtkMortonSortPoints::vtkMortonSortPoints()
+{
+  this->PointMap = nullptr;
+  this->GenerateOriginalPointIds = false;
+  this->GenerateVertices = false;
+}
+
+//------------------------------------------------------------------------------
+vtkMortonSortPoints::~vtkMortonSortPoints()
+{
+  delete[] this->PointMap;
+}
+
+//------------------------------------------------------------------------------
+const vtkIdType* vtkMortonSortPoints::GetPointMap()
+{
+  return this->PointMap;
+}
+
+//------------------------------------------------------------------------------
+int vtkMortonSortPoints::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  // get the info objects
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  // get the input and output
+  vtkPointSet* input = vtkPointSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  delete[] this->PointMap; // might have executed previously
+  this->PointMap = nullptr;
+
+  if (!input || !output)
+  {
+    return 1;
+  }
+  vtkIdType numPts = input->GetNumberOfPoints();
+  if (numPts < 1)
+  {
+    return 1;
+  }
+  this->PointMap = new vtkIdType[numPts];
+
+  // First pass: compute the Morton key of each point in parallel.
+  double bounds[6];
+  input->GetBounds(bounds);
+  std::vector<SortKey> keys(numPts);
+  using vtkArrayDispatch::Reals;
+  using KeyDispatcher = vtkArrayDispatch::DispatchByValueType<Reals>;
+  ComputeKeys keyWorker;
+  vtkDataArray* inPtArray = input->GetPoints()->GetData();
+  if (!KeyDispatcher::Execute(inPtArray, keyWorker, bounds, keys.data()))
+  { // fallback for weird types:
+    keyWorker(inPtArray, bounds, keys.data());
+  }
+
+  // Second pass: sort the keys (point ids break ties for determinism).
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+
+  // Third pass: gather the points and attributes into sorted order.
+  vtkPointData* inPD = input->GetPointData();
+  vtkPointData* outPD = output->GetPointData();
+  outPD->CopyAllocate(inPD, numPts);
+  vtkPoints* points = input->GetPoints()->NewInstance();
+  points->SetDataType(input->GetPoints()->GetDataType());
+  points->SetNumberOfPoints(numPts);
+  output->SetPoints(points);
+
+  using Dispatcher = vtkArrayDispatch::Dispatch2BySameValueType<Reals>;
+  GatherPoints gatherWorker;
+  vtkDataArray* outPtArray = output->GetPoints()->GetData();
+  if (!Dispatcher::Execute(
+        inPtArray, outPtArray, gatherWorker, keys.data(), this->PointMap, inPD, outPD))
+  { // fallback for weird types:
+    gatherWorker(inPtArray, outPtArray, keys.data(), this->PointMap, inPD, outPD);
+  }
+  points->Delete();
+
+  // Attach the inverse mapping if requested.
+  if (this->GenerateOriginalPointIds)
+  {
+    vtkNew<vtkIdTypeArray> origIds;
+    origIds->SetName("OriginalPointIds");
+    origIds->SetNumberOfTuples(numPts);
+    vtkIdType* ids = origIds->GetPointer(0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        ids[ptId] = keys[ptId].second;
+      }
+    });
+    outPD->AddArray(origIds);
+  }
+
+  // Generate poly vertex cell if requested
+  if (this->GenerateVertices)
+  {
+    vtkNew<vtkCellArray> verts;
+    verts->AllocateEstimate(1, numPts);
+    verts->InsertNextCell(numPts);
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      verts->InsertCellPoint(ptId);
+    }
+    output->SetVerts(verts);
+  }
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkMortonSortPoints::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPointSet");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkMortonSortPoints::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent
+     << "Generate Original Point Ids: " << (this->GenerateOriginalPointIds ? "On\n" : "Off\n");
+  os << indent << "Generate Vertices: " << (this->GenerateVertices ? "On\n" : "Off\n");
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-CLAUSE
+/**
+ * @class   vtkMortonSortPoints
+ * @brief   reorder a point cloud along a Morton (Z-order) space-filling curve
+ *
+ * vtkMortonSortPoints takes any vtkPointSet and produces a vtkPolyData whose
+ * points (and their attributes) are sorted by the Morton code of their
+ * quantized coordinates. Points that are close in space end up close in
+ * memory, so downstream traversals that visit spatial neighborhoods -- point
+ * locator queries, kernel interpolation, rendering of scan data -- walk the
+ * point array nearly sequentially instead of at random. In particular, after
+ * sorting, the bins of a vtkStaticPointLocator built on the output contain
+ * contiguous runs of point ids, so its neighborhood searches return
+ * cache-friendly id ranges without any change to the locator itself.
+ *
+ * The sort keys are computed and the points gathered in parallel; only the
+ * key sort itself uses vtkSMPTools::Sort. The permutation is recorded and
+ * available through GetPointMap() after execution: map[i] is the position of
+ * the ith input point in the output, which lets filters holding ids into the
+ * original ordering remap them. Optionally the inverse mapping can also be
+ * attached to the output as a point-data array of original point ids.
+ *
+ * The coordinates are quantized to 21 bits per axis over the input bounds,
+ * which is ample for ordering purposes; the point coordinates themselves are
+ * copied unmodified.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
+ * @sa
+ * vtkStaticPointLocator vtkPointCloudFilter vtkHierarchicalBinningFilter
+ */
+
+#ifndef vtkMortonSortPoints_h
+#define vtkMortonSortPoints_h
+
+#include "vtkFiltersPointsModule.h" // For export macro
+#include "vtkPolyDataAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkPointSet;
+
+class VTKFILTERSPOINTS_EXPORT vtkMortonSortPoints : public vtkPolyDataAlgorithm
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiating, obtaining type information, and
+   * printing information.
+   */
+  static vtkMortonSortPoints* New();
+  vtkTypeMacro(vtkMortonSortPoints, vtkPolyDataAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * Retrieve a map which indicates, on a point-by-point basis, where each
+   * input point was placed into the output. In other words, map[i] indicates
+   * where the ith input point is located in the output array of points. This
+   * method returns valid information only after the filter executes.
+   */
+  const vtkIdType* GetPointMap();
+
+  ///@{
+  /**
+   * If enabled, the output point data contains a vtkIdTypeArray named
+   * "OriginalPointIds" giving, for each output point, its id in the input.
+   * This is the inverse of the point map and travels with the data, so
+   * consumers further down the pipeline can remap ids without access to
+   * this filter. By default this is off.
+   */
+  vtkSetMacro(GenerateOriginalPointIds, bool);
+  vtkGetMacro(GenerateOriginalPointIds, bool);
+  vtkBooleanMacro(GenerateOriginalPointIds, bool);
+  ///@}
+
+  ///@{
+  /**
+   * If this method is enabled (true), then the output will contain a vertex
+   * cell for each point (a single vtkPolyVertex). This takes more memory
+   * but some VTK filters need cells to function properly. By default this
+   * is off (false).
+   */
+  vtkSetMacro(GenerateVertices, bool);
+  vtkGetMacro(GenerateVertices, bool);
+  vtkBooleanMacro(GenerateVertices, bool);
+  ///@}
+
+protected:
+  vtkMortonSortPoints();
+  ~vtkMortonSortPoints() override;
+
+  // The permutation from input point ids to output point ids
+  vtkIdType* PointMap;
+
+  bool GenerateOriginalPointIds;
+  bool GenerateVertices;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+private:
+  vtkMortonSortPoints(const vtkMortonSortPoints&) = delete;
+  void operator=(const vtkMortonSortPoints&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
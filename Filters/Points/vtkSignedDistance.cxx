@@ -9,9 +9,11 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkStaticPointLocator.h"
@@ -20,6 +22,7 @@
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSignedDistance);
 vtkCxxSetObjectMacro(vtkSignedDistance, Locator, vtkAbstractPointLocator);
+vtkCxxSetObjectMacro(vtkSignedDistance, SurfaceTransform, vtkMatrix4x4);
 
 //------------------------------------------------------------------------------
 // Helper classes to support efficient computing, and threaded execution.
@@ -38,24 +41,35 @@ struct SignedDistance
   double Radius;
   vtkAbstractPointLocator* Locator;
   float* Scalars;
+  const double* InverseTransform; // maps voxel samples into the surface's frame, may be null
+  const unsigned char* Mask;      // coarse band mask in the surface's frame, may be null
+  double MaskOrigin[3];
+  double MaskBinSize;
+  vtkIdType MaskDims[3];
 
   // Don't want to allocate these working arrays on every thread invocation,
   // so make them thread local.
   vtkSMPThreadLocalObject<vtkIdList> PIds;
 
   SignedDistance(T* pts, float* normals, int dims[3], double origin[3], double spacing[3],
-    double radius, vtkAbstractPointLocator* loc, float* scalars)
+    double radius, vtkAbstractPointLocator* loc, float* scalars, const double* inverseTransform,
+    const unsigned char* mask, const double maskOrigin[3], double maskBinSize, const int maskDims[3])
     : Pts(pts)
     , Normals(normals)
     , Radius(radius)
     , Locator(loc)
     , Scalars(scalars)
+    , InverseTransform(inverseTransform)
+    , Mask(mask)
+    , MaskBinSize(maskBinSize)
   {
     for (int i = 0; i < 3; ++i)
     {
       this->Dims[i] = static_cast<vtkIdType>(dims[i]);
       this->Origin[i] = origin[i];
       this->Spacing[i] = spacing[i];
+      this->MaskOrigin[i] = maskOrigin[i];
+      this->MaskDims[i] = static_cast<vtkIdType>(maskDims[i]);
     }
   }
 
@@ -66,12 +80,46 @@ struct SignedDistance
     pIds->Allocate(128); // allocate some memory
   }
 
+  // Map a voxel sample into the surface's frame (where the locator and the
+  // band mask live) and check it against the band mask. Returns false when
+  // the voxel is known to be outside the narrow band.
+  bool PrepareSample(const double x[3], double xq[3])
+  {
+    if (this->InverseTransform)
+    {
+      const double* m = this->InverseTransform;
+      xq[0] = m[0] * x[0] + m[1] * x[1] + m[2] * x[2] + m[3];
+      xq[1] = m[4] * x[0] + m[5] * x[1] + m[6] * x[2] + m[7];
+      xq[2] = m[8] * x[0] + m[9] * x[1] + m[10] * x[2] + m[11];
+    }
+    else
+    {
+      xq[0] = x[0];
+      xq[1] = x[1];
+      xq[2] = x[2];
+    }
+    if (this->Mask)
+    {
+      vtkIdType bin[3];
+      for (int i = 0; i < 3; ++i)
+      {
+        bin[i] = static_cast<vtkIdType>((xq[i] - this->MaskOrigin[i]) / this->MaskBinSize);
+        if (xq[i] < this->MaskOrigin[i] || bin[i] >= this->MaskDims[i])
+        {
+          return false;
+        }
+      }
+      return this->Mask[bin[0] + this->MaskDims[0] * (bin[1] + this->MaskDims[1] * bin[2])] != 0;
+    }
+    return true;
+  }
+
   // Threaded interpolation method
   void operator()(vtkIdType slice, vtkIdType sliceEnd)
   {
     T* p;
     float* n;
-    double x[3], dist;
+    double x[3], xq[3], dist;
     vtkIdType numPts;
     double* origin = this->Origin;
     double* spacing = this->Spacing;
@@ -95,9 +143,15 @@ struct SignedDistance
           x[0] = origin[0] + i * spacing[0];
           ptId = i + jOffset + kOffset;
 
+          if (!this->PrepareSample(x, xq))
+          {
+            // Far from the surface; keep the empty value.
+            continue;
+          }
+
           // Compute signed distance at voxel from surrounding points. Use average
           // distance of neighboring points.
-          this->Locator->FindPointsWithinRadius(this->Radius, x, pIds);
+          this->Locator->FindPointsWithinRadius(this->Radius, xq, pIds);
           numPts = pIds->GetNumberOfIds();
           if (numPts > 0)
           {
@@ -105,7 +159,7 @@ struct SignedDistance
             {
               p = this->Pts + 3 * pIds->GetId(ii);
               n = this->Normals + 3 * pIds->GetId(ii);
-              dist += n[0] * (p[0] - x[0]) + n[1] * (p[1] - x[1]) + n[2] * (p[2] - x[2]);
+              dist += n[0] * (p[0] - xq[0]) + n[1] * (p[1] - xq[1]) + n[2] * (p[2] - xq[2]);
             }
             this->Scalars[ptId] = dist / static_cast<double>(numPts);
           } // if nearby points
@@ -117,15 +171,75 @@ struct SignedDistance
   void Reduce() {}
 
   static void Execute(vtkSignedDistance* self, T* pts, float* normals, int dims[3],
-    double origin[3], double spacing[3], float* scalars)
+    double origin[3], double spacing[3], float* scalars, const double* inverseTransform,
+    const unsigned char* mask, const double maskOrigin[3], double maskBinSize, const int maskDims[3])
   {
-    SignedDistance dist(
-      pts, normals, dims, origin, spacing, self->GetRadius(), self->GetLocator(), scalars);
+    SignedDistance dist(pts, normals, dims, origin, spacing, self->GetRadius(), self->GetLocator(),
+      scalars, inverseTransform, mask, maskOrigin, maskBinSize, maskDims);
     vtkSMPTools::For(0, dims[2], dist);
   }
 
 }; // SignedDistance
 
+// Bin the surface points into the coarse band mask. Each thread marks its
+// own local mask which are ORed together in Reduce() to avoid contention on
+// the shared bins.
+struct BinSurfacePoints
+{
+  vtkPoints* Points;
+  double MaskOrigin[3];
+  double MaskBinSize;
+  vtkIdType MaskDims[3];
+  vtkIdType MaskSize;
+  std::vector<unsigned char>& Occupied;
+
+  vtkSMPThreadLocal<std::vector<unsigned char>> LocalOccupied;
+
+  BinSurfacePoints(vtkPoints* pts, const double maskOrigin[3], double maskBinSize,
+    const int maskDims[3], std::vector<unsigned char>& occupied)
+    : Points(pts)
+    , MaskBinSize(maskBinSize)
+    , Occupied(occupied)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      this->MaskOrigin[i] = maskOrigin[i];
+      this->MaskDims[i] = static_cast<vtkIdType>(maskDims[i]);
+    }
+    this->MaskSize = this->MaskDims[0] * this->MaskDims[1] * this->MaskDims[2];
+  }
+
+  void Initialize() { this->LocalOccupied.Local().resize(this->MaskSize, 0); }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    std::vector<unsigned char>& occupied = this->LocalOccupied.Local();
+    double x[3];
+
+    for (; ptId < endPtId; ++ptId)
+    {
+      this->Points->GetPoint(ptId, x);
+      vtkIdType bin[3];
+      for (int i = 0; i < 3; ++i)
+      {
+        bin[i] = static_cast<vtkIdType>((x[i] - this->MaskOrigin[i]) / this->MaskBinSize);
+      }
+      occupied[bin[0] + this->MaskDims[0] * (bin[1] + this->MaskDims[1] * bin[2])] = 1;
+    }
+  }
+
+  void Reduce()
+  {
+    for (const auto& local : this->LocalOccupied)
+    {
+      for (vtkIdType i = 0; i < this->MaskSize; ++i)
+      {
+        this->Occupied[i] |= local[i];
+      }
+    }
+  }
+}; // BinSurfacePoints
+
 } // anonymous namespace
 
 //================= Begin class proper =======================================
@@ -148,6 +262,11 @@ vtkSignedDistance::vtkSignedDistance()
   this->Radius = 0.1;
 
   this->Locator = vtkStaticPointLocator::New();
+  this->SurfaceTransform = nullptr;
+
+  this->MaskOrigin[0] = this->MaskOrigin[1] = this->MaskOrigin[2] = 0.0;
+  this->MaskBinSize = 0.0;
+  this->MaskDims[0] = this->MaskDims[1] = this->MaskDims[2] = 0;
 
   this->Initialized = 0;
 }
@@ -156,6 +275,19 @@ vtkSignedDistance::vtkSignedDistance()
 vtkSignedDistance::~vtkSignedDistance()
 {
   this->SetLocator(nullptr);
+  this->SetSurfaceTransform(nullptr);
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkSignedDistance::GetMTime()
+{
+  vtkMTimeType mTime = this->Superclass::GetMTime();
+  if (this->SurfaceTransform)
+  {
+    vtkMTimeType time = this->SurfaceTransform->GetMTime();
+    mTime = (time > mTime ? time : mTime);
+  }
+  return mTime;
 }
 
 //------------------------------------------------------------------------------
@@ -246,25 +378,125 @@ void vtkSignedDistance::Append(vtkPolyData* input)
   }
   float* normals = static_cast<float*>(normalArray->GetVoidPointer(0));
 
-  // Build the locator
+  // Build the locator and the coarse band mask. When a surface transform is
+  // in use they live in the surface's own frame and persist across
+  // executions: a rigid motion of the surface only changes the transform,
+  // not the structures, so they are reused until the points are modified.
   if (!this->Locator)
   {
     vtkErrorMacro(<< "Point locator required\n");
     return;
   }
-  this->Locator->SetDataSet(input);
-  this->Locator->BuildLocator();
+  bool reuse = this->SurfaceTransform && this->Locator->GetDataSet() == input &&
+    this->Locator->GetBuildTime() > pts->GetMTime() && !this->BandMask.empty();
+  if (!reuse)
+  {
+    this->Locator->SetDataSet(input);
+    this->Locator->BuildLocator();
+    this->BuildBandMask(input);
+  }
+
+  // Voxel samples are mapped into the surface's frame before querying; a
+  // rigid transform preserves distances so the result is unchanged.
+  double inverse[16];
+  const double* xform = nullptr;
+  if (this->SurfaceTransform)
+  {
+    vtkMatrix4x4::Invert(this->SurfaceTransform->GetData(), inverse);
+    xform = inverse;
+  }
+  const unsigned char* mask = this->BandMask.empty() ? nullptr : this->BandMask.data();
 
   // Finally: compute the signed distance function
   vtkImageData* output = this->GetOutput();
   void* inPtr = pts->GetVoidPointer(0);
   switch (pts->GetDataType())
   {
-    vtkTemplateMacro(SignedDistance<VTK_TT>::Execute(this, (VTK_TT*)inPtr, normals,
-      this->Dimensions, output->GetOrigin(), output->GetSpacing(), scalars));
+    vtkTemplateMacro(
+      SignedDistance<VTK_TT>::Execute(this, (VTK_TT*)inPtr, normals, this->Dimensions,
+        output->GetOrigin(), output->GetSpacing(), scalars, xform, mask, this->MaskOrigin,
+        this->MaskBinSize, this->MaskDims));
   }
 }
 
+//------------------------------------------------------------------------------
+// Build a coarse occupancy mask over the surface. The bins are at least
+// Radius wide, so dilating the occupied bins by one covers every voxel whose
+// distance to a surface point may be within Radius; everything else can be
+// skipped without a locator query.
+void vtkSignedDistance::BuildBandMask(vtkPolyData* input)
+{
+  this->BandMask.clear();
+
+  double bounds[6];
+  input->GetBounds(bounds);
+  double maxRange = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    double range = bounds[2 * i + 1] - bounds[2 * i];
+    maxRange = (range > maxRange ? range : maxRange);
+  }
+  // Cap the number of bins per axis to bound the mask's memory use.
+  this->MaskBinSize = (this->Radius > maxRange / 128 ? this->Radius : maxRange / 128);
+  if (this->MaskBinSize <= 0.0)
+  {
+    return;
+  }
+  vtkIdType maskSize = 1;
+  for (int i = 0; i < 3; ++i)
+  {
+    // One bin of margin on each side so the dilation below stays in range.
+    this->MaskOrigin[i] = bounds[2 * i] - this->MaskBinSize;
+    this->MaskDims[i] =
+      static_cast<int>((bounds[2 * i + 1] - bounds[2 * i]) / this->MaskBinSize) + 3;
+    maskSize *= this->MaskDims[i];
+  }
+
+  // Mark the bins containing surface points, in parallel over the points.
+  std::vector<unsigned char> occupied(maskSize, 0);
+  vtkPoints* pts = input->GetPoints();
+  vtkIdType numPts = input->GetNumberOfPoints();
+  BinSurfacePoints binPoints(
+    pts, this->MaskOrigin, this->MaskBinSize, this->MaskDims, occupied);
+  vtkSMPTools::For(0, numPts, binPoints);
+
+  // Dilate by one bin in each direction to cover the full band, in parallel
+  // over slices (reads occupied, writes the mask).
+  this->BandMask.resize(maskSize, 0);
+  const vtkIdType maskDims[3] = { this->MaskDims[0], this->MaskDims[1], this->MaskDims[2] };
+  unsigned char* bandMask = this->BandMask.data();
+  const unsigned char* occ = occupied.data();
+  vtkSMPTools::For(0, this->MaskDims[2], [&](vtkIdType k, vtkIdType kEnd) {
+    for (; k < kEnd; ++k)
+    {
+      for (vtkIdType j = 0; j < maskDims[1]; ++j)
+      {
+        for (vtkIdType i = 0; i < maskDims[0]; ++i)
+        {
+          bool nearSurface = false;
+          for (vtkIdType kk = (k > 0 ? k - 1 : 0);
+               !nearSurface && kk <= (k < maskDims[2] - 1 ? k + 1 : k); ++kk)
+          {
+            for (vtkIdType jj = (j > 0 ? j - 1 : 0);
+                 !nearSurface && jj <= (j < maskDims[1] - 1 ? j + 1 : j); ++jj)
+            {
+              for (vtkIdType ii = (i > 0 ? i - 1 : 0);
+                   !nearSurface && ii <= (i < maskDims[0] - 1 ? i + 1 : i); ++ii)
+              {
+                nearSurface = occ[ii + maskDims[0] * (jj + maskDims[1] * kk)] != 0;
+              }
+            }
+          }
+          if (nearSurface)
+          {
+            bandMask[i + maskDims[0] * (j + maskDims[1] * k)] = 1;
+          }
+        }
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 // Method completes the append process (does the capping if requested).
 void vtkSignedDistance::EndAppend()
@@ -435,5 +667,6 @@ void vtkSignedDistance::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "  Zmin,Zmax: (" << this->Bounds[4] << ", " << this->Bounds[5] << ")\n";
 
   os << indent << "Locator: " << this->Locator << "\n";
+  os << indent << "SurfaceTransform: " << this->SurfaceTransform << "\n";
 }
 VTK_ABI_NAMESPACE_END
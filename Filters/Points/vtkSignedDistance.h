@@ -60,9 +60,12 @@
 #include "vtkFiltersPointsModule.h" // For export macro
 #include "vtkImageAlgorithm.h"
 
+#include <vector> // For band mask
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkPolyData;
 class vtkAbstractPointLocator;
+class vtkMatrix4x4;
 
 class VTKFILTERSPOINTS_EXPORT vtkSignedDistance : public vtkImageAlgorithm
 {
@@ -116,6 +119,29 @@ public:
   vtkGetObjectMacro(Locator, vtkAbstractPointLocator);
   ///@}
 
+  ///@{
+  /**
+   * Specify an optional 4x4 rigid transform taking the input surface from
+   * the frame its points are defined in to its current pose. When set, the
+   * filter computes the distance to the transformed surface but keeps the
+   * point locator and the coarse band mask built in the surface's own
+   * frame: voxel samples are mapped through the inverse transform before
+   * the proximity queries, so successive executions with updated poses
+   * reuse the locator instead of rebuilding it. The locator is only
+   * rebuilt when the input points themselves are modified. Specify Bounds
+   * explicitly when using a transform, since the automatic bounds are
+   * computed from the untransformed input. Default is none.
+   */
+  void SetSurfaceTransform(vtkMatrix4x4* transform);
+  vtkGetObjectMacro(SurfaceTransform, vtkMatrix4x4);
+  ///@}
+
+  /**
+   * The modified time also depends on the surface transform, so moving the
+   * surface re-executes the filter without rebuilding the locator.
+   */
+  vtkMTimeType GetMTime() override;
+
   /**
    * Initialize the filter for appending data. You must invoke the
    * StartAppend() method before doing successive Appends(). It's also a
@@ -150,10 +176,22 @@ protected:
   double Bounds[6];
   double Radius;
   vtkAbstractPointLocator* Locator;
+  vtkMatrix4x4* SurfaceTransform;
 
   // Flag tracks whether process needs initialization
   int Initialized;
 
+  // Coarse occupancy mask over the surface used to skip voxels outside the
+  // narrow band without a locator query. It is built in the surface's own
+  // frame so it can be reused along with the locator.
+  std::vector<unsigned char> BandMask;
+  double MaskOrigin[3];
+  double MaskBinSize;
+  int MaskDims[3];
+
+  // Build the band mask for the given surface.
+  void BuildBandMask(vtkPolyData* input);
+
   int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int FillInputPortInformation(int, vtkInformation*) override;
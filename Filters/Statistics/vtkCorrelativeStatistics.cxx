@@ -264,6 +264,11 @@ void vtkCorrelativeStatistics::Learn(
       continue;
     }
 
+    // Fetch the columns once and read them through direct typed access,
+    // so the accumulation does not box a vtkVariant for every cell.
+    vtkDataArray* arrX = vtkArrayDownCast<vtkDataArray>(inData->GetColumnByName(colX.c_str()));
+    vtkDataArray* arrY = vtkArrayDownCast<vtkDataArray>(inData->GetColumnByName(colY.c_str()));
+
     double meanX = 0.;
     double meanY = 0.;
     double mom2X = 0.;
@@ -275,13 +280,13 @@ void vtkCorrelativeStatistics::Learn(
     {
       inv_n = 1. / (r + 1.);
 
-      x = inData->GetValueByName(r, colX.c_str()).ToDouble();
+      x = arrX ? arrX->GetComponent(r, 0) : inData->GetValueByName(r, colX.c_str()).ToDouble();
       delta = x - meanX;
       meanX += delta * inv_n;
       deltaXn = x - meanX;
       mom2X += delta * deltaXn;
 
-      y = inData->GetValueByName(r, colY.c_str()).ToDouble();
+      y = arrY ? arrY->GetComponent(r, 0) : inData->GetValueByName(r, colY.c_str()).ToDouble();
       delta = y - meanY;
       meanY += delta * inv_n;
       mom2Y += delta * (y - meanY);
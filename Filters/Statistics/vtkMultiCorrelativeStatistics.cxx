@@ -3,6 +3,8 @@
 #include "vtkMultiCorrelativeStatistics.h"
 #include "vtkMultiCorrelativeStatisticsAssessFunctor.h"
 
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataObject.h"
 #include "vtkDataObjectCollection.h"
 #include "vtkDataSetAttributes.h"
@@ -21,6 +23,7 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkVariantArray.h"
 
+#include <algorithm>
 #include <map>
 #include <sstream>
 #include <vector>
@@ -70,6 +73,160 @@ struct GhostsCounter
   vtkIdType GlobalNumberOfGhosts;
   vtkSMPThreadLocal<vtkIdType> NumberOfGhosts;
 };
+
+//==============================================================================
+// Partial means and column-pair comoments for a contiguous range of rows.
+struct PartialMoments
+{
+  vtkIdType N = 0;
+  std::vector<double> Mu;
+  std::vector<double> Cov;
+};
+
+//==============================================================================
+// Copy one column range into a contiguous buffer of doubles, so that the
+// accumulation loop does not make a virtual call per value.
+struct ColumnGatherWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, vtkIdType begin, vtkIdType end, double* values) const
+  {
+    const auto range = vtk::DataArrayValueRange<1>(array, begin, end);
+    std::copy(range.cbegin(), range.cend(), values);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Accumulate the means and column-pair comoments over rows [begin, end),
+// using the same online updates as for the whole table.
+void AccumulateMoments(const std::vector<vtkDataArray*>& cols,
+  const std::vector<std::pair<vtkIdType, vtkIdType>>& pairs, vtkUnsignedCharArray* ghosts,
+  unsigned char ghostsToSkip, vtkIdType begin, vtkIdType end, PartialMoments& moments)
+{
+  vtkIdType m = static_cast<vtkIdType>(cols.size());
+  vtkIdType nPair = static_cast<vtkIdType>(pairs.size());
+  vtkIdType nValues = end - begin;
+
+  moments.Mu.assign(m, 0.);
+  moments.Cov.assign(nPair, 0.);
+
+  // gather the column values for this range of rows
+  std::vector<double> values(m * nValues);
+  ColumnGatherWorker worker;
+  for (vtkIdType j = 0; j < m; ++j)
+  {
+    double* colValues = &values[j * nValues];
+    if (cols[j]->GetNumberOfComponents() != 1 ||
+      !vtkArrayDispatch::Dispatch::Execute(cols[j], worker, begin, end, colValues))
+    {
+      for (vtkIdType r = 0; r < nValues; ++r)
+      {
+        colValues[r] = cols[j]->GetComponent(begin + r, 0);
+      }
+    }
+  }
+
+  double* mu = moments.Mu.data();
+  double* cov = moments.Cov.data();
+  vtkIdType counter = 0;
+  for (vtkIdType r = 0; r < nValues; ++r)
+  {
+    if (ghosts && (ghosts->GetValue(begin + r) & ghostsToSkip))
+    {
+      continue;
+    }
+    // Update column products. Equation 3.12 from the SAND report.
+    double f = counter / (counter + 1.);
+    for (vtkIdType l = 0; l < nPair; ++l)
+    {
+      cov[l] += (values[pairs[l].first * nValues + r] - mu[pairs[l].first]) *
+        (values[pairs[l].second * nValues + r] - mu[pairs[l].second]) * f;
+    }
+    // Update running column averages. Equation 1.1 from the SAND report.
+    for (vtkIdType j = 0; j < m; ++j)
+    {
+      mu[j] += (values[j * nValues + r] - mu[j]) / (counter + 1);
+    }
+    ++counter;
+  }
+  moments.N = counter;
+}
+
+//------------------------------------------------------------------------------
+// Merge a set of partial moments into another, using the same pairwise
+// update as Aggregate().
+void MergeMoments(
+  const std::vector<std::pair<vtkIdType, vtkIdType>>& pairs, PartialMoments& out,
+  const PartialMoments& in)
+{
+  if (in.N == 0)
+  {
+    return;
+  }
+  if (out.N == 0)
+  {
+    out = in;
+    return;
+  }
+
+  vtkIdType totN = out.N + in.N;
+  double muFactor = static_cast<double>(in.N) / totN;
+  double covFactor = static_cast<double>(in.N) * out.N / totN;
+
+  vtkIdType nPair = static_cast<vtkIdType>(pairs.size());
+  for (vtkIdType l = 0; l < nPair; ++l)
+  {
+    out.Cov[l] += in.Cov[l] +
+      (in.Mu[pairs[l].first] - out.Mu[pairs[l].first]) *
+        (in.Mu[pairs[l].second] - out.Mu[pairs[l].second]) * covFactor;
+  }
+  vtkIdType m = static_cast<vtkIdType>(out.Mu.size());
+  for (vtkIdType j = 0; j < m; ++j)
+  {
+    out.Mu[j] += (in.Mu[j] - out.Mu[j]) * muFactor;
+  }
+  out.N = totN;
+}
+
+//==============================================================================
+// Accumulate partial moments per thread over subranges of rows, then merge
+// them pairwise so the Learn phase scales with the number of cores.
+struct MomentsFunctor
+{
+  MomentsFunctor(const std::vector<vtkDataArray*>& cols,
+    const std::vector<std::pair<vtkIdType, vtkIdType>>& pairs, vtkUnsignedCharArray* ghosts,
+    unsigned char ghostsToSkip)
+    : Cols(cols)
+    , Pairs(pairs)
+    , Ghosts(ghosts)
+    , GhostsToSkip(ghostsToSkip)
+  {
+  }
+
+  void Initialize() { this->Partials.Local() = PartialMoments{}; }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    PartialMoments local;
+    AccumulateMoments(this->Cols, this->Pairs, this->Ghosts, this->GhostsToSkip, begin, end, local);
+    MergeMoments(this->Pairs, this->Partials.Local(), local);
+  }
+
+  void Reduce()
+  {
+    for (PartialMoments& partial : this->Partials)
+    {
+      MergeMoments(this->Pairs, this->Global, partial);
+    }
+  }
+
+  const std::vector<vtkDataArray*>& Cols;
+  const std::vector<std::pair<vtkIdType, vtkIdType>>& Pairs;
+  vtkUnsignedCharArray* Ghosts;
+  unsigned char GhostsToSkip;
+  PartialMoments Global;
+  vtkSMPThreadLocal<PartialMoments> Partials;
+};
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -458,7 +615,6 @@ void vtkMultiCorrelativeStatistics::Learn(
   // This uses the on-line algorithms for computing centered
   // moments and covariances from Philippe's SAND2008-6212 report.
   double* x;
-  std::vector<double> v(m, 0.); // Values (v) for one observation
 
   // Storage pattern in primary statistics column:
   //  Row 0: cardinality of sample
@@ -525,38 +681,32 @@ void vtkMultiCorrelativeStatistics::Learn(
   }
   else
   {
-    vtkIdType counter = 0;
-    // Iterate over rows
-    for (i = 0; i < nRow; ++i)
+    // Collect the column pairs in the order in which they appear in col3,
+    // i.e. the order in which their names were inserted above.
+    std::vector<std::pair<vtkIdType, vtkIdType>> pairs;
+    pairs.reserve(colPairs.size());
+    for (cpIt = colPairs.begin(); cpIt != colPairs.end(); ++cpIt)
     {
-      if (ghosts && (ghosts->GetValue(i) & this->GhostsToSkip))
-      {
-        continue;
-      }
+      pairs.push_back(cpIt->first);
+    }
 
-      // First fetch column values
-      for (vtkIdType j = 0; j < m; ++j)
-      {
-        v[j] = colPtrs[j]->GetTuple(i)[0];
-      }
-      // Update column products. Equation 3.12 from the SAND report.
-      x = rv + m;
-      for (cpIt = colPairs.begin(); cpIt != colPairs.end(); ++cpIt, ++x)
-      {
-        // cpIt->first is a pair of indices into colPtrs used to specify (u,v) or (s,t)
-        // cpIt->first.first is the index of u or s
-        // cpIt->first.second is the index of v or t
-        *x += (v[cpIt->first.first] - rv[cpIt->first.first]) * // \delta_{u,2,1} = s - \mu_{u,1}
-          (v[cpIt->first.second] - rv[cpIt->first.second]) *   // \delta_{v,2,1} = t - \mu_{v,1}
-          counter / (counter + 1.); // \frac{n_1 n_2}{n_1 + n_2} = \frac{n_1}{n_1 + 1}
-      }
-      // Update running column averages. Equation 1.1 from the SAND report.
+    // Accumulate per-thread partial moments over row ranges through raw
+    // array access, then merge them pairwise; this matches the serial
+    // on-line updates but uses all cores and avoids per-value virtual Gets.
+    MomentsFunctor functor(colPtrs, pairs, ghosts, this->GhostsToSkip);
+    vtkSMPTools::For(0, nRow, functor);
+
+    if (functor.Global.N > 0)
+    {
       x = rv;
       for (vtkIdType j = 0; j < m; ++j, ++x)
       {
-        *x += (v[j] - *x) / (counter + 1);
+        *x = functor.Global.Mu[j];
+      }
+      for (vtkIdType l = 0; l < static_cast<vtkIdType>(pairs.size()); ++l, ++x)
+      {
+        *x = functor.Global.Cov[l];
       }
-      ++counter;
     }
   }
 
@@ -12,6 +12,8 @@
 #include <QtGui/QOpenGLContext>
 #include <QtGui/QScreen>
 
+#include <QtCore/QAtomicInt>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QEvent>
 #include <QtCore/QPointer>
 #include <QtCore/QQueue>
@@ -77,6 +79,9 @@ public:
   QVTKInteractorAdapter qt2vtkInteractorAdapter;
   bool scheduleRender = false;
 
+  // written from the gui thread, read from the render thread.
+  QAtomicInt renderFrameBudget{ 0 };
+
   mutable QSGVtkObjectNode* node = nullptr;
 
 private:
@@ -199,9 +204,32 @@ public:
 
 public Q_SLOTS: // NOLINT(readability-redundant-access-specifiers)
   void render()
+  {
+    // Frame pacing: when the previous VTK render overran the item's budget, skip whole
+    // scenegraph frames -- presenting the last completed framebuffer texture instead -- until as
+    // much time has passed as that render took. The render thread is never blocked waiting for
+    // VTK; a slow pipeline only lowers this item's own frame rate.
+    const int budget = m_item ? m_item->renderFrameBudget() : 0;
+    if (m_renderPending && budget > 0 && m_lastRenderDuration > budget &&
+      m_sinceLastRender.isValid() && m_sinceLastRender.elapsed() < m_lastRenderDuration)
+    {
+      if (m_window)
+        m_window->update();
+      return;
+    }
+
+    this->renderNow();
+  }
+
+public: // NOLINT(readability-redundant-access-specifiers)
+  // Renders right away, bypassing frame pacing; used on size changes where the scenegraph needs
+  // a framebuffer of the new size for this very frame.
+  void renderNow()
   {
     if (m_renderPending)
     {
+      QElapsedTimer renderTimer;
+      renderTimer.start();
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
       const bool needsWrap = m_window &&
         QSGRendererInterface::isApiRhiBased(m_window->rendererInterface()->graphicsApi());
@@ -227,11 +255,14 @@ public Q_SLOTS: // NOLINT(readability-redundant-access-specifiers)
 #endif
 
       m_renderPending = false;
+      m_lastRenderDuration = renderTimer.elapsed();
+      m_sinceLastRender.start();
       markDirty(QSGNode::DirtyMaterial);
       Q_EMIT textureChanged();
     }
   }
 
+public Q_SLOTS: // NOLINT(readability-redundant-access-specifiers)
   void handleScreenChange(QScreen*)
   {
     if (!m_window || !m_item)
@@ -248,6 +279,8 @@ private:
   vtkSmartPointer<vtkGenericOpenGLRenderWindow> vtkWindow;
   vtkSmartPointer<vtkObject> vtkUserData;
   bool m_renderPending = false;
+  qint64 m_lastRenderDuration = 0;
+  QElapsedTimer m_sinceLastRender;
 
 protected:
   // variables set in QQuickVTKItem::updatePaintNode()
@@ -317,7 +350,7 @@ QSGNode* QQuickVTKItem::updatePaintNode(QSGNode* node, UpdatePaintNodeData*)
   if (dirtySize)
   {
     n->scheduleRender();
-    n->render();
+    n->renderNow();
     auto fb = n->vtkWindow->GetDisplayFramebuffer();
     if (fb && fb->GetNumberOfColorAttachments() > 0)
     {
@@ -363,6 +396,21 @@ void QQuickVTKItem::scheduleRender()
   update();
 }
 
+int QQuickVTKItem::renderFrameBudget() const
+{
+  Q_D(const QQuickVTKItem);
+
+  return d->renderFrameBudget.loadAcquire();
+}
+
+void QQuickVTKItem::setRenderFrameBudget(int milliseconds)
+{
+  Q_D(QQuickVTKItem);
+
+  if (d->renderFrameBudget.fetchAndStoreOrdered(milliseconds) != milliseconds)
+    Q_EMIT renderFrameBudgetChanged();
+}
+
 bool QQuickVTKItem::isTextureProvider() const
 {
   return true;
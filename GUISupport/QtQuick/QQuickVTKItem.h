@@ -27,6 +27,9 @@ class VTKGUISUPPORTQTQUICK_EXPORT QQuickVTKItem : public QQuickItem
 {
   Q_OBJECT
 
+  Q_PROPERTY(int renderFrameBudget READ renderFrameBudget WRITE setRenderFrameBudget NOTIFY
+      renderFrameBudgetChanged)
+
 public:
   explicit QQuickVTKItem(QQuickItem* parent = nullptr);
   ~QQuickVTKItem() override;
@@ -133,6 +136,29 @@ public:
    */
   void scheduleRender();
 
+  ///@{
+  /**
+   * Time budget, in milliseconds, that a VTK render may consume on the QML render thread before
+   * frame pacing kicks in. 0 (the default) disables pacing and renders VTK on every scheduled
+   * scenegraph frame.
+   *
+   * When a VTK render overruns the budget, subsequently scheduled renders are skipped -- the item
+   * keeps presenting the last completed framebuffer texture so QML animations stay fluid -- until
+   * as much time has passed as the late render took. The render thread is never blocked waiting
+   * for VTK; a slow pipeline only lowers this item's own frame rate.
+   *
+   * \note A typical value is the target frame interval, e.g. 16 for a 60Hz display.
+   *
+   * \note Renders forced by a size change still run immediately, since the scenegraph needs a
+   * framebuffer of the new size for that frame.
+   */
+  int renderFrameBudget() const;
+  void setRenderFrameBudget(int milliseconds);
+  ///@}
+
+Q_SIGNALS:
+  void renderFrameBudgetChanged();
+
 protected:
   bool event(QEvent*) override;
 
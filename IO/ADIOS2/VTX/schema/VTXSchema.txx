@@ -124,16 +124,22 @@ template <class T>
 void VTXSchema::InitDataArray(
   const std::string& name, size_t elements, size_t components, types::DataArray& dataArray)
 {
-  if (dataArray.IsIdType)
+  // the array and its allocation are reused across steps: the deferred
+  // adios2 Gets land directly in this VTK-owned buffer, so a step that
+  // keeps the same shape costs no allocation and no extra copy
+  if (dataArray.Data == nullptr)
   {
-    dataArray.Data = helper::NewDataArrayIdType();
-  }
-  else
-  {
-    dataArray.Data = helper::NewDataArray<T>();
+    if (dataArray.IsIdType)
+    {
+      dataArray.Data = helper::NewDataArrayIdType();
+    }
+    else
+    {
+      dataArray.Data = helper::NewDataArray<T>();
+    }
+    dataArray.Data->Allocate(elements);
   }
 
-  dataArray.Data->Allocate(elements);
   dataArray.Data->SetNumberOfComponents(static_cast<int>(components));
   dataArray.Data->SetNumberOfTuples(elements / components);
   dataArray.Data->SetName(name.c_str());
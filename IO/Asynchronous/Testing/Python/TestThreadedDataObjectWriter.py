@@ -0,0 +1,53 @@
+#!/usr/bin/env python
+import os
+import time
+
+from vtkmodules.vtkIOAsynchronous import vtkThreadedDataObjectWriter
+from vtkmodules.vtkCommonDataModel import vtkMultiBlockDataSet
+from vtkmodules.vtkFiltersSources import vtkSphereSource
+from vtkmodules.vtkImagingCore import vtkRTAnalyticSource
+from vtkmodules.util.misc import vtkGetTempDir
+
+VTK_TEMP_DIR = vtkGetTempDir()
+
+# Generate Data
+imageSource = vtkRTAnalyticSource()
+imageSource.Update()
+image = imageSource.GetOutput()
+
+sphereSource = vtkSphereSource()
+sphereSource.Update()
+
+multiBlock = vtkMultiBlockDataSet()
+multiBlock.SetNumberOfBlocks(2)
+multiBlock.SetBlock(0, image)
+multiBlock.SetBlock(1, sphereSource.GetOutput())
+
+# Initialize writer
+writer = vtkThreadedDataObjectWriter()
+writer.Initialize()
+
+# Queue snapshots of every supported flavor
+wroteFiles = []
+t0 = time.time()
+for i in range(5):
+    for data, ext in [(image, 'vti'), (sphereSource.GetOutput(), 'vtp'), (multiBlock, 'vtm')]:
+        filePath = '%s/%s-snapshot.%s' % (VTK_TEMP_DIR, i, ext)
+        wroteFiles.append(filePath)
+        writer.WriteSnapshot(data, filePath)
+
+t1 = time.time()
+
+# Wait for the work to be done
+writer.Finalize()
+t2 = time.time()
+
+print('Capture time', t1 - t0)
+print('Wait time', t2 - t1)
+print('Total time', t2 - t0)
+
+assert writer.GetBufferedMemorySize() == 0
+
+for filePath in wroteFiles:
+    assert os.path.exists(filePath), 'missing snapshot %s' % filePath
+    print('wrote: %s' % filePath)
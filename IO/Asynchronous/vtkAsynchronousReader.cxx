@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAsynchronousReader.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkCommand.h"
+#include "vtkDataObject.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkThreadedTaskQueue.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+//****************************************************************************
+class vtkAsynchronousReader::vtkInternals
+{
+public:
+  // Single worker thread executing the queued updates in order.
+  std::unique_ptr<vtkThreadedTaskQueue<void>> Queue;
+
+  // Outputs of the most recently completed update, one per port.
+  std::mutex OutputsMutex;
+  std::vector<vtkSmartPointer<vtkDataObject>> Outputs;
+
+  // Number of updates running or waiting to run.
+  std::atomic<int> PendingCount{ 0 };
+};
+
+vtkStandardNewMacro(vtkAsynchronousReader);
+vtkCxxSetObjectMacro(vtkAsynchronousReader, Reader, vtkAlgorithm);
+
+//----------------------------------------------------------------------------
+vtkAsynchronousReader::vtkAsynchronousReader()
+  : Reader(nullptr)
+  , Internals(new vtkInternals())
+{
+  this->Internals->Queue.reset(new vtkThreadedTaskQueue<void>(
+    [this]() { this->ExecuteUpdate(); }, /*strict_ordering=*/true, /*buffer_size=*/-1,
+    /*max_concurrent_tasks=*/1));
+}
+
+//----------------------------------------------------------------------------
+vtkAsynchronousReader::~vtkAsynchronousReader()
+{
+  this->Wait();
+  this->SetReader(nullptr);
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+void vtkAsynchronousReader::UpdateAsynchronously()
+{
+  ++this->Internals->PendingCount;
+  this->Internals->Queue->Push();
+}
+
+//----------------------------------------------------------------------------
+bool vtkAsynchronousReader::IsUpdating()
+{
+  return this->Internals->PendingCount > 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkAsynchronousReader::Wait()
+{
+  this->Internals->Queue->Flush();
+}
+
+//----------------------------------------------------------------------------
+vtkDataObject* vtkAsynchronousReader::GetOutput(int port)
+{
+  std::lock_guard<std::mutex> lock(this->Internals->OutputsMutex);
+  if (port < 0 || static_cast<size_t>(port) >= this->Internals->Outputs.size())
+  {
+    return nullptr;
+  }
+  return this->Internals->Outputs[port];
+}
+
+//----------------------------------------------------------------------------
+void vtkAsynchronousReader::ExecuteUpdate()
+{
+  if (!this->Reader)
+  {
+    --this->Internals->PendingCount;
+    return;
+  }
+
+  this->Reader->Update();
+
+  // Publish fresh shallow copies of the outputs so objects handed out by
+  // earlier calls to GetOutput() are left untouched.
+  {
+    std::lock_guard<std::mutex> lock(this->Internals->OutputsMutex);
+    int numberOfPorts = this->Reader->GetNumberOfOutputPorts();
+    this->Internals->Outputs.resize(numberOfPorts);
+    for (int port = 0; port < numberOfPorts; ++port)
+    {
+      vtkDataObject* output = this->Reader->GetOutputDataObject(port);
+      if (output)
+      {
+        auto copy = vtk::TakeSmartPointer(output->NewInstance());
+        copy->ShallowCopy(output);
+        this->Internals->Outputs[port] = copy;
+      }
+      else
+      {
+        this->Internals->Outputs[port] = nullptr;
+      }
+    }
+  }
+
+  --this->Internals->PendingCount;
+
+  // Announce completion. This runs on the background thread; observers
+  // normally hand the notification over to the application's event loop.
+  this->InvokeEvent(vtkCommand::UpdateDataEvent);
+}
+
+//----------------------------------------------------------------------------
+void vtkAsynchronousReader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Reader: " << this->Reader << "\n";
+  os << indent << "IsUpdating: " << (this->IsUpdating() ? "true" : "false") << "\n";
+}
+VTK_ABI_NAMESPACE_END
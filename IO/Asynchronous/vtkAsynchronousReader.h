@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkAsynchronousReader
+ * @brief   runs a reader's pipeline update on a background thread
+ *
+ * vtkAsynchronousReader wraps any vtkAlgorithm-derived reader and executes
+ * its Update() on a background thread so the calling thread -- typically
+ * an application's interface thread -- stays responsive while a file
+ * loads. The outputs are double buffered: GetOutput() returns a stable
+ * data object produced by the most recently completed update, and the
+ * next update produces a fresh object that replaces it only when the
+ * update finishes. Completion is announced by invoking
+ * vtkCommand::UpdateDataEvent on this object; note that the event fires
+ * on the background thread, so an observer usually just schedules work
+ * back onto the application's own event loop.
+ *
+ * The wrapped reader and everything upstream of it belong to the
+ * background thread while an update is in flight: do not call into the
+ * reader until IsUpdating() returns false or Wait() returns.
+ *
+ * @sa
+ * vtkThreadedImageWriter
+ */
+
+#ifndef vtkAsynchronousReader_h
+#define vtkAsynchronousReader_h
+
+#include "vtkIOAsynchronousModule.h" // For export macro
+#include "vtkObject.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkDataObject;
+
+class VTKIOASYNCHRONOUS_EXPORT vtkAsynchronousReader : public vtkObject
+{
+public:
+  static vtkAsynchronousReader* New();
+  vtkTypeMacro(vtkAsynchronousReader, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the reader whose pipeline is updated in the background. Any
+   * vtkAlgorithm works; the reader keeps its usual synchronous behavior
+   * when used directly.
+   */
+  virtual void SetReader(vtkAlgorithm*);
+  vtkGetObjectMacro(Reader, vtkAlgorithm);
+  ///@}
+
+  /**
+   * Request an update of the reader on the background thread and return
+   * immediately. Requests are executed one at a time in order. When an
+   * update completes, its outputs replace the ones returned by
+   * GetOutput() and vtkCommand::UpdateDataEvent is invoked from the
+   * background thread.
+   */
+  void UpdateAsynchronously();
+
+  /**
+   * Returns true while an update is running or waiting to run.
+   */
+  bool IsUpdating();
+
+  /**
+   * Block until every requested update has completed.
+   */
+  void Wait();
+
+  /**
+   * Returns the output of the given port produced by the most recently
+   * completed update, or nullptr when no update has completed yet. The
+   * returned object is not modified by later updates; callers that keep
+   * it beyond the next completion should hold their own reference.
+   */
+  vtkDataObject* GetOutput(int port = 0);
+
+protected:
+  vtkAsynchronousReader();
+  ~vtkAsynchronousReader() override;
+
+  vtkAlgorithm* Reader;
+
+private:
+  vtkAsynchronousReader(const vtkAsynchronousReader&) = delete;
+  void operator=(const vtkAsynchronousReader&) = delete;
+
+  /**
+   * Runs on the background thread: updates the reader, publishes shallow
+   * copies of its outputs, and invokes the completion event.
+   */
+  void ExecuteUpdate();
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
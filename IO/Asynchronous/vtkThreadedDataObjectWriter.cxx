@@ -0,0 +1,245 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkThreadedDataObjectWriter.h"
+
+#include "vtkCompositeDataIterator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataSet.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkThreadedTaskQueue.h"
+#include "vtkUniformGridAMR.h"
+#include "vtkXMLDataSetWriter.h"
+#include "vtkXMLHyperTreeGridWriter.h"
+#include "vtkXMLMultiBlockDataWriter.h"
+#include "vtkXMLUniformGridAMRWriter.h"
+#include "vtkXMLWriterBase.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#define MAX_NUMBER_OF_THREADS_IN_POOL 32
+//****************************************************************************
+namespace
+{
+vtkSmartPointer<vtkXMLWriterBase> CreateWriter(vtkDataObject* data)
+{
+  if (vtkMultiBlockDataSet::SafeDownCast(data))
+  {
+    return vtkSmartPointer<vtkXMLMultiBlockDataWriter>::New();
+  }
+  if (vtkUniformGridAMR::SafeDownCast(data))
+  {
+    return vtkSmartPointer<vtkXMLUniformGridAMRWriter>::New();
+  }
+  if (vtkHyperTreeGrid::SafeDownCast(data))
+  {
+    return vtkSmartPointer<vtkXMLHyperTreeGridWriter>::New();
+  }
+  if (vtkDataSet::SafeDownCast(data))
+  {
+    return vtkSmartPointer<vtkXMLDataSetWriter>::New();
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------
+// Duplicate the structure of the data object while sharing its data arrays
+// by reference, recursing into composite datasets so their leaves are
+// snapshotted too instead of shared as instances.
+vtkSmartPointer<vtkDataObject> TakeSnapshot(vtkDataObject* data)
+{
+  vtkSmartPointer<vtkDataObject> snapshot;
+  snapshot.TakeReference(data->NewInstance());
+  auto* composite = vtkCompositeDataSet::SafeDownCast(data);
+  if (!composite)
+  {
+    snapshot->ShallowCopy(data);
+    return snapshot;
+  }
+
+  auto* compositeSnapshot = vtkCompositeDataSet::SafeDownCast(snapshot);
+  compositeSnapshot->CopyStructure(composite);
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(composite->NewIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    if (vtkDataObject* leaf = iter->GetCurrentDataObject())
+    {
+      compositeSnapshot->SetDataSet(iter, ::TakeSnapshot(leaf));
+    }
+  }
+  return snapshot;
+}
+
+//----------------------------------------------------------------------------
+void WriteSnapshotFile(const vtkSmartPointer<vtkDataObject>& data, const std::string& fileName)
+{
+  vtkLogF(TRACE, "writing snapshot: %s", fileName.c_str());
+
+  auto writer = ::CreateWriter(data);
+  if (!writer)
+  {
+    vtkLogF(ERROR, "No XML writer available for %s, dropping snapshot %s", data->GetClassName(),
+      fileName.c_str());
+    return;
+  }
+  writer->SetFileName(fileName.c_str());
+  writer->SetInputDataObject(data);
+  if (!writer->Write())
+  {
+    vtkLogF(ERROR, "Failed to write snapshot %s", fileName.c_str());
+  }
+}
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//****************************************************************************
+class vtkThreadedDataObjectWriter::vtkInternals
+{
+private:
+  using TaskQueueType =
+    vtkThreadedTaskQueue<void, vtkSmartPointer<vtkDataObject>, std::string, vtkIdType>;
+  std::unique_ptr<TaskQueueType> Queue;
+
+  std::mutex Mutex;
+  std::condition_variable MemoryReleased;
+  vtkIdType BufferedMemorySize = 0;
+
+public:
+  vtkInternals()
+    : Queue(nullptr)
+  {
+  }
+
+  ~vtkInternals() { this->TerminateAllWorkers(); }
+
+  void TerminateAllWorkers()
+  {
+    if (this->Queue)
+    {
+      this->Queue->Flush();
+    }
+    this->Queue.reset(nullptr);
+  }
+
+  void SpawnWorkers(vtkTypeUInt32 numberOfThreads)
+  {
+    this->Queue.reset(new TaskQueueType(
+      [this](vtkSmartPointer<vtkDataObject> data, std::string fileName, vtkIdType memorySize) {
+        ::WriteSnapshotFile(data, fileName);
+        data = nullptr; // release the snapshot before accounting for it
+        std::lock_guard<std::mutex> lock(this->Mutex);
+        this->BufferedMemorySize -= memorySize;
+        this->MemoryReleased.notify_all();
+      },
+      /*strict_ordering=*/true,
+      /*buffer_size=*/-1,
+      /*max_concurrent_tasks=*/static_cast<int>(numberOfThreads)));
+  }
+
+  bool HasWorkers() { return this->Queue != nullptr; }
+
+  void PushSnapshotToQueue(
+    vtkSmartPointer<vtkDataObject>&& data, std::string&& fileName, vtkIdType maximumMemorySize)
+  {
+    const vtkIdType memorySize = static_cast<vtkIdType>(data->GetActualMemorySize());
+    {
+      std::unique_lock<std::mutex> lock(this->Mutex);
+      // Always admit a snapshot into an empty queue so captures larger than
+      // the bound still make progress.
+      this->MemoryReleased.wait(lock, [this, memorySize, maximumMemorySize] {
+        return maximumMemorySize <= 0 || this->BufferedMemorySize == 0 ||
+          this->BufferedMemorySize + memorySize <= maximumMemorySize;
+      });
+      this->BufferedMemorySize += memorySize;
+    }
+    this->Queue->Push(std::move(data), std::move(fileName), memorySize);
+  }
+
+  vtkIdType GetBufferedMemorySize()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    return this->BufferedMemorySize;
+  }
+};
+
+vtkStandardNewMacro(vtkThreadedDataObjectWriter);
+//------------------------------------------------------------------------------
+vtkThreadedDataObjectWriter::vtkThreadedDataObjectWriter()
+  : Internals(new vtkInternals())
+{
+  this->MaxThreads = 1;
+  this->MaximumBufferedMemorySize = 4194304;
+}
+
+//------------------------------------------------------------------------------
+vtkThreadedDataObjectWriter::~vtkThreadedDataObjectWriter()
+{
+  delete this->Internals;
+  this->Internals = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::SetMaxThreads(vtkTypeUInt32 maxThreads)
+{
+  if (maxThreads < MAX_NUMBER_OF_THREADS_IN_POOL && maxThreads > 0)
+  {
+    this->MaxThreads = maxThreads;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::Initialize()
+{
+  // Stop any started thread first
+  this->Internals->TerminateAllWorkers();
+
+  // Register new worker threads
+  this->Internals->SpawnWorkers(this->MaxThreads);
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::WriteSnapshot(vtkDataObject* data, const char* fileName)
+{
+  // Error checking
+  if (data == nullptr || fileName == nullptr)
+  {
+    vtkErrorMacro(<< "WriteSnapshot: Please specify an input and a file name!");
+    return;
+  }
+  if (!this->Internals->HasWorkers())
+  {
+    vtkErrorMacro(<< "WriteSnapshot: Initialize() must be called first!");
+    return;
+  }
+
+  this->Internals->PushSnapshotToQueue(
+    ::TakeSnapshot(data), std::string(fileName), this->MaximumBufferedMemorySize);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkThreadedDataObjectWriter::GetBufferedMemorySize()
+{
+  return this->Internals->GetBufferedMemorySize();
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaxThreads: " << this->MaxThreads << endl;
+  os << indent << "MaximumBufferedMemorySize: " << this->MaximumBufferedMemorySize << endl;
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedDataObjectWriter::Finalize()
+{
+  this->Internals->TerminateAllWorkers();
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class    vtkThreadedDataObjectWriter
+ * @brief    class used to snapshot data objects to XML files from a
+ *           background thread to prevent blocking the caller.
+ *
+ * @details  This writer captures a snapshot of a vtkDataObject and hands it
+ *           to a background thread that serializes it with the matching XML
+ *           writer (vti, vtr, vts, vtp, vtu, vtm, vthb, htg depending on the
+ *           data object type). The snapshot is a shallow copy: the structure
+ *           is duplicated (recursively for composite datasets) while the data
+ *           arrays are shared by reference, so capture is cheap and the
+ *           caller's pipeline can replace arrays afterwards without
+ *           disturbing the queued write. Modifying shared arrays in place
+ *           after the capture is not safe, as with vtkThreadedImageWriter.
+ *
+ *           The memory held by queued snapshots is bounded: once
+ *           MaximumBufferedMemorySize is reached, WriteSnapshot blocks until
+ *           enough queued writes complete. This keeps checkpointing of large
+ *           time series from accumulating an unbounded backlog.
+ */
+
+#ifndef vtkThreadedDataObjectWriter_h
+#define vtkThreadedDataObjectWriter_h
+
+#include "vtkIOAsynchronousModule.h" // For export macro
+#include "vtkObject.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataObject;
+
+class VTKIOASYNCHRONOUS_EXPORT vtkThreadedDataObjectWriter : public vtkObject
+{
+public:
+  static vtkThreadedDataObjectWriter* New();
+  vtkTypeMacro(vtkThreadedDataObjectWriter, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Need to be called at least once before using the class.
+   * Then it should be called again after any change on the
+   * thread count or if Finalize() was called.
+   *
+   * This method will wait for any running thread to terminate and start
+   * a new pool with the given number of threads.
+   */
+  void Initialize();
+
+  /**
+   * Capture a snapshot of the given data object and queue it for writing to
+   * the given file. The file name extension selects nothing; the writer is
+   * chosen from the data object type, so the extension should be the chosen
+   * writer's default one. Returns once the snapshot is queued, blocking only
+   * when the queued snapshots exceed MaximumBufferedMemorySize. It is not
+   * safe to modify the data object's arrays in place after this point;
+   * replacing them, as pipeline re-executions do, is fine.
+   */
+  void WriteSnapshot(vtkDataObject* data, VTK_FILEPATH const char* fileName);
+
+  /**
+   * Define the number of worker thread to use.
+   * Initialize() need to be called after any thread count change.
+   */
+  void SetMaxThreads(vtkTypeUInt32);
+  vtkGetMacro(MaxThreads, vtkTypeUInt32);
+
+  ///@{
+  /**
+   * Set/Get the maximum amount of memory queued snapshots may hold, in
+   * kibibytes as reported by vtkDataObject::GetActualMemorySize(). When a new
+   * snapshot would exceed the bound, WriteSnapshot blocks until enough queued
+   * writes have completed; a single snapshot larger than the bound is still
+   * admitted once the queue is empty. 0 means unbounded.
+   * The default is 4194304 (4 GiB).
+   */
+  vtkSetMacro(MaximumBufferedMemorySize, vtkIdType);
+  vtkGetMacro(MaximumBufferedMemorySize, vtkIdType);
+  ///@}
+
+  /**
+   * Return the memory currently held by queued snapshots, in kibibytes.
+   */
+  vtkIdType GetBufferedMemorySize();
+
+  /**
+   * This method will wait for any running thread to terminate.
+   */
+  void Finalize();
+
+protected:
+  vtkThreadedDataObjectWriter();
+  ~vtkThreadedDataObjectWriter() override;
+
+private:
+  vtkThreadedDataObjectWriter(const vtkThreadedDataObjectWriter&) = delete;
+  void operator=(const vtkThreadedDataObjectWriter&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+  vtkTypeUInt32 MaxThreads;
+  vtkIdType MaximumBufferedMemorySize;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
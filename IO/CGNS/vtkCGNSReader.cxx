@@ -2640,12 +2640,19 @@ int vtkCGNSReader::GetUnstructuredZone(
             vtkErrorMacro(<< "Invalid number of points per cell: " << numPointsPerCell);
           }
 
-          // Fill offsets array from number of points per cell
-          for (vtkIdType idx = 0; idx < elementSize; idx++)
-          {
-            offsets->SetValue(offsetsIdx, offsets->GetValue(offsetsIdx - 1) + numPointsPerCell);
-            offsetsIdx++;
-          }
+          // Fill offsets array from number of points per cell. All cells of
+          // the section have the same size, so the offsets follow in closed
+          // form and can be computed on all threads.
+          const vtkIdType sectionOffsetsStart = offsetsIdx;
+          const vtkIdType firstOffset = offsets->GetValue(offsetsIdx - 1);
+          vtkSMPTools::For(0, elementSize, [&](vtkIdType begin, vtkIdType endIdx) {
+            for (vtkIdType idx = begin; idx < endIdx; idx++)
+            {
+              offsets->SetValue(
+                sectionOffsetsStart + idx, firstOffset + (idx + 1) * numPointsPerCell);
+            }
+          });
+          offsetsIdx += elementSize;
 
           bool higherOrderWarning = false;
           bool reOrderElements = false;
@@ -2694,10 +2701,12 @@ int vtkCGNSReader::GetUnstructuredZone(
             srcStride, memStart, memEnd, memStride, memDim, localConnectivity);
 
           // Add -1 on indices due to indexing from 1
-          for (vtkIdType icell = 0; icell < elementSize * npe; ++icell)
-          {
-            localConnectivity[icell] = localConnectivity[icell] - 1;
-          }
+          vtkSMPTools::For(0, elementSize * npe, [&](vtkIdType begin, vtkIdType endIdx) {
+            for (vtkIdType icell = begin; icell < endIdx; ++icell)
+            {
+              localConnectivity[icell] = localConnectivity[icell] - 1;
+            }
+          });
 
           if (reOrderElements)
           {
@@ -2885,10 +2894,12 @@ int vtkCGNSReader::GetUnstructuredZone(
         if (startArraySec[sec] != 0)
         {
           // Add offset since it is not the first section
-          for (vtkIdType idx = 0; idx < offsetDataSize; idx++)
-          {
-            localFaceElementsIdx[idx] += startArraySec[sec];
-          }
+          vtkSMPTools::For(0, offsetDataSize, [&](vtkIdType begin, vtkIdType endIdx) {
+            for (vtkIdType idx = begin; idx < endIdx; idx++)
+            {
+              localFaceElementsIdx[idx] += startArraySec[sec];
+            }
+          });
         }
 
         srcStart[0] = 1;
@@ -3011,10 +3022,12 @@ int vtkCGNSReader::GetUnstructuredZone(
           if (startNFaceArraySec[sec] != 0)
           {
             // Add offset since it is not the first section
-            for (vtkIdType idx = 0; idx < offsetDataSize; idx++)
-            {
-              localCellElementsIdx[idx] += startNFaceArraySec[sec];
-            }
+            vtkSMPTools::For(0, offsetDataSize, [&](vtkIdType begin, vtkIdType endIdx) {
+              for (vtkIdType idx = begin; idx < endIdx; idx++)
+              {
+                localCellElementsIdx[idx] += startNFaceArraySec[sec];
+              }
+            });
           }
 
           srcStart[0] = 1;
@@ -14,6 +14,9 @@
 #include "vtkOverlappingAMR.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <catalyst_conduit.hpp>
@@ -22,9 +25,109 @@
 #include <cassert>
 #include <functional>
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 
+namespace
+{
+//----------------------------------------------------------------------------
+// Identity of the memory backing a blueprint mesh: the buffer pointer and
+// element count of every leaf under "coordsets" and "topologies", plus the
+// mesh and field names. The points and connectivity of the generated VTK
+// datasets are zero-copy views of those buffers, so while the signature is
+// unchanged between invocations the cached structure stays valid and only the
+// field arrays need to be refreshed.
+struct MeshStructureSignature
+{
+  std::vector<std::pair<const void*, conduit_index_t>> Buffers;
+  std::string Names;
+
+  bool Matches(const MeshStructureSignature& other) const
+  {
+    return !this->Buffers.empty() && this->Buffers == other.Buffers &&
+      this->Names == other.Names;
+  }
+};
+
+//----------------------------------------------------------------------------
+void AppendLeafSignature(const conduit_cpp::Node& node, MeshStructureSignature& signature)
+{
+  const conduit_index_t nchildren = node.number_of_children();
+  if (nchildren == 0)
+  {
+    const conduit_index_t nelements = node.dtype().number_of_elements();
+    signature.Buffers.emplace_back(
+      nelements > 0 ? const_cast<conduit_cpp::Node&>(node).element_ptr(0) : nullptr, nelements);
+    return;
+  }
+  for (conduit_index_t cc = 0; cc < nchildren; ++cc)
+  {
+    AppendLeafSignature(node.child(cc), signature);
+  }
+}
+
+//----------------------------------------------------------------------------
+void AppendMeshSignature(const conduit_cpp::Node& meshNode, MeshStructureSignature& signature)
+{
+  signature.Names += meshNode.name();
+  signature.Names += '\n';
+  for (const auto& section : { "coordsets", "topologies" })
+  {
+    if (meshNode.has_path(section))
+    {
+      AppendLeafSignature(meshNode[section], signature);
+    }
+    else
+    {
+      // record a hole so incomplete meshes never match complete ones.
+      signature.Buffers.emplace_back(nullptr, -1);
+    }
+  }
+  // field names (and associations) catch fields being added, removed or
+  // re-associated while the geometry buffers stay put.
+  if (meshNode.has_path("fields"))
+  {
+    auto fields = meshNode["fields"];
+    for (conduit_index_t cc = 0; cc < fields.number_of_children(); ++cc)
+    {
+      auto field = fields.child(cc);
+      signature.Names += field.name();
+      if (field.has_path("association"))
+      {
+        signature.Names += '|';
+        signature.Names += field["association"].as_string();
+      }
+      signature.Names += '\n';
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// The simulation may have updated coordinate or field values in place even
+// though the buffer pointers are unchanged; invalidate cached bounds and bump
+// the modification times so downstream filters re-execute.
+void MarkPartitionsModified(vtkPartitionedDataSet* pds)
+{
+  for (unsigned int cc = 0, numPartitions = pds->GetNumberOfPartitions(); cc < numPartitions; ++cc)
+  {
+    if (auto ds = pds->GetPartition(cc))
+    {
+      if (auto ps = vtkPointSet::SafeDownCast(ds))
+      {
+        if (ps->GetPoints())
+        {
+          ps->GetPoints()->Modified();
+        }
+      }
+      ds->Modified();
+    }
+  }
+}
+} // anonymous namespace
+
 class vtkConduitSource::vtkInternals
 {
 public:
@@ -33,6 +136,12 @@ public:
   conduit_cpp::Node AssemblyNode;
   bool GlobalFieldsNodeValid{ false };
   bool AssemblyNodeValid{ false };
+
+  // output generated on the previous execution together with the structure
+  // signature it was built from; reused with refreshed field arrays while the
+  // signature is unchanged.
+  vtkSmartPointer<vtkDataObject> CachedOutput;
+  MeshStructureSignature CachedSignature;
 };
 
 vtkStandardNewMacro(vtkConduitSource);
@@ -114,14 +223,36 @@ bool vtkConduitSource::GenerateAMR(vtkDataObject* output)
 //----------------------------------------------------------------------------
 bool vtkConduitSource::GeneratePartitionedDataSet(vtkDataObject* output)
 {
+  auto& internals = (*this->Internals);
+
+  MeshStructureSignature signature;
+  AppendMeshSignature(internals.Node, signature);
+
+  // when the coordinate and connectivity buffers are unchanged since the
+  // previous invocation, reuse the cached structure and only refresh the
+  // field arrays.
+  if (auto cached = vtkPartitionedDataSet::SafeDownCast(internals.CachedOutput))
+  {
+    if (signature.Matches(internals.CachedSignature) &&
+      vtkConduitToDataObject::FillPartitionedDataSetFields(cached, internals.Node))
+    {
+      MarkPartitionsModified(cached);
+      output->ShallowCopy(cached);
+      return true;
+    }
+  }
+
   vtkNew<vtkPartitionedDataSet> pd_output;
-  if (!vtkConduitToDataObject::FillPartionedDataSet(pd_output, this->Internals->Node))
+  if (!vtkConduitToDataObject::FillPartionedDataSet(pd_output, internals.Node))
   {
-    vtkLogF(ERROR, "Failed reading mesh from '%s'", this->Internals->Node.name().c_str());
+    vtkLogF(ERROR, "Failed reading mesh from '%s'", internals.Node.name().c_str());
+    internals.CachedOutput = nullptr;
     output->Initialize();
     return false;
   }
 
+  internals.CachedOutput = pd_output;
+  internals.CachedSignature = std::move(signature);
   output->ShallowCopy(pd_output);
   return true;
 }
@@ -129,9 +260,53 @@ bool vtkConduitSource::GeneratePartitionedDataSet(vtkDataObject* output)
 //----------------------------------------------------------------------------
 bool vtkConduitSource::GeneratePartitionedDataSetCollection(vtkDataObject* output)
 {
-  vtkNew<vtkPartitionedDataSetCollection> pdc_output;
-  const auto& pdc_node = this->Internals->Node;
+  auto& internals = (*this->Internals);
+  const auto& pdc_node = internals.Node;
   const auto count = pdc_node.number_of_children();
+
+  MeshStructureSignature signature;
+  for (conduit_index_t cc = 0; cc < count; ++cc)
+  {
+    AppendMeshSignature(pdc_node.child(cc), signature);
+  }
+  if (internals.AssemblyNodeValid)
+  {
+    AppendLeafSignature(internals.AssemblyNode, signature);
+  }
+
+  // when the coordinate and connectivity buffers of every mesh are unchanged
+  // since the previous invocation, reuse the cached collection (including its
+  // assembly) and only refresh the field arrays.
+  if (auto cached = vtkPartitionedDataSetCollection::SafeDownCast(internals.CachedOutput))
+  {
+    bool refreshed = signature.Matches(internals.CachedSignature) &&
+      cached->GetNumberOfPartitionedDataSets() == static_cast<unsigned int>(count);
+    for (conduit_index_t cc = 0; refreshed && cc < count; ++cc)
+    {
+      const auto& child = pdc_node.child(cc);
+      auto pd = cached->GetPartitionedDataSet(static_cast<unsigned int>(cc));
+      refreshed = pd != nullptr && vtkConduitToDataObject::FillPartitionedDataSetFields(pd, child);
+      if (refreshed && child.has_path("state/fields"))
+      {
+        vtkConduitToDataObject::AddFieldData(pd, child["state/fields"]);
+      }
+      if (refreshed && child.has_path("fields"))
+      {
+        vtkConduitToDataObject::AddFieldData(pd, child["fields"]);
+      }
+      if (refreshed)
+      {
+        MarkPartitionsModified(pd);
+      }
+    }
+    if (refreshed)
+    {
+      output->ShallowCopy(cached);
+      return true;
+    }
+  }
+
+  vtkNew<vtkPartitionedDataSetCollection> pdc_output;
   pdc_output->SetNumberOfPartitionedDataSets(static_cast<unsigned int>(count));
 
   std::map<std::string, unsigned int> name_map;
@@ -143,6 +318,7 @@ bool vtkConduitSource::GeneratePartitionedDataSetCollection(vtkDataObject* outpu
     if (!vtkConduitToDataObject::FillPartionedDataSet(pd, child))
     {
       vtkLogF(ERROR, "Failed reading mesh '%s'", child.name().c_str());
+      internals.CachedOutput = nullptr;
       output->Initialize();
       return false;
     }
@@ -211,6 +387,8 @@ bool vtkConduitSource::GeneratePartitionedDataSetCollection(vtkDataObject* outpu
     pdc_output->SetDataAssembly(assembly);
   }
 
+  internals.CachedOutput = pdc_output;
+  internals.CachedSignature = std::move(signature);
   output->ShallowCopy(pdc_output);
 
   return true;
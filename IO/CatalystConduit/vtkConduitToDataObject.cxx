@@ -43,8 +43,6 @@ bool FillPartionedDataSet(vtkPartitionedDataSet* output, const conduit_cpp::Node
     return false;
   }
 
-  std::map<std::string, vtkSmartPointer<vtkDataSet>> datasets;
-
   // process "topologies".
   auto topologies = node["topologies"];
 
@@ -59,7 +57,6 @@ bool FillPartionedDataSet(vtkPartitionedDataSet* output, const conduit_cpp::Node
         auto idx = output->GetNumberOfPartitions();
         output->SetPartition(idx, ds);
         output->GetMetaData(idx)->Set(vtkCompositeDataSet::NAME(), child.name().c_str());
-        datasets[child.name()] = ds;
       }
     }
     catch (std::exception& e)
@@ -70,6 +67,25 @@ bool FillPartionedDataSet(vtkPartitionedDataSet* output, const conduit_cpp::Node
     }
   }
 
+  return FillPartitionedDataSetFields(output, node);
+}
+
+//----------------------------------------------------------------------------
+bool FillPartitionedDataSetFields(vtkPartitionedDataSet* output, const conduit_cpp::Node& node)
+{
+  // match the partitions created by FillPartionedDataSet back to their
+  // topologies through the NAME metadata set at creation time.
+  std::map<std::string, vtkSmartPointer<vtkDataSet>> datasets;
+  for (unsigned int cc = 0, numPartitions = output->GetNumberOfPartitions(); cc < numPartitions;
+       ++cc)
+  {
+    auto ds = output->GetPartition(cc);
+    if (ds && output->HasMetaData(cc) && output->GetMetaData(cc)->Has(vtkCompositeDataSet::NAME()))
+    {
+      datasets[output->GetMetaData(cc)->Get(vtkCompositeDataSet::NAME())] = ds;
+    }
+  }
+
   // add field data at leaf level
   if (node.has_path("state/fields"))
   {
@@ -86,7 +102,7 @@ bool FillPartionedDataSet(vtkPartitionedDataSet* output, const conduit_cpp::Node
   }
 
   auto fields = node["fields"];
-  nchildren = fields.number_of_children();
+  const conduit_index_t nchildren = fields.number_of_children();
   for (conduit_index_t i = 0; i < nchildren; ++i)
   {
     auto fieldNode = fields.child(i);
@@ -47,6 +47,18 @@ VTK_ABI_NAMESPACE_BEGIN
 VTKIOCATALYSTCONDUIT_EXPORT bool FillPartionedDataSet(
   vtkPartitionedDataSet* output, const conduit_cpp::Node& meshNode);
 
+/**
+ * Refresh the field arrays of a vtkPartitionedDataSet previously filled by
+ * FillPartionedDataSet without rebuilding its points or connectivity.
+ * Partitions are matched back to their topologies through the NAME metadata
+ * set at creation time.
+ *
+ * Return true if data was correctly generated, false if an error occurred.
+ * Do not throw errors.
+ */
+VTKIOCATALYSTCONDUIT_EXPORT bool FillPartitionedDataSetFields(
+  vtkPartitionedDataSet* output, const conduit_cpp::Node& meshNode);
+
 /**
  * Fill the vtkOverlappingAMR input.
  */
@@ -88,6 +88,15 @@ public:
   virtual void SetCompressionLevel(int compressionLevel) = 0;
   virtual int GetCompressionLevel() = 0;
 
+  /**
+   * Returns true when Compress and Uncompress may be invoked concurrently
+   * from several threads on this instance, allowing readers and writers
+   * to process independent data blocks in parallel. The compressors
+   * shipped with VTK keep no per-call state and return true; the
+   * conservative default for subclasses is false.
+   */
+  virtual bool GetThreadSafe() { return false; }
+
 protected:
   vtkDataCompressor();
   ~vtkDataCompressor() override;
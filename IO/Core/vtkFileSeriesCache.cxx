@@ -0,0 +1,318 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkFileSeriesCache.h"
+
+#include "vtkDataObject.h"
+#include "vtkFileResourceStream.h"
+#include "vtkObjectFactory.h"
+
+#include "vtksys/SystemTools.hxx"
+
+#include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <utility>
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkFileSeriesCache::vtkInternals
+{
+public:
+  using TimeStepKey = std::pair<std::string, double>;
+
+  struct DataEntry
+  {
+    vtkSmartPointer<vtkDataObject> Data;
+    vtkTypeUInt64 Bytes = 0;
+    std::list<TimeStepKey>::iterator LruPosition;
+  };
+
+  // Guards every container below; the cache is shared between readers
+  // which may execute on different threads.
+  std::mutex Mutex;
+
+  std::map<TimeStepKey, DataEntry> Data;
+  std::list<TimeStepKey> DataLru; // front = most recently used
+  vtkTypeUInt64 DataBytes = 0;
+
+  std::map<std::string, vtkSmartPointer<vtkObjectBase>> MetaData;
+
+  std::map<std::string, vtkSmartPointer<vtkResourceStream>> Streams;
+  std::list<std::string> StreamLru; // front = most recently used
+
+  // Modification time of each file when its first entry was stored, used
+  // to drop entries when the file changes on disk.
+  std::map<std::string, long int> FileMTimes;
+
+  //----------------------------------------------------------------------------
+  void TouchData(std::map<TimeStepKey, DataEntry>::iterator iter)
+  {
+    this->DataLru.splice(this->DataLru.begin(), this->DataLru, iter->second.LruPosition);
+  }
+
+  //----------------------------------------------------------------------------
+  void RemoveData(std::map<TimeStepKey, DataEntry>::iterator iter)
+  {
+    this->DataBytes -= iter->second.Bytes;
+    this->DataLru.erase(iter->second.LruPosition);
+    this->Data.erase(iter);
+  }
+
+  //----------------------------------------------------------------------------
+  void EvictDataTo(vtkTypeUInt64 budget)
+  {
+    while (this->DataBytes > budget && !this->DataLru.empty())
+    {
+      this->RemoveData(this->Data.find(this->DataLru.back()));
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  void TouchStream(const std::string& fileName)
+  {
+    this->StreamLru.remove(fileName);
+    this->StreamLru.push_front(fileName);
+  }
+
+  //----------------------------------------------------------------------------
+  void RemoveStream(const std::string& fileName)
+  {
+    this->Streams.erase(fileName);
+    this->StreamLru.remove(fileName);
+  }
+
+  //----------------------------------------------------------------------------
+  // Drop everything stored for the given file.
+  void DropFile(const std::string& fileName)
+  {
+    auto iter = this->Data.lower_bound(
+      TimeStepKey(fileName, std::numeric_limits<double>::lowest()));
+    while (iter != this->Data.end() && iter->first.first == fileName)
+    {
+      auto next = iter;
+      ++next;
+      this->RemoveData(iter);
+      iter = next;
+    }
+    this->MetaData.erase(fileName);
+    this->RemoveStream(fileName);
+    this->FileMTimes.erase(fileName);
+  }
+
+  //----------------------------------------------------------------------------
+  // Record the on-disk modification time the first time a file is seen.
+  void RecordFile(const std::string& fileName)
+  {
+    if (this->FileMTimes.find(fileName) == this->FileMTimes.end())
+    {
+      this->FileMTimes[fileName] = vtksys::SystemTools::ModifiedTime(fileName);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkFileSeriesCache);
+
+//------------------------------------------------------------------------------
+vtkFileSeriesCache::vtkFileSeriesCache()
+  : Internals(new vtkFileSeriesCache::vtkInternals())
+{
+  this->CacheSizeLimit = 256 * 1024 * 1024ULL;
+  this->MaxOpenStreams = 64;
+}
+
+//------------------------------------------------------------------------------
+vtkFileSeriesCache::~vtkFileSeriesCache() = default;
+
+//------------------------------------------------------------------------------
+vtkFileSeriesCache* vtkFileSeriesCache::GetGlobalInstance()
+{
+  static vtkSmartPointer<vtkFileSeriesCache> instance =
+    vtkSmartPointer<vtkFileSeriesCache>::New();
+  return instance;
+}
+
+//------------------------------------------------------------------------------
+bool vtkFileSeriesCache::ValidateFile(const std::string& fileName)
+{
+  auto& internals = (*this->Internals);
+  auto iter = internals.FileMTimes.find(fileName);
+  if (iter == internals.FileMTimes.end())
+  {
+    return false;
+  }
+  if (vtksys::SystemTools::ModifiedTime(fileName) != iter->second)
+  {
+    internals.DropFile(fileName);
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkFileSeriesCache::GetTimeStepData(
+  const std::string& fileName, double time)
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  if (!this->ValidateFile(fileName))
+  {
+    return nullptr;
+  }
+  auto iter = internals.Data.find(vtkInternals::TimeStepKey(fileName, time));
+  if (iter == internals.Data.end())
+  {
+    return nullptr;
+  }
+  internals.TouchData(iter);
+  return iter->second.Data;
+}
+
+//------------------------------------------------------------------------------
+void vtkFileSeriesCache::SetTimeStepData(
+  const std::string& fileName, double time, vtkDataObject* data)
+{
+  if (!data)
+  {
+    return;
+  }
+
+  // GetActualMemorySize is in kibibytes.
+  vtkTypeUInt64 bytes = static_cast<vtkTypeUInt64>(data->GetActualMemorySize()) * 1024;
+
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+
+  vtkInternals::TimeStepKey key(fileName, time);
+  auto iter = internals.Data.find(key);
+  if (iter != internals.Data.end())
+  {
+    internals.RemoveData(iter);
+  }
+  if (bytes > this->CacheSizeLimit)
+  {
+    // Never worth evicting the whole cache for a single entry.
+    return;
+  }
+
+  // Snapshot the data so that downstream modifications of the reader
+  // output do not alter the cached copy.
+  vtkSmartPointer<vtkDataObject> snapshot =
+    vtkSmartPointer<vtkDataObject>::Take(data->NewInstance());
+  snapshot->ShallowCopy(data);
+
+  internals.EvictDataTo(this->CacheSizeLimit - bytes);
+  internals.RecordFile(fileName);
+  internals.DataLru.push_front(key);
+  vtkInternals::DataEntry& entry = internals.Data[key];
+  entry.Data = snapshot;
+  entry.Bytes = bytes;
+  entry.LruPosition = internals.DataLru.begin();
+  internals.DataBytes += bytes;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkObjectBase> vtkFileSeriesCache::GetMetaData(const std::string& fileName)
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  if (!this->ValidateFile(fileName))
+  {
+    return nullptr;
+  }
+  auto iter = internals.MetaData.find(fileName);
+  return iter != internals.MetaData.end() ? iter->second : nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkFileSeriesCache::SetMetaData(const std::string& fileName, vtkObjectBase* metadata)
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  if (!metadata)
+  {
+    internals.MetaData.erase(fileName);
+    return;
+  }
+  internals.RecordFile(fileName);
+  internals.MetaData[fileName] = metadata;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkResourceStream> vtkFileSeriesCache::GetOpenStream(const std::string& fileName)
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+
+  if (this->ValidateFile(fileName))
+  {
+    auto iter = internals.Streams.find(fileName);
+    if (iter != internals.Streams.end())
+    {
+      internals.TouchStream(fileName);
+      return iter->second;
+    }
+  }
+
+  vtkSmartPointer<vtkFileResourceStream> stream =
+    vtkSmartPointer<vtkFileResourceStream>::New();
+  if (!stream->Open(fileName.c_str()))
+  {
+    return nullptr;
+  }
+
+  internals.RecordFile(fileName);
+  internals.Streams[fileName] = stream;
+  internals.StreamLru.push_front(fileName);
+  while (static_cast<int>(internals.Streams.size()) > this->MaxOpenStreams &&
+    !internals.StreamLru.empty())
+  {
+    internals.RemoveStream(internals.StreamLru.back());
+  }
+  return stream;
+}
+
+//------------------------------------------------------------------------------
+void vtkFileSeriesCache::CloseStream(const std::string& fileName)
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  internals.RemoveStream(fileName);
+}
+
+//------------------------------------------------------------------------------
+void vtkFileSeriesCache::Clear()
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  internals.Data.clear();
+  internals.DataLru.clear();
+  internals.DataBytes = 0;
+  internals.MetaData.clear();
+  internals.Streams.clear();
+  internals.StreamLru.clear();
+  internals.FileMTimes.clear();
+}
+
+//------------------------------------------------------------------------------
+vtkTypeUInt64 vtkFileSeriesCache::GetCacheSize()
+{
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  return internals.DataBytes;
+}
+
+//------------------------------------------------------------------------------
+void vtkFileSeriesCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  auto& internals = (*this->Internals);
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  os << indent << "CacheSizeLimit: " << this->CacheSizeLimit << endl;
+  os << indent << "MaxOpenStreams: " << this->MaxOpenStreams << endl;
+  os << indent << "Cached time steps: " << internals.Data.size() << " (" << internals.DataBytes
+     << " bytes)" << endl;
+  os << indent << "Cached metadata entries: " << internals.MetaData.size() << endl;
+  os << indent << "Pooled streams: " << internals.Streams.size() << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkFileSeriesCache
+ * @brief   process-wide cache for readers of time series split across files
+ *
+ * Readers that implement temporal data as a series of files typically
+ * re-open and re-parse a file every time the pipeline requests a time
+ * step, so scrubbing a timeline pays the full open/parse cost per step.
+ * vtkFileSeriesCache is a shared service such readers can hold to avoid
+ * that redundant work. It offers three facilities, all keyed by file name:
+ *
+ * - a byte-budgeted, least-recently-used cache of time step outputs,
+ *   see SetTimeStepData() and GetTimeStepData();
+ * - persistence of parsed per-file metadata across time steps, see
+ *   SetMetaData() and GetMetaData();
+ * - a pool of open vtkResourceStream handles so that a seek replaces a
+ *   re-open, see GetOpenStream() and CloseStream().
+ *
+ * Entries are discarded automatically when the file they were read from
+ * is modified on disk. Readers normally share the instance returned by
+ * GetGlobalInstance() so that the byte budget is enforced process-wide,
+ * but private instances can be created with New(). All methods are
+ * thread safe.
+ *
+ * @sa
+ * vtkResourceStream vtkFileResourceStream
+ */
+
+#ifndef vtkFileSeriesCache_h
+#define vtkFileSeriesCache_h
+
+#include "vtkIOCoreModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For return values
+
+#include <memory> // For std::unique_ptr
+#include <string> // For file name keys
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataObject;
+class vtkResourceStream;
+
+class VTKIOCORE_EXPORT vtkFileSeriesCache : public vtkObject
+{
+public:
+  static vtkFileSeriesCache* New();
+  vtkTypeMacro(vtkFileSeriesCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Return the process-wide cache instance shared by all readers that do
+   * not use a private cache. The instance is created on first use.
+   */
+  static vtkFileSeriesCache* GetGlobalInstance();
+
+  ///@{
+  /**
+   * The byte budget for cached time step outputs. When an insertion
+   * pushes the total above this limit, least-recently-used entries are
+   * evicted until the cache fits again. Metadata and pooled streams are
+   * not counted against the budget. Default is 256 MiB.
+   */
+  vtkSetMacro(CacheSizeLimit, vtkTypeUInt64);
+  vtkGetMacro(CacheSizeLimit, vtkTypeUInt64);
+  ///@}
+
+  ///@{
+  /**
+   * The maximum number of streams kept open by the handle pool. When the
+   * pool is full, the least-recently-used stream is closed to make room.
+   * Default is 64.
+   */
+  vtkSetMacro(MaxOpenStreams, int);
+  vtkGetMacro(MaxOpenStreams, int);
+  ///@}
+
+  /**
+   * Return the output cached for the given file and time, or nullptr when
+   * none is cached. The returned data object is shared with the cache:
+   * callers must ShallowCopy it into their output rather than modify it.
+   */
+  vtkSmartPointer<vtkDataObject> GetTimeStepData(const std::string& fileName, double time);
+
+  /**
+   * Cache the output read from the given file for the given time. A
+   * snapshot of the data is stored (shallow copy), so the caller may keep
+   * modifying its own object afterwards. Storing may evict
+   * least-recently-used entries to respect CacheSizeLimit; data larger
+   * than the whole budget is not cached at all.
+   */
+  void SetTimeStepData(const std::string& fileName, double time, vtkDataObject* data);
+
+  /**
+   * Return the metadata object stored for the given file, or nullptr when
+   * none is stored. Use this to keep parsed headers, tables of contents or
+   * similar reader-specific state alive across time steps.
+   */
+  vtkSmartPointer<vtkObjectBase> GetMetaData(const std::string& fileName);
+
+  /**
+   * Store a metadata object for the given file, replacing any previous
+   * one. Pass nullptr to remove the stored metadata.
+   */
+  void SetMetaData(const std::string& fileName, vtkObjectBase* metadata);
+
+  /**
+   * Return an open stream for the given file, opening and pooling one on
+   * the first request. The stream position is wherever the previous user
+   * left it, so callers must Seek() before reading. Returns nullptr if
+   * the file cannot be opened.
+   */
+  vtkSmartPointer<vtkResourceStream> GetOpenStream(const std::string& fileName);
+
+  /**
+   * Remove the pooled stream for the given file, if any. The stream is
+   * closed once the last external reference to it goes away.
+   */
+  void CloseStream(const std::string& fileName);
+
+  /**
+   * Remove every cached time step, metadata entry and pooled stream.
+   */
+  void Clear();
+
+  /**
+   * Return the number of bytes currently used by cached time step outputs.
+   */
+  vtkTypeUInt64 GetCacheSize();
+
+protected:
+  vtkFileSeriesCache();
+  ~vtkFileSeriesCache() override;
+
+  /**
+   * Drop all entries for the file when it changed on disk since they were
+   * stored. Returns true when the entries are still valid. The caller must
+   * hold the internal lock.
+   */
+  bool ValidateFile(const std::string& fileName);
+
+  vtkTypeUInt64 CacheSizeLimit;
+  int MaxOpenStreams;
+
+private:
+  vtkFileSeriesCache(const vtkFileSeriesCache&) = delete;
+  void operator=(const vtkFileSeriesCache&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -43,6 +43,12 @@ public:
   vtkSetClampMacro(AccelerationLevel, int, 1, VTK_INT_MAX);
   vtkGetMacro(AccelerationLevel, int);
 
+  /**
+   * The LZ4 compressor keeps no per-call state, so independent data
+   * blocks may be processed concurrently.
+   */
+  bool GetThreadSafe() override { return true; }
+
 protected:
   vtkLZ4DataCompressor();
   ~vtkLZ4DataCompressor() override;
@@ -45,6 +45,12 @@ public:
   // Compression level getter required by vtkDataCompressor.
   int GetCompressionLevel() override;
 
+  /**
+   * The LZMA compressor keeps no per-call state, so independent data
+   * blocks may be processed concurrently.
+   */
+  bool GetThreadSafe() override { return true; }
+
 protected:
   vtkLZMADataCompressor();
   ~vtkLZMADataCompressor() override;
@@ -41,6 +41,12 @@ public:
   void SetCompressionLevel(int compressionLevel) override;
   ///@}
 
+  /**
+   * The zlib compressor keeps no per-call state, so independent data
+   * blocks may be processed concurrently.
+   */
+  bool GetThreadSafe() override { return true; }
+
 protected:
   vtkZLibDataCompressor();
   ~vtkZLibDataCompressor() override;
@@ -251,7 +251,16 @@ int vtkEnSightGoldBinaryReader::OpenFile(const char* filename)
 #ifdef _WIN32
     mode |= ios::binary;
 #endif
-    this->GoldIFile = new vtksys::ifstream(filename, mode);
+    // The gold format is parsed with many small reads (80 byte lines, single
+    // ints); install a large buffer so they are served from memory instead of
+    // individual system calls. The buffer must be in place before the file is
+    // opened for pubsetbuf to take effect.
+    constexpr size_t bufferSize = 1 << 20;
+    auto* file = new vtksys::ifstream;
+    this->IFileBuffer.resize(bufferSize);
+    file->rdbuf()->pubsetbuf(this->IFileBuffer.data(), bufferSize);
+    file->open(filename, mode);
+    this->GoldIFile = file;
   }
   else
   {
@@ -31,6 +31,8 @@
 #include "vtkEnSightReader.h"
 #include "vtkIOEnSightModule.h" // For export macro
 
+#include <vector> // For IFileBuffer
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkMultiBlockDataSet;
 
@@ -231,6 +233,9 @@ protected:
   int FortranSkipBytes; // Number of bytes to skip when seeking within a fortran-written file
 
   istream* GoldIFile;
+  // Large read buffer installed on GoldIFile so the many small reads the
+  // format requires are served from memory instead of individual system calls.
+  std::vector<char> IFileBuffer;
   // The size of the file could be used to choose byte order.
   vtkTypeUInt64 FileSize;
 
@@ -7,6 +7,13 @@
 #include "vtkImageData.h"
 #include "vtkObjectFactory.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 extern "C"
 {
 #include <libavcodec/avcodec.h>
@@ -44,8 +51,22 @@ public:
   int FrameRate;
 
 private:
+  // scale and encode the frame currently held in rgbInput and write the
+  // resulting packets; called from the encode thread when asynchronous
+  // encoding is on and from Write() otherwise
+  int EncodeFrame();
+  void EncodeLoop();
+
   vtkFFMPEGWriter* Writer;
 
+  std::thread EncodeThread;
+  std::mutex QueueMutex;
+  std::condition_variable QueuePushed;
+  std::condition_variable QueuePopped;
+  std::deque<std::vector<unsigned char>> FrameQueue;
+  bool StopRequested;
+  std::atomic<bool> EncodeFailed;
+
   AVFormatContext* avFormatContext;
 
   vtk_ff_const59 AVOutputFormat* avOutputFormat;
@@ -81,6 +102,9 @@ vtkFFMPEGWriterInternal::vtkFFMPEGWriterInternal(vtkFFMPEGWriter* creator)
   this->closedFile = 1;
 
   this->FrameRate = 25;
+
+  this->StopRequested = false;
+  this->EncodeFailed = false;
 }
 
 //------------------------------------------------------------------------------
@@ -251,6 +275,13 @@ int vtkFFMPEGWriterInternal::Start()
     vtkGenericWarningMacro(<< "Could not allocate avcodec private data.");
     return 0;
   }
+
+  if (this->Writer->GetAsyncEncoding())
+  {
+    this->StopRequested = false;
+    this->EncodeFailed = false;
+    this->EncodeThread = std::thread(&vtkFFMPEGWriterInternal::EncodeLoop, this);
+  }
   return 1;
 }
 
@@ -259,16 +290,57 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
 {
   this->Writer->GetInputAlgorithm(0, 0)->UpdateWholeExtent();
 
-  // copy the image from the input to the RGB buffer while flipping Y
   unsigned char* rgb = (unsigned char*)id->GetScalarPointer();
+  const int width = this->avCodecContext->width;
+  const int height = this->avCodecContext->height;
+
+  if (this->Writer->GetAsyncEncoding())
+  {
+    if (this->EncodeFailed)
+    {
+      return 0;
+    }
+    // flip Y into a queued buffer; this is the same copy the synchronous
+    // path performs into rgbInput, the pipeline's scalars are not
+    // referenced once we return
+    std::vector<unsigned char> frame(static_cast<size_t>(height) * width * 3);
+    for (int y = 0; y < height; y++)
+    {
+      memcpy(&frame[static_cast<size_t>(y) * width * 3], rgb + (height - y - 1) * width * 3,
+        width * 3);
+    }
+    {
+      std::unique_lock<std::mutex> lock(this->QueueMutex);
+      this->QueuePopped.wait(lock,
+        [this]() {
+          return static_cast<int>(this->FrameQueue.size()) < this->Writer->GetMaxQueuedFrames() ||
+            this->EncodeFailed;
+        });
+      if (this->EncodeFailed)
+      {
+        return 0;
+      }
+      this->FrameQueue.push_back(std::move(frame));
+    }
+    this->QueuePushed.notify_one();
+    return 1;
+  }
+
+  // copy the image from the input to the RGB buffer while flipping Y
   unsigned char* src;
-  for (int y = 0; y < this->avCodecContext->height; y++)
+  for (int y = 0; y < height; y++)
   {
-    src = rgb + (this->avCodecContext->height - y - 1) * this->avCodecContext->width * 3; // flip Y
+    src = rgb + (height - y - 1) * width * 3; // flip Y
     unsigned char* dest = &this->rgbInput->data[0][y * this->rgbInput->linesize[0]];
-    memcpy((void*)dest, (void*)src, this->avCodecContext->width * 3);
+    memcpy((void*)dest, (void*)src, width * 3);
   }
 
+  return this->EncodeFrame();
+}
+
+//------------------------------------------------------------------------------
+int vtkFFMPEGWriterInternal::EncodeFrame()
+{
   // convert that to YUV for input to the codec
   SwsContext* convert_ctx =
     sws_getContext(this->avCodecContext->width, this->avCodecContext->height, AV_PIX_FMT_RGB24,
@@ -325,9 +397,60 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
   return 1;
 }
 
+//------------------------------------------------------------------------------
+void vtkFFMPEGWriterInternal::EncodeLoop()
+{
+  for (;;)
+  {
+    std::vector<unsigned char> frame;
+    {
+      std::unique_lock<std::mutex> lock(this->QueueMutex);
+      this->QueuePushed.wait(
+        lock, [this]() { return this->StopRequested || !this->FrameQueue.empty(); });
+      if (this->FrameQueue.empty())
+      {
+        // stop was requested and every queued frame has been encoded
+        return;
+      }
+      frame = std::move(this->FrameQueue.front());
+      this->FrameQueue.pop_front();
+    }
+    this->QueuePopped.notify_one();
+
+    // the rows were already flipped when the frame was queued
+    for (int y = 0; y < this->avCodecContext->height; y++)
+    {
+      memcpy(&this->rgbInput->data[0][y * this->rgbInput->linesize[0]],
+        &frame[static_cast<size_t>(y) * this->avCodecContext->width * 3],
+        this->avCodecContext->width * 3);
+    }
+
+    if (!this->EncodeFrame())
+    {
+      this->EncodeFailed = true;
+      {
+        std::unique_lock<std::mutex> lock(this->QueueMutex);
+        this->FrameQueue.clear();
+      }
+      this->QueuePopped.notify_all();
+      return;
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkFFMPEGWriterInternal::End()
 {
+  if (this->EncodeThread.joinable())
+  {
+    {
+      std::unique_lock<std::mutex> lock(this->QueueMutex);
+      this->StopRequested = true;
+    }
+    this->QueuePushed.notify_all();
+    this->EncodeThread.join();
+  }
+
   if (this->yuvOutput)
   {
     av_frame_free(&this->yuvOutput);
@@ -661,6 +784,8 @@ vtkFFMPEGWriter::vtkFFMPEGWriter()
   this->Rate = 25;
   this->BitRate = 0;
   this->BitRateTolerance = 0;
+  this->AsyncEncoding = false;
+  this->MaxQueuedFrames = 4;
 }
 
 //------------------------------------------------------------------------------
@@ -775,5 +900,7 @@ void vtkFFMPEGWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Rate: " << this->Rate << endl;
   os << indent << "BitRate: " << this->BitRate << endl;
   os << indent << "BitRateTolerance: " << this->BitRateTolerance << endl;
+  os << indent << "AsyncEncoding: " << (this->AsyncEncoding ? "true" : "false") << endl;
+  os << indent << "MaxQueuedFrames: " << this->MaxQueuedFrames << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -87,6 +87,33 @@ public:
   vtkGetMacro(BitRateTolerance, int);
   ///@}
 
+  ///@{
+  /**
+   * Encode frames on a dedicated thread instead of on the thread that
+   * calls Write(). Write() then only copies the frame into a bounded
+   * queue and returns, so rendering the next frame overlaps with
+   * encoding the previous ones; End() drains the queue before closing
+   * the file. Errors raised by the encode thread are reported on a
+   * subsequent Write() call. Must be set before Start(). Requires the
+   * post-2016 FFmpeg API; with older FFmpeg versions frames are encoded
+   * synchronously regardless of this setting. Default is off.
+   */
+  vtkSetMacro(AsyncEncoding, bool);
+  vtkGetMacro(AsyncEncoding, bool);
+  vtkBooleanMacro(AsyncEncoding, bool);
+  ///@}
+
+  ///@{
+  /**
+   * The maximum number of frames the asynchronous encode queue may hold
+   * before Write() blocks waiting for the encoder to catch up. Each
+   * queued frame holds a full RGB copy of the image, so large values
+   * trade memory for burst tolerance. Default is 4.
+   */
+  vtkSetClampMacro(MaxQueuedFrames, int, 1, 64);
+  vtkGetMacro(MaxQueuedFrames, int);
+  ///@}
+
 protected:
   vtkFFMPEGWriter();
   ~vtkFFMPEGWriter() override;
@@ -99,6 +126,8 @@ protected:
   int BitRate;
   int BitRateTolerance;
   bool Compression;
+  bool AsyncEncoding;
+  int MaxQueuedFrames;
 
 private:
   vtkFFMPEGWriter(const vtkFFMPEGWriter&) = delete;
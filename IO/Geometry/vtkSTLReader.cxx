@@ -7,6 +7,7 @@
 #include "vtkCellData.h"
 #include "vtkErrorCode.h"
 #include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -14,6 +15,7 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -21,7 +23,9 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <string>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -214,13 +218,6 @@ int vtkSTLReader::RequestData(vtkInformation* vtkNotUsed(request),
 //------------------------------------------------------------------------------
 bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newPolys)
 {
-  struct facet_t_t
-  {
-    float n[3], v1[3], v2[3], v3[3];
-    unsigned short junk;
-  };
-  using facet_t = struct facet_t_t;
-
   vtkDebugMacro(<< "Reading BINARY STL file");
 
   //  File is read to obtain raw information as well as bounding box
@@ -271,43 +268,64 @@ bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newP
   {
     numTris = static_cast<int>(ulFileLength);
   }
-
-  // now we can allocate the memory we need for this STL file
-  newPts->Allocate(numTris * 3);
-  newPolys->AllocateEstimate(numTris, 3);
-
-  facet_t facet;
-  for (int i = 0; fread(&facet, 50, 1, fp) > 0; i++)
+  numTris = std::max(numTris, 0);
+
+  // The record size is fixed, so the output can be carved once up front:
+  // every facet contributes three points and one triangle.
+  newPts->SetDataType(VTK_FLOAT);
+  newPts->SetNumberOfPoints(static_cast<vtkIdType>(numTris) * 3);
+  float* pointData = vtkArrayDownCast<vtkFloatArray>(newPts->GetData())->GetPointer(0);
+
+  // Parse the facets in large slabs: each slab is read with a single
+  // fread and unpacked (copied and byte swapped) on all threads.
+  constexpr size_t facetSize = 50; // twelve 32-bit floats plus the attribute count
+  constexpr size_t facetsPerSlab = 131072;
+  std::vector<unsigned char> slab(facetsPerSlab * facetSize);
+  vtkIdType numRead = 0;
+  size_t slabFacets;
+  while (numRead < numTris && (slabFacets = fread(slab.data(), facetSize, facetsPerSlab, fp)) > 0)
   {
-    vtkByteSwap::Swap4LE(facet.n);
-    vtkByteSwap::Swap4LE(facet.n + 1);
-    vtkByteSwap::Swap4LE(facet.n + 2);
-
-    vtkByteSwap::Swap4LE(facet.v1);
-    vtkByteSwap::Swap4LE(facet.v1 + 1);
-    vtkByteSwap::Swap4LE(facet.v1 + 2);
-
-    vtkByteSwap::Swap4LE(facet.v2);
-    vtkByteSwap::Swap4LE(facet.v2 + 1);
-    vtkByteSwap::Swap4LE(facet.v2 + 2);
-
-    vtkByteSwap::Swap4LE(facet.v3);
-    vtkByteSwap::Swap4LE(facet.v3 + 1);
-    vtkByteSwap::Swap4LE(facet.v3 + 2);
-
-    vtkIdType pts[3];
-    pts[0] = newPts->InsertNextPoint(facet.v1);
-    pts[1] = newPts->InsertNextPoint(facet.v2);
-    pts[2] = newPts->InsertNextPoint(facet.v3);
-
-    newPolys->InsertNextCell(3, pts);
+    slabFacets = std::min(slabFacets, static_cast<size_t>(numTris - numRead));
+    const unsigned char* facets = slab.data();
+    float* slabPoints = pointData + numRead * 9;
+    vtkSMPTools::For(
+      0, static_cast<vtkIdType>(slabFacets), [&](vtkIdType facet, vtkIdType endFacet) {
+        for (; facet < endFacet; ++facet)
+        {
+          // Skip the 12 byte facet normal; the three vertices follow.
+          float* vertices = slabPoints + facet * 9;
+          memcpy(vertices, facets + facet * facetSize + 12, 9 * sizeof(float));
+          vtkByteSwap::Swap4LERange(vertices, 9);
+        }
+      });
+    numRead += static_cast<vtkIdType>(slabFacets);
+    vtkDebugMacro(<< "triangle# " << numRead);
+    this->UpdateProgress(static_cast<double>(numRead) / numTris);
+  }
+  if (numRead < numTris)
+  {
+    // The file ended early; keep only the facets actually present.
+    newPts->SetNumberOfPoints(numRead * 3);
+  }
 
-    if ((i % 100000) == 0 && i != 0)
+  // The connectivity is implicit: triangle i uses points 3i, 3i+1, 3i+2.
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numRead + 1);
+  vtkSMPTools::For(0, numRead + 1, [&](vtkIdType tri, vtkIdType endTri) {
+    for (; tri < endTri; ++tri)
     {
-      vtkDebugMacro(<< "triangle# " << i);
-      this->UpdateProgress(static_cast<double>(i) / numTris);
+      offsets->SetValue(tri, 3 * tri);
     }
-  }
+  });
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(numRead * 3);
+  vtkSMPTools::For(0, numRead * 3, [&](vtkIdType entry, vtkIdType endEntry) {
+    for (; entry < endEntry; ++entry)
+    {
+      connectivity->SetValue(entry, entry);
+    }
+  });
+  newPolys->SetData(offsets, connectivity);
 
   return true;
 }
@@ -243,6 +243,48 @@ struct vtkHDFReader::DataCache
     return (this->Map.find(KeyT{ attribute, key }) != this->Map.end());
   }
 
+  /*
+   * Record a use of the given key for the least recently used eviction.
+   */
+  void Touch(const KeyT& key) { this->LastUse[key] = ++this->UseCounter; }
+
+  /*
+   * Evict the least recently used arrays until the cache fits MaxSize
+   * bytes. A MaxSize of 0 means no limit, and the most recently used
+   * entry is always kept.
+   */
+  void Prune()
+  {
+    if (this->MaxSize <= 0)
+    {
+      return;
+    }
+    const vtkIdType maxKiB = this->MaxSize / 1024;
+    vtkIdType sizeKiB = 0;
+    for (const auto& entry : this->Map)
+    {
+      sizeKiB +=
+        entry.second.second ? static_cast<vtkIdType>(entry.second.second->GetActualMemorySize())
+                            : 0;
+    }
+    while (sizeKiB > maxKiB && this->Map.size() > 1)
+    {
+      auto oldest = this->Map.begin();
+      for (auto it = this->Map.begin(); it != this->Map.end(); ++it)
+      {
+        if (this->LastUse[it->first] < this->LastUse[oldest->first])
+        {
+          oldest = it;
+        }
+      }
+      sizeKiB -= oldest->second.second
+        ? static_cast<vtkIdType>(oldest->second.second->GetActualMemorySize())
+        : 0;
+      this->LastUse.erase(oldest->first);
+      this->Map.erase(oldest);
+    }
+  }
+
   template <typename T>
   bool CheckExistsAndEqual(int attribute, const std::string& name, const T& currentOffset)
   {
@@ -273,6 +315,8 @@ struct vtkHDFReader::DataCache
     this->Map.emplace(KeyT{ attribute, name },
       ValueT{ std::move(buff), static_cast<vtkSmartPointer<vtkAbstractArray>>(array) });
     this->HasBeenUpdated = true;
+    this->Touch(KeyT{ attribute, name });
+    this->Prune();
   }
 
   template <typename OffT>
@@ -293,6 +337,8 @@ struct vtkHDFReader::DataCache
     this->Map.emplace(
       key, ValueT{ std::move(buff), static_cast<vtkSmartPointer<vtkAbstractArray>>(array) });
     this->HasBeenUpdated = true;
+    this->Touch(key);
+    this->Prune();
   }
 
   vtkSmartPointer<vtkAbstractArray> Get(int attribute, const std::string& name)
@@ -302,6 +348,7 @@ struct vtkHDFReader::DataCache
     {
       return nullptr;
     }
+    this->Touch(it->first);
     return it->second.second;
   }
 
@@ -318,8 +365,14 @@ struct vtkHDFReader::DataCache
   }
   bool HasBeenUpdated = false;
 
+  // Byte budget for the cache, 0 meaning no limit. Set from the reader's
+  // MaxCacheSize before each execution.
+  vtkIdType MaxSize = 0;
+
 private:
   std::map<KeyT, ValueT> Map;
+  std::map<KeyT, vtkIdType> LastUse;
+  vtkIdType UseCounter = 0;
 };
 
 //----------------------------------------------------------------------------
@@ -379,6 +432,8 @@ void vtkHDFReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Step: " << this->Step << "\n";
   os << indent << "TimeValue: " << this->TimeValue << "\n";
   os << indent << "TimeRange: " << this->TimeRange[0] << " - " << this->TimeRange[1] << "\n";
+  os << indent << "UseCache: " << (this->UseCache ? "true" : "false") << "\n";
+  os << indent << "MaxCacheSize: " << this->MaxCacheSize << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -1540,6 +1595,7 @@ int vtkHDFReader::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
 {
   this->MeshGeometryChangedFromPreviousTimeStep = false;
+  this->Cache->MaxSize = this->MaxCacheSize;
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
   int ok = 1;
   if (!outInfo)
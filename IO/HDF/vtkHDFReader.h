@@ -143,6 +143,17 @@ public:
   vtkBooleanMacro(UseCache, bool);
   ///@}
 
+  ///@{
+  /**
+   * Maximum number of bytes the internal cache may retain, 0 meaning no
+   * limit (the default). When reading a time step would push the cache
+   * over this budget, the least recently used arrays are evicted first.
+   * Only meaningful when UseCache is true.
+   */
+  vtkGetMacro(MaxCacheSize, vtkIdType);
+  vtkSetMacro(MaxCacheSize, vtkIdType);
+  ///@}
+
   ///@{
   /**
    * Boolean property determining whether to merge partitions when reading unstructured data.
@@ -336,6 +347,7 @@ protected:
   Implementation* Impl;
 
   bool UseCache = false;
+  vtkIdType MaxCacheSize = 0;
   struct DataCache;
   std::shared_ptr<DataCache> Cache;
 };
@@ -164,7 +164,20 @@ bool vtkHDFReader::Implementation::Open(const char* fileName)
       this->Close();
     }
 
-    if ((this->File = H5Fopen(this->FileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT)) < 0)
+    // Enlarge the raw chunk cache from the 1 MiB HDF5 default so that
+    // hyperslab reads of chunked (and possibly compressed) datasets
+    // decompress each chunk only once instead of every time a read
+    // touches it. The slot count is a prime well above the number of
+    // cached chunks, as the HDF5 documentation recommends.
+    vtkHDF::ScopedH5PHandle fileAccessPropertyList = H5Pcreate(H5P_FILE_ACCESS);
+    if (fileAccessPropertyList < 0 ||
+      H5Pset_cache(fileAccessPropertyList, 0, 8191, 32 * 1024 * 1024, 0.75) < 0)
+    {
+      vtkErrorWithObjectMacro(this->Reader, "Cannot create file access property list");
+      return false;
+    }
+
+    if ((this->File = H5Fopen(this->FileName.c_str(), H5F_ACC_RDONLY, fileAccessPropertyList)) < 0)
     {
       // we try to read a non-HDF file
       return false;
@@ -23,6 +23,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 
 #include <vtksys/RegularExpression.hxx>
 #include <vtksys/SystemTools.hxx>
@@ -34,6 +35,7 @@
 #include <Ioss_SideSet.h>
 
 #include <memory>
+#include <vector>
 
 namespace vtkIOSSUtilities
 {
@@ -550,14 +552,14 @@ struct ChangeComponentsImpl
     using ValueType = typename ArrayT::ValueType;
     ArrayT* input = vtkArrayDownCast<ArrayT>(this->Input);
     const int numComps = std::max(input->GetNumberOfComponents(), output->GetNumberOfComponents());
-    ValueType* tuple = new ValueType[numComps];
-    std::fill(tuple, tuple + numComps, static_cast<ValueType>(0));
-    for (vtkIdType cc = 0, max = input->GetNumberOfTuples(); cc < max; ++cc)
-    {
-      input->GetTypedTuple(cc, tuple);
-      output->SetTypedTuple(cc, tuple);
-    }
-    delete[] tuple;
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      std::vector<ValueType> tuple(numComps, static_cast<ValueType>(0));
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        input->GetTypedTuple(cc, tuple.data());
+        output->SetTypedTuple(cc, tuple.data());
+      }
+    });
   }
 };
 
@@ -596,19 +598,19 @@ struct Swizzler
   {
     const int numComps = array->GetNumberOfComponents();
     using ValueType = typename ArrayT::ValueType;
-    ValueType* inTuple = new ValueType[numComps];
-    ValueType* outTuple = new ValueType[numComps];
-    for (vtkIdType cc = 0, max = array->GetNumberOfTuples(); cc < max; ++cc)
-    {
-      array->GetTypedTuple(cc, inTuple);
-      for (int comp = 0; comp < numComps; ++comp)
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      std::vector<ValueType> inTuple(numComps);
+      std::vector<ValueType> outTuple(numComps);
+      for (vtkIdType cc = begin; cc < end; ++cc)
       {
-        outTuple[comp] = inTuple[this->Ordering[comp]];
+        array->GetTypedTuple(cc, inTuple.data());
+        for (int comp = 0; comp < numComps; ++comp)
+        {
+          outTuple[comp] = inTuple[this->Ordering[comp]];
+        }
+        array->SetTypedTuple(cc, outTuple.data());
       }
-      array->SetTypedTuple(cc, outTuple);
-    }
-    delete[] inTuple;
-    delete[] outTuple;
+    });
   }
 };
 
@@ -14,6 +14,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
@@ -378,19 +379,32 @@ public:
   //---------------------------------------------------------------------------
   void FinalizeTopology()
   {
+    // drop the parts that have no cells first, so that the parallel pass
+    // below only sees parts that need their topology built
     for (vtkIdType i = 0; i < this->NumParts; ++i)
     {
       vtkLSDynaPart* part = this->Parts[i];
-      if (part && part->HasCells())
-      {
-        part->BuildToplogy();
-      }
-      else if (part)
+      if (part && !part->HasCells())
       {
         part->Delete();
         this->Parts[i] = nullptr;
       }
     }
+
+    // each part builds its topology from its own cell and point buffers,
+    // so the parts are independent of each other
+    vtkLSDynaPart** parts = this->Parts;
+    vtkSMPTools::For(0, this->NumParts,
+      [parts](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          if (parts[i])
+          {
+            parts[i]->BuildToplogy();
+          }
+        }
+      });
   }
 
   //---------------------------------------------------------------------------
@@ -34,6 +34,7 @@
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkShortArray.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -1510,6 +1511,70 @@ int vtkReadBinaryData(istream* IS, T* data, vtkIdType numTuples, vtkIdType numCo
   return 1;
 }
 
+// Byte swap a buffer on all threads. The vtkByteSwap range functions keep
+// no state, so disjoint sub-ranges can be swapped concurrently; the word
+// size is taken from the value type.
+template <class T>
+void vtkSwapBERangeInParallel(T* data, vtkIdType numWords)
+{
+  vtkSMPTools::For(0, numWords, [&](vtkIdType begin, vtkIdType end) {
+    switch (sizeof(T))
+    {
+      case 2:
+        vtkByteSwap::Swap2BERange(data + begin, end - begin);
+        break;
+      case 4:
+        vtkByteSwap::Swap4BERange(data + begin, end - begin);
+        break;
+      case 8:
+        vtkByteSwap::Swap8BERange(data + begin, end - begin);
+        break;
+      default:
+        break;
+    }
+  });
+}
+
+// Stream a binary section stored as 32-bit big-endian ints into a vtkIdType
+// destination through a fixed-size staging buffer, swapping and widening each
+// chunk on all threads. Reading a section this way never allocates a second
+// full-size copy of it, which matters for connectivity sections of very large
+// files.
+int vtkReadBinaryIdTypeData(istream* IS, vtkIdType* data, vtkIdType numValues)
+{
+  if (numValues == 0)
+  {
+    // nothing to read here.
+    return 1;
+  }
+  char line[256];
+
+  // suck up newline
+  IS->getline(line, 256);
+
+  constexpr vtkIdType valuesPerChunk = 1 << 20; // 4 MB of staging
+  std::vector<int> buffer(std::min(numValues, valuesPerChunk));
+  for (vtkIdType first = 0; first < numValues; first += valuesPerChunk)
+  {
+    const vtkIdType numChunkValues = std::min(valuesPerChunk, numValues - first);
+    IS->read((char*)buffer.data(), sizeof(int) * numChunkValues);
+    if (IS->eof())
+    {
+      vtkGenericWarningMacro(<< "Error reading binary data!");
+      return 0;
+    }
+    vtkIdType* chunkData = data + first;
+    vtkSMPTools::For(0, numChunkValues, [&](vtkIdType begin, vtkIdType end) {
+      vtkByteSwap::Swap4BERange(buffer.data() + begin, end - begin);
+      for (vtkIdType idx = begin; idx < end; ++idx)
+      {
+        chunkData[idx] = buffer[idx];
+      }
+    });
+  }
+  return 1;
+}
+
 // General templated function to read data of various types.
 template <class T>
 int vtkReadASCIIData(vtkDataReader* self, T* data, vtkIdType numTuples, vtkIdType numComp)
@@ -1627,7 +1692,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap2BERange(ptr, numTuples * numComp);
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
     else
     {
@@ -1643,7 +1708,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap2BERange((short*)ptr, numTuples * numComp);
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
     else
     {
@@ -1656,20 +1721,14 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     // currently writing vtkIdType as int.
     array = vtkIdTypeArray::New();
     array->SetNumberOfComponents(numComp);
-    std::vector<int> buffer(numTuples * numComp);
+    vtkIdType* ptr = ((vtkIdTypeArray*)array)->WritePointer(0, numTuples * numComp);
     if (this->FileType == VTK_BINARY)
     {
-      vtkReadBinaryData(this->IS, buffer.data(), numTuples, numComp);
-      vtkByteSwap::Swap4BERange(buffer.data(), numTuples * numComp);
+      vtkReadBinaryIdTypeData(this->IS, ptr, numTuples * numComp);
     }
     else
     {
-      vtkReadASCIIData(this, buffer.data(), numTuples, numComp);
-    }
-    vtkIdType* ptr2 = ((vtkIdTypeArray*)array)->WritePointer(0, numTuples * numComp);
-    for (vtkIdType idx = 0; idx < numTuples * numComp; idx++)
-    {
-      ptr2[idx] = buffer[idx];
+      vtkReadASCIIData(this, ptr, numTuples, numComp);
     }
   }
 
@@ -1681,7 +1740,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap4BERange(ptr, numTuples * numComp);
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
     else
     {
@@ -1697,7 +1756,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap4BERange((int*)ptr, numTuples * numComp);
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
     else
     {
@@ -1716,11 +1775,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-#if VTK_SIZEOF_LONG == 4
-      vtkByteSwap::Swap4BERange(ptr, numTuples * numComp);
-#else // VTK_SIZEOF_LONG == 8
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
-#endif
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
 
     else
@@ -1737,11 +1792,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-#if VTK_SIZEOF_LONG == 4
-      vtkByteSwap::Swap4BERange(ptr, numTuples * numComp);
-#else // VTK_SIZEOF_LONG == 8
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
-#endif
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
     else
     {
@@ -1757,7 +1808,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
 
     else
@@ -1774,7 +1825,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
 
     else
@@ -1791,7 +1842,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap4BERange(ptr, numTuples * numComp);
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
     else
     {
@@ -1807,7 +1858,7 @@ vtkAbstractArray* vtkDataReader::ReadArray(
     if (this->FileType == VTK_BINARY)
     {
       vtkReadBinaryData(this->IS, ptr, numTuples, numComp);
-      vtkByteSwap::Swap8BERange(ptr, numTuples * numComp);
+      vtkSwapBERangeInParallel(ptr, numTuples * numComp);
     }
     else
     {
@@ -3176,7 +3227,7 @@ int vtkDataReader::ReadCellsLegacy(vtkIdType size, int* data)
                     << " for file: " << (fname ? fname : "(Null FileName)"));
       return 0;
     }
-    vtkByteSwap::Swap4BERange(data, size);
+    vtkSwapBERangeInParallel(data, size);
   }
   else // ascii
   {
@@ -3228,7 +3279,7 @@ int vtkDataReader::ReadCellsLegacy(vtkIdType size, int* data, int skip1, int rea
                     << " for file: " << (fname ? fname : "(Null FileName)"));
       return 0;
     }
-    vtkByteSwap::Swap4BERange(tmp, size);
+    vtkSwapBERangeInParallel(tmp, size);
     if (tmp == data)
     {
       return 1;
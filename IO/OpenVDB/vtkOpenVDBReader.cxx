@@ -343,6 +343,77 @@ struct PopulateImageDataArray
   }
 };
 
+//------------------------------------------------------------------------
+// writes one OpenVDB value into a vtk tuple. Mirrors SamplerVdbGrid for
+// values coming from an iterator instead of an accessor.
+template <vtkIdType NComps, typename GridType, typename ArrayType>
+struct TupleWriterVdbValue
+{
+  static inline void WriteValue(const typename GridType::ValueType& vtkNotUsed(value),
+    ArrayType* vtkNotUsed(dataArray), vtkIdType vtkNotUsed(idx)){};
+};
+
+//------------------------------------------------------------------------
+template <typename GridType, typename ArrayType>
+struct TupleWriterVdbValue<1, GridType, ArrayType>
+{
+  static inline void WriteValue(
+    const typename GridType::ValueType& value, ArrayType* dataArray, vtkIdType idx)
+  {
+    dataArray->SetTuple1(idx, value);
+  }
+};
+
+//------------------------------------------------------------------------
+template <typename GridType, typename ArrayType>
+struct TupleWriterVdbValue<3, GridType, ArrayType>
+{
+  static inline void WriteValue(
+    const typename GridType::ValueType& value, ArrayType* dataArray, vtkIdType idx)
+  {
+    dataArray->SetTuple3(idx, value[0], value[1], value[2]);
+  }
+};
+
+//------------------------------------------------------------------------
+// functor to fill one point per active voxel of a grid, with the voxel
+// value in the corresponding vtk array. Active tiles are expanded into the
+// voxels they cover; inactive space is never visited nor materialized.
+struct PopulateActiveVoxels
+{
+  // points of the resulting point cloud
+  vtkPoints* Points = nullptr;
+
+  template <vtkIdType NComps, typename GridType, typename ArrayType>
+  void operator()(typename GridType::Ptr grid, ArrayType* dataArray)
+  {
+    if (grid == nullptr || dataArray == nullptr || this->Points == nullptr)
+    {
+      return;
+    }
+
+    const vtkIdType numVoxels = static_cast<vtkIdType>(grid->activeVoxelCount());
+    this->Points->SetNumberOfPoints(numVoxels);
+    dataArray->SetNumberOfTuples(numVoxels);
+
+    vtkIdType idx = 0;
+    for (auto iter = grid->tree().cbeginValueOn(); iter; ++iter)
+    {
+      const typename GridType::ValueType value = *iter;
+      // an iterator stop is either a single voxel or a constant active tile
+      openvdb::CoordBBox bbox;
+      iter.getBoundingBox(bbox);
+      for (auto coordIter = bbox.begin(); coordIter != bbox.end(); ++coordIter)
+      {
+        const openvdb::Vec3d world = grid->transform().indexToWorld((*coordIter).asVec3d());
+        this->Points->SetPoint(idx, world[0], world[1], world[2]);
+        ::TupleWriterVdbValue<NComps, GridType, ArrayType>::WriteValue(value, dataArray, idx);
+        idx++;
+      }
+    }
+  }
+};
+
 //------------------------------------------------------------------------
 vtkSmartPointer<vtkDataArray> InstanciateVtkArrayType(openvdb::GridBase::Ptr grid)
 {
@@ -977,6 +1048,15 @@ int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
     this->Internals->UpdateMissingGridInformation(gridInfo.Grid, &gridInfo);
   }
 
+  // in active-voxels-only mode the image grids bypass the densification
+  // below and are exported as point clouds of their active voxels,
+  // one partition per grid
+  std::vector<unsigned int> sparseGrids;
+  if (this->ActiveVoxelsOnly)
+  {
+    sparseGrids.swap(reqGridsImage);
+  }
+
   // now we construct the vtkResDataLeafInformation
   std::vector<vtkResDataLeafInformation> imgDatasetsInfo;
   std::vector<vtkResDataLeafInformation> pointsDatasetsInfo;
@@ -1057,8 +1137,9 @@ int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
-  // one block per vtkResDataLeafInformation
-  output->SetNumberOfPartitionedDataSets(imgDatasetsInfo.size() + pointsDatasetsInfo.size());
+  // one block per vtkResDataLeafInformation, plus one per sparse grid
+  output->SetNumberOfPartitionedDataSets(
+    imgDatasetsInfo.size() + pointsDatasetsInfo.size() + sparseGrids.size());
   for (unsigned int blockidx = 0; blockidx < output->GetNumberOfPartitionedDataSets(); blockidx++)
   {
     output->SetNumberOfPartitions(blockidx, 1);
@@ -1157,6 +1238,51 @@ int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
     polydataIdx++;
   }
 
+  // finally the active-voxel point clouds: one vertex per active voxel,
+  // carrying the voxel value in an array named after the grid
+  int numberPoints = pointsDatasetsInfo.size();
+  int sparseIdx = 0;
+  for (const unsigned int& gridIdx : sparseGrids)
+  {
+    OpenVDBGridInformation& gridInfo = this->Internals->GetGridInformation(gridIdx);
+
+    vtkSmartPointer<vtkDataArray> dataArray = ::InstanciateVtkArrayType(gridInfo.Grid);
+    if (!dataArray)
+    {
+      vtkErrorMacro(<< "Couldn't instantiate vtDataArray, unknown array type");
+      return 0;
+    }
+    dataArray->SetName(gridInfo.Name.c_str());
+    dataArray->SetNumberOfComponents(gridInfo.NumComps);
+
+    vtkNew<vtkPoints> points;
+    PopulateActiveVoxels populateVoxels;
+    populateVoxels.Points = points;
+    ::processTypedGridArray(gridInfo.Grid, dataArray, populateVoxels);
+
+    // only vertices, like the point cloud grids above
+    const vtkIdType numVertices = points->GetNumberOfPoints();
+    vtkNew<vtkCellArray> cells;
+    vtkNew<vtkIdTypeArray> vertices;
+    vtkIdType* rawVertices = new vtkIdType[2l * numVertices];
+    for (vtkIdType i = 0; i < numVertices; i++)
+    {
+      rawVertices[2 * i] = 1;
+      rawVertices[2 * i + 1] = i;
+    }
+    vertices->SetArray(rawVertices, 2l * numVertices, 0, vtkDataArray::VTK_DATA_ARRAY_DELETE);
+    cells->SetCells(numVertices, vertices);
+
+    vtkNew<vtkPolyData> polydata;
+    polydata->SetPoints(points);
+    polydata->SetVerts(cells);
+    polydata->GetPointData()->AddArray(dataArray);
+    polydata->GetPointData()->SetActiveScalars(gridInfo.Name.c_str());
+
+    output->SetPartition(numberImages + numberPoints + sparseIdx, 0, polydata);
+    sparseIdx++;
+  }
+
   return 1;
 }
 
@@ -1253,6 +1379,7 @@ void vtkOpenVDBReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DownsamplingFactor: " << this->DownsamplingFactor << endl;
   os << indent << "MergeImageVolumes: " << this->MergeImageVolumes << endl;
   os << indent << "MergePointSets: " << this->MergePointSets << endl;
+  os << indent << "ActiveVoxelsOnly: " << this->ActiveVoxelsOnly << endl;
   this->GridSelection->PrintSelf(os, indent.GetNextIndent());
 }
 VTK_ABI_NAMESPACE_END
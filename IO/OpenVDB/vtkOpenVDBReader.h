@@ -95,6 +95,21 @@ public:
   vtkBooleanMacro(MergePointSets, bool);
   ///@}
 
+  ///@{
+  /**
+   * When enabled, image volume grids are exported as point clouds of their
+   * active voxels instead of dense vtkImageData: one vtkPolyData vertex per
+   * active voxel, carrying the voxel value in a point data array named after
+   * the grid. For sparse grids this avoids materializing the empty space of
+   * the bounding box entirely. Each image grid gives its own vtkPolyData;
+   * MergeImageVolumes and DownsamplingFactor are not used in this mode.
+   * It is disabled by default.
+   */
+  vtkSetMacro(ActiveVoxelsOnly, bool);
+  vtkGetMacro(ActiveVoxelsOnly, bool);
+  vtkBooleanMacro(ActiveVoxelsOnly, bool);
+  ///@}
+
   ///@{
   /**
    * Standard interface to a vtkDataArraySelection object,
@@ -141,6 +156,7 @@ protected:
 
   bool MergeImageVolumes = false;
   bool MergePointSets = false;
+  bool ActiveVoxelsOnly = false;
 
   bool DataCorrect = true;
 
@@ -69,8 +69,11 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 
+#include "vtksys/SystemTools.hxx"
+
 #include <cctype>
 #include <cstring>
+#include <unordered_set>
 
 //------------------------------------------------------------------------------
 
@@ -144,36 +147,48 @@ inline int ProcessorsNumPieces(const int procTuple[])
 }
 #endif
 
-// Search and list processor subdirectories
+// List the "processor..." entries of an opened case directory without any
+// further checks. Statting and parsing the candidates is left to
+// ParseProcessorDirs so that each process can handle its own share of a
+// large decomposed case instead of the root process doing all of them.
+void ListCandidateProcessorDirs(vtkDirectory* dir, vtkStringArray* names)
+{
+  const vtkIdType nFiles = dir->GetNumberOfFiles();
+  for (vtkIdType filei = 0; filei < nFiles; ++filei)
+  {
+    const char* subdir = dir->GetFile(filei);
+    if (strncmp(subdir, "processor", 9) == 0)
+    {
+      names->InsertNextValue(subdir);
+    }
+  }
+}
+
+// Stat and parse the candidate processor subdirectories whose index matches
+// this process id, striding by the number of processes.
 // Detect collated and uncollated processor directories
 // - "processor(\d+)"
 // - "processors(\d+)"
 // - "processors(\d+)_(\d+)-(\d+)"
 //
 // string parsing logic as per fileOperation / parseProcsNumRange from OpenFOAM-v2012
-//
-// Return either collated or uncollated directories, never a mix.
-// Use the number of components to distinguish
-vtkSmartPointer<vtkIntArray> ScanForProcessorDirs(vtkDirectory* dir)
+void ParseProcessorDirs(const std::string& casePath, vtkStringArray* candidates, int processId,
+  int numProcesses, vtkIntArray* uncollated, vtkIntArray* collated)
 {
-  // Uncollated: save processor id
-  auto uncollated = vtkSmartPointer<vtkIntArray>::New();
-  uncollated->SetNumberOfComponents(1);
-
-  // Collated: save (processor count, first, size) tuple
-  auto collated = vtkSmartPointer<vtkIntArray>::New();
-  collated->SetNumberOfComponents(3);
+  std::string casePrefix(casePath);
+  if (!casePrefix.empty() && casePrefix.back() != '/')
+  {
+    casePrefix += '/';
+  }
 
-  // Sort keys for collated
-  vtkNew<vtkIntArray> collatedNums;
   int procTuple[3] = { 0, 0, 0 };
 
-  const vtkIdType nFiles = dir->GetNumberOfFiles();
-  for (vtkIdType filei = 0; filei < nFiles; ++filei)
+  const vtkIdType nCandidates = candidates->GetNumberOfValues();
+  for (vtkIdType filei = processId; filei < nCandidates; filei += numProcesses)
   {
-    const char* subdir = dir->GetFile(filei);
+    const char* subdir = candidates->GetValue(filei).c_str();
 
-    if (strncmp(subdir, "processor", 9) != 0 || !dir->FileIsDirectory(subdir))
+    if (!vtksys::SystemTools::FileIsDirectory(casePrefix + subdir))
     {
       continue;
     }
@@ -221,7 +236,6 @@ vtkSmartPointer<vtkIntArray> ScanForProcessorDirs(vtkDirectory* dir)
         procTuple[2] = 0;
 
         collated->InsertNextTypedTuple(procTuple);
-        collatedNums->InsertNextValue(nProcs);
         continue;
       }
 
@@ -269,14 +283,28 @@ vtkSmartPointer<vtkIntArray> ScanForProcessorDirs(vtkDirectory* dir)
         procTuple[2] = (lastProc - firstProc + 1);
 
         collated->InsertNextTypedTuple(procTuple);
-        collatedNums->InsertNextValue(nProcs);
       }
     }
   }
 
-  collatedNums->Squeeze();
   collated->Squeeze();
   uncollated->Squeeze();
+}
+
+// Merge the per-process parse results into the global piece table.
+//
+// Return either collated or uncollated directories, never a mix.
+// Use the number of components to distinguish
+vtkSmartPointer<vtkIntArray> SelectProcessorDirs(vtkIntArray* uncollated, vtkIntArray* collated)
+{
+  // Sort keys for collated
+  vtkNew<vtkIntArray> collatedNums;
+  const vtkIdType nCollatedTuples = collated->GetNumberOfTuples();
+  collatedNums->SetNumberOfValues(nCollatedTuples);
+  for (vtkIdType i = 0; i < nCollatedTuples; ++i)
+  {
+    collatedNums->SetValue(i, collated->GetTypedComponent(i, 0));
+  }
 
   vtkSortDataArray::Sort(uncollated);
   vtkSortDataArray::Sort(collatedNums, collated);
@@ -290,6 +318,7 @@ vtkSmartPointer<vtkIntArray> ScanForProcessorDirs(vtkDirectory* dir)
   std::cerr << " )\n";
 
   std::cerr << "processors (";
+  int procTuple[3];
   for (vtkIdType proci = 0; proci < collated->GetNumberOfTuples(); ++proci)
   {
     collated->GetTypedTuple(proci, procTuple);
@@ -473,51 +502,103 @@ int vtkPOpenFOAMReader::RequestInformation(
       this->Superclass::CasePath, "CasePath", masterCasePath);
 
     int nProcessorDirs = 0;
-    auto processorDirs = vtkSmartPointer<vtkIntArray>::New();
+    vtkSmartPointer<vtkIntArray> processorDirs;
     vtkStringArray* timeNames = nullptr;
     vtkDoubleArray* timeValues = nullptr;
 
+    // Only the root process lists the case directory. The candidate names are
+    // broadcast so that each process stats and parses its own share of the
+    // processor subdirectories instead of the root process doing all of them.
+    vtkNew<vtkStringArray> candidateDirs;
     if (isRootProc)
     {
-      do
+      vtkNew<vtkDirectory> dir;
+      if (!dir->Open(masterCasePath.c_str()))
       {
-        // Search and list processor subdirectories
-        vtkNew<vtkDirectory> dir;
-        if (!dir->Open(masterCasePath.c_str()))
-        {
-          vtkErrorMacro(<< "Cannot open " << masterCasePath);
-          returnCode = 0;
-          break; // Failed
-        }
+        vtkErrorMacro(<< "Cannot open " << masterCasePath);
+        returnCode = 0;
+      }
+      else
+      {
+        ::ListCandidateProcessorDirs(dir, candidateDirs);
+      }
+    }
+
+    if (isParallel)
+    {
+      this->Controller->Broadcast(&returnCode, 1, 0);
+
+      if (returnCode == 0)
+      {
+        // Error encountered in process 0 - abort all processes
+        vtkErrorMacro(<< "The master process returned an error.");
+        return 0;
+      }
+
+      this->Broadcast(candidateDirs);
+    }
+    else if (returnCode == 0)
+    {
+      // Error encountered (single process). Nothing to cleanup
+      return 0;
+    }
+
+    // Assemble the global piece table collectively
+    {
+      // Uncollated: save processor id
+      vtkNew<vtkIntArray> uncollated;
+      uncollated->SetNumberOfComponents(1);
+
+      // Collated: save (processor count, first, size) tuple
+      vtkNew<vtkIntArray> collated;
+      collated->SetNumberOfComponents(3);
+
+      ::ParseProcessorDirs(
+        masterCasePath, candidateDirs, this->ProcessId, this->NumProcesses, uncollated, collated);
+
+      if (isParallel)
+      {
+        vtkNew<vtkIntArray> allUncollated;
+        vtkNew<vtkIntArray> allCollated;
+        this->Controller->AllGatherV(uncollated, allUncollated);
+        this->Controller->AllGatherV(collated, allCollated);
+        processorDirs = ::SelectProcessorDirs(allUncollated, allCollated);
+      }
+      else
+      {
+        processorDirs = ::SelectProcessorDirs(uncollated, collated);
+      }
+    }
+    nProcessorDirs = static_cast<int>(processorDirs->GetNumberOfTuples());
+
+    if (isRootProc)
+    {
+      if (nProcessorDirs)
+      {
+        // Get times from the first processor subdirectory
+        const std::string procDirName = ::ProcessorDirName(processorDirs, 0);
+        vtkFoamDebug(<< "First processor dir: " << procDirName << "\n");
 
-        processorDirs = ::ScanForProcessorDirs(dir);
-        nProcessorDirs = static_cast<int>(processorDirs->GetNumberOfTuples());
+        auto masterReader = ::NewFoamReader(this);
 
-        if (nProcessorDirs)
+        if (!masterReader->MakeInformationVector(outputVector, procDirName) ||
+          !masterReader->MakeMetaDataAtTimeStep(true))
         {
-          // Get times from the first processor subdirectory
-          const std::string procDirName = ::ProcessorDirName(processorDirs, 0);
-          vtkFoamDebug(<< "First processor dir: " << procDirName << "\n");
-
-          auto masterReader = ::NewFoamReader(this);
-
-          if (!masterReader->MakeInformationVector(outputVector, procDirName) ||
-            !masterReader->MakeMetaDataAtTimeStep(true))
-          {
-            returnCode = 0;
-            break; // Failed
-          }
-          this->Superclass::Readers->AddItem(masterReader);
-          timeNames = masterReader->GetTimeNames();
-          timeValues = masterReader->GetTimeValues();
+          returnCode = 0; // Failed
         }
         else
         {
-          timeNames = vtkStringArray::New();
-          timeValues = vtkDoubleArray::New();
-          this->Superclass::SetTimeInformation(outputVector, timeValues);
+          this->Superclass::Readers->AddItem(masterReader);
+          timeNames = masterReader->GetTimeNames();
+          timeValues = masterReader->GetTimeValues();
         }
-      } while (false); // End of process 0 only execution scope
+      }
+      else
+      {
+        timeNames = vtkStringArray::New();
+        timeValues = vtkDoubleArray::New();
+        this->Superclass::SetTimeInformation(outputVector, timeValues);
+      }
     }
 
     if (isParallel)
@@ -537,22 +618,17 @@ int vtkPOpenFOAMReader::RequestInformation(
         timeValues = vtkDoubleArray::New();
       }
 
-      this->Controller->Broadcast(processorDirs, 0);
       this->Controller->Broadcast(timeValues, 0);
       this->Broadcast(timeNames);
       if (!isRootProc)
       {
         this->Superclass::SetTimeInformation(outputVector, timeValues);
       }
-      nProcessorDirs = static_cast<int>(processorDirs->GetNumberOfTuples());
     }
-    else
+    else if (returnCode == 0)
     {
-      if (returnCode == 0)
-      {
-        // Error encountered (single process). Nothing to cleanup
-        return 0;
-      }
+      // Error encountered (single process). Nothing to cleanup
+      return 0;
     }
 
     // Create reader instances for processor subdirectories,
@@ -861,11 +937,15 @@ void vtkPOpenFOAMReader::AllGather(vtkStringArray* sa)
 
   // Walk the set of nul-char delimited strings
   {
+    // Track the strings already seen; the linear LookupValue() per entry made
+    // the gather quadratic in the number of entries for large cases
+    std::unordered_set<std::string> seen;
+
     const char* name = allContents.data();
     for (int off = 0; off < totalLength; /*nil*/)
     {
       const int len = static_cast<int>(strlen(name)) + 1; // Trailing nul-char
-      if (sa->LookupValue(name) == -1)
+      if (seen.insert(name).second)
       {
         // Insert only when the same string is not found
         sa->InsertNextValue(name);
@@ -2,13 +2,24 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkXMLPUnstructuredDataWriter.h"
 
+#include "vtkAppendFilter.h"
+#include "vtkAppendPolyData.h"
+#include "vtkCallbackCommand.h"
 #include "vtkErrorCode.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkPointSet.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkXMLUnstructuredDataWriter.h"
 
+#include <vtksys/SystemTools.hxx>
+
+#include <vector>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkXMLPUnstructuredDataWriter::vtkXMLPUnstructuredDataWriter() = default;
@@ -20,6 +31,7 @@ vtkXMLPUnstructuredDataWriter::~vtkXMLPUnstructuredDataWriter() = default;
 void vtkXMLPUnstructuredDataWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfFiles: " << this->NumberOfFiles << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -39,6 +51,131 @@ vtkXMLWriter* vtkXMLPUnstructuredDataWriter::CreatePieceWriter(int index)
   return pWriter;
 }
 
+//------------------------------------------------------------------------------
+int vtkXMLPUnstructuredDataWriter::WritePieceInternal()
+{
+  vtkMultiProcessController* controller = this->GetController();
+  const int numRanks = controller ? controller->GetNumberOfProcesses() : 1;
+  if (this->NumberOfFiles <= 0 || this->NumberOfFiles >= numRanks ||
+    this->StartPiece != this->EndPiece)
+  {
+    return this->Superclass::WritePieceInternal();
+  }
+
+  // Split the ranks into NumberOfFiles contiguous groups. Every group
+  // gathers its pieces to its first rank, which writes them out merged as
+  // one larger piece file whose index in the summary file is the group
+  // index.
+  const int myRank = controller->GetLocalProcessId();
+  const int group = myRank * this->NumberOfFiles / numRanks;
+
+  vtkSmartPointer<vtkMultiProcessController> groupController =
+    vtk::TakeSmartPointer(controller->PartitionController(group, myRank));
+  if (!groupController)
+  {
+    vtkErrorMacro("Failed to partition the controller into writer groups.");
+    return 0;
+  }
+
+  std::vector<vtkSmartPointer<vtkDataObject>> pieces;
+  if (!groupController->Gather(this->GetInputAsPointSet(), pieces, 0))
+  {
+    vtkErrorMacro("Failed to gather pieces onto the writer rank.");
+    return 0;
+  }
+
+  if (groupController->GetLocalProcessId() != 0)
+  {
+    // This rank's piece is written by the first rank of the group.
+    return 1;
+  }
+
+  // Merge the gathered pieces, skipping empty ones. The appropriate append
+  // filter keeps the data type expected by the piece writer.
+  vtkSmartPointer<vtkPointSet> merged;
+  if (vtkPolyData::SafeDownCast(this->GetInputAsPointSet()))
+  {
+    vtkNew<vtkAppendPolyData> append;
+    for (const auto& piece : pieces)
+    {
+      vtkPolyData* pd = vtkPolyData::SafeDownCast(piece);
+      if (pd && (pd->GetNumberOfPoints() > 0 || pd->GetNumberOfCells() > 0))
+      {
+        append->AddInputData(pd);
+      }
+    }
+    if (append->GetNumberOfInputConnections(0) > 0)
+    {
+      append->Update();
+      merged = append->GetOutput();
+    }
+  }
+  else
+  {
+    vtkNew<vtkAppendFilter> append;
+    for (const auto& piece : pieces)
+    {
+      vtkDataSet* ds = vtkDataSet::SafeDownCast(piece);
+      if (ds && (ds->GetNumberOfPoints() > 0 || ds->GetNumberOfCells() > 0))
+      {
+        append->AddInputData(ds);
+      }
+    }
+    if (append->GetNumberOfInputConnections(0) > 0)
+    {
+      append->Update();
+      merged = append->GetOutput();
+    }
+  }
+
+  if (!merged)
+  {
+    // The whole group is empty; nothing to write.
+    return 1;
+  }
+
+  // Write the merged piece the same way WritePiece() writes a single one.
+  vtkXMLUnstructuredDataWriter* pWriter = this->CreateUnstructuredPieceWriter();
+  pWriter->SetInputDataObject(merged);
+  pWriter->AddObserver(vtkCommand::ProgressEvent, this->InternalProgressObserver);
+
+  char* fileName = this->CreatePieceFileName(group, this->PathName);
+  std::string path = vtksys::SystemTools::GetParentDirectory(fileName);
+  if (!path.empty() && !vtksys::SystemTools::PathExists(path))
+  {
+    vtksys::SystemTools::MakeDirectory(path);
+  }
+  pWriter->SetFileName(fileName);
+
+  // Copy the writer settings.
+  pWriter->SetDebug(this->Debug);
+  pWriter->SetCompressor(this->Compressor);
+  pWriter->SetDataMode(this->DataMode);
+  pWriter->SetByteOrder(this->ByteOrder);
+  pWriter->SetEncodeAppendedData(this->EncodeAppendedData);
+  pWriter->SetHeaderType(this->HeaderType);
+  pWriter->SetBlockSize(this->BlockSize);
+  pWriter->SetWriteTimeValue(this->GetWriteTimeValue());
+
+  int result = pWriter->Write();
+  this->SetErrorCode(pWriter->GetErrorCode());
+
+  pWriter->RemoveObserver(this->InternalProgressObserver);
+  pWriter->Delete();
+
+  if (!result)
+  {
+    vtkErrorMacro("Ran out of disk space; deleting file(s) already written");
+    this->DeleteAFile(fileName);
+    delete[] fileName;
+    return 0;
+  }
+  delete[] fileName;
+
+  this->PieceWrittenFlags[group] = static_cast<unsigned char>(0x1);
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 void vtkXMLPUnstructuredDataWriter::WritePData(vtkIndent indent)
 {
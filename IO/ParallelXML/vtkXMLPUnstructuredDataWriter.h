@@ -25,6 +25,22 @@ public:
   vtkTypeMacro(vtkXMLPUnstructuredDataWriter, vtkXMLPDataWriter);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  ///@{
+  /**
+   * Get/Set the number of piece files to produce when running distributed.
+   * When 0 (default), every piece is written to its own file, matching the
+   * historical behavior. When positive, the ranks are split into that many
+   * contiguous groups; each group gathers its pieces to one writer rank
+   * over the controller, which writes them merged as a single larger piece
+   * file, and the summary file references only the group files. This keeps
+   * the file count -- and with it the metadata load on parallel file
+   * systems -- independent of the number of ranks. Only used when every
+   * rank writes exactly one piece (StartPiece == EndPiece).
+   */
+  vtkSetClampMacro(NumberOfFiles, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfFiles, int);
+  ///@}
+
 protected:
   vtkXMLPUnstructuredDataWriter();
   ~vtkXMLPUnstructuredDataWriter() override;
@@ -33,6 +49,9 @@ protected:
   virtual vtkXMLUnstructuredDataWriter* CreateUnstructuredPieceWriter() = 0;
   vtkXMLWriter* CreatePieceWriter(int index) override;
   void WritePData(vtkIndent indent) override;
+  int WritePieceInternal() override;
+
+  int NumberOfFiles = 0;
 
 private:
   vtkXMLPUnstructuredDataWriter(const vtkXMLPUnstructuredDataWriter&) = delete;
@@ -10,6 +10,7 @@
 
 #include "vtkSQLiteDatabase.h"
 
+#include "vtkAutoInit.h"
 #include "vtkObjectFactory.h"
 #include "vtkStdString.h"
 
@@ -352,6 +353,12 @@ vtkSQLDatabase* vtkSQLDatabase::CreateFromURL(const char* URL)
   std::string dataglom;
   vtkSQLDatabase* db = nullptr;
 
+  // The MySQL, PostgreSQL and ODBC modules register their callback from their
+  // VTK_MODULE_AUTOINIT construct function, and those constructs are deferred
+  // until the first factory lookup. Run any still-pending constructs so the
+  // callback list is populated before it is consulted below.
+  vtkAutoInitFlushDeferredConstructs();
+
   static std::mutex dbURLCritSec;
   dbURLCritSec.lock();
 
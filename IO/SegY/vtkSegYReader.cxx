@@ -7,6 +7,7 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSegYIOUtils.h"
 #include "vtkSegYReaderInternal.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -15,6 +16,7 @@
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <string>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSegYReader);
@@ -27,6 +29,7 @@ vtkSegYReader::vtkSegYReader()
   this->FileName = nullptr;
   this->Is3D = false;
   this->Force2D = false;
+  this->StreamingMode = false;
   std::fill(this->DataOrigin, this->DataOrigin + 3, 0.0);
   std::fill(this->DataSpacing[0], this->DataSpacing[0] + 3, 1.0);
   std::fill(this->DataSpacing[1], this->DataSpacing[1] + 3, 1.0);
@@ -113,16 +116,29 @@ int vtkSegYReader::RequestData(vtkInformation* vtkNotUsed(request),
       return 1;
     }
   }
-  this->Reader->LoadTraces(this->DataExtent);
-  this->UpdateProgress(0.5);
   if (this->Is3D && !this->StructuredGrid)
   {
     vtkImageData* imageData = vtkImageData::SafeDownCast(output);
-    this->Reader->ExportData(
-      imageData, this->DataExtent, this->DataOrigin, this->DataSpacing, this->DataSpacingSign);
+    if (this->StreamingMode)
+    {
+      // read only the traces covered by the requested extent
+      int updateExtent[6];
+      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent);
+      this->Reader->ExportSubVolume(imageData, updateExtent, this->DataExtent, this->DataOrigin,
+        this->DataSpacing, this->DataSpacingSign);
+    }
+    else
+    {
+      this->Reader->LoadTraces(this->DataExtent);
+      this->UpdateProgress(0.5);
+      this->Reader->ExportData(
+        imageData, this->DataExtent, this->DataOrigin, this->DataSpacing, this->DataSpacingSign);
+    }
   }
   else
   {
+    this->Reader->LoadTraces(this->DataExtent);
+    this->UpdateProgress(0.5);
     vtkStructuredGrid* grid = vtkStructuredGrid::SafeDownCast(output);
     this->Reader->ExportData(grid, this->DataExtent, this->DataOrigin, this->DataSpacing);
     grid->Squeeze();
@@ -149,6 +165,10 @@ int vtkSegYReader::RequestInformation(vtkInformation* vtkNotUsed(request),
       vtkMath::Norm(this->DataSpacing[2]) };
     outInfo->Set(vtkDataObject::ORIGIN(), this->DataOrigin, 3);
     outInfo->Set(vtkDataObject::SPACING(), spacing, 3);
+    if (this->StreamingMode)
+    {
+      outInfo->Set(vtkAlgorithm::CAN_PRODUCE_SUB_EXTENT(), 1);
+    }
   }
   return 1;
 }
@@ -179,8 +199,28 @@ int vtkSegYReader::RequestDataObject(vtkInformation*,
     vtkErrorMacro("File not found:" << this->FileName);
     return 0;
   }
-  this->Is3D = this->Reader->Is3DComputeParameters(
-    this->DataExtent, this->DataOrigin, this->DataSpacing, this->DataSpacingSign, this->Force2D);
+  bool haveIndex = false;
+  std::string indexFileName;
+  std::streamoff fileSize = 0;
+  if (this->StreamingMode)
+  {
+    indexFileName = std::string(this->FileName) + ".tridx";
+    fileSize = vtkSegYIOUtils::Instance()->getFileSize(this->Reader->In);
+    haveIndex = this->Reader->ReadTraceIndex(indexFileName, fileSize, this->DataExtent,
+      this->DataOrigin, this->DataSpacing, this->DataSpacingSign, this->Is3D);
+  }
+  if (!haveIndex)
+  {
+    this->Is3D = this->Reader->Is3DComputeParameters(
+      this->DataExtent, this->DataOrigin, this->DataSpacing, this->DataSpacingSign, this->Force2D);
+    if (this->StreamingMode)
+    {
+      // best effort; if the sidecar cannot be written the scan runs again
+      // on the next open
+      this->Reader->WriteTraceIndex(indexFileName, fileSize, this->DataExtent, this->DataOrigin,
+        this->DataSpacing, this->DataSpacingSign, this->Is3D);
+    }
+  }
   const char* outputTypeName =
     (this->Is3D && !this->StructuredGrid) ? "vtkImageData" : "vtkStructuredGrid";
 
@@ -108,6 +108,22 @@ public:
   vtkBooleanMacro(StructuredGrid, int);
   ///@}
 
+  ///@{
+  /**
+   * Stream 3D volumes instead of loading them whole. In this mode the
+   * one-time header scan builds a trace-offset index that is persisted
+   * next to the data file (FileName plus a ".tridx" suffix) and reused on
+   * subsequent opens as long as the data file size is unchanged, and only
+   * the traces inside the requested update extent are read from disk.
+   * Writing the sidecar is best effort; a read-only location simply means
+   * the scan runs again next time. Only used for 3D data with
+   * StructuredGrid off, otherwise it is ignored. The default is false.
+   */
+  vtkSetMacro(StreamingMode, bool);
+  vtkGetMacro(StreamingMode, bool);
+  vtkBooleanMacro(StreamingMode, bool);
+  ///@}
+
   ///@{
   /**
    * Should we force the data to be interpreted as a 2D dataset? It may be a
@@ -149,6 +165,8 @@ protected:
 
   bool Force2D;
 
+  bool StreamingMode;
+
 private:
   vtkSegYReader(const vtkSegYReader&) = delete;
   void operator=(const vtkSegYReader&) = delete;
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <iostream>
 #include <iterator>
 #include <map>
@@ -25,6 +26,7 @@ VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
 const int FIRST_TRACE_START_POS = 3600; // this->Traces start after 3200 + 400 file header
+const char TRACE_INDEX_MAGIC[8] = { 'S', 'e', 'g', 'Y', 'I', 'd', 'x', '1' };
 double decodeMultiplier(short multiplier)
 {
   return (multiplier < 0) ? (-1.0 / multiplier) : (multiplier > 0 ? multiplier : 1.0);
@@ -91,6 +93,29 @@ void vtkSegYReaderInternal::LoadTraces(int* extent)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkSegYReaderInternal::BuildTraceIndex(const std::vector<std::streamoff>& offsets,
+  const std::vector<int>& inlineNumbers, const std::vector<int>& crosslineNumbers, int* extent)
+{
+  // position the offsets exactly the way LoadTraces positions the traces
+  int dims[3] = { extent[1] - extent[0] + 1, extent[3] - extent[2] + 1, extent[5] - extent[4] + 1 };
+  bool is3d = extent[3] - extent[2] > 1;
+  this->TraceOffsets.assign(static_cast<size_t>(dims[0]) * dims[1], -1);
+  for (size_t traceCount = 0; traceCount < offsets.size(); ++traceCount)
+  {
+    size_t loc = traceCount;
+    if (is3d)
+    {
+      loc = crosslineNumbers[traceCount] - extent[0] +
+        static_cast<size_t>(inlineNumbers[traceCount] - extent[2]) * dims[0];
+    }
+    if (loc < this->TraceOffsets.size())
+    {
+      this->TraceOffsets[loc] = offsets[traceCount];
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 bool vtkSegYReaderInternal::ReadHeader()
 {
@@ -116,14 +141,23 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
 
   size_t traceCount = 0;
 
+  // record the file offset and position of every trace while scanning the
+  // headers, so that ExportSubVolume can later seek straight to any trace
+  std::vector<std::streamoff> traceOffsets;
+  std::vector<int> inlineNumbers;
+  std::vector<int> crosslineNumbers;
+
   // for the forced 2D case we ignore lines/crosslines and just stitch together the
   // traces in order applying their x,y coordinates
   if (force2D)
   {
     while (traceStartPos + 240 < fileSize)
     {
+      traceOffsets.push_back(traceStartPos);
       this->TraceReader->ReadInlineCrossline(traceStartPos, this->In, this->FormatCode,
         &inlineNumber, &crosslineNumber, &xCoord, &yCoord, &coordMultiplier);
+      inlineNumbers.push_back(inlineNumber);
+      crosslineNumbers.push_back(crosslineNumber);
       traceCount++;
     }
     extent[0] = 0;
@@ -132,6 +166,7 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
     extent[3] = 0;
     extent[4] = 0;
     extent[5] = this->SampleCountPerTrace - 1;
+    this->BuildTraceIndex(traceOffsets, inlineNumbers, crosslineNumbers, extent);
     return false;
   }
 
@@ -149,8 +184,11 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
 
   while (traceStartPos + 240 < fileSize)
   {
+    traceOffsets.push_back(traceStartPos);
     this->TraceReader->ReadInlineCrossline(traceStartPos, this->In, this->FormatCode, &inlineNumber,
       &crosslineNumber, &xCoord, &yCoord, &coordMultiplier);
+    inlineNumbers.push_back(inlineNumber);
+    crosslineNumbers.push_back(crosslineNumber);
     traceCount++;
     double coordinateMultiplier = decodeMultiplier(coordMultiplier);
 
@@ -229,8 +267,10 @@ bool vtkSegYReaderInternal::Is3DComputeParameters(
       extent[0] = 0;
       extent[1] = static_cast<int>(traceCount) - 1;
     }
+    this->BuildTraceIndex(traceOffsets, inlineNumbers, crosslineNumbers, extent);
     return false;
   }
+  this->BuildTraceIndex(traceOffsets, inlineNumbers, crosslineNumbers, extent);
 
   // compute the mapping of indices into coords if we have three
   if (basisPointCount == 3)
@@ -367,4 +407,142 @@ void vtkSegYReaderInternal::ExportData(
   grid->SetPoints(points);
   grid->GetPointData()->SetScalars(scalars);
 }
+
+//------------------------------------------------------------------------------
+void vtkSegYReaderInternal::ExportSubVolume(vtkImageData* imageData, int* updateExtent,
+  int* wholeExtent, double origin[3], double spacing[3][3], int* spacingSign)
+{
+  imageData->SetExtent(updateExtent);
+  imageData->SetOrigin(origin);
+  imageData->SetSpacing(
+    vtkMath::Norm(spacing[0]), vtkMath::Norm(spacing[1]), vtkMath::Norm(spacing[2]));
+  int dims[3] = { updateExtent[1] - updateExtent[0] + 1, updateExtent[3] - updateExtent[2] + 1,
+    updateExtent[5] - updateExtent[4] + 1 };
+  size_t wholeDim0 = static_cast<size_t>(wholeExtent[1] - wholeExtent[0] + 1);
+
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetNumberOfComponents(1);
+  scalars->SetNumberOfTuples(static_cast<vtkIdType>(dims[0]) * dims[1] * dims[2]);
+  scalars->SetName("trace");
+  imageData->GetPointData()->SetScalars(scalars);
+
+  // one trace is resident at a time, so only the requested sub-extent of a
+  // large survey is ever read from disk
+  vtkSegYTrace trace;
+  for (int j = updateExtent[2]; j <= updateExtent[3]; ++j)
+  {
+    int destJ = (spacingSign[1] > 0 ? j - wholeExtent[2] : wholeExtent[3] - j);
+    for (int i = updateExtent[0]; i <= updateExtent[1]; ++i)
+    {
+      int destI = (spacingSign[0] > 0 ? i - wholeExtent[0] : wholeExtent[1] - i);
+      std::streamoff offset = -1;
+      size_t loc = destJ * wholeDim0 + destI;
+      if (loc < this->TraceOffsets.size())
+      {
+        offset = this->TraceOffsets[loc];
+      }
+      trace.Data.clear();
+      if (offset >= 0)
+      {
+        this->TraceReader->ReadTrace(offset, this->In, this->FormatCode, &trace);
+      }
+      vtkIdType id = static_cast<vtkIdType>(j - updateExtent[2]) * dims[0] + (i - updateExtent[0]);
+      for (int k = updateExtent[4]; k <= updateExtent[5]; ++k)
+      {
+        int destK = (spacingSign[2] > 0 ? k - wholeExtent[4] : wholeExtent[5] - k);
+        scalars->SetValue(
+          id, destK < static_cast<int>(trace.Data.size()) ? trace.Data[destK] : 0.0f);
+        id += static_cast<vtkIdType>(dims[0]) * dims[1];
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkSegYReaderInternal::ReadTraceIndex(const std::string& indexFileName,
+  std::streamoff dataFileSize, int* extent, double origin[3], double spacing[3][3],
+  int* spacingSign, bool& is3d)
+{
+  vtksys::ifstream in(indexFileName.c_str(), std::ios::binary);
+  if (!in)
+  {
+    return false;
+  }
+  char magic[8];
+  in.read(magic, sizeof(magic));
+  if (!in || !std::equal(magic, magic + sizeof(magic), TRACE_INDEX_MAGIC))
+  {
+    return false;
+  }
+  std::int64_t fileSize = 0;
+  in.read(reinterpret_cast<char*>(&fileSize), sizeof(fileSize));
+  if (!in || fileSize != static_cast<std::int64_t>(dataFileSize))
+  {
+    // the survey changed since the index was built
+    return false;
+  }
+  in.read(reinterpret_cast<char*>(extent), 6 * sizeof(int));
+  in.read(reinterpret_cast<char*>(origin), 3 * sizeof(double));
+  in.read(reinterpret_cast<char*>(spacing), 9 * sizeof(double));
+  in.read(reinterpret_cast<char*>(spacingSign), 3 * sizeof(int));
+  std::int32_t is3dFlag = 0;
+  in.read(reinterpret_cast<char*>(&is3dFlag), sizeof(is3dFlag));
+  std::int64_t count = 0;
+  in.read(reinterpret_cast<char*>(&count), sizeof(count));
+  std::int64_t expected =
+    static_cast<std::int64_t>(extent[1] - extent[0] + 1) * (extent[3] - extent[2] + 1);
+  if (!in || count != expected)
+  {
+    return false;
+  }
+  std::vector<std::streamoff> offsets(static_cast<size_t>(count));
+  for (std::int64_t t = 0; t < count; ++t)
+  {
+    std::int64_t value = 0;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    offsets[static_cast<size_t>(t)] = static_cast<std::streamoff>(value);
+  }
+  if (!in)
+  {
+    return false;
+  }
+  // the binary header is still parsed from the data file for the sample format
+  this->ReadHeader();
+  this->TraceOffsets.swap(offsets);
+  is3d = (is3dFlag != 0);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkSegYReaderInternal::WriteTraceIndex(const std::string& indexFileName,
+  std::streamoff dataFileSize, int* extent, double origin[3], double spacing[3][3],
+  int* spacingSign, bool is3d)
+{
+  if (this->TraceOffsets.empty())
+  {
+    return false;
+  }
+  vtksys::ofstream out(indexFileName.c_str(), std::ios::binary);
+  if (!out)
+  {
+    return false;
+  }
+  out.write(TRACE_INDEX_MAGIC, sizeof(TRACE_INDEX_MAGIC));
+  std::int64_t fileSize = dataFileSize;
+  out.write(reinterpret_cast<const char*>(&fileSize), sizeof(fileSize));
+  out.write(reinterpret_cast<const char*>(extent), 6 * sizeof(int));
+  out.write(reinterpret_cast<const char*>(origin), 3 * sizeof(double));
+  out.write(reinterpret_cast<const char*>(spacing), 9 * sizeof(double));
+  out.write(reinterpret_cast<const char*>(spacingSign), 3 * sizeof(int));
+  std::int32_t is3dFlag = is3d ? 1 : 0;
+  out.write(reinterpret_cast<const char*>(&is3dFlag), sizeof(is3dFlag));
+  std::int64_t count = static_cast<std::int64_t>(this->TraceOffsets.size());
+  out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+  for (std::streamoff offset : this->TraceOffsets)
+  {
+    std::int64_t value = static_cast<std::int64_t>(offset);
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+  return out.good();
+}
 VTK_ABI_NAMESPACE_END
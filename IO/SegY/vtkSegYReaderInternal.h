@@ -35,6 +35,25 @@ public:
     vtkImageData*, int* extent, double origin[3], double spacing[3][3], int* spacingSign);
   void ExportData(vtkStructuredGrid*, int* extent, double origin[3], double spacing[3][3]);
 
+  // Read traces intersecting updateExtent directly from the file, one trace
+  // at a time, using the trace-offset index built by Is3DComputeParameters
+  // or loaded by ReadTraceIndex. Only valid for 3D volumes.
+  void ExportSubVolume(vtkImageData*, int* updateExtent, int* wholeExtent, double origin[3],
+    double spacing[3][3], int* spacingSign);
+
+  ///@{
+  /**
+   * Persist/restore the trace-offset index and the volume parameters in a
+   * sidecar file so that subsequent opens of a large survey can skip the
+   * full header scan. The stored data file size is used to detect a stale
+   * index. Both return true on success.
+   */
+  bool ReadTraceIndex(const std::string& indexFileName, std::streamoff dataFileSize, int* extent,
+    double origin[3], double spacing[3][3], int* spacingSign, bool& is3d);
+  bool WriteTraceIndex(const std::string& indexFileName, std::streamoff dataFileSize, int* extent,
+    double origin[3], double spacing[3][3], int* spacingSign, bool is3d);
+  ///@}
+
   void SetXYCoordBytePositions(int x, int y);
   void SetVerticalCRS(int);
 
@@ -42,9 +61,14 @@ public:
 
 protected:
   bool ReadHeader();
+  void BuildTraceIndex(const std::vector<std::streamoff>& offsets,
+    const std::vector<int>& inlineNumbers, const std::vector<int>& crosslineNumbers, int* extent);
 
 private:
   std::vector<vtkSegYTrace*> Traces;
+  // File offset of the trace at each (crossline, inline) location, -1 where
+  // a trace is missing. Laid out the same way as Traces.
+  std::vector<std::streamoff> TraceOffsets;
   vtkSegYBinaryHeaderBytesPositions* BinaryHeaderBytesPos;
   vtkSegYTraceReader* TraceReader;
   int VerticalCRS;
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellType.h"
+#include "vtkCellTypeSource.h"
+#include "vtkDataArray.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkXMLUnstructuredGridReader.h"
+#include "vtkXMLUnstructuredGridWriter.h"
+
+#include "vtkTestUtilities.h"
+#include <string>
+
+// Read back a raw appended data file both with and without
+// MemoryMapAppendedData and verify that the memory mapped arrays hold the
+// same values, and that modifying a mapped array does not change the file.
+int TestXMLMemoryMapAppendedData(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string fileName(tempDir);
+  delete[] tempDir;
+
+  fileName += "/XMLMemoryMapAppendedData.vtu";
+
+  int blocksDimensions[] = { 10, 10, 10 };
+  vtkSmartPointer<vtkCellTypeSource> cellSource = vtkSmartPointer<vtkCellTypeSource>::New();
+  cellSource->SetBlocksDimensions(blocksDimensions);
+  cellSource->SetCellType(VTK_TETRA);
+  cellSource->SetOutputPrecision(vtkAlgorithm::DOUBLE_PRECISION);
+  cellSource->Update();
+
+  // Write raw (not base64 encoded), uncompressed appended data so the
+  // arrays qualify for memory mapping.
+  vtkSmartPointer<vtkXMLUnstructuredGridWriter> writer =
+    vtkSmartPointer<vtkXMLUnstructuredGridWriter>::New();
+  writer->SetInputData(cellSource->GetOutput());
+  writer->SetFileName(fileName.c_str());
+  writer->SetDataModeToAppended();
+  writer->EncodeAppendedDataOff();
+  writer->SetCompressorTypeToNone();
+  writer->Write();
+
+  vtkSmartPointer<vtkXMLUnstructuredGridReader> reader =
+    vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  vtkUnstructuredGrid* grid = reader->GetOutput();
+
+  vtkSmartPointer<vtkXMLUnstructuredGridReader> mappedReader =
+    vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
+  mappedReader->SetFileName(fileName.c_str());
+  mappedReader->MemoryMapAppendedDataOn();
+  mappedReader->Update();
+  vtkUnstructuredGrid* mappedGrid = mappedReader->GetOutput();
+
+  if (grid->GetNumberOfPoints() != mappedGrid->GetNumberOfPoints() ||
+    grid->GetNumberOfCells() != mappedGrid->GetNumberOfCells())
+  {
+    std::cerr << "Memory mapped read produced a different grid size." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkDataArray* coords = grid->GetPoints()->GetData();
+  vtkDataArray* mappedCoords = mappedGrid->GetPoints()->GetData();
+  for (vtkIdType i = 0; i < coords->GetNumberOfTuples(); ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      if (coords->GetComponent(i, j) != mappedCoords->GetComponent(i, j))
+      {
+        std::cerr << "Memory mapped point " << i << " differs." << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  for (int a = 0; a < grid->GetPointData()->GetNumberOfArrays(); ++a)
+  {
+    vtkDataArray* array = grid->GetPointData()->GetArray(a);
+    vtkDataArray* mappedArray = mappedGrid->GetPointData()->GetArray(array->GetName());
+    if (!mappedArray || mappedArray->GetNumberOfValues() != array->GetNumberOfValues())
+    {
+      std::cerr << "Memory mapped read lost point data array " << array->GetName() << std::endl;
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType i = 0; i < array->GetNumberOfValues(); ++i)
+    {
+      if (array->GetComponent(i, 0) != mappedArray->GetComponent(i, 0))
+      {
+        std::cerr << "Memory mapped array " << array->GetName() << " differs at value " << i
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // The mapping is copy-on-write: scribbling over a mapped array must not
+  // leak through to the file.
+  for (vtkIdType i = 0; i < mappedCoords->GetNumberOfTuples(); ++i)
+  {
+    mappedCoords->SetComponent(i, 0, -1.0);
+  }
+  vtkSmartPointer<vtkXMLUnstructuredGridReader> checkReader =
+    vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
+  checkReader->SetFileName(fileName.c_str());
+  checkReader->Update();
+  vtkDataArray* checkCoords = checkReader->GetOutput()->GetPoints()->GetData();
+  for (vtkIdType i = 0; i < coords->GetNumberOfTuples(); ++i)
+  {
+    if (checkCoords->GetComponent(i, 0) != coords->GetComponent(i, 0))
+    {
+      std::cerr << "Modifying a memory mapped array changed the file." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
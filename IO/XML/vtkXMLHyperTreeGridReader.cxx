@@ -727,7 +727,31 @@ void vtkXMLHyperTreeGridReader::ReadTrees_1(vtkXMLDataElement* elem)
     eTree->GetScalarAttribute("NumberOfLevels", numberOfLevels);
     eTree->GetScalarAttribute("NumberOfVertices", numberOfVertices);
 
-    // Descriptor for hypertree
+    // Parse the per-level vertex counts first: when a depth limit is active
+    // they tell how many descriptor and mask values the requested levels
+    // span, so only those bytes need to be read below.
+    vtkXMLDataElement* nbVerticesByLevelElement =
+      eTree->FindNestedElementWithNameAndAttribute("DataArray", "Name", "NbVerticesByLevel");
+    vtkSmartPointer<vtkDataArray> nbVerticesByLevelArray = nullptr;
+    if (nbVerticesByLevelElement)
+    {
+      nbVerticesByLevelArray = vtkSmartPointer<vtkDataArray>::Take(
+        vtkArrayDownCast<vtkDataArray>(this->CreateArray(nbVerticesByLevelElement)));
+      vtkIdType numberOfNodes = 0;
+      nbVerticesByLevelElement->GetScalarAttribute("NumberOfTuples", numberOfNodes);
+      nbVerticesByLevelArray->SetNumberOfTuples(numberOfNodes);
+      this->ReadArrayValues(nbVerticesByLevelElement, 0, nbVerticesByLevelArray, 0, numberOfNodes);
+    }
+    AccImpl accFunctor(this->GetFixedLevelOfThisHT(numberOfLevels, treeIndxInHTG));
+    if (!vtkArrayDispatch::Dispatch::Execute(nbVerticesByLevelArray, accFunctor))
+    {
+      cerr << "Should not happen: could not dispatch nbVerticesByLevel array" << endl;
+      cerr << "Falling back to vtkDataArray, can pose problems on windows" << endl;
+      accFunctor(nbVerticesByLevelArray.GetPointer());
+    }
+
+    // Descriptor for hypertree. Rebuilding the kept levels only consumes the
+    // bits describing their non-deepest vertices, so stop reading there.
     vtkXMLDataElement* desc_e =
       eTree->FindNestedElementWithNameAndAttribute("DataArray", "Name", "Descriptor");
     vtkSmartPointer<vtkAbstractArray> desc_a =
@@ -740,6 +764,8 @@ void vtkXMLHyperTreeGridReader::ReadTrees_1(vtkXMLDataElement* elem)
     vtkIdType descSize = 0;
     vtkBitArray* desc = nullptr;
     desc_e->GetScalarAttribute("NumberOfTuples", descSize);
+    descSize = std::min(
+      descSize, static_cast<vtkIdType>(accFunctor.FixedNbVertices - accFunctor.LimitedLevelElement));
     if (descSize)
     {
       desc_d->SetNumberOfTuples(descSize);
@@ -771,6 +797,8 @@ void vtkXMLHyperTreeGridReader::ReadTrees_1(vtkXMLDataElement* elem)
         vtkArrayDownCast<vtkBitArray>(this->CreateArray(maskElement)));
       vtkIdType numberOfNodes = 0;
       maskElement->GetScalarAttribute("NumberOfTuples", numberOfNodes);
+      // Only the kept vertices are masked; the rest defaults to false.
+      numberOfNodes = std::min(numberOfNodes, static_cast<vtkIdType>(accFunctor.FixedNbVertices));
       maskArray->SetNumberOfTuples(numberOfNodes);
       this->ReadArrayValues(maskElement, 0, maskArray, 0, numberOfNodes);
 
@@ -781,25 +809,6 @@ void vtkXMLHyperTreeGridReader::ReadTrees_1(vtkXMLDataElement* elem)
       }
     }
 
-    vtkXMLDataElement* nbVerticesByLevelElement =
-      eTree->FindNestedElementWithNameAndAttribute("DataArray", "Name", "NbVerticesByLevel");
-    vtkSmartPointer<vtkDataArray> nbVerticesByLevelArray = nullptr;
-    if (nbVerticesByLevelElement)
-    {
-      nbVerticesByLevelArray = vtkSmartPointer<vtkDataArray>::Take(
-        vtkArrayDownCast<vtkDataArray>(this->CreateArray(nbVerticesByLevelElement)));
-      vtkIdType numberOfNodes = 0;
-      nbVerticesByLevelElement->GetScalarAttribute("NumberOfTuples", numberOfNodes);
-      nbVerticesByLevelArray->SetNumberOfTuples(numberOfNodes);
-      this->ReadArrayValues(nbVerticesByLevelElement, 0, nbVerticesByLevelArray, 0, numberOfNodes);
-    }
-    AccImpl accFunctor(this->GetFixedLevelOfThisHT(numberOfLevels, treeIndxInHTG));
-    if (!vtkArrayDispatch::Dispatch::Execute(nbVerticesByLevelArray, accFunctor))
-    {
-      cerr << "Should not happen: could not dispatch nbVerticesByLevel array" << endl;
-      cerr << "Falling back to vtkDataArray, can pose problems on windows" << endl;
-      accFunctor(nbVerticesByLevelArray.GetPointer());
-    }
     tree->InitializeForReader(accFunctor.LimitedLevel, accFunctor.FixedNbVertices,
       accFunctor.LimitedLevelElement, desc, maskArray, output->GetMask());
 
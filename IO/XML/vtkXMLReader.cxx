@@ -45,10 +45,19 @@
 #include <cmath>
 #include <functional>
 #include <locale> // C++ locale
+#include <map>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <vector>
 
+#if !defined(_WIN32)
+#include <fcntl.h>    // For open(), backing the memory mapped read mode
+#include <sys/mman.h> // For mmap() and munmap()
+#include <sys/stat.h> // For fstat()
+#include <unistd.h>   // For close(), pread() and sysconf()
+#endif
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkCxxSetObjectMacro(vtkXMLReader, ReaderErrorObserver, vtkCommand);
 vtkCxxSetObjectMacro(vtkXMLReader, ParserErrorObserver, vtkCommand);
@@ -132,6 +141,7 @@ vtkXMLReader::vtkXMLReader()
   this->FileStream = nullptr;
   this->StringStream = nullptr;
   this->ReadFromInputString = 0;
+  this->MemoryMapAppendedData = 0;
   this->InputString = "";
   this->InputArray = nullptr;
   this->XMLParser = nullptr;
@@ -236,6 +246,7 @@ void vtkXMLReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "NumberOfTimeSteps:" << this->NumberOfTimeSteps << "\n";
   os << indent << "TimeStepRange:(" << this->TimeStepRange[0] << "," << this->TimeStepRange[1]
      << ")\n";
+  os << indent << "MemoryMapAppendedData: " << (this->MemoryMapAppendedData ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -781,6 +792,31 @@ int vtkXMLReader::RequestData(vtkInformation* vtkNotUsed(request),
 
 namespace
 {
+#if !defined(_WIN32)
+// Active file mappings backing appended data arrays, keyed by the value
+// pointer handed to the array. The free function installed on an array only
+// receives that pointer back, so the mapping extents are kept here.
+struct vtkXMLReaderArrayMapping
+{
+  void* Base;
+  size_t Length;
+};
+std::mutex vtkXMLReaderArrayMappingsMutex;
+std::map<void*, vtkXMLReaderArrayMapping> vtkXMLReaderArrayMappings;
+
+//------------------------------------------------------------------------------
+void vtkXMLDataReaderUnmapArray(void* values)
+{
+  std::lock_guard<std::mutex> lock(vtkXMLReaderArrayMappingsMutex);
+  auto mapping = vtkXMLReaderArrayMappings.find(values);
+  if (mapping != vtkXMLReaderArrayMappings.end())
+  {
+    munmap(mapping->second.Base, mapping->second.Length);
+    vtkXMLReaderArrayMappings.erase(mapping);
+  }
+}
+#endif
+
 //------------------------------------------------------------------------------
 template <class iterT>
 int vtkXMLDataReaderReadArrayValues(vtkXMLDataElement* da, vtkXMLDataParser* xmlparser,
@@ -959,6 +995,104 @@ int vtkXMLDataReaderReadArrayValues(vtkXMLDataElement* da, vtkXMLDataParser* xml
 
 }
 
+//------------------------------------------------------------------------------
+bool vtkXMLReader::MapAppendedArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
+  vtkAbstractArray* array, vtkIdType startIndex, vtkIdType numValues)
+{
+#if !defined(_WIN32)
+  // Only whole reads from a file into fixed-width arrays with contiguous
+  // storage can alias the file bytes; partial reads and bit/string arrays
+  // take the normal copying path.
+  vtkDataArray* dataArray = vtkDataArray::SafeDownCast(array);
+  if (!dataArray || !dataArray->HasStandardMemoryLayout() ||
+    dataArray->GetDataType() == VTK_BIT || arrayIndex != 0 || startIndex != 0 || numValues < 1 ||
+    numValues != array->GetNumberOfValues() || !this->FileName || this->ReadFromInputString)
+  {
+    return false;
+  }
+  vtkTypeInt64 offset = 0;
+  if (!da->GetScalarAttribute("offset", offset))
+  {
+    return false;
+  }
+  vtkTypeInt64 dataPosition = this->XMLParser->GetAppendedDataBlockPosition(offset);
+  if (dataPosition < 0)
+  {
+    return false;
+  }
+  size_t wordSize = this->XMLParser->GetWordTypeSize(dataArray->GetDataType());
+  vtkTypeUInt64 numBytes = static_cast<vtkTypeUInt64>(numValues) * wordSize;
+
+  int fd = open(this->FileName, O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  // Check the file length and the block's byte-count header before
+  // trusting the mapping. The header's byte order already matches this
+  // machine, or GetAppendedDataBlockPosition would have refused.
+  vtkTypeInt64 headerPosition = this->XMLParser->GetAppendedDataPosition() + offset;
+  size_t headerSize = static_cast<size_t>(dataPosition - headerPosition);
+  vtkTypeUInt64 blockBytes = 0;
+  vtkTypeUInt32 blockBytes32 = 0;
+  struct stat fileStatus;
+  bool usable = fstat(fd, &fileStatus) == 0 &&
+    static_cast<vtkTypeUInt64>(fileStatus.st_size) >=
+      static_cast<vtkTypeUInt64>(dataPosition) + numBytes;
+  if (usable && headerSize == sizeof(blockBytes32))
+  {
+    usable = pread(fd, &blockBytes32, headerSize, headerPosition) ==
+      static_cast<ssize_t>(headerSize);
+    blockBytes = blockBytes32;
+  }
+  else if (usable && headerSize == sizeof(blockBytes))
+  {
+    usable =
+      pread(fd, &blockBytes, headerSize, headerPosition) == static_cast<ssize_t>(headerSize);
+  }
+  else
+  {
+    usable = false;
+  }
+  if (!usable || blockBytes < numBytes)
+  {
+    close(fd);
+    return false;
+  }
+
+  // Map privately so later modifications of the array copy pages on write
+  // instead of touching the file.
+  size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  vtkTypeInt64 mapPosition = dataPosition - dataPosition % static_cast<vtkTypeInt64>(pageSize);
+  size_t pageOffset = static_cast<size_t>(dataPosition - mapPosition);
+  size_t mapLength = pageOffset + static_cast<size_t>(numBytes);
+  void* base =
+    mmap(nullptr, mapLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, static_cast<off_t>(mapPosition));
+  close(fd);
+  if (base == MAP_FAILED)
+  {
+    return false;
+  }
+
+  void* values = static_cast<char*>(base) + pageOffset;
+  {
+    std::lock_guard<std::mutex> lock(vtkXMLReaderArrayMappingsMutex);
+    vtkXMLReaderArrayMappings[values] = { base, mapLength };
+  }
+  dataArray->SetVoidArray(values, numValues, 0, vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+  dataArray->SetArrayFreeFunction(vtkXMLDataReaderUnmapArray);
+  return true;
+#else
+  (void)da;
+  (void)arrayIndex;
+  (void)array;
+  (void)startIndex;
+  (void)numValues;
+  return false;
+#endif
+}
+
 //------------------------------------------------------------------------------
 int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
   vtkAbstractArray* array, vtkIdType startIndex, vtkIdType numValues, FieldType fieldType)
@@ -969,6 +1103,18 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
     return 0;
   }
   this->InReadData = 1;
+
+  // An appended array may be able to alias a mapping of the file instead
+  // of being copied out of it.
+  if (this->MemoryMapAppendedData &&
+    this->MapAppendedArrayValues(da, arrayIndex, array, startIndex, numValues))
+  {
+    this->ConvertGhostLevelsToGhostType(fieldType, array, startIndex, numValues);
+    array->Modified();
+    this->InReadData = 0;
+    return 1;
+  }
+
   int result;
   vtkArrayIterator* iter = array->NewIterator();
   if (arrayIndex + numValues > array->GetNumberOfValues())
@@ -89,6 +89,23 @@ public:
   virtual void SetInputArray(vtkCharArray*);
   ///@}
 
+  ///@{
+  /**
+   * When on, data arrays stored in the appended section of the file are
+   * not copied out of it when possible: each such array aliases a private
+   * (copy-on-write) memory mapping of the file, so reading costs page
+   * cache lookups instead of a full copy and unmodified arrays share
+   * physical memory with the file system cache. Only whole reads of
+   * uncompressed, raw-encoded (not base64) arrays whose byte order
+   * matches this machine qualify; anything else silently takes the
+   * normal reading path, as does everything on platforms without mmap().
+   * Default is off.
+   */
+  vtkSetMacro(MemoryMapAppendedData, vtkTypeBool);
+  vtkGetMacro(MemoryMapAppendedData, vtkTypeBool);
+  vtkBooleanMacro(MemoryMapAppendedData, vtkTypeBool);
+  ///@}
+
   /**
    * Test whether the file (type) with the given name can be read by this
    * reader. If the file has a newer version than the reader, we still say
@@ -351,6 +368,15 @@ protected:
   virtual int ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex, vtkAbstractArray* array,
     vtkIdType startIndex, vtkIdType numValues, FieldType type = OTHER);
 
+  /**
+   * Try to satisfy a whole-array appended data read by aliasing the array
+   * to a private (copy-on-write) memory mapping of the file. Returns false
+   * when the read does not qualify (see MemoryMapAppendedData), in which
+   * case the caller falls back to the normal copying path.
+   */
+  bool MapAppendedArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex, vtkAbstractArray* array,
+    vtkIdType startIndex, vtkIdType numValues);
+
   /**
    * Read an Array values starting at the given tuple index and up to numTuples
    * taking into account the number of components declared in array.
@@ -418,6 +444,10 @@ protected:
   // Default is 0: read from file.
   vtkTypeBool ReadFromInputString;
 
+  // Whether appended data arrays may alias a memory mapping of the file.
+  // Default is 0: copy appended data out of the file.
+  vtkTypeBool MemoryMapAppendedData;
+
   // The input string.
   std::string InputString;
 
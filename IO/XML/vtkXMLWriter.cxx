@@ -31,6 +31,7 @@
 #include "vtkOutputStream.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkStdString.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -1005,6 +1006,16 @@ int vtkXMLWriter::WriteBinaryData(vtkAbstractArray* a)
       result = 0;
     }
 
+    // Compress and write any blocks still gathered for the batch.
+    if (result)
+    {
+      result = this->FlushCompressionBlocks();
+    }
+    else
+    {
+      this->CompressionBlockBatch.clear();
+    }
+
     // Finish writing the data.
     if (result && !this->DataStream->EndWriting())
     {
@@ -1367,6 +1378,20 @@ int vtkXMLWriter::CreateCompressionHeader(size_t size)
 //------------------------------------------------------------------------------
 int vtkXMLWriter::WriteCompressionBlock(unsigned char* data, size_t size)
 {
+  if (this->Compressor->GetThreadSafe() && vtkSMPTools::GetEstimatedNumberOfThreads() > 1)
+  {
+    // Gather blocks so that several of them can be compressed at once;
+    // they are compressed on all threads and written out in order when
+    // the batch fills up or the array ends.
+    this->CompressionBlockBatch.emplace_back(data, data + size);
+    if (this->CompressionBlockBatch.size() <
+      4 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads()))
+    {
+      return 1;
+    }
+    return this->FlushCompressionBlocks();
+  }
+
   // Compress the data.
   vtkUnsignedCharArray* outputArray = this->Compressor->Compress(data, size);
 
@@ -1390,6 +1415,56 @@ int vtkXMLWriter::WriteCompressionBlock(unsigned char* data, size_t size)
   return result;
 }
 
+//------------------------------------------------------------------------------
+int vtkXMLWriter::FlushCompressionBlocks()
+{
+  if (this->CompressionBlockBatch.empty())
+  {
+    return 1;
+  }
+
+  // Compress the gathered blocks on all threads.
+  vtkIdType numBlocks = static_cast<vtkIdType>(this->CompressionBlockBatch.size());
+  std::vector<vtkUnsignedCharArray*> compressed(numBlocks, nullptr);
+  vtkSMPTools::For(0, numBlocks, [&](vtkIdType block, vtkIdType endBlock) {
+    for (; block < endBlock; ++block)
+    {
+      std::vector<unsigned char>& raw = this->CompressionBlockBatch[block];
+      compressed[block] = this->Compressor->Compress(raw.data(), raw.size());
+    }
+  });
+
+  // Write the compressed results serially in their original order.
+  int result = 1;
+  for (vtkIdType block = 0; block < numBlocks; ++block)
+  {
+    vtkUnsignedCharArray* outputArray = compressed[block];
+    if (!outputArray)
+    {
+      result = 0;
+      continue;
+    }
+    if (result)
+    {
+      size_t outputSize = outputArray->GetNumberOfTuples();
+      if (!this->DataStream->Write(outputArray->GetPointer(0), outputSize))
+      {
+        result = 0;
+      }
+      this->CompressionHeader->Set(3 + this->CompressionBlockNumber++, outputSize);
+    }
+    outputArray->Delete();
+  }
+  this->Stream->flush();
+  if (this->Stream->fail())
+  {
+    this->SetErrorCode(vtkErrorCode::GetLastSystemError());
+  }
+
+  this->CompressionBlockBatch.clear();
+  return result;
+}
+
 //------------------------------------------------------------------------------
 int vtkXMLWriter::WriteCompressionHeader()
 {
@@ -22,6 +22,7 @@
 #include "vtkXMLWriterBase.h"
 
 #include <sstream> // For ostringstream ivar
+#include <vector>  // For the parallel compression block batch
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkAbstractArray;
@@ -128,6 +129,10 @@ protected:
   vtkXMLDataHeader* CompressionHeader;
   vtkTypeInt64 CompressionHeaderPosition;
 
+  // Raw data blocks gathered so that several of them can be compressed at
+  // once on all threads. Used only when the compressor is thread safe.
+  std::vector<std::vector<unsigned char>> CompressionBlockBatch;
+
   // The output stream used to write binary and appended data.  May
   // transparently encode the data.
   vtkOutputStream* DataStream;
@@ -243,6 +248,7 @@ protected:
   void PerformByteSwap(void* data, size_t numWords, size_t wordSize);
   int CreateCompressionHeader(size_t size);
   int WriteCompressionBlock(unsigned char* data, size_t size);
+  int FlushCompressionBlocks();
   int WriteCompressionHeader();
   size_t GetWordTypeSize(int dataType);
   const char* GetWordTypeName(int dataType);
@@ -9,12 +9,14 @@
 #include "vtkEndian.h"
 #include "vtkInputStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkXMLDataElement.h"
 #define vtkXMLDataHeaderPrivate_DoNotInclude
 #include "vtkXMLDataHeaderPrivate.h"
 #undef vtkXMLDataHeaderPrivate_DoNotInclude
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cctype>
 #include <memory>
@@ -624,6 +626,50 @@ unsigned char* vtkXMLDataParser::ReadBlock(vtkTypeUInt64 block)
   return decompressBuffer;
 }
 
+//------------------------------------------------------------------------------
+int vtkXMLDataParser::ReadBlocksInParallel(
+  vtkTypeUInt64 firstBlock, vtkTypeUInt64 lastBlock, unsigned char* buffer, size_t wordSize)
+{
+  size_t numBlocks = static_cast<size_t>(lastBlock - firstBlock);
+
+  // The stream cannot be shared between threads, so read the compressed
+  // bytes of every block up front.
+  std::vector<std::vector<unsigned char>> compressedBlocks(numBlocks);
+  std::vector<unsigned char*> uncompressedBlocks(numBlocks);
+  size_t numRead = 0;
+  for (; numRead < numBlocks && !this->Abort; ++numRead)
+  {
+    vtkTypeUInt64 block = firstBlock + numRead;
+    size_t compressedSize = this->BlockCompressedSizes[block];
+    compressedBlocks[numRead].resize(compressedSize);
+    if (!this->DataStream->Seek(this->BlockStartOffsets[block]) ||
+      this->DataStream->Read(compressedBlocks[numRead].data(), compressedSize) < compressedSize)
+    {
+      return 0;
+    }
+    uncompressedBlocks[numRead] = buffer;
+    buffer += this->FindBlockSize(block);
+  }
+
+  // Decompress and byte swap the blocks that were read on all threads.
+  std::atomic<bool> result(true);
+  vtkSMPTools::For(
+    0, static_cast<vtkIdType>(numRead), [&](vtkIdType block, vtkIdType endBlock) {
+      for (; block < endBlock; ++block)
+      {
+        size_t uncompressedSize = this->FindBlockSize(firstBlock + block);
+        if (this->Compressor->Uncompress(compressedBlocks[block].data(),
+              compressedBlocks[block].size(), uncompressedBlocks[block], uncompressedSize) == 0)
+        {
+          result = false;
+          continue;
+        }
+        this->PerformByteSwap(uncompressedBlocks[block], uncompressedSize / wordSize, wordSize);
+      }
+    });
+  return result ? 1 : 0;
+}
+
 //------------------------------------------------------------------------------
 size_t vtkXMLDataParser::ReadUncompressedData(
   unsigned char* data, vtkTypeUInt64 startWord, size_t numWords, size_t wordSize)
@@ -797,24 +843,42 @@ size_t vtkXMLDataParser::ReadCompressedData(
     this->UpdateProgress(float(outputPointer - data) / length);
 
     unsigned int currentBlock = firstBlock + 1;
-    for (; currentBlock != lastBlock && !this->Abort; ++currentBlock)
+    if (this->Compressor->GetThreadSafe() && lastBlock > currentBlock + 1 && !this->Abort)
     {
-      // Read this block.
-      if (!this->ReadBlock(currentBlock, outputPointer))
+      // Several complete blocks remain: decompress them on all threads.
+      if (!this->ReadBlocksInParallel(currentBlock, lastBlock, outputPointer, wordSize))
       {
         return 0;
       }
-
-      // Byte swap this block.  Note that blockSize will always be an
-      // integer multiple of the word size.
-      this->PerformByteSwap(outputPointer, blockSize / wordSize, wordSize);
-
-      // Advance the pointer to the beginning of the next block.
-      outputPointer += this->FindBlockSize(currentBlock);
+      for (; currentBlock != lastBlock; ++currentBlock)
+      {
+        outputPointer += this->FindBlockSize(currentBlock);
+      }
 
       // Report progress.
       this->UpdateProgress(float(outputPointer - data) / length);
     }
+    else
+    {
+      for (; currentBlock != lastBlock && !this->Abort; ++currentBlock)
+      {
+        // Read this block.
+        if (!this->ReadBlock(currentBlock, outputPointer))
+        {
+          return 0;
+        }
+
+        // Byte swap this block.  Note that blockSize will always be an
+        // integer multiple of the word size.
+        this->PerformByteSwap(outputPointer, blockSize / wordSize, wordSize);
+
+        // Advance the pointer to the beginning of the next block.
+        outputPointer += this->FindBlockSize(currentBlock);
+
+        // Report progress.
+        this->UpdateProgress(float(outputPointer - data) / length);
+      }
+    }
 
     // Now read the final block, which is incomplete if it exists.
     if (endBlockOffset > 0 && !this->Abort)
@@ -958,6 +1022,29 @@ size_t vtkXMLDataParser::ReadAppendedData(
   return this->ReadBinaryData(buffer, startWord, numWords, wordType);
 }
 
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkXMLDataParser::GetAppendedDataBlockPosition(vtkTypeInt64 offset)
+{
+  // The file bytes can only be used in place when the appended section is
+  // raw (not base64 encoded), uncompressed, and already in this machine's
+  // byte order.
+  if (this->AppendedDataPosition < 0 || this->Compressor ||
+    this->AppendedDataStream->IsA("vtkBase64InputStream"))
+  {
+    return -1;
+  }
+#ifdef VTK_WORDS_BIGENDIAN
+  if (this->ByteOrder != vtkXMLDataParser::BigEndian)
+#else
+  if (this->ByteOrder != vtkXMLDataParser::LittleEndian)
+#endif
+  {
+    return -1;
+  }
+  // Skip the leading byte-count header to land on the raw values.
+  return this->AppendedDataPosition + offset + this->HeaderType / 8;
+}
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 // Define a parsing function template.  The extra "long" argument is used
@@ -147,6 +147,15 @@ public:
    */
   vtkTypeInt64 GetAppendedDataPosition() { return this->AppendedDataPosition; }
 
+  /**
+   * Returns the byte index in the file of the raw values of the appended
+   * data block at the given offset (past its leading byte-count header),
+   * or -1 when the block cannot be read in place because the appended
+   * section is base64 encoded or compressed, or its byte order does not
+   * match this machine. Valid after the XML is parsed.
+   */
+  vtkTypeInt64 GetAppendedDataBlockPosition(vtkTypeInt64 offset);
+
 protected:
   vtkXMLDataParser();
   ~vtkXMLDataParser() override;
@@ -175,6 +184,8 @@ protected:
   size_t FindBlockSize(vtkTypeUInt64 block);
   int ReadBlock(vtkTypeUInt64 block, unsigned char* buffer);
   unsigned char* ReadBlock(vtkTypeUInt64 block);
+  int ReadBlocksInParallel(
+    vtkTypeUInt64 firstBlock, vtkTypeUInt64 lastBlock, unsigned char* buffer, size_t wordSize);
   size_t ReadUncompressedData(
     unsigned char* data, vtkTypeUInt64 startWord, size_t numWords, size_t wordSize);
   size_t ReadCompressedData(
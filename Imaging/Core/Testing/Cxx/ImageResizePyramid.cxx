@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+//
+// Test the multi-resolution pyramid generation of vtkImageResizePyramid.
+//
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkImageResizePyramid.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+
+#include <cmath>
+#include <iostream>
+
+int ImageResizePyramid(int, char*[])
+{
+  const int size = 64;
+  const double value = 3.25;
+
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(size, size, 1);
+  image->SetSpacing(0.5, 0.5, 1.0);
+  image->SetOrigin(1.0, 2.0, 0.0);
+  image->AllocateScalars(VTK_FLOAT, 1);
+  vtkFloatArray::SafeDownCast(image->GetPointData()->GetScalars())->Fill(value);
+
+  vtkNew<vtkImageResizePyramid> pyramid;
+  pyramid->SetInputData(image);
+  pyramid->SetNumberOfLevels(4);
+  pyramid->Update();
+
+  if (pyramid->GetNumberOfOutputPorts() != 4)
+  {
+    std::cerr << "Expected 4 output ports, got " << pyramid->GetNumberOfOutputPorts() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  double inBounds[6];
+  image->GetBounds(inBounds);
+
+  int expectedSize = size;
+  for (int level = 0; level < 4; level++)
+  {
+    vtkImageData* output = pyramid->GetOutput(level);
+    int dims[3];
+    output->GetDimensions(dims);
+    if (dims[0] != expectedSize || dims[1] != expectedSize || dims[2] != 1)
+    {
+      std::cerr << "Level " << level << ": expected " << expectedSize << "x" << expectedSize
+                << "x1, got " << dims[0] << "x" << dims[1] << "x" << dims[2] << "\n";
+      return EXIT_FAILURE;
+    }
+
+    // every level must span the same physical bounds as the input
+    double bounds[6];
+    output->GetBounds(bounds);
+    for (int j = 0; j < 6; j++)
+    {
+      if (std::fabs(bounds[j] - inBounds[j]) > 1e-6)
+      {
+        std::cerr << "Level " << level << ": bounds[" << j << "] is " << bounds[j] << ", expected "
+                  << inBounds[j] << "\n";
+        return EXIT_FAILURE;
+      }
+    }
+
+    // downsampling a constant image must reproduce the constant
+    double range[2];
+    output->GetPointData()->GetScalars()->GetRange(range);
+    if (std::fabs(range[0] - value) > 1e-4 || std::fabs(range[1] - value) > 1e-4)
+    {
+      std::cerr << "Level " << level << ": scalar range [" << range[0] << ", " << range[1]
+                << "], expected constant " << value << "\n";
+      return EXIT_FAILURE;
+    }
+
+    expectedSize /= 2;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkImageResizePyramid.h"
+
+#include "vtkImageData.h"
+#include "vtkImageResize.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkImageResizePyramid);
+
+//------------------------------------------------------------------------------
+vtkImageResizePyramid::vtkImageResizePyramid()
+{
+  this->NumberOfLevels = 4;
+  this->SetNumberOfInputPorts(1);
+  this->SetNumberOfOutputPorts(this->NumberOfLevels);
+
+  this->Resizer->SetResizeMethod(vtkImageResize::OUTPUT_DIMENSIONS);
+}
+
+//------------------------------------------------------------------------------
+vtkImageResizePyramid::~vtkImageResizePyramid() = default;
+
+//------------------------------------------------------------------------------
+void vtkImageResizePyramid::SetNumberOfLevels(int levels)
+{
+  levels = std::max(levels, 1);
+  if (this->NumberOfLevels != levels)
+  {
+    this->NumberOfLevels = levels;
+    this->SetNumberOfOutputPorts(levels);
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkImageResizePyramid::RequestInformation(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+
+  int inExt[6];
+  double inSpacing[3], inOrigin[3];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), inExt);
+  inInfo->Get(vtkDataObject::SPACING(), inSpacing);
+  inInfo->Get(vtkDataObject::ORIGIN(), inOrigin);
+
+  int dims[3];
+  double spacing[3], origin[3];
+  for (int j = 0; j < 3; j++)
+  {
+    dims[j] = inExt[2 * j + 1] - inExt[2 * j] + 1;
+    spacing[j] = inSpacing[j];
+    origin[j] = inOrigin[j];
+  }
+
+  for (int level = 0; level < this->NumberOfLevels; level++)
+  {
+    if (level > 0)
+    {
+      // Mirror the spacing and origin that vtkImageResize computes when
+      // halving the previous level (OUTPUT_DIMENSIONS method, no border,
+      // no cropping), so the physical bounds are preserved on every level.
+      for (int j = 0; j < 3; j++)
+      {
+        int halved = std::max(dims[j] / 2, 1);
+        double e = dims[j] - 1;
+        double d = halved - 1;
+        double stretch = (d != 0 && e != 0) ? (e / d) : 1.0;
+        double translate = inExt[2 * j] - inExt[2 * j] * stretch;
+
+        origin[j] = origin[j] + spacing[j] * translate;
+        spacing[j] = spacing[j] * stretch;
+        dims[j] = halved;
+      }
+    }
+
+    int outExt[6];
+    for (int j = 0; j < 3; j++)
+    {
+      outExt[2 * j] = inExt[2 * j];
+      outExt[2 * j + 1] = inExt[2 * j] + dims[j] - 1;
+    }
+
+    vtkInformation* outInfo = outputVector->GetInformationObject(level);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), outExt, 6);
+    outInfo->Set(vtkDataObject::SPACING(), spacing, 3);
+    outInfo->Set(vtkDataObject::ORIGIN(), origin, 3);
+  }
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkImageResizePyramid::RequestUpdateExtent(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector*)
+{
+  // every level resamples the whole input
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  int inExt[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), inExt);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkImageResizePyramid::RequestData(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  if (!input)
+  {
+    return 0;
+  }
+
+  // Level 0 passes the input through; every following level halves the
+  // previous one, so the expensive resampling always runs on the smallest
+  // possible image.
+  vtkImageData* previous = vtkImageData::GetData(outputVector, 0);
+  previous->ShallowCopy(input);
+
+  for (int level = 1; level < this->NumberOfLevels; level++)
+  {
+    int prevExt[6];
+    previous->GetExtent(prevExt);
+    int dims[3];
+    for (int j = 0; j < 3; j++)
+    {
+      dims[j] = std::max((prevExt[2 * j + 1] - prevExt[2 * j] + 1) / 2, 1);
+    }
+
+    this->Resizer->SetInputData(previous);
+    this->Resizer->SetOutputDimensions(dims);
+    this->Resizer->Update();
+
+    vtkImageData* output = vtkImageData::GetData(outputVector, level);
+    output->ShallowCopy(this->Resizer->GetOutput());
+    previous = output;
+  }
+  this->Resizer->SetInputDataObject(nullptr);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkImageResizePyramid::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfLevels: " << this->NumberOfLevels << "\n";
+}
+VTK_ABI_NAMESPACE_END
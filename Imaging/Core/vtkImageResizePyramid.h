@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkImageResizePyramid
+ * @brief   generate a multi-resolution pyramid from an image
+ *
+ * vtkImageResizePyramid produces a stack of progressively downsampled
+ * versions of its input image.  Level 0 is the input at full resolution and
+ * every following level halves the sample count along each axis (never below
+ * one sample) while preserving the physical bounds of the image.  Each level
+ * is available on its own output port, so consumers such as
+ * vtkImageResliceMapper can pick the level whose resolution matches the
+ * screen instead of resampling gigapixel data on every pan or zoom.
+ * The downsampling is delegated to vtkImageResize, whose bandlimited
+ * Lanczos-windowed sinc kernel avoids the aliasing of plain subsampling,
+ * and is multithreaded over output tiles.
+ * @sa
+ * vtkImageResize vtkImageShrink3D
+ */
+
+#ifndef vtkImageResizePyramid_h
+#define vtkImageResizePyramid_h
+
+#include "vtkImageAlgorithm.h"
+#include "vtkImagingCoreModule.h" // For export macro
+#include "vtkNew.h"               // For vtkNew
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkImageResize;
+
+class VTKIMAGINGCORE_EXPORT vtkImageResizePyramid : public vtkImageAlgorithm
+{
+public:
+  static vtkImageResizePyramid* New();
+  vtkTypeMacro(vtkImageResizePyramid, vtkImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * The number of pyramid levels to generate, including the full-resolution
+   * level 0.  Each level occupies its own output port.  The default is 4.
+   */
+  virtual void SetNumberOfLevels(int levels);
+  vtkGetMacro(NumberOfLevels, int);
+  ///@}
+
+protected:
+  vtkImageResizePyramid();
+  ~vtkImageResizePyramid() override;
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  int NumberOfLevels;
+  vtkNew<vtkImageResize> Resizer;
+
+private:
+  vtkImageResizePyramid(const vtkImageResizePyramid&) = delete;
+  void operator=(const vtkImageResizePyramid&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
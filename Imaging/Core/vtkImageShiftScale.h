@@ -8,6 +8,14 @@
  * and then scaled (multiplied by a scalar. As a convenience, this class
  * allows you to set the output scalar type similar to vtkImageCast.
  * This is because shift scale operations frequently convert data types.
+ *
+ * The shift, scale, type conversion, and overflow clamping are all done
+ * in a single traversal of the data, so there is no need to chain this
+ * filter with vtkImageCast: one vtkImageShiftScale with OutputScalarType
+ * and ClampOverflow set replaces a shift/scale, cast, clip chain and
+ * avoids materializing the intermediate volumes.
+ * @sa
+ * vtkImageCast vtkImageDataStreamer
  */
 
 #ifndef vtkImageShiftScale_h
@@ -732,6 +732,50 @@ int vtkImageStencilData::IsInside(int xIdx, int yIdx, int zIdx)
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// Checks if an entire scanline extent is inside the stencil.
+int vtkImageStencilData::IsRowInside(int xMin, int xMax, int yIdx, int zIdx)
+{
+  // A masked operation can process the scanline exactly like the
+  // unmasked case when this returns 1.
+
+  int yExt = this->Extent[3] - this->Extent[2] + 1;
+  yIdx -= this->Extent[2];
+  if (yIdx < 0 || yIdx >= yExt)
+  {
+    return 0; // out-of-bounds in y
+  }
+
+  int zExt = this->Extent[5] - this->Extent[4] + 1;
+  zIdx -= this->Extent[4];
+  if (zIdx < 0 || zIdx >= zExt)
+  {
+    return 0; // out-of-bounds in z
+  }
+
+  // get the ExtentList and ExtentListLength for this yIdx,zIdx
+  int incr = zIdx * yExt + yIdx;
+  int* clist = this->ExtentLists[incr];
+  int clistlen = this->ExtentListLengths[incr];
+
+  // The row is inside only if a single one of the stored [r1,r2+1)
+  // pairs covers the full [xMin,xMax] range.
+  for (int iter = 0; iter < clistlen; iter += 2)
+  {
+    if (clist[iter] > xMin)
+    {
+      return 0; // the pairs are sorted, no later pair can cover xMin
+    }
+
+    if (xMax < clist[iter + 1])
+    {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
 //------------------------------------------------------------------------------
 //  Fills the stencil.  Extents must be set.
 void vtkImageStencilData::Fill()
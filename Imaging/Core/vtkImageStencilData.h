@@ -60,6 +60,14 @@ public:
    */
   int IsInside(int xIdx, int yIdx, int zIdx);
 
+  /**
+   * Checks if an entire x scanline extent [xMin,xMax] at (yIdx,zIdx) is
+   * inside the stencil.  This lets masked operations take the same fast
+   * path as unmasked operations for scanlines that the stencil does not
+   * clip, which is the common case for mostly-inside stencils.
+   */
+  int IsRowInside(int xMin, int xMax, int yIdx, int zIdx);
+
   /**
    * This method is used by vtkImageStencilDataSource to add an x
    * sub extent [r1,r2] for the x row (yIdx,zIdx).  The specified sub
@@ -376,65 +376,136 @@ void vtkImageGaussianSmooth::ThreadedRequestData(vtkInformation* vtkNotUsed(requ
         0, inData[0][0], inExt, outData[0], outExt, &cycle, target, &count, total, inInfo);
       break;
     case 2:
-      int tempExt[6];
-      vtkImageData* tempData;
-      // compute intermediate extent
+    {
+      int tempExt[6], tileOutExt[6];
+      // the intermediate covers the input x extent; y is tiled below
       tempExt[0] = inExt[0];
       tempExt[1] = inExt[1];
-      tempExt[2] = outExt[2];
-      tempExt[3] = outExt[3];
       tempExt[4] = inExt[4];
       tempExt[5] = inExt[5];
-      // create a temp data for intermediate results
-      tempData = vtkImageData::New();
-      tempData->SetExtent(tempExt);
-      tempData->AllocateScalars(
-        inData[0][0]->GetScalarType(), inData[0][0]->GetNumberOfScalarComponents());
-      this->ExecuteAxis(
-        1, inData[0][0], inExt, tempData, tempExt, &cycle, target, &count, total, inInfo);
-      this->ExecuteAxis(
-        0, tempData, tempExt, outData[0], outExt, &cycle, target, &count, total, inInfo);
-      // release temporary data
-      tempData->Delete();
+
+      tileOutExt[0] = outExt[0];
+      tileOutExt[1] = outExt[1];
+      tileOutExt[4] = outExt[4];
+      tileOutExt[5] = outExt[5];
+
+      // process the piece in y slabs so that the intermediate results stay
+      // cache resident between the two passes instead of making a full
+      // round trip through main memory
+      const vtkIdType maxTempSize = 4194304; // soft bound in bytes
+      vtkIdType tempRowSize = static_cast<vtkIdType>(tempExt[1] - tempExt[0] + 1) *
+        (tempExt[5] - tempExt[4] + 1) * inData[0][0]->GetNumberOfScalarComponents() *
+        inData[0][0]->GetScalarSize();
+      int tileRows = static_cast<int>(maxTempSize / tempRowSize);
+      tileRows = (tileRows > 0 ? tileRows : 1);
+
+      for (int tileFirst = outExt[2]; tileFirst <= outExt[3]; tileFirst += tileRows)
+      {
+        int tileLast = tileFirst + tileRows - 1;
+        tileLast = (tileLast < outExt[3] ? tileLast : outExt[3]);
+
+        tempExt[2] = tileFirst;
+        tempExt[3] = tileLast;
+        tileOutExt[2] = tileFirst;
+        tileOutExt[3] = tileLast;
+
+        // create a temp data for intermediate results
+        vtkImageData* tempData = vtkImageData::New();
+        tempData->SetExtent(tempExt);
+        tempData->AllocateScalars(
+          inData[0][0]->GetScalarType(), inData[0][0]->GetNumberOfScalarComponents());
+        // the y pass reads its halo directly from the input
+        this->ExecuteAxis(
+          1, inData[0][0], inExt, tempData, tempExt, &cycle, target, &count, total, inInfo);
+        this->ExecuteAxis(
+          0, tempData, tempExt, outData[0], tileOutExt, &cycle, target, &count, total, inInfo);
+        // release temporary data
+        tempData->Delete();
+      }
       break;
+    }
     case 3:
-      // we do z first because it is most likely smallest
-      int temp0Ext[6], temp1Ext[6];
-      vtkImageData *temp0Data, *temp1Data;
-      // compute intermediate extents
+    {
+      int temp0Ext[6], temp1Ext[6], tileInExt[6], tileOutExt[6];
+      // compute intermediate extents; x and z never change, y is tiled below
       temp0Ext[0] = inExt[0];
       temp0Ext[1] = inExt[1];
-      temp0Ext[2] = inExt[2];
-      temp0Ext[3] = inExt[3];
       temp0Ext[4] = outExt[4];
       temp0Ext[5] = outExt[5];
 
       temp1Ext[0] = inExt[0];
       temp1Ext[1] = inExt[1];
-      temp1Ext[2] = outExt[2];
-      temp1Ext[3] = outExt[3];
       temp1Ext[4] = outExt[4];
       temp1Ext[5] = outExt[5];
 
-      // create a temp data for intermediate results
-      temp0Data = vtkImageData::New();
-      temp0Data->SetExtent(temp0Ext);
-      temp0Data->AllocateScalars(
-        inData[0][0]->GetScalarType(), inData[0][0]->GetNumberOfScalarComponents());
-
-      temp1Data = vtkImageData::New();
-      temp1Data->SetExtent(temp1Ext);
-      temp1Data->AllocateScalars(
-        inData[0][0]->GetScalarType(), inData[0][0]->GetNumberOfScalarComponents());
-      this->ExecuteAxis(
-        2, inData[0][0], inExt, temp0Data, temp0Ext, &cycle, target, &count, total, inInfo);
-      this->ExecuteAxis(
-        1, temp0Data, temp0Ext, temp1Data, temp1Ext, &cycle, target, &count, total, inInfo);
-      temp0Data->Delete();
-      this->ExecuteAxis(
-        0, temp1Data, temp1Ext, outData[0], outExt, &cycle, target, &count, total, inInfo);
-      temp1Data->Delete();
+      tileInExt[0] = inExt[0];
+      tileInExt[1] = inExt[1];
+      tileInExt[4] = inExt[4];
+      tileInExt[5] = inExt[5];
+
+      tileOutExt[0] = outExt[0];
+      tileOutExt[1] = outExt[1];
+      tileOutExt[4] = outExt[4];
+      tileOutExt[5] = outExt[5];
+
+      // process the piece in y slabs so that the two intermediates stay
+      // bounded and cache resident while a slab runs through all three
+      // passes. The z pass is recomputed over the y halo of each slab, so
+      // keep the slabs tall enough for that overhead to stay small.
+      int radiusY = static_cast<int>(this->StandardDeviations[1] * this->RadiusFactors[1]);
+      const vtkIdType maxTempSize = 4194304; // soft bound in bytes
+      vtkIdType tempRowSize = static_cast<vtkIdType>(temp0Ext[1] - temp0Ext[0] + 1) *
+        (temp0Ext[5] - temp0Ext[4] + 1) * inData[0][0]->GetNumberOfScalarComponents() *
+        inData[0][0]->GetScalarSize();
+      int tileRows = static_cast<int>(maxTempSize / tempRowSize);
+      tileRows = (tileRows > 8 * radiusY ? tileRows : 8 * radiusY);
+      tileRows = (tileRows > 0 ? tileRows : 1);
+
+      for (int tileFirst = outExt[2]; tileFirst <= outExt[3]; tileFirst += tileRows)
+      {
+        int tileLast = tileFirst + tileRows - 1;
+        tileLast = (tileLast < outExt[3] ? tileLast : outExt[3]);
+
+        // the slab of the first intermediate includes the y halo that the
+        // y pass consumes
+        temp0Ext[2] = tileFirst - radiusY;
+        temp0Ext[2] = (temp0Ext[2] > inExt[2] ? temp0Ext[2] : inExt[2]);
+        temp0Ext[3] = tileLast + radiusY;
+        temp0Ext[3] = (temp0Ext[3] < inExt[3] ? temp0Ext[3] : inExt[3]);
+
+        temp1Ext[2] = tileFirst;
+        temp1Ext[3] = tileLast;
+
+        // the z pass starts reading the input at the slab's y halo
+        tileInExt[2] = temp0Ext[2];
+        tileInExt[3] = temp0Ext[3];
+
+        tileOutExt[2] = tileFirst;
+        tileOutExt[3] = tileLast;
+
+        // create temp data for intermediate results
+        // we do z first because it is most likely smallest
+        vtkImageData* temp0Data = vtkImageData::New();
+        temp0Data->SetExtent(temp0Ext);
+        temp0Data->AllocateScalars(
+          inData[0][0]->GetScalarType(), inData[0][0]->GetNumberOfScalarComponents());
+        this->ExecuteAxis(
+          2, inData[0][0], tileInExt, temp0Data, temp0Ext, &cycle, target, &count, total, inInfo);
+
+        vtkImageData* temp1Data = vtkImageData::New();
+        temp1Data->SetExtent(temp1Ext);
+        temp1Data->AllocateScalars(
+          inData[0][0]->GetScalarType(), inData[0][0]->GetNumberOfScalarComponents());
+        this->ExecuteAxis(
+          1, temp0Data, temp0Ext, temp1Data, temp1Ext, &cycle, target, &count, total, inInfo);
+        temp0Data->Delete();
+
+        this->ExecuteAxis(
+          0, temp1Data, temp1Ext, outData[0], tileOutExt, &cycle, target, &count, total, inInfo);
+        temp1Data->Delete();
+      }
       break;
+    }
   }
 }
 VTK_ABI_NAMESPACE_END
@@ -12,12 +12,14 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkGaussianSplatter);
@@ -75,6 +77,160 @@ public:
       }       // k within splat footprint
     }
   };
+
+  // Threads over the input points when ParallelSplatting is enabled. Each
+  // thread accumulates splats into its own scratch volume; the per-thread
+  // volumes are then merged into the output in a second pass threaded over
+  // voxels, so no synchronization on individual voxels is required.
+  class SplatPoints
+  {
+  public:
+    vtkGaussianSplatterAlgorithm* Algo;
+    vtkDataSet* Input;
+    vtkDataArray* Normals;
+    vtkDataArray* InScalars;
+    vtkIdType NumVoxels;
+
+    struct LocalDataType
+    {
+      std::vector<double> Scratch;
+      std::vector<char> Visited;
+    };
+    vtkSMPThreadLocal<LocalDataType> LocalData;
+
+    SplatPoints(
+      vtkGaussianSplatterAlgorithm* algo, vtkDataSet* input, vtkDataArray* n, vtkDataArray* s)
+      : Algo(algo)
+      , Input(input)
+      , Normals(n)
+      , InScalars(s)
+    {
+      this->NumVoxels = algo->Dims[0] * algo->Dims[1] * algo->Dims[2];
+    }
+
+    void Initialize()
+    {
+      LocalDataType& localData = this->LocalData.Local();
+      localData.Scratch.resize(this->NumVoxels);
+      localData.Visited.resize(this->NumVoxels, 0);
+    }
+
+    void operator()(vtkIdType ptId, vtkIdType endPtId)
+    {
+      LocalDataType& localData = this->LocalData.Local();
+      double* scratch = localData.Scratch.data();
+      char* visited = localData.Visited.data();
+      vtkGaussianSplatter* self = this->Algo->Splatter;
+      double p[3], n[3] = { 0.0, 0.0, 1.0 }, s = 0.0;
+      double loc[3], cx[3], dist2;
+      vtkIdType i, j, jOffset, kOffset, idx;
+      int min[3], max[3];
+
+      for (; ptId < endPtId; ++ptId)
+      {
+        this->Input->GetPoint(ptId, p);
+        if (this->Normals != nullptr)
+        {
+          this->Normals->GetTuple(ptId, n);
+        }
+        if (this->InScalars != nullptr)
+        {
+          s = this->InScalars->GetComponent(ptId, 0);
+        }
+
+        // Determine the splat footprint
+        for (i = 0; i < 3; i++)
+        {
+          loc[i] = (p[i] - this->Algo->Origin[i]) / this->Algo->Spacing[i];
+          min[i] = static_cast<int>(floor(loc[i] - self->SplatDistance[i]));
+          max[i] = static_cast<int>(ceil(loc[i] + self->SplatDistance[i]));
+          if (min[i] < 0)
+          {
+            min[i] = 0;
+          }
+          if (max[i] >= this->Algo->Dims[i])
+          {
+            max[i] = this->Algo->Dims[i] - 1;
+          }
+        }
+
+        // Loop over all sample points in the volume within the footprint
+        // and evaluate the splat
+        for (vtkIdType slice = min[2]; slice <= max[2]; ++slice)
+        {
+          cx[2] = this->Algo->Origin[2] + this->Algo->Spacing[2] * slice;
+          kOffset = slice * this->Algo->SliceSize;
+          for (j = min[1]; j <= max[1]; j++)
+          {
+            cx[1] = this->Algo->Origin[1] + this->Algo->Spacing[1] * j;
+            jOffset = j * this->Algo->Dims[0];
+            for (i = min[0]; i <= max[0]; i++)
+            {
+              cx[0] = this->Algo->Origin[0] + this->Algo->Spacing[0] * i;
+              dist2 = self->SamplePoint(cx, p, n);
+              if (dist2 <= this->Algo->Radius2)
+              {
+                idx = i + jOffset + kOffset;
+                self->SetScalar(idx, dist2, s, scratch + idx, visited);
+              } // if within splat radius
+            }   // i
+          }     // j
+        }       // k within splat footprint
+      }         // for points in this batch
+    }
+
+    void Reduce() {}
+
+    static void Execute(vtkGaussianSplatterAlgorithm* algo, vtkDataSet* input, vtkDataArray* n,
+      vtkDataArray* s, vtkIdType numPts)
+    {
+      SplatPoints splatPoints(algo, input, n, s);
+      vtkSMPTools::For(0, numPts, splatPoints);
+
+      // Now combine the per-thread volumes into the output. Threading is
+      // over voxels, so each output voxel is touched by exactly one thread.
+      std::vector<LocalDataType*> locals;
+      for (auto& localData : splatPoints.LocalData)
+      {
+        locals.push_back(&localData);
+      }
+      vtkGaussianSplatter* self = algo->Splatter;
+      vtkSMPTools::For(0, splatPoints.NumVoxels, [&](vtkIdType idx, vtkIdType endIdx) {
+        for (; idx < endIdx; ++idx)
+        {
+          for (LocalDataType* localData : locals)
+          {
+            if (!localData->Visited[idx])
+            {
+              continue;
+            }
+            double v = localData->Scratch[idx];
+            double* sPtr = algo->Scalars + idx;
+            if (!self->Visited[idx])
+            {
+              self->Visited[idx] = 1;
+              *sPtr = v;
+            }
+            else
+            {
+              switch (self->AccumulationMode)
+              {
+                case VTK_ACCUMULATION_MODE_MIN:
+                  *sPtr = (*sPtr > v ? v : *sPtr);
+                  break;
+                case VTK_ACCUMULATION_MODE_MAX:
+                  *sPtr = (*sPtr < v ? v : *sPtr);
+                  break;
+                case VTK_ACCUMULATION_MODE_SUM:
+                  *sPtr += v;
+                  break;
+              }
+            } // not first visit
+          }   // for each thread's scratch volume
+        }     // for voxels in this batch
+      });
+    }
+  };
 };
 
 //------------------------------------------------------------------------------
@@ -108,6 +264,8 @@ vtkGaussianSplatter::vtkGaussianSplatter()
 
   this->AccumulationMode = VTK_ACCUMULATION_MODE_MAX;
   this->NullValue = 0.0;
+
+  this->ParallelSplatting = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -306,6 +464,16 @@ int vtkGaussianSplatter::RequestData(vtkInformation* vtkNotUsed(request),
     }
     vtkIdType numPts = input->GetNumberOfPoints();
 
+    if (this->ParallelSplatting)
+    {
+      // Thread over the input points: each thread splats a range of points
+      // into its own scratch volume, and the volumes are combined afterwards
+      // in a reduction threaded over voxels.
+      vtkGaussianSplatterAlgorithm::SplatPoints::Execute(
+        &algo, input, myNormals, myScalars, numPts);
+      continue;
+    }
+
     // Traverse all points - splatting each into the volume.
     // For each point, determine which voxel it is in.  Then determine
     // the subvolume that the splat is contained in, and process that.
@@ -650,8 +818,14 @@ void vtkGaussianSplatter::Cap(vtkDoubleArray* s)
 //
 double vtkGaussianSplatter::Gaussian(double cx[3])
 {
-  return ((cx[0] - P[0]) * (cx[0] - P[0]) + (cx[1] - P[1]) * (cx[1] - P[1]) +
-    (cx[2] - P[2]) * (cx[2] - P[2]));
+  return this->Gaussian(cx, this->P);
+}
+
+//------------------------------------------------------------------------------
+double vtkGaussianSplatter::Gaussian(const double cx[3], const double p[3])
+{
+  return ((cx[0] - p[0]) * (cx[0] - p[0]) + (cx[1] - p[1]) * (cx[1] - p[1]) +
+    (cx[2] - p[2]) * (cx[2] - p[2]));
 }
 
 //------------------------------------------------------------------------------
@@ -659,16 +833,23 @@ double vtkGaussianSplatter::Gaussian(double cx[3])
 //  Ellipsoidal Gaussian sampling
 //
 double vtkGaussianSplatter::EccentricGaussian(double cx[3])
+{
+  return this->EccentricGaussian(cx, this->P, this->N);
+}
+
+//------------------------------------------------------------------------------
+double vtkGaussianSplatter::EccentricGaussian(
+  const double cx[3], const double p[3], const double n[3])
 {
   double v[3], r2, z2, rxy2, mag;
 
-  v[0] = cx[0] - this->P[0];
-  v[1] = cx[1] - this->P[1];
-  v[2] = cx[2] - this->P[2];
+  v[0] = cx[0] - p[0];
+  v[1] = cx[1] - p[1];
+  v[2] = cx[2] - p[2];
 
   r2 = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
 
-  if ((mag = this->N[0] * this->N[0] + this->N[1] * this->N[1] + this->N[2] * this->N[2]) != 1.0)
+  if ((mag = n[0] * n[0] + n[1] * n[1] + n[2] * n[2]) != 1.0)
   {
     if (mag == 0.0)
     {
@@ -680,7 +861,7 @@ double vtkGaussianSplatter::EccentricGaussian(double cx[3])
     }
   }
 
-  z2 = (v[0] * this->N[0] + v[1] * this->N[1] + v[2] * this->N[2]) / mag;
+  z2 = (v[0] * n[0] + v[1] * n[1] + v[2] * n[2]) / mag;
   z2 = z2 * z2;
 
   rxy2 = r2 - z2;
@@ -733,6 +914,8 @@ void vtkGaussianSplatter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Accumulation Mode: " << this->GetAccumulationModeAsString() << "\n";
 
   os << indent << "Null Value: " << this->NullValue << "\n";
+
+  os << indent << "Parallel Splatting: " << (this->ParallelSplatting ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
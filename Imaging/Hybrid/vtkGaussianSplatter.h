@@ -215,6 +215,25 @@ public:
   vtkGetMacro(NullValue, double);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to splat the input points in parallel. When enabled,
+   * the filter threads over the input points, with each thread accumulating
+   * splats into its own scratch volume; the per-thread volumes are then
+   * combined in a threaded reduction, so no synchronization on voxels is
+   * needed. This scales much better for large numbers of points with small
+   * splat footprints than the default mode, which parallelizes over the
+   * footprint of one splat at a time. The cost is one scratch volume per
+   * thread, so very large sample dimensions may favor the default mode (or
+   * vtkCheckerboardSplatter). In Sum accumulation mode the result may differ
+   * from the serial path in the last bits due to accumulation order. The
+   * default is off.
+   */
+  vtkSetMacro(ParallelSplatting, vtkTypeBool);
+  vtkGetMacro(ParallelSplatting, vtkTypeBool);
+  vtkBooleanMacro(ParallelSplatting, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Compute the size of the sample bounding box automatically from the
@@ -238,13 +257,28 @@ public:
   }
   void SetScalar(vtkIdType idx, double dist2, double* sPtr)
   {
-    double v = (this->*SampleFactor)(this->S) *
+    this->SetScalar(idx, dist2, this->S, sPtr, this->Visited);
+  }
+
+  // Thread-safe variants of the methods above, used when splatting points in
+  // parallel: the per-splat state (position, normal, scalar) is passed in
+  // rather than taken from the filter, and accumulation goes into the
+  // caller's scratch volume and visited array.
+  double SamplePoint(const double x[3], const double p[3], const double n[3])
+  {
+    return (this->Sample == &vtkGaussianSplatter::EccentricGaussian)
+      ? this->EccentricGaussian(x, p, n)
+      : this->Gaussian(x, p);
+  }
+  void SetScalar(vtkIdType idx, double dist2, double s, double* sPtr, char* visited)
+  {
+    double v = (this->*SampleFactor)(s) *
       std::exp(static_cast<double>(this->ExponentFactor * (dist2) / (this->Radius2)));
     ///@}
 
-    if (!this->Visited[idx])
+    if (!visited[idx])
     {
-      this->Visited[idx] = 1;
+      visited[idx] = 1;
       *sPtr = v;
     }
     else
@@ -290,9 +324,12 @@ protected:
   vtkTypeBool Capping;       // Cap side of volume to close surfaces
   double CapValue;           // value to use for capping
   int AccumulationMode;      // how to combine scalar values
+  vtkTypeBool ParallelSplatting; // thread over points rather than one footprint
 
   double Gaussian(double x[3]);
+  double Gaussian(const double x[3], const double p[3]);
   double EccentricGaussian(double x[3]);
+  double EccentricGaussian(const double x[3], const double p[3], const double n[3]);
   double ScalarSampling(double s) { return this->ScaleFactor * s; }
   double PositionSampling(double) { return this->ScaleFactor; }
 
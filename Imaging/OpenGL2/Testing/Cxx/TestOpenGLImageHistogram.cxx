@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the GPU histogram gives the same bins as the CPU histogram.
+
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkImageHistogram.h"
+#include "vtkNew.h"
+#include "vtkOpenGLImageHistogram.h"
+#include "vtkRenderWindow.h"
+
+int TestOpenGLImageHistogram(int, char*[])
+{
+  // create a 16-bit test volume
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, 63, 0, 63, 0, 63);
+  image->AllocateScalars(VTK_SHORT, 1);
+  short* ptr = static_cast<short*>(image->GetScalarPointer());
+  vtkIdType numVoxels = 64 * 64 * 64;
+  for (vtkIdType i = 0; i < numVoxels; i++)
+  {
+    ptr[i] = static_cast<short>((i * 31) % 4096 - 1024);
+  }
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetShowWindow(false);
+
+  // if compute shaders are not supported, the GPU filter falls back to
+  // the CPU implementation and this becomes a smoke test
+  vtkNew<vtkOpenGLImageHistogram> gpuHistogram;
+  gpuHistogram->SetRenderWindow(renWin);
+  gpuHistogram->SetInputData(image);
+  gpuHistogram->AutomaticBinningOn();
+  gpuHistogram->Update();
+
+  vtkNew<vtkImageHistogram> cpuHistogram;
+  cpuHistogram->SetInputData(image);
+  cpuHistogram->AutomaticBinningOn();
+  cpuHistogram->Update();
+
+  if (gpuHistogram->GetNumberOfBins() != cpuHistogram->GetNumberOfBins())
+  {
+    cerr << "GPU histogram has " << gpuHistogram->GetNumberOfBins() << " bins, expected "
+         << cpuHistogram->GetNumberOfBins() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  if (gpuHistogram->GetTotal() != cpuHistogram->GetTotal())
+  {
+    cerr << "GPU histogram total is " << gpuHistogram->GetTotal() << ", expected "
+         << cpuHistogram->GetTotal() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkIdTypeArray* gpuBins = gpuHistogram->GetHistogram();
+  vtkIdTypeArray* cpuBins = cpuHistogram->GetHistogram();
+  for (int i = 0; i < cpuHistogram->GetNumberOfBins(); i++)
+  {
+    if (gpuBins->GetValue(i) != cpuBins->GetValue(i))
+    {
+      cerr << "GPU histogram bin " << i << " is " << gpuBins->GetValue(i) << ", expected "
+           << cpuBins->GetValue(i) << "\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
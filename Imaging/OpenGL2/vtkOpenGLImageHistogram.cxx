@@ -0,0 +1,317 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkOpenGLImageHistogram.h"
+
+#include "vtkDataArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkOpenGLBufferObject.h"
+#include "vtkOpenGLRenderWindow.h"
+#include "vtkOpenGLShaderCache.h"
+#include "vtkPointData.h"
+#include "vtkShader.h"
+#include "vtkShaderProgram.h"
+#include "vtk_glew.h"
+
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkOpenGLImageHistogram);
+
+//------------------------------------------------------------------------------
+vtkOpenGLImageHistogram::vtkOpenGLImageHistogram()
+{
+  // threading is left enabled because it is used by the CPU fallback
+  this->RenderWindow = nullptr;
+}
+
+//------------------------------------------------------------------------------
+vtkOpenGLImageHistogram::~vtkOpenGLImageHistogram() = default;
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageHistogram::SetRenderWindow(vtkRenderWindow* renWin)
+{
+  if (renWin == this->RenderWindow.GetPointer())
+  {
+    return;
+  }
+
+  vtkOpenGLRenderWindow* orw = nullptr;
+  if (renWin)
+  {
+    orw = vtkOpenGLRenderWindow::SafeDownCast(renWin);
+  }
+
+  this->RenderWindow = orw;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLImageHistogram::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "RenderWindow: " << this->RenderWindow.GetPointer() << "\n";
+}
+
+//------------------------------------------------------------------------------
+// Bin the scalars on the GPU, or return false to request the CPU fallback.
+bool vtkOpenGLImageHistogram::GPURequestData(vtkImageData* inData)
+{
+#ifdef GL_COMPUTE_SHADER
+  vtkDataArray* scalars = inData->GetPointData()->GetScalars();
+  if (scalars == nullptr)
+  {
+    return false;
+  }
+
+  int scalarType = scalars->GetDataType();
+  int scalarSize = scalars->GetDataTypeSize();
+  if (scalarSize > 4)
+  {
+    // 64-bit types cannot be decoded from 32-bit buffer words
+    return false;
+  }
+
+  int numComponents = scalars->GetNumberOfComponents();
+  vtkIdType numValues = scalars->GetNumberOfTuples() * numComponents;
+  // the histogram is accumulated in 32-bit counters on the GPU
+  if (numValues < 1 || numValues > VTK_UNSIGNED_INT_MAX)
+  {
+    return false;
+  }
+
+  // the scalars are uploaded as raw 32-bit words, values in the trailing
+  // partial word (if any) are binned on the CPU afterwards
+  int valuesPerWord = 4 / scalarSize;
+  vtkIdType numWords = numValues / valuesPerWord;
+  if (numWords < 1 || numWords > VTK_INT_MAX)
+  {
+    return false;
+  }
+
+  // build the per-value decode code for the scalar type
+  std::string decode;
+  switch (scalarType)
+  {
+    case VTK_CHAR:
+    case VTK_SIGNED_CHAR:
+      decode = "    for (int k = 0; k < 4; ++k)\n"
+               "    {\n"
+               "      float value = float((int(word) << (24 - 8*k)) >> 24);\n"
+               "      int idx = int(w)*4 + k;\n";
+      break;
+    case VTK_UNSIGNED_CHAR:
+      decode = "    for (int k = 0; k < 4; ++k)\n"
+               "    {\n"
+               "      float value = float((word >> uint(8*k)) & 0xFFu);\n"
+               "      int idx = int(w)*4 + k;\n";
+      break;
+    case VTK_SHORT:
+      decode = "    for (int k = 0; k < 2; ++k)\n"
+               "    {\n"
+               "      float value = float((int(word) << (16 - 16*k)) >> 16);\n"
+               "      int idx = int(w)*2 + k;\n";
+      break;
+    case VTK_UNSIGNED_SHORT:
+      decode = "    for (int k = 0; k < 2; ++k)\n"
+               "    {\n"
+               "      float value = float((word >> uint(16*k)) & 0xFFFFu);\n"
+               "      int idx = int(w)*2 + k;\n";
+      break;
+    case VTK_INT:
+      decode = "    {\n"
+               "      float value = float(int(word));\n"
+               "      int idx = int(w);\n";
+      break;
+    case VTK_UNSIGNED_INT:
+      decode = "    {\n"
+               "      float value = float(word);\n"
+               "      int idx = int(w);\n";
+      break;
+    case VTK_FLOAT:
+      decode = "    {\n"
+               "      float value = uintBitsToFloat(word);\n"
+               "      int idx = int(w);\n";
+      break;
+    default:
+      return false;
+  }
+
+  // bin exactly like the CPU implementation: shift, scale, clamp, round
+  std::string source = "#version 430\n"
+                       "layout(local_size_x = 64) in;\n"
+                       "layout(std430, binding = 0) readonly buffer InputBuffer\n"
+                       "{\n"
+                       "  uint inputData[];\n"
+                       "};\n"
+                       "layout(std430, binding = 1) buffer HistogramBuffer\n"
+                       "{\n"
+                       "  uint histogram[];\n"
+                       "};\n"
+                       "uniform int numWords;\n"
+                       "uniform int numComponents;\n"
+                       "uniform int component;\n"
+                       "uniform int numBins;\n"
+                       "uniform float binShift;\n"
+                       "uniform float binScale;\n"
+                       "void main() {\n"
+                       "  uint stride = gl_NumWorkGroups.x * gl_WorkGroupSize.x;\n"
+                       "  for (uint w = gl_GlobalInvocationID.x; w < uint(numWords); w += stride)\n"
+                       "  {\n"
+                       "    uint word = inputData[w];\n" +
+    decode +
+    "      if (component < 0 || idx % numComponents == component)\n"
+    "      {\n"
+    "        float x = (value + binShift) * binScale;\n"
+    "        x = clamp(x, 0.0, float(numBins - 1));\n"
+    "        atomicAdd(histogram[int(x + 0.5)], 1u);\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n";
+
+  // make sure there is an OpenGL context
+  if (!this->RenderWindow)
+  {
+    vtkRenderWindow* renWin = vtkRenderWindow::New();
+    renWin->SetShowWindow(false);
+    this->SetRenderWindow(renWin);
+    renWin->Delete();
+    if (!this->RenderWindow)
+    {
+      return false;
+    }
+  }
+  this->RenderWindow->Initialize();
+  this->RenderWindow->MakeCurrent();
+
+  if (!vtkShader::IsComputeShaderSupported())
+  {
+    return false;
+  }
+
+  vtkNew<vtkShader> shader;
+  shader->SetSource(source);
+  shader->SetType(vtkShader::Compute);
+
+  vtkNew<vtkShaderProgram> program;
+  program->SetComputeShader(shader);
+
+  vtkOpenGLShaderCache* shaderCache = this->RenderWindow->GetShaderCache();
+  if (shaderCache->ReadyShaderProgram(program) != program.GetPointer())
+  {
+    return false;
+  }
+
+  // handle automatic binning the same way as the CPU implementation,
+  // the scalar range that it needs is cached by vtkImageData
+  this->ComputeAutomaticBinning(inData);
+  int numBins = this->NumberOfBins;
+  double binOrigin = this->BinOrigin;
+  double binSpacing = this->BinSpacing;
+
+  // upload the scalars and the cleared histogram counters
+  vtkNew<vtkOpenGLBufferObject> inputBuffer;
+  if (!inputBuffer->Upload(static_cast<const unsigned int*>(scalars->GetVoidPointer(0)),
+        static_cast<size_t>(numWords), vtkOpenGLBufferObject::ArrayBuffer))
+  {
+    return false;
+  }
+  inputBuffer->BindShaderStorage(0);
+
+  std::vector<unsigned int> counts(numBins, 0);
+  vtkNew<vtkOpenGLBufferObject> histogramBuffer;
+  if (!histogramBuffer->Upload(counts, vtkOpenGLBufferObject::ArrayBuffer))
+  {
+    return false;
+  }
+  histogramBuffer->BindShaderStorage(1);
+
+  program->SetUniformi("numWords", static_cast<int>(numWords));
+  program->SetUniformi("numComponents", numComponents);
+  program->SetUniformi("component", this->ActiveComponent);
+  program->SetUniformi("numBins", numBins);
+  program->SetUniformf("binShift", static_cast<float>(-binOrigin));
+  program->SetUniformf("binScale", static_cast<float>(1.0 / binSpacing));
+
+  // each invocation strides over the words, so the group count is capped
+  int groupCount = static_cast<int>((numWords + 63) / 64);
+  groupCount = (groupCount < 65535 ? groupCount : 65535);
+  glDispatchCompute(groupCount, 1, 1);
+  glMemoryBarrier(GL_ALL_BARRIER_BITS);
+
+  // the pipeline consumes the histogram in this very update, so the
+  // readback is synchronous
+  if (!histogramBuffer->Download(counts.data(), static_cast<size_t>(numBins)))
+  {
+    return false;
+  }
+
+  this->Histogram->SetNumberOfComponents(1);
+  this->Histogram->SetNumberOfTuples(numBins);
+  vtkIdType* histogram = this->Histogram->GetPointer(0);
+
+  vtkIdType total = 0;
+  for (int i = 0; i < numBins; i++)
+  {
+    vtkIdType c = counts[i];
+    histogram[i] = c;
+    total += c;
+  }
+
+  // bin the values from the trailing partial word, if there is one
+  int maxBin = numBins - 1;
+  for (vtkIdType v = numWords * valuesPerWord; v < numValues; v++)
+  {
+    int c = static_cast<int>(v % numComponents);
+    if (this->ActiveComponent >= 0 && c != this->ActiveComponent)
+    {
+      continue;
+    }
+    double x = (scalars->GetComponent(v / numComponents, c) - binOrigin) / binSpacing;
+    x = (x > 0 ? x : 0);
+    x = (x < maxBin ? x : maxBin);
+    histogram[vtkMath::Floor(x + 0.5)]++;
+    total++;
+  }
+
+  this->Total = total;
+
+  return true;
+#else
+  (void)inData;
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// override to generate the histogram on the GPU whenever possible
+int vtkOpenGLImageHistogram::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkImageData* inData = vtkImageData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  // the GPU path does not handle stencils
+  if (this->GetStencil() == nullptr && this->GPURequestData(inData))
+  {
+    // allocate the output and draw the histogram image
+    this->PrepareImageData(inputVector, outputVector);
+    if (this->GetNumberOfOutputPorts() > 0 && this->GenerateHistogramImage)
+    {
+      vtkInformation* outInfo = outputVector->GetInformationObject(0);
+      vtkImageData* outData = vtkImageData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+      this->GenerateHistogramImageData(outData);
+    }
+    return 1;
+  }
+
+  return this->Superclass::RequestData(request, inputVector, outputVector);
+}
+VTK_ABI_NAMESPACE_END
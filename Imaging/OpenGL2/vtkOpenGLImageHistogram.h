@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkOpenGLImageHistogram
+ * @brief   Compute the histogram for an image using the GPU
+ *
+ * vtkOpenGLImageHistogram computes the image histogram with a compute
+ * shader that bins the scalars into a shader storage buffer with atomic
+ * adds.  The GPU path is used when the context supports compute shaders
+ * and the input has no stencil and a scalar type that fits in 32 bits;
+ * in all other cases the filter silently falls back to the threaded CPU
+ * implementation of vtkImageHistogram.
+ */
+
+#ifndef vtkOpenGLImageHistogram_h
+#define vtkOpenGLImageHistogram_h
+
+#include "vtkImageHistogram.h"
+#include "vtkImagingOpenGL2Module.h" // For export macro
+#include "vtkSmartPointer.h"         // For RenderWindow
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkOpenGLRenderWindow;
+class vtkRenderWindow;
+
+class VTKIMAGINGOPENGL2_EXPORT vtkOpenGLImageHistogram : public vtkImageHistogram
+{
+public:
+  static vtkOpenGLImageHistogram* New();
+  vtkTypeMacro(vtkOpenGLImageHistogram, vtkImageHistogram);
+
+  /**
+   * Set the render window to get the OpenGL resources from
+   */
+  void SetRenderWindow(vtkRenderWindow*);
+
+protected:
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  vtkOpenGLImageHistogram();
+  ~vtkOpenGLImageHistogram() override;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  /**
+   * Compute the histogram on the GPU.  Returns false if the input or the
+   * context cannot be handled, in which case nothing has been modified
+   * and the CPU implementation must be used instead.
+   */
+  bool GPURequestData(vtkImageData* inData);
+
+  vtkSmartPointer<vtkOpenGLRenderWindow> RenderWindow;
+
+private:
+  vtkOpenGLImageHistogram(const vtkOpenGLImageHistogram&) = delete;
+  void operator=(const vtkOpenGLImageHistogram&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
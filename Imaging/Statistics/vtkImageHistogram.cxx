@@ -621,16 +621,12 @@ void vtkImageHistogramFunctor::Reduce()
 }
 
 //------------------------------------------------------------------------------
-// override from vtkThreadedImageAlgorithm to customize the multithreading
-int vtkImageHistogram::RequestData(
-  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+// set the binning according to the scalar type and range of the data
+void vtkImageHistogram::ComputeAutomaticBinning(vtkImageData* image)
 {
-  vtkInformation* info = inputVector[0]->GetInformationObject(0);
-  vtkImageData* image = vtkImageData::SafeDownCast(info->Get(vtkDataObject::DATA_OBJECT()));
   int scalarType = image->GetScalarType();
   double scalarRange[2];
 
-  // handle automatic binning
   if (this->AutomaticBinning)
   {
     switch (scalarType)
@@ -704,6 +700,18 @@ int vtkImageHistogram::RequestData(
       break;
     }
   }
+}
+
+//------------------------------------------------------------------------------
+// override from vtkThreadedImageAlgorithm to customize the multithreading
+int vtkImageHistogram::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* info = inputVector[0]->GetInformationObject(0);
+  vtkImageData* image = vtkImageData::SafeDownCast(info->Get(vtkDataObject::DATA_OBJECT()));
+
+  // handle automatic binning
+  this->ComputeAutomaticBinning(image);
 
   // get the input extent
   vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
@@ -804,15 +812,22 @@ int vtkImageHistogram::RequestData(
   {
     info = outputVector->GetInformationObject(0);
     image = vtkImageData::SafeDownCast(info->Get(vtkDataObject::DATA_OBJECT()));
-    int* outExt = image->GetExtent();
-    vtkImageHistogramGenerateImage(this->Histogram->GetPointer(0), this->NumberOfBins,
-      static_cast<unsigned char*>(image->GetScalarPointerForExtent(outExt)),
-      this->HistogramImageScale, this->HistogramImageSize, outExt);
+    this->GenerateHistogramImageData(image);
   }
 
   return 1;
 }
 
+//------------------------------------------------------------------------------
+// draw the histogram into the given output image
+void vtkImageHistogram::GenerateHistogramImageData(vtkImageData* image)
+{
+  int* outExt = image->GetExtent();
+  vtkImageHistogramGenerateImage(this->Histogram->GetPointer(0), this->NumberOfBins,
+    static_cast<unsigned char*>(image->GetScalarPointerForExtent(outExt)),
+    this->HistogramImageScale, this->HistogramImageSize, outExt);
+}
+
 //------------------------------------------------------------------------------
 // This method is passed a input and output region, and executes the filter
 // algorithm to fill the output from the input.
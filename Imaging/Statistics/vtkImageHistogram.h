@@ -199,6 +199,17 @@ protected:
    */
   void ComputeImageScalarRange(vtkImageData* data, double range[2]);
 
+  /**
+   * If AutomaticBinning is On, set NumberOfBins, BinOrigin, and BinSpacing
+   * from the scalar type and scalar range of the given input data.
+   */
+  void ComputeAutomaticBinning(vtkImageData* data);
+
+  /**
+   * Draw the histogram into the given output image.
+   */
+  void GenerateHistogramImageData(vtkImageData* data);
+
   int ActiveComponent;
   vtkTypeBool AutomaticBinning;
   int MaximumNumberOfBins;
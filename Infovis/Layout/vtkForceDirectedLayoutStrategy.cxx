@@ -16,6 +16,7 @@
 #include "vtkOutEdgeIterator.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTree.h"
 
@@ -186,38 +187,44 @@ void vtkForceDirectedLayoutStrategy::Layout()
   vtkIdType numEdges = this->Graph->GetNumberOfEdges();
 
   // Begin iterations.
-  double norm, fr, fa, minimum;
+  double norm, fa, minimum;
   double diff[3];
   for (int i = 0; i < this->IterationsPerLayout; i++)
   {
-    // Calculate the repulsive forces.
-    for (vtkIdType j = 0; j < numVertices; j++)
-    {
-      v[j].d[0] = 0.0;
-      v[j].d[1] = 0.0;
-      v[j].d[2] = 0.0;
-      for (vtkIdType l = 0; l < numVertices; l++)
+    // Calculate the repulsive forces. Every vertex reads all positions but
+    // accumulates only into its own delta, so this O(n^2) pass -- the
+    // dominant cost of the layout -- parallelizes cleanly over vertices.
+    vtkSMPTools::For(0, numVertices, [this, numVertices](vtkIdType begin, vtkIdType end) {
+      double rdiff[3];
+      for (vtkIdType j = begin; j < end; j++)
       {
-        if (j != l)
+        v[j].d[0] = 0.0;
+        v[j].d[1] = 0.0;
+        v[j].d[2] = 0.0;
+        for (vtkIdType l = 0; l < numVertices; l++)
         {
-          diff[0] = v[j].x[0] - v[l].x[0];
-          diff[1] = v[j].x[1] - v[l].x[1];
-          diff[2] = v[j].x[2] - v[l].x[2];
-          norm = vtkMath::Normalize(diff);
-          if (norm > 2 * optDist)
+          if (j != l)
           {
-            fr = 0;
+            rdiff[0] = v[j].x[0] - v[l].x[0];
+            rdiff[1] = v[j].x[1] - v[l].x[1];
+            rdiff[2] = v[j].x[2] - v[l].x[2];
+            double rnorm = vtkMath::Normalize(rdiff);
+            double fr;
+            if (rnorm > 2 * optDist)
+            {
+              fr = 0;
+            }
+            else
+            {
+              fr = forceRepulse(rnorm, optDist);
+            }
+            v[j].d[0] += rdiff[0] * fr;
+            v[j].d[1] += rdiff[1] * fr;
+            v[j].d[2] += rdiff[2] * fr;
           }
-          else
-          {
-            fr = forceRepulse(norm, optDist);
-          }
-          v[j].d[0] += diff[0] * fr;
-          v[j].d[1] += diff[1] * fr;
-          v[j].d[2] += diff[2] * fr;
         }
       }
-    }
+    });
 
     // Calculate the attractive forces.
     for (vtkIdType j = 0; j < numEdges; j++)
@@ -6,6 +6,7 @@
 #include "vtkEvent.h"
 #include "vtkRenderWindowInteractor.h"
 #include "vtkRenderer.h"
+#include "vtkTimerLog.h"
 #include "vtkWidgetCallbackMapper.h"
 #include "vtkWidgetEvent.h"
 #include "vtkWidgetEventTranslator.h"
@@ -33,6 +34,10 @@ vtkAbstractWidget::vtkAbstractWidget()
   // Does this widget respond to interaction?
   this->ProcessEvents = 1;
 
+  // Process every move event unless the user asks for coalescing
+  this->CoalesceMoveEvents = 0;
+  this->LastMoveEventTime = 0.0;
+
   // Okay, set up the event translations for the subclasses.
   this->EventTranslator = vtkWidgetEventTranslator::New();
   this->CallbackMapper = vtkWidgetCallbackMapper::New();
@@ -237,6 +242,25 @@ void vtkAbstractWidget::ProcessEventsHandler(
     }
   }
 
+  // Optionally collapse the high-frequency stream of move events down to
+  // at most one per frame, where the frame time comes from the interactor's
+  // desired update rate. Dropping an intermediate move is harmless since
+  // the callbacks read the current event position from the interactor, so
+  // the next processed event (a later move, or the end of the interaction)
+  // brings the widget up to date.
+  if (self->CoalesceMoveEvents && self->Interactor &&
+    (widgetEvent == vtkWidgetEvent::Move || widgetEvent == vtkWidgetEvent::Move3D))
+  {
+    double rate = self->Interactor->GetDesiredUpdateRate();
+    double minInterval = (rate > 0.0 ? 1.0 / rate : 0.0);
+    double eventTime = vtkTimerLog::GetUniversalTime();
+    if (eventTime - self->LastMoveEventTime < minInterval)
+    {
+      return;
+    }
+    self->LastMoveEventTime = eventTime;
+  }
+
   // Save the call data for widgets if needed
   self->CallData = calldata;
 
@@ -320,6 +344,8 @@ void vtkAbstractWidget::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "ProcessEvents: " << (this->ProcessEvents ? "On" : "Off") << "\n";
 
+  os << indent << "Coalesce Move Events: " << (this->CoalesceMoveEvents ? "On" : "Off") << "\n";
+
   if (this->WidgetRep)
   {
     os << indent << "Widget Representation: " << this->WidgetRep << "\n";
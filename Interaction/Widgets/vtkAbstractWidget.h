@@ -87,6 +87,23 @@ public:
   vtkBooleanMacro(ProcessEvents, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on coalescing of move events. Pointer moves can be delivered far
+   * faster than frames can be rendered, and every one of them triggers a
+   * full recomputation of the widget representation. When coalescing is
+   * enabled, move events that arrive less than a frame apart - as defined
+   * by the interactor's desired update rate - are dropped, so the
+   * representation is recomputed at most once per frame. This is safe
+   * because the widget callbacks read the current event position from the
+   * interactor, so the widget state catches up on the next processed
+   * event. Events other than moves are never dropped. Off by default.
+   */
+  vtkSetClampMacro(CoalesceMoveEvents, vtkTypeBool, 0, 1);
+  vtkGetMacro(CoalesceMoveEvents, vtkTypeBool);
+  vtkBooleanMacro(CoalesceMoveEvents, vtkTypeBool);
+  ///@}
+
   /**
    * Get the event translator. Careful manipulation of this class enables
    * the user to override the default event bindings.
@@ -187,6 +204,11 @@ protected:
   // On by default.
   vtkTypeBool ProcessEvents;
 
+  // Support for coalescing move events. Off by default; when on, move
+  // events arriving less than a frame apart are dropped.
+  vtkTypeBool CoalesceMoveEvents;
+  double LastMoveEventTime;
+
   // Used by subclasses to ensure different events comes from the same
   // hardware device. Such as starting a move with the right controller
   // should then only respond to move events from the right controller.
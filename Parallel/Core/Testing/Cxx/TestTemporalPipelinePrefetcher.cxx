@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkTemporalPipelinePrefetcher.h"
+
+#include "vtkDoubleArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+
+// A time-aware source slow enough that the overlap of one step's update
+// with the consumption of the previous one is observable.
+class vtkClockSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkClockSource* New();
+  vtkTypeMacro(vtkClockSource, vtkPolyDataAlgorithm);
+
+  std::atomic<int> ExecutionCount{ 0 };
+
+protected:
+  vtkClockSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    double times[5] = { 0.0, 1.0, 2.0, 3.0, 4.0 };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), times, 5);
+    double range[2] = { times[0], times[4] };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    vtkNew<vtkPoints> points;
+    points->InsertNextPoint(time, 0.0, 0.0);
+    output->SetPoints(points);
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("time");
+    values->InsertNextValue(time);
+    output->GetPointData()->AddArray(values);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+
+    ++this->ExecutionCount;
+    return 1;
+  }
+};
+
+vtkStandardNewMacro(vtkClockSource);
+
+//------------------------------------------------------------------------------
+double GetSnapshotTime(vtkDataObject* snapshot)
+{
+  vtkPolyData* polyData = vtkPolyData::SafeDownCast(snapshot);
+  return vtkDoubleArray::SafeDownCast(polyData->GetPointData()->GetArray("time"))->GetValue(0);
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+int TestTemporalPipelinePrefetcher(int, char*[])
+{
+  vtkNew<vtkClockSource> source;
+  vtkNew<vtkTemporalPipelinePrefetcher> prefetcher;
+  prefetcher->SetPipeline(source);
+
+  if (!prefetcher->Start())
+  {
+    std::cerr << "Start failed on a pipeline advertising time steps" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The first snapshot is handed over while the second step is still
+  // executing — or not yet started — on the worker.
+  double time = -1.0;
+  vtkSmartPointer<vtkDataObject> first = prefetcher->GetNext(&time);
+  if (!first || time != 0.0 || GetSnapshotTime(first) != 0.0)
+  {
+    std::cerr << "Wrong snapshot for the first time step" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // While the caller holds the first snapshot, the second step executes.
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (source->ExecutionCount.load() < 2 && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  if (source->ExecutionCount.load() < 2)
+  {
+    std::cerr << "The next step did not execute while the snapshot was held" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The remaining steps come out in order, and the snapshots must keep
+  // their values while later steps overwrite the pipeline output.
+  std::vector<vtkSmartPointer<vtkDataObject>> snapshots;
+  snapshots.push_back(first);
+  while (prefetcher->HasNext())
+  {
+    vtkSmartPointer<vtkDataObject> snapshot = prefetcher->GetNext(&time);
+    if (!snapshot || time != static_cast<double>(snapshots.size()) ||
+      GetSnapshotTime(snapshot) != time)
+    {
+      std::cerr << "Wrong snapshot at time " << time << std::endl;
+      return EXIT_FAILURE;
+    }
+    snapshots.push_back(snapshot);
+  }
+  if (snapshots.size() != 5 || prefetcher->GetNext() != nullptr)
+  {
+    std::cerr << "Iteration returned " << snapshots.size() << " steps" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (size_t i = 0; i < snapshots.size(); ++i)
+  {
+    if (GetSnapshotTime(snapshots[i]) != static_cast<double>(i))
+    {
+      std::cerr << "Snapshot " << i << " was clobbered by a later step" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (source->ExecutionCount.load() != 5)
+  {
+    std::cerr << "Source executed " << source->ExecutionCount.load() << " times" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Explicit time steps override the ones the pipeline advertises.
+  prefetcher->SetTimeSteps({ 3.0, 1.0 });
+  if (!prefetcher->Start())
+  {
+    std::cerr << "Start failed with explicit time steps" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (double expected : { 3.0, 1.0 })
+  {
+    vtkSmartPointer<vtkDataObject> snapshot = prefetcher->GetNext(&time);
+    if (!snapshot || time != expected || GetSnapshotTime(snapshot) != expected)
+    {
+      std::cerr << "Wrong snapshot for explicit time step " << expected << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (prefetcher->HasNext())
+  {
+    std::cerr << "Iteration did not finish after the explicit time steps" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAsyncPipelineUpdater.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkAlgorithmOutput.h"
+#include "vtkDemandDrivenPipeline.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkAsyncPipelineUpdater);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Run the data pass of one algorithm. Its inputs are guaranteed up to date
+// by the task dependencies, so the recursive upstream forward inside
+// UpdateData is a short-circuited walk.
+int RunDataPass(vtkSmartPointer<vtkAlgorithm> algorithm)
+{
+  int port = algorithm->GetNumberOfOutputPorts() > 0 ? 0 : -1;
+  if (vtkDemandDrivenPipeline* ddp =
+        vtkDemandDrivenPipeline::SafeDownCast(algorithm->GetExecutive()))
+  {
+    return ddp->UpdateData(port);
+  }
+  return algorithm->GetExecutive()->Update(port);
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkAsyncPipelineUpdater::vtkAsyncPipelineUpdater()
+{
+  this->Queue->SetNumberOfThreads(2);
+}
+
+//------------------------------------------------------------------------------
+vtkAsyncPipelineUpdater::~vtkAsyncPipelineUpdater()
+{
+  this->Wait();
+}
+
+//------------------------------------------------------------------------------
+void vtkAsyncPipelineUpdater::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Queue:\n";
+  this->Queue->PrintSelf(os, indent.GetNextIndent());
+  os << indent << "Number of tracked algorithms: " << this->LastTask.size() << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkAsyncPipelineUpdater::SetNumberOfThreads(int numberOfThreads)
+{
+  this->Queue->SetNumberOfThreads(numberOfThreads);
+}
+
+//------------------------------------------------------------------------------
+vtkAsyncPipelineUpdater::FuturePointer vtkAsyncPipelineUpdater::UpdateAsync(vtkAlgorithm* sink)
+{
+  return this->UpdateAsync(std::vector<vtkAlgorithm*>{ sink })[0];
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkAsyncPipelineUpdater::FuturePointer> vtkAsyncPipelineUpdater::UpdateAsync(
+  const std::vector<vtkAlgorithm*>& sinks)
+{
+  // The information and update-extent passes mutate information objects
+  // shared between branches; run them serially here so the tasks only
+  // ever perform the data pass.
+  for (vtkAlgorithm* sink : sinks)
+  {
+    sink->UpdateInformation();
+  }
+  for (vtkAlgorithm* sink : sinks)
+  {
+    if (vtkStreamingDemandDrivenPipeline* sddp =
+          vtkStreamingDemandDrivenPipeline::SafeDownCast(sink->GetExecutive()))
+    {
+      sddp->PropagateUpdateExtent(sink->GetNumberOfOutputPorts() > 0 ? 0 : -1);
+    }
+  }
+
+  // One task per algorithm within this call, even when several sinks
+  // share upstream algorithms.
+  std::map<vtkAlgorithm*, FuturePointer> pushed;
+  std::vector<FuturePointer> futures;
+  futures.reserve(sinks.size());
+  for (vtkAlgorithm* sink : sinks)
+  {
+    futures.push_back(this->PushAlgorithm(sink, pushed));
+  }
+  return futures;
+}
+
+//------------------------------------------------------------------------------
+vtkAsyncPipelineUpdater::FuturePointer vtkAsyncPipelineUpdater::PushAlgorithm(
+  vtkAlgorithm* algorithm, std::map<vtkAlgorithm*, FuturePointer>& pushed)
+{
+  auto alreadyPushed = pushed.find(algorithm);
+  if (alreadyPushed != pushed.end())
+  {
+    return alreadyPushed->second;
+  }
+
+  // Producers first; their futures become this task's dependencies.
+  std::vector<vtkThreadedCallbackQueue::SharedFutureBasePointer> dependencies;
+  for (int port = 0; port < algorithm->GetNumberOfInputPorts(); ++port)
+  {
+    for (int index = 0; index < algorithm->GetNumberOfInputConnections(port); ++index)
+    {
+      vtkAlgorithmOutput* connection = algorithm->GetInputConnection(port, index);
+      if (vtkAlgorithm* producer = connection ? connection->GetProducer() : nullptr)
+      {
+        dependencies.emplace_back(this->PushAlgorithm(producer, pushed));
+      }
+    }
+  }
+
+  // Chain after the last task pushed for this algorithm by an earlier
+  // call, so an algorithm never runs concurrently with itself.
+  auto lastTask = this->LastTask.find(algorithm);
+  if (lastTask != this->LastTask.end())
+  {
+    dependencies.emplace_back(lastTask->second);
+  }
+
+  FuturePointer future = dependencies.empty()
+    ? this->Queue->Push(&RunDataPass, vtkSmartPointer<vtkAlgorithm>(algorithm))
+    : this->Queue->PushDependent(
+        dependencies, &RunDataPass, vtkSmartPointer<vtkAlgorithm>(algorithm));
+  pushed[algorithm] = future;
+  this->LastTask[algorithm] = future;
+  return future;
+}
+
+//------------------------------------------------------------------------------
+void vtkAsyncPipelineUpdater::Wait()
+{
+  std::vector<vtkThreadedCallbackQueue::SharedFutureBasePointer> futures;
+  futures.reserve(this->LastTask.size());
+  for (const auto& task : this->LastTask)
+  {
+    futures.emplace_back(task.second);
+  }
+  this->Queue->Wait(futures);
+}
+VTK_ABI_NAMESPACE_END
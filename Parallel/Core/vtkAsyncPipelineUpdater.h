@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkAsyncPipelineUpdater
+ * @brief Updates pipelines as a task graph, running independent branches
+ * concurrently.
+ *
+ * A standard `Update()` walks the pipeline serially, so two branches that
+ * do not depend on each other — say two contour filters feeding one
+ * renderer — still execute one after the other. `UpdateAsync()` instead
+ * turns every algorithm reachable upstream of the given sink into a task
+ * on a `vtkThreadedCallbackQueue`, with one dependency edge per input
+ * connection, and returns the sink's `vtkSharedFuture` immediately. Tasks
+ * with no unfinished dependencies run concurrently, so independent
+ * branches overlap; the caller blocks only when it calls `Wait()` or
+ * `Get()` on the returned future.
+ *
+ * The information and update-extent passes are propagated synchronously on
+ * the calling thread before any task is pushed; only the data pass is
+ * scheduled. Each algorithm's task therefore finds its inputs already up
+ * to date and runs exactly its own `RequestData`.
+ *
+ * One updater instance remembers the last task pushed per algorithm and
+ * chains new tasks after it, so overlapping calls to `UpdateAsync()` —
+ * two sinks sharing an upstream source, or the same sink after a
+ * parameter change — never execute the same algorithm concurrently.
+ * Distinct updater instances provide no such ordering and must not be
+ * used on pipelines that share algorithms.
+ *
+ * @sa
+ * vtkThreadedCallbackQueue vtkAlgorithm
+ */
+
+#ifndef vtkAsyncPipelineUpdater_h
+#define vtkAsyncPipelineUpdater_h
+
+#include "vtkNew.h" // For the task queue
+#include "vtkParallelCoreModule.h"
+#include "vtkThreadedCallbackQueue.h" // For the returned futures
+
+#include <map>    // For the per-algorithm future map
+#include <vector> // For the multi-sink overload
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkExecutive;
+
+class VTKPARALLELCORE_EXPORT vtkAsyncPipelineUpdater : public vtkObject
+{
+public:
+  static vtkAsyncPipelineUpdater* New();
+  vtkTypeMacro(vtkAsyncPipelineUpdater, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * The waitable handle returned by `UpdateAsync`. `Wait()` blocks until
+   * the sink's data pass has finished; `Get()` additionally returns the
+   * pass's status (1 on success, as returned by the executive).
+   */
+  using FuturePointer = vtkThreadedCallbackQueue::SharedFuturePointer<int>;
+
+  /**
+   * Schedule the data pass of every algorithm upstream of `sink`
+   * (inclusive) and return without waiting. The returned future completes
+   * when the sink's output is up to date.
+   */
+  FuturePointer UpdateAsync(vtkAlgorithm* sink);
+
+  /**
+   * Schedule several sinks at once. Algorithms shared between the sinks'
+   * pipelines are scheduled once and their task is a dependency of both
+   * futures.
+   */
+  std::vector<FuturePointer> UpdateAsync(const std::vector<vtkAlgorithm*>& sinks);
+
+  /**
+   * Block until every task pushed by this updater so far has finished.
+   */
+  void Wait();
+
+  /**
+   * Set the number of threads the underlying queue runs on. The default
+   * is 2; see `vtkThreadedCallbackQueue::SetNumberOfThreads`.
+   */
+  void SetNumberOfThreads(int numberOfThreads);
+
+protected:
+  vtkAsyncPipelineUpdater();
+  ~vtkAsyncPipelineUpdater() override;
+
+private:
+  vtkAsyncPipelineUpdater(const vtkAsyncPipelineUpdater&) = delete;
+  void operator=(const vtkAsyncPipelineUpdater&) = delete;
+
+  /**
+   * Push a task for `algorithm` after recursively pushing its producers,
+   * reusing tasks already pushed during this or earlier calls.
+   */
+  FuturePointer PushAlgorithm(
+    vtkAlgorithm* algorithm, std::map<vtkAlgorithm*, FuturePointer>& pushed);
+
+  vtkNew<vtkThreadedCallbackQueue> Queue;
+  // Last task pushed per algorithm; new tasks for the same algorithm are
+  // chained after it so an algorithm never runs concurrently with itself.
+  std::map<vtkAlgorithm*, FuturePointer> LastTask;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
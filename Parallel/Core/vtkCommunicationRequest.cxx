@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCommunicationRequest.h"
+
+#include "vtkObjectFactory.h"
+
+#include <utility>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkCommunicationRequest);
+
+//------------------------------------------------------------------------------
+vtkCommunicationRequest::vtkCommunicationRequest() = default;
+
+//------------------------------------------------------------------------------
+vtkCommunicationRequest::~vtkCommunicationRequest() = default;
+
+//------------------------------------------------------------------------------
+bool vtkCommunicationRequest::Test()
+{
+  return this->Completed;
+}
+
+//------------------------------------------------------------------------------
+void vtkCommunicationRequest::Wait()
+{
+  // The base class has no pending backend operation to wait on; subclasses
+  // with a real nonblocking backend override this.
+  this->Test();
+}
+
+//------------------------------------------------------------------------------
+void vtkCommunicationRequest::SetCompletionCallback(std::function<void()> callback)
+{
+  this->Callback = std::move(callback);
+  if (this->Completed && this->Callback)
+  {
+    std::function<void()> callback2;
+    std::swap(callback2, this->Callback);
+    callback2();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCommunicationRequest::MarkCompleted()
+{
+  if (!this->Completed)
+  {
+    this->Completed = true;
+    if (this->Callback)
+    {
+      // Clear before invoking so a callback that re-enters cannot fire twice.
+      std::function<void()> callback;
+      std::swap(callback, this->Callback);
+      callback();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCommunicationRequest::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Completed: " << (this->Completed ? "yes" : "no") << "\n";
+  os << indent << "Callback: " << (this->Callback ? "set" : "(none)") << "\n";
+}
+VTK_ABI_NAMESPACE_END
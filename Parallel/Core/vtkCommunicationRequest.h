@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCommunicationRequest
+ * @brief   Future for a nonblocking communication operation
+ *
+ * vtkCommunicationRequest is the handle returned by the nonblocking
+ * collective methods on vtkMultiProcessController (IAllReduce, IGather,
+ * IAllGather). It supports test/wait/callback semantics: poll completion
+ * with Test() while doing local work, block in Wait() when the result is
+ * finally needed, and optionally register a callback that runs exactly once
+ * when completion is first observed.
+ *
+ * An instance of this base class is always already complete; controllers
+ * without a nonblocking backend (serial, socket) perform the operation
+ * immediately and return such a request, so algorithms can overlap
+ * communication with computation without backend-specific code.
+ * vtkMPIController returns subclasses backed by true nonblocking MPI
+ * collectives.
+ *
+ * @sa
+ * vtkMultiProcessController vtkMPIController
+ */
+
+#ifndef vtkCommunicationRequest_h
+#define vtkCommunicationRequest_h
+
+#include "vtkObject.h"
+#include "vtkParallelCoreModule.h" // For export macro
+
+#include <functional> // For the completion callback
+
+VTK_ABI_NAMESPACE_BEGIN
+
+class VTKPARALLELCORE_EXPORT vtkCommunicationRequest : public vtkObject
+{
+public:
+  static vtkCommunicationRequest* New();
+  vtkTypeMacro(vtkCommunicationRequest, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Advance the operation if possible and return true once it has completed.
+   * Never blocks. The receive buffers of the originating collective are only
+   * valid after this returns true (or after Wait()).
+   */
+  virtual bool Test();
+
+  /**
+   * Block until the operation has completed.
+   */
+  virtual void Wait();
+
+  /**
+   * Return whether completion has already been observed, without advancing
+   * the operation.
+   */
+  bool IsComplete() { return this->Completed; }
+
+  /**
+   * Register a function to invoke exactly once when completion is first
+   * observed, from the thread calling Test() or Wait(). If the request has
+   * already completed the callback is invoked immediately.
+   */
+  void SetCompletionCallback(std::function<void()> callback);
+
+  /**
+   * Mark the request complete and invoke the completion callback if one is
+   * set. For use by the controller implementations that create requests; not
+   * intended for users of the request.
+   */
+  void MarkCompleted();
+
+protected:
+  vtkCommunicationRequest();
+  ~vtkCommunicationRequest() override;
+
+  bool Completed = false;
+  std::function<void()> Callback;
+
+private:
+  vtkCommunicationRequest(const vtkCommunicationRequest&) = delete;
+  void operator=(const vtkCommunicationRequest&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
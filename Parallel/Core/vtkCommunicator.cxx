@@ -3,6 +3,8 @@
 #include "vtkCommunicator.h"
 
 #include "vtkBoundingBox.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
 #include "vtkCharArray.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataObjectTypes.h"
@@ -10,6 +12,7 @@
 #include "vtkDataSetReader.h"
 #include "vtkDataSetWriter.h"
 #include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
 #include "vtkFloatArray.h"
 #include "vtkGenericDataObjectReader.h"
 #include "vtkGenericDataObjectWriter.h"
@@ -19,6 +22,10 @@
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
 #include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
@@ -27,6 +34,7 @@
 #include "vtkTypeTraits.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedLongArray.h"
+#include "vtkUnstructuredGrid.h"
 
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
@@ -198,9 +206,149 @@ int vtkCommunicator::Send(vtkDataObject* data, int remoteHandle, int tag)
   }
 }
 
+namespace
+{
+
+//------------------------------------------------------------------------------
+// Sends the array's data type ahead of the array itself so the receiver can
+// allocate an array of the matching type before calling
+// vtkCommunicator::Receive(vtkDataArray*). A type of -1 denotes a null array.
+int SendTypedArray(vtkCommunicator* comm, vtkDataArray* array, int remoteHandle, int tag)
+{
+  int type = array ? array->GetDataType() : -1;
+  comm->Send(&type, 1, remoteHandle, tag);
+  if (type == -1)
+  {
+    return 1;
+  }
+  return comm->Send(array, remoteHandle, tag);
+}
+
+//------------------------------------------------------------------------------
+int ReceiveTypedArray(
+  vtkCommunicator* comm, vtkSmartPointer<vtkDataArray>& array, int remoteHandle, int tag)
+{
+  array = nullptr;
+  int type;
+  if (!comm->Receive(&type, 1, remoteHandle, tag))
+  {
+    return 0;
+  }
+  if (type == -1)
+  {
+    return 1;
+  }
+  array.TakeReference(vtkDataArray::CreateDataArray(type));
+  return comm->Receive(array, remoteHandle, tag);
+}
+
+//------------------------------------------------------------------------------
+int SendFieldDataArrays(vtkCommunicator* comm, vtkFieldData* fieldData, int remoteHandle, int tag)
+{
+  int numArrays = fieldData->GetNumberOfArrays();
+  comm->Send(&numArrays, 1, remoteHandle, tag);
+  for (int i = 0; i < numArrays; i++)
+  {
+    if (!SendTypedArray(comm, fieldData->GetArray(i), remoteHandle, tag))
+    {
+      return 0;
+    }
+  }
+  if (vtkDataSetAttributes* attributes = vtkDataSetAttributes::SafeDownCast(fieldData))
+  {
+    int attributeIndices[vtkDataSetAttributes::NUM_ATTRIBUTES];
+    attributes->GetAttributeIndices(attributeIndices);
+    comm->Send(attributeIndices, vtkDataSetAttributes::NUM_ATTRIBUTES, remoteHandle, tag);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int ReceiveFieldDataArrays(
+  vtkCommunicator* comm, vtkFieldData* fieldData, int remoteHandle, int tag)
+{
+  fieldData->Initialize();
+  int numArrays;
+  if (!comm->Receive(&numArrays, 1, remoteHandle, tag))
+  {
+    return 0;
+  }
+  for (int i = 0; i < numArrays; i++)
+  {
+    vtkSmartPointer<vtkDataArray> array;
+    if (!ReceiveTypedArray(comm, array, remoteHandle, tag))
+    {
+      return 0;
+    }
+    if (array)
+    {
+      fieldData->AddArray(array);
+    }
+  }
+  if (vtkDataSetAttributes* attributes = vtkDataSetAttributes::SafeDownCast(fieldData))
+  {
+    int attributeIndices[vtkDataSetAttributes::NUM_ATTRIBUTES];
+    if (!comm->Receive(attributeIndices, vtkDataSetAttributes::NUM_ATTRIBUTES, remoteHandle, tag))
+    {
+      return 0;
+    }
+    for (int attr = 0; attr < vtkDataSetAttributes::NUM_ATTRIBUTES; attr++)
+    {
+      if (attributeIndices[attr] >= 0)
+      {
+        attributes->SetActiveAttribute(attributeIndices[attr], attr);
+      }
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+// The direct array-by-array path only handles vtkDataArray attributes; data
+// sets carrying abstract arrays (strings, variants) take the marshaled path.
+bool CanSendDirect(vtkDataObject* data)
+{
+  int type = data->GetDataObjectType();
+  if (type != VTK_POLY_DATA && type != VTK_UNSTRUCTURED_GRID)
+  {
+    return false;
+  }
+  vtkPointSet* pointSet = vtkPointSet::SafeDownCast(data);
+  vtkFieldData* fields[3] = { pointSet->GetPointData(), pointSet->GetCellData(),
+    pointSet->GetFieldData() };
+  for (vtkFieldData* fieldData : fields)
+  {
+    for (int i = 0; i < fieldData->GetNumberOfArrays(); i++)
+    {
+      if (!vtkDataArray::SafeDownCast(fieldData->GetAbstractArray(i)))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 int vtkCommunicator::SendElementalDataObject(vtkDataObject* data, int remoteHandle, int tag)
 {
+  // Poly data and unstructured grids -- the types exchanged by the
+  // redistribution and transmit filters -- are sent array by array, skipping
+  // the writer marshaling and its transient full-size copy. The receiver is
+  // told which path was taken so both formats stay receivable.
+  int type = data ? data->GetDataObjectType() : -1;
+  if (type == VTK_POLY_DATA || type == VTK_UNSTRUCTURED_GRID)
+  {
+    int direct = CanSendDirect(data) ? 1 : 0;
+    this->Send(&direct, 1, remoteHandle, tag);
+    if (direct)
+    {
+      return this->SendPointSetDataObject(vtkPointSet::SafeDownCast(data), remoteHandle, tag);
+    }
+  }
+
   VTK_CREATE(vtkCharArray, buffer);
   if (vtkCommunicator::MarshalDataObject(data, buffer))
   {
@@ -211,6 +359,46 @@ int vtkCommunicator::SendElementalDataObject(vtkDataObject* data, int remoteHand
   return 0;
 }
 
+//------------------------------------------------------------------------------
+int vtkCommunicator::SendPointSetDataObject(vtkPointSet* data, int remoteHandle, int tag)
+{
+  vtkPoints* points = data->GetPoints();
+  if (!SendTypedArray(this, points ? points->GetData() : nullptr, remoteHandle, tag))
+  {
+    return 0;
+  }
+
+  if (vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(data))
+  {
+    vtkCellArray* cells = grid->GetCells();
+    if (!SendTypedArray(this, grid->GetCellTypesArray(), remoteHandle, tag) ||
+      !SendTypedArray(this, cells ? cells->GetOffsetsArray() : nullptr, remoteHandle, tag) ||
+      !SendTypedArray(this, cells ? cells->GetConnectivityArray() : nullptr, remoteHandle, tag) ||
+      !SendTypedArray(this, grid->GetFaceLocations(), remoteHandle, tag) ||
+      !SendTypedArray(this, grid->GetFaces(), remoteHandle, tag))
+    {
+      return 0;
+    }
+  }
+  else if (vtkPolyData* polyData = vtkPolyData::SafeDownCast(data))
+  {
+    vtkCellArray* cellArrays[4] = { polyData->GetVerts(), polyData->GetLines(),
+      polyData->GetPolys(), polyData->GetStrips() };
+    for (vtkCellArray* cells : cellArrays)
+    {
+      if (!SendTypedArray(this, cells ? cells->GetOffsetsArray() : nullptr, remoteHandle, tag) ||
+        !SendTypedArray(this, cells ? cells->GetConnectivityArray() : nullptr, remoteHandle, tag))
+      {
+        return 0;
+      }
+    }
+  }
+
+  return SendFieldDataArrays(this, data->GetPointData(), remoteHandle, tag) &&
+    SendFieldDataArrays(this, data->GetCellData(), remoteHandle, tag) &&
+    SendFieldDataArrays(this, data->GetFieldData(), remoteHandle, tag);
+}
+
 //------------------------------------------------------------------------------
 int vtkCommunicator::Send(vtkDataArray* data, int remoteHandle, int tag)
 {
@@ -396,6 +584,22 @@ int vtkCommunicator::ReceiveDataObject(vtkDataObject* data, int remoteHandle, in
 //------------------------------------------------------------------------------
 int vtkCommunicator::ReceiveElementalDataObject(vtkDataObject* data, int remoteHandle, int tag)
 {
+  // Mirror SendElementalDataObject: for poly data and unstructured grids the
+  // sender first announces whether the direct array-by-array path was taken.
+  int type = data ? data->GetDataObjectType() : -1;
+  if (type == VTK_POLY_DATA || type == VTK_UNSTRUCTURED_GRID)
+  {
+    int direct;
+    if (!this->Receive(&direct, 1, remoteHandle, tag))
+    {
+      return 0;
+    }
+    if (direct)
+    {
+      return this->ReceivePointSetDataObject(vtkPointSet::SafeDownCast(data), remoteHandle, tag);
+    }
+  }
+
   VTK_CREATE(vtkCharArray, buffer);
   if (!this->Receive(buffer, remoteHandle, tag))
   {
@@ -405,6 +609,87 @@ int vtkCommunicator::ReceiveElementalDataObject(vtkDataObject* data, int remoteH
   return vtkCommunicator::UnMarshalDataObject(buffer, data);
 }
 
+//------------------------------------------------------------------------------
+int vtkCommunicator::ReceivePointSetDataObject(vtkPointSet* data, int remoteHandle, int tag)
+{
+  data->Initialize();
+
+  vtkSmartPointer<vtkDataArray> pointsArray;
+  if (!ReceiveTypedArray(this, pointsArray, remoteHandle, tag))
+  {
+    return 0;
+  }
+  if (pointsArray)
+  {
+    vtkNew<vtkPoints> points;
+    points->SetData(pointsArray);
+    data->SetPoints(points);
+  }
+
+  if (vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(data))
+  {
+    vtkSmartPointer<vtkDataArray> cellTypes;
+    vtkSmartPointer<vtkDataArray> offsets;
+    vtkSmartPointer<vtkDataArray> connectivity;
+    vtkSmartPointer<vtkDataArray> faceLocations;
+    vtkSmartPointer<vtkDataArray> faces;
+    if (!ReceiveTypedArray(this, cellTypes, remoteHandle, tag) ||
+      !ReceiveTypedArray(this, offsets, remoteHandle, tag) ||
+      !ReceiveTypedArray(this, connectivity, remoteHandle, tag) ||
+      !ReceiveTypedArray(this, faceLocations, remoteHandle, tag) ||
+      !ReceiveTypedArray(this, faces, remoteHandle, tag))
+    {
+      return 0;
+    }
+    if (cellTypes && offsets && connectivity)
+    {
+      vtkNew<vtkCellArray> cells;
+      cells->SetData(offsets, connectivity);
+      grid->SetCells(vtkArrayDownCast<vtkUnsignedCharArray>(cellTypes.Get()), cells,
+        vtkArrayDownCast<vtkIdTypeArray>(faceLocations.Get()),
+        vtkArrayDownCast<vtkIdTypeArray>(faces.Get()));
+    }
+  }
+  else if (vtkPolyData* polyData = vtkPolyData::SafeDownCast(data))
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      vtkSmartPointer<vtkDataArray> offsets;
+      vtkSmartPointer<vtkDataArray> connectivity;
+      if (!ReceiveTypedArray(this, offsets, remoteHandle, tag) ||
+        !ReceiveTypedArray(this, connectivity, remoteHandle, tag))
+      {
+        return 0;
+      }
+      if (!offsets || !connectivity)
+      {
+        continue;
+      }
+      vtkNew<vtkCellArray> cells;
+      cells->SetData(offsets, connectivity);
+      switch (i)
+      {
+        case 0:
+          polyData->SetVerts(cells);
+          break;
+        case 1:
+          polyData->SetLines(cells);
+          break;
+        case 2:
+          polyData->SetPolys(cells);
+          break;
+        case 3:
+          polyData->SetStrips(cells);
+          break;
+      }
+    }
+  }
+
+  return ReceiveFieldDataArrays(this, data->GetPointData(), remoteHandle, tag) &&
+    ReceiveFieldDataArrays(this, data->GetCellData(), remoteHandle, tag) &&
+    ReceiveFieldDataArrays(this, data->GetFieldData(), remoteHandle, tag);
+}
+
 int vtkCommunicator::Receive(vtkDataArray* data, int remoteHandle, int tag)
 {
   // If we are receiving with ANY_SOURCE, we have a problem because some
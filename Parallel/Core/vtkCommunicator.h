@@ -35,6 +35,7 @@ class vtkIdTypeArray;
 class vtkImageData;
 class vtkMultiBlockDataSet;
 class vtkMultiProcessStream;
+class vtkPointSet;
 
 class VTKPARALLELCORE_EXPORT vtkCommunicator : public vtkObject
 {
@@ -1316,6 +1317,20 @@ protected:
 
   // Internal methods called by Send/Receive(vtkDataObject *... ) above.
   int SendElementalDataObject(vtkDataObject* data, int remoteHandle, int tag);
+
+  ///@{
+  /**
+   * Structure-aware transfer of vtkPolyData and vtkUnstructuredGrid used by
+   * SendElementalDataObject/ReceiveElementalDataObject. Every vtkDataArray
+   * buffer (points, cell topology, attributes) is sent directly with a small
+   * header instead of marshaling the whole data set through the legacy
+   * writer, which avoids the serialize/deserialize time and the transient
+   * full-size copy of the marshaled buffer.
+   */
+  int SendPointSetDataObject(vtkPointSet* data, int remoteHandle, int tag);
+  int ReceivePointSetDataObject(vtkPointSet* data, int remoteHandle, int tag);
+  ///@}
+
   ///@{
   /**
    * GatherV collects arrays in the process with id \c destProcessId.
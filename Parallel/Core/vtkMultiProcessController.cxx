@@ -7,6 +7,7 @@
 #include "vtkByteSwap.h"
 #include "vtkCollection.h"
 #include "vtkCommand.h"
+#include "vtkCommunicationRequest.h"
 #include "vtkDataArraySelection.h"
 #include "vtkDummyController.h"
 #include "vtkEndian.h"
@@ -790,6 +791,38 @@ int vtkMultiProcessController::AllReduce(
   return 0;
 }
 
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicationRequest> vtkMultiProcessController::IAllReduceVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int operation)
+{
+  // No nonblocking backend at this level: run the blocking collective now and
+  // hand back an already-completed request.
+  this->Communicator->AllReduceVoidArray(sendBuffer, recvBuffer, length, type, operation);
+  auto request = vtkSmartPointer<vtkCommunicationRequest>::New();
+  request->MarkCompleted();
+  return request;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicationRequest> vtkMultiProcessController::IGatherVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int destProcessId)
+{
+  this->Communicator->GatherVoidArray(sendBuffer, recvBuffer, length, type, destProcessId);
+  auto request = vtkSmartPointer<vtkCommunicationRequest>::New();
+  request->MarkCompleted();
+  return request;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicationRequest> vtkMultiProcessController::IAllGatherVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type)
+{
+  this->Communicator->AllGatherVoidArray(sendBuffer, recvBuffer, length, type);
+  auto request = vtkSmartPointer<vtkCommunicationRequest>::New();
+  request->MarkCompleted();
+  return request;
+}
+
 //----------------------------------------------------------------------------
 int vtkMultiProcessController::Reduce(
   vtkDataArraySelection* sendBuffer, vtkDataArraySelection* recvBuffer, int destProcessId)
@@ -40,10 +40,12 @@
 #include "vtkObject.h"
 #include "vtkParallelCoreModule.h" // For export macro
 
-#include "vtkCommunicator.h" // Needed for direct access to communicator
+#include "vtkCommunicator.h"  // Needed for direct access to communicator
+#include "vtkSmartPointer.h"  // For the nonblocking collective requests
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkBoundingBox;
+class vtkCommunicationRequest;
 class vtkCollection;
 class vtkDataObject;
 class vtkDataSet;
@@ -1398,6 +1400,105 @@ public:
   int AllReduce(vtkDataArraySelection* sendBuffer, vtkDataArraySelection* recvBuffer);
   ///@}
 
+  ///@{
+  /**
+   * Nonblocking collectives. These start the collective and return a request
+   * future with test/wait/callback semantics (see vtkCommunicationRequest);
+   * the receive buffer is only valid once the request has completed, and the
+   * send and receive buffers must stay alive until then. All processes must
+   * call the collective in the same order.
+   *
+   * The default implementation performs the corresponding blocking collective
+   * immediately and returns an already-completed request, which keeps these
+   * usable (degenerate) with the serial and socket controllers;
+   * vtkMPIController overrides them with true nonblocking MPI collectives so
+   * callers can overlap communication with local computation without
+   * backend-specific code.
+   */
+  virtual vtkSmartPointer<vtkCommunicationRequest> IAllReduceVoidArray(
+    const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int operation);
+  virtual vtkSmartPointer<vtkCommunicationRequest> IGatherVoidArray(
+    const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int destProcessId);
+  virtual vtkSmartPointer<vtkCommunicationRequest> IAllGatherVoidArray(
+    const void* sendBuffer, void* recvBuffer, vtkIdType length, int type);
+  ///@}
+
+  ///@{
+  /**
+   * Typed convenience overloads for the nonblocking collectives.
+   */
+  vtkSmartPointer<vtkCommunicationRequest> IAllReduce(
+    const int* sendBuffer, int* recvBuffer, vtkIdType length, int operation)
+  {
+    return this->IAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_INT, operation);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllReduce(
+    const long* sendBuffer, long* recvBuffer, vtkIdType length, int operation)
+  {
+    return this->IAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_LONG, operation);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllReduce(
+    const unsigned long* sendBuffer, unsigned long* recvBuffer, vtkIdType length, int operation)
+  {
+    return this->IAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_UNSIGNED_LONG, operation);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllReduce(
+    const long long* sendBuffer, long long* recvBuffer, vtkIdType length, int operation)
+  {
+    return this->IAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_LONG_LONG, operation);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllReduce(
+    const float* sendBuffer, float* recvBuffer, vtkIdType length, int operation)
+  {
+    return this->IAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_FLOAT, operation);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllReduce(
+    const double* sendBuffer, double* recvBuffer, vtkIdType length, int operation)
+  {
+    return this->IAllReduceVoidArray(sendBuffer, recvBuffer, length, VTK_DOUBLE, operation);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IGather(
+    const int* sendBuffer, int* recvBuffer, vtkIdType length, int destProcessId)
+  {
+    return this->IGatherVoidArray(sendBuffer, recvBuffer, length, VTK_INT, destProcessId);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IGather(
+    const long long* sendBuffer, long long* recvBuffer, vtkIdType length, int destProcessId)
+  {
+    return this->IGatherVoidArray(sendBuffer, recvBuffer, length, VTK_LONG_LONG, destProcessId);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IGather(
+    const float* sendBuffer, float* recvBuffer, vtkIdType length, int destProcessId)
+  {
+    return this->IGatherVoidArray(sendBuffer, recvBuffer, length, VTK_FLOAT, destProcessId);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IGather(
+    const double* sendBuffer, double* recvBuffer, vtkIdType length, int destProcessId)
+  {
+    return this->IGatherVoidArray(sendBuffer, recvBuffer, length, VTK_DOUBLE, destProcessId);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllGather(
+    const int* sendBuffer, int* recvBuffer, vtkIdType length)
+  {
+    return this->IAllGatherVoidArray(sendBuffer, recvBuffer, length, VTK_INT);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllGather(
+    const long long* sendBuffer, long long* recvBuffer, vtkIdType length)
+  {
+    return this->IAllGatherVoidArray(sendBuffer, recvBuffer, length, VTK_LONG_LONG);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllGather(
+    const float* sendBuffer, float* recvBuffer, vtkIdType length)
+  {
+    return this->IAllGatherVoidArray(sendBuffer, recvBuffer, length, VTK_FLOAT);
+  }
+  vtkSmartPointer<vtkCommunicationRequest> IAllGather(
+    const double* sendBuffer, double* recvBuffer, vtkIdType length)
+  {
+    return this->IAllGatherVoidArray(sendBuffer, recvBuffer, length, VTK_DOUBLE);
+  }
+  ///@}
+
   /**
    * Check if this controller implements a probe operation
    */
@@ -4,6 +4,7 @@
 
 #include "vtkClientSocket.h"
 #include "vtkCommand.h"
+#include "vtkLZ4DataCompressor.h"
 #include "vtkObjectFactory.h"
 #include "vtkServerSocket.h"
 #include "vtkSocketController.h"
@@ -13,6 +14,7 @@
 #include <cassert>
 
 #include <algorithm>
+#include <cstring>
 #include <list>
 #include <map>
 #include <vector>
@@ -99,6 +101,10 @@ vtkSocketCommunicator::vtkSocketCommunicator()
   this->BufferMessage = false;
 
   this->ReportErrors = 1;
+  this->EnableCompression = 0;
+  this->CompressionThreshold = 1024;
+  this->Compressor = vtkLZ4DataCompressor::New();
+  this->BatchMessages = false;
   this->ReceivedMessageBuffer = new vtkSocketCommunicator::vtkMessageBuffer();
 }
 
@@ -107,6 +113,8 @@ vtkSocketCommunicator::~vtkSocketCommunicator()
 {
   this->SetSocket(nullptr);
   this->SetLogStream(nullptr);
+  this->Compressor->Delete();
+  this->Compressor = nullptr;
   delete this->ReceivedMessageBuffer;
   this->ReceivedMessageBuffer = nullptr;
 }
@@ -145,6 +153,9 @@ void vtkSocketCommunicator::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Perform a handshake: " << (this->PerformHandshake ? "Yes" : "No") << endl;
 
   os << indent << "ReportErrors: " << this->ReportErrors << endl;
+  os << indent << "EnableCompression: " << (this->EnableCompression ? "On" : "Off") << endl;
+  os << indent << "CompressionThreshold: " << this->CompressionThreshold << endl;
+  os << indent << "BatchMessages: " << (this->BatchMessages ? "On" : "Off") << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -259,21 +270,34 @@ int vtkSocketCommunicator::SendVoidArray(
   }
 
   const char* byteData = reinterpret_cast<const char*>(data);
-  int maxSend = VTK_INT_MAX / typeSize;
-  // If sending an array longer than the maximum number that can be held
-  // in an integer, break up the array into pieces.
-  while (length >= maxSend)
+  if (this->EnableCompression &&
+    length * static_cast<vtkIdType>(typeSize) >= this->CompressionThreshold)
   {
-    if (!this->SendTagged(byteData, typeSize, maxSend, tag, typeName.c_str()))
+    // The receiver makes the same decision from its EnableCompression and
+    // CompressionThreshold settings, which is why both ends must agree.
+    if (!this->SendCompressed(byteData, length, typeSize, tag, typeName.c_str()))
     {
       return 0;
     }
-    byteData += maxSend * typeSize;
-    length -= maxSend;
   }
-  if (!this->SendTagged(byteData, typeSize, length, tag, typeName.c_str()))
+  else
   {
-    return 0;
+    int maxSend = VTK_INT_MAX / typeSize;
+    // If sending an array longer than the maximum number that can be held
+    // in an integer, break up the array into pieces.
+    while (length >= maxSend)
+    {
+      if (!this->SendTagged(byteData, typeSize, maxSend, tag, typeName.c_str()))
+      {
+        return 0;
+      }
+      byteData += maxSend * typeSize;
+      length -= maxSend;
+    }
+    if (!this->SendTagged(byteData, typeSize, length, tag, typeName.c_str()))
+    {
+      return 0;
+    }
   }
 #ifdef ENABLE_SYNCHRONIZED_COMMUNICATION
   int status[3] = { 0, 0, 0 };
@@ -331,24 +355,34 @@ int vtkSocketCommunicator::ReceiveVoidArray(
   }
 
   char* byteData = reinterpret_cast<char*>(data);
-  int maxReceive = VTK_INT_MAX / typeSize;
-  // If receiving an array longer than the maximum number that can be held
-  // in an integer, break up the array into pieces.
   int ret = 0;
-  while (this->ReceiveTagged(
-    byteData, typeSize, vtkSocketCommunicatorMin(maxReceive, length), tag, typeName.c_str()))
+  if (this->EnableCompression &&
+    length * static_cast<vtkIdType>(typeSize) >= this->CompressionThreshold)
+  {
+    // Mirrors the decision made by the sender in SendVoidArray; both ends
+    // must be configured with the same compression settings.
+    ret = this->ReceiveCompressed(byteData, length, typeSize, tag, typeName.c_str());
+  }
+  else
   {
-    this->Count += this->TagMessageLength;
-    byteData += this->TagMessageLength * typeSize;
-    length -= this->TagMessageLength;
-    if (this->TagMessageLength < maxReceive)
+    int maxReceive = VTK_INT_MAX / typeSize;
+    // If receiving an array longer than the maximum number that can be held
+    // in an integer, break up the array into pieces.
+    while (this->ReceiveTagged(
+      byteData, typeSize, vtkSocketCommunicatorMin(maxReceive, length), tag, typeName.c_str()))
     {
-      // words_received in this packet is exactly equal to maxReceive, then it
-      // means that the sender is sending at least one more packet for this
-      // message. Otherwise, we have received all the packets for this message
-      // and we no longer need to iterate.
-      ret = 1;
-      break;
+      this->Count += this->TagMessageLength;
+      byteData += this->TagMessageLength * typeSize;
+      length -= this->TagMessageLength;
+      if (this->TagMessageLength < maxReceive)
+      {
+        // words_received in this packet is exactly equal to maxReceive, then it
+        // means that the sender is sending at least one more packet for this
+        // message. Otherwise, we have received all the packets for this message
+        // and we no longer need to iterate.
+        ret = 1;
+        break;
+      }
     }
   }
 
@@ -688,25 +722,84 @@ int vtkSocketCommunicator::ConnectTo(const char* hostName, int port)
   return this->ClientSideHandshake();
 }
 
+//------------------------------------------------------------------------------
+void vtkSocketCommunicator::BeginMessageBatching()
+{
+  this->BatchMessages = true;
+}
+
+//------------------------------------------------------------------------------
+int vtkSocketCommunicator::EndMessageBatching()
+{
+  this->BatchMessages = false;
+  int success = 1;
+  // The batch is flushed with as few socket writes as possible (one, unless
+  // it exceeds the int length vtkSocket::Send accepts). The wire content is
+  // identical to sending each queued message individually.
+  const char* ptr = this->BatchSendBuffer.data();
+  size_t left = this->BatchSendBuffer.size();
+  while (left > 0 && success)
+  {
+    int sendSize =
+      (left > static_cast<size_t>(VTK_INT_MAX)) ? VTK_INT_MAX : static_cast<int>(left);
+    if (!this->Socket->Send(ptr, sendSize))
+    {
+      vtkSocketCommunicatorErrorMacro("Could not send batched messages.");
+      success = 0;
+    }
+    ptr += sendSize;
+    left -= sendSize;
+  }
+  this->BatchSendBuffer.clear();
+  return success;
+}
+
 //------------------------------------------------------------------------------
 int vtkSocketCommunicator::SendTagged(
   const void* data, int wordSize, int numWords, int tag, const char* logName)
 {
-  if (!this->Socket->Send(&tag, static_cast<int>(sizeof(int))))
+  int header[2] = { tag, wordSize * numWords };
+  const int length = header[1];
+
+  if (this->BatchMessages)
   {
-    vtkSocketCommunicatorErrorMacro("Could not send tag.");
-    return 0;
+    // Queue the message; it goes on the wire in EndMessageBatching().
+    const char* headerBytes = reinterpret_cast<const char*>(header);
+    this->BatchSendBuffer.insert(
+      this->BatchSendBuffer.end(), headerBytes, headerBytes + sizeof(header));
+    if (length > 0)
+    {
+      const char* bytes = reinterpret_cast<const char*>(data);
+      this->BatchSendBuffer.insert(this->BatchSendBuffer.end(), bytes, bytes + length);
+    }
+    this->LogTagged("Queued", data, wordSize, numWords, tag, logName);
+    return 1;
   }
-  int length = wordSize * numWords;
-  if (!this->Socket->Send(&length, static_cast<int>(sizeof(int))))
+
+  // Coalesce the tag, the length and a small payload into a single socket
+  // write. Sending them separately costs up to three TCP packets per
+  // message, which dominates the transfer time of small messages.
+  constexpr int coalesceLimit = 1024;
+  if (length > 0 && length <= coalesceLimit)
   {
-    vtkSocketCommunicatorErrorMacro("Could not send length.");
-    return 0;
+    char message[sizeof(header) + coalesceLimit];
+    memcpy(message, header, sizeof(header));
+    memcpy(message + sizeof(header), data, length);
+    if (!this->Socket->Send(message, static_cast<int>(sizeof(header)) + length))
+    {
+      vtkSocketCommunicatorErrorMacro("Could not send message.");
+      return 0;
+    }
   }
-  // Only do the actual send if there is some data in the message.
-  if (length > 0)
+  else
   {
-    if (!this->Socket->Send(data, length))
+    if (!this->Socket->Send(header, static_cast<int>(sizeof(header))))
+    {
+      vtkSocketCommunicatorErrorMacro("Could not send tag.");
+      return 0;
+    }
+    // Only do the actual send if there is some data in the message.
+    if (length > 0 && !this->Socket->Send(data, length))
     {
       vtkSocketCommunicatorErrorMacro("Could not send message.");
       return 0;
@@ -902,6 +995,124 @@ void vtkSocketCommunicator::FixByteOrder(void* data, int wordSize, int numWords)
   }
 }
 
+//------------------------------------------------------------------------------
+// Largest number of words per compressed chunk such that the compressed
+// chunk is guaranteed to fit in a single tagged message. Both sides compute
+// the same value, which lets the receiver detect the final (short) chunk the
+// same way the uncompressed path does.
+static int vtkSocketCommunicatorCompressChunk(vtkDataCompressor* compressor, int typeSize)
+{
+  int maxWords = VTK_INT_MAX / typeSize;
+  while (maxWords > 1 &&
+    compressor->GetMaximumCompressionSpace(static_cast<size_t>(maxWords) * typeSize) >
+      static_cast<size_t>(VTK_INT_MAX))
+  {
+    maxWords /= 2;
+  }
+  return maxWords;
+}
+
+//------------------------------------------------------------------------------
+int vtkSocketCommunicator::SendCompressed(
+  const char* byteData, vtkIdType length, int typeSize, int tag, const char* logName)
+{
+  const int maxWords = vtkSocketCommunicatorCompressChunk(this->Compressor, typeSize);
+  std::vector<unsigned char> compressed;
+  // Mirror the uncompressed path: full chunks followed by a final short
+  // (possibly empty) chunk so that the receiver can detect the last one.
+  // Each chunk is a pair of tagged messages: a header carrying the word
+  // count and the compressed byte count, then the compressed bytes.
+  for (int lastChunk = 0; !lastChunk;)
+  {
+    int chunkWords;
+    if (length >= maxWords)
+    {
+      chunkWords = maxWords;
+    }
+    else
+    {
+      chunkWords = static_cast<int>(length);
+      lastChunk = 1;
+    }
+    size_t chunkBytes = static_cast<size_t>(chunkWords) * typeSize;
+    int header[2] = { chunkWords, 0 };
+    if (chunkBytes > 0)
+    {
+      compressed.resize(this->Compressor->GetMaximumCompressionSpace(chunkBytes));
+      size_t compressedSize = this->Compressor->Compress(
+        reinterpret_cast<const unsigned char*>(byteData), chunkBytes, compressed.data(),
+        compressed.size());
+      if (compressedSize == 0)
+      {
+        vtkSocketCommunicatorErrorMacro("Could not compress message.");
+        return 0;
+      }
+      header[1] = static_cast<int>(compressedSize);
+    }
+    if (!this->SendTagged(header, static_cast<int>(sizeof(int)), 2, tag, "compressed header"))
+    {
+      return 0;
+    }
+    if (header[1] > 0 && !this->SendTagged(compressed.data(), 1, header[1], tag, logName))
+    {
+      return 0;
+    }
+    byteData += chunkBytes;
+    length -= chunkWords;
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkSocketCommunicator::ReceiveCompressed(
+  char* byteData, vtkIdType length, int typeSize, int tag, const char* logName)
+{
+  const int maxWords = vtkSocketCommunicatorCompressChunk(this->Compressor, typeSize);
+  std::vector<unsigned char> compressed;
+  while (true)
+  {
+    int header[2];
+    if (!this->ReceiveTagged(header, static_cast<int>(sizeof(int)), 2, tag, "compressed header"))
+    {
+      return 0;
+    }
+    int chunkWords = header[0];
+    int compressedSize = header[1];
+    if (chunkWords < 0 || chunkWords > length || compressedSize < 0)
+    {
+      vtkSocketCommunicatorErrorMacro("Invalid compressed message header.");
+      return 0;
+    }
+    size_t chunkBytes = static_cast<size_t>(chunkWords) * typeSize;
+    if (compressedSize > 0)
+    {
+      compressed.resize(compressedSize);
+      if (!this->ReceiveTagged(compressed.data(), 1, compressedSize, tag, logName))
+      {
+        return 0;
+      }
+      if (this->Compressor->Uncompress(compressed.data(), compressedSize,
+            reinterpret_cast<unsigned char*>(byteData), chunkBytes) != chunkBytes)
+      {
+        vtkSocketCommunicatorErrorMacro("Could not uncompress message.");
+        return 0;
+      }
+      // The compressed bytes travel as a char message, so byte order has to
+      // be fixed here on the uncompressed words.
+      this->FixByteOrder(byteData, typeSize, chunkWords);
+    }
+    this->Count += chunkWords;
+    byteData += chunkBytes;
+    length -= chunkWords;
+    if (chunkWords < maxWords)
+    {
+      // As in ReceiveVoidArray, a full chunk means the sender has at least
+      // one more chunk for this message; a short chunk is the last one.
+      return 1;
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 bool vtkSocketCommunicator::HasBufferredMessages()
 {
@@ -28,6 +28,8 @@
 
 #include "vtkByteSwap.h" // Needed for vtkSwap macros
 
+#include <vector> // For BatchSendBuffer
+
 #ifdef VTK_WORDS_BIGENDIAN
 #define vtkSwap4 vtkByteSwap::Swap4LE
 #define vtkSwap4Range vtkByteSwap::Swap4LERange
@@ -42,6 +44,7 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkClientSocket;
+class vtkDataCompressor;
 class vtkServerSocket;
 
 class VTKPARALLELCORE_EXPORT vtkSocketCommunicator : public vtkCommunicator
@@ -173,6 +176,45 @@ public:
   vtkGetMacro(ReportErrors, int);
   ///@}
 
+  ///@{
+  /**
+   * Enable LZ4 compression of array payloads. When on, arrays whose size in
+   * bytes is at least CompressionThreshold are sent as a compressed stream
+   * and decompressed on the receiving side. These settings are not
+   * negotiated over the wire (just like PerformHandshake), so both ends of
+   * the connection must be configured identically. Off by default.
+   */
+  vtkSetClampMacro(EnableCompression, vtkTypeBool, 0, 1);
+  vtkBooleanMacro(EnableCompression, vtkTypeBool);
+  vtkGetMacro(EnableCompression, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * Minimum size of an array, in bytes, for it to be compressed when
+   * EnableCompression is on. Compressing small messages costs more than the
+   * bytes it saves. Both ends must use the same threshold. Default is 1024.
+   */
+  vtkSetClampMacro(CompressionThreshold, int, 0, VTK_INT_MAX);
+  vtkGetMacro(CompressionThreshold, int);
+  ///@}
+
+  ///@{
+  /**
+   * Coalesce outgoing messages into a single socket write. Between
+   * BeginMessageBatching() and EndMessageBatching() all sends are queued in
+   * a buffer which is flushed with one write when the batch ends; this
+   * avoids a round trip worth of latency per message when sending many
+   * small messages. The wire format is unchanged, so the receiving side
+   * needs no matching calls; however, no receives may be issued on this
+   * communicator while a batch is open since the queued messages have not
+   * been sent yet. EndMessageBatching() returns 1 on success, 0 on error.
+   */
+  void BeginMessageBatching();
+  int EndMessageBatching();
+  vtkGetMacro(BatchMessages, bool);
+  ///@}
+
   ///@{
   /**
    * Get/Set the actual socket used for communication.
@@ -239,6 +281,13 @@ protected:
 
   int ReportErrors;
 
+  vtkTypeBool EnableCompression;
+  int CompressionThreshold;
+  vtkDataCompressor* Compressor;
+
+  bool BatchMessages;
+  std::vector<char> BatchSendBuffer;
+
   ostream* LogFile;
   ostream* LogStream;
 
@@ -254,6 +303,19 @@ protected:
   int ReceivedTaggedFromBuffer(
     void* data, int wordSize, int numWords, int tag, const char* logName);
 
+  ///@{
+  /**
+   * Send/receive an array as an LZ4 compressed stream of tagged messages.
+   * Used by Send/ReceiveVoidArray when EnableCompression is on and the
+   * array is at least CompressionThreshold bytes. Return 1 for success,
+   * and 0 for failure.
+   */
+  int SendCompressed(const char* byteData, vtkIdType length, int typeSize, int tag,
+    const char* logName);
+  int ReceiveCompressed(char* byteData, vtkIdType length, int typeSize, int tag,
+    const char* logName);
+  ///@}
+
   /**
    * Fix byte order for received data.
    */
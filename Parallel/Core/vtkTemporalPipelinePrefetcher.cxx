@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkTemporalPipelinePrefetcher.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkObjectFactory.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkTemporalPipelinePrefetcher);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Update the pipeline for one time step and snapshot its output. The
+// shallow copy keeps the step's arrays alive while the next update
+// replaces the pipeline output with freshly allocated ones.
+vtkSmartPointer<vtkDataObject> RunTimeStep(
+  vtkSmartPointer<vtkAlgorithm> sink, int outputPort, double time)
+{
+  if (!sink->UpdateTimeStep(time))
+  {
+    return nullptr;
+  }
+  vtkDataObject* output = sink->GetOutputDataObject(outputPort);
+  if (!output)
+  {
+    return nullptr;
+  }
+  auto snapshot = vtkSmartPointer<vtkDataObject>::Take(output->NewInstance());
+  snapshot->ShallowCopy(output);
+  return snapshot;
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkTemporalPipelinePrefetcher::vtkTemporalPipelinePrefetcher()
+{
+  this->Queue->SetNumberOfThreads(1);
+}
+
+//------------------------------------------------------------------------------
+vtkTemporalPipelinePrefetcher::~vtkTemporalPipelinePrefetcher()
+{
+  this->Stop();
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalPipelinePrefetcher::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Pipeline: " << this->Pipeline << "\n";
+  os << indent << "OutputPort: " << this->OutputPort << "\n";
+  os << indent << "Number of time steps: " << this->TimeSteps.size() << "\n";
+  os << indent << "Next step: " << this->NextStep << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalPipelinePrefetcher::SetPipeline(vtkAlgorithm* sink, int outputPort)
+{
+  if (this->Pipeline == sink && this->OutputPort == outputPort)
+  {
+    return;
+  }
+  this->Stop();
+  this->Pipeline = sink;
+  this->OutputPort = outputPort;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalPipelinePrefetcher::SetTimeSteps(const std::vector<double>& timeSteps)
+{
+  this->RequestedTimeSteps = timeSteps;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkTemporalPipelinePrefetcher::Start()
+{
+  this->Stop();
+  if (!this->Pipeline)
+  {
+    vtkWarningMacro("No pipeline set, nothing to iterate over.");
+    return false;
+  }
+
+  this->TimeSteps = this->RequestedTimeSteps;
+  if (this->TimeSteps.empty())
+  {
+    // The information pass runs on the calling thread; the worker only
+    // ever performs the per-step updates.
+    this->Pipeline->UpdateInformation();
+    vtkInformation* outInfo = this->Pipeline->GetOutputInformation(this->OutputPort);
+    if (outInfo && outInfo->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+    {
+      int length = outInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+      double* times = outInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+      this->TimeSteps.assign(times, times + length);
+    }
+  }
+  if (this->TimeSteps.empty())
+  {
+    vtkWarningMacro("The pipeline does not advertise time steps and none were "
+                    "set with SetTimeSteps.");
+    return false;
+  }
+
+  this->NextStep = 0;
+  this->Prefetch();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkTemporalPipelinePrefetcher::HasNext()
+{
+  return this->Pending != nullptr;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkTemporalPipelinePrefetcher::GetNext(double* time)
+{
+  if (!this->Pending)
+  {
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkDataObject> snapshot = this->Queue->Get(this->Pending);
+  if (time)
+  {
+    *time = this->TimeSteps[this->NextStep];
+  }
+  this->Pending = nullptr;
+
+  // Schedule the following step before returning, so it executes while
+  // the caller consumes the snapshot.
+  ++this->NextStep;
+  if (this->NextStep < this->TimeSteps.size())
+  {
+    this->Prefetch();
+  }
+  return snapshot;
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalPipelinePrefetcher::Stop()
+{
+  if (this->Pending)
+  {
+    this->Queue->Wait(
+      std::vector<vtkThreadedCallbackQueue::SharedFutureBasePointer>{ this->Pending });
+    this->Pending = nullptr;
+  }
+  this->NextStep = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalPipelinePrefetcher::Prefetch()
+{
+  this->Pending = this->Queue->Push(
+    &RunTimeStep, this->Pipeline, this->OutputPort, this->TimeSteps[this->NextStep]);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkTemporalPipelinePrefetcher
+ * @brief Executes the next time step of a pipeline while the current one
+ * is consumed.
+ *
+ * Stepping through a time series with `UpdateTimeStep()` serializes the
+ * pipeline update and whatever the caller does with the result: rendering
+ * step t waits for the update of t, and the update of t+1 waits for the
+ * rendering of t. vtkTemporalPipelinePrefetcher overlaps the two with a
+ * double buffer. `GetNext()` returns a shallow-copied snapshot of the
+ * current step's output and immediately schedules the update of the next
+ * step on a worker thread, so that step executes while the caller renders
+ * or processes the snapshot it was handed.
+ *
+ * The snapshot is safe to read while the next step executes because
+ * re-executing the pipeline allocates fresh output arrays rather than
+ * writing into the previous ones. The pipeline itself is owned by the
+ * worker between `Start()` and the last `GetNext()`: the caller must not
+ * update it, change its parameters or read its outputs directly during
+ * the iteration, only through the returned snapshots.
+ *
+ * The time steps are read from the sink's output information during
+ * `Start()`; `SetTimeSteps()` overrides them for pipelines that do not
+ * advertise `TIME_STEPS()`. A typical loop is
+ *
+ * @code
+ * prefetcher->SetPipeline(sink);
+ * prefetcher->Start();
+ * while (prefetcher->HasNext())
+ * {
+ *   double time;
+ *   vtkSmartPointer<vtkDataObject> data = prefetcher->GetNext(&time);
+ *   Render(data, time); // overlaps the update of the next step
+ * }
+ * @endcode
+ *
+ * @sa
+ * vtkAsyncPipelineUpdater vtkThreadedCallbackQueue vtkAlgorithm
+ */
+
+#ifndef vtkTemporalPipelinePrefetcher_h
+#define vtkTemporalPipelinePrefetcher_h
+
+#include "vtkNew.h" // For the task queue
+#include "vtkParallelCoreModule.h"
+#include "vtkSmartPointer.h"          // For the pipeline and the snapshots
+#include "vtkThreadedCallbackQueue.h" // For the pending future
+
+#include <vector> // For the time steps
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkDataObject;
+
+class VTKPARALLELCORE_EXPORT vtkTemporalPipelinePrefetcher : public vtkObject
+{
+public:
+  static vtkTemporalPipelinePrefetcher* New();
+  vtkTypeMacro(vtkTemporalPipelinePrefetcher, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Set the sink whose output is iterated and the output port to read.
+   * Changing the pipeline stops any iteration in progress.
+   */
+  void SetPipeline(vtkAlgorithm* sink, int outputPort = 0);
+
+  /**
+   * Override the time steps to iterate over. When this is not called, or
+   * called with an empty vector, `Start()` reads the time steps the
+   * pipeline advertises in its output information.
+   */
+  void SetTimeSteps(const std::vector<double>& timeSteps);
+
+  /**
+   * Begin the iteration: update the pipeline information, resolve the
+   * time steps and schedule the update of the first one on the worker.
+   * Returns false when no pipeline is set or no time steps are found.
+   */
+  bool Start();
+
+  /**
+   * Whether a step is pending; false once every time step has been
+   * returned by `GetNext()`.
+   */
+  bool HasNext();
+
+  /**
+   * Wait for the pending step, schedule the update of the step after it
+   * and return the pending step's output as a shallow-copied snapshot.
+   * The step's time is stored in `time` when it is non-null. Returns
+   * null when the iteration is exhausted or the update failed.
+   */
+  vtkSmartPointer<vtkDataObject> GetNext(double* time = nullptr);
+
+  /**
+   * Abandon the iteration, blocking until the in-flight update has
+   * finished. Called implicitly by `SetPipeline()` and the destructor.
+   */
+  void Stop();
+
+protected:
+  vtkTemporalPipelinePrefetcher();
+  ~vtkTemporalPipelinePrefetcher() override;
+
+private:
+  vtkTemporalPipelinePrefetcher(const vtkTemporalPipelinePrefetcher&) = delete;
+  void operator=(const vtkTemporalPipelinePrefetcher&) = delete;
+
+  using SnapshotFuturePointer =
+    vtkThreadedCallbackQueue::SharedFuturePointer<vtkSmartPointer<vtkDataObject>>;
+
+  /**
+   * Schedule the update of the step at `NextStep` on the worker.
+   */
+  void Prefetch();
+
+  // A single worker thread: only one step is ever in flight, overlapped
+  // with the caller consuming the previous one.
+  vtkNew<vtkThreadedCallbackQueue> Queue;
+  vtkSmartPointer<vtkAlgorithm> Pipeline;
+  int OutputPort = 0;
+  std::vector<double> RequestedTimeSteps;
+  std::vector<double> TimeSteps;
+  std::size_t NextStep = 0;
+  SnapshotFuturePointer Pending;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -33,6 +33,7 @@
 #include <atomic>
 #include <functional>
 #include <limits>
+#include <map>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -213,8 +214,43 @@ unsigned char CleanGhostsReduceAllForStructuredData(
 
   unsigned char cleanGhostMask = 0;
 
+  // The ghost array scan only depends on the block's input, so run it once per
+  // block up front; the reduction rounds below then only merge one-byte masks
+  // instead of re-scanning every ghost array on every round.
+  std::map<int, unsigned char> localGhostMasks;
+  for (int localId = 0; localId < static_cast<int>(master.size()); ++localId)
+  {
+    BlockType* block = master.block<BlockType>(localId);
+
+    unsigned char foundGhost = 0;
+    const ExtentType& extent = block->Information.Extent;
+    StructuredDataSetT* ds = block->Information.Input;
+    const int* dsExtent = ds->GetExtent();
+    const ExtentType fullExtent{ dsExtent[0], dsExtent[1], dsExtent[2], dsExtent[3], dsExtent[4],
+      dsExtent[5] };
+    if (vtkUnsignedCharArray* ghostCells = ds->GetCellGhostArray())
+    {
+      const vtkIdType numberOfCells = vtkStructuredData::GetNumberOfCells(extent.data());
+      vtkDIYGhostUtilities_detail::GhostFinder<true> worker(ghostCells, fullExtent, extent,
+        vtkDataSetAttributes::HIDDENCELL | vtkDataSetAttributes::DUPLICATECELL);
+      vtkSMPTools::For(0, numberOfCells, worker);
+
+      foundGhost |= GHOST_CELL_BIT * worker.FoundGhost;
+    }
+    if (vtkUnsignedCharArray* ghostPoints = ds->GetPointGhostArray())
+    {
+      const vtkIdType numberOfPoints = vtkStructuredData::GetNumberOfPoints(extent.data());
+      vtkDIYGhostUtilities_detail::GhostFinder<false> worker(ghostPoints, fullExtent, extent,
+        vtkDataSetAttributes::HIDDENPOINT | vtkDataSetAttributes::DUPLICATEPOINT);
+      vtkSMPTools::For(0, numberOfPoints, worker);
+
+      foundGhost |= GHOST_POINT_BIT * worker.FoundGhost;
+    }
+    localGhostMasks[master.gid(localId)] = foundGhost;
+  }
+
   diy::reduce(master, assigner, partners,
-    [&](BlockType* block, const diy::ReduceProxy& rp, const diy::RegularAllReducePartners&) {
+    [&](BlockType*, const diy::ReduceProxy& rp, const diy::RegularAllReducePartners&) {
       // step 1 dequeue and merge
       for (int i = 0; i < rp.in_link().size(); ++i)
       {
@@ -225,30 +261,7 @@ unsigned char CleanGhostsReduceAllForStructuredData(
         cleanGhostMask |= currentMask;
       }
 
-      unsigned char foundGhost = 0;
-      const ExtentType& extent = block->Information.Extent;
-      StructuredDataSetT* ds = block->Information.Input;
-      const int* dsExtent = ds->GetExtent();
-      const ExtentType fullExtent{ dsExtent[0], dsExtent[1], dsExtent[2], dsExtent[3], dsExtent[4],
-        dsExtent[5] };
-      if (vtkUnsignedCharArray* ghostCells = ds->GetCellGhostArray())
-      {
-        const vtkIdType numberOfCells = vtkStructuredData::GetNumberOfCells(extent.data());
-        vtkDIYGhostUtilities_detail::GhostFinder<true> worker(ghostCells, fullExtent, extent,
-          vtkDataSetAttributes::HIDDENCELL | vtkDataSetAttributes::DUPLICATECELL);
-        vtkSMPTools::For(0, numberOfCells, worker);
-
-        foundGhost |= GHOST_CELL_BIT * worker.FoundGhost;
-      }
-      if (vtkUnsignedCharArray* ghostPoints = ds->GetPointGhostArray())
-      {
-        const vtkIdType numberOfPoints = vtkStructuredData::GetNumberOfPoints(extent.data());
-        vtkDIYGhostUtilities_detail::GhostFinder<false> worker(ghostPoints, fullExtent, extent,
-          vtkDataSetAttributes::HIDDENPOINT | vtkDataSetAttributes::DUPLICATEPOINT);
-        vtkSMPTools::For(0, numberOfPoints, worker);
-
-        foundGhost |= GHOST_POINT_BIT * worker.FoundGhost;
-      }
+      const unsigned char foundGhost = localGhostMasks[rp.gid()];
 
       // step 2 enqueue
       for (int i = 0; i < rp.out_link().size(); ++i)
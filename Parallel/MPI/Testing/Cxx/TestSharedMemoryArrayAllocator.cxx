@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME TestSharedMemoryArrayAllocator.cxx -- Tests node-shared array broadcast
+//
+// .SECTION Description
+//  Broadcasts an array from rank 0 through a vtkSharedMemoryArrayAllocator
+//  and checks that every rank sees the source contents. When the ranks run
+//  on the same node the arrays must share one physical buffer.
+
+// VTK includes
+#include "vtkDoubleArray.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkSharedMemoryArrayAllocator.h"
+
+//------------------------------------------------------------------------------
+int TestSharedMemoryArrayAllocator(int argc, char* argv[])
+{
+  vtkMPIController* controller = vtkMPIController::New();
+  controller->Initialize(&argc, &argv, 0);
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  const int rank = controller->GetLocalProcessId();
+  const vtkIdType numTuples = 1000;
+
+  vtkNew<vtkDoubleArray> array;
+  array->SetNumberOfComponents(3);
+  if (rank == 0)
+  {
+    array->SetNumberOfTuples(numTuples);
+    for (vtkIdType i = 0; i < numTuples; ++i)
+    {
+      array->SetTuple3(i, i, 2.0 * i, 3.0 * i);
+    }
+  }
+
+  vtkNew<vtkSharedMemoryArrayAllocator> allocator;
+  allocator->SetController(controller);
+  const bool shared = allocator->SharedBroadcast(array, 0);
+
+  int errors = 0;
+
+  if (array->GetNumberOfComponents() != 3 || array->GetNumberOfTuples() != numTuples)
+  {
+    cerr << "Rank " << rank << ": wrong array dimensions after broadcast\n";
+    ++errors;
+  }
+  else
+  {
+    for (vtkIdType i = 0; i < numTuples; ++i)
+    {
+      double tuple[3];
+      array->GetTuple(i, tuple);
+      if (tuple[0] != i || tuple[1] != 2.0 * i || tuple[2] != 3.0 * i)
+      {
+        cerr << "Rank " << rank << ": wrong value at tuple " << i << "\n";
+        ++errors;
+        break;
+      }
+    }
+  }
+
+  // Sharing requires MPI-3; with older MPI the broadcast falls back to
+  // private copies, which is not an error
+  if (!shared && controller->GetNumberOfProcesses() > 1)
+  {
+    cout << "Rank " << rank << ": array was broadcast without node-shared backing\n";
+  }
+
+  // All windows must be released before MPI is finalized
+  allocator->Free();
+
+  int allErrors = 0;
+  controller->AllReduce(&errors, &allErrors, 1, vtkCommunicator::SUM_OP);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  controller->Delete();
+
+  return (allErrors == 0) ? 0 : -1;
+}
@@ -7,6 +7,7 @@
 #include "vtkMPI.h"
 #include "vtkMPIController.h"
 #include "vtkObjectFactory.h"
+#include "vtkPerformanceCounters.h"
 #include "vtkProcessGroup.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSmartPointer.h"
@@ -973,6 +974,9 @@ int vtkMPICommunicator::SendVoidArray(
       break;
   }
 
+  vtkPerformanceCounters::Add(
+    vtkPerformanceCounters::MPI_TRANSFER_BYTES, static_cast<vtkTypeUInt64>(length) * sizeOfType);
+
 #ifndef VTKMPI_64BIT_LENGTH
   int maxSend = VTK_INT_MAX;
   while (length >= maxSend)
@@ -1030,6 +1034,8 @@ int vtkMPICommunicator::ReceiveVoidArray(
       return 0;
     }
     this->Count += words_received;
+    vtkPerformanceCounters::Add(vtkPerformanceCounters::MPI_TRANSFER_BYTES,
+      static_cast<vtkTypeUInt64>(words_received) * sizeOfType);
     return 1;
   }
 #else
@@ -1055,6 +1061,8 @@ int vtkMPICommunicator::ReceiveVoidArray(
       return 0;
     }
     this->Count += words_received;
+    vtkPerformanceCounters::Add(vtkPerformanceCounters::MPI_TRANSFER_BYTES,
+      static_cast<vtkTypeUInt64>(words_received) * sizeOfType);
     byteData += words_received * sizeOfType;
     maxlength -= words_received;
     if (words_received < maxReceive)
@@ -1845,6 +1853,132 @@ int vtkMPICommunicator::AllReduceVoidArray(
   return res;
 }
 
+//------------------------------------------------------------------------------
+int vtkMPICommunicator::NoBlockAllReduceVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int operation, Request& req)
+{
+#if MPI_VERSION >= 3
+  MPI_Op mpiOp;
+  switch (operation)
+  {
+    case MAX_OP:
+      mpiOp = MPI_MAX;
+      break;
+    case MIN_OP:
+      mpiOp = MPI_MIN;
+      break;
+    case SUM_OP:
+      mpiOp = MPI_SUM;
+      break;
+    case PRODUCT_OP:
+      mpiOp = MPI_PROD;
+      break;
+    case LOGICAL_AND_OP:
+      mpiOp = MPI_LAND;
+      break;
+    case BITWISE_AND_OP:
+      mpiOp = MPI_BAND;
+      break;
+    case LOGICAL_OR_OP:
+      mpiOp = MPI_LOR;
+      break;
+    case BITWISE_OR_OP:
+      mpiOp = MPI_BOR;
+      break;
+    case LOGICAL_XOR_OP:
+      mpiOp = MPI_LXOR;
+      break;
+    case BITWISE_XOR_OP:
+      mpiOp = MPI_BXOR;
+      break;
+    default:
+      vtkWarningMacro(<< "Operation number " << operation << " not supported.");
+      return 0;
+  }
+  MPI_Datatype mpiType = vtkMPICommunicatorGetMPIType(type);
+#ifdef VTKMPI_64BIT_LENGTH
+  return CheckForMPIError(MPI_Iallreduce_c(const_cast<void*>(sendBuffer), recvBuffer, length,
+    mpiType, mpiOp, *this->MPIComm->Handle, &req.Req->Handle));
+#else
+  if (!vtkMPICommunicatorCheckSize(length))
+  {
+    return 0;
+  }
+  return CheckForMPIError(MPI_Iallreduce(const_cast<void*>(sendBuffer), recvBuffer,
+    static_cast<int>(length), mpiType, mpiOp, *this->MPIComm->Handle, &req.Req->Handle));
+#endif
+#else
+  (void)sendBuffer;
+  (void)recvBuffer;
+  (void)length;
+  (void)type;
+  (void)operation;
+  (void)req;
+  return 0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+int vtkMPICommunicator::NoBlockGatherVoidArray(const void* sendBuffer, void* recvBuffer,
+  vtkIdType length, int type, int destProcessId, Request& req)
+{
+#if MPI_VERSION >= 3
+  MPI_Datatype mpiType = vtkMPICommunicatorGetMPIType(type);
+#ifdef VTKMPI_64BIT_LENGTH
+  return CheckForMPIError(MPI_Igather_c(const_cast<void*>(sendBuffer), length, mpiType, recvBuffer,
+    length, mpiType, destProcessId, *this->MPIComm->Handle, &req.Req->Handle));
+#else
+  int numProc;
+  MPI_Comm_size(*this->MPIComm->Handle, &numProc);
+  if (!vtkMPICommunicatorCheckSize(length * numProc))
+  {
+    return 0;
+  }
+  return CheckForMPIError(MPI_Igather(const_cast<void*>(sendBuffer), static_cast<int>(length),
+    mpiType, recvBuffer, static_cast<int>(length), mpiType, destProcessId, *this->MPIComm->Handle,
+    &req.Req->Handle));
+#endif
+#else
+  (void)sendBuffer;
+  (void)recvBuffer;
+  (void)length;
+  (void)type;
+  (void)destProcessId;
+  (void)req;
+  return 0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+int vtkMPICommunicator::NoBlockAllGatherVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, Request& req)
+{
+#if MPI_VERSION >= 3
+  MPI_Datatype mpiType = vtkMPICommunicatorGetMPIType(type);
+#ifdef VTKMPI_64BIT_LENGTH
+  return CheckForMPIError(MPI_Iallgather_c(const_cast<void*>(sendBuffer), length, mpiType,
+    recvBuffer, length, mpiType, *this->MPIComm->Handle, &req.Req->Handle));
+#else
+  int numProc;
+  MPI_Comm_size(*this->MPIComm->Handle, &numProc);
+  if (!vtkMPICommunicatorCheckSize(length * numProc))
+  {
+    return 0;
+  }
+  return CheckForMPIError(MPI_Iallgather(const_cast<void*>(sendBuffer), static_cast<int>(length),
+    mpiType, recvBuffer, static_cast<int>(length), mpiType, *this->MPIComm->Handle,
+    &req.Req->Handle));
+#endif
+#else
+  (void)sendBuffer;
+  (void)recvBuffer;
+  (void)length;
+  (void)type;
+  (void)req;
+  return 0;
+#endif
+}
+
 //------------------------------------------------------------------------------
 int vtkMPICommunicator::WaitAll(int count, Request requests[])
 {
@@ -189,6 +189,24 @@ public:
     Operation* operation) override;
   ///@}
 
+  ///@{
+  /**
+   * Nonblocking versions of the collective operations, mirroring the
+   * NoBlockSend/NoBlockReceive idiom. On success the collective is started
+   * and req can be used ( req.Test() / req.Wait() ) to detect completion;
+   * the buffers must stay alive until then. Return values are 1 for success
+   * and 0 otherwise; with an MPI implementation older than MPI-3 (which
+   * introduced nonblocking collectives) these return 0 without starting
+   * anything and callers should fall back to the blocking equivalents.
+   */
+  int NoBlockAllReduceVoidArray(const void* sendBuffer, void* recvBuffer, vtkIdType length,
+    int type, int operation, Request& req);
+  int NoBlockGatherVoidArray(const void* sendBuffer, void* recvBuffer, vtkIdType length, int type,
+    int destProcessId, Request& req);
+  int NoBlockAllGatherVoidArray(
+    const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, Request& req);
+  ///@}
+
   ///@{
   /**
    * Nonblocking test for a message.  Inputs are: source -- the source rank
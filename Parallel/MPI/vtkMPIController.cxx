@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkMPIController.h"
 
+#include "vtkCommunicationRequest.h"
 #include "vtkIntArray.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOutputWindow.h"
 
@@ -402,4 +404,79 @@ bool vtkMPIController::TestSome(
     return false;
   }
 }
+
+//------------------------------------------------------------------------------
+// Request future wrapping a pending MPI collective.
+namespace
+{
+class vtkMPICommunicationRequest : public vtkCommunicationRequest
+{
+public:
+  static vtkMPICommunicationRequest* New();
+  vtkTypeMacro(vtkMPICommunicationRequest, vtkCommunicationRequest);
+
+  vtkMPICommunicator::Request Handle;
+
+  bool Test() override
+  {
+    if (!this->IsComplete() && this->Handle.Test())
+    {
+      this->MarkCompleted();
+    }
+    return this->IsComplete();
+  }
+
+  void Wait() override
+  {
+    if (!this->IsComplete())
+    {
+      this->Handle.Wait();
+      this->MarkCompleted();
+    }
+  }
+};
+vtkStandardNewMacro(vtkMPICommunicationRequest);
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicationRequest> vtkMPIController::IAllReduceVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int operation)
+{
+  vtkMPICommunicator* myMPICommunicator = (vtkMPICommunicator*)this->Communicator;
+  vtkNew<vtkMPICommunicationRequest> req;
+  if (myMPICommunicator->NoBlockAllReduceVoidArray(
+        sendBuffer, recvBuffer, length, type, operation, req->Handle))
+  {
+    return req;
+  }
+  // Pre-MPI-3 implementation (or start failure): blocking fallback.
+  return this->Superclass::IAllReduceVoidArray(sendBuffer, recvBuffer, length, type, operation);
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicationRequest> vtkMPIController::IGatherVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int destProcessId)
+{
+  vtkMPICommunicator* myMPICommunicator = (vtkMPICommunicator*)this->Communicator;
+  vtkNew<vtkMPICommunicationRequest> req;
+  if (myMPICommunicator->NoBlockGatherVoidArray(
+        sendBuffer, recvBuffer, length, type, destProcessId, req->Handle))
+  {
+    return req;
+  }
+  return this->Superclass::IGatherVoidArray(sendBuffer, recvBuffer, length, type, destProcessId);
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicationRequest> vtkMPIController::IAllGatherVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type)
+{
+  vtkMPICommunicator* myMPICommunicator = (vtkMPICommunicator*)this->Communicator;
+  vtkNew<vtkMPICommunicationRequest> req;
+  if (myMPICommunicator->NoBlockAllGatherVoidArray(sendBuffer, recvBuffer, length, type, req->Handle))
+  {
+    return req;
+  }
+  return this->Superclass::IAllGatherVoidArray(sendBuffer, recvBuffer, length, type);
+}
 VTK_ABI_NAMESPACE_END
@@ -321,6 +321,22 @@ public:
   }
   ///@}
 
+  ///@{
+  /**
+   * Nonblocking collectives backed by the MPI-3 nonblocking collective
+   * operations, wrapping the MPI request in the returned
+   * vtkCommunicationRequest. With a pre-MPI-3 implementation these fall back
+   * to the superclass's blocking behavior and return an already-completed
+   * request.
+   */
+  vtkSmartPointer<vtkCommunicationRequest> IAllReduceVoidArray(const void* sendBuffer,
+    void* recvBuffer, vtkIdType length, int type, int operation) override;
+  vtkSmartPointer<vtkCommunicationRequest> IGatherVoidArray(const void* sendBuffer,
+    void* recvBuffer, vtkIdType length, int type, int destProcessId) override;
+  vtkSmartPointer<vtkCommunicationRequest> IAllGatherVoidArray(
+    const void* sendBuffer, void* recvBuffer, vtkIdType length, int type) override;
+  ///@}
+
   ///@{
   /**
    * Nonblocking test for a message.  Inputs are: source -- the source rank
@@ -0,0 +1,270 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSharedMemoryArrayAllocator.h"
+
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkArrayDispatch.h"
+#include "vtkDataArray.h"
+#include "vtkMPI.h"
+#include "vtkMPICommunicator.h"
+#include "vtkMPIController.h"
+#include "vtkObjectFactory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// MPI_Comm_split_type and MPI_Win_allocate_shared require MPI-3
+#if (MPI_VERSION >= 3)
+#define VTK_SHARED_MEMORY_ARRAY_HAVE_MPI3 1
+#else
+#define VTK_SHARED_MEMORY_ARRAY_HAVE_MPI3 0
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+class vtkSharedMemoryArrayAllocator::vtkInternals
+{
+public:
+#if VTK_SHARED_MEMORY_ARRAY_HAVE_MPI3
+  // One communicator per node and one communicator of the node leaders,
+  // both derived lazily from the controller's communicator
+  MPI_Comm NodeComm = MPI_COMM_NULL;
+  MPI_Comm LeaderComm = MPI_COMM_NULL;
+
+  // The windows backing the attached arrays, freed collectively in Free()
+  std::vector<MPI_Win> Windows;
+#endif
+};
+
+VTK_ABI_NAMESPACE_END
+
+namespace
+{
+#if VTK_SHARED_MEMORY_ARRAY_HAVE_MPI3
+
+//------------------------------------------------------------------------------
+// Attach the node-shared buffer to the array without copying. The allocator
+// keeps ownership of the window, so the array must never free the buffer.
+struct AttachSharedBufferWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, void* buffer, vtkIdType numValues) const
+  {
+    array->SetArray(static_cast<typename ArrayT::ValueType*>(buffer), numValues, 1);
+  }
+};
+
+#endif // VTK_SHARED_MEMORY_ARRAY_HAVE_MPI3
+} // anonymous namespace
+
+VTK_ABI_NAMESPACE_BEGIN
+
+vtkStandardNewMacro(vtkSharedMemoryArrayAllocator);
+
+//------------------------------------------------------------------------------
+vtkSharedMemoryArrayAllocator::vtkSharedMemoryArrayAllocator()
+  : Controller(nullptr)
+  , Internals(new vtkInternals)
+{
+  this->SetController(
+    vtkMPIController::SafeDownCast(vtkMultiProcessController::GetGlobalController()));
+}
+
+//------------------------------------------------------------------------------
+vtkSharedMemoryArrayAllocator::~vtkSharedMemoryArrayAllocator()
+{
+  this->SetController(nullptr);
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemoryArrayAllocator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Controller: " << this->Controller << endl;
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemoryArrayAllocator::SetController(vtkMPIController* controller)
+{
+  if (this->Controller == controller)
+  {
+    return;
+  }
+
+  // The windows were created on the previous controller's communicator
+  this->Free();
+
+  vtkSetObjectBodyMacro(Controller, vtkMPIController, controller);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSharedMemoryArrayAllocator::SharedBroadcast(vtkDataArray* data, int srcProcessId)
+{
+  if (data == nullptr)
+  {
+    vtkErrorMacro("No data array given.");
+    return false;
+  }
+  if (this->Controller == nullptr)
+  {
+    vtkErrorMacro("No controller set.");
+    return false;
+  }
+  if (this->Controller->GetNumberOfProcesses() == 1)
+  {
+    // Nothing to share or broadcast
+    return false;
+  }
+
+#if VTK_SHARED_MEMORY_ARRAY_HAVE_MPI3
+  auto* communicator = vtkMPICommunicator::SafeDownCast(this->Controller->GetCommunicator());
+  if (communicator == nullptr)
+  {
+    this->Controller->Broadcast(data, srcProcessId);
+    return false;
+  }
+  MPI_Comm comm = *communicator->GetMPIComm()->GetHandle();
+
+  const int worldRank = this->Controller->GetLocalProcessId();
+  const bool isSrcProc = (worldRank == srcProcessId);
+
+  // Broadcast the array metadata so that every rank can size the window
+  vtkIdType header[3]; // data type, number of components, number of tuples
+  if (isSrcProc)
+  {
+    header[0] = data->GetDataType();
+    header[1] = data->GetNumberOfComponents();
+    header[2] = data->GetNumberOfTuples();
+  }
+  this->Controller->Broadcast(header, 3, srcProcessId);
+
+  // Sharing requires a zero-copy attachable buffer on every rank: the array
+  // must match the source type and use the standard AOS memory layout.
+  // Decide collectively so that all ranks take the same path.
+  int shareable = (data->GetDataType() == header[0] && data->HasStandardMemoryLayout() &&
+                    header[0] != VTK_BIT)
+    ? 1
+    : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &shareable, 1, MPI_INT, MPI_MIN, comm);
+  if (!shareable)
+  {
+    this->Controller->Broadcast(data, srcProcessId);
+    return false;
+  }
+
+  vtkInternals& internals = *this->Internals;
+  if (internals.NodeComm == MPI_COMM_NULL)
+  {
+    MPI_Comm_split_type(
+      comm, MPI_COMM_TYPE_SHARED, worldRank, MPI_INFO_NULL, &internals.NodeComm);
+
+    int rank;
+    MPI_Comm_rank(internals.NodeComm, &rank);
+    MPI_Comm_split(comm, rank == 0 ? 0 : MPI_UNDEFINED, worldRank, &internals.LeaderComm);
+  }
+
+  int nodeRank;
+  MPI_Comm_rank(internals.NodeComm, &nodeRank);
+
+  const vtkIdType numValues = header[1] * header[2];
+  const MPI_Aint numBytes =
+    static_cast<MPI_Aint>(numValues) * vtkDataArray::GetDataTypeSize(static_cast<int>(header[0]));
+
+  // One physical allocation per node, owned by the node leader
+  void* shared = nullptr;
+  MPI_Win window;
+  MPI_Win_allocate_shared(
+    nodeRank == 0 ? numBytes : 0, 1, MPI_INFO_NULL, internals.NodeComm, &shared, &window);
+  if (nodeRank != 0)
+  {
+    MPI_Aint size;
+    int dispUnit;
+    MPI_Win_shared_query(window, 0, &size, &dispUnit, &shared);
+  }
+
+  // The source rank seeds its node's buffer through the shared mapping
+  int hasSrc = isSrcProc ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &hasSrc, 1, MPI_INT, MPI_MAX, internals.NodeComm);
+  if (isSrcProc && numBytes > 0)
+  {
+    memcpy(shared, data->GetVoidPointer(0), numBytes);
+  }
+  MPI_Win_fence(0, window);
+
+  // The node leaders transfer the payload across nodes, rooted at the leader
+  // of the source rank's node
+  if (internals.LeaderComm != MPI_COMM_NULL)
+  {
+    int leaderRank;
+    MPI_Comm_rank(internals.LeaderComm, &leaderRank);
+
+    int root = hasSrc ? leaderRank : 0;
+    MPI_Allreduce(MPI_IN_PLACE, &root, 1, MPI_INT, MPI_MAX, internals.LeaderComm);
+
+    MPI_Aint offset = 0;
+    while (offset < numBytes)
+    {
+      const int chunk = static_cast<int>(std::min<MPI_Aint>(numBytes - offset, VTK_INT_MAX));
+      MPI_Bcast(static_cast<char*>(shared) + offset, chunk, MPI_BYTE, root, internals.LeaderComm);
+      offset += chunk;
+    }
+  }
+  MPI_Win_fence(0, window);
+
+  data->SetNumberOfComponents(static_cast<int>(header[1]));
+  if (!vtkArrayDispatch::Dispatch::Execute(
+        data, AttachSharedBufferWorker{}, shared, numValues))
+  {
+    // Cannot happen for the types accepted above, but do not leak the window
+    vtkErrorMacro("Failed to attach shared buffer to array of type " << data->GetDataTypeAsString()
+                                                                     << ".");
+    MPI_Win_free(&window);
+    return false;
+  }
+
+  internals.Windows.push_back(window);
+  return true;
+#else
+  // MPI-2: no shared windows available, fall back to private copies
+  this->Controller->Broadcast(data, srcProcessId);
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemoryArrayAllocator::Free()
+{
+#if VTK_SHARED_MEMORY_ARRAY_HAVE_MPI3
+  vtkInternals& internals = *this->Internals;
+
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if (finalized)
+  {
+    // Too late to free MPI resources
+    internals.Windows.clear();
+    internals.LeaderComm = MPI_COMM_NULL;
+    internals.NodeComm = MPI_COMM_NULL;
+    return;
+  }
+
+  for (MPI_Win& window : internals.Windows)
+  {
+    MPI_Win_free(&window);
+  }
+  internals.Windows.clear();
+
+  if (internals.LeaderComm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&internals.LeaderComm);
+  }
+  if (internals.NodeComm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&internals.NodeComm);
+  }
+#endif
+}
+VTK_ABI_NAMESPACE_END
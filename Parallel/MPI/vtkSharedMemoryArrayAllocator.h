@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSharedMemoryArrayAllocator
+ * @brief   Node-local shared-memory storage for read-only data arrays
+ *
+ * When several MPI ranks run on the same node, broadcasting a read-only
+ * array with vtkCommunicator::Broadcast leaves every rank with its own
+ * private copy of the data. For large static structures (points,
+ * connectivity) replicated this way, the per-node memory cost is the array
+ * size multiplied by the number of ranks per node.
+ *
+ * This class provides a drop-in alternative: SharedBroadcast() allocates one
+ * MPI-3 shared-memory window per node, transfers the source rank's data to
+ * each node once, and attaches the node-local mapping to the caller's array
+ * on every rank. All ranks of a node then read the same physical copy.
+ *
+ * The allocator owns the shared windows. The attached arrays stay valid
+ * only as long as the allocator is alive and Free() has not been called,
+ * and their contents must be treated as read-only. SharedBroadcast() and
+ * Free() are collective operations: every rank of the controller must call
+ * them in the same order. When sharing is not available (MPI older than
+ * version 3, or an array without the standard AOS memory layout), the data
+ * is broadcast conventionally and each rank keeps a private copy.
+ *
+ * @sa
+ * vtkMPIController vtkCommunicator
+ */
+
+#ifndef vtkSharedMemoryArrayAllocator_h
+#define vtkSharedMemoryArrayAllocator_h
+
+#include "vtkObject.h"
+#include "vtkParallelMPIModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+class vtkMPIController;
+
+class VTKPARALLELMPI_EXPORT vtkSharedMemoryArrayAllocator : public vtkObject
+{
+public:
+  static vtkSharedMemoryArrayAllocator* New();
+  vtkTypeMacro(vtkSharedMemoryArrayAllocator, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the controller the shared windows are created on. Initialized to
+   * the global controller when it is an vtkMPIController. Changing the
+   * controller frees all existing windows and is therefore collective over
+   * the previous controller.
+   */
+  virtual void SetController(vtkMPIController*);
+  vtkGetObjectMacro(Controller, vtkMPIController);
+  ///@}
+
+  /**
+   * Broadcast the array of the process identified by srcProcessId into one
+   * shared-memory buffer per node and attach that buffer to the given array
+   * on every rank. On the ranks other than the source, the array must be of
+   * the same data type as the source array; its previous contents are
+   * released. Collective over the controller.
+   *
+   * Returns true when the array is backed by node-shared storage on return.
+   * Returns false when sharing is unavailable, in which case the array holds
+   * a conventional private copy of the broadcast data.
+   */
+  bool SharedBroadcast(vtkDataArray* data, int srcProcessId);
+
+  /**
+   * Free all shared-memory windows created by this allocator. Every array
+   * attached by SharedBroadcast() becomes invalid. Collective over the
+   * controller; also invoked by the destructor.
+   */
+  void Free();
+
+protected:
+  vtkSharedMemoryArrayAllocator();
+  ~vtkSharedMemoryArrayAllocator() override;
+
+  vtkMPIController* Controller;
+
+private:
+  vtkSharedMemoryArrayAllocator(const vtkSharedMemoryArrayAllocator&) = delete;
+  void operator=(const vtkSharedMemoryArrayAllocator&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif
@@ -8,6 +8,8 @@
 #include "vtkAbstractHyperTreeGridMapper.h"
 #include "vtkAbstractVolumeMapper.h"
 #include "vtkActor.h"
+#include "vtkAssemblyNode.h"
+#include "vtkAssemblyPath.h"
 #include "vtkBitArray.h"
 #include "vtkBox.h"
 #include "vtkCamera.h"
@@ -27,7 +29,9 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolygon.h"
+#include "vtkPropCollection.h"
 #include "vtkRenderer.h"
+#include "vtkStaticCellLocator.h"
 #include "vtkTexture.h"
 #include "vtkTransform.h"
 #include "vtkUniformHyperTreeGrid.h"
@@ -45,6 +49,7 @@ vtkCellPicker::vtkCellPicker()
 {
   // List of locators for accelerating polydata picking
   this->Locators = vtkCollection::New();
+  this->AutoBuildLocators = 0;
 
   // For polydata picking
   this->Cell = vtkGenericCell::New();
@@ -97,6 +102,8 @@ void vtkCellPicker::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "PickTextureData: " << (this->PickTextureData ? "On" : "Off") << "\n";
 
+  os << indent << "AutoBuildLocators: " << (this->AutoBuildLocators ? "On" : "Off") << "\n";
+
   os << indent << "PointId: " << this->PointId << "\n";
   os << indent << "CellId: " << this->CellId << "\n";
   os << indent << "SubId: " << this->SubId << "\n";
@@ -191,6 +198,95 @@ void vtkCellPicker::RemoveAllLocators()
   this->Locators->RemoveAllItems();
 }
 
+//------------------------------------------------------------------------------
+vtkAbstractCellLocator* vtkCellPicker::BuildCachedLocator(vtkDataSet* dataSet)
+{
+  std::map<vtkDataSet*, vtkSmartPointer<vtkAbstractCellLocator>>::iterator cacheIter =
+    this->CachedLocators.find(dataSet);
+  if (cacheIter != this->CachedLocators.end())
+  {
+    // BuildLocator is a no-op unless the dataset was modified after the
+    // previous build.
+    cacheIter->second->BuildLocator();
+    return cacheIter->second;
+  }
+
+  if (dataSet->GetNumberOfCells() < 1)
+  {
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkAbstractCellLocator> locator =
+    vtkSmartPointer<vtkStaticCellLocator>::New();
+  locator->SetDataSet(dataSet);
+  locator->BuildLocator();
+  this->CachedLocators[dataSet] = locator;
+  return locator;
+}
+
+//------------------------------------------------------------------------------
+void vtkCellPicker::ClearCachedLocators()
+{
+  this->CachedLocators.clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkCellPicker::BuildLocators(vtkRenderer* renderer)
+{
+  vtkPropCollection* props;
+  if (this->PickFromList)
+  {
+    props = this->GetPickList();
+  }
+  else if (renderer)
+  {
+    props = renderer->GetViewProps();
+  }
+  else
+  {
+    return;
+  }
+
+  // Collect the datasets of the pickable actors the same way the pick pass
+  // does, and build their locators now rather than during the first pick.
+  vtkProp* prop;
+  vtkCollectionSimpleIterator pit;
+  for (props->InitTraversal(pit); (prop = props->GetNextProp(pit));)
+  {
+    vtkAssemblyPath* path;
+    for (prop->InitPathTraversal(); (path = prop->GetNextPath());)
+    {
+      vtkProp* propCandidate = path->GetLastNode()->GetViewProp();
+      if (!propCandidate->GetPickable() || !propCandidate->GetVisibility())
+      {
+        continue;
+      }
+      vtkActor* actor = vtkActor::SafeDownCast(propCandidate);
+      vtkMapper* mapper = actor ? actor->GetMapper() : nullptr;
+      if (!mapper)
+      {
+        continue;
+      }
+      if (vtkDataSet* data = mapper->GetInput())
+      {
+        this->BuildCachedLocator(data);
+      }
+      else if (vtkCompositeDataSet* composite =
+                 vtkCompositeDataSet::SafeDownCast(mapper->GetInputDataObject(0, 0)))
+      {
+        using Opts = vtk::CompositeDataSetOptions;
+        for (auto node : vtk::Range(composite, Opts::SkipEmptyNodes))
+        {
+          if (vtkDataSet* ds = vtkDataSet::SafeDownCast(node.GetDataObject()))
+          {
+            this->BuildCachedLocator(ds);
+          }
+        }
+      }
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkCellPicker::Pick(
   double selectionX, double selectionY, double selectionZ, vtkRenderer* renderer)
@@ -629,6 +725,24 @@ bool vtkCellPicker::IntersectDataSetWithLine(vtkDataSet* dataSet, const double p
     }
   }
 
+  if (!locator)
+  {
+    // Fall back to the locator cache: reuse a locator built by a previous
+    // pick or by BuildLocators(), or build one now when AutoBuildLocators
+    // is on, instead of intersecting the ray with every cell below.
+    std::map<vtkDataSet*, vtkSmartPointer<vtkAbstractCellLocator>>::iterator cacheIter =
+      this->CachedLocators.find(dataSet);
+    if (cacheIter != this->CachedLocators.end())
+    {
+      cacheIter->second->BuildLocator();
+      locator = cacheIter->second;
+    }
+    else if (this->AutoBuildLocators)
+    {
+      locator = this->BuildCachedLocator(dataSet);
+    }
+  }
+
   if (locator)
   {
     double t = tMin;
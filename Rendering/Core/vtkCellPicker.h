@@ -31,6 +31,9 @@
 
 #include "vtkPicker.h"
 #include "vtkRenderingCoreModule.h" // For export macro
+#include "vtkSmartPointer.h"        // For CachedLocators
+
+#include <map> // For CachedLocators
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkMapper;
@@ -95,6 +98,37 @@ public:
    */
   void RemoveAllLocators();
 
+  ///@{
+  /**
+   * Automatically build and cache a cell locator for each dataset the
+   * first time it is picked, instead of intersecting the ray with every
+   * cell of the dataset on every pick. The cached locator is reused by
+   * later picks and is rebuilt only when its dataset is modified. Locators
+   * added explicitly with AddLocator() always take precedence over the
+   * cache. The cache keeps a reference to each dataset, so use
+   * ClearCachedLocators() when the scene is replaced. Off by default.
+   */
+  vtkSetMacro(AutoBuildLocators, vtkTypeBool);
+  vtkBooleanMacro(AutoBuildLocators, vtkTypeBool);
+  vtkGetMacro(AutoBuildLocators, vtkTypeBool);
+  ///@}
+
+  /**
+   * Build cached locators for all the pickable props of the renderer (or
+   * of the pick list, when PickFromList is on) ahead of the first pick.
+   * Call this after the scene is loaded to move the locator construction
+   * cost out of the first pick; the build of each locator is itself
+   * multithreaded. The cached locators are used regardless of the
+   * AutoBuildLocators setting.
+   */
+  void BuildLocators(vtkRenderer* renderer);
+
+  /**
+   * Discard all cached locators, releasing the references they hold on
+   * their datasets. The locators added with AddLocator() are not affected.
+   */
+  void ClearCachedLocators();
+
   ///@{
   /**
    * Set the opacity isovalue to use for defining volume surfaces.  The
@@ -301,7 +335,16 @@ protected:
     vtkDataArray* scalars, vtkPiecewiseFunction* scalarOpacity,
     vtkPiecewiseFunction* gradientOpacity);
 
+  /**
+   * Return the cached locator for the dataset, creating and building it if
+   * none is cached yet. A cached locator is rebuilt when the dataset was
+   * modified after the previous build.
+   */
+  vtkAbstractCellLocator* BuildCachedLocator(vtkDataSet* dataSet);
+
   vtkCollection* Locators;
+  vtkTypeBool AutoBuildLocators;
+  std::map<vtkDataSet*, vtkSmartPointer<vtkAbstractCellLocator>> CachedLocators;
 
   double VolumeOpacityIsovalue;
   vtkTypeBool UseVolumeGradientOpacity;
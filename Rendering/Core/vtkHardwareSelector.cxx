@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkHardwareSelector.h"
 
+#include "vtkCamera.h"
 #include "vtkCommand.h"
 #include "vtkDataObject.h"
 #include "vtkDataSetAttributes.h"
@@ -9,15 +10,19 @@
 #include "vtkInformation.h"
 #include "vtkObjectFactory.h"
 #include "vtkProp.h"
+#include "vtkPropCollection.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
 #include "vtkSmartPointer.h"
+#include "vtkWeakPointer.h"
 
 #include <cassert>
 #include <map>
 #include <set>
+#include <utility>
+#include <vector>
 
 #define ID_OFFSET 1
 
@@ -67,6 +72,27 @@ public:
   double OriginalBackground[3];
   bool OriginalGradient;
 
+  // state of the scene when the cached pixel buffers were captured
+  bool CacheValid = false;
+  vtkMTimeType CacheSelectorMTime = 0;
+  vtkMTimeType CacheCameraMTime = 0;
+  int CacheWindowSize[2] = { 0, 0 };
+  std::vector<std::pair<vtkWeakPointer<vtkProp>, vtkMTimeType>> CacheProps;
+
+  // whether the prop contributed pixels to the captured buffers
+  bool PropContributed(vtkProp* prop)
+  {
+    for (const auto& entry : this->Props)
+    {
+      if (entry.second == prop)
+      {
+        auto pixels = this->PropPixels.find(entry.first);
+        return pixels != this->PropPixels.end() && !pixels->second.empty();
+      }
+    }
+    return false;
+  }
+
   typedef std::map<PixelInformation, std::set<vtkIdType>, PixelInformationComparator>
     MapOfAttributeIds;
 
@@ -191,6 +217,7 @@ vtkHardwareSelector::vtkHardwareSelector()
   this->UseProcessIdFromData = false;
   this->ActorPassOnly = false;
   this->CaptureZValues = false;
+  this->UseBufferCache = false;
 }
 
 //------------------------------------------------------------------------------
@@ -211,9 +238,90 @@ void vtkHardwareSelector::ReleasePixBuffers()
     delete[] this->RawPixBuffer[cc];
     this->RawPixBuffer[cc] = nullptr;
   }
+  this->Internals->CacheValid = false;
   // this->Internals->Props.clear();
 }
 
+//------------------------------------------------------------------------------
+void vtkHardwareSelector::InvalidateCachedSelection()
+{
+  this->Internals->CacheValid = false;
+}
+
+//------------------------------------------------------------------------------
+void vtkHardwareSelector::InvalidateCachedSelection(vtkProp* prop)
+{
+  if (!this->Internals->CacheValid || !prop)
+  {
+    return;
+  }
+  if (this->Internals->PropContributed(prop))
+  {
+    this->Internals->CacheValid = false;
+    return;
+  }
+  // the prop is not in the captured buffers; accept its current state so
+  // the change does not trip the automatic validity check
+  for (auto& entry : this->Internals->CacheProps)
+  {
+    if (entry.first.GetPointer() == prop)
+    {
+      entry.second = prop->GetRedrawMTime();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkHardwareSelector::CachedBuffersValid()
+{
+  vtkInternals& internals = *this->Internals;
+  if (!internals.CacheValid || !this->Renderer)
+  {
+    return false;
+  }
+  // any selector setting changed since the capture invalidates it
+  if (this->GetMTime() > internals.CacheSelectorMTime)
+  {
+    return false;
+  }
+  vtkRenderWindow* rwin = this->Renderer->GetRenderWindow();
+  const int* size = rwin ? rwin->GetSize() : nullptr;
+  if (!size || size[0] != internals.CacheWindowSize[0] || size[1] != internals.CacheWindowSize[1])
+  {
+    return false;
+  }
+  vtkCamera* camera = this->Renderer->GetActiveCamera();
+  if (!camera || camera->GetMTime() != internals.CacheCameraMTime)
+  {
+    return false;
+  }
+
+  // the same props, in the same order, none re-rendered in a way that can
+  // change the captured buffers
+  vtkPropCollection* props = this->Renderer->GetViewProps();
+  if (props->GetNumberOfItems() != static_cast<int>(internals.CacheProps.size()))
+  {
+    return false;
+  }
+  vtkCollectionSimpleIterator pit;
+  vtkProp* prop;
+  size_t index = 0;
+  for (props->InitTraversal(pit); (prop = props->GetNextProp(pit)); ++index)
+  {
+    const auto& cached = internals.CacheProps[index];
+    if (cached.first.GetPointer() != prop)
+    {
+      return false;
+    }
+    if (prop->GetRedrawMTime() > cached.second &&
+      ((prop->GetVisibility() && prop->GetPickable()) || internals.PropContributed(prop)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkHardwareSelector::BeginSelection()
 {
@@ -241,7 +349,10 @@ vtkSelection* vtkHardwareSelector::Select()
   if (this->CaptureBuffers())
   {
     sel = this->GenerateSelection();
-    this->ReleasePixBuffers();
+    if (!this->UseBufferCache)
+    {
+      this->ReleasePixBuffers();
+    }
   }
   return sel;
 }
@@ -255,6 +366,13 @@ bool vtkHardwareSelector::CaptureBuffers()
     return false;
   }
 
+  if (this->UseBufferCache && this->CachedBuffersValid())
+  {
+    // the buffers of the previous capture still describe the scene;
+    // answer this pick without re-rendering
+    return true;
+  }
+
   vtkRenderWindow* rwin = this->Renderer->GetRenderWindow();
   rwin->MakeCurrent();
 
@@ -314,6 +432,28 @@ bool vtkHardwareSelector::CaptureBuffers()
   this->Renderer->SetGradientBackground(this->Internals->OriginalGradient);
   this->Renderer->GetRenderWindow()->SwapBuffersOn();
   this->InvokeEvent(vtkCommand::EndEvent);
+
+  if (this->UseBufferCache)
+  {
+    // record the state the buffers were captured against; the capture
+    // itself modifies the selector, so the times are taken afterwards
+    vtkInternals& internals = *this->Internals;
+    internals.CacheSelectorMTime = this->GetMTime();
+    internals.CacheCameraMTime =
+      this->Renderer->GetActiveCamera() ? this->Renderer->GetActiveCamera()->GetMTime() : 0;
+    const int* size = rwin->GetSize();
+    internals.CacheWindowSize[0] = size[0];
+    internals.CacheWindowSize[1] = size[1];
+    internals.CacheProps.clear();
+    vtkCollectionSimpleIterator pit;
+    vtkProp* prop;
+    vtkPropCollection* props = this->Renderer->GetViewProps();
+    for (props->InitTraversal(pit); (prop = props->GetNextProp(pit));)
+    {
+      internals.CacheProps.emplace_back(prop, prop->GetRedrawMTime());
+    }
+    internals.CacheValid = true;
+  }
   return true;
 }
 
@@ -870,5 +1010,6 @@ void vtkHardwareSelector::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Renderer: " << this->Renderer << endl;
   os << indent << "UseProcessIdFromData: " << this->UseProcessIdFromData << endl;
   os << indent << "ActorPassOnly: " << this->ActorPassOnly << endl;
+  os << indent << "UseBufferCache: " << this->UseBufferCache << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -268,6 +268,36 @@ public:
   vtkSetMacro(CaptureZValues, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set whether the selection buffers are cached between picks. When
+   * enabled, Select() and CaptureBuffers() reuse the buffers of the
+   * previous capture as long as the selector settings, the camera, the
+   * render window size and the props participating in the selection are
+   * unchanged, so repeated picks on a static scene skip the selection
+   * render passes entirely. Queries against the cache use the area of the
+   * original capture; pick sub-regions with GetPixelInformation() or
+   * GenerateSelection(x1, y1, x2, y2) rather than by shrinking the area.
+   * Default is off.
+   */
+  vtkSetMacro(UseBufferCache, bool);
+  vtkGetMacro(UseBufferCache, bool);
+  vtkBooleanMacro(UseBufferCache, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Discard the cached selection buffers so that the next pick captures
+   * them again. The overload taking a prop discards the cache only when
+   * that prop contributed pixels to the cached capture; otherwise it
+   * accepts the prop's current modified time, declaring that the change
+   * does not affect the captured buffers. Props whose changes would make
+   * them appear in the selection are detected automatically.
+   */
+  void InvalidateCachedSelection();
+  void InvalidateCachedSelection(vtkProp* prop);
+  ///@}
+
   ///@{
   /**
    * Called by the mapper before and after rendering each prop.
@@ -480,6 +510,13 @@ protected:
   virtual void ProcessPixelBuffers();
   void BuildPropHitList(unsigned char* rgbData);
 
+  /**
+   * Whether the cached pixel buffers can answer the next capture: the
+   * selector settings, camera, window size and participating props must
+   * not have changed since they were captured.
+   */
+  bool CachedBuffersValid();
+
   ///@{
   /**
    * Clears all pixel buffers.
@@ -507,6 +544,8 @@ protected:
 
   bool CaptureZValues;
 
+  bool UseBufferCache;
+
 private:
   vtkHardwareSelector(const vtkHardwareSelector&) = delete;
   void operator=(const vtkHardwareSelector&) = delete;
@@ -4,12 +4,14 @@
 
 #include "vtkActor.h"
 #include "vtkActor2D.h"
+#include "vtkActorCollection.h"
 #include "vtkAssemblyNode.h"
 #include "vtkAssemblyPath.h"
 #include "vtkCallbackCommand.h"
 #include "vtkCellPicker.h"
 #include "vtkCommand.h"
 #include "vtkEventForwarderCommand.h"
+#include "vtkMapper.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkOutlineSource.h"
@@ -19,6 +21,7 @@
 #include "vtkRenderWindow.h"
 #include "vtkRenderWindowInteractor.h"
 #include "vtkRenderer.h"
+#include "vtkRendererCollection.h"
 #include "vtkTDxInteractorStyleCamera.h"
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -37,6 +40,8 @@ vtkInteractorStyle::vtkInteractorStyle()
 
   this->AutoAdjustCameraClippingRange = 1;
 
+  this->StaticMappersDuringInteraction = 0;
+
   this->Interactor = nullptr;
 
   this->EventCallbackCommand->SetCallback(vtkInteractorStyle::ProcessEvents);
@@ -417,6 +422,10 @@ void vtkInteractorStyle::StartState(int newstate)
   {
     vtkRenderWindowInteractor* rwi = this->Interactor;
     rwi->GetRenderWindow()->SetDesiredUpdateRate(rwi->GetDesiredUpdateRate());
+    if (this->StaticMappersDuringInteraction)
+    {
+      this->MarkMappersStatic();
+    }
     this->InvokeEvent(vtkCommand::StartInteractionEvent, nullptr);
     if (this->UseTimers && !(this->TimerId = rwi->CreateRepeatingTimer(this->TimerDuration)))
     {
@@ -442,6 +451,9 @@ void vtkInteractorStyle::StopState()
     vtkRenderWindowInteractor* rwi = this->Interactor;
     vtkRenderWindow* renwin = rwi->GetRenderWindow();
     renwin->SetDesiredUpdateRate(rwi->GetStillUpdateRate());
+    // restore unconditionally so toggling the flag mid-interaction cannot
+    // leave mappers static
+    this->RestoreStaticMappers();
     if (this->UseTimers &&
       // FIXME: This comment doesn't match the logic of the code. There is
       // one test failing with it like it is, but more failing if the
@@ -457,6 +469,48 @@ void vtkInteractorStyle::StopState()
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkInteractorStyle::MarkMappersStatic()
+{
+  vtkRenderWindowInteractor* rwi = this->Interactor;
+  if (!rwi || !rwi->GetRenderWindow())
+  {
+    return;
+  }
+
+  vtkRendererCollection* renderers = rwi->GetRenderWindow()->GetRenderers();
+  vtkCollectionSimpleIterator rsit;
+  vtkRenderer* renderer;
+  for (renderers->InitTraversal(rsit); (renderer = renderers->GetNextRenderer(rsit));)
+  {
+    vtkActorCollection* actors = renderer->GetActors();
+    vtkCollectionSimpleIterator asit;
+    vtkActor* actor;
+    for (actors->InitTraversal(asit); (actor = actors->GetNextActor(asit));)
+    {
+      vtkMapper* mapper = actor->GetMapper();
+      if (mapper && !mapper->GetStatic())
+      {
+        mapper->StaticOn();
+        this->MappersMadeStatic.emplace_back(mapper);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkInteractorStyle::RestoreStaticMappers()
+{
+  for (vtkWeakPointer<vtkMapper>& mapper : this->MappersMadeStatic)
+  {
+    if (mapper)
+    {
+      mapper->StaticOff();
+    }
+  }
+  this->MappersMadeStatic.clear();
+}
+
 //------------------------------------------------------------------------------
 // JCP animation control
 void vtkInteractorStyle::StartAnimate()
@@ -971,6 +1025,9 @@ void vtkInteractorStyle::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "UseTimers: " << this->UseTimers << endl;
   os << indent << "HandleObservers: " << this->HandleObservers << endl;
   os << indent << "MouseWheelMotionFactor: " << this->MouseWheelMotionFactor << endl;
+  os << indent
+     << "StaticMappersDuringInteraction: " << (this->StaticMappersDuringInteraction ? "On" : "Off")
+     << endl;
 
   os << indent << "Timer Duration: " << this->TimerDuration << endl;
 
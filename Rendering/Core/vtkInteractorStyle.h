@@ -82,8 +82,11 @@
 
 #include "vtkInteractorObserver.h"
 #include "vtkRenderingCoreModule.h" // For export macro
+#include "vtkWeakPointer.h"         // For tracking mappers made static
 #include "vtkWrappingHints.h"       // For VTK_MARSHALAUTO
 
+#include <vector> // For tracking mappers made static
+
 // Motion flags
 
 #define VTKIS_START 0
@@ -121,6 +124,7 @@ class vtkActor;
 class vtkCallbackCommand;
 class vtkEventData;
 class vtkEventForwarderCommand;
+class vtkMapper;
 class vtkOutlineSource;
 class vtkPolyDataMapper;
 class vtkProp3D;
@@ -403,6 +407,22 @@ public:
   vtkGetMacro(MouseWheelMotionFactor, double);
   ///@}
 
+  ///@{
+  /**
+   * If StaticMappersDuringInteraction is on, every mapper in the render
+   * window is marked static (see vtkMapper::SetStatic) for the duration of
+   * an interaction state, so renders issued while rotating, panning or
+   * zooming redraw the mappers' current data instead of waiting for the
+   * upstream pipeline to re-execute. The flags are restored when the
+   * interaction ends, and the final still render picks up any pending
+   * pipeline updates. This keeps camera interaction responsive when
+   * upstream filters take seconds to update. Default is off.
+   */
+  vtkSetMacro(StaticMappersDuringInteraction, vtkTypeBool);
+  vtkGetMacro(StaticMappersDuringInteraction, vtkTypeBool);
+  vtkBooleanMacro(StaticMappersDuringInteraction, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * 3Dconnexion device interactor style. Initial value is a pointer to an
@@ -429,6 +449,16 @@ protected:
   static void ProcessEvents(
     vtkObject* object, unsigned long event, void* clientdata, void* calldata);
 
+  ///@{
+  /**
+   * Mark the mappers in the render window static / restore the flags changed
+   * by the last MarkMappersStatic call. Used by StartState and StopState
+   * when StaticMappersDuringInteraction is enabled.
+   */
+  void MarkMappersStatic();
+  void RestoreStaticMappers();
+  ///@}
+
   // Keep track of current state
   int State;
   int AnimState;
@@ -451,6 +481,11 @@ protected:
   double PickColor[3]; // support 2D picking
   double MouseWheelMotionFactor;
 
+  // Redraw current mapper data during interaction instead of waiting for
+  // pipeline updates
+  vtkTypeBool StaticMappersDuringInteraction;
+  std::vector<vtkWeakPointer<vtkMapper>> MappersMadeStatic;
+
   // Control the timer duration
   unsigned long TimerDuration; // in milliseconds
 
@@ -707,20 +707,35 @@ bool vtkMapper::HasTranslucentPolygonalGeometry()
     return false;
   }
 
-  unsigned char ghostsToSkip;
-  vtkUnsignedCharArray* ghosts =
-    vtkAbstractMapper::GetGhostArray(input, this->ScalarMode, ghostsToSkip);
-
   vtkScalarsToColors* lut = this->GetLookupTable();
-  if (lut)
+  if (!lut)
   {
+    return false;
+  }
+
+  // deciding whether any scalar maps to a translucent color scans the scalar
+  // array, and this query runs several times per frame; cache the answer
+  // until the input, the lookup table or this mapper is modified
+  this->TranslucentCheckTempState.Clear();
+  this->TranslucentCheckTempState.Append(input->GetMTime(), "input mtime");
+  this->TranslucentCheckTempState.Append(lut->GetMTime(), "lut mtime");
+  this->TranslucentCheckTempState.Append(this->GetMTime(), "this mtime");
+  if (this->TranslucentCheckState != this->TranslucentCheckTempState)
+  {
+    this->TranslucentCheckState = this->TranslucentCheckTempState;
+
+    unsigned char ghostsToSkip;
+    vtkUnsignedCharArray* ghosts =
+      vtkAbstractMapper::GetGhostArray(input, this->ScalarMode, ghostsToSkip);
+
     // Ensure that the lookup table is built
     lut->Build();
-    return (lut->IsOpaque(
-              abstractArray, this->ColorMode, this->ArrayComponent, ghosts, ghostsToSkip) == 0);
+    this->TranslucentGeometry =
+      (lut->IsOpaque(abstractArray, this->ColorMode, this->ArrayComponent, ghosts, ghostsToSkip) ==
+        0);
   }
 
-  return false;
+  return this->TranslucentGeometry;
 }
 
 // anonymous namespace
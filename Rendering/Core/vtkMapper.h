@@ -38,6 +38,7 @@
 #include "vtkAbstractMapper3D.h"
 #include "vtkRenderingCoreModule.h" // For export macro
 #include "vtkSmartPointer.h"        // needed for vtkSmartPointer.
+#include "vtkStateStorage.h"        // for ivar
 #include "vtkSystemIncludes.h"      // For VTK_COLOR_MODE_DEFAULT and _MAP_SCALARS
 #include "vtkWrappingHints.h"       // For VTK_MARSHALAUTO
 #include <vector>                   // for method args
@@ -126,7 +127,10 @@ public:
    * Turn on/off flag to control whether the mapper's data is static. Static data
    * means that the mapper does not propagate updates down the pipeline, greatly
    * decreasing the time it takes to update many mappers. This should only be
-   * used if the data never changes.
+   * used if the data never changes. Together with the cached translucency
+   * determination this effectively freezes the mapper: per-frame CPU cost
+   * reduces to time stamp comparisons. Turn the flag off (or modify the
+   * input) to resume normal pipeline behavior when the data is edited.
    */
   vtkSetMacro(Static, vtkTypeBool);
   vtkGetMacro(Static, vtkTypeBool);
@@ -555,6 +559,11 @@ protected:
 
   vtkSelection* Selection = nullptr;
 
+  // cached translucency determination, see HasTranslucentPolygonalGeometry()
+  vtkStateStorage TranslucentCheckState;
+  vtkStateStorage TranslucentCheckTempState;
+  bool TranslucentGeometry = false;
+
 private:
   vtkMapper(const vtkMapper&) = delete;
   void operator=(const vtkMapper&) = delete;
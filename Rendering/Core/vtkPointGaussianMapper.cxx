@@ -29,6 +29,7 @@ vtkPointGaussianMapper::vtkPointGaussianMapper()
 
   this->ScaleFactor = 1.0;
   this->Emissive = 1;
+  this->OrderIndependentTranslucency = 0;
   this->BoundScale = 3.0;
 }
 
@@ -43,6 +44,21 @@ vtkPointGaussianMapper::~vtkPointGaussianMapper()
   this->SetScaleFunction(nullptr);
 }
 
+//------------------------------------------------------------------------------
+bool vtkPointGaussianMapper::HasTranslucentPolygonalGeometry()
+{
+  // The gaussian footprint leaves every splat fragment partially
+  // transparent even when the scalar colors the superclass inspects are
+  // opaque, so when requested report the splats as translucent. The
+  // renderer then composites them with its order-independent translucent
+  // pass and no depth sorting of the points is needed.
+  if (this->OrderIndependentTranslucency && !this->Emissive && this->ScaleFactor != 0.0)
+  {
+    return true;
+  }
+  return this->Superclass::HasTranslucentPolygonalGeometry();
+}
+
 //------------------------------------------------------------------------------
 void vtkPointGaussianMapper::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -56,6 +72,7 @@ void vtkPointGaussianMapper::PrintSelf(ostream& os, vtkIndent indent)
      << "\n";
   os << indent << "ScaleFactor: " << this->ScaleFactor << "\n";
   os << indent << "Emissive: " << this->Emissive << "\n";
+  os << indent << "OrderIndependentTranslucency: " << this->OrderIndependentTranslucency << "\n";
   os << indent << "OpacityTableSize: " << this->OpacityTableSize << "\n";
   os << indent << "ScaleTableSize: " << this->ScaleTableSize << "\n";
   os << indent << "BoundScale: " << this->BoundScale << "\n";
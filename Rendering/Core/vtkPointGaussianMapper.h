@@ -108,6 +108,27 @@ public:
   vtkBooleanMacro(Emissive, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Report non-emissive splats as translucent geometry so the renderer
+   * composites them with its order-independent translucent pass rather
+   * than drawing them in the opaque pass. The splats then blend correctly
+   * in any order, without any depth sorting of the points, which keeps
+   * camera interaction smooth on very large point clouds. Ignored when
+   * Emissive is on, as emissive splats already blend additively. The
+   * default is false.
+   */
+  vtkSetMacro(OrderIndependentTranslucency, vtkTypeBool);
+  vtkGetMacro(OrderIndependentTranslucency, vtkTypeBool);
+  vtkBooleanMacro(OrderIndependentTranslucency, vtkTypeBool);
+  ///@}
+
+  /**
+   * Splats with OrderIndependentTranslucency enabled are translucent
+   * regardless of the scalar colors the superclass inspects.
+   */
+  bool HasTranslucentPolygonalGeometry() override;
+
   ///@{
   /**
    * Set/Get the optional opacity transfer function. This is only
@@ -218,6 +239,7 @@ protected:
 
   double ScaleFactor;
   vtkTypeBool Emissive;
+  vtkTypeBool OrderIndependentTranslucency;
 
   float BoundScale;
 
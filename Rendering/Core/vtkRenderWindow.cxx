@@ -19,6 +19,7 @@
 #include "vtkTransform.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <string>
@@ -74,6 +75,9 @@ vtkRenderWindow::vtkRenderWindow()
 #endif
   this->DeviceIndex = 0;
   this->SharedRenderWindow = nullptr;
+  this->TrackDamageRegions = 0;
+  this->DamageCheckSize[0] = this->DamageCheckSize[1] = 0;
+  this->ResetDamageRegion();
 
   this->CursorFileName = nullptr;
 }
@@ -295,6 +299,11 @@ void vtkRenderWindow::Render()
     this->Interactor->Initialize();
   }
 
+  if (this->TrackDamageRegions)
+  {
+    this->AccumulateDamageRegion();
+  }
+
   this->Start(); // Ensure context exists
   vtkRenderTimerLog::ScopedEventLogger event;
   if (this->RenderTimer->GetLoggingEnabled())
@@ -319,6 +328,111 @@ void vtkRenderWindow::Render()
   this->InvokeEvent(vtkCommand::EndEvent, nullptr);
 }
 
+//------------------------------------------------------------------------------
+bool vtkRenderWindow::GetDamageRegion(int region[4])
+{
+  if (this->DamageRegion[0] > this->DamageRegion[2] ||
+    this->DamageRegion[1] > this->DamageRegion[3])
+  {
+    return false;
+  }
+  region[0] = this->DamageRegion[0];
+  region[1] = this->DamageRegion[1];
+  region[2] = this->DamageRegion[2];
+  region[3] = this->DamageRegion[3];
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkRenderWindow::ResetDamageRegion()
+{
+  this->DamageRegion[0] = this->DamageRegion[1] = VTK_INT_MAX;
+  this->DamageRegion[2] = this->DamageRegion[3] = VTK_INT_MIN;
+}
+
+//------------------------------------------------------------------------------
+void vtkRenderWindow::AccumulateDamageRegion()
+{
+  const int* size = this->GetActualSize();
+  auto addRect = [this, size](int xmin, int ymin, int xmax, int ymax)
+  {
+    xmin = vtkMath::ClampValue(xmin, 0, size[0] - 1);
+    xmax = vtkMath::ClampValue(xmax, 0, size[0] - 1);
+    ymin = vtkMath::ClampValue(ymin, 0, size[1] - 1);
+    ymax = vtkMath::ClampValue(ymax, 0, size[1] - 1);
+    this->DamageRegion[0] = std::min(this->DamageRegion[0], xmin);
+    this->DamageRegion[1] = std::min(this->DamageRegion[1], ymin);
+    this->DamageRegion[2] = std::max(this->DamageRegion[2], xmax);
+    this->DamageRegion[3] = std::max(this->DamageRegion[3], ymax);
+  };
+
+  // The first check and window resizes damage everything.
+  if (this->DamageCheckTime.GetMTime() == 0 || size[0] != this->DamageCheckSize[0] ||
+    size[1] != this->DamageCheckSize[1])
+  {
+    addRect(0, 0, size[0] - 1, size[1] - 1);
+  }
+  else
+  {
+    vtkCollectionSimpleIterator rsit;
+    vtkRenderer* aren;
+    for (this->Renderers->InitTraversal(rsit); (aren = this->Renderers->GetNextRenderer(rsit));)
+    {
+      const int* vpOrigin = aren->GetOrigin();
+      const int* vpSize = aren->GetSize();
+
+      // A camera or renderer change invalidates the whole viewport.
+      if (aren->GetMTime() > this->DamageCheckTime ||
+        (aren->IsActiveCameraCreated() &&
+          aren->GetActiveCamera()->GetMTime() > this->DamageCheckTime))
+      {
+        addRect(
+          vpOrigin[0], vpOrigin[1], vpOrigin[0] + vpSize[0] - 1, vpOrigin[1] + vpSize[1] - 1);
+        continue;
+      }
+
+      vtkPropCollection* props = aren->GetViewProps();
+      vtkCollectionSimpleIterator pit;
+      vtkProp* prop;
+      for (props->InitTraversal(pit); (prop = props->GetNextProp(pit));)
+      {
+        if (prop->GetRedrawMTime() <= this->DamageCheckTime)
+        {
+          continue;
+        }
+        const double* bounds = prop->GetBounds();
+        if (!bounds || !vtkMath::AreBoundsInitialized(bounds))
+        {
+          // 2D props and props without geometry: damage the viewport.
+          addRect(
+            vpOrigin[0], vpOrigin[1], vpOrigin[0] + vpSize[0] - 1, vpOrigin[1] + vpSize[1] - 1);
+          break;
+        }
+        double xmin = VTK_DOUBLE_MAX, ymin = VTK_DOUBLE_MAX;
+        double xmax = VTK_DOUBLE_MIN, ymax = VTK_DOUBLE_MIN;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+          double display[3] = { bounds[corner & 1], bounds[2 + ((corner >> 1) & 1)],
+            bounds[4 + ((corner >> 2) & 1)] };
+          aren->WorldToDisplay(display[0], display[1], display[2]);
+          xmin = std::min(xmin, display[0]);
+          ymin = std::min(ymin, display[1]);
+          xmax = std::max(xmax, display[0]);
+          ymax = std::max(ymax, display[1]);
+        }
+        // Pad a little to cover line widths, point sizes and antialiasing.
+        const int pad = 2;
+        addRect(vtkMath::Floor(xmin) - pad, vtkMath::Floor(ymin) - pad,
+          vtkMath::Ceil(xmax) + pad, vtkMath::Ceil(ymax) + pad);
+      }
+    }
+  }
+
+  this->DamageCheckTime.Modified();
+  this->DamageCheckSize[0] = size[0];
+  this->DamageCheckSize[1] = size[1];
+}
+
 //------------------------------------------------------------------------------
 // Handle rendering the two different views for stereo rendering.
 void vtkRenderWindow::DoStereoRender()
@@ -465,6 +579,7 @@ void vtkRenderWindow::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "MultiSamples: " << this->MultiSamples << "\n";
   os << indent << "StencilCapable: " << (this->StencilCapable ? "True" : "False") << endl;
+  os << indent << "TrackDamageRegions: " << (this->TrackDamageRegions ? "On" : "Off") << endl;
 }
 
 //------------------------------------------------------------------------------
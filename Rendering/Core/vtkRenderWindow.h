@@ -123,6 +123,35 @@ public:
    */
   vtkRendererCollection* GetRenderers() { return this->Renderers; }
 
+  ///@{
+  /**
+   * Turn on to accumulate a damage region across renders. Before each
+   * render, the screen-space bounds of every prop whose redraw time
+   * changed since the previous check are added to the region; camera or
+   * renderer changes and window resizes damage the whole viewport.
+   * Remote-rendering services use this to re-encode and ship only the
+   * part of the frame that actually changed. Off by default.
+   */
+  vtkSetMacro(TrackDamageRegions, vtkTypeBool);
+  vtkGetMacro(TrackDamageRegions, vtkTypeBool);
+  vtkBooleanMacro(TrackDamageRegions, vtkTypeBool);
+  ///@}
+
+  /**
+   * Get the damage region accumulated since the last ResetDamageRegion()
+   * as {xmin, ymin, xmax, ymax} in pixels, with the origin in the lower
+   * left corner as for GetPixelData(). Returns false when nothing has
+   * been damaged (the region is then left unmodified). Only meaningful
+   * when TrackDamageRegions is on.
+   */
+  bool GetDamageRegion(int region[4]);
+
+  /**
+   * Empty the accumulated damage region. Call after consuming the region
+   * so the next render starts a fresh accumulation.
+   */
+  void ResetDamageRegion();
+
   /**
    * The GL2PS exporter must handle certain props in a special way (e.g. text).
    * This method performs a render and captures all "GL2PS-special" props in
@@ -734,6 +763,13 @@ protected:
 
   virtual void DoStereoRender();
 
+  /**
+   * Add the screen bounds of everything that changed since the previous
+   * check to the damage region. Called from Render() when
+   * TrackDamageRegions is on.
+   */
+  virtual void AccumulateDamageRegion();
+
   vtkRendererCollection* Renderers;
   vtkNew<vtkRenderTimerLog> RenderTimer;
   vtkTypeBool Borders;
@@ -763,6 +799,10 @@ protected:
   vtkTypeBool StencilCapable;
   int CapturingGL2PSSpecialProps;
   int DeviceIndex;
+  vtkTypeBool TrackDamageRegions;
+  int DamageRegion[4];
+  vtkTimeStamp DamageCheckTime;
+  int DamageCheckSize[2];
 
   bool UseSRGBColorSpace;
   char* CursorFileName;
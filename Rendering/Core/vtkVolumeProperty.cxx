@@ -180,6 +180,14 @@ void vtkVolumeProperty::UpdateMTimes()
 
 //------------------------------------------------------------------------------
 vtkMTimeType vtkVolumeProperty::GetMTime()
+{
+  vtkMTimeType mTime = this->GetMTimeIgnoringIsoSurfaceValues();
+  vtkMTimeType time = this->IsoSurfaceValues->GetMTime();
+  return vtkMath::Max(mTime, time);
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkVolumeProperty::GetMTimeIgnoringIsoSurfaceValues()
 {
   vtkMTimeType mTime = this->vtkObject::GetMTime();
   vtkMTimeType time;
@@ -253,9 +261,6 @@ vtkMTimeType vtkVolumeProperty::GetMTime()
     }
   }
 
-  time = this->IsoSurfaceValues->GetMTime();
-  mTime = vtkMath::Max(mTime, time);
-
   time = this->LabelColorMTime;
   mTime = vtkMath::Max(mTime, time);
 
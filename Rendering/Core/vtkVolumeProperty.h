@@ -75,6 +75,13 @@ public:
    */
   vtkMTimeType GetMTime() override;
 
+  /**
+   * Get the modified time ignoring changes to the isosurface values.
+   * Mappers that apply the isovalues as shader uniforms use this to
+   * avoid rebuilding their shaders on isovalue-only edits.
+   */
+  vtkMTimeType GetMTimeIgnoringIsoSurfaceValues();
+
   ///@{
   /**
    * Does the data have independent components, or do some define color
@@ -10,11 +10,13 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderWindowInteractor.h"
 #include "vtkRendererCollection.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
 #include <vector>
@@ -66,6 +68,7 @@ vtkWindowToImageFilter::vtkWindowToImageFilter()
   this->Viewport[3] = 1;
   this->InputBufferType = VTK_RGB;
   this->FixBoundary = false;
+  this->PipelinedReadback = 0;
 
   this->SetNumberOfInputPorts(0);
   this->SetNumberOfOutputPorts(1);
@@ -128,6 +131,7 @@ void vtkWindowToImageFilter::PrintSelf(ostream& os, vtkIndent indent)
      << this->Viewport[2] << "," << this->Viewport[3] << "\n";
   os << indent << "InputBufferType: " << this->InputBufferType << "\n";
   os << indent << "FixBoundary: " << this->FixBoundary << endl;
+  os << indent << "PipelinedReadback: " << this->PipelinedReadback << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -459,10 +463,26 @@ void vtkWindowToImageFilter::RequestData(vtkInformation* vtkNotUsed(request),
       if (this->InputBufferType == VTK_RGB || this->InputBufferType == VTK_RGBA)
       {
         unsigned char *pixels, *pixels1, *outPtr;
+        vtkNew<vtkUnsignedCharArray> pipelinedPixels;
+        bool pipelined = false;
         if (this->InputBufferType == VTK_RGB)
         {
-          pixels = this->Input->GetPixelData(
-            imageBounds[0], imageBounds[1], imageBounds[2], imageBounds[3], buffer);
+          // Pipelined capture only makes sense when the whole image comes
+          // from a single readback of an unscaled window.
+          if (this->PipelinedReadback && num_iterations[0] == 1 && num_iterations[1] == 1)
+          {
+            this->Input->SubmitPixelDataReadback(
+              imageBounds[0], imageBounds[1], imageBounds[2], imageBounds[3], buffer);
+            this->Input->RetrievePixelDataReadback(imageBounds[0], imageBounds[1], imageBounds[2],
+              imageBounds[3], buffer, pipelinedPixels);
+            pixels = pipelinedPixels->GetPointer(0);
+            pipelined = true;
+          }
+          else
+          {
+            pixels = this->Input->GetPixelData(
+              imageBounds[0], imageBounds[1], imageBounds[2], imageBounds[3], buffer);
+          }
         }
         else
         {
@@ -513,7 +533,10 @@ void vtkWindowToImageFilter::RequestData(vtkInformation* vtkNotUsed(request),
         }
 
         // free the memory
-        delete[] pixels;
+        if (!pipelined)
+        {
+          delete[] pixels;
+        }
       }
       else
       { // VTK_ZBUFFER
@@ -133,6 +133,23 @@ public:
   vtkGetVectorMacro(Viewport, double, 4);
   ///@}
 
+  ///@{
+  /**
+   * Set/get whether to capture pixels through the window's pipelined
+   * readback API instead of a blocking read. When enabled, each capture
+   * submits an asynchronous readback and retrieves the one submitted on
+   * the previous capture, overlapping the transfer of one frame with the
+   * rendering of the next. This is intended for continuous capture
+   * (e.g. streaming a render window); the retrieved image lags the window
+   * contents by one capture. Only honored for VTK_RGB captures without
+   * tiling (scale factor 1); other configurations read synchronously.
+   * Initial value is false.
+   */
+  vtkBooleanMacro(PipelinedReadback, vtkTypeBool);
+  vtkSetMacro(PipelinedReadback, vtkTypeBool);
+  vtkGetMacro(PipelinedReadback, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set/get the window buffer from which data will be read.  Choices
@@ -170,6 +187,7 @@ protected:
   double Viewport[4];
   int InputBufferType;
   bool FixBoundary;
+  vtkTypeBool PipelinedReadback;
 
   void RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*);
 
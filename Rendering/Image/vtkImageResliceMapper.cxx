@@ -132,6 +132,22 @@ vtkAbstractImageInterpolator* vtkImageResliceMapper::GetInterpolator()
   return this->ImageReslice->GetInterpolator();
 }
 
+//------------------------------------------------------------------------------
+void vtkImageResliceMapper::SetUseSMPThreading(bool smp)
+{
+  if (this->ImageReslice->GetEnableSMP() != smp)
+  {
+    this->ImageReslice->SetEnableSMP(smp);
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkImageResliceMapper::GetUseSMPThreading()
+{
+  return this->ImageReslice->GetEnableSMP();
+}
+
 //------------------------------------------------------------------------------
 void vtkImageResliceMapper::ReleaseGraphicsResources(vtkWindow* win)
 {
@@ -1496,6 +1512,7 @@ void vtkImageResliceMapper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "SlabSampleFactor: " << this->SlabSampleFactor << "\n";
   os << indent << "ImageSampleFactor: " << this->ImageSampleFactor << "\n";
   os << indent << "Interpolator: " << this->GetInterpolator() << "\n";
+  os << indent << "UseSMPThreading: " << (this->GetUseSMPThreading() ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -151,6 +151,21 @@ public:
   virtual vtkAbstractImageInterpolator* GetInterpolator();
   ///@}
 
+  ///@{
+  /**
+   * Execute the internal reslice operation through the vtkSMPTools
+   * backend, rather than through vtkMultiThreader.  The SMP backend
+   * subdivides the slice (and the slab samples, for thick slicing) into
+   * small pieces that are dynamically load-balanced across the thread
+   * pool, which gives better core utilization for oblique slices through
+   * large volumes.  The initial value is taken from the global default
+   * set with vtkThreadedImageAlgorithm::SetGlobalDefaultEnableSMP().
+   */
+  virtual void SetUseSMPThreading(bool smp);
+  virtual bool GetUseSMPThreading();
+  vtkBooleanMacro(UseSMPThreading, bool);
+  ///@}
+
   /**
    * This should only be called by the renderer.
    */
@@ -9,6 +9,7 @@
 #include "vtkOutlineFilter.h"
 #include "vtkPolyDataMapper.h"
 #include "vtkProperty.h"
+#include "vtkQuadricDecimation.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 #include "vtkTexture.h"
@@ -34,6 +35,8 @@ vtkLODActor::vtkLODActor()
   this->MediumResFilter = nullptr;
   this->LowResFilter = nullptr;
   this->NumberOfCloudPoints = 150;
+  this->NumberOfDecimationLevels = 0;
+  this->DecimationTargetReduction = 0.5;
   this->LowMapper = nullptr;
   this->MediumMapper = nullptr;
 }
@@ -53,6 +56,8 @@ void vtkLODActor::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "Cloud Points: " << this->NumberOfCloudPoints << endl;
+  os << indent << "Number Of Decimation Levels: " << this->NumberOfDecimationLevels << endl;
+  os << indent << "Decimation Target Reduction: " << this->DecimationTargetReduction << endl;
 
   // how should we print out the LODMappers?
   os << indent << "Number Of LOD Mappers: " << this->LODMappers->GetNumberOfItems() << endl;
@@ -254,6 +259,16 @@ void vtkLODActor::CreateOwnLODs()
   this->LODMappers->AddItem(this->MediumMapper);
   this->LODMappers->AddItem(this->LowMapper);
 
+  // optionally build a chain of progressively decimated surface LODs; they
+  // are connected to their inputs in UpdateOwnLODs
+  for (int level = 0; level < this->NumberOfDecimationLevels; level++)
+  {
+    this->DecimationFilters.push_back(vtkSmartPointer<vtkQuadricDecimation>::New());
+    vtkSmartPointer<vtkPolyDataMapper> mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
+    this->DecimationMappers.push_back(mapper);
+    this->LODMappers->AddItem(mapper);
+  }
+
   this->UpdateOwnLODs();
 }
 
@@ -266,6 +281,13 @@ void vtkLODActor::UpdateOwnLODs()
     return;
   }
 
+  // rebuild from scratch if the number of requested decimation levels changed
+  if (this->MediumMapper &&
+    this->DecimationFilters.size() != static_cast<size_t>(this->NumberOfDecimationLevels))
+  {
+    this->DeleteOwnLODs();
+  }
+
   if (!this->MediumMapper)
   {
     this->CreateOwnLODs();
@@ -295,6 +317,19 @@ void vtkLODActor::UpdateOwnLODs()
   this->LowMapper->ScalarVisibilityOff();
   this->LowMapper->SetInputConnection(this->LowResFilter->GetOutputPort());
 
+  // chain each decimation level off the previous one so level N+1 decimates
+  // level N's (already reduced) output
+  vtkAlgorithmOutput* previousPort = this->Mapper->GetInputConnection(0, 0);
+  for (size_t level = 0; level < this->DecimationFilters.size(); level++)
+  {
+    vtkQuadricDecimation* decimator = this->DecimationFilters[level];
+    decimator->SetTargetReduction(this->DecimationTargetReduction);
+    decimator->SetInputConnection(previousPort);
+    this->DecimationMappers[level]->ShallowCopy(this->Mapper);
+    this->DecimationMappers[level]->SetInputConnection(decimator->GetOutputPort());
+    previousPort = decimator->GetOutputPort();
+  }
+
   this->BuildTime.Modified();
 }
 
@@ -318,6 +353,13 @@ void vtkLODActor::DeleteOwnLODs()
     this->MediumMapper = nullptr;
   }
 
+  for (const vtkSmartPointer<vtkPolyDataMapper>& mapper : this->DecimationMappers)
+  {
+    this->LODMappers->RemoveItem(mapper);
+  }
+  this->DecimationMappers.clear();
+  this->DecimationFilters.clear();
+
   // delete the filters used to create the LODs ...
   // The nullptr check should not be necessary, but for sanity ...
   this->SetLowResFilter(nullptr);
@@ -340,6 +382,8 @@ void vtkLODActor::ShallowCopy(vtkProp* prop)
   if (a)
   {
     this->SetNumberOfCloudPoints(a->GetNumberOfCloudPoints());
+    this->SetNumberOfDecimationLevels(a->GetNumberOfDecimationLevels());
+    this->SetDecimationTargetReduction(a->GetDecimationTargetReduction());
     vtkMapperCollection* c = a->GetLODMappers();
     vtkMapper* map;
     vtkCollectionSimpleIterator mit;
@@ -20,6 +20,14 @@
  * vtkOutlineFilter (low-res) and vtkMaskPoints (medium-res). Additional
  * levels of detail can be add using the AddLODMapper() method.
  *
+ * In addition, a chain of progressively decimated surface LODs can be built
+ * by setting NumberOfDecimationLevels. Each level runs vtkQuadricDecimation
+ * on the previous level's output, so the levels are computed once and
+ * provide true surface renderings at decreasing cost, rather than a point
+ * cloud or outline. The budget-based selection in Render() then picks the
+ * finest level that fits the allocated render time, and still renders fall
+ * back to the full-resolution mapper.
+ *
  * To control the frame rate, you typically set the vtkRenderWindowInteractor
  * DesiredUpdateRate and StillUpdateRate. This then will cause vtkLODActor
  * to adjust its LOD to fulfill the requested update rate.
@@ -46,12 +54,16 @@
 
 #include "vtkActor.h"
 #include "vtkRenderingLODModule.h" // For export macro
+#include "vtkSmartPointer.h"       // For decimated LOD storage
+
+#include <vector> // For decimated LOD storage
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkMapper;
 class vtkMapperCollection;
 class vtkPolyDataAlgorithm;
 class vtkPolyDataMapper;
+class vtkQuadricDecimation;
 class vtkRenderer;
 class vtkViewport;
 class vtkWindow;
@@ -108,6 +120,28 @@ public:
   vtkSetMacro(NumberOfCloudPoints, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the number of progressively decimated surface LODs to build
+   * between the full-resolution mapper and the point-cloud/outline levels.
+   * Each level decimates the previous one with vtkQuadricDecimation, so the
+   * whole chain is computed once and reused across interactions. Default is
+   * 0, which keeps the classic point-cloud/outline-only behavior.
+   */
+  vtkSetClampMacro(NumberOfDecimationLevels, int, 0, 16);
+  vtkGetMacro(NumberOfDecimationLevels, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the target reduction each decimation level applies to the
+   * previous level, in ]0, 1[. With the default of 0.5, every level roughly
+   * halves the triangle count of the one before it.
+   */
+  vtkSetClampMacro(DecimationTargetReduction, double, 0.0, 1.0);
+  vtkGetMacro(DecimationTargetReduction, double);
+  ///@}
+
   ///@{
   /**
    * All the mappers for different LODs are stored here.
@@ -140,8 +174,14 @@ protected:
   vtkPolyDataMapper* LowMapper;
   vtkPolyDataMapper* MediumMapper;
 
+  // Optional chain of progressively decimated LODs, coarsest last
+  std::vector<vtkSmartPointer<vtkQuadricDecimation>> DecimationFilters;
+  std::vector<vtkSmartPointer<vtkPolyDataMapper>> DecimationMappers;
+
   vtkTimeStamp BuildTime;
   int NumberOfCloudPoints;
+  int NumberOfDecimationLevels;
+  double DecimationTargetReduction;
 
   virtual void CreateOwnLODs();
   virtual void UpdateOwnLODs();
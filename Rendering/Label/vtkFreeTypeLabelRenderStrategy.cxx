@@ -13,28 +13,80 @@
 #include "vtkTimerLog.h"
 #include "vtkWindow.h"
 
+#include <map>
+#include <string>
+#include <tuple>
+
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// cached label textures unused for this many consecutive frames are released
+constexpr vtkTypeUInt64 vtkLabelCacheMaxFrameAge = 5;
+
+struct vtkLabelCacheKey
+{
+  vtkTextProperty* Property;
+  vtkMTimeType PropertyMTime;
+  int DPI;
+  std::string Text;
+
+  bool operator<(const vtkLabelCacheKey& other) const
+  {
+    return std::tie(this->Property, this->PropertyMTime, this->DPI, this->Text) <
+      std::tie(other.Property, other.PropertyMTime, other.DPI, other.Text);
+  }
+};
+
+struct vtkLabelCacheValue
+{
+  vtkSmartPointer<vtkTextMapper> Mapper;
+  vtkSmartPointer<vtkActor2D> Actor;
+  int BBox[4] = { 0, -1, 0, -1 };
+  bool HasBBox = false;
+  vtkTypeUInt64 LastUsedFrame = 0;
+};
+} // end anonymous namespace
+
+class vtkFreeTypeLabelRenderStrategy::Internals
+{
+public:
+  std::map<vtkLabelCacheKey, vtkLabelCacheValue> Cache;
+  vtkTypeUInt64 FrameNumber = 0;
+
+  vtkLabelCacheValue& FetchEntry(vtkTextProperty* tprop, const vtkStdString& label, int dpi)
+  {
+    vtkLabelCacheKey key{ tprop, tprop->GetMTime(), dpi, label };
+    vtkLabelCacheValue& value = this->Cache[key];
+    value.LastUsedFrame = this->FrameNumber;
+    return value;
+  }
+};
+
 vtkStandardNewMacro(vtkFreeTypeLabelRenderStrategy);
 
 //------------------------------------------------------------------------------
 vtkFreeTypeLabelRenderStrategy::vtkFreeTypeLabelRenderStrategy()
 {
   this->TextRenderer = vtkTextRenderer::GetInstance();
-  this->Mapper = vtkTextMapper::New();
-  this->Actor = vtkActor2D::New();
-  this->Actor->SetMapper(this->Mapper);
+  this->Implementation = new Internals();
 }
 
 //------------------------------------------------------------------------------
 vtkFreeTypeLabelRenderStrategy::~vtkFreeTypeLabelRenderStrategy()
 {
-  this->Mapper->Delete();
-  this->Actor->Delete();
+  delete this->Implementation;
 }
 
 void vtkFreeTypeLabelRenderStrategy::ReleaseGraphicsResources(vtkWindow* window)
 {
-  this->Actor->ReleaseGraphicsResources(window);
+  for (auto& entry : this->Implementation->Cache)
+  {
+    if (entry.second.Actor)
+    {
+      entry.second.Actor->ReleaseGraphicsResources(window);
+    }
+  }
+  this->Implementation->Cache.clear();
 }
 
 // double compute_bounds_time1 = 0;
@@ -60,13 +112,6 @@ void vtkFreeTypeLabelRenderStrategy::ComputeLabelBounds(
   {
     tprop = this->DefaultTextProperty;
   }
-  vtkSmartPointer<vtkTextProperty> copy = tprop;
-  if (tprop->GetOrientation() != 0.0)
-  {
-    copy = vtkSmartPointer<vtkTextProperty>::New();
-    copy->ShallowCopy(tprop);
-    copy->SetOrientation(0.0);
-  }
 
   int dpi = 72;
   if (this->Renderer && this->Renderer->GetVTKWindow())
@@ -78,14 +123,28 @@ void vtkFreeTypeLabelRenderStrategy::ComputeLabelBounds(
     vtkWarningMacro(<< "No Renderer set. Assuming DPI of " << dpi << ".");
   }
 
-  int bbox[4];
-  this->TextRenderer->GetBoundingBox(copy, label, bbox, dpi);
+  // Measuring a string walks its glyphs through FreeType, which is far more
+  // expensive than the justification arithmetic below; reuse the cached
+  // bounding box when this label was measured before.
+  vtkLabelCacheValue& value = this->Implementation->FetchEntry(tprop, label, dpi);
+  if (!value.HasBBox)
+  {
+    vtkSmartPointer<vtkTextProperty> copy = tprop;
+    if (tprop->GetOrientation() != 0.0)
+    {
+      copy = vtkSmartPointer<vtkTextProperty>::New();
+      copy->ShallowCopy(tprop);
+      copy->SetOrientation(0.0);
+    }
+    this->TextRenderer->GetBoundingBox(copy, label, value.BBox, dpi);
+    value.HasBBox = true;
+  }
 
   // Take line offset into account
-  bds[0] = bbox[0];
-  bds[1] = bbox[1];
-  bds[2] = bbox[2] - tprop->GetLineOffset();
-  bds[3] = bbox[3] - tprop->GetLineOffset();
+  bds[0] = value.BBox[0];
+  bds[1] = value.BBox[1];
+  bds[2] = value.BBox[2] - tprop->GetLineOffset();
+  bds[3] = value.BBox[3] - tprop->GetLineOffset();
 
   // Take justification into account
   double sz[2] = { bds[1] - bds[0], bds[3] - bds[2] };
@@ -142,11 +201,27 @@ void vtkFreeTypeLabelRenderStrategy::RenderLabel(
   {
     tprop = this->DefaultTextProperty;
   }
-  this->Mapper->SetTextProperty(tprop);
-  this->Mapper->SetInput(label.c_str());
-  this->Actor->GetPositionCoordinate()->SetCoordinateSystemToDisplay();
-  this->Actor->GetPositionCoordinate()->SetValue(x[0], x[1], 0.0);
-  this->Mapper->RenderOverlay(this->Renderer, this->Actor);
+
+  int dpi = 72;
+  if (this->Renderer->GetVTKWindow())
+  {
+    dpi = this->Renderer->GetVTKWindow()->GetDPI();
+  }
+
+  // Each cached label keeps its own mapper so its rasterized texture stays
+  // valid between frames; only the actor position changes per render.
+  vtkLabelCacheValue& value = this->Implementation->FetchEntry(tprop, label, dpi);
+  if (!value.Mapper)
+  {
+    value.Mapper = vtkSmartPointer<vtkTextMapper>::New();
+    value.Mapper->SetTextProperty(tprop);
+    value.Mapper->SetInput(label.c_str());
+    value.Actor = vtkSmartPointer<vtkActor2D>::New();
+    value.Actor->SetMapper(value.Mapper);
+  }
+  value.Actor->GetPositionCoordinate()->SetCoordinateSystemToDisplay();
+  value.Actor->GetPositionCoordinate()->SetValue(x[0], x[1], 0.0);
+  value.Mapper->RenderOverlay(this->Renderer, value.Actor);
   // timer->StopTimer();
   // render_label_time1 += timer->GetElapsedTime();
   // render_label_iter1++;
@@ -156,6 +231,25 @@ void vtkFreeTypeLabelRenderStrategy::RenderLabel(
   //  }
 }
 
+//------------------------------------------------------------------------------
+void vtkFreeTypeLabelRenderStrategy::EndFrame()
+{
+  this->Superclass::EndFrame();
+
+  this->Implementation->FrameNumber++;
+  for (auto it = this->Implementation->Cache.begin(); it != this->Implementation->Cache.end();)
+  {
+    if (it->second.LastUsedFrame + vtkLabelCacheMaxFrameAge < this->Implementation->FrameNumber)
+    {
+      it = this->Implementation->Cache.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkFreeTypeLabelRenderStrategy::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -7,6 +7,12 @@
  *
  * Uses the FreeType to render labels and compute label sizes.
  * This strategy may be used with vtkLabelPlacementMapper.
+ *
+ * Rendered labels and their bounds are cached across frames, keyed on the
+ * label text and the text property, so that a label whose appearance has not
+ * changed reuses its existing textured quad instead of being re-rasterized
+ * through FreeType on every camera move. Entries that go unused for a few
+ * frames are released at the end of the frame.
  */
 
 #ifndef vtkFreeTypeLabelRenderStrategy_h
@@ -16,9 +22,7 @@
 #include "vtkRenderingLabelModule.h" // For export macro
 
 VTK_ABI_NAMESPACE_BEGIN
-class vtkActor2D;
 class vtkTextRenderer;
-class vtkTextMapper;
 
 class VTKRENDERINGLABEL_EXPORT vtkFreeTypeLabelRenderStrategy : public vtkLabelRenderStrategy
 {
@@ -48,6 +52,12 @@ public:
    */
   void RenderLabel(int x[2], vtkTextProperty* tprop, vtkStdString label) override;
 
+  /**
+   * End a rendering frame. Drops cached label textures that were not used
+   * for several consecutive frames.
+   */
+  void EndFrame() override;
+
   /**
    * Release any graphics resources that are being consumed by this strategy.
    * The parameter window could be used to determine which graphic
@@ -60,8 +70,9 @@ protected:
   ~vtkFreeTypeLabelRenderStrategy() override;
 
   vtkTextRenderer* TextRenderer;
-  vtkTextMapper* Mapper;
-  vtkActor2D* Actor;
+
+  class Internals;
+  Internals* Implementation;
 
 private:
   vtkFreeTypeLabelRenderStrategy(const vtkFreeTypeLabelRenderStrategy&) = delete;
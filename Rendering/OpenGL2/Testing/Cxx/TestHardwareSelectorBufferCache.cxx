@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkActor.h"
+#include "vtkCallbackCommand.h"
+#include "vtkCamera.h"
+#include "vtkCommand.h"
+#include "vtkHardwareSelector.h"
+#include "vtkNew.h"
+#include "vtkPolyDataMapper.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
+#include "vtkSelection.h"
+#include "vtkSphereSource.h"
+
+namespace
+{
+// Counts the selection captures; a cached pick performs none.
+void CountCapture(vtkObject*, unsigned long, void* clientData, void*)
+{
+  ++*static_cast<int*>(clientData);
+}
+}
+
+int TestHardwareSelectorBufferCache(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkPolyDataMapper> mapper;
+  mapper->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+
+  vtkNew<vtkRenderer> renderer;
+  vtkNew<vtkRenderWindow> renderWindow;
+  renderWindow->SetSize(300, 300);
+  renderWindow->SetMultiSamples(0);
+  renderWindow->AddRenderer(renderer);
+  renderer->AddActor(actor);
+  renderWindow->Render();
+
+  vtkNew<vtkHardwareSelector> selector;
+  selector->SetRenderer(renderer);
+  selector->SetArea(0, 0, 299, 299);
+  selector->UseBufferCacheOn();
+
+  int captureCount = 0;
+  vtkNew<vtkCallbackCommand> counter;
+  counter->SetCallback(CountCapture);
+  counter->SetClientData(&captureCount);
+  selector->AddObserver(vtkCommand::StartEvent, counter);
+
+  // The first pick captures the buffers.
+  vtkSelection* selection = selector->Select();
+  vtkIdType firstNodes = selection ? selection->GetNumberOfNodes() : -1;
+  if (selection)
+  {
+    selection->Delete();
+  }
+  if (captureCount != 1 || firstNodes < 1)
+  {
+    std::cerr << "First pick did not capture a selection" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A pick on the unchanged scene answers from the cache.
+  selection = selector->Select();
+  vtkIdType cachedNodes = selection ? selection->GetNumberOfNodes() : -1;
+  if (selection)
+  {
+    selection->Delete();
+  }
+  if (captureCount != 1 || cachedNodes != firstNodes)
+  {
+    std::cerr << "Cached pick re-rendered or returned a different selection" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A camera move invalidates the cache.
+  renderer->GetActiveCamera()->Azimuth(20);
+  renderWindow->Render();
+  selection = selector->Select();
+  if (selection)
+  {
+    selection->Delete();
+  }
+  if (captureCount != 2)
+  {
+    std::cerr << "Camera change did not trigger a new capture" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // So does a change to a prop that contributed pixels.
+  actor->SetPosition(0.1, 0.0, 0.0);
+  renderWindow->Render();
+  selection = selector->Select();
+  if (selection)
+  {
+    selection->Delete();
+  }
+  if (captureCount != 3)
+  {
+    std::cerr << "Prop change did not trigger a new capture" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Explicit invalidation forces a capture even on an unchanged scene.
+  selector->InvalidateCachedSelection();
+  selection = selector->Select();
+  if (selection)
+  {
+    selection->Delete();
+  }
+  if (captureCount != 4)
+  {
+    std::cerr << "InvalidateCachedSelection did not discard the cache" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkActor.h"
+#include "vtkCamera.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPointGaussianMapper.h"
+#include "vtkPointSource.h"
+#include "vtkRandomAttributeGenerator.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderWindowInteractor.h"
+#include "vtkRenderer.h"
+
+// Exercise the order-independent translucency path for non-emissive
+// gaussian splats: the mapper must report translucent geometry so the
+// renderer composites the unsorted splats with its order-independent
+// translucent pass.
+int TestPointGaussianMapperTranslucent(int, char*[])
+{
+  int desiredPoints = 1.0e4;
+
+  vtkNew<vtkPointSource> points;
+  points->SetNumberOfPoints(desiredPoints);
+  points->SetRadius(pow(desiredPoints, 0.33) * 10.0);
+
+  vtkNew<vtkRandomAttributeGenerator> randomAttr;
+  randomAttr->SetInputConnection(points->GetOutputPort());
+  randomAttr->SetDataTypeToFloat();
+  randomAttr->GeneratePointScalarsOn();
+  randomAttr->GeneratePointArrayOn();
+
+  vtkNew<vtkPointGaussianMapper> mapper;
+  mapper->SetInputConnection(randomAttr->GetOutputPort());
+  mapper->SetScalarVisibility(0);
+  mapper->SetScaleArray("RandomPointScalars");
+  mapper->SetOpacityArray("RandomPointArray");
+  mapper->EmissiveOff();
+  mapper->OrderIndependentTranslucencyOn();
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->SetBackground(0.0, 0.0, 0.0);
+  vtkNew<vtkRenderWindow> renderWindow;
+  renderWindow->SetSize(300, 300);
+  renderWindow->SetMultiSamples(0);
+  renderWindow->AddRenderer(renderer);
+  vtkNew<vtkRenderWindowInteractor> iren;
+  iren->SetRenderWindow(renderWindow);
+
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  renderer->AddActor(actor);
+
+  renderWindow->Render();
+
+  if (!mapper->HasTranslucentPolygonalGeometry())
+  {
+    std::cerr << "Splats were not reported as translucent geometry" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // emissive splats keep their additive opaque-pass rendering
+  mapper->EmissiveOn();
+  if (mapper->HasTranslucentPolygonalGeometry())
+  {
+    std::cerr << "Emissive splats were reported as translucent geometry" << std::endl;
+    return EXIT_FAILURE;
+  }
+  mapper->EmissiveOff();
+
+  // a few frames of camera motion through the translucent pass
+  for (int i = 0; i < 10; ++i)
+  {
+    renderer->GetActiveCamera()->Azimuth(3);
+    renderWindow->Render();
+  }
+
+  return EXIT_SUCCESS;
+}
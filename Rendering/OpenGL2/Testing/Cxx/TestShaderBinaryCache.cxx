@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkActor.h"
+#include "vtkNew.h"
+#include "vtkOpenGLRenderWindow.h"
+#include "vtkOpenGLShaderCache.h"
+#include "vtkPolyDataMapper.h"
+#include "vtkRenderWindowInteractor.h"
+#include "vtkRenderer.h"
+#include "vtkSphereSource.h"
+#include "vtkTestUtilities.h"
+
+#include "vtksys/SystemTools.hxx"
+
+namespace
+{
+int RenderOnce(const std::string& binaryDirectory)
+{
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkPolyDataMapper> mapper;
+  mapper->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+
+  vtkNew<vtkRenderWindow> renderWindow;
+  renderWindow->SetSize(300, 300);
+  renderWindow->AddRenderer(renderer);
+  vtkNew<vtkRenderWindowInteractor> iren;
+  iren->SetRenderWindow(renderWindow);
+
+  vtkOpenGLRenderWindow* oglWindow = vtkOpenGLRenderWindow::SafeDownCast(renderWindow);
+  if (!oglWindow)
+  {
+    std::cerr << "Not an OpenGL render window" << std::endl;
+    return EXIT_FAILURE;
+  }
+  oglWindow->GetShaderCache()->SetProgramBinaryDirectory(binaryDirectory.c_str());
+
+  renderWindow->Render();
+  renderWindow->Finalize();
+  return EXIT_SUCCESS;
+}
+}
+
+// Exercise the on disk program binary cache: the first window populates
+// the cache directory while compiling its programs, the second one
+// restores from it where the driver supports program binaries. Drivers
+// without support must render identically through plain compilation, so
+// no cache contents are asserted here.
+int TestShaderBinaryCache(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string binaryDirectory = std::string(tempDir) + "/TestShaderBinaryCache";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(binaryDirectory);
+
+  // cold start, compiles and stores
+  if (RenderOnce(binaryDirectory) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+  // warmed start, restores where supported
+  if (RenderOnce(binaryDirectory) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtksys::SystemTools::RemoveADirectory(binaryDirectory);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkAdaptiveResolutionPass.h"
+#include "vtkObjectFactory.h"
+#include "vtkOpenGLError.h"
+#include "vtkOpenGLFramebufferObject.h"
+#include "vtkOpenGLRenderWindow.h"
+#include "vtkOpenGLState.h"
+#include "vtkRenderState.h"
+#include "vtkRenderer.h"
+#include "vtkTextureObject.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkAdaptiveResolutionPass);
+
+//------------------------------------------------------------------------------
+vtkAdaptiveResolutionPass::vtkAdaptiveResolutionPass()
+{
+  this->FrameBufferObject = nullptr;
+  this->ColorTexture = nullptr;
+  this->ResolutionScale = 0.5;
+  this->InteractiveUpdateRate = 1.0;
+}
+
+//------------------------------------------------------------------------------
+vtkAdaptiveResolutionPass::~vtkAdaptiveResolutionPass()
+{
+  if (this->FrameBufferObject != nullptr)
+  {
+    vtkErrorMacro(<< "FrameBufferObject should have been deleted in ReleaseGraphicsResources().");
+  }
+  if (this->ColorTexture != nullptr)
+  {
+    vtkErrorMacro(<< "ColorTexture should have been deleted in ReleaseGraphicsResources().");
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkAdaptiveResolutionPass::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "ResolutionScale: " << this->ResolutionScale << endl;
+  os << indent << "InteractiveUpdateRate: " << this->InteractiveUpdateRate << endl;
+}
+
+//------------------------------------------------------------------------------
+// Description:
+// Perform rendering according to a render state \p s.
+// \pre s_exists: s!=0
+void vtkAdaptiveResolutionPass::Render(const vtkRenderState* s)
+{
+  assert("pre: s_exists" && s != nullptr);
+
+  vtkOpenGLClearErrorMacro();
+
+  this->NumberOfRenderedProps = 0;
+
+  vtkRenderer* r = s->GetRenderer();
+  vtkOpenGLRenderWindow* renWin = static_cast<vtkOpenGLRenderWindow*>(r->GetRenderWindow());
+  vtkOpenGLState* ostate = renWin->GetState();
+
+  if (this->DelegatePass == nullptr)
+  {
+    vtkWarningMacro(<< " no delegate.");
+    return;
+  }
+
+  // During a still render (the interactor has dropped the desired update
+  // rate back to the still update rate), or when no reduction is requested,
+  // render the delegate directly at full resolution.
+  if (renWin->GetDesiredUpdateRate() < this->InteractiveUpdateRate ||
+    this->ResolutionScale >= 1.0)
+  {
+    this->DelegatePass->Render(s);
+    this->NumberOfRenderedProps += this->DelegatePass->GetNumberOfRenderedProps();
+    return;
+  }
+
+  // 1. Get the viewport dimensions.
+  int viewportX;
+  int viewportY;
+  int viewportWidth;
+  int viewportHeight;
+  if (s->GetFrameBuffer() == nullptr)
+  {
+    r->GetTiledSizeAndOrigin(&viewportWidth, &viewportHeight, &viewportX, &viewportY);
+  }
+  else
+  {
+    int size[2];
+    s->GetWindowSize(size);
+    viewportWidth = size[0];
+    viewportHeight = size[1];
+    viewportX = 0;
+    viewportY = 0;
+  }
+
+  int reducedWidth =
+    std::max(1, static_cast<int>(std::ceil(viewportWidth * this->ResolutionScale)));
+  int reducedHeight =
+    std::max(1, static_cast<int>(std::ceil(viewportHeight * this->ResolutionScale)));
+
+  if (this->ColorTexture == nullptr)
+  {
+    this->ColorTexture = vtkTextureObject::New();
+    this->ColorTexture->SetContext(renWin);
+  }
+
+  if (this->FrameBufferObject == nullptr)
+  {
+    this->FrameBufferObject = vtkOpenGLFramebufferObject::New();
+    this->FrameBufferObject->SetContext(renWin);
+  }
+
+  // 2. Render the delegate into the reduced-resolution render target.
+  ostate->PushFramebufferBindings();
+  this->RenderDelegate(s, viewportWidth, viewportHeight, reducedWidth, reducedHeight,
+    this->FrameBufferObject, this->ColorTexture);
+  ostate->PopFramebufferBindings();
+
+  // 3. Upscale the result to the full viewport with a linear blit.
+  ostate->PushReadFramebufferBinding();
+  this->FrameBufferObject->Bind(vtkOpenGLFramebufferObject::GetReadMode());
+
+  ostate->vtkglViewport(viewportX, viewportY, viewportWidth, viewportHeight);
+  ostate->vtkglScissor(viewportX, viewportY, viewportWidth, viewportHeight);
+
+  ostate->vtkglBlitFramebuffer(0, 0, reducedWidth, reducedHeight, viewportX, viewportY,
+    viewportX + viewportWidth, viewportY + viewportHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+
+  ostate->PopReadFramebufferBinding();
+
+  vtkOpenGLCheckErrorMacro("failed after Render");
+}
+
+//------------------------------------------------------------------------------
+// Description:
+// Release graphics resources and ask components to release their own
+// resources.
+// \pre w_exists: w!=0
+void vtkAdaptiveResolutionPass::ReleaseGraphicsResources(vtkWindow* w)
+{
+  assert("pre: w_exists" && w != nullptr);
+
+  this->Superclass::ReleaseGraphicsResources(w);
+
+  if (this->FrameBufferObject != nullptr)
+  {
+    this->FrameBufferObject->Delete();
+    this->FrameBufferObject = nullptr;
+  }
+  if (this->ColorTexture != nullptr)
+  {
+    this->ColorTexture->Delete();
+    this->ColorTexture = nullptr;
+  }
+}
+VTK_ABI_NAMESPACE_END
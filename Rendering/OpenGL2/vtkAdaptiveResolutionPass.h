@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkAdaptiveResolutionPass
+ * @brief   Render the delegate at reduced resolution during interaction
+ *
+ * This pass renders its delegate into an offscreen render target whose size
+ * is reduced by ResolutionScale whenever the render window's desired update
+ * rate is at or above InteractiveUpdateRate, then upscales the result to the
+ * full viewport with linear filtering. Since vtkRenderWindowInteractor raises
+ * the desired update rate while the camera is being manipulated and lowers it
+ * back to the still update rate afterwards, the degradation engages during
+ * camera motion and full resolution is restored automatically on the next
+ * still render, without any per-application logic.
+ *
+ * When the desired update rate is below InteractiveUpdateRate the delegate is
+ * rendered directly and this pass adds no overhead beyond the rate check.
+ *
+ * Its delegate is usually set to a vtkCameraPass or to a post-processing
+ * pass. Chaining a vtkOpenGLFXAAPass after this pass softens the blockiness
+ * of the upscaled interactive frames. Note that volume mappers already
+ * degrade independently through their AutoAdjustSampleDistances support, and
+ * geometry can be budgeted with vtkLODActor/vtkQuadricLODActor; this pass
+ * covers the remaining per-pixel rendering cost.
+ *
+ * This pass requires an OpenGL context that supports texture objects (TO),
+ * framebuffer objects (FBO) and GLSL. If not, it will emit an error message
+ * and will render its delegate and return.
+ *
+ * @sa
+ * vtkRenderPass vtkImageProcessingPass vtkOpenGLFXAAPass
+ */
+
+#ifndef vtkAdaptiveResolutionPass_h
+#define vtkAdaptiveResolutionPass_h
+
+#include "vtkImageProcessingPass.h"
+#include "vtkRenderingOpenGL2Module.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkOpenGLFramebufferObject;
+class vtkTextureObject;
+
+class VTKRENDERINGOPENGL2_EXPORT vtkAdaptiveResolutionPass : public vtkImageProcessingPass
+{
+public:
+  static vtkAdaptiveResolutionPass* New();
+  vtkTypeMacro(vtkAdaptiveResolutionPass, vtkImageProcessingPass);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Perform rendering according to a render state \p s.
+   * \pre s_exists: s!=0
+   */
+  void Render(const vtkRenderState* s) override;
+
+  /**
+   * Release graphics resources and ask components to release their own
+   * resources.
+   * \pre w_exists: w!=0
+   */
+  void ReleaseGraphicsResources(vtkWindow* w) override;
+
+  ///@{
+  /**
+   * Set/Get the factor applied to the viewport dimensions while the desired
+   * update rate indicates interaction. Valid values are clamped to [0.1, 1.0].
+   * A value of 0.5 renders a quarter of the pixels. Initial value is 0.5.
+   */
+  vtkSetClampMacro(ResolutionScale, double, 0.1, 1.0);
+  vtkGetMacro(ResolutionScale, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the desired update rate (in frames per second) at or above which
+   * the reduced-resolution path is used. The interactor's still update rate
+   * is conventionally well below 1 frame per second while its interactive
+   * desired update rate is well above it, so the initial value of 1.0
+   * distinguishes the two without further configuration.
+   */
+  vtkSetClampMacro(InteractiveUpdateRate, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(InteractiveUpdateRate, double);
+  ///@}
+
+protected:
+  /**
+   * Default constructor. DelegatePass is set to NULL.
+   */
+  vtkAdaptiveResolutionPass();
+
+  /**
+   * Destructor.
+   */
+  ~vtkAdaptiveResolutionPass() override;
+
+  /**
+   * Graphics resources.
+   */
+  vtkOpenGLFramebufferObject* FrameBufferObject;
+  vtkTextureObject* ColorTexture; // reduced-resolution render target
+
+  double ResolutionScale;
+  double InteractiveUpdateRate;
+
+private:
+  vtkAdaptiveResolutionPass(const vtkAdaptiveResolutionPass&) = delete;
+  void operator=(const vtkAdaptiveResolutionPass&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif /* vtkAdaptiveResolutionPass_h */
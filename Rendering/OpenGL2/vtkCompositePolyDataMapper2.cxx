@@ -553,10 +553,12 @@ void vtkCompositeMapperHelper2::BuildBufferObjects(vtkRenderer* ren, vtkActor* a
   std::vector<unsigned char> newColors;
   std::vector<float> newNorms;
 
-  this->VBOs->ClearAllVBOs();
-
+  // keep the VBOs around; BuildAllVBOs reuses the uploaded data for
+  // attributes whose appended arrays have not changed and frees the
+  // VBOs of attributes that are no longer appended
   if (this->Data.begin() == this->Data.end())
   {
+    this->VBOs->ClearAllVBOs();
     this->VBOBuildTime.Modified();
     return;
   }
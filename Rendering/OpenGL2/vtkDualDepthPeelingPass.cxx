@@ -70,6 +70,7 @@ void annotate(const std::string& str)
 void vtkDualDepthPeelingPass::PrintSelf(std::ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "FragmentBudget: " << this->FragmentBudget << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -787,6 +788,8 @@ vtkDualDepthPeelingPass::vtkDualDepthPeelingPass()
   , VolumetricOcclusionQueryId(0)
   , VolumetricWrittenPixels(0)
   , OcclusionThreshold(0)
+  , FragmentBudget(0)
+  , PeeledFragmentCount(0)
   , TranslucentRenderCount(0)
   , VolumetricRenderCount(0)
   , SaveScissorTestState(false)
@@ -1068,6 +1071,7 @@ void vtkDualDepthPeelingPass::InitializeOcclusionQuery()
   // TranslucentWrittenPixels are initialized to be above the required OcclusionThreshold
   // If they would, they may never be updated if IsRenderingVolumes is false
   this->VolumetricWrittenPixels = 0;
+  this->PeeledFragmentCount = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -1205,6 +1209,13 @@ bool vtkDualDepthPeelingPass::PeelingDone()
 {
   const auto writtenPix = this->TranslucentWrittenPixels + this->VolumetricWrittenPixels;
 
+  if (this->FragmentBudget > 0 && this->PeeledFragmentCount >= this->FragmentBudget)
+  {
+    // over budget; the layers still hidden between the accumulation
+    // buffers are alpha blended in Finalize()
+    return true;
+  }
+
   return this->CurrentPeel >= this->MaximumNumberOfPeels || writtenPix <= this->OcclusionThreshold;
 }
 
@@ -1233,6 +1244,7 @@ void vtkDualDepthPeelingPass::Peel()
 
   this->SwapDepthBufferSourceDest();
 
+  this->PeeledFragmentCount += this->TranslucentWrittenPixels + this->VolumetricWrittenPixels;
   ++this->CurrentPeel;
 
 #ifdef DEBUG_PEEL
@@ -72,6 +72,22 @@ public:
   virtual void SetVolumetricPass(vtkRenderPass* volumetricPass);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get an upper bound on the total number of translucent and
+   * volumetric fragments peeled per frame, measured with the pass's
+   * occlusion queries across peel iterations. Deeply layered scenes stop
+   * peeling once the budget is spent and composite the layers still
+   * hidden between the accumulation buffers with the same unsorted alpha
+   * blending used when MaximumNumberOfPeels is reached (step 4 above).
+   * This bounds the worst case frame time by the scene's fragment count
+   * rather than by its depth complexity, without limiting scenes with few
+   * layers. The default of 0 leaves peeling unbounded.
+   */
+  vtkSetMacro(FragmentBudget, unsigned long long);
+  vtkGetMacro(FragmentBudget, unsigned long long);
+  ///@}
+
   // vtkOpenGLRenderPass virtuals:
   bool PreReplaceShaderValues(std::string& vertexShader, std::string& geometryShader,
     std::string& fragmentShader, vtkAbstractMapper* mapper, vtkProp* prop) override;
@@ -253,6 +269,8 @@ protected:
   unsigned int VolumetricOcclusionQueryId;
   unsigned int VolumetricWrittenPixels;
   unsigned int OcclusionThreshold;
+  unsigned long long FragmentBudget;
+  unsigned long long PeeledFragmentCount;
 
   int TranslucentRenderCount; // Debug info, counts number of geometry passes.
   int VolumetricRenderCount;  // Debug info, counts number of volumetric passes.
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "vtkOpenGLBatchedPolyDataMapper.h"
+#include "vtkCamera.h"
 #include "vtkCellData.h"
 #include "vtkColorTransferFunction.h"
 #include "vtkCompositePolyDataMapper.h"
@@ -9,6 +10,8 @@
 #include "vtkHardwareSelector.h"
 #include "vtkImageData.h"
 #include "vtkLookupTable.h"
+#include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLCellToVTKCellMap.h"
 #include "vtkOpenGLCompositePolyDataMapperDelegator.h"
@@ -28,6 +31,7 @@
 #include "vtkTextureObject.h"
 #include "vtkTransform.h"
 #include "vtkUnsignedIntArray.h"
+#include <algorithm>
 #include <sstream>
 
 namespace
@@ -53,6 +57,20 @@ private:
 
 VTK_ABI_NAMESPACE_BEGIN
 
+namespace
+{
+// Returns true when SetShaderValues would emit the same uniform values for
+// both blocks outside of the selection passes, i.e. their draws can be
+// merged into a single one.
+bool BatchElementsShareShaderValues(
+  const vtkOpenGLCompositePolyDataMapperDelegator::BatchElement& first,
+  const vtkOpenGLCompositePolyDataMapperDelegator::BatchElement& second)
+{
+  return first.Opacity == second.Opacity && first.AmbientColor == second.AmbientColor &&
+    first.DiffuseColor == second.DiffuseColor && first.OverridesColor == second.OverridesColor;
+}
+} // end anonymous namespace
+
 #define SCOPED_ROLLBACK(type, varName)                                                             \
   ScopedValueRollback<type> saver_##varName(this->varName, batchElement.varName)
 
@@ -162,6 +180,7 @@ void vtkOpenGLBatchedPolyDataMapper::RenderPiece(vtkRenderer* renderer, vtkActor
   this->CurrentInput = this->VTKPolyDataToGLBatchElement.begin()->second->Parent.PolyData;
 
   this->UpdateCameraShiftScale(renderer, actor);
+  this->UpdateBlockFrustumVisibility(renderer, actor);
   this->RenderPieceStart(renderer, actor);
   this->RenderPieceDraw(renderer, actor);
   this->RenderPieceFinish(renderer, actor);
@@ -621,6 +640,60 @@ void vtkOpenGLBatchedPolyDataMapper::UpdateCameraShiftScale(vtkRenderer* rendere
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLBatchedPolyDataMapper::UpdateBlockFrustumVisibility(
+  vtkRenderer* renderer, vtkActor* actor)
+{
+  vtkCamera* camera = renderer->GetActiveCamera();
+  if (!camera || this->VTKPolyDataToGLBatchElement.size() <= 1)
+  {
+    for (auto& iter : this->VTKPolyDataToGLBatchElement)
+    {
+      iter.second->InsideFrustum = true;
+    }
+    return;
+  }
+
+  double planes[24];
+  camera->GetFrustumPlanes(renderer->GetTiledAspectRatio(), planes);
+  vtkMatrix4x4* matrix = actor->GetMatrix();
+  const bool isIdentity = actor->GetIsIdentity() != 0;
+
+  for (auto& iter : this->VTKPolyDataToGLBatchElement)
+  {
+    auto glBatchElement = iter.second.get();
+    double bounds[6];
+    glBatchElement->Parent.PolyData->GetBounds(bounds);
+    if (!vtkMath::AreBoundsInitialized(bounds))
+    {
+      glBatchElement->InsideFrustum = true;
+      continue;
+    }
+
+    // The block is off screen when all eight corners of its bounds lie
+    // behind one of the frustum planes; the plane normals point inward.
+    bool inside = true;
+    for (int planeId = 0; planeId < 6 && inside; ++planeId)
+    {
+      const double* plane = planes + 4 * planeId;
+      bool allBehind = true;
+      for (int corner = 0; corner < 8 && allBehind; ++corner)
+      {
+        double point[4] = { bounds[corner & 1], bounds[2 + ((corner >> 1) & 1)],
+          bounds[4 + ((corner >> 2) & 1)], 1.0 };
+        if (!isIdentity)
+        {
+          matrix->MultiplyPoint(point, point);
+        }
+        allBehind =
+          plane[0] * point[0] + plane[1] * point[1] + plane[2] * point[2] + plane[3] < 0.0;
+      }
+      inside = !allBehind;
+    }
+    glBatchElement->InsideFrustum = inside;
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLBatchedPolyDataMapper::DrawIBO(vtkRenderer* renderer, vtkActor* actor, int primType,
   vtkOpenGLHelper& CellBO, GLenum mode, int pointSize)
@@ -667,36 +740,76 @@ void vtkOpenGLBatchedPolyDataMapper::DrawIBO(vtkRenderer* renderer, vtkActor* ac
     bool selecting = this->CurrentSelector != nullptr;
     bool tpass = actor->IsRenderingTranslucentPolygonalGeometry();
 
+    // The IBO is packed in map iteration order, so consecutive drawn blocks
+    // occupy adjacent index ranges. When the shader state they would set is
+    // identical -- the common case for many-block datasets sharing display
+    // properties -- their draws are merged into a single call so that the
+    // draw call count is bounded by the number of distinct block appearances
+    // rather than the number of blocks. The selection passes need per-block
+    // ids and are never merged; neither are blocks when the program uses the
+    // per-block PrimitiveIDOffset or when missing arrays are colored with
+    // the NaN color, which depends on each block's arrays.
+    const bool mayCoalesce = !selecting && !this->DrawingSelection && !this->PrimIDUsed &&
+      !(this->Parent && this->Parent->GetColorMissingArraysWithNanColor());
+
+    GLBatchElement* runHead = nullptr;
+    GLuint runStartVertex = 0;
+    GLuint runEndVertex = 0;
+    unsigned int runStartIndex = 0;
+    unsigned int runEndIndex = 0;
+    auto flushRun = [&]() {
+      if (!runHead)
+      {
+        return;
+      }
+      unsigned int count = this->DrawingSelection ? static_cast<unsigned int>(CellBO.IBO->IndexCount)
+                                                  : runEndIndex - runStartIndex;
+      glDrawRangeElements(mode, runStartVertex, runEndVertex, count, GL_UNSIGNED_INT,
+        reinterpret_cast<const GLvoid*>(runStartIndex * sizeof(GLuint)));
+      runHead = nullptr;
+    };
+
     for (auto& iter : this->VTKPolyDataToGLBatchElement)
     {
       auto glBatchElement = iter.second.get();
       auto& batchElement = glBatchElement->Parent;
       bool shouldDraw = batchElement.Visibility     // must be visible
+        && glBatchElement->InsideFrustum            // and not entirely off screen
         && (!selecting || batchElement.Pickability) // and pickable when selecting
         && (((selecting || batchElement.IsOpaque || actor->GetForceOpaque()) &&
               !tpass) // opaque during opaque or when selecting
              || ((!batchElement.IsOpaque || actor->GetForceTranslucent()) && tpass &&
                   !selecting)); // translucent during translucent and never selecting
-      if (shouldDraw && glBatchElement->NextIndex[primType] > glBatchElement->StartIndex[primType])
+      if (!shouldDraw || glBatchElement->NextIndex[primType] <= glBatchElement->StartIndex[primType])
       {
-        // compilers think this can exceed the bounds so we also
-        // test against primType even though we should not need to
-        if (primType <= vtkOpenGLPolyDataMapper::PrimitiveTriStrips)
-        {
-          this->SetShaderValues(
-            prog, glBatchElement, glBatchElement->CellCellMap->GetPrimitiveOffsets()[primType]);
-        }
+        continue;
+      }
 
-        unsigned int count = this->DrawingSelection
-          ? static_cast<unsigned int>(CellBO.IBO->IndexCount)
-          : glBatchElement->NextIndex[primType] - glBatchElement->StartIndex[primType];
+      if (runHead && mayCoalesce && glBatchElement->StartIndex[primType] == runEndIndex &&
+        BatchElementsShareShaderValues(runHead->Parent, batchElement))
+      {
+        runEndVertex = std::max(runEndVertex,
+          static_cast<GLuint>(glBatchElement->NextVertex > 0 ? glBatchElement->NextVertex - 1 : 0));
+        runEndIndex = glBatchElement->NextIndex[primType];
+        continue;
+      }
 
-        glDrawRangeElements(mode, static_cast<GLuint>(glBatchElement->StartVertex),
-          static_cast<GLuint>(glBatchElement->NextVertex > 0 ? glBatchElement->NextVertex - 1 : 0),
-          count, GL_UNSIGNED_INT,
-          reinterpret_cast<const GLvoid*>(glBatchElement->StartIndex[primType] * sizeof(GLuint)));
+      flushRun();
+      // compilers think this can exceed the bounds so we also
+      // test against primType even though we should not need to
+      if (primType <= vtkOpenGLPolyDataMapper::PrimitiveTriStrips)
+      {
+        this->SetShaderValues(
+          prog, glBatchElement, glBatchElement->CellCellMap->GetPrimitiveOffsets()[primType]);
       }
+      runHead = glBatchElement;
+      runStartVertex = static_cast<GLuint>(glBatchElement->StartVertex);
+      runEndVertex =
+        static_cast<GLuint>(glBatchElement->NextVertex > 0 ? glBatchElement->NextVertex - 1 : 0);
+      runStartIndex = glBatchElement->StartIndex[primType];
+      runEndIndex = glBatchElement->NextIndex[primType];
     }
+    flushRun();
     CellBO.IBO->Release();
   }
 }
@@ -872,10 +985,12 @@ void vtkOpenGLBatchedPolyDataMapper::BuildBufferObjects(vtkRenderer* renderer, v
   std::vector<unsigned char> newColors;
   std::vector<float> newNorms;
 
-  this->VBOs->ClearAllVBOs();
-
+  // keep the VBOs around; BuildAllVBOs reuses the uploaded data for
+  // attributes whose appended arrays have not changed and frees the
+  // VBOs of attributes that are no longer appended
   if (this->VTKPolyDataToGLBatchElement.empty())
   {
+    this->VBOs->ClearAllVBOs();
     this->VBOBuildTime.Modified();
     return;
   }
@@ -79,6 +79,12 @@ protected:
   void RenderPieceDraw(vtkRenderer* renderer, vtkActor* actor) override;
   void UpdateCameraShiftScale(vtkRenderer* renderer, vtkActor* actoror) override;
 
+  /**
+   * Updates each block's InsideFrustum flag against the active camera so
+   * that DrawIBO can skip blocks entirely outside the view frustum.
+   */
+  void UpdateBlockFrustumVisibility(vtkRenderer* renderer, vtkActor* actor);
+
   /**
    * Draws primitives
    */
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkOpenGLBufferObject.h"
 #include "vtkObjectFactory.h"
+#include "vtkPerformanceCounters.h"
 
 #include "vtk_glew.h"
 
@@ -242,7 +243,14 @@ bool vtkOpenGLBufferObject::GenerateBuffer(vtkOpenGLBufferObject::ObjectType obj
 bool vtkOpenGLBufferObject::UploadInternal(
   const void* buffer, size_t size, vtkOpenGLBufferObject::ObjectType objectType)
 {
-  this->Allocate(size, objectType, this->GetUsage());
+  // When the new data is exactly the size of the existing allocation -- the
+  // common case for animations that re-upload their arrays every frame --
+  // update the storage in place instead of reallocating it via glBufferData.
+  if (this->Internal->Handle == 0 || this->Internal->Size != size ||
+    this->Internal->Type != convertType(objectType))
+  {
+    this->Allocate(size, objectType, this->GetUsage());
+  }
   return this->UploadRangeInternal(buffer, 0, size, objectType);
 }
 
@@ -262,6 +270,8 @@ bool vtkOpenGLBufferObject::UploadRangeInternal(
                 << "(offset: " << offset << ", size: " << size << ")");
   glBufferSubData(
     this->Internal->Type, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), buffer);
+  vtkPerformanceCounters::Add(
+    vtkPerformanceCounters::VBO_UPLOAD_BYTES, static_cast<vtkTypeUInt64>(size));
   this->Dirty = false;
   return true;
 }
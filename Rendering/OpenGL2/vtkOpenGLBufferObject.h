@@ -72,7 +72,9 @@ public:
 
   /**
    * Upload data to the buffer object. The BufferObject::type() must match
-   * @a type or be uninitialized.
+   * @a type or be uninitialized. When the buffer already holds an
+   * allocation of the same size, the data is written into it in place;
+   * otherwise the storage is reallocated first.
    *
    * The T type must have tightly packed values of T::value_type accessible by
    * reference via T::operator[]. Additionally, the standard size() and empty()
@@ -53,6 +53,10 @@ public:
 
     // stores the mapping from vtk cells to gl_PrimitiveId
     vtkNew<vtkOpenGLCellToVTKCellMap> CellCellMap;
+
+    // whether the block's bounds intersect the view frustum; updated every
+    // render so that draws of off-screen blocks can be skipped
+    bool InsideFrustum = true;
   };
 
   ///@{
@@ -21,10 +21,12 @@
 #include "vtkQuaternion.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTransform.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <map>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -771,243 +773,276 @@ void vtkOpenGLGlyph3DMapper::RebuildStructures(
       this->UseSourceTableTree ? getChildDataObject(sourceTableTree, i) : this->GetSource(i);
   }
 
-  double trans[16];
-  double normalTrans[9];
-
-  for (vtkIdType inPtId = 0; inPtId < numPts; inPtId++)
+  // report invalid configurations once instead of once per point
+  if (this->ScaleMode == SCALE_BY_COMPONENTS && scaleArray &&
+    scaleArray->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro("Cannot scale by components since " << scaleArray->GetName()
+                                                      << " does not have 3 components.");
+  }
+  const bool useSelectionArray =
+    this->UseSelectionIds && selectionArray && selectionArray->GetNumberOfTuples() > 0;
+  if (this->UseSelectionIds && !useSelectionArray)
   {
-    if (!(inPtId % 10000))
+    vtkWarningMacro(<< "UseSelectionIds is true, but selection array"
+                       " is invalid. Ignoring selection array.");
+  }
+
+  // scratch space for the vtkDataArray::GetTuple overload that is safe to call
+  // concurrently; sized for the widest array read per point
+  const int scratchSize = std::max(scaleArray ? scaleArray->GetNumberOfComponents() : 0,
+    selectionArray ? selectionArray->GetNumberOfComponents() : 0);
+
+  // Computes the transform, normal matrix, color and pick id of input point
+  // inPtId and stores them at position outPtId of the entry arrays.
+  auto buildInstance = [&](vtkOpenGLGlyph3DMapper::vtkOpenGLGlyph3DMapperEntry* entry,
+                         vtkIdType inPtId, vtkIdType outPtId, double* scratch) {
+    double trans[16];
+    double normalTrans[9];
+
+    entry->Colors[outPtId * 4] = color[0];
+    entry->Colors[outPtId * 4 + 1] = color[1];
+    entry->Colors[outPtId * 4 + 2] = color[2];
+    entry->Colors[outPtId * 4 + 3] = color[3];
+
+    double scalex = 1.0;
+    double scaley = 1.0;
+    double scalez = 1.0;
+    // Get the scalar and vector data
+    if (scaleArray)
     {
-      this->UpdateProgress(static_cast<double>(inPtId) / static_cast<double>(numPts));
-      if (this->GetAbortExecute())
+      scaleArray->GetTuple(inPtId, scratch);
+      switch (this->ScaleMode)
       {
-        break;
+        case SCALE_BY_MAGNITUDE:
+          scalex = scaley = scalez = vtkMath::Norm(scratch, scaleArray->GetNumberOfComponents());
+          break;
+        case SCALE_BY_COMPONENTS:
+          if (scaleArray->GetNumberOfComponents() == 3)
+          {
+            scalex = scratch[0];
+            scaley = scratch[1];
+            scalez = scratch[2];
+          }
+          break;
+        case NO_DATA_SCALING:
+        default:
+          break;
       }
-    }
 
-    if (maskArray && maskArray->GetValue(inPtId) == 0)
-    {
-      continue;
+      // Clamp data scale if enabled
+      if (this->Clamping && this->ScaleMode != NO_DATA_SCALING)
+      {
+        scalex = (scalex < this->Range[0] ? this->Range[0]
+                                          : (scalex > this->Range[1] ? this->Range[1] : scalex));
+        scalex = (scalex - this->Range[0]) / den;
+        scaley = (scaley < this->Range[0] ? this->Range[0]
+                                          : (scaley > this->Range[1] ? this->Range[1] : scaley));
+        scaley = (scaley - this->Range[0]) / den;
+        scalez = (scalez < this->Range[0] ? this->Range[0]
+                                          : (scalez > this->Range[1] ? this->Range[1] : scalez));
+        scalez = (scalez - this->Range[0]) / den;
+      }
     }
-
-    // Compute index into table of glyphs
-    if (indexArray)
+    scalex *= this->ScaleFactor;
+    scaley *= this->ScaleFactor;
+    scalez *= this->ScaleFactor;
+
+    // Now begin copying/transforming glyph
+    vtkMatrix4x4::Identity(trans);
+    vtkMatrix3x3::Identity(normalTrans);
+
+    // translate Source to Input point
+    double x[3];
+    dataset->GetPoint(inPtId, x);
+    trans[3] = x[0];
+    trans[7] = x[1];
+    trans[11] = x[2];
+
+    if (orientArray)
     {
-      double value =
-        vtkMath::Norm(indexArray->GetTuple(inPtId), indexArray->GetNumberOfComponents());
-      index = static_cast<int>(value);
-      index = vtkMath::ClampValue(index, 0, numEntries - 1);
-    }
-
-    // source can be null.
-    vtkDataObject* source =
-      index < static_cast<int>(sourceCache.size()) ? sourceCache[index] : nullptr;
+      double orientation[4];
+      orientArray->GetTuple(inPtId, orientation);
 
-    // Make sure we're not indexing into empty glyph
-    if (source)
-    {
-      vtkOpenGLGlyph3DMapper::vtkOpenGLGlyph3DMapperEntry* entry = subarray->Entries[index];
-
-      entry->Colors[entry->NumberOfPoints * 4] = color[0];
-      entry->Colors[entry->NumberOfPoints * 4 + 1] = color[1];
-      entry->Colors[entry->NumberOfPoints * 4 + 2] = color[2];
-      entry->Colors[entry->NumberOfPoints * 4 + 3] = color[3];
-
-      double scalex = 1.0;
-      double scaley = 1.0;
-      double scalez = 1.0;
-      // Get the scalar and vector data
-      if (scaleArray)
-      {
-        double* tuple = scaleArray->GetTuple(inPtId);
-        switch (this->ScaleMode)
-        {
-          case SCALE_BY_MAGNITUDE:
-            scalex = scaley = scalez = vtkMath::Norm(tuple, scaleArray->GetNumberOfComponents());
-            break;
-          case SCALE_BY_COMPONENTS:
-            if (scaleArray->GetNumberOfComponents() != 3)
-            {
-              vtkErrorMacro("Cannot scale by components since " << scaleArray->GetName()
-                                                                << " does not have 3 components.");
-            }
-            else
-            {
-              scalex = tuple[0];
-              scaley = tuple[1];
-              scalez = tuple[2];
-            }
-            break;
-          case NO_DATA_SCALING:
-          default:
-            break;
-        }
+      double rotMatrix[3][3];
+      vtkQuaterniond quaternion;
 
-        // Clamp data scale if enabled
-        if (this->Clamping && this->ScaleMode != NO_DATA_SCALING)
-        {
-          scalex = (scalex < this->Range[0] ? this->Range[0]
-                                            : (scalex > this->Range[1] ? this->Range[1] : scalex));
-          scalex = (scalex - this->Range[0]) / den;
-          scaley = (scaley < this->Range[0] ? this->Range[0]
-                                            : (scaley > this->Range[1] ? this->Range[1] : scaley));
-          scaley = (scaley - this->Range[0]) / den;
-          scalez = (scalez < this->Range[0] ? this->Range[0]
-                                            : (scalez > this->Range[1] ? this->Range[1] : scalez));
-          scalez = (scalez - this->Range[0]) / den;
-        }
-      }
-      scalex *= this->ScaleFactor;
-      scaley *= this->ScaleFactor;
-      scalez *= this->ScaleFactor;
-
-      // Now begin copying/transforming glyph
-      vtkMatrix4x4::Identity(trans);
-      vtkMatrix3x3::Identity(normalTrans);
-
-      // translate Source to Input point
-      double x[3];
-      dataset->GetPoint(inPtId, x);
-      trans[3] = x[0];
-      trans[7] = x[1];
-      trans[11] = x[2];
-
-      if (orientArray)
+      switch (this->OrientationMode)
       {
-        double orientation[4];
-        orientArray->GetTuple(inPtId, orientation);
-
-        double rotMatrix[3][3];
-        vtkQuaterniond quaternion;
-
-        switch (this->OrientationMode)
+        case ROTATION:
         {
-          case ROTATION:
-          {
-            double angle = vtkMath::RadiansFromDegrees(orientation[2]);
-            vtkQuaterniond qz(cos(0.5 * angle), 0.0, 0.0, sin(0.5 * angle));
+          double angle = vtkMath::RadiansFromDegrees(orientation[2]);
+          vtkQuaterniond qz(cos(0.5 * angle), 0.0, 0.0, sin(0.5 * angle));
 
-            angle = vtkMath::RadiansFromDegrees(orientation[0]);
-            vtkQuaterniond qx(cos(0.5 * angle), sin(0.5 * angle), 0.0, 0.0);
+          angle = vtkMath::RadiansFromDegrees(orientation[0]);
+          vtkQuaterniond qx(cos(0.5 * angle), sin(0.5 * angle), 0.0, 0.0);
 
-            angle = vtkMath::RadiansFromDegrees(orientation[1]);
-            vtkQuaterniond qy(cos(0.5 * angle), 0.0, sin(0.5 * angle), 0.0);
+          angle = vtkMath::RadiansFromDegrees(orientation[1]);
+          vtkQuaterniond qy(cos(0.5 * angle), 0.0, sin(0.5 * angle), 0.0);
 
-            quaternion = qz * qx * qy;
-          }
-          break;
+          quaternion = qz * qx * qy;
+        }
+        break;
 
-          case DIRECTION:
-            if (orientation[1] == 0.0 && orientation[2] == 0.0)
-            {
-              if (orientation[0] < 0) // just flip x if we need to
-              {
-                quaternion.Set(0.0, 0.0, 1.0, 0.0);
-              }
-            }
-            else
+        case DIRECTION:
+          if (orientation[1] == 0.0 && orientation[2] == 0.0)
+          {
+            if (orientation[0] < 0) // just flip x if we need to
             {
-              double vMag = vtkMath::Norm(orientation);
-              double vNew[3];
-              vNew[0] = (orientation[0] + vMag) / 2.0;
-              vNew[1] = orientation[1] / 2.0;
-              vNew[2] = orientation[2] / 2.0;
-
-              double f = 1.0 / sqrt(vNew[0] * vNew[0] + vNew[1] * vNew[1] + vNew[2] * vNew[2]);
-              vNew[0] *= f;
-              vNew[1] *= f;
-              vNew[2] *= f;
-
-              quaternion.Set(0.0, vNew[0], vNew[1], vNew[2]);
+              quaternion.Set(0.0, 0.0, 1.0, 0.0);
             }
-            break;
+          }
+          else
+          {
+            double vMag = vtkMath::Norm(orientation);
+            double vNew[3];
+            vNew[0] = (orientation[0] + vMag) / 2.0;
+            vNew[1] = orientation[1] / 2.0;
+            vNew[2] = orientation[2] / 2.0;
+
+            double f = 1.0 / sqrt(vNew[0] * vNew[0] + vNew[1] * vNew[1] + vNew[2] * vNew[2]);
+            vNew[0] *= f;
+            vNew[1] *= f;
+            vNew[2] *= f;
+
+            quaternion.Set(0.0, vNew[0], vNew[1], vNew[2]);
+          }
+          break;
 
-          case QUATERNION:
-            quaternion.Set(orientation);
-            break;
-        }
+        case QUATERNION:
+          quaternion.Set(orientation);
+          break;
+      }
 
-        quaternion.ToMatrix3x3(rotMatrix);
+      quaternion.ToMatrix3x3(rotMatrix);
 
-        for (int i = 0; i < 3; i++)
+      for (int i = 0; i < 3; i++)
+      {
+        for (int j = 0; j < 3; j++)
         {
-          for (int j = 0; j < 3; j++)
-          {
-            trans[4 * i + j] = rotMatrix[i][j];
-            normalTrans[3 * i + j] = rotMatrix[j][i]; // transpose
-          }
+          trans[4 * i + j] = rotMatrix[i][j];
+          normalTrans[3 * i + j] = rotMatrix[j][i]; // transpose
         }
       }
+    }
+
+    // Set pickid
+    // Use selectionArray value or glyph point ID.
+    vtkIdType selectionId = inPtId;
+    if (useSelectionArray)
+    {
+      selectionArray->GetTuple(inPtId, scratch);
+      selectionId = static_cast<vtkIdType>(scratch[0]);
+    }
+    entry->PickIds[outPtId] = selectionId;
+
+    if (colors)
+    {
+      colors->GetTypedTuple(inPtId, &(entry->Colors[outPtId * 4]));
+    }
 
-      // Set pickid
-      // Use selectionArray value or glyph point ID.
-      vtkIdType selectionId = inPtId;
-      if (this->UseSelectionIds)
+    // scale data if appropriate
+    if (this->Scaling)
+    {
+      if (scalex == 0.0)
       {
-        if (selectionArray == nullptr || selectionArray->GetNumberOfTuples() == 0)
-        {
-          vtkWarningMacro(<< "UseSelectionIds is true, but selection array"
-                             " is invalid. Ignoring selection array.");
-        }
-        else
-        {
-          selectionId = static_cast<vtkIdType>(*selectionArray->GetTuple(inPtId));
-        }
+        scalex = 1.0e-10;
+      }
+      if (scaley == 0.0)
+      {
+        scaley = 1.0e-10;
+      }
+      if (scalez == 0.0)
+      {
+        scalez = 1.0e-10;
       }
-      entry->PickIds[entry->NumberOfPoints] = selectionId;
 
-      if (colors)
+      for (int i = 0; i < 3; i++)
       {
-        colors->GetTypedTuple(inPtId, &(entry->Colors[entry->NumberOfPoints * 4]));
+        // inverse of normal matrix is directly computed with inverse scale
+        trans[4 * i] *= scalex;
+        normalTrans[i] /= scalex;
+        trans[4 * i + 1] *= scaley;
+        normalTrans[i + 3] /= scaley;
+        trans[4 * i + 2] *= scalez;
+        normalTrans[i + 6] /= scalez;
       }
+    }
 
-      // scale data if appropriate
-      if (this->Scaling)
+    float* matrices = &entry->Matrices[outPtId * 16];
+    float* normalMatrices = &entry->NormalMatrices[outPtId * 9];
+
+    for (int i = 0; i < 4; i++)
+    {
+      for (int j = 0; j < 4; j++)
       {
-        if (scalex == 0.0)
-        {
-          scalex = 1.0e-10;
-        }
-        if (scaley == 0.0)
-        {
-          scaley = 1.0e-10;
-        }
-        if (scalez == 0.0)
-        {
-          scalez = 1.0e-10;
-        }
+        matrices[i * 4 + j] = trans[j * 4 + i];
+      }
+    }
 
-        for (int i = 0; i < 3; i++)
+    for (int i = 0; i < 3; i++)
+    {
+      for (int j = 0; j < 3; j++)
+      {
+        normalMatrices[i * 3 + j] = normalTrans[i * 3 + j];
+      }
+    }
+  };
+
+  if (!maskArray && numEntries == 1 && sourceCache[0])
+  {
+    // Dense case: no masking and a single glyph source, so input point inPtId
+    // lands at position inPtId of the entry arrays and every instance can be
+    // built independently.
+    vtkOpenGLGlyph3DMapper::vtkOpenGLGlyph3DMapperEntry* entry = subarray->Entries[0];
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      std::vector<double> scratch(scratchSize);
+      for (vtkIdType inPtId = begin; inPtId < end; inPtId++)
+      {
+        buildInstance(entry, inPtId, inPtId, scratch.data());
+      }
+    });
+    entry->NumberOfPoints = numPts;
+  }
+  else
+  {
+    std::vector<double> scratch(scratchSize);
+    for (vtkIdType inPtId = 0; inPtId < numPts; inPtId++)
+    {
+      if (!(inPtId % 10000))
+      {
+        this->UpdateProgress(static_cast<double>(inPtId) / static_cast<double>(numPts));
+        if (this->GetAbortExecute())
         {
-          // inverse of normal matrix is directly computed with inverse scale
-          trans[4 * i] *= scalex;
-          normalTrans[i] /= scalex;
-          trans[4 * i + 1] *= scaley;
-          normalTrans[i + 3] /= scaley;
-          trans[4 * i + 2] *= scalez;
-          normalTrans[i + 6] /= scalez;
+          break;
         }
       }
 
-      float* matrices = &entry->Matrices[entry->NumberOfPoints * 16];
-      float* normalMatrices = &entry->NormalMatrices[entry->NumberOfPoints * 9];
+      if (maskArray && maskArray->GetValue(inPtId) == 0)
+      {
+        continue;
+      }
 
-      for (int i = 0; i < 4; i++)
+      // Compute index into table of glyphs
+      if (indexArray)
       {
-        for (int j = 0; j < 4; j++)
-        {
-          matrices[i * 4 + j] = trans[j * 4 + i];
-        }
+        double value =
+          vtkMath::Norm(indexArray->GetTuple(inPtId), indexArray->GetNumberOfComponents());
+        index = static_cast<int>(value);
+        index = vtkMath::ClampValue(index, 0, numEntries - 1);
       }
 
-      for (int i = 0; i < 3; i++)
+      // source can be null.
+      vtkDataObject* source =
+        index < static_cast<int>(sourceCache.size()) ? sourceCache[index] : nullptr;
+
+      // Make sure we're not indexing into empty glyph
+      if (source)
       {
-        for (int j = 0; j < 3; j++)
-        {
-          normalMatrices[i * 3 + j] = normalTrans[i * 3 + j];
-        }
+        vtkOpenGLGlyph3DMapper::vtkOpenGLGlyph3DMapperEntry* entry = subarray->Entries[index];
+        buildInstance(entry, inPtId, entry->NumberOfPoints, scratch.data());
+        entry->NumberOfPoints++;
       }
-      entry->NumberOfPoints++;
     }
   }
 
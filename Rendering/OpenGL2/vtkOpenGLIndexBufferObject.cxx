@@ -11,6 +11,7 @@
 #include "vtkPoints.h"
 #include "vtkPolygon.h"
 #include "vtkProperty.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
 #include "vtk_glew.h"
@@ -31,64 +32,107 @@ vtkOpenGLIndexBufferObject::~vtkOpenGLIndexBufferObject() = default;
 namespace
 {
 // A worker functor. The calculation is implemented in the function template
-// for operator().
+// for operator(). The cells are processed in parallel chunks, each chunk
+// appending to its own buffers which are concatenated in cell order
+// afterwards so the triangle order matches the serial traversal.
 struct AppendTrianglesWorker
 {
+  static constexpr vtkIdType ChunkSize = 8192;
+
   std::vector<unsigned int>* indexArray;
   std::vector<unsigned char>* edgeArray;
   unsigned char* edgeFlags;
   vtkCellArray* cells;
   vtkIdType vOffset;
 
+  // Concatenate the per-chunk buffers in cell order.
+  void MergeChunks(const std::vector<std::vector<unsigned int>>& chunkIndices,
+    const std::vector<std::vector<unsigned char>>& chunkEdges)
+  {
+    size_t total = 0;
+    for (const auto& chunk : chunkIndices)
+    {
+      total += chunk.size();
+    }
+    indexArray->reserve(indexArray->size() + total);
+    for (const auto& chunk : chunkIndices)
+    {
+      indexArray->insert(indexArray->end(), chunk.begin(), chunk.end());
+    }
+    if (edgeArray)
+    {
+      edgeArray->reserve(edgeArray->size() + total / 3);
+      for (const auto& chunk : chunkEdges)
+      {
+        edgeArray->insert(edgeArray->end(), chunk.begin(), chunk.end());
+      }
+    }
+  }
+
   // AoS fast path
   template <typename ValueType>
   void operator()(vtkAOSDataArrayTemplate<ValueType>* src)
   {
     ValueType* points = src->Begin();
 
-    auto cellIter = vtk::TakeSmartPointer(cells->NewIterator());
+    const vtkIdType numCells = this->cells->GetNumberOfCells();
+    const vtkIdType numChunks = (numCells + ChunkSize - 1) / ChunkSize;
+    std::vector<std::vector<unsigned int>> chunkIndices(numChunks);
+    std::vector<std::vector<unsigned char>> chunkEdges(this->edgeArray ? numChunks : 0);
 
-    for (cellIter->GoToFirstCell(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell())
-    {
-      vtkIdType cellSize;
-      const vtkIdType* cell;
-      cellIter->GetCurrentCell(cellSize, cell);
-
-      if (cellSize >= 3)
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType chunk, vtkIdType endChunk) {
+      auto cellIter = vtk::TakeSmartPointer(this->cells->NewIterator());
+      for (; chunk < endChunk; ++chunk)
       {
-        vtkIdType id1 = cell[0];
-        ValueType* p1 = points + id1 * 3;
-        for (int i = 1; i < cellSize - 1; i++)
+        std::vector<unsigned int>& localIndices = chunkIndices[chunk];
+        std::vector<unsigned char>* localEdges = this->edgeArray ? &chunkEdges[chunk] : nullptr;
+        const vtkIdType endCellId =
+          (chunk + 1) * ChunkSize < numCells ? (chunk + 1) * ChunkSize : numCells;
+        for (vtkIdType cellId = chunk * ChunkSize; cellId < endCellId; ++cellId)
         {
-          vtkIdType id2 = cell[i];
-          vtkIdType id3 = cell[i + 1];
-          ValueType* p2 = points + id2 * 3;
-          ValueType* p3 = points + id3 * 3;
-          if ((p1[0] != p2[0] || p1[1] != p2[1] || p1[2] != p2[2]) &&
-            (p3[0] != p2[0] || p3[1] != p2[1] || p3[2] != p2[2]) &&
-            (p3[0] != p1[0] || p3[1] != p1[1] || p3[2] != p1[2]))
+          vtkIdType cellSize;
+          const vtkIdType* cell;
+          cellIter->GetCellAtId(cellId, cellSize, cell);
+
+          if (cellSize >= 3)
           {
-            indexArray->push_back(static_cast<unsigned int>(id1 + vOffset));
-            indexArray->push_back(static_cast<unsigned int>(id2 + vOffset));
-            indexArray->push_back(static_cast<unsigned int>(id3 + vOffset));
-            if (edgeArray)
+            vtkIdType id1 = cell[0];
+            ValueType* p1 = points + id1 * 3;
+            for (int i = 1; i < cellSize - 1; i++)
             {
-              int val = cellSize == 3 ? 7 : i == 1 ? 3 : i == cellSize - 2 ? 6 : 2;
-              if (edgeFlags)
+              vtkIdType id2 = cell[i];
+              vtkIdType id3 = cell[i + 1];
+              ValueType* p2 = points + id2 * 3;
+              ValueType* p3 = points + id3 * 3;
+              if ((p1[0] != p2[0] || p1[1] != p2[1] || p1[2] != p2[2]) &&
+                (p3[0] != p2[0] || p3[1] != p2[1] || p3[2] != p2[2]) &&
+                (p3[0] != p1[0] || p3[1] != p1[1] || p3[2] != p1[2]))
               {
-                int mask = 0;
-                mask = edgeFlags[id1] + edgeFlags[id2] * 2 + edgeFlags[id3] * 4;
-                edgeArray->push_back(val & mask);
-              }
-              else
-              {
-                edgeArray->push_back(val);
+                localIndices.push_back(static_cast<unsigned int>(id1 + this->vOffset));
+                localIndices.push_back(static_cast<unsigned int>(id2 + this->vOffset));
+                localIndices.push_back(static_cast<unsigned int>(id3 + this->vOffset));
+                if (localEdges)
+                {
+                  int val = cellSize == 3 ? 7 : i == 1 ? 3 : i == cellSize - 2 ? 6 : 2;
+                  if (this->edgeFlags)
+                  {
+                    int mask = 0;
+                    mask = this->edgeFlags[id1] + this->edgeFlags[id2] * 2 + this->edgeFlags[id3] * 4;
+                    localEdges->push_back(val & mask);
+                  }
+                  else
+                  {
+                    localEdges->push_back(val);
+                  }
+                }
               }
             }
           }
         }
       }
-    }
+    });
+
+    this->MergeChunks(chunkIndices, chunkEdges);
   }
 
   // Generic API, on VS13 Rel this is about 80% slower than
@@ -98,35 +142,48 @@ struct AppendTrianglesWorker
   {
     const auto points = vtk::DataArrayTupleRange<3>(pointArray);
 
-    auto cellIter = vtk::TakeSmartPointer(cells->NewIterator());
+    const vtkIdType numCells = this->cells->GetNumberOfCells();
+    const vtkIdType numChunks = (numCells + ChunkSize - 1) / ChunkSize;
+    std::vector<std::vector<unsigned int>> chunkIndices(numChunks);
 
-    for (cellIter->GoToFirstCell(); !cellIter->IsDoneWithTraversal(); cellIter->GoToNextCell())
-    {
-      vtkIdType cellSize;
-      const vtkIdType* cell;
-      cellIter->GetCurrentCell(cellSize, cell);
-
-      if (cellSize >= 3)
+    vtkSMPTools::For(0, numChunks, [&](vtkIdType chunk, vtkIdType endChunk) {
+      auto cellIter = vtk::TakeSmartPointer(this->cells->NewIterator());
+      for (; chunk < endChunk; ++chunk)
       {
-        const vtkIdType id1 = cell[0];
-        for (int i = 1; i < cellSize - 1; i++)
+        std::vector<unsigned int>& localIndices = chunkIndices[chunk];
+        const vtkIdType endCellId =
+          (chunk + 1) * ChunkSize < numCells ? (chunk + 1) * ChunkSize : numCells;
+        for (vtkIdType cellId = chunk * ChunkSize; cellId < endCellId; ++cellId)
         {
-          const vtkIdType id2 = cell[i];
-          const vtkIdType id3 = cell[i + 1];
+          vtkIdType cellSize;
+          const vtkIdType* cell;
+          cellIter->GetCellAtId(cellId, cellSize, cell);
 
-          const auto pt1 = points[id1];
-          const auto pt2 = points[id2];
-          const auto pt3 = points[id3];
-
-          if (pt1 != pt2 && pt1 != pt3 && pt2 != pt3)
+          if (cellSize >= 3)
           {
-            indexArray->push_back(static_cast<unsigned int>(id1 + vOffset));
-            indexArray->push_back(static_cast<unsigned int>(id2 + vOffset));
-            indexArray->push_back(static_cast<unsigned int>(id3 + vOffset));
+            const vtkIdType id1 = cell[0];
+            for (int i = 1; i < cellSize - 1; i++)
+            {
+              const vtkIdType id2 = cell[i];
+              const vtkIdType id3 = cell[i + 1];
+
+              const auto pt1 = points[id1];
+              const auto pt2 = points[id2];
+              const auto pt3 = points[id3];
+
+              if (pt1 != pt2 && pt1 != pt3 && pt2 != pt3)
+              {
+                localIndices.push_back(static_cast<unsigned int>(id1 + this->vOffset));
+                localIndices.push_back(static_cast<unsigned int>(id2 + this->vOffset));
+                localIndices.push_back(static_cast<unsigned int>(id3 + this->vOffset));
+              }
+            }
           }
         }
       }
-    }
+    });
+
+    this->MergeChunks(chunkIndices, {});
   }
 };
 
@@ -551,6 +551,14 @@ void vtkOpenGLRenderWindow::ReleaseGraphicsResources(vtkWindow* renWin)
   this->ResolveFramebuffer->ReleaseGraphicsResources(renWin);
   this->DepthFramebuffer->ReleaseGraphicsResources(renWin);
 
+  this->DiscardPendingPixelReadbacks();
+  if (!this->FreePixelReadbackBuffers.empty())
+  {
+    glDeleteBuffers(static_cast<GLsizei>(this->FreePixelReadbackBuffers.size()),
+      this->FreePixelReadbackBuffers.data());
+    this->FreePixelReadbackBuffers.clear();
+  }
+
   // release the registered resources
   if (this->NoiseTextureObject)
   {
@@ -1049,41 +1057,204 @@ int vtkOpenGLRenderWindow::GetPixelData(
 }
 
 //------------------------------------------------------------------------------
-// does the current read buffer require resolving for reading pixels
-bool vtkOpenGLRenderWindow::GetBufferNeedsResolving()
+int vtkOpenGLRenderWindow::SubmitPixelDataReadback(
+  int x1, int y1, int x2, int y2, int front, int right)
 {
-  if (this->RenderFramebuffer->GetMultiSamples())
+  int y_low = y1 < y2 ? y1 : y2;
+  int y_hi = y1 < y2 ? y2 : y1;
+  int x_low = x1 < x2 ? x1 : x2;
+  int x_hi = x1 < x2 ? x2 : x1;
+
+  int width = (x_hi - x_low) + 1;
+  int height = (y_hi - y_low) + 1;
+  if (width <= 0 || height <= 0)
   {
-    return true;
+    return VTK_ERROR;
   }
-  return false;
+  vtkRecti rect(x_low, y_low, width, height);
+
+  this->MakeCurrent();
+
+  // Must clear previous errors first.
+#ifdef VTK_REPORT_OPENGL_ERRORS
+  while (glGetError() != GL_NO_ERROR)
+  {
+  }
+#endif
+
+  // Triple buffering: render N, readback N-1, consumer N-2. Anything deeper
+  // only adds latency, so drop the oldest readback when the ring is full.
+  while (this->PendingPixelReadbacks.size() >= 3)
+  {
+    PendingPixelReadback& stale = this->PendingPixelReadbacks.front();
+    glDeleteSync(static_cast<GLsync>(stale.Fence));
+    this->FreePixelReadbackBuffers.push_back(stale.Buffer);
+    this->PendingPixelReadbacks.pop_front();
+  }
+
+  PendingPixelReadback entry;
+  entry.Rect = rect;
+  entry.Front = front;
+  entry.Right = right;
+#ifdef GL_ES_VERSION_3_0
+  // GL ES only guarantees GL_RGBA/GL_UNSIGNED_BYTE readback; the alpha
+  // channel is stripped when the pixels are retrieved.
+  entry.Components = 4;
+#else
+  entry.Components = 3;
+#endif
+
+  if (this->FreePixelReadbackBuffers.empty())
+  {
+    glGenBuffers(1, &entry.Buffer);
+  }
+  else
+  {
+    entry.Buffer = this->FreePixelReadbackBuffers.back();
+    this->FreePixelReadbackBuffers.pop_back();
+  }
+
+  this->GetState()->vtkglDisable(GL_SCISSOR_TEST);
+  this->GetState()->vtkglPixelStorei(GL_PACK_ALIGNMENT, 1);
+  this->BindReadFramebufferForPixels(rect, front, right);
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, entry.Buffer);
+  glBufferData(GL_PIXEL_PACK_BUFFER,
+    static_cast<GLsizeiptr>(width) * height * entry.Components, nullptr, GL_STREAM_READ);
+  glReadPixels(rect.GetLeft(), rect.GetBottom(), rect.GetWidth(), rect.GetHeight(),
+    entry.Components == 4 ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+  this->GetState()->PopReadFramebufferBinding();
+
+  entry.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  // Make sure the readback starts now instead of at the next implicit flush.
+  glFlush();
+
+  if (glGetError() != GL_NO_ERROR || !entry.Fence)
+  {
+    if (entry.Fence)
+    {
+      glDeleteSync(static_cast<GLsync>(entry.Fence));
+    }
+    this->FreePixelReadbackBuffers.push_back(entry.Buffer);
+    return VTK_ERROR;
+  }
+
+  this->PendingPixelReadbacks.push_back(entry);
+  return VTK_OK;
 }
 
 //------------------------------------------------------------------------------
-int vtkOpenGLRenderWindow::ReadPixels(
-  const vtkRecti& rect, int front, int glformat, int gltype, void* data, int right)
+int vtkOpenGLRenderWindow::RetrievePixelDataReadback(
+  int x1, int y1, int x2, int y2, int front, vtkUnsignedCharArray* data, int right)
 {
-  // set the current window
+  int y_low = y1 < y2 ? y1 : y2;
+  int y_hi = y1 < y2 ? y2 : y1;
+  int x_low = x1 < x2 ? x1 : x2;
+  int x_hi = x1 < x2 ? x2 : x1;
+
+  int width = (x_hi - x_low) + 1;
+  int height = (y_hi - y_low) + 1;
+  vtkRecti rect(x_low, y_low, width, height);
+
   this->MakeCurrent();
 
-  if (rect.GetWidth() < 0 || rect.GetHeight() < 0)
+  // Discard queued readbacks that do not match the requested capture; they
+  // were submitted for a different rectangle or buffer and would otherwise
+  // pin their pack buffers forever.
+  while (!this->PendingPixelReadbacks.empty())
   {
-    // invalid box
-    return VTK_ERROR;
+    PendingPixelReadback& oldest = this->PendingPixelReadbacks.front();
+    if (oldest.Rect.GetLeft() == rect.GetLeft() && oldest.Rect.GetBottom() == rect.GetBottom() &&
+      oldest.Rect.GetWidth() == rect.GetWidth() && oldest.Rect.GetHeight() == rect.GetHeight() &&
+      oldest.Front == front && oldest.Right == right)
+    {
+      break;
+    }
+    glDeleteSync(static_cast<GLsync>(oldest.Fence));
+    this->FreePixelReadbackBuffers.push_back(oldest.Buffer);
+    this->PendingPixelReadbacks.pop_front();
   }
 
-  // Must clear previous errors first.
-#ifdef VTK_REPORT_OPENGL_ERRORS
-  while (glGetError() != GL_NO_ERROR)
+  if (this->PendingPixelReadbacks.empty())
   {
+    // Nothing in flight: fall back to a plain synchronous read.
+    return this->GetPixelData(x1, y1, x2, y2, front, data, right);
   }
-#endif
 
-  this->GetState()->vtkglDisable(GL_SCISSOR_TEST);
+  PendingPixelReadback entry = this->PendingPixelReadbacks.front();
+  this->PendingPixelReadbacks.pop_front();
 
-  // Calling pack alignment ensures that we can grab the any size window
-  this->GetState()->vtkglPixelStorei(GL_PACK_ALIGNMENT, 1);
+  // One second is far beyond any sane readback; treat longer as an error.
+  glClientWaitSync(
+    static_cast<GLsync>(entry.Fence), GL_SYNC_FLUSH_COMMANDS_BIT, 1000ull * 1000ull * 1000ull);
+  glDeleteSync(static_cast<GLsync>(entry.Fence));
+
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, entry.Buffer);
+  const unsigned char* mapped = static_cast<const unsigned char*>(glMapBufferRange(
+    GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(width) * height * entry.Components,
+    GL_MAP_READ_BIT));
+  if (!mapped)
+  {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    this->FreePixelReadbackBuffers.push_back(entry.Buffer);
+    return this->GetPixelData(x1, y1, x2, y2, front, data, right);
+  }
 
+  int size = 3 * width * height;
+  if (data->GetMaxId() + 1 != size)
+  {
+    vtkDebugMacro("Resizing array.");
+    data->SetNumberOfComponents(3);
+    data->SetNumberOfValues(size);
+  }
+  unsigned char* dest = data->GetPointer(0);
+  if (entry.Components == 3)
+  {
+    memcpy(dest, mapped, size);
+  }
+  else
+  {
+    for (vtkIdType i = 0; i < static_cast<vtkIdType>(width) * height; ++i)
+    {
+      dest[3 * i] = mapped[4 * i];
+      dest[3 * i + 1] = mapped[4 * i + 1];
+      dest[3 * i + 2] = mapped[4 * i + 2];
+    }
+  }
+
+  glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  this->FreePixelReadbackBuffers.push_back(entry.Buffer);
+  return VTK_OK;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLRenderWindow::DiscardPendingPixelReadbacks()
+{
+  for (PendingPixelReadback& entry : this->PendingPixelReadbacks)
+  {
+    glDeleteSync(static_cast<GLsync>(entry.Fence));
+    this->FreePixelReadbackBuffers.push_back(entry.Buffer);
+  }
+  this->PendingPixelReadbacks.clear();
+}
+
+//------------------------------------------------------------------------------
+// does the current read buffer require resolving for reading pixels
+bool vtkOpenGLRenderWindow::GetBufferNeedsResolving()
+{
+  if (this->RenderFramebuffer->GetMultiSamples())
+  {
+    return true;
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLRenderWindow::BindReadFramebufferForPixels(const vtkRecti& rect, int front, int right)
+{
   this->GetState()->PushReadFramebufferBinding();
 
   if (front)
@@ -1118,6 +1289,34 @@ int vtkOpenGLRenderWindow::ReadPixels(
       this->ResolveFramebuffer->ActivateReadBuffer(0);
     }
   }
+}
+
+//------------------------------------------------------------------------------
+int vtkOpenGLRenderWindow::ReadPixels(
+  const vtkRecti& rect, int front, int glformat, int gltype, void* data, int right)
+{
+  // set the current window
+  this->MakeCurrent();
+
+  if (rect.GetWidth() < 0 || rect.GetHeight() < 0)
+  {
+    // invalid box
+    return VTK_ERROR;
+  }
+
+  // Must clear previous errors first.
+#ifdef VTK_REPORT_OPENGL_ERRORS
+  while (glGetError() != GL_NO_ERROR)
+  {
+  }
+#endif
+
+  this->GetState()->vtkglDisable(GL_SCISSOR_TEST);
+
+  // Calling pack alignment ensures that we can grab the any size window
+  this->GetState()->vtkglPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+  this->BindReadFramebufferForPixels(rect, front, right);
 #ifdef GL_ES_VERSION_3_0
   // Open GL ES is very strict about the internal formats and data types that can be
   // used in `glReadPixels`. Even the slightest mistake will result in GL_INVALID_OPERATION
@@ -18,9 +18,11 @@
 #include "vtkRenderingOpenGL2Module.h" // For export macro
 #include "vtkType.h"                   // for ivar
 #include "vtkWrappingHints.h"          // For VTK_MARSHALAUTO
+#include <deque>                       // for ivar
 #include <map>                         // for ivar
 #include <set>                         // for ivar
 #include <string>                      // for ivar
+#include <vector>                      // for ivar
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkIdList;
@@ -83,6 +85,21 @@ public:
     int x, int y, int x2, int y2, vtkUnsignedCharArray* data, int front, int right) override;
   ///@}
 
+  ///@{
+  /**
+   * Pipelined readback of RGB pixel data through a small ring of pixel
+   * pack buffers. Submit issues the read into a buffer object and places
+   * a fence so the transfer overlaps subsequent rendering; Retrieve maps
+   * the oldest queued buffer, waiting on its fence only when the
+   * transfer has not finished. Readbacks queued for a different
+   * rectangle than the one retrieved, for example after a window resize,
+   * are discarded and replaced by a synchronous read.
+   */
+  int SubmitPixelDataReadback(int x, int y, int x2, int y2, int front, int right = 0) override;
+  int RetrievePixelDataReadback(
+    int x, int y, int x2, int y2, int front, vtkUnsignedCharArray* data, int right = 0) override;
+  ///@}
+
   ///@{
   /**
    * Set/Get the pixel data of an image, transmitted as RGBARGBA...
@@ -526,6 +543,31 @@ protected:
   virtual int ReadPixels(
     const vtkRecti& rect, int front, int glFormat, int glType, void* data, int right = 0);
 
+  /**
+   * Bind (and resolve, for multisampled buffers) the framebuffer that
+   * pixel reads of the given rectangle should come from. Pushes the read
+   * framebuffer binding; the caller pops it when done reading.
+   */
+  void BindReadFramebufferForPixels(const vtkRecti& rect, int front, int right);
+
+  // readbacks in flight for SubmitPixelDataReadback, oldest first
+  struct PendingPixelReadback
+  {
+    unsigned int Buffer = 0;
+    void* Fence = nullptr;
+    vtkRecti Rect = vtkRecti(0, 0, 0, 0);
+    int Front = 0;
+    int Right = 0;
+    int Components = 3;
+  };
+  std::deque<PendingPixelReadback> PendingPixelReadbacks;
+  std::vector<unsigned int> FreePixelReadbackBuffers;
+
+  /**
+   * Drop every queued readback, recycling their buffer objects.
+   */
+  void DiscardPendingPixelReadbacks();
+
   /**
    * Create the offScreen framebuffers or resize them if they are already created.
    * Return if the creation was successful or not.
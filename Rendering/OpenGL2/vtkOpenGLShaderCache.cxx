@@ -9,9 +9,15 @@
 #include "vtkShader.h"
 #include "vtkShaderProgram.h"
 
+#include <cstdint> // for uintptr_t
+#include <cstdio>  // for std::rename
+#include <iterator>
 #include <sstream>
+#include <vector>
 
+#include "vtksys/FStream.hxx"
 #include "vtksys/MD5.h"
+#include "vtksys/SystemTools.hxx"
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkOpenGLShaderCache::Private
@@ -22,6 +28,10 @@ public:
   // map of hash to shader program structs
   std::map<std::string, vtkShaderProgram*> ShaderPrograms;
 
+  // hash of the driver strings, program binaries are only valid for the
+  // driver that produced them
+  std::string ContextHash;
+
   Private() { md5 = vtksysMD5_New(); }
 
   ~Private() { vtksysMD5_Delete(this->md5); }
@@ -60,6 +70,13 @@ vtkOpenGLShaderCache::vtkOpenGLShaderCache()
   this->OpenGLMajorVersion = 0;
   this->OpenGLMinorVersion = 0;
   this->SyncGLSLShaderVersion = false;
+  this->ProgramBinaryDirectory = nullptr;
+  std::string binaryDirectory;
+  if (vtksys::SystemTools::GetEnv("VTK_SHADER_BINARY_CACHE", binaryDirectory) &&
+    !binaryDirectory.empty())
+  {
+    this->SetProgramBinaryDirectory(binaryDirectory.c_str());
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -73,6 +90,7 @@ vtkOpenGLShaderCache::~vtkOpenGLShaderCache()
   }
 
   delete this->Internal;
+  this->SetProgramBinaryDirectory(nullptr);
 }
 
 // perform System and Output replacements
@@ -379,10 +397,14 @@ vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgram(
     shader->SetTransformFeedback(cap);
   }
 
-  // compile if needed
-  if (!shader->GetCompiled() && !shader->CompileShader())
+  // compile if needed, trying the on disk program binary cache first
+  if (!shader->GetCompiled() && !this->LoadShaderProgramBinary(shader))
   {
-    return nullptr;
+    if (!shader->CompileShader())
+    {
+      return nullptr;
+    }
+    this->SaveShaderProgramBinary(shader);
   }
 
   // bind if needed
@@ -499,6 +521,131 @@ void vtkOpenGLShaderCache::ReleaseCurrentShader()
   }
 }
 
+std::string vtkOpenGLShaderCache::GetProgramBinaryFileName(vtkShaderProgram* shader)
+{
+  if (!this->ProgramBinaryDirectory || shader->GetMD5Hash().empty())
+  {
+    return std::string();
+  }
+  if (shader->GetTransformFeedback())
+  {
+    // the captured varyings are bound outside of the hashed sources
+    return std::string();
+  }
+#ifndef GL_ES_VERSION_3_0
+  if (!glGetProgramBinary || !glProgramBinary)
+  {
+    return std::string();
+  }
+#endif
+  GLint numFormats = 0;
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+  if (numFormats <= 0)
+  {
+    return std::string();
+  }
+  if (this->Internal->ContextHash.empty())
+  {
+    const char* vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
+    const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    this->Internal->ComputeMD5({ vendor, renderer, version }, this->Internal->ContextHash);
+  }
+  std::string result = this->ProgramBinaryDirectory;
+  result += "/" + shader->GetMD5Hash() + "-" + this->Internal->ContextHash + ".bin";
+  return result;
+}
+
+bool vtkOpenGLShaderCache::LoadShaderProgramBinary(vtkShaderProgram* shader)
+{
+  std::string fileName = this->GetProgramBinaryFileName(shader);
+  if (fileName.empty() || !vtksys::SystemTools::FileExists(fileName))
+  {
+    return false;
+  }
+
+  vtksys::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+  unsigned int format = 0;
+  file.read(reinterpret_cast<char*>(&format), sizeof(format));
+  std::vector<char> binary(
+    (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (!file || binary.empty())
+  {
+    return false;
+  }
+
+  GLuint handle = glCreateProgram();
+  glProgramBinary(
+    handle, static_cast<GLenum>(format), binary.data(), static_cast<GLsizei>(binary.size()));
+  GLint status = 0;
+  glGetProgramiv(handle, GL_LINK_STATUS, &status);
+  if (status == 0)
+  {
+    // a stale binary from before a driver update, or a corrupt file;
+    // fall back to compilation, which overwrites it
+    glDeleteProgram(handle);
+    return false;
+  }
+
+  shader->Handle = static_cast<int>(handle);
+  shader->Linked = true;
+  shader->SetCompiled(true);
+  return true;
+}
+
+void vtkOpenGLShaderCache::SaveShaderProgramBinary(vtkShaderProgram* shader)
+{
+  std::string fileName = this->GetProgramBinaryFileName(shader);
+  if (fileName.empty())
+  {
+    return;
+  }
+
+  GLuint handle = static_cast<GLuint>(shader->GetHandle());
+  GLint length = 0;
+  glGetProgramiv(handle, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+  {
+    // some drivers only retain a binary when asked for one ahead of the
+    // link, nothing is bound to the fresh program yet so relink
+    glProgramParameteri(handle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(handle);
+    glGetProgramiv(handle, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+      return;
+    }
+  }
+
+  std::vector<char> binary(length);
+  GLsizei retrieved = 0;
+  GLenum format = 0;
+  glGetProgramBinary(handle, length, &retrieved, &format, binary.data());
+  if (retrieved <= 0)
+  {
+    return;
+  }
+
+  vtksys::SystemTools::MakeDirectory(this->ProgramBinaryDirectory);
+  // write through a private temporary so that concurrent processes
+  // warming the same cache never observe a partial binary
+  std::ostringstream tmpName;
+  tmpName << fileName << "." << reinterpret_cast<uintptr_t>(this) << ".tmp";
+  {
+    vtksys::ofstream file(tmpName.str().c_str(), std::ios::out | std::ios::binary);
+    unsigned int fmt = static_cast<unsigned int>(format);
+    file.write(reinterpret_cast<const char*>(&fmt), sizeof(fmt));
+    file.write(binary.data(), retrieved);
+    if (!file)
+    {
+      file.close();
+      vtksys::SystemTools::RemoveFile(tmpName.str());
+      return;
+    }
+  }
+  std::rename(tmpName.str().c_str(), fileName.c_str());
+}
+
 int vtkOpenGLShaderCache::BindShader(vtkShaderProgram* shader)
 {
   if (this->LastShaderBound != shader)
@@ -524,5 +671,7 @@ int vtkOpenGLShaderCache::BindShader(vtkShaderProgram* shader)
 void vtkOpenGLShaderCache::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ProgramBinaryDirectory: "
+     << (this->ProgramBinaryDirectory ? this->ProgramBinaryDirectory : "(none)") << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -14,6 +14,7 @@
 #include "vtkRenderingOpenGL2Module.h" // For export macro
 #include "vtkShader.h"                 // for vtkShader::Type
 #include <map>                         // for methods
+#include <string>                      // for GetProgramBinaryFileName
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkTransformFeedback;
@@ -80,6 +81,24 @@ public:
   // Set the time in seconds elapsed since the first render
   void SetElapsedTime(float val) { this->ElapsedTime = val; }
 
+  ///@{
+  /**
+   * Set/Get the directory of an on disk cache of linked program binaries
+   * that is shared between processes. When set, newly linked programs are
+   * stored there with glGetProgramBinary, keyed on the hash of their
+   * shader sources and on the OpenGL vendor, renderer and version
+   * strings, and later processes restore them with glProgramBinary
+   * instead of compiling, which makes startup of many short lived
+   * rendering processes far cheaper on warmed nodes. The environment
+   * variable VTK_SHADER_BINARY_CACHE provides the initial value. Stale or
+   * foreign binaries are rejected by the driver and silently recompiled.
+   * Drivers without program binary support fall back to compilation. The
+   * default is unset, no on disk cache.
+   */
+  vtkSetFilePathMacro(ProgramBinaryDirectory);
+  vtkGetFilePathMacro(ProgramBinaryDirectory);
+  ///@}
+
 protected:
   vtkOpenGLShaderCache();
   ~vtkOpenGLShaderCache() override;
@@ -94,6 +113,22 @@ protected:
   virtual vtkShaderProgram* GetShaderProgram(std::map<vtkShader::Type, vtkShader*> shaders);
   virtual int BindShader(vtkShaderProgram* shader);
 
+  ///@{
+  /**
+   * Restore/store a linked program from/to ProgramBinaryDirectory.
+   * Loading returns false when no usable binary is on disk and the
+   * program must be compiled instead.
+   */
+  virtual bool LoadShaderProgramBinary(vtkShaderProgram* shader);
+  virtual void SaveShaderProgramBinary(vtkShaderProgram* shader);
+  ///@}
+
+  /**
+   * The on disk location of a program's binary. Empty when the cache is
+   * disabled or the context cannot provide binaries for this program.
+   */
+  std::string GetProgramBinaryFileName(vtkShaderProgram* shader);
+
   class Private;
   Private* Internal;
   vtkShaderProgram* LastShaderBound;
@@ -102,6 +137,8 @@ protected:
   int OpenGLMinorVersion;
   bool SyncGLSLShaderVersion;
 
+  char* ProgramBinaryDirectory;
+
   float ElapsedTime;
 
 private:
@@ -10,6 +10,7 @@
 #include "vtkOpenGLVertexBufferObjectCache.h"
 #include "vtkPoints.h"
 #include "vtkProp3D.h"
+#include "vtkSMPTools.h"
 
 #include "vtk_glew.h"
 
@@ -288,7 +289,7 @@ void vtkAppendVBOWorker<destType>::operator()(vtkAOSDataArrayTemplate<ValueType>
 
   ValueType* input = src->Begin();
   unsigned int numComps = this->VBO->GetNumberOfComponents();
-  unsigned int numTuples = src->GetNumberOfTuples();
+  vtkIdType numTuples = src->GetNumberOfTuples();
 
   // compute extra padding required
   int bytesNeeded = this->VBO->GetDataTypeSize() * this->VBO->GetNumberOfComponents();
@@ -304,26 +305,35 @@ void vtkAppendVBOWorker<destType>::operator()(vtkAOSDataArrayTemplate<ValueType>
     }
     else
     {
-      for (unsigned int i = 0; i < numTuples; ++i)
-      {
-        for (unsigned int j = 0; j < numComps; j++)
+      // tuples are independent, so convert and pad them in parallel
+      vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+        ValueType* in = input + begin * numComps;
+        destType* out = VBOit + begin * (numComps + extraComponents);
+        for (vtkIdType i = begin; i < end; ++i)
         {
-          *(VBOit++) = *(input++);
+          for (unsigned int j = 0; j < numComps; j++)
+          {
+            *(out++) = *(in++);
+          }
+          out += extraComponents;
         }
-        VBOit += extraComponents;
-      }
+      });
     }
   }
   else
   {
-    for (unsigned int i = 0; i < numTuples; ++i)
-    {
-      for (unsigned int j = 0; j < numComps; j++)
+    vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+      ValueType* in = input + begin * numComps;
+      destType* out = VBOit + begin * (numComps + extraComponents);
+      for (vtkIdType i = begin; i < end; ++i)
       {
-        *(VBOit++) = (*(input++) - this->Shift.at(j)) * this->Scale.at(j);
+        for (unsigned int j = 0; j < numComps; j++)
+        {
+          *(out++) = (*(in++) - this->Shift[j]) * this->Scale[j];
+        }
+        out += extraComponents;
       }
-      VBOit += extraComponents;
-    }
+    });
   } // end if shift*scale
 }
 
@@ -341,6 +351,7 @@ void vtkAppendVBOWorker<destType>::operator()(DataArray* array)
   destType* VBOit = reinterpret_cast<destType*>(&this->VBO->GetPackedVBO()[this->Offset]);
 
   const auto dataRange = vtk::DataArrayTupleRange(array);
+  const unsigned int numComps = this->VBO->GetNumberOfComponents();
 
   // compute extra padding required
   int bytesNeeded = this->VBO->GetDataTypeSize() * this->VBO->GetNumberOfComponents();
@@ -349,22 +360,30 @@ void vtkAppendVBOWorker<destType>::operator()(DataArray* array)
   // If not shift & scale
   if (!this->VBO->GetCoordShiftAndScaleEnabled())
   {
-    for (const auto tuple : dataRange)
-    {
-      VBOit = std::copy(tuple.cbegin(), tuple.cend(), VBOit);
-      VBOit += extraComponents;
-    }
+    vtkSMPTools::For(0, dataRange.size(), [&](vtkIdType begin, vtkIdType end) {
+      destType* out = VBOit + begin * (numComps + extraComponents);
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const auto tuple = dataRange[i];
+        out = std::copy(tuple.cbegin(), tuple.cend(), out);
+        out += extraComponents;
+      }
+    });
   }
   else
   {
-    for (const auto tuple : dataRange)
-    {
-      for (int j = 0; j < tuple.size(); ++j)
+    vtkSMPTools::For(0, dataRange.size(), [&](vtkIdType begin, vtkIdType end) {
+      destType* out = VBOit + begin * (numComps + extraComponents);
+      for (vtkIdType i = begin; i < end; ++i)
       {
-        *(VBOit++) = (tuple[j] - this->Shift[j]) * this->Scale[j];
+        const auto tuple = dataRange[i];
+        for (int j = 0; j < tuple.size(); ++j)
+        {
+          *(out++) = (tuple[j] - this->Shift[j]) * this->Scale[j];
+        }
+        out += extraComponents;
       }
-      VBOit += extraComponents;
-    }
+    });
   } // end if shift*scale
 }
 
@@ -445,17 +464,31 @@ void vtkOpenGLVertexBufferObject::UpdateShiftScale(vtkDataArray* array)
 
   if (useSS || this->GetCoordShiftAndScaleMethod() == ShiftScaleMethod::ALWAYS_AUTO_SHIFT_SCALE)
   {
+    // for 16-bit quantized storage, widen the unit-sized auto range so each
+    // coordinate spans the full integer range; the shift/scale reported to
+    // the mapper then also encodes the dequantization transform
+    double quantRange = 1.0;
+    double quantShift = 0.0; // fraction of delta added to the midpoint shift
+    if (this->DataType == VTK_SHORT)
+    {
+      quantRange = 2.0 * VTK_SHORT_MAX;
+    }
+    else if (this->DataType == VTK_UNSIGNED_SHORT)
+    {
+      quantRange = VTK_UNSIGNED_SHORT_MAX;
+      quantShift = -0.5; // shift to range minimum, the type has no sign
+    }
     std::vector<double> shift;
     std::vector<double> scale;
     for (int i = 0; i < array->GetNumberOfComponents(); ++i)
     {
       double range[2];
       array->GetRange(range, i);
-      shift.push_back(0.5 * (range[1] + range[0]));
       double delta = range[1] - range[0];
+      shift.push_back(0.5 * (range[1] + range[0]) + quantShift * delta);
       if (delta > 0)
       {
-        scale.push_back(1.0 / delta);
+        scale.push_back(quantRange / delta);
       }
       else
       {
@@ -538,9 +571,15 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
   // handle any shift scale calcs required before upload
   this->UpdateShiftScale(array);
 
-  // can we use the fast path and just upload the raw array?
+  // can we use the fast path and just upload the raw array? Arrays without
+  // a contiguous AOS layout (e.g. vtkSOADataArrayTemplate) only take it
+  // when no packing worker exists for the VBO data type: GetVoidPointer
+  // would silently materialize a full interleaved copy, while the workers
+  // below pack straight from the component buffers.
+  bool hasPackingWorker = this->DataType == VTK_FLOAT || this->DataType == VTK_UNSIGNED_CHAR ||
+    this->DataType == VTK_SHORT || this->DataType == VTK_UNSIGNED_SHORT;
   if (!this->GetCoordShiftAndScaleEnabled() && this->DataType == array->GetDataType() &&
-    extraComponents == 0)
+    extraComponents == 0 && (array->HasStandardMemoryLayout() || !hasPackingWorker))
   {
     this->NumberOfTuples = array->GetNumberOfTuples();
     this->PackedVBO.resize(0);
@@ -581,6 +620,24 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
         }
         break;
       }
+      case VTK_SHORT:
+      {
+        vtkAppendVBOWorker<short> worker(this, 0, this->GetShift(), this->GetScale());
+        if (!Dispatcher::Execute(array, worker))
+        {
+          worker(array);
+        }
+        break;
+      }
+      case VTK_UNSIGNED_SHORT:
+      {
+        vtkAppendVBOWorker<unsigned short> worker(this, 0, this->GetShift(), this->GetScale());
+        if (!Dispatcher::Execute(array, worker))
+        {
+          worker(array);
+        }
+        break;
+      }
     }
 
     if (!result)
@@ -593,6 +650,57 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
   }
 }
 
+bool vtkOpenGLVertexBufferObject::UploadDataArrayRange(
+  vtkDataArray* array, vtkIdType startTuple, vtkIdType numTuples)
+{
+  if (array == nullptr || startTuple < 0 || numTuples <= 0 ||
+    startTuple + numTuples > array->GetNumberOfTuples())
+  {
+    return false;
+  }
+
+  // the patch must leave the rest of the buffer valid, so the array has
+  // to match the layout of the last full upload and take the fast path
+  // where bytes are copied straight from the array into the buffer
+  int ssMethod = this->GetCoordShiftAndScaleMethod();
+  bool dynamicShiftScale =
+    ssMethod == NEAR_PLANE_SHIFT_SCALE || ssMethod == FOCAL_POINT_SHIFT_SCALE;
+  int bytesNeeded = array->GetNumberOfComponents() * this->DataTypeSize;
+  int extraComponents =
+    (this->DataTypeSize > 0) ? ((4 - (bytesNeeded % 4)) % 4) / this->DataTypeSize : 0;
+  if (this->UploadTime.GetMTime() == 0 || !this->IsReady() || dynamicShiftScale ||
+    this->GetCoordShiftAndScaleEnabled() || this->DataType != array->GetDataType() ||
+    extraComponents != 0 || !array->HasStandardMemoryLayout() ||
+    this->NumberOfTuples != static_cast<unsigned int>(array->GetNumberOfTuples()) ||
+    this->NumberOfComponents != static_cast<unsigned int>(array->GetNumberOfComponents()) ||
+    this->GetSize() != static_cast<size_t>(this->NumberOfTuples) * this->Stride)
+  {
+    return false;
+  }
+
+  const unsigned char* data = static_cast<const unsigned char*>(array->GetVoidPointer(0));
+  ptrdiff_t offset = static_cast<ptrdiff_t>(startTuple) * this->Stride;
+  if (!this->UploadRange(data + offset, offset, static_cast<size_t>(numTuples) * this->Stride,
+        vtkOpenGLBufferObject::ArrayBuffer))
+  {
+    return false;
+  }
+  this->UploadTime.Modified();
+  return true;
+}
+
+void vtkOpenGLVertexBufferObject::ReleasePackedVBO()
+{
+  this->PackedVBO.clear();
+  this->PackedVBO.shrink_to_fit();
+}
+
+void vtkOpenGLVertexBufferObject::ResetAppendState()
+{
+  this->NumberOfTuples = 0;
+  this->PackedVBO.resize(0);
+}
+
 void vtkOpenGLVertexBufferObject::AppendDataArray(vtkDataArray* array)
 {
   if (array == nullptr || array->GetNumberOfTuples() == 0)
@@ -650,6 +758,24 @@ void vtkOpenGLVertexBufferObject::AppendDataArray(vtkDataArray* array)
       }
       break;
     }
+    case VTK_SHORT:
+    {
+      vtkAppendVBOWorker<short> worker(this, offset, this->GetShift(), this->GetScale());
+      if (!Dispatcher::Execute(array, worker))
+      {
+        worker(array);
+      }
+      break;
+    }
+    case VTK_UNSIGNED_SHORT:
+    {
+      vtkAppendVBOWorker<unsigned short> worker(this, offset, this->GetShift(), this->GetScale());
+      if (!Dispatcher::Execute(array, worker))
+      {
+        worker(array);
+      }
+      break;
+    }
   }
 
   if (!result)
@@ -40,10 +40,29 @@ public:
   // data array pointer to OpenGL if it is suitable
   void UploadDataArray(vtkDataArray* array);
 
+  // patch a sub-range of tuples of the previously uploaded data array
+  // in place with glBufferSubData. This only works when the array still
+  // matches the layout of the last full upload and qualifies for the
+  // fast upload path (same data type, AOS layout, no tuple padding, no
+  // shift/scale), so the untouched bytes of the buffer stay valid.
+  // Returns false when patching is not possible and the caller must
+  // fall back to UploadDataArray.
+  bool UploadDataArrayRange(vtkDataArray* array, vtkIdType startTuple, vtkIdType numTuples);
+
+  // free the host side staging copy of the VBO data, keeping the
+  // uploaded OpenGL buffer. Safe to call between uploads: every upload
+  // path rebuilds the staging buffer before using it.
+  void ReleasePackedVBO();
+
   // append a data array to this VBO, always
   // copies the data from the data array
   void AppendDataArray(vtkDataArray* array);
 
+  // reset the VBO to an empty state prior to appending a new
+  // sequence of data arrays. The uploaded OpenGL buffer is kept
+  // so that an unchanged sequence can be reused without an upload
+  void ResetAppendState();
+
   // Get the mtime when this VBO was loaded
   vtkGetMacro(UploadTime, vtkTimeStamp);
 
@@ -121,6 +140,15 @@ public:
 
   // Set/Get the DataType to use for the VBO
   // As a side effect sets the DataTypeSize
+  //
+  // Besides VTK_FLOAT and VTK_UNSIGNED_CHAR, the VBO can pack coordinates
+  // as VTK_SHORT or VTK_UNSIGNED_SHORT, halving the GPU and host memory
+  // for the buffer. Pair a 16-bit data type with ALWAYS_AUTO_SHIFT_SCALE:
+  // the shift/scale then quantizes each coordinate over its range into the
+  // 16-bit integer range, and the mapper's inverse shift/scale transform
+  // restores world coordinates during rendering. Best suited to static
+  // geometry, where the quantization error (1/65535 of the bounds) is
+  // below the render-scale precision of float32 anyway.
   void SetDataType(int v);
   vtkGetMacro(DataType, int);
 
@@ -6,6 +6,10 @@
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLVertexBufferObject.h"
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkOpenGLVertexBufferObjectCache);
@@ -23,6 +27,7 @@ void vtkOpenGLVertexBufferObjectCache::RemoveVBO(vtkOpenGLVertexBufferObject* vb
   {
     if (iter->second == vbo)
     {
+      this->LastUse.erase(iter->first);
       iter->first->UnRegister(this);
       this->MappedVBOs.erase(iter++);
     }
@@ -51,6 +56,9 @@ vtkOpenGLVertexBufferObject* vtkOpenGLVertexBufferObjectCache::GetVBO(
     vtkOpenGLVertexBufferObject* vbo = iter->second;
     vbo->SetDataType(destType);
     vbo->Register(this);
+    this->CacheHits++;
+    this->LastUse[array] = ++this->UseClock;
+    this->TrimStagingMemory();
     return vbo;
   }
 
@@ -63,12 +71,70 @@ vtkOpenGLVertexBufferObject* vtkOpenGLVertexBufferObjectCache::GetVBO(
 
   // Add vbo to map
   this->MappedVBOs[array] = vbo;
+  this->CacheMisses++;
+  this->LastUse[array] = ++this->UseClock;
+  this->TrimStagingMemory();
   return vbo;
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkOpenGLVertexBufferObjectCache::GetDeviceMemorySize()
+{
+  vtkIdType total = 0;
+  for (auto& entry : this->MappedVBOs)
+  {
+    total += static_cast<vtkIdType>(entry.second->GetSize());
+  }
+  return total;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLVertexBufferObjectCache::TrimStagingMemory()
+{
+  if (this->MemoryBudget <= 0)
+  {
+    return;
+  }
+
+  // gather the entries that still hold a staging copy, oldest first
+  std::vector<std::tuple<vtkIdType, vtkIdType, vtkOpenGLVertexBufferObject*>> entries;
+  vtkIdType total = 0;
+  for (auto& entry : this->MappedVBOs)
+  {
+    vtkIdType size =
+      static_cast<vtkIdType>(entry.second->GetPackedVBO().capacity() * sizeof(float));
+    if (size > 0)
+    {
+      total += size;
+      entries.emplace_back(this->LastUse[entry.first], size, entry.second);
+    }
+  }
+  if (total <= this->MemoryBudget)
+  {
+    return;
+  }
+
+  std::sort(entries.begin(), entries.end());
+  for (auto& entry : entries)
+  {
+    if (total <= this->MemoryBudget)
+    {
+      break;
+    }
+    std::get<2>(entry)->ReleasePackedVBO();
+    total -= std::get<1>(entry);
+    this->StagingBuffersTrimmed++;
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLVertexBufferObjectCache::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MemoryBudget: " << this->MemoryBudget << "\n";
+  os << indent << "CacheHits: " << this->CacheHits << "\n";
+  os << indent << "CacheMisses: " << this->CacheMisses << "\n";
+  os << indent << "StagingBuffersTrimmed: " << this->StagingBuffersTrimmed << "\n";
+  os << indent << "DeviceMemorySize: " << this->GetDeviceMemorySize() << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -46,14 +46,59 @@ public:
    */
   void RemoveVBO(vtkOpenGLVertexBufferObject* vbo);
 
+  ///@{
+  /**
+   * Budget in bytes for the host side staging copies held by the cached
+   * VBOs. When the total exceeds the budget, the staging buffers of the
+   * least recently used entries are freed until it fits again; the
+   * device buffers stay resident, since mappers hold references to the
+   * VBOs and entries leave the cache when the last reference drops.
+   * 0 (the default) disables trimming.
+   */
+  vtkSetMacro(MemoryBudget, vtkIdType);
+  vtkGetMacro(MemoryBudget, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Cache statistics: the number of GetVBO calls served by an existing
+   * entry, the number that created a new one, and the number of host
+   * staging buffers freed to stay under the memory budget.
+   */
+  vtkGetMacro(CacheHits, vtkIdType);
+  vtkGetMacro(CacheMisses, vtkIdType);
+  vtkGetMacro(StagingBuffersTrimmed, vtkIdType);
+  ///@}
+
+  /**
+   * Returns the total size in bytes of the device buffers held by the
+   * cached entries.
+   */
+  vtkIdType GetDeviceMemorySize();
+
   typedef std::map<vtkDataArray*, vtkOpenGLVertexBufferObject*> VBOMap;
 
 protected:
   vtkOpenGLVertexBufferObjectCache();
   ~vtkOpenGLVertexBufferObjectCache() override;
 
+  /**
+   * Free the host side staging copies of the least recently used
+   * entries until their total size fits in the memory budget.
+   */
+  void TrimStagingMemory();
+
   VBOMap MappedVBOs;
 
+  vtkIdType MemoryBudget = 0;
+  vtkIdType CacheHits = 0;
+  vtkIdType CacheMisses = 0;
+  vtkIdType StagingBuffersTrimmed = 0;
+
+  // monotonic access clock per entry, used for LRU ordering
+  vtkIdType UseClock = 0;
+  std::map<vtkDataArray*, vtkIdType> LastUse;
+
 private:
   vtkOpenGLVertexBufferObjectCache(const vtkOpenGLVertexBufferObjectCache&) = delete;
   void operator=(const vtkOpenGLVertexBufferObjectCache&) = delete;
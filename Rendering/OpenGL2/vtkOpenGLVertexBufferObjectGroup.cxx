@@ -79,6 +79,7 @@ void vtkOpenGLVertexBufferObjectGroup::RemoveAttribute(const char* attribute)
     {
       viter->second->UnRegister(this);
       this->UsedVBOs.erase(viter);
+      this->LastAppendedArrays.erase(attribute);
       this->Modified();
     }
     std::vector<vtkDataArray*>& vec = diter->second;
@@ -177,6 +178,12 @@ void vtkOpenGLVertexBufferObjectGroup::CacheDataArray(
   this->UsedVBOs[attribute] = vbo;
 }
 
+void vtkOpenGLVertexBufferObjectGroup::SetModifiedTupleRanges(
+  const char* attribute, const std::vector<std::array<vtkIdType, 2>>& ranges)
+{
+  this->ModifiedTupleRanges[attribute] = ranges;
+}
+
 // On a composite poly data with N blocks this method
 // gets called N times. So it is import that it not
 // be order N itself because then the total time
@@ -251,6 +258,7 @@ void vtkOpenGLVertexBufferObjectGroup::ReleaseGraphicsResources(vtkWindow*)
     i->second->Delete();
   }
   this->UsedVBOs.clear();
+  this->LastAppendedArrays.clear();
 }
 
 void vtkOpenGLVertexBufferObjectGroup::AddAllAttributesToVAO(
@@ -298,6 +306,7 @@ void vtkOpenGLVertexBufferObjectGroup::ClearAllVBOs()
     i->second->Delete();
   }
   this->UsedVBOs.clear();
+  this->LastAppendedArrays.clear();
 }
 
 void vtkOpenGLVertexBufferObjectGroup::BuildAllVBOs(vtkViewport* vp)
@@ -315,6 +324,7 @@ void vtkOpenGLVertexBufferObjectGroup::BuildAllVBOs(vtkOpenGLVertexBufferObjectC
   {
     if (this->UsedDataArrays.find(i->first) == this->UsedDataArrays.end())
     {
+      this->LastAppendedArrays.erase(i->first);
       i->second->UnRegister(this);
       vboIter toErase = i;
       ++i;
@@ -326,7 +336,8 @@ void vtkOpenGLVertexBufferObjectGroup::BuildAllVBOs(vtkOpenGLVertexBufferObjectC
     }
   }
 
-  // we always upload appended data :-(
+  // upload appended data, unless the same sequence of unmodified
+  // arrays was already uploaded to this VBO
   for (arrayIter i = this->UsedDataArrays.begin(); i != this->UsedDataArrays.end(); ++i)
   {
     std::string attribute = i->first;
@@ -335,12 +346,36 @@ void vtkOpenGLVertexBufferObjectGroup::BuildAllVBOs(vtkOpenGLVertexBufferObjectC
 
     if (vec.size() > 1)
     {
+      // build the signature of this append sequence. MTimes increase
+      // monotonically process wide, so matching pointers and mtimes
+      // mean the VBO already holds exactly this data
+      std::vector<std::pair<vtkDataArray*, vtkMTimeType>> signature;
+      signature.reserve(vec.size());
+      for (size_t j = 0; j < vec.size(); j++)
+      {
+        signature.emplace_back(vec[j], vec[j]->GetMTime());
+      }
+
+      // camera dependent shift and scale must be recomputed on every
+      // upload so those methods cannot reuse a prior upload
+      int ssMethod = vbo->GetCoordShiftAndScaleMethod();
+      bool dynamicShiftScale = ssMethod == vtkOpenGLVertexBufferObject::NEAR_PLANE_SHIFT_SCALE ||
+        ssMethod == vtkOpenGLVertexBufferObject::FOCAL_POINT_SHIFT_SCALE;
+
+      auto last = this->LastAppendedArrays.find(attribute);
+      if (!dynamicShiftScale && last != this->LastAppendedArrays.end() &&
+        last->second == signature && vbo->GetUploadTime() > vbo->GetMTime())
+      {
+        continue;
+      }
+
+      vbo->ResetAppendState();
       for (size_t j = 0; j < vec.size(); j++)
       {
-        // only append if needed?
         vbo->AppendDataArray(vec[j]);
       }
       vbo->UploadVBO();
+      this->LastAppendedArrays[attribute] = std::move(signature);
     }
   }
 
@@ -351,9 +386,39 @@ void vtkOpenGLVertexBufferObjectGroup::BuildAllVBOs(vtkOpenGLVertexBufferObjectC
     std::vector<vtkDataArray*>& vec = i->second;
     vtkOpenGLVertexBufferObject* vbo = this->UsedVBOs[attribute];
 
-    if (vec.size() == 1 && vec[0]->GetMTime() > vbo->GetUploadTime())
+    if (vec.size() == 1)
     {
-      vbo->UploadDataArray(vec[0]);
+      // if the VBO last held appended data its contents do not match
+      // the single array, so force the upload
+      auto last = this->LastAppendedArrays.find(attribute);
+      bool heldAppendedData = last != this->LastAppendedArrays.end();
+      if (heldAppendedData)
+      {
+        this->LastAppendedArrays.erase(last);
+      }
+      if (heldAppendedData || vec[0]->GetMTime() > vbo->GetUploadTime())
+      {
+        // when the producer declared which tuple ranges changed, patch
+        // the resident buffer instead of re-uploading the whole array
+        bool patched = false;
+        auto riter = this->ModifiedTupleRanges.find(attribute);
+        if (!heldAppendedData && riter != this->ModifiedTupleRanges.end())
+        {
+          patched = true;
+          for (const std::array<vtkIdType, 2>& range : riter->second)
+          {
+            if (!vbo->UploadDataArrayRange(vec[0], range[0], range[1] - range[0] + 1))
+            {
+              patched = false;
+              break;
+            }
+          }
+        }
+        if (!patched)
+        {
+          vbo->UploadDataArray(vec[0]);
+        }
+      }
     }
   }
 
@@ -368,6 +433,7 @@ void vtkOpenGLVertexBufferObjectGroup::BuildAllVBOs(vtkOpenGLVertexBufferObjectC
   }
 
   this->ClearAllDataArrays();
+  this->ModifiedTupleRanges.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -15,10 +15,12 @@
  * each time and this class will not rebuild or upload
  * unless needed.
  *
- * When using the AppendDataArray API no caching is done
- * and the VBOs will be rebuilt and uploaded each time.
- * So when appending th emapper need to handle checking
- * if the VBO should be updated.
+ * When using the AppendDataArray API the VBO for an attribute
+ * is only rebuilt and uploaded when the sequence of appended
+ * arrays differs from what was last uploaded, so re-appending
+ * the same unmodified arrays keeps the data resident on the
+ * device. Mappers still need to handle checking if the set of
+ * arrays to append has changed.
  *
  * Use case:
  *   make this an ivar of your mapper
@@ -50,8 +52,10 @@
 
 #include "vtkObject.h"
 #include "vtkRenderingOpenGL2Module.h" // For export macro
+#include <array>                       // for methods
 #include <map>                         // for methods
 #include <string>                      // for ivars
+#include <utility>                     // for ivars
 #include <vector>                      // for ivars
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -116,6 +120,18 @@ public:
     const char* attribute, vtkDataArray* da, vtkOpenGLVertexBufferObjectCache* cache, int destType);
   void CacheDataArray(const char* attribute, vtkDataArray* da, vtkViewport* vp, int destType);
 
+  /**
+   * Declare that only the given inclusive tuple ranges of the array
+   * cached for an attribute have changed since the last upload. During
+   * the next BuildAllVBOs the resident buffer is then patched in place
+   * with glBufferSubData instead of re-uploaded in full, when the array
+   * layout allows it. The ranges typically come from a producer's
+   * MODIFIED_ID_RANGES metadata. The declaration applies to the next
+   * build only.
+   */
+  void SetModifiedTupleRanges(
+    const char* attribute, const std::vector<std::array<vtkIdType, 2>>& ranges);
+
   /**
    * Check if the array already exists.
    * offset is the index of the first vertex of the array if it exists.
@@ -167,6 +183,14 @@ protected:
   std::map<std::string, std::map<vtkDataArray*, vtkIdType>> UsedDataArrayMaps;
   std::map<std::string, vtkIdType> UsedDataArraySizes;
 
+  // the (array, mtime) sequence last uploaded for each appended
+  // attribute, used to skip the upload when it has not changed
+  std::map<std::string, std::vector<std::pair<vtkDataArray*, vtkMTimeType>>> LastAppendedArrays;
+
+  // inclusive tuple ranges declared modified for the next build,
+  // see SetModifiedTupleRanges
+  std::map<std::string, std::vector<std::array<vtkIdType, 2>>> ModifiedTupleRanges;
+
 private:
   vtkOpenGLVertexBufferObjectGroup(const vtkOpenGLVertexBufferObjectGroup&) = delete;
   void operator=(const vtkOpenGLVertexBufferObjectGroup&) = delete;
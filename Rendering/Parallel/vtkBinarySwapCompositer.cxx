@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkBinarySwapCompositer.h"
+#include "vtkFloatArray.h"
+#include "vtkMultiProcessController.h"
+#include "vtkObjectFactory.h"
+#include "vtkUnsignedCharArray.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBinarySwapCompositer);
+
+//------------------------------------------------------------------------------
+vtkBinarySwapCompositer::vtkBinarySwapCompositer() = default;
+
+//------------------------------------------------------------------------------
+vtkBinarySwapCompositer::~vtkBinarySwapCompositer() = default;
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+// Depth-composite numPixels pixels of the remote span into the local span.
+// Results are put in the local data.
+void vtkBSCompositeSpan(float* localZ, float* remoteZ, unsigned char* localPC,
+  unsigned char* remotePC, float* localPF, float* remotePF, int numComp, int numPixels)
+{
+  if (localPC)
+  {
+    for (int i = 0; i < numPixels; i++)
+    {
+      if (remoteZ[i] < localZ[i])
+      {
+        localZ[i] = remoteZ[i];
+        for (int j = 0; j < numComp; j++)
+        {
+          localPC[i * numComp + j] = remotePC[i * numComp + j];
+        }
+      }
+    }
+  }
+  else
+  {
+    for (int i = 0; i < numPixels; i++)
+    {
+      if (remoteZ[i] < localZ[i])
+      {
+        localZ[i] = remoteZ[i];
+        for (int j = 0; j < numComp; j++)
+        {
+          localPF[i * numComp + j] = remotePF[i * numComp + j];
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBSSendSpan(vtkMultiProcessController* controller, float* zData, unsigned char* pCharData,
+  float* pFloatData, int offset, int numPixels, int numComp, int id)
+{
+  controller->Send(zData + offset, numPixels, id, 99);
+  if (pCharData)
+  {
+    controller->Send(pCharData + offset * numComp, numPixels * numComp, id, 99);
+  }
+  else
+  {
+    controller->Send(pFloatData + offset * numComp, numPixels * numComp, id, 99);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBSReceiveSpan(vtkMultiProcessController* controller, float* zData,
+  unsigned char* pCharData, float* pFloatData, int offset, int numPixels, int numComp, int id)
+{
+  controller->Receive(zData + offset, numPixels, id, 99);
+  if (pCharData)
+  {
+    controller->Receive(pCharData + offset * numComp, numPixels * numComp, id, 99);
+  }
+  else
+  {
+    controller->Receive(pFloatData + offset * numComp, numPixels * numComp, id, 99);
+  }
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::CompositeBuffer(
+  vtkDataArray* pBuf, vtkFloatArray* zBuf, vtkDataArray* pTmp, vtkFloatArray* zTmp)
+{
+  int myId = this->Controller->GetLocalProcessId();
+  int numProcs = this->NumberOfProcesses;
+  int numComp = pBuf->GetNumberOfComponents();
+  int totalPixels = zBuf->GetNumberOfTuples();
+  int i, id;
+
+  float* zData = zBuf->GetPointer(0);
+  float* zTmpData = zTmp->GetPointer(0);
+  unsigned char* pCharData = nullptr;
+  unsigned char* pCharTmpData = nullptr;
+  float* pFloatData = nullptr;
+  float* pFloatTmpData = nullptr;
+  if (pBuf->GetDataType() == VTK_UNSIGNED_CHAR)
+  {
+    pCharData = reinterpret_cast<unsigned char*>(pBuf->GetVoidPointer(0));
+    pCharTmpData = reinterpret_cast<unsigned char*>(pTmp->GetVoidPointer(0));
+  }
+  else
+  {
+    pFloatData = reinterpret_cast<float*>(pBuf->GetVoidPointer(0));
+    pFloatTmpData = reinterpret_cast<float*>(pTmp->GetVoidPointer(0));
+  }
+
+  // Largest power of two that fits in numProcs; the swap rounds run on
+  // exactly this many processes.
+  int pow2Procs = 1;
+  while (pow2Procs * 2 <= numProcs)
+  {
+    pow2Procs *= 2;
+  }
+
+#ifdef MPIPROALLOC
+  vtkCommunicator::SetUseCopy(0);
+#endif
+
+  // Fold the processes beyond the largest power of two into their lower
+  // partners so every remaining process starts with a full composited frame.
+  if (myId >= pow2Procs)
+  {
+    vtkBSSendSpan(
+      this->Controller, zData, pCharData, pFloatData, 0, totalPixels, numComp, myId - pow2Procs);
+#ifdef MPIPROALLOC
+    vtkCommunicator::SetUseCopy(1);
+#endif
+    return;
+  }
+  if (myId + pow2Procs < numProcs)
+  {
+    vtkBSReceiveSpan(this->Controller, zTmpData, pCharTmpData, pFloatTmpData, 0, totalPixels,
+      numComp, myId + pow2Procs);
+    vtkBSCompositeSpan(zData, zTmpData, pCharData, pCharTmpData, pFloatData, pFloatTmpData, numComp,
+      totalPixels);
+  }
+
+  // Binary-swap rounds. Every process keeps one half of its current span and
+  // exchanges the other half with its partner, so the traffic per round
+  // halves as the reduction proceeds and no process ever idles.
+  int offset = 0;
+  int size = totalPixels;
+  for (i = 1; i < pow2Procs; i = i << 1)
+  {
+    id = myId ^ i;
+    int lowerSize = size / 2;
+    int upperSize = size - lowerSize;
+    int keepOffset, keepSize, sendOffset, sendSize;
+    if ((myId & i) == 0)
+    {
+      keepOffset = offset;
+      keepSize = lowerSize;
+      sendOffset = offset + lowerSize;
+      sendSize = upperSize;
+    }
+    else
+    {
+      keepOffset = offset + lowerSize;
+      keepSize = upperSize;
+      sendOffset = offset;
+      sendSize = lowerSize;
+    }
+
+    // The lower member of each pair sends first; the upper member receives
+    // first. This keeps the blocking exchange deadlock free.
+    if (myId < id)
+    {
+      vtkBSSendSpan(this->Controller, zData, pCharData, pFloatData, sendOffset, sendSize, numComp,
+        id);
+      vtkBSReceiveSpan(this->Controller, zTmpData, pCharTmpData, pFloatTmpData, keepOffset,
+        keepSize, numComp, id);
+    }
+    else
+    {
+      vtkBSReceiveSpan(this->Controller, zTmpData, pCharTmpData, pFloatTmpData, keepOffset,
+        keepSize, numComp, id);
+      vtkBSSendSpan(this->Controller, zData, pCharData, pFloatData, sendOffset, sendSize, numComp,
+        id);
+    }
+
+    vtkBSCompositeSpan(zData + keepOffset, zTmpData + keepOffset,
+      pCharData ? pCharData + keepOffset * numComp : nullptr,
+      pCharTmpData ? pCharTmpData + keepOffset * numComp : nullptr,
+      pFloatData ? pFloatData + keepOffset * numComp : nullptr,
+      pFloatTmpData ? pFloatTmpData + keepOffset * numComp : nullptr, numComp, keepSize);
+
+    offset = keepOffset;
+    size = keepSize;
+  }
+
+  // Gather the fully composited spans onto process 0. Each process ends the
+  // swap rounds owning a distinct span, so the receives on process 0 write
+  // straight into the final buffers.
+  if (myId == 0)
+  {
+    for (id = 1; id < pow2Procs; id++)
+    {
+      int span[2];
+      this->Controller->Receive(span, 2, id, 99);
+      if (span[1] > 0)
+      {
+        vtkBSReceiveSpan(
+          this->Controller, zData, pCharData, pFloatData, span[0], span[1], numComp, id);
+      }
+    }
+  }
+  else
+  {
+    int span[2] = { offset, size };
+    this->Controller->Send(span, 2, 0, 99);
+    if (size > 0)
+    {
+      vtkBSSendSpan(this->Controller, zData, pCharData, pFloatData, offset, size, numComp, 0);
+    }
+  }
+
+#ifdef MPIPROALLOC
+  vtkCommunicator::SetUseCopy(1);
+#endif
+}
+
+//------------------------------------------------------------------------------
+void vtkBinarySwapCompositer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+VTK_ABI_NAMESPACE_END
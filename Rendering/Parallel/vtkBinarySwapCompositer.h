@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * @class   vtkBinarySwapCompositer
+ * @brief   Implements binary-swap compositing.
+ *
+ * vtkBinarySwapCompositer composites the color and depth buffers of all
+ * processes onto process 0 using the binary-swap schedule. Unlike
+ * vtkTreeCompositer, which sends full frames at every reduction level and
+ * idles half of the remaining processes each round, binary swap keeps every
+ * process busy for all log2(N) rounds: in each round a process exchanges one
+ * half of its current image span with a partner and composites the half it
+ * keeps, so the amount of pixel data sent per round halves as the reduction
+ * proceeds. A final gather collects the per-process spans onto process 0.
+ * Process counts that are not a power of two are handled by folding the
+ * excess processes into their lower partners before the swap rounds start.
+ * It will not handle transparency well.
+ *
+ * @sa
+ * vtkTreeCompositer vtkCompressCompositer
+ */
+
+#ifndef vtkBinarySwapCompositer_h
+#define vtkBinarySwapCompositer_h
+
+#include "vtkCompositer.h"
+#include "vtkRenderingParallelModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKRENDERINGPARALLEL_EXPORT vtkBinarySwapCompositer : public vtkCompositer
+{
+public:
+  static vtkBinarySwapCompositer* New();
+  vtkTypeMacro(vtkBinarySwapCompositer, vtkCompositer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  void CompositeBuffer(
+    vtkDataArray* pBuf, vtkFloatArray* zBuf, vtkDataArray* pTmp, vtkFloatArray* zTmp) override;
+
+protected:
+  vtkBinarySwapCompositer();
+  ~vtkBinarySwapCompositer() override;
+
+private:
+  vtkBinarySwapCompositer(const vtkBinarySwapCompositer&) = delete;
+  void operator=(const vtkBinarySwapCompositer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
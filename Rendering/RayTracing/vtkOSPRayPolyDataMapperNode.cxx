@@ -19,6 +19,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPiecewiseFunction.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolyDataMapper.h"
 #include "vtkProperty.h"
@@ -37,6 +38,74 @@
 namespace vtkosp
 {
 VTK_ABI_NAMESPACE_BEGIN
+// A process wide registry of committed vertex position arrays, keyed on
+// the points they were uploaded from. Every mapper node that shows the
+// same points - across actors, renderers and views - reuses one device
+// copy instead of transforming and uploading its own. The registry holds
+// only weak references; the nodes using a buffer own it and the device
+// memory is released when the last of them lets go.
+struct SharedVertexKey
+{
+  RTW::Backend* Backend;
+  vtkPoints* Points;
+  vtkMTimeType MTime;
+
+  bool operator<(const SharedVertexKey& other) const
+  {
+    if (this->Backend != other.Backend)
+    {
+      return this->Backend < other.Backend;
+    }
+    if (this->Points != other.Points)
+    {
+      return this->Points < other.Points;
+    }
+    return this->MTime < other.MTime;
+  }
+};
+
+static std::map<SharedVertexKey, std::weak_ptr<vtkOSPRayCacheItemObject>> SharedVertexRegistry;
+
+//------------------------------------------------------------------------------
+std::shared_ptr<vtkOSPRayCacheItemObject> FindSharedVertices(
+  RTW::Backend* backend, vtkPoints* points)
+{
+  SharedVertexKey key{ backend, points, points->GetMTime() };
+  auto it = SharedVertexRegistry.find(key);
+  if (it != SharedVertexRegistry.end())
+  {
+    if (auto held = it->second.lock())
+    {
+      return held;
+    }
+    SharedVertexRegistry.erase(it);
+  }
+  return nullptr;
+}
+
+//------------------------------------------------------------------------------
+std::shared_ptr<vtkOSPRayCacheItemObject> ShareVertices(
+  RTW::Backend* backend, vtkPoints* points, OSPData position)
+{
+  // drop entries whose last user has gone away, among them any upload
+  // made from an older incarnation of these points
+  for (auto it = SharedVertexRegistry.begin(); it != SharedVertexRegistry.end();)
+  {
+    if (it->second.expired())
+    {
+      it = SharedVertexRegistry.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
+  auto held = std::make_shared<vtkOSPRayCacheItemObject>(backend, position);
+  SharedVertexRegistry[SharedVertexKey{ backend, points, points->GetMTime() }] = held;
+  return held;
+}
+
+//------------------------------------------------------------------------------
 void VToOPointNormals(
   vtkDataArray* vNormals, std::vector<osp::vec3f>& normals, vtkMatrix3x3* matrix)
 {
@@ -843,27 +912,54 @@ void vtkOSPRayPolyDataMapperNode::ORenderPoly(void* renderer, vtkOSPRayActorNode
     texTransform.w = mat[5];
   }
 
+  // make connectivity
+  vtkPolyDataMapperNode::vtkPDConnectivity conn;
+  vtkPolyDataMapperNode::MakeConnectivity(poly, property->GetRepresentation(), conn);
+
   // make geometry
-  std::vector<double> _vertices;
-  vtkPolyDataMapperNode::TransformPoints(act, poly, _vertices);
-  size_t numPositions = _vertices.size() / 3;
-  if (numPositions == 0)
+  // Only the triangle meshes consume the device side vertex array directly;
+  // spheres and cylinders index the host side copy made below.
+  const bool deviceVerticesSuffice = property->GetRepresentation() == VTK_SURFACE &&
+    !property->GetEdgeVisibility() && conn.vertex_index.empty() && conn.line_index.empty();
+  std::shared_ptr<vtkOSPRayCacheItemObject> sharedVertices;
+  if (deviceVerticesSuffice && act->GetIsIdentity() && poly->GetPoints())
   {
-    return;
+    // actor transforms are baked into the upload, so only untransformed
+    // actors can share one
+    sharedVertices = vtkosp::FindSharedVertices(backend, poly->GetPoints());
   }
-  std::vector<osp::vec3f> vertices(numPositions);
-  for (size_t i = 0; i < numPositions; i++)
+  std::vector<osp::vec3f> vertices;
+  OSPData position = nullptr;
+  if (sharedVertices)
   {
-    vertices[i] = osp::vec3f{ static_cast<float>(_vertices[i * 3 + 0]),
-      static_cast<float>(_vertices[i * 3 + 1]), static_cast<float>(_vertices[i * 3 + 2]) };
+    position = static_cast<OSPData>(sharedVertices->object);
+  }
+  else
+  {
+    std::vector<double> _vertices;
+    vtkPolyDataMapperNode::TransformPoints(act, poly, _vertices);
+    size_t numPositions = _vertices.size() / 3;
+    if (numPositions == 0)
+    {
+      return;
+    }
+    vertices.resize(numPositions);
+    for (size_t i = 0; i < numPositions; i++)
+    {
+      vertices[i] = osp::vec3f{ static_cast<float>(_vertices[i * 3 + 0]),
+        static_cast<float>(_vertices[i * 3 + 1]), static_cast<float>(_vertices[i * 3 + 2]) };
+    }
+    position = ospNewCopyData1D(&vertices[0], OSP_VEC3F, numPositions);
+    ospCommit(position);
+    if (act->GetIsIdentity() && poly->GetPoints())
+    {
+      sharedVertices = vtkosp::ShareVertices(backend, poly->GetPoints(), position);
+    }
+  }
+  if (sharedVertices)
+  {
+    this->SharedVertexBuffers.push_back(sharedVertices);
   }
-  OSPData position = ospNewCopyData1D(&vertices[0], OSP_VEC3F, numPositions);
-  ospCommit(position);
-  _vertices.clear();
-
-  // make connectivity
-  vtkPolyDataMapperNode::vtkPDConnectivity conn;
-  vtkPolyDataMapperNode::MakeConnectivity(poly, property->GetRepresentation(), conn);
 
   // choosing sphere and cylinder radii (for points and lines) that
   // approximate pointsize and linewidth
@@ -1288,7 +1384,12 @@ void vtkOSPRayPolyDataMapperNode::ORenderPoly(void* renderer, vtkOSPRayActorNode
       }
     }
   }
-  ospRelease(position);
+  if (!sharedVertices)
+  {
+    // when shared, the registry entry in this->SharedVertexBuffers keeps
+    // the creation reference until the last node using it lets go
+    ospRelease(position);
+  }
 
   for (auto it : mats)
   {
@@ -1399,5 +1500,6 @@ void vtkOSPRayPolyDataMapperNode::ClearGeometricModels()
     ospRelease(instance);
   }
   this->Instances.clear();
+  this->SharedVertexBuffers.clear();
 }
 VTK_ABI_NAMESPACE_END
@@ -44,6 +44,15 @@ protected:
 
   std::vector<OSPGeometricModel> GeometricModels;
   std::vector<OSPInstance> Instances;
+
+  /**
+   * Device vertex arrays this node currently holds a share of. The
+   * implementation keeps a registry of committed vertex buffers keyed on
+   * the points they were uploaded from, so mapper nodes across renderers
+   * and views showing the same points reuse one upload.
+   */
+  std::vector<std::shared_ptr<vtkOSPRayCacheItemObject>> SharedVertexBuffers;
+
   void ClearGeometricModels();
 
   /**
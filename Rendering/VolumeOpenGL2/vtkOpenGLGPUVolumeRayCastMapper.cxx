@@ -19,6 +19,7 @@
 #include "vtkOpenGLResourceFreeCallback.h"
 #include "vtkOpenGLState.h"
 #include "vtkOpenGLUniforms.h"
+#include <vtkArrayDispatch.h>
 #include <vtkBoundingBox.h>
 #include <vtkCamera.h>
 #include <vtkCellArray.h>
@@ -28,12 +29,14 @@
 #include <vtkCommand.h>
 #include <vtkContourFilter.h>
 #include <vtkDataArray.h>
+#include <vtkDataArrayRange.h>
 #include <vtkDensifyPolyData.h>
 #include <vtkFloatArray.h>
 #include <vtkImageData.h>
 #include <vtkLight.h>
 #include <vtkLightCollection.h>
 #include <vtkMath.h>
+#include <vtkMatrix3x3.h>
 #include <vtkMatrix4x4.h>
 #include <vtkMultiVolume.h>
 #include <vtkNew.h>
@@ -48,6 +51,7 @@
 #include <vtkOpenGLShaderCache.h>
 #include <vtkOpenGLShaderProperty.h>
 #include <vtkOpenGLVertexArrayObject.h>
+#include <vtkPiecewiseFunction.h>
 #include <vtkPixelBufferObject.h>
 #include <vtkPixelExtent.h>
 #include <vtkPixelTransfer.h>
@@ -59,6 +63,7 @@
 #include <vtkRectilinearGrid.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderer.h>
+#include <vtkSMPTools.h>
 #include <vtkShader.h>
 #include <vtkShaderProgram.h>
 #include <vtkSmartPointer.h>
@@ -262,6 +267,19 @@ public:
     vtkRenderer* ren, vtkShaderProgram* prog, vtkVolume* vol, double geometry[24]);
   ///@}
 
+  ///@{
+  /**
+   * Empty-space skipping. The loaded scalars are summarized into a min-max
+   * brick structure once per upload; when the scalar opacity function
+   * changes, the bricks whose value range maps entirely to zero opacity are
+   * discarded and the proxy geometry is tightened to the remaining region,
+   * so rays are never cast through it.
+   */
+  void ComputeRenderGeometry(vtkVolume* vol, vtkVolumeTexture* volumeTex,
+    vtkVolumeTexture::VolumeBlock* block, double geometry[24]);
+  void UpdateBrickMinMax(vtkDataArray* scalars, const int dims[3]);
+  ///@}
+
   // Update cropping params to shader
   void SetCroppingRegions(vtkShaderProgram* prog, double loadedBounds[6]);
 
@@ -453,6 +471,10 @@ public:
 
   vtkTimeStamp ShaderBuildTime;
 
+  // number of isovalues baked into the shader per port, used to skip
+  // shader rebuilds on isovalue-only edits in isosurface blend mode
+  std::map<int, vtkIdType> LastNumberOfIsoValues;
+
   vtkNew<vtkMatrix4x4> InverseProjectionMat;
   vtkNew<vtkMatrix4x4> InverseModelViewMat;
   vtkNew<vtkMatrix4x4> InverseVolumeMat;
@@ -462,6 +484,18 @@ public:
   vtkSmartPointer<vtkPolyData> BBoxPolyData;
   vtkSmartPointer<vtkVolumeTexture> CurrentMask;
 
+  // Min-max summary of the loaded scalars over bricks of voxels and the
+  // tight point extent of the bricks the current scalar opacity function
+  // does not map entirely to zero opacity (see ComputeRenderGeometry).
+  std::vector<double> BrickMin;
+  std::vector<double> BrickMax;
+  int BrickDims[3] = { 0, 0, 0 };
+  int TightExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  bool TightExtentValid = false;
+  vtkTimeStamp BrickSummaryTime;
+  vtkTimeStamp TightClassifyTime;
+  vtkTimeStamp TightGeometryTime;
+
   vtkTimeStamp InitializationTime;
   vtkTimeStamp MaskUpdateTime;
   vtkTimeStamp ReleaseResourcesTime;
@@ -1067,6 +1101,7 @@ bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::IsGeometryUpdateRequired(
 
   return (this->NeedToInitializeResources || uploadTimeChanged ||
     this->IsCameraInside(ren, vol, geometry) || this->CameraWasInsideInLastUpdate ||
+    this->TightGeometryTime > GeomTime ||
     (this->MultiVolume && this->MultiVolume->GetBoundsTime() > this->BBoxPolyData->GetMTime()));
 }
 
@@ -1260,6 +1295,210 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::RenderVolumeGeometry(
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
+namespace
+{
+// Edge length, in voxels, of the bricks the loaded scalars are summarized
+// over for empty-space skipping.
+constexpr int vtkEmptySpaceBrickSize = 8;
+
+// Computes the scalar min-max of every brick. Parallelized over slabs of
+// bricks along the z axis so no two ranges touch the same brick.
+struct vtkBrickMinMaxWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const int dims[3], const int brickDims[3],
+    std::vector<double>& brickMin, std::vector<double>& brickMax) const
+  {
+    const auto values = vtk::DataArrayValueRange<1>(array);
+    vtkSMPTools::For(0, brickDims[2], [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType bz = begin; bz < end; ++bz)
+      {
+        const int zEnd =
+          std::min(static_cast<int>(bz + 1) * vtkEmptySpaceBrickSize, dims[2]);
+        for (int z = static_cast<int>(bz) * vtkEmptySpaceBrickSize; z < zEnd; ++z)
+        {
+          for (int y = 0; y < dims[1]; ++y)
+          {
+            const vtkIdType rowStart = (static_cast<vtkIdType>(z) * dims[1] + y) * dims[0];
+            const size_t rowBrick =
+              (bz * brickDims[1] + y / vtkEmptySpaceBrickSize) * brickDims[0];
+            for (int x = 0; x < dims[0]; ++x)
+            {
+              const double value = static_cast<double>(values[rowStart + x]);
+              const size_t brick = rowBrick + x / vtkEmptySpaceBrickSize;
+              brickMin[brick] = std::min(brickMin[brick], value);
+              brickMax[brick] = std::max(brickMax[brick], value);
+            }
+          }
+        }
+      }
+    });
+  }
+};
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::UpdateBrickMinMax(
+  vtkDataArray* scalars, const int dims[3])
+{
+  for (int cc = 0; cc < 3; ++cc)
+  {
+    this->BrickDims[cc] = (dims[cc] + vtkEmptySpaceBrickSize - 1) / vtkEmptySpaceBrickSize;
+  }
+  const size_t numBricks =
+    static_cast<size_t>(this->BrickDims[0]) * this->BrickDims[1] * this->BrickDims[2];
+  this->BrickMin.assign(numBricks, VTK_DOUBLE_MAX);
+  this->BrickMax.assign(numBricks, VTK_DOUBLE_MIN);
+
+  vtkBrickMinMaxWorker worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(
+        scalars, worker, dims, this->BrickDims, this->BrickMin, this->BrickMax))
+  {
+    worker(scalars, dims, this->BrickDims, this->BrickMin, this->BrickMax);
+  }
+  this->BrickSummaryTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::ComputeRenderGeometry(vtkVolume* vol,
+  vtkVolumeTexture* volumeTex, vtkVolumeTexture::VolumeBlock* block, double geometry[24])
+{
+  std::copy(block->VolumeGeometry, block->VolumeGeometry + 24, geometry);
+
+  // Empty-space skipping only applies to the plain composited,
+  // single-component, point-data image path; everything else keeps the full
+  // proxy geometry. Blend modes other than composite accumulate values
+  // independently of the opacity function, so fully transparent regions
+  // still contribute to them.
+  vtkImageData* imData = vtkImageData::SafeDownCast(block->DataSet);
+  vtkDataArray* scalars = volumeTex->GetLoadedScalars();
+  if (!imData || !scalars || scalars->GetNumberOfComponents() != 1 || volumeTex->IsCellData ||
+    this->CurrentMask || this->Parent->GetCropping() ||
+    this->Parent->GetBlendMode() != vtkVolumeMapper::COMPOSITE_BLEND)
+  {
+    return;
+  }
+  vtkPiecewiseFunction* opacity = vol->GetProperty()->GetScalarOpacity(0);
+  if (!opacity)
+  {
+    return;
+  }
+
+  const int* extent = block->Extents;
+  const int dims[3] = { extent[1] - extent[0] + 1, extent[3] - extent[2] + 1,
+    extent[5] - extent[4] + 1 };
+  if (static_cast<vtkIdType>(dims[0]) * dims[1] * dims[2] != scalars->GetNumberOfTuples())
+  {
+    // Streamed blocks share one scalar array; do not summarize a partial
+    // extent against it.
+    return;
+  }
+
+  if (scalars->GetMTime() > this->BrickSummaryTime)
+  {
+    this->UpdateBrickMinMax(scalars, dims);
+  }
+
+  if (opacity->GetMTime() > this->TightClassifyTime ||
+    this->BrickSummaryTime > this->TightClassifyTime)
+  {
+    // Classify the bricks against the opacity function sampled over the
+    // scalar range: a brick is skippable when every value in its min-max
+    // range maps to zero opacity. A prefix count of the non-zero table bins
+    // turns each brick test into two lookups.
+    constexpr int tableSize = 1024;
+    const double range[2] = { static_cast<double>(volumeTex->ScalarRange[0][0]),
+      static_cast<double>(volumeTex->ScalarRange[0][1]) };
+    double table[tableSize];
+    opacity->GetTable(range[0], range[1], tableSize, table);
+    int prefix[tableSize + 1];
+    prefix[0] = 0;
+    for (int bin = 0; bin < tableSize; ++bin)
+    {
+      prefix[bin + 1] = prefix[bin] + (table[bin] > 0.0 ? 1 : 0);
+    }
+    const double binScale =
+      range[1] > range[0] ? (tableSize - 1) / (range[1] - range[0]) : 0.0;
+
+    int tight[6] = { VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX,
+      VTK_INT_MIN };
+    for (int bz = 0; bz < this->BrickDims[2]; ++bz)
+    {
+      for (int by = 0; by < this->BrickDims[1]; ++by)
+      {
+        for (int bx = 0; bx < this->BrickDims[0]; ++bx)
+        {
+          const size_t brick =
+            (static_cast<size_t>(bz) * this->BrickDims[1] + by) * this->BrickDims[0] + bx;
+          if (this->BrickMin[brick] > this->BrickMax[brick])
+          {
+            continue;
+          }
+          const int lo = vtkMath::ClampValue(
+            static_cast<int>((this->BrickMin[brick] - range[0]) * binScale), 0, tableSize - 1);
+          const int hi = vtkMath::ClampValue(
+            static_cast<int>(std::ceil((this->BrickMax[brick] - range[0]) * binScale)), lo,
+            tableSize - 1);
+          if (prefix[hi + 1] - prefix[lo] == 0)
+          {
+            continue;
+          }
+          tight[0] = std::min(tight[0], bx * vtkEmptySpaceBrickSize);
+          tight[1] = std::max(tight[1], std::min((bx + 1) * vtkEmptySpaceBrickSize, dims[0] - 1));
+          tight[2] = std::min(tight[2], by * vtkEmptySpaceBrickSize);
+          tight[3] = std::max(tight[3], std::min((by + 1) * vtkEmptySpaceBrickSize, dims[1] - 1));
+          tight[4] = std::min(tight[4], bz * vtkEmptySpaceBrickSize);
+          tight[5] = std::max(tight[5], std::min((bz + 1) * vtkEmptySpaceBrickSize, dims[2] - 1));
+        }
+      }
+    }
+
+    bool valid = tight[0] <= tight[1];
+    if (valid)
+    {
+      // Grow by one voxel for the interpolation reach and translate to the
+      // block's point extent.
+      for (int cc = 0; cc < 3; ++cc)
+      {
+        tight[2 * cc] = std::max(tight[2 * cc] - 1, 0) + extent[2 * cc];
+        tight[2 * cc + 1] = std::min(tight[2 * cc + 1] + 1, dims[cc] - 1) + extent[2 * cc];
+      }
+    }
+    if (valid != this->TightExtentValid ||
+      (valid && !std::equal(tight, tight + 6, this->TightExtent)))
+    {
+      std::copy(tight, tight + 6, this->TightExtent);
+      this->TightExtentValid = valid;
+      this->TightGeometryTime.Modified();
+    }
+    this->TightClassifyTime.Modified();
+  }
+
+  if (!this->TightExtentValid || std::equal(extent, extent + 6, this->TightExtent))
+  {
+    return;
+  }
+
+  // Rebuild the 8 proxy-geometry corners from the tight extent, matching the
+  // corner order vtkVolumeTexture uses for the full geometry.
+  double origin[3];
+  double spacing[3];
+  imData->GetOrigin(origin);
+  imData->GetSpacing(spacing);
+  const double* direction = imData->GetDirectionMatrix()->GetData();
+  const int iMin = this->TightExtent[0], iMax = this->TightExtent[1];
+  const int jMin = this->TightExtent[2], jMax = this->TightExtent[3];
+  const int kMin = this->TightExtent[4], kMax = this->TightExtent[5];
+  const int ijkCorners[8][3] = { { iMin, jMin, kMin }, { iMax, jMin, kMin }, { iMin, jMax, kMin },
+    { iMax, jMax, kMin }, { iMin, jMin, kMax }, { iMax, jMin, kMax }, { iMin, jMax, kMax },
+    { iMax, jMax, kMax } };
+  for (int i = 0; i < 8; ++i)
+  {
+    vtkImageData::TransformContinuousIndexToPhysicalPoint(ijkCorners[i][0], ijkCorners[i][1],
+      ijkCorners[i][2], origin, spacing, direction, geometry + i * 3);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::SetCroppingRegions(
   vtkShaderProgram* prog, double loadedBounds[6])
@@ -3014,8 +3253,22 @@ bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::UpdateInputs(vtkRenderer* ren
     auto property = vol->GetProperty();
     auto input = this->Parent->GetTransformedInput(port);
 
-    // Check for property changes
-    this->VolumePropertyChanged |= property->GetMTime() > this->ShaderBuildTime.GetMTime();
+    // Check for property changes. In isosurface blend mode the isovalues
+    // reach the shader as uniforms and only their number is baked into
+    // the program, so isovalue-only edits do not require a rebuild.
+    if (this->Parent->GetBlendMode() == vtkVolumeMapper::ISOSURFACE_BLEND)
+    {
+      vtkIdType nbContours = property->GetIsoSurfaceValues()->GetNumberOfContours();
+      auto lastIter = this->LastNumberOfIsoValues.find(port);
+      this->VolumePropertyChanged |=
+        property->GetMTimeIgnoringIsoSurfaceValues() > this->ShaderBuildTime.GetMTime() ||
+        lastIter == this->LastNumberOfIsoValues.end() || lastIter->second != nbContours;
+      this->LastNumberOfIsoValues[port] = nbContours;
+    }
+    else
+    {
+      this->VolumePropertyChanged |= property->GetMTime() > this->ShaderBuildTime.GetMTime();
+    }
 
     auto it = this->Parent->AssembledInputs.find(port);
     if (it == this->Parent->AssembledInputs.cend() || it->second.Volume != vol)
@@ -3969,7 +4222,9 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::RenderSingleInput(
     this->SetCameraShaderParameters(prog, ren, cam);
     this->SetAdvancedShaderParameters(ren, prog, vol, block, numComp);
 
-    this->RenderVolumeGeometry(ren, prog, vol, block->VolumeGeometry);
+    double geometry[24];
+    this->ComputeRenderGeometry(vol, volumeTex, block, geometry);
+    this->RenderVolumeGeometry(ren, prog, vol, geometry);
 
     this->FinishRendering(numComp);
     block = volumeTex->GetNextBlock();
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 #include "vtkAnariVolumeInterface.h"
 #include "vtkCellData.h"
@@ -16,6 +18,7 @@
 #include "vtkImageResample.h"
 #include "vtkOSPRayVolumeInterface.h"
 #include "vtkObjectFactory.h"
+#include "vtkOpenGLGPUVolumeRayCastMapper.h"
 #include "vtkPiecewiseFunction.h"
 #include "vtkPointData.h"
 #include "vtkPointDataToCellData.h"
@@ -490,6 +493,34 @@ void vtkSmartVolumeMapper::ComputeRenderMode(vtkRenderer* ren, vtkVolume* vol)
       // if the GPU mapper cannot hand the size of the volume.
       this->GPUMapper->GetReductionRatio(scale);
 
+      if (auto glGPUMapper = vtkOpenGLGPUVolumeRayCastMapper::SafeDownCast(this->GPUMapper))
+      {
+        unsigned short partitions[3] = { 1, 1, 1 };
+        if (this->LowResMode == LowResModeStream)
+        {
+          // Stream the volume through the GPU as full-resolution bricks
+          // instead of resampling it: split it into just enough blocks that
+          // a single one fits within the memory budget. The slowest-varying
+          // axes are split first so the blocks stay slab-shaped and copy
+          // contiguously out of the scalar array.
+          if (vtkImageData* input = vtkImageData::SafeDownCast(this->GetInput()))
+          {
+            const int* dims = input->GetDimensions();
+            const double maxSize = this->MaxMemoryInBytes * this->MaxMemoryFraction;
+            double numBlocks = std::ceil(static_cast<double>(dims[0]) * dims[1] * dims[2] *
+              input->GetScalarSize() * input->GetNumberOfScalarComponents() / maxSize);
+            for (int axis = 2; axis >= 0 && numBlocks > 1.0; --axis)
+            {
+              const double split = std::min({ numBlocks, static_cast<double>(dims[axis]),
+                static_cast<double>(VTK_UNSIGNED_SHORT_MAX) });
+              partitions[axis] = static_cast<unsigned short>(split);
+              numBlocks = std::ceil(numBlocks / partitions[axis]);
+            }
+          }
+        }
+        glGPUMapper->SetPartitions(partitions[0], partitions[1], partitions[2]);
+      }
+
       // if any of the scale factors is not 1.0, then we do need
       // to use the low res mapper for interactive rendering
       if (LowResMode == LowResModeResample &&
@@ -375,11 +375,18 @@ public:
    * this enable large volume to be displayed at higher frame rate at the cost of
    * rendering quality
    * Actual resample factor will be determined using MaxMemoryInBytes and MaxMemoryFraction
+   * LowResModeStream keeps the full resolution and instead streams the volume
+   * through the GPU as bricks: the volume is split into just enough blocks
+   * that a single one fits within the memory budget and the GPU mapper
+   * uploads and composites them back to front on every render. This lets
+   * volumes larger than GPU memory render without downsampling, at the cost
+   * of per-render texture uploads.
    */
   enum LowResModeType
   {
     LowResModeDisabled = 0,
     LowResModeResample = 1,
+    LowResModeStream = 2,
   };
 
   vtkSetMacro(LowResMode, int);
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Exercises vtkWebGPUComputePipeline with a point-cloud style kernel: each
+// invocation culls a point against a radius and maps its scalar to a color,
+// the two results are read back and checked against a CPU reference.
+#include "vtkNew.h"
+#include "vtkWebGPUComputeBuffer.h"
+#include "vtkWebGPUComputePipeline.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr int NumberOfPoints = 1024;
+constexpr float CullRadius = 4.0f;
+
+const char* ComputeShaderSource = R"(
+struct Params
+{
+  cull_radius: f32,
+  num_points: u32,
+}
+
+@group(0) @binding(0) var<uniform> params: Params;
+@group(0) @binding(1) var<storage, read> positions: array<f32>;
+@group(0) @binding(2) var<storage, read> scalars: array<f32>;
+@group(0) @binding(3) var<storage, read_write> visibility: array<u32>;
+@group(0) @binding(4) var<storage, read_write> colors: array<f32>;
+
+@compute @workgroup_size(64)
+fn computeMain(@builtin(global_invocation_id) id: vec3<u32>)
+{
+  if (id.x >= params.num_points)
+  {
+    return;
+  }
+  let p = vec3<f32>(positions[3u * id.x], positions[3u * id.x + 1u], positions[3u * id.x + 2u]);
+  visibility[id.x] = select(0u, 1u, length(p) <= params.cull_radius);
+  // grayscale scalar mapping, enough to validate the indexing
+  let s = clamp(scalars[id.x], 0.0f, 1.0f);
+  colors[3u * id.x] = s;
+  colors[3u * id.x + 1u] = s;
+  colors[3u * id.x + 2u] = 1.0f - s;
+}
+)";
+
+struct Results
+{
+  std::vector<uint32_t> Visibility;
+  std::vector<float> Colors;
+};
+
+void OnVisibilityMapped(const void* mappedData, void* userdata)
+{
+  auto results = reinterpret_cast<Results*>(userdata);
+  auto flags = reinterpret_cast<const uint32_t*>(mappedData);
+  results->Visibility.assign(flags, flags + NumberOfPoints);
+}
+
+void OnColorsMapped(const void* mappedData, void* userdata)
+{
+  auto results = reinterpret_cast<Results*>(userdata);
+  auto colors = reinterpret_cast<const float*>(mappedData);
+  results->Colors.assign(colors, colors + 3 * NumberOfPoints);
+}
+}
+
+int TestComputePipeline(int, char*[])
+{
+  std::vector<float> positions(3 * NumberOfPoints);
+  std::vector<float> scalars(NumberOfPoints);
+  for (int i = 0; i < NumberOfPoints; ++i)
+  {
+    positions[3 * i] = 0.01f * i;
+    positions[3 * i + 1] = -0.005f * i;
+    positions[3 * i + 2] = 0.002f * i;
+    scalars[i] = i / static_cast<float>(NumberOfPoints - 1);
+  }
+  struct
+  {
+    float CullRadius;
+    uint32_t NumberOfPoints2;
+  } params = { CullRadius, NumberOfPoints };
+
+  vtkNew<vtkWebGPUComputeBuffer> paramsBuffer;
+  paramsBuffer->SetBinding(0);
+  paramsBuffer->SetMode(vtkWebGPUComputeBuffer::UNIFORM_BUFFER);
+  paramsBuffer->SetByteSize(sizeof(params));
+  paramsBuffer->SetLabel("params");
+
+  vtkNew<vtkWebGPUComputeBuffer> positionsBuffer;
+  positionsBuffer->SetBinding(1);
+  positionsBuffer->SetData(positions);
+  positionsBuffer->SetLabel("positions");
+
+  vtkNew<vtkWebGPUComputeBuffer> scalarsBuffer;
+  scalarsBuffer->SetBinding(2);
+  scalarsBuffer->SetData(scalars);
+  scalarsBuffer->SetLabel("scalars");
+
+  vtkNew<vtkWebGPUComputeBuffer> visibilityBuffer;
+  visibilityBuffer->SetBinding(3);
+  visibilityBuffer->SetMode(vtkWebGPUComputeBuffer::READ_WRITE_MAP_COMPUTE_STORAGE);
+  visibilityBuffer->SetByteSize(NumberOfPoints * sizeof(uint32_t));
+  visibilityBuffer->SetLabel("visibility");
+
+  vtkNew<vtkWebGPUComputeBuffer> colorsBuffer;
+  colorsBuffer->SetBinding(4);
+  colorsBuffer->SetMode(vtkWebGPUComputeBuffer::READ_WRITE_MAP_COMPUTE_STORAGE);
+  colorsBuffer->SetByteSize(3 * NumberOfPoints * sizeof(float));
+  colorsBuffer->SetLabel("colors");
+
+  vtkNew<vtkWebGPUComputePipeline> pipeline;
+  pipeline->SetShaderSource(::ComputeShaderSource);
+  pipeline->SetShaderEntryPoint("computeMain");
+  int paramsIndex = pipeline->AddBuffer(paramsBuffer);
+  pipeline->AddBuffer(positionsBuffer);
+  pipeline->AddBuffer(scalarsBuffer);
+  int visibilityIndex = pipeline->AddBuffer(visibilityBuffer);
+  int colorsIndex = pipeline->AddBuffer(colorsBuffer);
+  if (paramsIndex < 0 || visibilityIndex < 0 || colorsIndex < 0)
+  {
+    std::cerr << "Failed to create compute buffers\n";
+    return EXIT_FAILURE;
+  }
+  pipeline->UpdateBufferData(paramsIndex, &params, sizeof(params));
+
+  pipeline->Dispatch((NumberOfPoints + 63) / 64);
+
+  Results results;
+  pipeline->ReadBufferFromGPU(visibilityIndex, ::OnVisibilityMapped, &results);
+  pipeline->ReadBufferFromGPU(colorsIndex, ::OnColorsMapped, &results);
+  pipeline->Update();
+
+  if (results.Visibility.size() != NumberOfPoints ||
+    results.Colors.size() != 3 * NumberOfPoints)
+  {
+    std::cerr << "Readback did not produce the expected number of values\n";
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < NumberOfPoints; ++i)
+  {
+    const float length = std::sqrt(positions[3 * i] * positions[3 * i] +
+      positions[3 * i + 1] * positions[3 * i + 1] + positions[3 * i + 2] * positions[3 * i + 2]);
+    const uint32_t expectedVisibility = length <= CullRadius ? 1 : 0;
+    if (results.Visibility[i] != expectedVisibility)
+    {
+      std::cerr << "Wrong visibility for point " << i << '\n';
+      return EXIT_FAILURE;
+    }
+    if (std::abs(results.Colors[3 * i] - scalars[i]) > 1e-6f ||
+      std::abs(results.Colors[3 * i + 2] - (1.0f - scalars[i])) > 1e-6f)
+    {
+      std::cerr << "Wrong color for point " << i << '\n';
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
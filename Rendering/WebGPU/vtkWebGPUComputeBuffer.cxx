@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkWebGPUComputeBuffer.h"
+
+#include "vtkDataArray.h"
+#include "vtkObjectFactory.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkWebGPUComputeBuffer);
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputeBuffer::vtkWebGPUComputeBuffer() = default;
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputeBuffer::~vtkWebGPUComputeBuffer() = default;
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputeBuffer::SetData(vtkDataArray* array)
+{
+  this->DataArray = array;
+  if (array)
+  {
+    this->DataPointer = array->GetVoidPointer(0);
+    this->ByteSize = static_cast<std::size_t>(array->GetNumberOfValues()) * array->GetDataTypeSize();
+  }
+  else
+  {
+    this->DataPointer = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputeBuffer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Group: " << this->Group << '\n';
+  os << indent << "Binding: " << this->Binding << '\n';
+  os << indent << "Mode: " << this->Mode << '\n';
+  os << indent << "ByteSize: " << this->ByteSize << '\n';
+  os << indent << "Label: " << this->Label << '\n';
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkWebGPUComputeBuffer
+ * @brief   Describes a buffer bound to a compute pipeline.
+ *
+ * vtkWebGPUComputeBuffer describes one storage or uniform buffer that a
+ * vtkWebGPUComputePipeline binds to its compute shader: the (group, binding)
+ * pair it occupies in the WGSL source, its access mode, its size and
+ * optionally the host data uploaded into it when the pipeline creates the
+ * device buffer.
+ *
+ * Host data can be given either as a vtkDataArray, in which case this class
+ * keeps a reference to the array, or as a std::vector, in which case the
+ * vector must outlive the AddBuffer() call that uploads it.
+ *
+ * @sa
+ * vtkWebGPUComputePipeline
+ */
+
+#ifndef vtkWebGPUComputeBuffer_h
+#define vtkWebGPUComputeBuffer_h
+
+#include "vtkObject.h"
+#include "vtkRenderingWebGPUModule.h" // for export macro
+#include "vtkSmartPointer.h"          // for the data array ivar
+
+#include <string> // for the buffer label
+#include <vector> // for SetData
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+
+class VTKRENDERINGWEBGPU_EXPORT vtkWebGPUComputeBuffer : public vtkObject
+{
+public:
+  static vtkWebGPUComputeBuffer* New();
+  vtkTypeMacro(vtkWebGPUComputeBuffer, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * How the compute shader accesses the buffer. Storage buffers map to WGSL
+   * `var<storage, read>` or `var<storage, read_write>`, uniform buffers to
+   * `var<uniform>`. Use READ_WRITE_MAP_COMPUTE_STORAGE for buffers whose
+   * results are read back to the host with
+   * vtkWebGPUComputePipeline::ReadBufferFromGPU().
+   */
+  enum BufferMode
+  {
+    READ_ONLY_COMPUTE_STORAGE = 0,
+    READ_WRITE_COMPUTE_STORAGE,
+    READ_WRITE_MAP_COMPUTE_STORAGE,
+    UNIFORM_BUFFER,
+
+    NUMBER_OF_BUFFER_MODES
+  };
+
+  ///@{
+  /**
+   * Set/Get the bind group and binding of the buffer in the compute shader.
+   * Both default to 0.
+   */
+  vtkGetMacro(Group, vtkTypeUInt32);
+  vtkSetMacro(Group, vtkTypeUInt32);
+  vtkGetMacro(Binding, vtkTypeUInt32);
+  vtkSetMacro(Binding, vtkTypeUInt32);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get how the compute shader accesses the buffer. The default is
+   * READ_ONLY_COMPUTE_STORAGE.
+   */
+  vtkGetMacro(Mode, BufferMode);
+  vtkSetMacro(Mode, BufferMode);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the size of the buffer in bytes. Setting data with SetData()
+   * sets the size to that of the given data; set it explicitly only for
+   * buffers created without initial data.
+   */
+  vtkGetMacro(ByteSize, std::size_t);
+  vtkSetMacro(ByteSize, std::size_t);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the label used for the device buffer. Labels show up in
+   * WebGPU error messages and graphics debuggers.
+   */
+  const std::string& GetLabel() const { return this->Label; }
+  void SetLabel(const std::string& label) { this->Label = label; }
+  ///@}
+
+  /**
+   * Set the host data uploaded into the buffer when it is added to a
+   * pipeline. The vector is not copied: it must stay alive until
+   * vtkWebGPUComputePipeline::AddBuffer() has been called with this buffer.
+   */
+  template <typename T>
+  void SetData(const std::vector<T>& data)
+  {
+    this->DataPointer = data.data();
+    this->ByteSize = data.size() * sizeof(T);
+    this->DataArray = nullptr;
+  }
+
+  /**
+   * Set the host data from a data array. A reference to the array is kept.
+   */
+  void SetData(vtkDataArray* array);
+
+  /**
+   * Returns the host data to upload, nullptr when the buffer starts
+   * uninitialized.
+   */
+  const void* GetDataPointer() const { return this->DataPointer; }
+
+protected:
+  vtkWebGPUComputeBuffer();
+  ~vtkWebGPUComputeBuffer() override;
+
+  vtkTypeUInt32 Group = 0;
+  vtkTypeUInt32 Binding = 0;
+  BufferMode Mode = READ_ONLY_COMPUTE_STORAGE;
+  std::size_t ByteSize = 0;
+  std::string Label = "vtkWebGPUComputeBuffer";
+
+  const void* DataPointer = nullptr;
+  vtkSmartPointer<vtkDataArray> DataArray;
+
+private:
+  vtkWebGPUComputeBuffer(const vtkWebGPUComputeBuffer&) = delete;
+  void operator=(const vtkWebGPUComputeBuffer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
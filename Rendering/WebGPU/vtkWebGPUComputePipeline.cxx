@@ -0,0 +1,368 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkWebGPUComputePipeline.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkWGPUContext.h"
+#include "vtkWebGPUComputeBuffer.h"
+#include "vtkWebGPUInternalsBindGroup.h"
+#include "vtkWebGPUInternalsBindGroupLayout.h"
+#include "vtkWebGPUInternalsBuffer.h"
+#include "vtkWebGPUInternalsPipelineLayout.h"
+#include "vtkWebGPUInternalsShaderModule.h"
+
+#include <algorithm>
+#include <map>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkWebGPUComputePipeline);
+
+// Tracks one ReadBufferFromGPU() staging buffer until its map callback ran.
+struct vtkWebGPUComputePipeline::MappingContext
+{
+  wgpu::Buffer StagingBuffer;
+  std::size_t ByteSize = 0;
+  BufferMapCallback Callback = nullptr;
+  void* Userdata = nullptr;
+  vtkWebGPUComputePipeline* Self = nullptr;
+  bool Done = false;
+};
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputePipeline::vtkWebGPUComputePipeline() = default;
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputePipeline::~vtkWebGPUComputePipeline()
+{
+  this->Update();
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePipeline::SetShaderSource(const std::string& source)
+{
+  if (this->ShaderSource != source)
+  {
+    this->ShaderSource = source;
+    this->PipelineOutdated = true;
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePipeline::SetShaderEntryPoint(const std::string& entryPoint)
+{
+  if (this->ShaderEntryPoint != entryPoint)
+  {
+    this->ShaderEntryPoint = entryPoint;
+    this->PipelineOutdated = true;
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePipeline::SetDevice(wgpu::Device device)
+{
+  if (this->Device.Get() != device.Get())
+  {
+    if (!this->Buffers.empty())
+    {
+      vtkErrorMacro(<< "The device cannot change after buffers have been added");
+      return;
+    }
+    this->Device = device;
+    this->PipelineOutdated = true;
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkWebGPUComputePipeline::EnsureDevice()
+{
+  if (this->Device)
+  {
+    return true;
+  }
+  wgpu::RequestAdapterOptions options = {};
+  options.powerPreference = wgpu::PowerPreference::HighPerformance;
+  this->Adapter = vtkWGPUContext::RequestAdapter(options);
+  wgpu::DeviceDescriptor deviceDescriptor = {};
+  deviceDescriptor.label = this->Label.c_str();
+  this->Device = vtkWGPUContext::RequestDevice(this->Adapter, deviceDescriptor);
+  if (!this->Device)
+  {
+    vtkErrorMacro(<< "Failed to acquire a device");
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int vtkWebGPUComputePipeline::AddBuffer(vtkWebGPUComputeBuffer* buffer)
+{
+  if (!buffer || !this->EnsureDevice())
+  {
+    return -1;
+  }
+  if (buffer->GetByteSize() == 0)
+  {
+    vtkErrorMacro(<< "Buffer \"" << buffer->GetLabel() << "\" has zero size");
+    return -1;
+  }
+
+  wgpu::BufferUsage usage;
+  switch (buffer->GetMode())
+  {
+    case vtkWebGPUComputeBuffer::READ_ONLY_COMPUTE_STORAGE:
+      usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopyDst;
+      break;
+    case vtkWebGPUComputeBuffer::READ_WRITE_COMPUTE_STORAGE:
+    case vtkWebGPUComputeBuffer::READ_WRITE_MAP_COMPUTE_STORAGE:
+      usage = wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+      break;
+    case vtkWebGPUComputeBuffer::UNIFORM_BUFFER:
+      usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+      break;
+    default:
+      vtkErrorMacro(<< "Unknown buffer mode " << buffer->GetMode());
+      return -1;
+  }
+
+  wgpu::Buffer deviceBuffer = vtkWebGPUInternalsBuffer::CreateABuffer(
+    this->Device, buffer->GetByteSize(), usage, false, buffer->GetLabel().c_str());
+  if (buffer->GetDataPointer() != nullptr)
+  {
+    this->Device.GetQueue().WriteBuffer(
+      deviceBuffer, 0, buffer->GetDataPointer(), buffer->GetByteSize());
+  }
+
+  this->Buffers.emplace_back(buffer);
+  this->DeviceBuffers.emplace_back(deviceBuffer);
+  this->PipelineOutdated = true;
+  return static_cast<int>(this->Buffers.size()) - 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkWebGPUComputePipeline::AddDeviceBuffer(
+  vtkWebGPUComputeBuffer* buffer, wgpu::Buffer deviceBuffer)
+{
+  if (!buffer || !deviceBuffer)
+  {
+    return -1;
+  }
+  if (!this->Device)
+  {
+    vtkErrorMacro(
+      << "Set the device owning the buffer with SetDevice() before adding device buffers");
+    return -1;
+  }
+  this->Buffers.emplace_back(buffer);
+  this->DeviceBuffers.emplace_back(deviceBuffer);
+  this->PipelineOutdated = true;
+  return static_cast<int>(this->Buffers.size()) - 1;
+}
+
+//------------------------------------------------------------------------------
+wgpu::Buffer vtkWebGPUComputePipeline::GetDeviceBuffer(std::size_t bufferIndex)
+{
+  if (bufferIndex >= this->DeviceBuffers.size())
+  {
+    vtkErrorMacro(<< "Invalid buffer index " << bufferIndex);
+    return nullptr;
+  }
+  return this->DeviceBuffers[bufferIndex];
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePipeline::UpdateBufferData(
+  std::size_t bufferIndex, const void* bytes, std::size_t byteSize)
+{
+  if (bufferIndex >= this->DeviceBuffers.size())
+  {
+    vtkErrorMacro(<< "Invalid buffer index " << bufferIndex);
+    return;
+  }
+  if (byteSize > this->Buffers[bufferIndex]->GetByteSize())
+  {
+    vtkErrorMacro(<< byteSize << " bytes do not fit in buffer \""
+                  << this->Buffers[bufferIndex]->GetLabel() << "\"");
+    return;
+  }
+  this->Device.GetQueue().WriteBuffer(this->DeviceBuffers[bufferIndex], 0, bytes, byteSize);
+}
+
+//------------------------------------------------------------------------------
+bool vtkWebGPUComputePipeline::CreatePipelineIfNeeded()
+{
+  if (!this->PipelineOutdated)
+  {
+    return true;
+  }
+  if (this->ShaderSource.empty())
+  {
+    vtkErrorMacro(<< "No shader source set");
+    return false;
+  }
+
+  // group the buffers by bind group number
+  std::map<vtkTypeUInt32,
+    std::vector<vtkWebGPUInternalsBindGroupLayout::LayoutEntryInitializationHelper>>
+    layoutEntries;
+  std::map<vtkTypeUInt32, std::vector<vtkWebGPUInternalsBindGroup::BindingInitializationHelper>>
+    bindingEntries;
+  for (std::size_t i = 0; i < this->Buffers.size(); ++i)
+  {
+    vtkWebGPUComputeBuffer* buffer = this->Buffers[i];
+    wgpu::BufferBindingType bindingType;
+    switch (buffer->GetMode())
+    {
+      case vtkWebGPUComputeBuffer::READ_ONLY_COMPUTE_STORAGE:
+        bindingType = wgpu::BufferBindingType::ReadOnlyStorage;
+        break;
+      case vtkWebGPUComputeBuffer::UNIFORM_BUFFER:
+        bindingType = wgpu::BufferBindingType::Uniform;
+        break;
+      default:
+        bindingType = wgpu::BufferBindingType::Storage;
+        break;
+    }
+    layoutEntries[buffer->GetGroup()].emplace_back(
+      buffer->GetBinding(), wgpu::ShaderStage::Compute, bindingType);
+    bindingEntries[buffer->GetGroup()].emplace_back(
+      buffer->GetBinding(), this->DeviceBuffers[i]);
+  }
+
+  // bind group numbers must be consecutive starting at 0 for the pipeline
+  // layout below
+  std::vector<wgpu::BindGroupLayout> bindGroupLayouts;
+  this->BindGroups.clear();
+  vtkTypeUInt32 expectedGroup = 0;
+  for (auto& groupEntries : layoutEntries)
+  {
+    if (groupEntries.first != expectedGroup++)
+    {
+      vtkErrorMacro(<< "Buffer bind groups must be consecutive and start at 0");
+      return false;
+    }
+    wgpu::BindGroupLayoutDescriptor layoutDescriptor;
+    std::vector<wgpu::BindGroupLayoutEntry> entries(
+      groupEntries.second.begin(), groupEntries.second.end());
+    layoutDescriptor.entryCount = entries.size();
+    layoutDescriptor.entries = entries.data();
+    wgpu::BindGroupLayout layout = this->Device.CreateBindGroupLayout(&layoutDescriptor);
+    bindGroupLayouts.push_back(layout);
+
+    std::vector<wgpu::BindGroupEntry> bindings;
+    for (const auto& helper : bindingEntries[groupEntries.first])
+    {
+      bindings.push_back(helper.GetAsBinding());
+    }
+    wgpu::BindGroupDescriptor bindGroupDescriptor;
+    bindGroupDescriptor.layout = layout;
+    bindGroupDescriptor.entryCount = bindings.size();
+    bindGroupDescriptor.entries = bindings.data();
+    this->BindGroups.emplace_back(
+      groupEntries.first, this->Device.CreateBindGroup(&bindGroupDescriptor));
+  }
+
+  wgpu::ShaderModule shaderModule =
+    vtkWebGPUInternalsShaderModule::CreateFromWGSL(this->Device, this->ShaderSource);
+
+  wgpu::ComputePipelineDescriptor pipelineDescriptor;
+  pipelineDescriptor.label = this->Label.c_str();
+  pipelineDescriptor.layout =
+    vtkWebGPUInternalsPipelineLayout::MakePipelineLayout(this->Device, bindGroupLayouts);
+  pipelineDescriptor.compute.module = shaderModule;
+  pipelineDescriptor.compute.entryPoint = this->ShaderEntryPoint.c_str();
+  this->Pipeline = this->Device.CreateComputePipeline(&pipelineDescriptor);
+
+  this->PipelineOutdated = false;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePipeline::Dispatch(
+  unsigned int groupsX, unsigned int groupsY, unsigned int groupsZ)
+{
+  if (!this->EnsureDevice() || !this->CreatePipelineIfNeeded())
+  {
+    return;
+  }
+
+  wgpu::CommandEncoderDescriptor encoderDescriptor;
+  encoderDescriptor.label = this->Label.c_str();
+  wgpu::CommandEncoder encoder = this->Device.CreateCommandEncoder(&encoderDescriptor);
+  wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+  pass.SetPipeline(this->Pipeline);
+  for (const auto& bindGroup : this->BindGroups)
+  {
+    pass.SetBindGroup(bindGroup.first, bindGroup.second);
+  }
+  pass.DispatchWorkgroups(groupsX, groupsY, groupsZ);
+  pass.End();
+
+  wgpu::CommandBuffer commands = encoder.Finish();
+  this->Device.GetQueue().Submit(1, &commands);
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePipeline::ReadBufferFromGPU(
+  std::size_t bufferIndex, BufferMapCallback callback, void* userdata)
+{
+  if (bufferIndex >= this->DeviceBuffers.size())
+  {
+    vtkErrorMacro(<< "Invalid buffer index " << bufferIndex);
+    return;
+  }
+
+  const std::size_t byteSize = this->Buffers[bufferIndex]->GetByteSize();
+  auto context = std::unique_ptr<MappingContext>(new MappingContext);
+  context->StagingBuffer = vtkWebGPUInternalsBuffer::CreateABuffer(this->Device, byteSize,
+    wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst, false, "compute readback staging");
+  context->ByteSize = byteSize;
+  context->Callback = callback;
+  context->Userdata = userdata;
+  context->Self = this;
+
+  wgpu::CommandEncoder encoder = this->Device.CreateCommandEncoder();
+  encoder.CopyBufferToBuffer(
+    this->DeviceBuffers[bufferIndex], 0, context->StagingBuffer, 0, byteSize);
+  wgpu::CommandBuffer commands = encoder.Finish();
+  this->Device.GetQueue().Submit(1, &commands);
+
+  auto onBufferMapped = [](WGPUBufferMapAsyncStatus status, void* mapUserdata) {
+    auto ctx = reinterpret_cast<MappingContext*>(mapUserdata);
+    if (status == WGPUBufferMapAsyncStatus_Success)
+    {
+      ctx->Callback(ctx->StagingBuffer.GetConstMappedRange(0, ctx->ByteSize), ctx->Userdata);
+      ctx->StagingBuffer.Unmap();
+    }
+    else
+    {
+      vtkErrorWithObjectMacro(ctx->Self, << "Failed to map compute buffer, status: " << status);
+    }
+    ctx->Done = true;
+  };
+  context->StagingBuffer.MapAsync(wgpu::MapMode::Read, 0, byteSize, onBufferMapped, context.get());
+  this->PendingMappings.push_back(std::move(context));
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePipeline::Update()
+{
+  while (std::any_of(this->PendingMappings.begin(), this->PendingMappings.end(),
+    [](const std::unique_ptr<MappingContext>& context) { return !context->Done; }))
+  {
+    vtkWGPUContext::WaitABit();
+  }
+  this->PendingMappings.clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Label: " << this->Label << '\n';
+  os << indent << "ShaderEntryPoint: " << this->ShaderEntryPoint << '\n';
+  os << indent << "NumberOfBuffers: " << this->Buffers.size() << '\n';
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkWebGPUComputePipeline
+ * @brief   Runs a WGSL compute shader over a set of buffers.
+ *
+ * vtkWebGPUComputePipeline wraps a WebGPU compute pass: give it WGSL source
+ * and an entry point, describe the buffers the shader binds with
+ * vtkWebGPUComputeBuffer, then Dispatch() workgroups and read results back
+ * with ReadBufferFromGPU(). Typical use:
+ *
+ * @code
+ * vtkNew<vtkWebGPUComputeBuffer> input;
+ * input->SetBinding(0);
+ * input->SetData(pointData);
+ *
+ * vtkNew<vtkWebGPUComputeBuffer> output;
+ * output->SetBinding(1);
+ * output->SetMode(vtkWebGPUComputeBuffer::READ_WRITE_MAP_COMPUTE_STORAGE);
+ * output->SetByteSize(outputSize);
+ *
+ * vtkNew<vtkWebGPUComputePipeline> pipeline;
+ * pipeline->SetShaderSource(wgslSource);
+ * pipeline->SetShaderEntryPoint("computeMain");
+ * pipeline->AddBuffer(input);
+ * int outputIndex = pipeline->AddBuffer(output);
+ * pipeline->Dispatch(numberOfGroups, 1, 1);
+ * pipeline->ReadBufferFromGPU(outputIndex, callback, userdata);
+ * pipeline->Update();
+ * @endcode
+ *
+ * The pipeline lazily acquires its own device. To share buffers with render
+ * pipelines instead of round-tripping data through the CPU, hand the pipeline
+ * the render window's device with SetDevice() before adding buffers, wrap
+ * existing device buffers with AddDeviceBuffer(), and fetch compute-produced
+ * buffers for rendering with GetDeviceBuffer().
+ *
+ * @sa
+ * vtkWebGPUComputeBuffer vtkWebGPURenderWindow
+ */
+
+#ifndef vtkWebGPUComputePipeline_h
+#define vtkWebGPUComputePipeline_h
+
+#include "vtkObject.h"
+#include "vtkRenderingWebGPUModule.h" // for export macro
+#include "vtkSmartPointer.h"          // for the buffer ivars
+#include "vtk_wgpu.h"                 // for webgpu
+
+#include <memory>  // for the pending mapping ivar
+#include <string>  // for the shader source
+#include <utility> // for the bind group ivar
+#include <vector>  // for the buffer ivars
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkWebGPUComputeBuffer;
+
+class VTKRENDERINGWEBGPU_EXPORT vtkWebGPUComputePipeline : public vtkObject
+{
+public:
+  static vtkWebGPUComputePipeline* New();
+  vtkTypeMacro(vtkWebGPUComputePipeline, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Signature of the callback given to ReadBufferFromGPU(). \p mappedData
+   * points at the buffer contents and is only valid for the duration of the
+   * callback.
+   */
+  using BufferMapCallback = void (*)(const void* mappedData, void* userdata);
+
+  ///@{
+  /**
+   * Set/Get the WGSL source of the compute shader.
+   */
+  const std::string& GetShaderSource() const { return this->ShaderSource; }
+  void SetShaderSource(const std::string& source);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the name of the compute shader entry point in the WGSL source.
+   * Defaults to "computeMain".
+   */
+  const std::string& GetShaderEntryPoint() const { return this->ShaderEntryPoint; }
+  void SetShaderEntryPoint(const std::string& entryPoint);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the label used for the pipeline and its command buffers.
+   */
+  const std::string& GetLabel() const { return this->Label; }
+  void SetLabel(const std::string& label) { this->Label = label; }
+  ///@}
+
+  /**
+   * Create the device buffer described by \p buffer, upload its host data if
+   * any and bind it to the compute shader. Returns the index used to refer
+   * to the buffer in ReadBufferFromGPU()/UpdateBufferData()/
+   * GetDeviceBuffer(), or -1 on error.
+   */
+  int AddBuffer(vtkWebGPUComputeBuffer* buffer);
+
+  /**
+   * Bind an existing device buffer — typically a vertex or storage buffer
+   * owned by a render pipeline on the same device — to the compute shader
+   * instead of creating a new one. \p buffer only provides the group,
+   * binding and access mode; no data is uploaded. The pipeline must use the
+   * same device as the buffer, see SetDevice(). Returns the buffer index or
+   * -1 on error.
+   */
+  int AddDeviceBuffer(vtkWebGPUComputeBuffer* buffer, wgpu::Buffer deviceBuffer);
+
+  /**
+   * Returns the device buffer at the given index so that it can be bound to
+   * a render pipeline sharing the device.
+   */
+  wgpu::Buffer GetDeviceBuffer(std::size_t bufferIndex);
+
+  /**
+   * Overwrite the contents of a buffer with the given bytes. \p byteSize
+   * must not exceed the size the buffer was created with.
+   */
+  void UpdateBufferData(std::size_t bufferIndex, const void* bytes, std::size_t byteSize);
+
+  /**
+   * Enqueue a dispatch of the given number of workgroups in each dimension.
+   */
+  void Dispatch(unsigned int groupsX, unsigned int groupsY = 1, unsigned int groupsZ = 1);
+
+  /**
+   * Enqueue an asynchronous readback of the buffer at the given index. The
+   * callback is invoked with the mapped buffer contents once the GPU work
+   * has completed; call Update() to wait for completion.
+   */
+  void ReadBufferFromGPU(std::size_t bufferIndex, BufferMapCallback callback, void* userdata);
+
+  /**
+   * Block until all dispatches and readbacks enqueued so far have executed
+   * and their callbacks have run.
+   */
+  void Update();
+
+  ///@{
+  /**
+   * Set/Get the device the pipeline creates its buffers on. Set this to a
+   * render window's device before adding buffers to share buffers between
+   * compute and render pipelines; when unset, the pipeline acquires its own
+   * device on first use.
+   */
+  void SetDevice(wgpu::Device device);
+  wgpu::Device GetDevice() { return this->Device; }
+  ///@}
+
+protected:
+  vtkWebGPUComputePipeline();
+  ~vtkWebGPUComputePipeline() override;
+
+  /**
+   * Acquire an adapter and device when none was given with SetDevice().
+   * Returns false when no device can be obtained.
+   */
+  bool EnsureDevice();
+
+  /**
+   * Recreate the shader module, bind groups and compute pipeline if the
+   * shader source or the set of buffers changed since the last dispatch.
+   */
+  bool CreatePipelineIfNeeded();
+
+  std::string ShaderSource;
+  std::string ShaderEntryPoint = "computeMain";
+  std::string Label = "vtkWebGPUComputePipeline";
+
+  wgpu::Adapter Adapter;
+  wgpu::Device Device;
+  wgpu::ComputePipeline Pipeline;
+
+  std::vector<vtkSmartPointer<vtkWebGPUComputeBuffer>> Buffers;
+  std::vector<wgpu::Buffer> DeviceBuffers;
+  // one bind group per group number used by the buffers, sorted by group
+  std::vector<std::pair<vtkTypeUInt32, wgpu::BindGroup>> BindGroups;
+  bool PipelineOutdated = true;
+
+  // readbacks in flight, so Update() knows when every callback has run
+  struct MappingContext;
+  std::vector<std::unique_ptr<MappingContext>> PendingMappings;
+
+private:
+  vtkWebGPUComputePipeline(const vtkWebGPUComputePipeline&) = delete;
+  void operator=(const vtkWebGPUComputePipeline&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
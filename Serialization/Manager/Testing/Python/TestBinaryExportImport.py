@@ -0,0 +1,48 @@
+from vtkmodules.test import Testing as vtkTesting
+import os
+import tempfile
+
+
+class TestBinaryExportImport(vtkTesting.vtkTest):
+
+    def test(self):
+        from vtkmodules.vtkSerializationManager import vtkObjectManager
+        from vtkmodules.vtkCommonCore import vtkTypeFloat32Array
+
+        with tempfile.TemporaryDirectory() as tempdir:
+            filename = os.path.join(tempdir, "scene")
+
+            manager = vtkObjectManager()
+            if not manager.Initialize():
+                return
+
+            array = vtkTypeFloat32Array()
+            for i in range(10):
+                array.InsertNextValue(10 - i)
+            array_id = manager.RegisterObject(array)
+            self.assertEqual(array_id, 1)
+
+            manager.UpdateStatesFromObjects()
+            manager.ExportBinary(filename)
+
+            states_file = filename + ".states.msgpack"
+            blobs_file = filename + ".blobs.msgpack"
+            self.assertTrue(os.path.exists(states_file))
+            self.assertTrue(os.path.exists(blobs_file))
+
+            importer = vtkObjectManager()
+            if not importer.Initialize():
+                return
+            importer.ImportBinary(states_file, blobs_file)
+
+            active_ids = importer.GetAllDependencies(0)
+            self.assertEqual(len(active_ids), 1)
+
+            restored = importer.GetObjectAtId(array_id)
+            self.assertIsInstance(restored, vtkTypeFloat32Array)
+            for i in range(10):
+                self.assertEqual(10 - i, restored.GetValue(i))
+
+
+if __name__ == "__main__":
+    vtkTesting.main([(TestBinaryExportImport, 'test')])
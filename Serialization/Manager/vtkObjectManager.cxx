@@ -209,6 +209,90 @@ void vtkObjectManager::Import(const std::string& stateFileName, const std::strin
   this->UpdateObjectsFromStates();
 }
 
+//------------------------------------------------------------------------------
+void vtkObjectManager::ExportBinary(const std::string& filename)
+{
+  std::string objectStatesFileName = filename, blobsFileName = filename + ".blobs.msgpack";
+  if (!vtksys::SystemTools::StringEndsWith(filename, ".msgpack"))
+  {
+    objectStatesFileName = filename + ".states.msgpack";
+    blobsFileName = filename + ".blobs.msgpack";
+  }
+  {
+    std::ofstream ofs(objectStatesFileName, std::ios::binary);
+    try
+    {
+      const auto buffer = nlohmann::json::to_msgpack(this->Context->States());
+      ofs.write(
+        reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    }
+    catch (nlohmann::json::type_error& e)
+    {
+      vtkErrorMacro(<< "Failed to encode states as msgpack. message=" << e.what());
+    }
+  }
+  {
+    std::ofstream ofs(blobsFileName, std::ios::binary);
+    try
+    {
+      const auto buffer = nlohmann::json::to_msgpack(this->Context->Blobs());
+      ofs.write(
+        reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    }
+    catch (nlohmann::json::type_error& e)
+    {
+      vtkErrorMacro(<< "Failed to encode blobs as msgpack. message=" << e.what());
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkObjectManager::ImportBinary(
+  const std::string& stateFileName, const std::string& blobFileName)
+{
+  this->Clear();
+  // Register all the states.
+  try
+  {
+    nlohmann::json states =
+      nlohmann::json::from_msgpack(std::ifstream(stateFileName, std::ios::binary));
+    for (const auto& state : states.items())
+    {
+      this->Context->RegisterState(state.value());
+    }
+  }
+  catch (nlohmann::json::parse_error& e)
+  {
+    vtkErrorMacro(<< "Failed to parse states from " << stateFileName << ". message=" << e.what());
+  }
+  // Register all the blobs. The msgpack bin segments decode straight into
+  // binary_t without a base64 round trip.
+  try
+  {
+    nlohmann::json blobs =
+      nlohmann::json::from_msgpack(std::ifstream(blobFileName, std::ios::binary));
+    for (const auto& blob : blobs.items())
+    {
+      auto hash = blob.key();
+      const auto& values = blob.value().get_binary();
+      if (!values.empty())
+      {
+        auto byteArray = vtk::TakeSmartPointer(vtkTypeUInt8Array::New());
+        byteArray->SetNumberOfValues(values.size());
+        auto blobRange = vtk::DataArrayValueRange(byteArray);
+        std::copy(values.begin(), values.end(), blobRange.begin());
+        this->Context->RegisterBlob(byteArray, hash);
+      }
+    }
+  }
+  catch (nlohmann::json::parse_error& e)
+  {
+    vtkErrorMacro(<< "Failed to parse blobs from " << blobFileName << ". message=" << e.what());
+  }
+  // Creates objects and deserializes states.
+  this->UpdateObjectsFromStates();
+}
+
 //------------------------------------------------------------------------------
 vtkTypeUInt32 vtkObjectManager::RegisterObject(vtkSmartPointer<vtkObjectBase> objectBase)
 {
@@ -167,6 +167,21 @@ public:
    */
   void Import(const std::string& stateFileName, const std::string& blobFileName);
 
+  /**
+   * Writes state of all registered objects to `filename.states.msgpack` and the blobs to
+   * `filename.blobs.msgpack` in the binary MessagePack encoding. Data arrays are stored as raw
+   * byte segments instead of base64 text, so this is the preferred format when the states are
+   * shipped between processes or written frequently.
+   */
+  void ExportBinary(const std::string& filename);
+
+  /**
+   * Reads state and blobs written by `ExportBinary`.
+   * This clears existing states, objects, blobs, imports data from the two files and updates
+   * objects from the states.
+   */
+  void ImportBinary(const std::string& stateFileName, const std::string& blobFileName);
+
   static vtkTypeUInt32 ROOT() { return 0; }
 
   vtkGetSmartPointerMacro(Serializer, vtkSerializer);
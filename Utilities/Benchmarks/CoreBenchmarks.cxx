@@ -0,0 +1,333 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * Curated micro-benchmarks for non-rendering hot paths: vtkArrayDispatch
+ * workers, vtkStaticCellLocator build and query, vtkCellArray traversal,
+ * vtkSMPTools scaling and vtkFlyingEdges3D. Each benchmark runs several
+ * times and reports its best time, both as a human-readable table on
+ * stdout and, with -o, as a CSV file
+ *
+ *   name,items,seconds,items_per_second
+ *
+ * suitable for storing as a baseline and diffing run-over-run. Use
+ * --scale to shrink or grow the default problem sizes uniformly.
+ */
+
+#include "vtkArrayDispatch.h"
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkDataArrayRange.h"
+#include "vtkFloatArray.h"
+#include "vtkFlyingEdges3D.h"
+#include "vtkImageData.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkTimerLog.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr int NumberOfRepeats = 3;
+
+struct BenchResult
+{
+  std::string Name;
+  vtkIdType Items;
+  double Seconds;
+};
+
+//------------------------------------------------------------------------------
+// Run op() NumberOfRepeats times and keep the best time.
+template <typename TOperation>
+double BestTime(TOperation&& op)
+{
+  double best = -1.0;
+  for (int repeat = 0; repeat < NumberOfRepeats; ++repeat)
+  {
+    double start = vtkTimerLog::GetUniversalTime();
+    op();
+    double elapsed = vtkTimerLog::GetUniversalTime() - start;
+    if (best < 0.0 || elapsed < best)
+    {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+//------------------------------------------------------------------------------
+// Typical dispatched worker: per-tuple vector magnitude through array ranges.
+struct MagnitudeWorker
+{
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT* in, OutArrayT* out) const
+  {
+    const auto inRange = vtk::DataArrayTupleRange<3>(in);
+    auto outRange = vtk::DataArrayValueRange<1>(out);
+    auto outIter = outRange.begin();
+    for (const auto tuple : inRange)
+    {
+      double x = tuple[0];
+      double y = tuple[1];
+      double z = tuple[2];
+      *outIter++ = std::sqrt(x * x + y * y + z * z);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+BenchResult BenchmarkArrayDispatch(vtkIdType numTuples)
+{
+  vtkNew<vtkFloatArray> input;
+  input->SetNumberOfComponents(3);
+  input->SetNumberOfTuples(numTuples);
+  float* raw = input->GetPointer(0);
+  for (vtkIdType i = 0; i < 3 * numTuples; ++i)
+  {
+    raw[i] = static_cast<float>(i % 1024) * 0.001f;
+  }
+  vtkNew<vtkFloatArray> output;
+  output->SetNumberOfTuples(numTuples);
+
+  using Dispatcher =
+    vtkArrayDispatch::Dispatch2ByValueType<vtkArrayDispatch::Reals, vtkArrayDispatch::Reals>;
+  MagnitudeWorker worker;
+  double seconds = BestTime(
+    [&]()
+    {
+      if (!Dispatcher::Execute(input.GetPointer(), output.GetPointer(), worker))
+      {
+        worker(input.GetPointer(), output.GetPointer());
+      }
+    });
+  return { "ArrayDispatchMagnitude", numTuples, seconds };
+}
+
+//------------------------------------------------------------------------------
+std::vector<BenchResult> BenchmarkStaticCellLocator(int resolution, vtkIdType numQueries)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(resolution);
+  sphere->SetPhiResolution(resolution);
+  sphere->Update();
+  vtkPolyData* surface = sphere->GetOutput();
+
+  vtkNew<vtkStaticCellLocator> locator;
+  locator->SetDataSet(surface);
+  double buildSeconds = BestTime(
+    [&]()
+    {
+      locator->FreeSearchStructure();
+      locator->ForceBuildLocator();
+    });
+
+  // ray casts through the sphere from random directions
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(8675309);
+  std::vector<double> rays(3 * numQueries);
+  for (vtkIdType i = 0; i < 3 * numQueries; ++i)
+  {
+    rays[i] = random->GetValue() - 0.5;
+    random->Next();
+  }
+  double querySeconds = BestTime(
+    [&]()
+    {
+      double t, x[3], pcoords[3];
+      int subId;
+      vtkIdType hits = 0;
+      for (vtkIdType i = 0; i < numQueries; ++i)
+      {
+        double p1[3] = { 2.0 * rays[3 * i], 2.0 * rays[3 * i + 1], 2.0 * rays[3 * i + 2] };
+        double p2[3] = { -p1[0], -p1[1], -p1[2] };
+        hits += locator->IntersectWithLine(p1, p2, 1.0e-6, t, x, pcoords, subId);
+      }
+      if (hits == 0)
+      {
+        std::cerr << "StaticCellLocatorQuery: no ray hit the surface\n";
+      }
+    });
+
+  return { { "StaticCellLocatorBuild", surface->GetNumberOfCells(), buildSeconds },
+    { "StaticCellLocatorQuery", numQueries, querySeconds } };
+}
+
+//------------------------------------------------------------------------------
+BenchResult BenchmarkCellArrayTraversal(vtkIdType numTriangles)
+{
+  vtkNew<vtkCellArray> cells;
+  cells->AllocateExact(numTriangles, 3 * numTriangles);
+  for (vtkIdType i = 0; i < numTriangles; ++i)
+  {
+    const vtkIdType tri[3] = { i, i + 1, i + 2 };
+    cells->InsertNextCell(3, tri);
+  }
+
+  double seconds = BestTime(
+    [&]()
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      vtkIdType sum = 0;
+      auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+      for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+      {
+        iter->GetCurrentCell(npts, pts);
+        sum += pts[npts - 1];
+      }
+      if (sum == 0)
+      {
+        std::cerr << "CellArrayTraversal: unexpected connectivity\n";
+      }
+    });
+  return { "CellArrayTraversal", numTriangles, seconds };
+}
+
+//------------------------------------------------------------------------------
+std::vector<BenchResult> BenchmarkSMPScaling(vtkIdType numValues)
+{
+  std::vector<double> values(numValues);
+  for (vtkIdType i = 0; i < numValues; ++i)
+  {
+    values[i] = static_cast<double>(i % 4096);
+  }
+  std::vector<double> results(numValues);
+
+  auto transform = [&](vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      double v = values[i];
+      results[i] = v * 1.0001 + std::sqrt(v + 1.0);
+    }
+  };
+
+  double serialSeconds = BestTime([&]() { transform(0, numValues); });
+  double parallelSeconds = BestTime([&]() { vtkSMPTools::For(0, numValues, transform); });
+
+  return { { "SMPTransformSerial", numValues, serialSeconds },
+    { "SMPTransformParallel", numValues, parallelSeconds } };
+}
+
+//------------------------------------------------------------------------------
+BenchResult BenchmarkFlyingEdges3D(int dimension)
+{
+  vtkNew<vtkImageData> volume;
+  volume->SetDimensions(dimension, dimension, dimension);
+  volume->AllocateScalars(VTK_FLOAT, 1);
+  float* scalars = static_cast<float*>(volume->GetScalarPointer());
+  const double center = 0.5 * (dimension - 1);
+  vtkSMPTools::For(0, dimension,
+    [&](vtkIdType kBegin, vtkIdType kEnd)
+    {
+      for (vtkIdType k = kBegin; k < kEnd; ++k)
+      {
+        for (vtkIdType j = 0; j < dimension; ++j)
+        {
+          for (vtkIdType i = 0; i < dimension; ++i)
+          {
+            double dx = i - center;
+            double dy = j - center;
+            double dz = k - center;
+            scalars[(k * dimension + j) * dimension + i] =
+              static_cast<float>(std::sqrt(dx * dx + dy * dy + dz * dz));
+          }
+        }
+      }
+    });
+
+  vtkNew<vtkFlyingEdges3D> contour;
+  contour->SetInputData(volume);
+  contour->SetValue(0, 0.4 * dimension);
+  double seconds = BestTime(
+    [&]()
+    {
+      contour->Modified();
+      contour->Update();
+    });
+  return { "FlyingEdges3D", volume->GetNumberOfPoints(), seconds };
+}
+
+//------------------------------------------------------------------------------
+void ReportResult(const BenchResult& result, std::ostream& table, std::ofstream* csv)
+{
+  double rate = result.Seconds > 0.0 ? result.Items / result.Seconds : 0.0;
+  table << result.Name << ": " << result.Items << " items in " << result.Seconds << " s ("
+        << rate << " items/s)\n";
+  if (csv && csv->is_open())
+  {
+    *csv << result.Name << "," << result.Items << "," << result.Seconds << "," << rate << "\n";
+  }
+}
+
+} // end anonymous namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  double scale = 1.0;
+  std::string csvFileName;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+    {
+      csvFileName = argv[++i];
+    }
+    else if (strcmp(argv[i], "--scale") == 0 && i + 1 < argc)
+    {
+      scale = atof(argv[++i]);
+    }
+    else
+    {
+      std::cout << "Usage: " << argv[0] << " [-o baseline.csv] [--scale s]\n";
+      return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+    }
+  }
+  if (scale <= 0.0)
+  {
+    std::cerr << "--scale must be positive\n";
+    return 1;
+  }
+
+  std::ofstream csv;
+  if (!csvFileName.empty())
+  {
+    csv.open(csvFileName);
+    if (!csv)
+    {
+      std::cerr << "Could not open " << csvFileName << " for writing\n";
+      return 1;
+    }
+    csv << "name,items,seconds,items_per_second\n";
+  }
+
+  ReportResult(
+    BenchmarkArrayDispatch(static_cast<vtkIdType>(scale * 10000000)), std::cout, &csv);
+  for (const BenchResult& result :
+    BenchmarkStaticCellLocator(static_cast<int>(scale * 512), static_cast<vtkIdType>(scale * 100000)))
+  {
+    ReportResult(result, std::cout, &csv);
+  }
+  ReportResult(
+    BenchmarkCellArrayTraversal(static_cast<vtkIdType>(scale * 5000000)), std::cout, &csv);
+  for (const BenchResult& result : BenchmarkSMPScaling(static_cast<vtkIdType>(scale * 50000000)))
+  {
+    ReportResult(result, std::cout, &csv);
+  }
+  ReportResult(BenchmarkFlyingEdges3D(static_cast<int>(scale * 128)), std::cout, &csv);
+
+  return 0;
+}
@@ -37,6 +37,10 @@ int main(int argc, char* argv[])
 
   a.TestsToRun.push_back(new manyActorTest("ManyActors"));
 
+  a.TestsToRun.push_back(new compositeTest("CompositeBlocks"));
+
+  a.TestsToRun.push_back(new hardwareSelectionTest("HardwareSelection"));
+
   // process them
   return a.ParseCommandLineArguments(argc, argv);
 }
@@ -472,10 +472,14 @@ public:
     ren1->GetActiveCamera()->Zoom(1.2);
     ren1->ResetCameraClippingRange();
 
+    vtkRTFrameTimer frameTimer;
+    frameTimer.Initialize(renWindow.GetPointer());
+
     int frameCount = 80;
     for (int i = 0; i < frameCount; i++)
     {
       renWindow->Render();
+      frameTimer.Sample();
       ren1->GetActiveCamera()->Azimuth(0.5);
       ren1->GetActiveCamera()->Elevation(0.5);
       ren1->ResetCameraClippingRange();
@@ -487,12 +491,14 @@ public:
     }
     double subsequentFrameTime =
       (vtkTimerLog::GetUniversalTime() - startTime - firstFrameTime) / frameCount;
+    frameTimer.Finish();
 
     vtkRTTestResult result;
     result.Results["first frame time"] = firstFrameTime;
     result.Results["subsequent frame time"] = subsequentFrameTime;
     result.Results["Mvoxels/sec"] = static_cast<double>(res1 * res2 * res3) / subsequentFrameTime;
     result.Results["Mvoxels"] = res1 * res2 * res3;
+    frameTimer.AddResults(result);
 
     return result;
   }
@@ -598,10 +604,14 @@ public:
     ren1->GetActiveCamera()->Azimuth(90);
     ren1->ResetCameraClippingRange();
 
+    vtkRTFrameTimer frameTimer;
+    frameTimer.Initialize(renWindow.Get());
+
     int frameCount = 80;
     for (int i = 0; i < frameCount; i++)
     {
       renWindow->Render();
+      frameTimer.Sample();
       ren1->GetActiveCamera()->Azimuth(1);
       ren1->GetActiveCamera()->Elevation(1);
       if ((vtkTimerLog::GetUniversalTime() - startTime - firstFrameTime) > this->TargetTime * 1.5)
@@ -612,6 +622,7 @@ public:
     }
     double subsequentFrameTime =
       (vtkTimerLog::GetUniversalTime() - startTime - firstFrameTime) / frameCount;
+    frameTimer.Finish();
     double numTris = PFS->GetOutput()->GetPolys()->GetNumberOfCells();
     numTris *= NUM_ACTORS;
 
@@ -620,6 +631,7 @@ public:
     result.Results["subsequent frame time"] = subsequentFrameTime;
     result.Results["FPS"] = 1. / subsequentFrameTime;
     result.Results["triangles"] = numTris;
+    frameTimer.AddResults(result);
 
     return result;
   }
@@ -727,6 +739,223 @@ public:
 protected:
 };
 
+/*=========================================================================
+Define a test for composite dataset mapper block scaling
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkCompositePolyDataMapper.h"
+#include "vtkMultiBlockDataSet.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class compositeTest : public vtkRTTest
+{
+public:
+  compositeTest(const char* name)
+    : vtkRTTest(name)
+  {
+  }
+
+  const char* GetSummaryResultName() override { return "blocks/sec"; }
+
+  const char* GetSecondSummaryResultName() override { return "blocks"; }
+
+  vtkRTTestResult Run(vtkRTTestSequence* ats, int /*argc*/, char* /* argv */[]) override
+  {
+    int ures, vres;
+    ats->GetSequenceNumbers(ures, vres);
+
+    // build a grid of sphere blocks so the mapper's per-block handling
+    // dominates over the per-triangle cost
+    vtkNew<vtkSphereSource> sphere;
+    sphere->SetPhiResolution(8);
+    sphere->SetThetaResolution(16);
+    sphere->SetRadius(0.7);
+
+    vtkNew<vtkMultiBlockDataSet> blocks;
+    blocks->SetNumberOfBlocks(100 * ures * vres);
+    unsigned int blockId = 0;
+    for (int u = 0; u < ures * 10; ++u)
+    {
+      for (int v = 0; v < vres * 10; ++v)
+      {
+        sphere->SetCenter(2.0 * u, 2.0 * v, 0.0);
+        sphere->Update();
+        vtkNew<vtkPolyData> block;
+        block->DeepCopy(sphere->GetOutput());
+        blocks->SetBlock(blockId++, block.Get());
+      }
+    }
+
+    vtkNew<vtkCompositePolyDataMapper> mapper;
+    mapper->SetInputDataObject(blocks.Get());
+    mapper->StaticOn();
+
+    vtkNew<vtkActor> actor;
+    actor->SetMapper(mapper.Get());
+
+    // create a rendering window and renderer
+    vtkNew<vtkRenderer> ren1;
+    vtkNew<vtkRenderWindow> renWindow;
+    renWindow->AddRenderer(ren1.Get());
+    ren1->AddActor(actor.Get());
+
+    // set the size/color of our window
+    renWindow->SetSize(this->GetRenderWidth(), this->GetRenderHeight());
+    ren1->SetBackground(0.2, 0.3, 0.5);
+
+    // draw the resulting scene
+    double startTime = vtkTimerLog::GetUniversalTime();
+    renWindow->Render();
+    double firstFrameTime = vtkTimerLog::GetUniversalTime() - startTime;
+    ren1->GetActiveCamera()->Zoom(0.5);
+    ren1->ResetCameraClippingRange();
+
+    vtkRTFrameTimer frameTimer;
+    frameTimer.Initialize(renWindow.Get());
+
+    int frameCount = 80;
+    for (int i = 0; i < frameCount; i++)
+    {
+      renWindow->Render();
+      frameTimer.Sample();
+      ren1->GetActiveCamera()->Azimuth(1);
+      ren1->GetActiveCamera()->Elevation(1);
+      ren1->ResetCameraClippingRange();
+      if ((vtkTimerLog::GetUniversalTime() - startTime - firstFrameTime) > this->TargetTime * 1.5)
+      {
+        frameCount = i + 1;
+        break;
+      }
+    }
+    double subsequentFrameTime =
+      (vtkTimerLog::GetUniversalTime() - startTime - firstFrameTime) / frameCount;
+    frameTimer.Finish();
+    double numBlocks = blocks->GetNumberOfBlocks();
+
+    vtkRTTestResult result;
+    result.Results["first frame time"] = firstFrameTime;
+    result.Results["subsequent frame time"] = subsequentFrameTime;
+    result.Results["frames/sec"] = 1.0 / subsequentFrameTime;
+    result.Results["blocks"] = numBlocks;
+    result.Results["blocks/sec"] = numBlocks / subsequentFrameTime;
+    frameTimer.AddResults(result);
+
+    return result;
+  }
+
+protected:
+};
+
+/*=========================================================================
+Define a test for hardware selection
+=========================================================================*/
+VTK_ABI_NAMESPACE_END
+#include "vtkDataObject.h"
+#include "vtkHardwareSelector.h"
+#include "vtkSelection.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class hardwareSelectionTest : public vtkRTTest
+{
+public:
+  hardwareSelectionTest(const char* name)
+    : vtkRTTest(name)
+  {
+  }
+
+  const char* GetSummaryResultName() override { return "selections/sec"; }
+
+  const char* GetSecondSummaryResultName() override { return "actors"; }
+
+  vtkRTTestResult Run(vtkRTTestSequence* ats, int /*argc*/, char* /* argv */[]) override
+  {
+    int ures, vres;
+    ats->GetSequenceNumbers(ures, vres);
+
+    vtkNew<vtkSphereSource> sphere;
+    sphere->SetPhiResolution(8);
+    sphere->SetThetaResolution(16);
+    sphere->SetRadius(0.7);
+
+    // create a rendering window and renderer
+    vtkNew<vtkRenderer> ren1;
+    vtkNew<vtkRenderWindow> renWindow;
+    renWindow->AddRenderer(ren1.Get());
+
+    // a grid of pickable actors so the selection passes have to encode
+    // many prop ids
+    for (int u = 0; u < ures * 10; ++u)
+    {
+      for (int v = 0; v < vres * 10; ++v)
+      {
+        vtkNew<vtkPolyDataMapper> mapper;
+        mapper->SetInputConnection(sphere->GetOutputPort());
+        mapper->StaticOn();
+
+        vtkNew<vtkActor> actor;
+        actor->SetMapper(mapper.Get());
+        actor->SetPosition(2.0 * u, 2.0 * v, 0.0);
+        ren1->AddActor(actor.Get());
+      }
+    }
+
+    // set the size/color of our window
+    renWindow->SetSize(this->GetRenderWidth(), this->GetRenderHeight());
+    ren1->SetBackground(0.2, 0.3, 0.5);
+
+    // draw the scene once so every prop is visible to the selector
+    double startTime = vtkTimerLog::GetUniversalTime();
+    renWindow->Render();
+    ren1->ResetCamera();
+    renWindow->Render();
+    double firstFrameTime = vtkTimerLog::GetUniversalTime() - startTime;
+
+    vtkNew<vtkHardwareSelector> selector;
+    selector->SetRenderer(ren1.Get());
+    selector->SetArea(0, 0, static_cast<unsigned int>(this->GetRenderWidth() - 1),
+      static_cast<unsigned int>(this->GetRenderHeight() - 1));
+    selector->SetFieldAssociation(vtkDataObject::FIELD_ASSOCIATION_CELLS);
+
+    vtkRTFrameTimer frameTimer;
+    frameTimer.Initialize(renWindow.Get());
+
+    // select the full viewport repeatedly, each Select runs the whole
+    // set of selection render passes
+    double numHits = 0.0;
+    int selectionCount = 50;
+    for (int i = 0; i < selectionCount; i++)
+    {
+      vtkSelection* selection = selector->Select();
+      frameTimer.Sample();
+      if (selection)
+      {
+        numHits = selection->GetNumberOfNodes();
+        selection->Delete();
+      }
+      if ((vtkTimerLog::GetUniversalTime() - startTime - firstFrameTime) > this->TargetTime * 1.5)
+      {
+        selectionCount = i + 1;
+        break;
+      }
+    }
+    double selectionTime =
+      (vtkTimerLog::GetUniversalTime() - startTime - firstFrameTime) / selectionCount;
+    frameTimer.Finish();
+
+    vtkRTTestResult result;
+    result.Results["first frame time"] = firstFrameTime;
+    result.Results["selection time"] = selectionTime;
+    result.Results["selections/sec"] = 1.0 / selectionTime;
+    result.Results["selected nodes"] = numHits;
+    result.Results["actors"] = 100.0 * ures * vres;
+    frameTimer.AddResults(result);
+
+    return result;
+  }
+
+protected:
+};
+
 VTK_ABI_NAMESPACE_END
 #endif
 // VTK-HeaderTest-Exclude: vtkRenderTimingTests.h
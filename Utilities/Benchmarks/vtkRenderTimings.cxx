@@ -8,6 +8,9 @@
 #include <vtksys/RegularExpression.hxx>
 #include <vtksys/SystemInformation.hxx>
 
+#include <cstdlib>
+#include <string>
+
 #include "vtkAxis.h"
 #include "vtkChartLegend.h"
 #include "vtkChartXY.h"
@@ -16,10 +19,99 @@
 #include "vtkDelimitedTextWriter.h"
 #include "vtkDoubleArray.h"
 #include "vtkPlot.h"
+#include "vtkRenderTimerLog.h"
 #include "vtkRenderWindow.h"
 #include "vtkTable.h"
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// sum each named event into the totals, recursing into nested events
+void AccumulateGPUEvents(
+  const std::vector<vtkRenderTimerLog::Event>& events, std::map<std::string, double>& totals)
+{
+  std::vector<vtkRenderTimerLog::Event>::const_iterator eItr;
+  for (eItr = events.begin(); eItr != events.end(); ++eItr)
+  {
+    totals[eItr->Name] += eItr->ElapsedTimeSeconds();
+    AccumulateGPUEvents(eItr->Events, totals);
+  }
+}
+}
+
+void vtkRTFrameTimer::Initialize(vtkRenderWindow* renWindow)
+{
+  this->RenderWindow = renWindow;
+  this->TimerLog = renWindow->GetRenderTimer();
+  this->GPUSupported = this->TimerLog->IsSupported();
+  if (this->GPUSupported)
+  {
+    this->TimerLog->LoggingEnabledOn();
+  }
+}
+
+void vtkRTFrameTimer::Sample()
+{
+  if (this->GPUSupported)
+  {
+    this->HarvestFrames();
+  }
+}
+
+void vtkRTFrameTimer::Finish()
+{
+  if (!this->GPUSupported)
+  {
+    return;
+  }
+  // the last frame stays current until the next MarkFrame, close it and
+  // wait for its queries so that every rendered frame gets harvested
+  this->TimerLog->MarkFrame();
+  this->RenderWindow->WaitForCompletion();
+  this->HarvestFrames();
+  this->TimerLog->LoggingEnabledOff();
+}
+
+void vtkRTFrameTimer::HarvestFrames()
+{
+  while (this->TimerLog->FrameReady())
+  {
+    vtkRenderTimerLog::Frame frame = this->TimerLog->PopFirstReadyFrame();
+    if (frame.Events.empty())
+    {
+      continue;
+    }
+    std::vector<vtkRenderTimerLog::Event>::iterator eItr;
+    for (eItr = frame.Events.begin(); eItr != frame.Events.end(); ++eItr)
+    {
+      // a top level event spans an entire vtkRenderWindow::Render, the
+      // nested events below it are the individual render passes
+      this->GPUSeconds += eItr->ElapsedTimeSeconds();
+      AccumulateGPUEvents(eItr->Events, this->GPUEventSeconds);
+    }
+    this->GPUFrameCount++;
+  }
+}
+
+double vtkRTFrameTimer::GetAverageGPUFrameTime()
+{
+  return this->GPUFrameCount ? this->GPUSeconds / this->GPUFrameCount : 0.0;
+}
+
+void vtkRTFrameTimer::AddResults(vtkRTTestResult& result)
+{
+  if (!this->GPUSupported || this->GPUFrameCount == 0)
+  {
+    return;
+  }
+  result.Results["GPU frame time"] = this->GPUSeconds / this->GPUFrameCount;
+  std::map<std::string, double>::iterator gItr;
+  for (gItr = this->GPUEventSeconds.begin(); gItr != this->GPUEventSeconds.end(); ++gItr)
+  {
+    result.Results["GPU " + gItr->first] = gItr->second / this->GPUFrameCount;
+  }
+}
+
 void vtkRTTestSequence::GetSequenceNumbers(int& xdim)
 {
   static int linearSequence[] = { 1, 2, 3, 5 };
@@ -170,6 +262,23 @@ void vtkRTTestSequence::Run()
   }
 }
 
+double vtkRTTestSequence::GetBestSummaryResult()
+{
+  double result = 0.0;
+  bool initialized = false;
+  std::vector<vtkRTTestResult>::iterator trItr;
+  for (trItr = this->TestResults.begin(); trItr != this->TestResults.end(); ++trItr)
+  {
+    double value = trItr->Results[this->Test->GetSummaryResultName()];
+    if (!initialized || (this->Test->UseLargestSummaryResult() ? value > result : value < result))
+    {
+      result = value;
+      initialized = true;
+    }
+  }
+  return result;
+}
+
 void vtkRTTestSequence::ReportSummaryResults(ostream& ost)
 {
   double result = 0.0;
@@ -235,6 +344,7 @@ vtkRenderTimings::vtkRenderTimings()
   this->SequenceEnd = 0;
   this->SequenceStepTimeLimit = 15.0; // seconds
   this->DetailedResultsFileName = "results.csv";
+  this->BaselineTolerance = 0.2;
   this->RenderWidth = 600;
   this->RenderHeight = 600;
 }
@@ -300,6 +410,75 @@ void vtkRenderTimings::ReportResults()
   rfile.close();
 }
 
+void vtkRenderTimings::WriteBaseline()
+{
+  vtksys::ofstream bfile;
+  bfile.open(this->WriteBaselineFileName.c_str());
+  std::vector<vtkRTTestSequence*>::iterator tsItr;
+  for (tsItr = this->TestSequences.begin(); tsItr != this->TestSequences.end(); ++tsItr)
+  {
+    bfile << (*tsItr)->Test->GetName() << ", " << (*tsItr)->GetBestSummaryResult() << "\n";
+  }
+  bfile.close();
+  cout << "Baseline written to " << this->WriteBaselineFileName << endl;
+}
+
+int vtkRenderTimings::CheckBaseline()
+{
+  // read the baseline, one "test name, summary result" pair per line
+  std::map<std::string, double> baseline;
+  vtksys::ifstream bfile(this->BaselineFileName.c_str());
+  if (!bfile)
+  {
+    cerr << "Unable to open baseline file " << this->BaselineFileName << endl;
+    return 1;
+  }
+  std::string line;
+  while (std::getline(bfile, line))
+  {
+    std::string::size_type comma = line.rfind(',');
+    if (comma == std::string::npos)
+    {
+      continue;
+    }
+    std::string name = line.substr(0, comma);
+    name.erase(name.find_last_not_of(" \t\r") + 1);
+    baseline[name] = atof(line.c_str() + comma + 1);
+  }
+
+  // a summary result may be up to BaselineTolerance worse than its
+  // baseline, in whichever direction is worse for that test
+  int regressions = 0;
+  std::vector<vtkRTTestSequence*>::iterator tsItr;
+  for (tsItr = this->TestSequences.begin(); tsItr != this->TestSequences.end(); ++tsItr)
+  {
+    std::string name = (*tsItr)->Test->GetName();
+    std::map<std::string, double>::iterator bItr = baseline.find(name);
+    if (bItr == baseline.end())
+    {
+      cout << name << ": no baseline, skipping" << endl;
+      continue;
+    }
+    double value = (*tsItr)->GetBestSummaryResult();
+    bool failed = (*tsItr)->Test->UseLargestSummaryResult()
+      ? value < bItr->second * (1.0 - this->BaselineTolerance)
+      : value > bItr->second * (1.0 + this->BaselineTolerance);
+    if (failed)
+    {
+      cerr << "REGRESSION: " << name << ": " << value << " "
+           << (*tsItr)->Test->GetSummaryResultName() << " versus a baseline of " << bItr->second
+           << endl;
+      regressions++;
+    }
+    else
+    {
+      cout << name << ": within tolerance of baseline (" << value << " versus " << bItr->second
+           << ")" << endl;
+    }
+  }
+  return regressions;
+}
+
 int vtkRenderTimings::ParseCommandLineArguments(int argc, char* argv[])
 {
   this->Arguments.Initialize(argc, argv);
@@ -337,6 +516,21 @@ int vtkRenderTimings::ParseCommandLineArguments(int argc, char* argv[])
     "-list", &this->ListTests, "Provide a listing of available tests.");
   this->Arguments.AddBooleanArgument(
     "-nochart", &this->NoChartResults, "Suppress realtime charting of test performance.");
+  this->Arguments.AddArgument("-baseline", argT::SPACE_ARGUMENT, &this->BaselineFileName,
+    "Specify a baseline file to compare the summary results against. Any "
+    "test whose summary result is worse than its baseline by more than "
+    "the tolerance is reported as a regression and counted in the exit "
+    "code, so CTest can gate on stored baselines.");
+  this->Arguments.AddArgument("-writebaseline", argT::SPACE_ARGUMENT,
+    &this->WriteBaselineFileName,
+    "Write the summary results to the named file in the format expected "
+    "by -baseline. Run this once on the machine that will gate on the "
+    "results.");
+  this->Arguments.AddArgument("-tolerance", argT::SPACE_ARGUMENT, &this->BaselineTolerance,
+    "Specify the fractional tolerance used when comparing against a "
+    "baseline. The default of 0.2 allows a summary result to be up to "
+    "20 percent worse than its baseline before it is reported as a "
+    "regression.");
   this->Arguments.AddArgument(
     "-width", argT::SPACE_ARGUMENT, &this->RenderWidth, "Width of benchmark rendering window.");
   this->Arguments.AddArgument(
@@ -384,6 +578,15 @@ int vtkRenderTimings::ParseCommandLineArguments(int argc, char* argv[])
   this->RunTests();
   this->ReportResults();
 
+  if (!this->WriteBaselineFileName.empty())
+  {
+    this->WriteBaseline();
+  }
+  if (!this->BaselineFileName.empty())
+  {
+    return this->CheckBaseline();
+  }
+
   return 0;
 }
 VTK_ABI_NAMESPACE_END
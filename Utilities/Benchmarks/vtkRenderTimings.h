@@ -11,12 +11,15 @@
 #include "vtkTimerLog.h"
 #include "vtkUtilitiesBenchmarksModule.h"
 #include <map>
+#include <string>
 #include <vtksys/CommandLineArguments.hxx>
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkRTTestResult;
 class vtkRTTestSequence;
+class vtkRenderTimerLog;
 class vtkRenderTimings;
+class vtkRenderWindow;
 
 class VTKUTILITIESBENCHMARKS_EXPORT vtkRTTest
 {
@@ -87,6 +90,45 @@ public:
   }
 };
 
+// a helper tests can use to collect GPU frame times and a per-pass
+// breakdown from the render window's vtkRenderTimerLog while their
+// render loop runs. Call Initialize after the first Render (the timer
+// queries need a live OpenGL context), Sample after each subsequent
+// Render, Finish once the loop is done, and AddResults to fold the
+// per-frame averages into the test result. When the graphics backend
+// does not support timestamp queries all of this quietly does nothing.
+class VTKUTILITIESBENCHMARKS_EXPORT vtkRTFrameTimer
+{
+public:
+  // enable GPU timing on the window, requires a live context
+  void Initialize(vtkRenderWindow* renWindow);
+
+  // harvest any frames whose timings have become available, call this
+  // once per render loop iteration so queries do not back up
+  void Sample();
+
+  // close the last frame, wait for the outstanding queries and harvest
+  // the remaining timings
+  void Finish();
+
+  // mean GPU seconds per harvested frame, zero when unsupported
+  double GetAverageGPUFrameTime();
+
+  // add a "GPU frame time" entry plus one "GPU <event name>" entry per
+  // timed render pass to the results, all mean seconds per frame
+  void AddResults(vtkRTTestResult& result);
+
+protected:
+  void HarvestFrames();
+
+  vtkRenderWindow* RenderWindow = nullptr;
+  vtkRenderTimerLog* TimerLog = nullptr;
+  bool GPUSupported = false;
+  double GPUSeconds = 0.0;
+  int GPUFrameCount = 0;
+  std::map<std::string, double> GPUEventSeconds;
+};
+
 class VTKUTILITIESBENCHMARKS_EXPORT vtkRTTestSequence
 {
 public:
@@ -94,6 +136,10 @@ public:
   virtual void ReportSummaryResults(ostream& ost);
   virtual void ReportDetailedResults(ostream& ost);
 
+  // the best summary result over the sequence, the same value that the
+  // summary report prints and that baselines are compared against
+  double GetBestSummaryResult();
+
   // tests should use these functions to determine what resolution
   // to use in scaling their test. The functions will always return
   // numbers then when multiplied will result in 1, 2, 3, or 5
@@ -162,6 +208,13 @@ protected:
   int RunTests();
   void ReportResults();
 
+  // write the summary results in the format -baseline expects
+  void WriteBaseline();
+
+  // compare the summary results against the stored baseline, reporting
+  // and returning the number of tests that regressed beyond the tolerance
+  int CheckBaseline();
+
 private:
   std::string Regex; // regular expression for tests
   double TargetTime;
@@ -174,6 +227,9 @@ private:
   int SequenceEnd;
   double SequenceStepTimeLimit;
   std::string DetailedResultsFileName;
+  std::string BaselineFileName;
+  std::string WriteBaselineFileName;
+  double BaselineTolerance;
   int RenderWidth;
   int RenderHeight;
 };
@@ -110,6 +110,8 @@ vtkStandardNewMacro(vtkWebApplication);
 vtkWebApplication::vtkWebApplication()
   : ImageEncoding(ENCODING_BASE64)
   , ImageCompression(COMPRESSION_JPEG)
+  , DeltaEncoding(false)
+  , LastEncodedRegion{ 0, 0, 0, 0 }
   , Internals(new vtkWebApplication::vtkInternals())
 {
 }
@@ -182,6 +184,11 @@ vtkUnsignedCharArray* vtkWebApplication::StillRender(vtkRenderWindow* view, int
   // vtkTimerLog::MarkStartEvent("StillRenderToString");
   // vtkTimerLog::MarkStartEvent("CaptureWindow");
 
+  if (this->DeltaEncoding)
+  {
+    view->TrackDamageRegionsOn();
+  }
+
   view->Render();
 
   // TODO: We should add logic to check if a new rendering needs to be done and
@@ -197,6 +204,31 @@ vtkUnsignedCharArray* vtkWebApplication::StillRender(vtkRenderWindow* view, int
   auto image = vtkSmartPointer<vtkImageData>::New();
   image->ShallowCopy(w2i->GetOutput());
 
+  int extent[6];
+  image->GetExtent(extent);
+  this->LastEncodedRegion[0] = extent[0];
+  this->LastEncodedRegion[1] = extent[2];
+  this->LastEncodedRegion[2] = extent[1];
+  this->LastEncodedRegion[3] = extent[3];
+  if (this->DeltaEncoding)
+  {
+    // Only ship a delta tile when the client already has a frame to patch
+    // and the damaged area is a proper subset of the view.
+    int damage[4];
+    if (value.Data != nullptr && view->GetDamageRegion(damage) &&
+      (damage[0] > extent[0] || damage[1] > extent[2] || damage[2] < extent[1] ||
+        damage[3] < extent[3]))
+    {
+      int cropExtent[6] = { damage[0], damage[2], damage[1], damage[3], 0, 0 };
+      image->Crop(cropExtent);
+      this->LastEncodedRegion[0] = damage[0];
+      this->LastEncodedRegion[1] = damage[1];
+      this->LastEncodedRegion[2] = damage[2];
+      this->LastEncodedRegion[3] = damage[3];
+    }
+    view->ResetDamageRegion();
+  }
+
   // vtkTimerLog::MarkEndEvent("CaptureWindow");
 
   // vtkTimerLog::MarkEndEvent("StillRenderToString");
@@ -446,6 +478,7 @@ void vtkWebApplication::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "ImageEncoding: " << this->ImageEncoding << endl;
   os << indent << "ImageCompression: " << this->ImageCompression << endl;
+  os << indent << "DeltaEncoding: " << (this->DeltaEncoding ? "On" : "Off") << endl;
 }
 
 //------------------------------------------------------------------------------
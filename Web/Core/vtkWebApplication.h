@@ -56,6 +56,34 @@ public:
   vtkGetMacro(ImageCompression, int);
   ///@}
 
+  ///@{
+  /**
+   * When enabled, StillRender() turns damage-region tracking on for the
+   * view and encodes only the sub-image covering what changed since the
+   * previous render instead of the full frame. This cuts bandwidth
+   * dramatically during interaction on mostly-static scenes (e.g. when
+   * only a widget handle moves). Use GetLastEncodedRegion() to recover
+   * the placement of the encoded tile; the protocol layer is expected to
+   * ship the region alongside the encoded data so the client can
+   * composite the tile over its previous frame. Full frames are still
+   * produced whenever the whole window changed (camera motion, resize)
+   * or no previous frame exists. Off by default.
+   */
+  vtkSetMacro(DeltaEncoding, bool);
+  vtkGetMacro(DeltaEncoding, bool);
+  vtkBooleanMacro(DeltaEncoding, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Returns the view region {xmin, ymin, xmax, ymax} covered by the image
+   * pushed to the encoder by the most recent StillRender(), in pixels
+   * with the origin in the lower left corner. This spans the whole view
+   * unless DeltaEncoding produced a delta tile.
+   */
+  vtkGetVector4Macro(LastEncodedRegion, int);
+  ///@}
+
   ///@{
   /**
    * Set the number of worker threads to use for image encoding.  Calling this
@@ -130,6 +158,8 @@ protected:
 
   int ImageEncoding;
   int ImageCompression;
+  bool DeltaEncoding;
+  int LastEncodedRegion[4];
   vtkMTimeType LastStillRenderToMTime;
 
 private:
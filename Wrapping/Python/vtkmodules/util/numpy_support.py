@@ -167,10 +167,10 @@ def numpy_to_vtk(num_array, deep=0, array_type=None):
         z_flat = numpy.ravel(z)
     else:
         z_flat = numpy.ravel(z).astype(arr_dtype)
-        # z_flat is now a standalone object with no references from the caller.
-        # As such, it will drop out of this scope and cause memory issues if we
-        # do not deep copy its data.
-        deep = 1
+        # z_flat is a standalone copy with no references from the caller, so
+        # the VTK array can simply keep it alive through _numpy_reference
+        # below; a second deep copy of the converted data is not needed.
+        z = z_flat
 
     # Point the VTK array to the numpy data.  The last argument (1)
     # tells the array not to deallocate.